@@ -0,0 +1,121 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <filesystem>
+#include <format>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+#include <spdlog/logger.h>
+#include <spdlog/sinks/rotating_file_sink.h>
+
+#include "JzRE/Runtime/Core/JzLogger.h"
+
+using namespace JzRE;
+
+namespace {
+
+/**
+ * @brief The previous macros: format eagerly, then let spdlog check the level and write synchronously.
+ */
+#define JzRE_BENCH_LEGACY_LOG(logger, level, ...) (logger)->log(level, std::format(__VA_ARGS__))
+
+std::shared_ptr<spdlog::logger> CreateLegacyLogger()
+{
+    const auto path   = std::filesystem::temp_directory_path() / "JzREBenchLegacy.log";
+    auto       sink   = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(path.string(), 1048576 * 5, 3);
+    auto       logger = std::make_shared<spdlog::logger>("bench_legacy", sink);
+    logger->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%l] %v");
+    logger->set_level(spdlog::level::info);
+    logger->flush_on(spdlog::level::info);
+    return logger;
+}
+
+void PrepareAsyncLogger(JzELogLevel level)
+{
+    auto &logger = JzLogger::GetInstance();
+    logger.SetConsoleOutput(false);
+    logger.SetLevel(level);
+}
+
+} // namespace
+
+static void BM_Logger_Legacy_Disabled(benchmark::State &state)
+{
+    auto logger = CreateLegacyLogger();
+
+    I32 frame = 0;
+    for (auto _ : state) {
+        JzRE_BENCH_LEGACY_LOG(logger, spdlog::level::debug, "Entity {} moved to ({}, {}, {})", frame++, 1.0f, 2.0f, 3.0f);
+    }
+}
+BENCHMARK(BM_Logger_Legacy_Disabled);
+
+static void BM_Logger_Async_RuntimeDisabled(benchmark::State &state)
+{
+    PrepareAsyncLogger(JzELogLevel::Warning);
+
+    I32 frame = 0;
+    for (auto _ : state) {
+        JzRE_LOG_INFO("Entity {} moved to ({}, {}, {})", frame++, 1.0f, 2.0f, 3.0f);
+    }
+    benchmark::DoNotOptimize(frame);
+
+    JzLogger::GetInstance().SetLevel(JzELogLevel::Info);
+}
+BENCHMARK(BM_Logger_Async_RuntimeDisabled);
+
+static void BM_Logger_Async_CompileStripped(benchmark::State &state)
+{
+    // Stripped in builds with NDEBUG, otherwise rejected by the runtime level
+    PrepareAsyncLogger(JzELogLevel::Info);
+
+    I32 frame = 0;
+    for (auto _ : state) {
+        JzRE_LOG_TRACE("Entity {} moved to ({}, {}, {})", frame++, 1.0f, 2.0f, 3.0f);
+    }
+    benchmark::DoNotOptimize(frame);
+}
+BENCHMARK(BM_Logger_Async_CompileStripped);
+
+static void BM_Logger_Legacy_Enabled(benchmark::State &state)
+{
+    auto logger = CreateLegacyLogger();
+
+    I32 frame = 0;
+    for (auto _ : state) {
+        JzRE_BENCH_LEGACY_LOG(logger, spdlog::level::info, "Entity {} moved to ({}, {}, {})", frame++, 1.0f, 2.0f, 3.0f);
+    }
+}
+BENCHMARK(BM_Logger_Legacy_Enabled);
+
+static void BM_Logger_Async_Enabled(benchmark::State &state)
+{
+    // Measures the calling thread; the writer blocks only once its ring is full
+    PrepareAsyncLogger(JzELogLevel::Info);
+
+    I32 frame = 0;
+    for (auto _ : state) {
+        JzRE_LOG_INFO("Entity {} moved to ({}, {}, {})", frame++, 1.0f, 2.0f, 3.0f);
+    }
+
+    // Outside the timed loop
+    JzLogger::GetInstance().Flush();
+}
+BENCHMARK(BM_Logger_Async_Enabled)->Threads(1)->Threads(4);
+
+static void BM_Logger_Async_EnabledString(benchmark::State &state)
+{
+    PrepareAsyncLogger(JzELogLevel::Info);
+
+    const String name = "Assets/Models/Sponza/sponza.gltf";
+    for (auto _ : state) {
+        JzRE_LOG_INFO("Loaded model {} with {} meshes", name, 103);
+    }
+
+    // Outside the timed loop
+    JzLogger::GetInstance().Flush();
+}
+BENCHMARK(BM_Logger_Async_EnabledString);
@@ -0,0 +1,87 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "JzRE/Runtime/Core/JzMatrix.h"
+#include "JzRE/Runtime/Core/JzVector.h"
+
+using namespace JzRE;
+
+namespace {
+
+std::vector<JzMat4> MakeTransforms(Size count)
+{
+    std::vector<JzMat4> transforms;
+    transforms.reserve(count);
+    for (Size i = 0; i < count; ++i) {
+        const F32 value = static_cast<F32>(i);
+        transforms.push_back(JzMat4::Translate(JzVec3(value, value * 0.5f, -value)) * JzMat4::RotateY(value * 0.01f) *
+                             JzMat4::Scale(JzVec3(1.0f, 2.0f, 1.0f)));
+    }
+    return transforms;
+}
+
+} // namespace
+
+static void BM_Math_Mat4Multiply(benchmark::State &state)
+{
+    const auto   transforms = MakeTransforms(static_cast<Size>(state.range(0)));
+    const JzMat4 viewProjection =
+        JzMat4::Perspective(1.0f, 16.0f / 9.0f, 0.1f, 100.0f) *
+        JzMat4::LookAt(JzVec3(0.0f, 5.0f, 10.0f), JzVec3(0.0f, 0.0f, 0.0f), JzVec3(0.0f, 1.0f, 0.0f));
+
+    std::vector<JzMat4> results(transforms.size());
+    for (auto _ : state) {
+        for (Size i = 0; i < transforms.size(); ++i) {
+            results[i] = viewProjection * transforms[i];
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Math_Mat4Multiply)->Arg(1024)->Arg(16384);
+
+static void BM_Math_TransformPoints(benchmark::State &state)
+{
+    const JzMat4        transform = MakeTransforms(2).back();
+    std::vector<JzVec4> points(static_cast<Size>(state.range(0)), JzVec4(1.0f, 2.0f, 3.0f, 1.0f));
+
+    for (auto _ : state) {
+        for (auto &point : points) {
+            point = transform * point;
+        }
+        benchmark::DoNotOptimize(points.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Math_TransformPoints)->Arg(1024)->Arg(16384);
+
+static void BM_Math_Vec3Normalize(benchmark::State &state)
+{
+    std::vector<JzVec3> vectors;
+    vectors.reserve(static_cast<Size>(state.range(0)));
+    for (I64 i = 0; i < state.range(0); ++i) {
+        const F32 value = static_cast<F32>(i + 1);
+        vectors.emplace_back(value, -value * 0.5f, value * 0.25f);
+    }
+
+    for (auto _ : state) {
+        F32 sum = 0.0f;
+        for (const auto &vector : vectors) {
+            sum += vector.Normalized().Dot(vector);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Math_Vec3Normalize)->Arg(16384);
@@ -0,0 +1,129 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "JzRE/Runtime/Core/JzTaskGraph.h"
+#include "JzRE/Runtime/Core/JzThreadPool.h"
+
+using namespace JzRE;
+
+namespace {
+
+/**
+ * @brief Worker counts 1, 2, 4, ... up to the number of hardware threads.
+ */
+void ThreadCounts(benchmark::internal::Benchmark *benchmark)
+{
+    const I64 hardwareThreads = std::max<I64>(1, std::thread::hardware_concurrency());
+    for (I64 threads = 1; threads < hardwareThreads; threads *= 2) {
+        benchmark->Arg(threads);
+    }
+    benchmark->Arg(hardwareThreads);
+}
+
+F32 Work(F32 value)
+{
+    return std::sqrt(value * value + 1.0f) * 0.5f;
+}
+
+} // namespace
+
+static void BM_ThreadPool_ParallelFor(benchmark::State &state)
+{
+    // The calling thread helps, so one worker less gives the requested parallelism
+    JzThreadPool pool(static_cast<Size>(state.range(0) - 1));
+
+    std::vector<F32> data(1 << 22, 1.0f);
+    for (auto _ : state) {
+        pool.ParallelFor(0, data.size(), 4096, [&data](Size begin, Size end) {
+            for (Size i = begin; i < end; ++i) {
+                data[i] = Work(data[i]);
+            }
+        });
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(data.size()));
+}
+BENCHMARK(BM_ThreadPool_ParallelFor)->Apply(ThreadCounts)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+static void BM_ThreadPool_FineGrainedParallelFor(benchmark::State &state)
+{
+    JzThreadPool pool(static_cast<Size>(state.range(0) - 1));
+
+    std::vector<F32> data(1 << 18, 1.0f);
+    for (auto _ : state) {
+        pool.ParallelFor(0, data.size(), 64, [&data](Size begin, Size end) {
+            for (Size i = begin; i < end; ++i) {
+                data[i] = Work(data[i]);
+            }
+        });
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(data.size() / 64));
+    state.SetLabel("items = chunks");
+}
+BENCHMARK(BM_ThreadPool_FineGrainedParallelFor)->Apply(ThreadCounts)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+static void BM_ThreadPool_Submit(benchmark::State &state)
+{
+    JzThreadPool pool(static_cast<Size>(state.range(0)));
+
+    constexpr Size                 kTaskCount = 4096;
+    std::vector<std::future<void>> futures;
+    futures.reserve(kTaskCount);
+
+    for (auto _ : state) {
+        futures.clear();
+        for (Size i = 0; i < kTaskCount; ++i) {
+            futures.push_back(pool.Submit([]() { benchmark::DoNotOptimize(Work(2.0f)); }));
+        }
+        for (auto &future : futures) {
+            future.wait();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(kTaskCount));
+}
+BENCHMARK(BM_ThreadPool_Submit)->Apply(ThreadCounts)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+static void BM_ThreadPool_TaskGraphFanOut(benchmark::State &state)
+{
+    JzThreadPool pool(static_cast<Size>(state.range(0) - 1));
+    JzTaskGraph  graph;
+
+    constexpr Size   kTaskCount = 256;
+    std::vector<F32> results(kTaskCount, 1.0f);
+
+    const auto root = graph.AddTask([]() {});
+    const auto sink = graph.AddTask([]() {});
+    for (Size i = 0; i < kTaskCount; ++i) {
+        const auto task = graph.AddTask([&results, i]() {
+            F32 value = results[i];
+            for (U32 step = 0; step < 2048; ++step) {
+                value = Work(value);
+            }
+            results[i] = value;
+        });
+        graph.AddDependency(root, task);
+        graph.AddDependency(task, sink);
+    }
+
+    for (auto _ : state) {
+        pool.Run(graph);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(kTaskCount));
+}
+BENCHMARK(BM_ThreadPool_TaskGraphFanOut)->Apply(ThreadCounts)->UseRealTime()->Unit(benchmark::kMicrosecond);
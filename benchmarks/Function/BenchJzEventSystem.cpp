@@ -0,0 +1,71 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "JzRE/Runtime/Function/Event/JzEventSystem.h"
+
+using namespace JzRE;
+
+namespace {
+
+struct BenchEventA : public JzECSEvent {
+    I32 value = 0;
+};
+
+struct BenchEventB : public JzECSEvent {
+    I32 value = 0;
+};
+
+} // namespace
+
+static void BM_EventSystem_SendAndDispatch(benchmark::State &state)
+{
+    JzEventSystem events;
+
+    I64 received = 0;
+    events.RegisterHandler<BenchEventA>([&received](const BenchEventA &e) { received += e.value; });
+    events.RegisterHandler<BenchEventB>([&received](const BenchEventB &e) { received -= e.value; });
+
+    for (auto _ : state) {
+        for (I64 i = 0; i < state.range(0); ++i) {
+            if (i % 2 == 0) {
+                BenchEventA event;
+                event.value = 1;
+                events.Send(std::move(event));
+            } else {
+                BenchEventB event;
+                event.value = 1;
+                events.Send(std::move(event));
+            }
+        }
+        events.DispatchEvents();
+    }
+
+    benchmark::DoNotOptimize(received);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EventSystem_SendAndDispatch)->Arg(64)->Arg(4096);
+
+static void BM_EventSystem_FanOut(benchmark::State &state)
+{
+    JzEventSystem events;
+
+    I64 received = 0;
+    for (I64 i = 0; i < state.range(0); ++i) {
+        events.RegisterHandler<BenchEventA>([&received](const BenchEventA &e) { received += e.value; });
+    }
+
+    for (auto _ : state) {
+        BenchEventA event;
+        event.value = 1;
+        events.Send(std::move(event));
+        events.DispatchEvents();
+    }
+
+    benchmark::DoNotOptimize(received);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EventSystem_FanOut)->Arg(1)->Arg(32);
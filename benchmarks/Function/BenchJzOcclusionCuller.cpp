@@ -0,0 +1,153 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "JzRE/Runtime/Core/JzThreadPool.h"
+#include "JzRE/Runtime/Function/Rendering/JzOcclusionCuller.h"
+
+using namespace JzRE;
+
+namespace {
+
+/**
+ * @brief Unit cube, the usual coarse occluder proxy.
+ */
+struct BenchCube {
+    std::vector<JzVertex> vertices;
+    std::vector<U32>      indices{0, 1, 3, 0, 3, 2, 4, 6, 7, 4, 7, 5, 0, 2, 6, 0, 6, 4,
+                                  1, 5, 7, 1, 7, 3, 0, 4, 5, 0, 5, 1, 2, 3, 7, 2, 7, 6};
+
+    BenchCube()
+    {
+        // Corner bits 0, 1 and 2 select +X, +Y and +Z
+        for (U32 corner = 0; corner < 8; ++corner) {
+            JzVertex vertex;
+            vertex.Position = JzVec3((corner & 1) ? 0.5f : -0.5f, (corner & 2) ? 0.5f : -0.5f,
+                                     (corner & 4) ? 0.5f : -0.5f);
+            vertices.push_back(vertex);
+        }
+    }
+};
+
+/**
+ * @brief City block seen from street level: buildings on a grid, props scattered between them.
+ */
+struct BenchScene {
+    BenchCube                   cube;
+    std::vector<JzOccluderMesh> occluders;
+    std::vector<JzVec4>         spheres;
+    JzMat4                      view;
+    JzMat4                      projection;
+
+    BenchScene(U32 occluderCount, U32 sphereCount)
+    {
+        std::mt19937                        random(42);
+        std::uniform_real_distribution<F32> unit(0.0f, 1.0f);
+        const U32                           columns = 8;
+
+        for (U32 index = 0; index < occluderCount; ++index) {
+            const F32    height = 6.0f + 20.0f * unit(random);
+            const JzVec3 center(-42.0f + 12.0f * static_cast<F32>(index % columns), height * 0.5f,
+                                -15.0f - 12.0f * static_cast<F32>(index / columns));
+            const JzVec3 size(8.0f, height, 8.0f);
+
+            JzOccluderMesh occluder;
+            occluder.vertices     = &cube.vertices;
+            occluder.indices      = &cube.indices;
+            occluder.worldMatrix  = JzMat4x4::Translate(center) * JzMat4x4::Scale(size);
+            occluder.boundsCenter = center;
+            occluder.boundsRadius = 0.5f * size.Length();
+            occluders.push_back(occluder);
+        }
+
+        for (U32 index = 0; index < sphereCount; ++index) {
+            spheres.emplace_back(-50.0f + 100.0f * unit(random), 4.0f * unit(random), -10.0f - 120.0f * unit(random),
+                                 0.5f + 1.5f * unit(random));
+        }
+
+        view = JzMat4x4::LookAt(JzVec3(0.0f, 1.8f, 0.0f), JzVec3(0.0f, 1.8f, -1.0f), JzVec3(0.0f, 1.0f, 0.0f));
+        projection = JzMat4x4::Perspective(1.0472f, 16.0f / 9.0f, 0.1f, 500.0f);
+    }
+
+    void Rasterize(JzOcclusionCuller &culler) const
+    {
+        culler.BeginFrame(view, projection);
+        for (const auto &occluder : occluders) {
+            culler.AddOccluder(occluder);
+        }
+        culler.Rasterize();
+    }
+};
+
+/**
+ * @brief Culler on the calling thread for 0, on a pool of hardware threads for 1.
+ */
+struct BenchCuller {
+    std::unique_ptr<JzThreadPool> pool;
+    JzOcclusionCuller             culler;
+
+    explicit BenchCuller(I64 threaded)
+    {
+        if (threaded != 0) {
+            pool = std::make_unique<JzThreadPool>();
+            culler.SetThreadPool(pool.get());
+        }
+    }
+};
+
+} // namespace
+
+static void BM_OcclusionCuller_Rasterize(benchmark::State &state)
+{
+    const BenchScene scene(static_cast<U32>(state.range(0)), 0);
+    BenchCuller      bench(state.range(1));
+
+    for (auto _ : state) {
+        scene.Rasterize(bench.culler);
+        benchmark::DoNotOptimize(bench.culler.GetDepth(0, 0));
+    }
+
+    state.SetItemsProcessed(state.iterations() * bench.culler.GetStats().occluderTriangles);
+}
+BENCHMARK(BM_OcclusionCuller_Rasterize)->ArgNames({"occluders", "threaded"})->ArgsProduct({{16, 64}, {0, 1}});
+
+static void BM_OcclusionCuller_TestSpheres(benchmark::State &state)
+{
+    const BenchScene scene(64, static_cast<U32>(state.range(0)));
+    BenchCuller      bench(state.range(1));
+    scene.Rasterize(bench.culler);
+
+    std::vector<U8> occluded;
+    for (auto _ : state) {
+        bench.culler.TestSpheres(scene.spheres, occluded);
+        benchmark::DoNotOptimize(occluded.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    const auto &stats          = bench.culler.GetStats();
+    state.counters["occluded"] = static_cast<F64>(stats.occluded) / static_cast<F64>(stats.tested);
+}
+BENCHMARK(BM_OcclusionCuller_TestSpheres)->ArgNames({"spheres", "threaded"})->ArgsProduct({{1024, 16384}, {0, 1}});
+
+static void BM_OcclusionCuller_Frame(benchmark::State &state)
+{
+    const BenchScene scene(64, 10000);
+    BenchCuller      bench(state.range(0));
+
+    std::vector<U8> occluded;
+    for (auto _ : state) {
+        scene.Rasterize(bench.culler);
+        bench.culler.TestSpheres(scene.spheres, occluded);
+        benchmark::DoNotOptimize(occluded.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(scene.spheres.size()));
+}
+BENCHMARK(BM_OcclusionCuller_Frame)->ArgName("threaded")->Arg(0)->Arg(1);
@@ -0,0 +1,82 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "JzRE/Runtime/Function/ECS/JzTransformComponents.h"
+#include "JzRE/Runtime/Function/ECS/JzWorld.h"
+
+using namespace JzRE;
+
+namespace {
+
+/**
+ * @brief Every entity has a transform; every other entity also moves.
+ */
+void PopulateWorld(JzWorld &world, I64 count)
+{
+    for (I64 i = 0; i < count; ++i) {
+        auto entity = world.CreateEntity();
+        world.AddComponent<JzTransformComponent>(entity, JzVec3(static_cast<F32>(i), 0.0f, 0.0f));
+        if (i % 2 == 0) {
+            world.AddComponent<JzVelocityComponent>(entity).velocity = JzVec3(1.0f, 0.0f, 0.0f);
+        }
+    }
+}
+
+} // namespace
+
+static void BM_World_IterateSingleComponent(benchmark::State &state)
+{
+    JzWorld world;
+    PopulateWorld(world, state.range(0));
+
+    for (auto _ : state) {
+        for (auto [entity, transform] : world.View<JzTransformComponent>().each()) {
+            transform.position.y += 1.0f;
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_World_IterateSingleComponent)->Arg(10000)->Arg(100000);
+
+static void BM_World_IterateJoinedComponents(benchmark::State &state)
+{
+    JzWorld world;
+    PopulateWorld(world, state.range(0));
+
+    for (auto _ : state) {
+        for (auto [entity, transform, velocity] : world.View<JzTransformComponent, JzVelocityComponent>().each()) {
+            transform.position += velocity.velocity * 0.016f;
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) / 2);
+}
+BENCHMARK(BM_World_IterateJoinedComponents)->Arg(10000)->Arg(100000);
+
+static void BM_World_CreateAndDestroy(benchmark::State &state)
+{
+    JzWorld               world;
+    std::vector<JzEntity> entities(static_cast<Size>(state.range(0)));
+
+    for (auto _ : state) {
+        for (auto &entity : entities) {
+            entity = world.CreateEntity();
+            world.AddComponent<JzTransformComponent>(entity);
+        }
+        for (auto entity : entities) {
+            world.DestroyEntity(entity);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_World_CreateAndDestroy)->Arg(10000);
@@ -0,0 +1,39 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "JzRE/Runtime/Platform/Command/JzRHICommandList.h"
+
+using namespace JzRE;
+
+static void BM_CommandList_RecordDraws(benchmark::State &state)
+{
+    JzRHICommandList commandList("BenchCommandList");
+
+    JzDrawIndexedParams drawParams;
+    drawParams.primitiveType = JzEPrimitiveType::Triangles;
+    drawParams.indexCount    = 36;
+    drawParams.instanceCount = 1;
+
+    JzViewport viewport;
+    viewport.width  = 1280.0f;
+    viewport.height = 720.0f;
+
+    for (auto _ : state) {
+        commandList.Begin();
+        commandList.SetViewport(viewport);
+        commandList.Clear(JzClearParams{});
+        for (I64 i = 0; i < state.range(0); ++i) {
+            drawParams.firstIndex = static_cast<U32>(i);
+            commandList.DrawIndexed(drawParams);
+        }
+        commandList.End();
+        benchmark::DoNotOptimize(commandList.GetCommandCount());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CommandList_RecordDraws)->Arg(256)->Arg(4096);
@@ -0,0 +1,96 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "JzRE/Runtime/Resource/JzAssetRegistry.h"
+
+using namespace JzRE;
+
+namespace {
+
+struct BenchAsset {
+    U32 value = 0;
+};
+
+std::vector<String> MakePaths(Size count)
+{
+    std::vector<String> paths;
+    paths.reserve(count);
+    for (Size i = 0; i < count; ++i) {
+        paths.push_back("assets/bench/asset_" + std::to_string(i) + ".bin");
+    }
+    return paths;
+}
+
+} // namespace
+
+static void BM_AssetRegistry_AllocateAndFree(benchmark::State &state)
+{
+    const auto                             paths = MakePaths(static_cast<Size>(state.range(0)));
+    JzAssetRegistry<BenchAsset>            registry;
+    std::vector<JzAssetHandle<BenchAsset>> handles(paths.size());
+
+    for (auto _ : state) {
+        for (Size i = 0; i < paths.size(); ++i) {
+            handles[i] = registry.Allocate(paths[i]);
+        }
+        for (auto handle : handles) {
+            registry.Free(handle);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AssetRegistry_AllocateAndFree)->Arg(1024);
+
+static void BM_AssetRegistry_Get(benchmark::State &state)
+{
+    const auto                             paths = MakePaths(static_cast<Size>(state.range(0)));
+    JzAssetRegistry<BenchAsset>            registry;
+    std::vector<JzAssetHandle<BenchAsset>> handles;
+    handles.reserve(paths.size());
+    for (Size i = 0; i < paths.size(); ++i) {
+        auto handle = registry.Allocate(paths[i]);
+        registry.Set(handle, std::make_shared<BenchAsset>(BenchAsset{static_cast<U32>(i)}));
+        handles.push_back(handle);
+    }
+
+    for (auto _ : state) {
+        U64 sum = 0;
+        for (auto handle : handles) {
+            if (const auto *asset = registry.Get(handle)) {
+                sum += asset->value;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AssetRegistry_Get)->Arg(1024)->Arg(16384);
+
+static void BM_AssetRegistry_FindByPath(benchmark::State &state)
+{
+    const auto                  paths = MakePaths(static_cast<Size>(state.range(0)));
+    JzAssetRegistry<BenchAsset> registry;
+    for (const auto &path : paths) {
+        registry.Allocate(path);
+    }
+
+    for (auto _ : state) {
+        U32 found = 0;
+        for (const auto &path : paths) {
+            found += registry.FindByPath(path).IsValid() ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AssetRegistry_FindByPath)->Arg(1024)->Arg(16384);
@@ -12,6 +12,7 @@
 #include "JzRE/Runtime/Core/JzLogger.h"
 #include "JzRE/Runtime/Core/JzServiceContainer.h"
 #include "JzRE/Runtime/Function/ECS/JzLightComponents.h"
+#include "JzRE/Runtime/Function/Rendering/JzRenderSnapshot.h"
 #include "JzRE/Runtime/Platform/RHI/JzDevice.h"
 #include "JzRE/Runtime/Resource/JzShader.h"
 
@@ -291,10 +292,11 @@ void JzRE::JzREEditor::InitializeEditorRenderContributions()
                 commandList.BindVertexArray(vertexArray);
 
                 JzVec3 sunDirection(0.3f, -1.0f, -0.5f);
-                auto   lightView = context.world.View<JzDirectionalLightComponent>();
-                if (!lightView.empty()) {
-                    sunDirection =
-                        context.world.GetComponent<JzDirectionalLightComponent>(lightView.front()).direction;
+                for (const auto &light : context.snapshot.lights) {
+                    if (light.type == JzELightType::Directional) {
+                        sunDirection = light.direction;
+                        break;
+                    }
                 }
                 if (sunDirection.Length() > 0.0001f) {
                     sunDirection.Normalize();
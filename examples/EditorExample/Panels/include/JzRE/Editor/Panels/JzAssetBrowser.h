@@ -6,16 +6,29 @@
 #pragma once
 
 #include <filesystem>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Function/Project/JzProjectFileIndex.h"
+#include "JzRE/Runtime/Platform/RHI/JzGPUTextureObject.h"
+#include "JzRE/Runtime/Resource/JzThumbnailCache.h"
 #include "JzRE/Editor/Core/JzEvent.h"
+#include "JzRE/Editor/UI/JzAssetContextMenu.h"
 #include "JzRE/Editor/UI/JzPanelWindow.h"
-#include "JzRE/Editor/UI/JzGroup.h"
-#include "JzRE/Editor/UI/JzTreeNode.h"
+#include "JzRE/Editor/UI/JzText.h"
+#include "JzRE/Editor/UI/JzVirtualTree.h"
 
 namespace JzRE {
 
 /**
  * @brief Asset Browser Panel Window
+ *
+ * Shows the content directory from a JzProjectFileIndex that is scanned in
+ * the background and kept current from file change notifications. Only the
+ * expanded folders are flattened into rows and only the visible rows are
+ * drawn; their thumbnails come from a JzThumbnailCache.
  */
 class JzAssetBrowser : public JzPanelWindow {
 public:
@@ -27,7 +40,7 @@ public:
     JzAssetBrowser(const String &name, Bool is_opened);
 
     /**
-     * @brief Fill the asset browser panel
+     * @brief Fill the asset browser panel from the file index
      */
     void Fill();
 
@@ -37,21 +50,59 @@ public:
     void Clear();
 
     /**
-     * @brief Refresh the asset browser panel
+     * @brief Refresh the asset browser panel, rescanning the content directory in the background
      */
     void Refresh();
 
 public:
     JzEvent<std::filesystem::path> AssetSelectedEvent;
 
+protected:
+    /**
+     * @brief Implementation of the Draw method
+     */
+    void _Draw_Impl() override;
+
 private:
-    void _TraverseDirectory(JzTreeNode &root, const std::filesystem::path &path);
-    void _AddDirectoryItem(JzTreeNode *root, const std::filesystem::path &path, Bool autoOpen);
-    void _AddFileItem(JzTreeNode *root, const std::filesystem::path &path);
+    struct JzAssetRow {
+        std::filesystem::path path;
+        String                label;
+        U32                   depth       = 0;
+        Bool                  isDirectory = false;
+        U64                   revision    = 0;
+    };
+
+    struct JzThumbnailSlot {
+        std::shared_ptr<JzGPUTextureObject> texture;
+        U64                                 revision      = 0;
+        U64                                 lastUsedFrame = 0;
+        Bool                                requested     = false;
+    };
+
+    void                _AppendDirectoryRows(const std::filesystem::path &directory, U32 depth);
+    void                _ToggleDirectory(U32 row);
+    void                _OpenContextMenu(U32 row);
+    void                _ApplyChange(const std::filesystem::path &path, JzEFileChangeKind kind);
+    void                _UploadThumbnails();
+    JzGPUTextureObject *_GetRowIcon(const JzAssetRow &row);
 
 private:
-    JzGroup              *m_assetList;
-    std::filesystem::path m_openDirectory;
+    std::filesystem::path                       m_openDirectory;
+    std::unique_ptr<JzProjectFileIndex>         m_index;
+    std::unique_ptr<JzThumbnailCache>           m_thumbnails;
+    JzText                                     *m_statusText = nullptr;
+    JzVirtualTree                              *m_tree       = nullptr;
+    std::vector<JzAssetRow>                     m_rows; ///< Expanded part of the tree, depth first
+    std::unordered_set<String>                  m_expandedDirectories;
+    U64                                         m_rowsVersion = 0;
+    Bool                                        m_rowsDirty   = true;
+    std::filesystem::path                       m_selectedPath;
+    std::unordered_map<String, JzThumbnailSlot> m_thumbnailSlots;
+    std::shared_ptr<JzGPUTextureObject>         m_folderIcon;
+    std::shared_ptr<JzGPUTextureObject>         m_fileIcon;
+    std::unique_ptr<JzAssetContextMenu>         m_contextMenu;
+    std::filesystem::path                       m_contextMenuPath;
+    U64                                         m_frame = 0;
 };
 
-} // namespace JzRE
\ No newline at end of file
+} // namespace JzRE
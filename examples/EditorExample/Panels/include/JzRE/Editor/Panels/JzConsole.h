@@ -5,18 +5,32 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <vector>
 #include "JzRE/Runtime/Core/JzRETypes.h"
 #include "JzRE/Runtime/Core/JzELog.h"
+#include "JzRE/Runtime/Core/JzMPSCQueue.h"
 #include "JzRE/Editor/UI/JzPanelWindow.h"
-#include "JzRE/Editor/UI/JzGroup.h"
 #include "JzRE/Editor/UI/JzText.h"
+#include "JzRE/Editor/UI/JzVirtualList.h"
 
 namespace JzRE {
 /**
  * @brief Console Panel Window
+ *
+ * Keeps the last Capacity log records in a ring buffer, together with one
+ * ring of record sequence numbers per filter category, and draws the
+ * filtered records newest first through a clipped list. Loggers on any
+ * thread hand records over through a lock-free queue as large as the ring,
+ * so records are only dropped, and counted, when more than Capacity arrive
+ * within one frame.
  */
 class JzConsole : public JzPanelWindow {
 public:
+    static constexpr Size Capacity      = 4096; ///< Records kept
+    static constexpr Size QueueCapacity = Capacity; ///< Records in flight between two frames
+
     /**
      * @brief Constructor
      *
@@ -38,30 +52,71 @@ public:
     void Clear();
 
     /**
-     * @brief Filter logs
+     * @brief Rebuild the visible records from the per-category lists
      */
     void FilterLogs();
 
+protected:
     /**
-     * @brief
+     * @brief Add records received since the last frame, then draw
      */
-    void TruncateLogs();
+    void _Draw_Impl() override;
 
 private:
+    enum class JzELogCategory : U8 {
+        Default,
+        Info,
+        Warning,
+        Error
+    };
+
+    static constexpr Size CategoryCount = 4;
+
+    struct JzConsoleRecord {
+        String      message;
+        JzELogLevel level = JzELogLevel::Info;
+    };
+
+    /**
+     * @brief Fixed-capacity ring of ascending record sequence numbers.
+     */
+    struct JzSequenceRing {
+        std::vector<U64> items = std::vector<U64>(Capacity);
+        Size             head  = 0;
+        Size             count = 0;
+
+        void Push(U64 sequence);
+        void PopFrontIf(U64 sequence);
+        void Clear();
+        U64  At(Size index) const;
+    };
+
     void OnLogMessage(const JzLogMessage &msg);
+    void AppendRecord(JzConsoleRecord &&record);
     void SetShowDefaultLogs(Bool value);
     void SetShowInfoLogs(Bool value);
     void SetShowWarningLogs(Bool value);
     void SetShowErrorLogs(Bool value);
     Bool IsAllowedByFilter(JzELogLevel level);
+    const JzConsoleRecord &GetVisibleRecord(U32 row) const;
+
+    static JzELogCategory GetCategory(JzELogLevel level);
 
 private:
-    JzGroup                                  *m_logGroup;
-    std::unordered_map<JzText *, JzELogLevel> m_logTextWidgets;
-    Bool                                      m_clearOnPlay    = true;
-    Bool                                      m_showDefaultLog = true;
-    Bool                                      m_showInfoLog    = true;
-    Bool                                      m_showWarningLog = true;
-    Bool                                      m_showErrorLog   = true;
+    JzText        *m_droppedText    = nullptr;
+    JzVirtualList *m_logList        = nullptr;
+    Bool           m_clearOnPlay    = true;
+    Bool           m_showDefaultLog = true;
+    Bool           m_showInfoLog    = true;
+    Bool           m_showWarningLog = true;
+    Bool           m_showErrorLog   = true;
+
+    std::vector<JzConsoleRecord>              m_records      = std::vector<JzConsoleRecord>(Capacity);
+    U64                                       m_nextSequence = 0; ///< Records ever appended
+    std::array<JzSequenceRing, CategoryCount> m_categoryRecords;
+    JzSequenceRing                            m_visibleRecords; ///< Records passing the filter
+    JzMPSCQueue<JzConsoleRecord>              m_incoming{QueueCapacity}; ///< Filled on the logging threads
+    std::atomic<U64>                          m_droppedMessages{0};
+    U64                                       m_shownDropped = 0;
 };
-} // namespace JzRE
\ No newline at end of file
+} // namespace JzRE
@@ -5,15 +5,25 @@
 
 #pragma once
 
+#include <unordered_map>
+#include <vector>
 #include "JzRE/Runtime/Core/JzRETypes.h"
 #include "JzRE/Runtime/Function/ECS/JzEntity.h"
+#include "JzRE/Editor/UI/JzInputText.h"
 #include "JzRE/Editor/UI/JzPanelWindow.h"
-#include "JzRE/Editor/UI/JzTreeNode.h"
+#include "JzRE/Editor/UI/JzVirtualList.h"
 #include "JzRE/Editor/UI/JzWidgetContainer.h"
 
 namespace JzRE {
+
+class JzWorld;
+
 /**
  * @brief Hierarchy Panel Window
+ *
+ * Keeps a flat index of the named entities sorted by lowercase name, patched
+ * from JzNameComponent construct/update/destroy signals once per frame, and
+ * draws it through a clipped list. Search filters the prebuilt lowercase names.
  */
 class JzHierarchy : public JzPanelWindow {
 public:
@@ -22,6 +32,13 @@ public:
      */
     JzHierarchy(const String &name, Bool is_opened);
 
+    /**
+     * @brief Destructor
+     *
+     * Disconnects from the observed world if it is still alive.
+     */
+    ~JzHierarchy();
+
     /**
      * @brief Update the hierarchy panel each frame
      * @param deltaTime Time since last frame in seconds
@@ -29,7 +46,7 @@ public:
     void Update(F32 deltaTime);
 
     /**
-     * @brief Refresh the entity list from JzWorld
+     * @brief Rebuild the entity index from JzWorld
      */
     void RefreshEntityList();
 
@@ -41,12 +58,7 @@ public:
     /**
      * @brief Clear Select Status
      */
-    void UnselectActorsWidgets();
-
-    /**
-     * @brief Select entity by widget
-     */
-    void SelectActorByWidget(JzTreeNode &widget);
+    void UnselectEntity();
 
     /**
      * @brief Select entity by JzEntity handle
@@ -54,6 +66,12 @@ public:
      */
     void SelectEntity(JzEntity entity);
 
+    /**
+     * @brief Show only entities whose name contains the query, ignoring case
+     * @param query Empty to show every entity
+     */
+    void SetSearchQuery(const String &query);
+
     /**
      * @brief Create an empty entity with default components
      */
@@ -70,7 +88,10 @@ public:
     void AddModelFromFile();
 
     /**
-     * @brief Mark the hierarchy as needing a refresh
+     * @brief Rebuild the index on the next update
+     *
+     * Only needed after writing JzNameComponent::name in place; AddComponent,
+     * PatchComponent and entity destruction are tracked automatically.
      */
     void MarkDirty()
     {
@@ -82,10 +103,35 @@ public:
     JzEvent<>         SelectionClearedEvent;
 
 private:
-    std::unordered_map<JzEntity, JzTreeNode *> m_entityWidgetMap;
-    JzWidgetContainer                         &m_actions;
-    JzWidgetContainer                         &m_actors;
-    Bool                                       m_needsRefresh  = true;
-    U32                                        m_entityCounter = 0;
+    struct JzHierarchyRow {
+        String   key; ///< Lowercase name, the sort and search key
+        String   name;
+        JzEntity entity = INVALID_ENTITY;
+    };
+
+    void ObserveWorld(JzWorld &world);
+    void StopObservingWorld();
+    void OnNameChanged(entt::registry &, JzEntity entity);
+    void OnNameRemoved(entt::registry &, JzEntity entity);
+    void ApplyPendingChanges();
+    void RebuildVisibleRows();
+    void UpdateSelectedRow();
+    U32  GetRowIndex(U32 listRow) const;
+
+private:
+    JzWidgetContainer &m_actions;
+    JzInputText       &m_searchInput;
+    JzVirtualList     &m_entityList;
+
+    JzWorld                             *m_observedWorld = nullptr;
+    std::vector<JzHierarchyRow>          m_rows;        ///< Sorted by key, then entity
+    std::unordered_map<JzEntity, String> m_indexedKeys; ///< Key each indexed entity is sorted under
+    std::vector<U32>                     m_visibleRows; ///< Indices into m_rows matching the search
+    std::vector<JzEntity>                m_pendingChanged;
+    std::vector<JzEntity>                m_pendingRemoved;
+    String                               m_searchQuery;
+    JzEntity                             m_selectedEntity = INVALID_ENTITY;
+    Bool                                 m_needsRefresh   = true;
+    U32                                  m_entityCounter  = 0;
 };
 } // namespace JzRE
\ No newline at end of file
@@ -10,15 +10,30 @@
 #include "JzRE/Editor/UI/JzButton.h"
 #include "JzRE/Editor/UI/JzFileContextMenu.h"
 #include "JzRE/Editor/UI/JzFolderContextMenu.h"
-#include "JzRE/Editor/UI/JzIcon.h"
 #include "JzRE/Editor/UI/JzSeparator.h"
-#include "JzRE/Editor/UI/JzTextClickable.h"
 #include "JzRE/Runtime/Function/Project/JzProjectManager.h"
+#include "JzRE/Runtime/Platform/RHI/JzDevice.h"
 #include "JzRE/Runtime/Resource/JzAssetManager.h"
 #include "JzRE/Runtime/Resource/JzTexture.h"
 #include "JzRE/Runtime/Function/Asset/JzAssetImporter.h"
 #include "JzRE/Runtime/Platform/Dialog/JzOpenFileDialog.h"
 
+namespace {
+
+constexpr JzRE::U32  kThumbnailSize        = 64;
+constexpr JzRE::U32  kMaxThumbnailUploads  = 8;   ///< GPU textures created per frame
+constexpr JzRE::Size kMaxThumbnailTextures = 512; ///< Textures of rows scrolled away are dropped past this
+
+std::shared_ptr<JzRE::JzGPUTextureObject> LoadIcon(const JzRE::String &path)
+{
+    auto &assetManager = JzRE::JzServiceContainer::Get<JzRE::JzAssetManager>();
+    auto  iconHandle   = assetManager.GetOrLoad<JzRE::JzTexture>(path);
+    auto  iconTexture  = assetManager.GetShared(iconHandle);
+    return iconTexture ? iconTexture->GetRhiTexture() : nullptr;
+}
+
+} // namespace
+
 JzRE::JzAssetBrowser::JzAssetBrowser(const JzRE::String &name, JzRE::Bool is_opened) :
     JzPanelWindow(name, is_opened)
 {
@@ -62,7 +77,10 @@ JzRE::JzAssetBrowser::JzAssetBrowser(const JzRE::String &name, JzRE::Bool is_ope
                     JzRE_LOG_INFO("Model imported: {} ({} dependencies)",
                                       modelResult.modelEntry.destinationPath.string(),
                                       modelResult.dependencyEntries.size());
-                    Refresh();
+                    _ApplyChange(modelResult.modelEntry.destinationPath, JzEFileChangeKind::Added);
+                    for (const auto &dependency : modelResult.dependencyEntries) {
+                        _ApplyChange(dependency.destinationPath, JzEFileChangeKind::Added);
+                    }
                 } else {
                     JzRE_LOG_ERROR("Model import failed: {}", modelResult.modelEntry.errorMessage);
                 }
@@ -71,7 +89,7 @@ JzRE::JzAssetBrowser::JzAssetBrowser(const JzRE::String &name, JzRE::Bool is_ope
 
                 if (result.result == JzEImportResult::Success) {
                     JzRE_LOG_INFO("Asset imported: {}", result.destinationPath.string());
-                    Refresh();
+                    _ApplyChange(result.destinationPath, JzEFileChangeKind::Added);
                 } else {
                     JzRE_LOG_ERROR("Asset import failed: {}", result.errorMessage);
                 }
@@ -81,109 +99,244 @@ JzRE::JzAssetBrowser::JzAssetBrowser(const JzRE::String &name, JzRE::Bool is_ope
 
     CreateWidget<JzSeparator>();
 
-    m_assetList = &CreateWidget<JzGroup>();
+    m_statusText = &CreateWidget<JzText>("Indexing project files...");
+
+    m_tree          = &CreateWidget<JzVirtualTree>();
+    m_tree->rowData = [this](U32 row) {
+        const auto      &assetRow = m_rows[row];
+        JzVirtualTreeRow data;
+        data.label    = &assetRow.label;
+        data.depth    = assetRow.depth;
+        data.isFolder = assetRow.isDirectory;
+        data.isOpen   = assetRow.isDirectory && m_expandedDirectories.count(assetRow.path.string()) > 0;
+        data.icon     = _GetRowIcon(assetRow);
+        return data;
+    };
+    m_tree->RowToggledEvent += [this](U32 row) { _ToggleDirectory(row); };
+    m_tree->RowClickedEvent += [this](U32 row) {
+        m_selectedPath      = m_rows[row].path;
+        m_tree->selectedRow = static_cast<I32>(row);
+    };
+    m_tree->RowDoubleClickedEvent += [this](U32 row) {
+        AssetSelectedEvent.Invoke(m_rows[row].path);
+    };
+    m_tree->RowRightClickedEvent += [this](U32 row) { _OpenContextMenu(row); };
+
+    m_folderIcon = LoadIcon("icons/folder-16.png");
+    m_fileIcon   = LoadIcon("icons/file-16.png");
+
+    JzThumbnailCacheConfig thumbnailConfig;
+    thumbnailConfig.size = kThumbnailSize;
+    if (!projectManager.GetProjectFilePath().empty()) {
+        thumbnailConfig.cacheDirectory = projectManager.GetProjectFilePath().parent_path() / "Intermediate" / "Thumbnails";
+    }
+    m_thumbnails = std::make_unique<JzThumbnailCache>(thumbnailConfig);
+
+    m_index = std::make_unique<JzProjectFileIndex>(m_openDirectory);
+    m_index->Rebuild();
 
     Fill();
 }
 
 void JzRE::JzAssetBrowser::Fill()
 {
-    for (const auto &item : std::filesystem::directory_iterator(m_openDirectory.string())) {
-        try {
-            if (item.is_directory()) {
-                _AddDirectoryItem(nullptr, item, true);
-            }
-        } catch (const std::exception &ex) {
-            JzRE_LOG_ERROR("Failed to process item: {} - {}", item.path().string(), ex.what());
-        }
+    if (!m_index->IsReady()) {
+        return;
+    }
+
+    const auto selectedPath = m_selectedPath.string();
+    const auto menuPath     = m_contextMenuPath.string();
+
+    m_rows.clear();
+    _AppendDirectoryRows(m_index->GetRoot(), 0);
+
+    m_tree->rowCount       = static_cast<U32>(m_rows.size());
+    m_tree->selectedRow    = -1;
+    m_tree->contextMenuRow = -1;
+    for (U32 row = 0; row < m_rows.size(); ++row) {
+        const auto path = m_rows[row].path.string();
+        if (path == selectedPath) m_tree->selectedRow = static_cast<I32>(row);
+        if (path == menuPath) m_tree->contextMenuRow = static_cast<I32>(row);
+    }
+
+    // The menu's item is gone or collapsed away
+    if (m_tree->contextMenuRow < 0) {
+        m_tree->contextMenu = nullptr;
+        m_contextMenu.reset();
+        m_contextMenuPath.clear();
     }
+
+    m_rowsVersion = m_index->GetVersion();
+    m_rowsDirty   = false;
 }
 
 void JzRE::JzAssetBrowser::Clear()
 {
-    m_assetList->RemoveAllWidgets();
+    m_rows.clear();
+    m_thumbnailSlots.clear();
+    m_tree->rowCount       = 0;
+    m_tree->selectedRow    = -1;
+    m_tree->contextMenu    = nullptr;
+    m_tree->contextMenuRow = -1;
+    m_contextMenu.reset();
+    m_contextMenuPath.clear();
+    m_rowsDirty = true;
 }
 
 void JzRE::JzAssetBrowser::Refresh()
 {
-    Clear();
-    Fill();
+    // The old rows stay visible until the new scan replaces the index
+    m_index->Rebuild();
 }
 
-void JzRE::JzAssetBrowser::_TraverseDirectory(JzRE::JzTreeNode &root, const std::filesystem::path &path)
+void JzRE::JzAssetBrowser::_Draw_Impl()
 {
-    for (auto &item : std::filesystem::directory_iterator(path)) {
-        if (item.is_directory()) {
-            _AddDirectoryItem(&root, item, false);
+    m_frame++;
+
+    const Bool wasReady = m_index->IsReady();
+    m_index->Update();
+    const auto *rootEntries = m_index->GetEntries(m_index->GetRoot());
+    if (!wasReady && rootEntries) {
+        // Top level folders start open, as they did when the browser built its widgets eagerly
+        for (const auto &entry : *rootEntries) {
+            if (entry.isDirectory) {
+                m_expandedDirectories.insert((m_index->GetRoot() / entry.name).string());
+            }
         }
     }
+    m_statusText->enabled = !m_index->IsReady();
 
-    for (auto &item : std::filesystem::directory_iterator(path)) {
-        if (!item.is_directory()) {
-            _AddFileItem(&root, item);
-        }
+    if (m_rowsDirty || m_rowsVersion != m_index->GetVersion()) {
+        Fill();
     }
+
+    _UploadThumbnails();
+
+    JzPanelWindow::_Draw_Impl();
 }
 
-void JzRE::JzAssetBrowser::_AddDirectoryItem(JzRE::JzTreeNode *root, const std::filesystem::path &path, JzRE::Bool autoOpen)
+void JzRE::JzAssetBrowser::_AppendDirectoryRows(const std::filesystem::path &directory, JzRE::U32 depth)
 {
-    auto &itemGroup = root ? root->CreateWidget<JzGroup>() : m_assetList->CreateWidget<JzGroup>();
+    const auto *entries = m_index->GetEntries(directory);
+    if (!entries) {
+        return;
+    }
 
-    const auto itemName = path.filename().string();
+    for (const auto &entry : *entries) {
+        JzAssetRow row;
+        row.path        = directory / entry.name;
+        row.label       = entry.name;
+        row.depth       = depth;
+        row.isDirectory = entry.isDirectory;
+        row.revision    = entry.revision;
 
-    /* Find the icon to apply to the item */
-    auto &assetManager = JzServiceContainer::Get<JzAssetManager>();
-    auto  iconHandle   = assetManager.GetOrLoad<JzTexture>("icons/folder-16.png");
-    auto  iconTexture  = assetManager.GetShared(iconHandle);
+        const Bool expand = entry.isDirectory && m_expandedDirectories.count(row.path.string()) > 0;
+        m_rows.push_back(std::move(row));
 
-    auto &iconItem     = itemGroup.CreateWidget<JzIcon>(iconTexture->GetRhiTexture(), JzVec2{16, 16});
-    iconItem.lineBreak = false;
+        if (expand) {
+            _AppendDirectoryRows(m_rows.back().path, depth + 1);
+        }
+    }
+}
 
-    auto &treeNode        = itemGroup.CreateWidget<JzTreeNode>(itemName);
-    treeNode.OpenedEvent += [this, &treeNode, path] {
-        treeNode.RemoveAllWidgets();
-        _TraverseDirectory(treeNode, path);
+void JzRE::JzAssetBrowser::_ToggleDirectory(JzRE::U32 row)
+{
+    const auto path = m_rows[row].path.string();
+    if (!m_expandedDirectories.erase(path)) {
+        m_expandedDirectories.insert(path);
+    }
+    m_rowsDirty = true;
+}
+
+void JzRE::JzAssetBrowser::_OpenContextMenu(JzRE::U32 row)
+{
+    const auto &assetRow = m_rows[row];
+    if (m_contextMenu && assetRow.path == m_contextMenuPath) {
+        return;
+    }
+
+    // Menus only exist for the item last right clicked, not one per row
+    if (assetRow.isDirectory) {
+        auto menu             = std::make_unique<JzFolderContextMenu>(assetRow.path.string());
+        menu->ItemAddedEvent += [this](std::filesystem::path path) {
+            m_expandedDirectories.insert(JzFileWatcher::NormalizePath(path.parent_path()).string());
+            _ApplyChange(path, JzEFileChangeKind::Added);
+        };
+        m_contextMenu = std::move(menu);
+    } else {
+        auto menu             = std::make_unique<JzFileContextMenu>(assetRow.path.string());
+        menu->DuplicateEvent += [this](std::filesystem::path path) {
+            _ApplyChange(path, JzEFileChangeKind::Added);
+        };
+        m_contextMenu = std::move(menu);
+    }
+
+    m_contextMenu->CreateList();
+    m_contextMenu->DestroyedEvent += [this](std::filesystem::path path) {
+        _ApplyChange(path, JzEFileChangeKind::Removed);
     };
-    treeNode.ClosedEvent += [this, &treeNode] {
-        treeNode.RemoveAllWidgets();
+    m_contextMenu->RenamedEvent += [this](std::filesystem::path previousPath, std::filesystem::path newPath) {
+        _ApplyChange(previousPath, JzEFileChangeKind::Removed);
+        _ApplyChange(newPath, JzEFileChangeKind::Added);
     };
 
-    auto &contextMenu = treeNode.AddPlugin<JzFolderContextMenu>(path.string());
-    contextMenu.CreateList();
-    contextMenu.ItemAddedEvent += [this, &treeNode](std::filesystem::path p_path) {
-        treeNode.Open();
-        treeNode.RemoveAllWidgets();
-        _TraverseDirectory(treeNode, std::filesystem::directory_entry(p_path.parent_path()));
-    };
+    m_contextMenuPath      = assetRow.path;
+    m_tree->contextMenu    = m_contextMenu.get();
+    m_tree->contextMenuRow = static_cast<I32>(row);
+}
 
-    if (autoOpen) {
-        treeNode.Open();
-    }
+void JzRE::JzAssetBrowser::_ApplyChange(const std::filesystem::path &path, JzRE::JzEFileChangeKind kind)
+{
+    // File notifications report the same change later; applying it twice is harmless
+    m_index->ApplyChanges({{JzFileWatcher::NormalizePath(path), kind}});
+    m_rowsDirty = true;
 }
 
-void JzRE::JzAssetBrowser::_AddFileItem(JzRE::JzTreeNode *root, const std::filesystem::path &path)
+void JzRE::JzAssetBrowser::_UploadThumbnails()
 {
-    auto &itemGroup = root ? root->CreateWidget<JzGroup>() : m_assetList->CreateWidget<JzGroup>();
+    auto             &device = JzServiceContainer::Get<JzDevice>();
+    JzThumbnailResult result;
 
-    const auto itemName = path.filename().string();
+    for (U32 uploads = 0; uploads < kMaxThumbnailUploads && m_thumbnails->Poll(result);) {
+        auto slot = m_thumbnailSlots.find(result.path.string());
+        if (slot == m_thumbnailSlots.end() || !result.succeeded) {
+            continue;
+        }
 
-    /* Find the icon to apply to the item */
-    auto &assetManager = JzServiceContainer::Get<JzAssetManager>();
-    auto  iconHandle   = assetManager.GetOrLoad<JzTexture>("icons/file-16.png");
-    auto  iconTexture  = assetManager.GetShared(iconHandle);
+        JzGPUTextureObjectDesc desc;
+        desc.width     = result.thumbnail.width;
+        desc.height    = result.thumbnail.height;
+        desc.format    = JzETextureResourceFormat::RGBA8;
+        desc.wrapS     = JzETextureResourceWrap::ClampToEdge;
+        desc.wrapT     = JzETextureResourceWrap::ClampToEdge;
+        desc.data      = result.thumbnail.pixels.data();
+        desc.debugName = "Thumbnail " + result.path.filename().string();
 
-    auto &iconItem     = itemGroup.CreateWidget<JzIcon>(iconTexture->GetRhiTexture(), JzVec2{16, 16});
-    iconItem.lineBreak = false;
+        slot->second.texture = device.CreateTexture(desc);
+        uploads++;
+    }
 
-    auto &clickableText = itemGroup.CreateWidget<JzTextClickable>(itemName);
+    if (m_thumbnailSlots.size() > kMaxThumbnailTextures) {
+        for (auto it = m_thumbnailSlots.begin(); it != m_thumbnailSlots.end();) {
+            it = it->second.lastUsedFrame + 1 < m_frame ? m_thumbnailSlots.erase(it) : std::next(it);
+        }
+    }
+}
 
-    auto &contextMenu = clickableText.AddPlugin<JzFileContextMenu>(path.string());
-    contextMenu.CreateList();
-    contextMenu.DestroyedEvent += [&itemGroup](std::filesystem::path p_deletedPath) { };
-    contextMenu.RenamedEvent   += [&clickableText](std::filesystem::path p_prev, std::filesystem::path p_newPath) { };
-    contextMenu.DuplicateEvent += [this, &clickableText](std::filesystem::path newItem) { };
+JzRE::JzGPUTextureObject *JzRE::JzAssetBrowser::_GetRowIcon(const JzAssetRow &row)
+{
+    if (row.isDirectory) {
+        return m_folderIcon.get();
+    }
+    if (!JzThumbnailCache::IsSupported(row.path)) {
+        return m_fileIcon.get();
+    }
 
-    clickableText.DoubleClickedEvent += [this, path]() {
-        AssetSelectedEvent.Invoke(path);
-    };
-}
\ No newline at end of file
+    auto &slot         = m_thumbnailSlots[row.path.string()];
+    slot.lastUsedFrame = m_frame;
+    if (!slot.requested || slot.revision != row.revision) {
+        slot.requested = m_thumbnails->Request(row.path);
+        slot.revision  = row.revision;
+    }
+    return slot.texture ? slot.texture.get() : m_fileIcon.get();
+}
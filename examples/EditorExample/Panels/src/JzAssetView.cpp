@@ -291,17 +291,20 @@ void JzRE::JzAssetView::UpdatePreviewInputState()
 
     // Only update when panel is hovered/focused
     if (IsHovered() || IsFocused()) {
-        previewInput->mouse.position       = primaryInput->mouse.position;
-        previewInput->mouse.scrollDelta    = primaryInput->mouse.scrollDelta;
-        previewInput->mouse.buttonsPressed = primaryInput->mouse.buttonsPressed;
-        previewInput->mouse.buttonsDown    = primaryInput->mouse.buttonsDown;
-        previewInput->mouse.buttonsUp      = primaryInput->mouse.buttonsUp;
-        previewInput->keyboard             = primaryInput->keyboard;
+        previewInput->mouse.position                = primaryInput->mouse.position;
+        previewInput->mouse.scrollDelta             = primaryInput->mouse.scrollDelta;
+        previewInput->mouse.buttonsPressed          = primaryInput->mouse.buttonsPressed;
+        previewInput->mouse.buttonsDown             = primaryInput->mouse.buttonsDown;
+        previewInput->mouse.buttonsUp               = primaryInput->mouse.buttonsUp;
+        previewInput->mouse.buttonsHeldAtFrameStart = primaryInput->mouse.buttonsHeldAtFrameStart;
+        previewInput->mouse.changedButtons          = primaryInput->mouse.changedButtons;
+        previewInput->keyboard                      = primaryInput->keyboard;
     } else {
         // Clear input state when not focused
         previewInput->mouse.buttonsPressed.reset();
         previewInput->mouse.buttonsDown.reset();
         previewInput->mouse.buttonsUp.reset();
+        previewInput->mouse.changedButtons.clear();
         previewInput->mouse.scrollDelta = JzVec2(0.0f, 0.0f);
     }
 }
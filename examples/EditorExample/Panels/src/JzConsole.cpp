@@ -6,7 +6,6 @@
 #include "JzRE/Editor/Panels/JzConsole.h"
 #include "JzRE/Runtime/Core/JzRETypes.h"
 #include "JzRE/Runtime/Core/JzLogger.h"
-#include "JzRE/Editor/UI/JzText.h"
 #include "JzRE/Editor/UI/JzButton.h"
 #include "JzRE/Editor/UI/JzSeparator.h"
 #include "JzRE/Editor/UI/JzSpacing.h"
@@ -24,8 +23,25 @@ JzRE::JzConsole::JzConsole(const String &name, Bool is_opened) :
     CreateWidget<JzSeparator>();
     CreateWidget<JzSpacing>();
 
-    m_logGroup = &CreateWidget<JzGroup>();
-    m_logGroup->ReverseDrawOrder();
+    m_droppedText          = &CreateWidget<JzText>();
+    m_droppedText->enabled = false;
+
+    m_logList             = &CreateWidget<JzVirtualList>();
+    m_logList->selectable = false;
+    m_logList->rowLabel   = [this](U32 row) -> const String & {
+        return GetVisibleRecord(row).message;
+    };
+    m_logList->rowColor = [this](U32 row) {
+        switch (GetVisibleRecord(row).level) {
+            case JzELogLevel::Warning:
+                return JzVec4(1.0f, 0.8f, 0.3f, 1.0f);
+            case JzELogLevel::Error:
+            case JzELogLevel::Critical:
+                return JzVec4(1.0f, 0.4f, 0.4f, 1.0f);
+            default:
+                return JzVec4(0.9f, 0.9f, 0.9f, 1.0f);
+        }
+    };
 
     JzLogger::GetInstance().SetLogMessageCallback(
         std::bind(&JzConsole::OnLogMessage, this, std::placeholders::_1));
@@ -37,33 +53,122 @@ JzRE::JzConsole::~JzConsole()
     JzLogger::GetInstance().ClearLogMessageCallback();
 }
 
+void JzRE::JzConsole::_Draw_Impl()
+{
+    JzConsoleRecord record;
+    while (m_incoming.TryPop(record)) {
+        AppendRecord(std::move(record));
+    }
+    m_logList->rowCount = static_cast<U32>(m_visibleRecords.count);
+
+    const U64 dropped = m_droppedMessages.load(std::memory_order_relaxed);
+    if (dropped != m_shownDropped) {
+        m_shownDropped         = dropped;
+        m_droppedText->content = std::to_string(dropped) + " messages dropped during log bursts";
+        m_droppedText->enabled = dropped > 0;
+    }
+
+    JzPanelWindow::_Draw_Impl();
+}
+
 void JzRE::JzConsole::OnLogMessage(const JzLogMessage &msg)
 {
-    auto &text = m_logGroup->CreateWidget<JzText>(msg.message);
-    // text.color              = msg.color;
-    m_logTextWidgets[&text] = msg.level;
-    text.enabled            = IsAllowedByFilter(msg.level);
+    // Runs on the logging thread: never blocks, drops the record when the UI falls behind
+    JzConsoleRecord record;
+    record.message = msg.message;
+    record.level   = msg.level;
+    if (!m_incoming.TryPush(std::move(record))) {
+        m_droppedMessages.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void JzRE::JzConsole::AppendRecord(JzConsoleRecord &&record)
+{
+    const U64 sequence = m_nextSequence++;
+    auto     &slot     = m_records[sequence % Capacity];
+
+    // The slot's previous record leaves every list it was in; it is the oldest in each
+    if (sequence >= Capacity) {
+        const U64 evicted = sequence - Capacity;
+        m_categoryRecords[static_cast<Size>(GetCategory(slot.level))].PopFrontIf(evicted);
+        m_visibleRecords.PopFrontIf(evicted);
+    }
+
+    slot = std::move(record);
+    m_categoryRecords[static_cast<Size>(GetCategory(slot.level))].Push(sequence);
+    if (IsAllowedByFilter(slot.level)) {
+        m_visibleRecords.Push(sequence);
+    }
+}
+
+const JzRE::JzConsole::JzConsoleRecord &JzRE::JzConsole::GetVisibleRecord(JzRE::U32 row) const
+{
+    // Newest first
+    return m_records[m_visibleRecords.At(m_visibleRecords.count - 1 - row) % Capacity];
 }
 
 void JzRE::JzConsole::Clear()
 {
-    m_logTextWidgets.clear();
-    m_logGroup->RemoveAllWidgets();
+    for (auto &category : m_categoryRecords) {
+        category.Clear();
+    }
+    m_visibleRecords.Clear();
+    m_logList->rowCount = 0;
 }
 
 void JzRE::JzConsole::FilterLogs()
 {
-    for (const auto &[widget, logLevel] : m_logTextWidgets)
-        widget->enabled = IsAllowedByFilter(logLevel);
+    // Merge the sorted lists of the enabled categories
+    std::array<Size, CategoryCount> cursors{};
+    std::array<Bool, CategoryCount> enabled = {m_showDefaultLog, m_showInfoLog, m_showWarningLog, m_showErrorLog};
+
+    m_visibleRecords.Clear();
+    while (true) {
+        Size next = CategoryCount;
+        for (Size category = 0; category < CategoryCount; ++category) {
+            const auto &records = m_categoryRecords[category];
+            if (!enabled[category] || cursors[category] >= records.count) {
+                continue;
+            }
+            if (next == CategoryCount ||
+                records.At(cursors[category]) < m_categoryRecords[next].At(cursors[next])) {
+                next = category;
+            }
+        }
+        if (next == CategoryCount) {
+            break;
+        }
+        m_visibleRecords.Push(m_categoryRecords[next].At(cursors[next]++));
+    }
+    m_logList->rowCount = static_cast<U32>(m_visibleRecords.count);
+}
+
+void JzRE::JzConsole::JzSequenceRing::Push(JzRE::U64 sequence)
+{
+    // Never full: a ring holds at most the Capacity live records
+    items[(head + count) % Capacity] = sequence;
+    ++count;
 }
 
-void JzRE::JzConsole::TruncateLogs()
+void JzRE::JzConsole::JzSequenceRing::PopFrontIf(JzRE::U64 sequence)
 {
-    while (m_logGroup->GetWidgets().size() > 500) {
-        m_logGroup->RemoveWidget(*m_logGroup->GetWidgets().front().first);
+    if (count > 0 && items[head] == sequence) {
+        head = (head + 1) % Capacity;
+        --count;
     }
 }
 
+void JzRE::JzConsole::JzSequenceRing::Clear()
+{
+    head  = 0;
+    count = 0;
+}
+
+JzRE::U64 JzRE::JzConsole::JzSequenceRing::At(JzRE::Size index) const
+{
+    return items[(head + index) % Capacity];
+}
+
 void JzRE::JzConsole::SetShowDefaultLogs(JzRE::Bool value)
 {
     m_showDefaultLog = value;
@@ -90,18 +195,30 @@ void JzRE::JzConsole::SetShowErrorLogs(JzRE::Bool value)
 
 JzRE::Bool JzRE::JzConsole::IsAllowedByFilter(JzELogLevel level)
 {
-    switch (level) {
-        case JzELogLevel::Trace:
-        case JzELogLevel::Debug:
-        case JzELogLevel::Critical:
+    switch (GetCategory(level)) {
+        case JzELogCategory::Default:
             return m_showDefaultLog;
-        case JzELogLevel::Info:
+        case JzELogCategory::Info:
             return m_showInfoLog;
-        case JzELogLevel::Warning:
+        case JzELogCategory::Warning:
             return m_showWarningLog;
-        case JzELogLevel::Error:
+        case JzELogCategory::Error:
             return m_showErrorLog;
     }
 
     return false;
+}
+
+JzRE::JzConsole::JzELogCategory JzRE::JzConsole::GetCategory(JzELogLevel level)
+{
+    switch (level) {
+        case JzELogLevel::Info:
+            return JzELogCategory::Info;
+        case JzELogLevel::Warning:
+            return JzELogCategory::Warning;
+        case JzELogLevel::Error:
+            return JzELogCategory::Error;
+        default:
+            return JzELogCategory::Default;
+    }
 }
\ No newline at end of file
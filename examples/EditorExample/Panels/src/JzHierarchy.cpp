@@ -3,11 +3,12 @@
  * @copyright Copyright (c) 2025 JzRE
  */
 
+#include <algorithm>
+#include <cctype>
 #include "JzRE/Editor/Core/JzEditorState.h"
 #include "JzRE/Editor/Panels/JzHierarchy.h"
-#include "JzRE/Editor/UI/JzTreeNode.h"
 #include "JzRE/Editor/UI/JzGroup.h"
-#include "JzRE/Editor/UI/JzSeparator.h"
+#include "JzRE/Editor/UI/JzInputText.h"
 #include "JzRE/Editor/UI/JzButton.h"
 #include "JzRE/Runtime/Core/JzServiceContainer.h"
 #include "JzRE/Runtime/Function/ECS/JzWorld.h"
@@ -19,10 +20,33 @@
 #include "JzRE/Runtime/Function/Asset/JzAssetImporter.h"
 #include "JzRE/Runtime/Platform/Dialog/JzOpenFileDialog.h"
 
+namespace {
+
+JzRE::String ToSearchKey(const JzRE::String &name)
+{
+    JzRE::String key = name;
+    std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+    return key;
+}
+
+template <typename TRow>
+bool RowLess(const TRow &lhs, const TRow &rhs)
+{
+    if (lhs.key != rhs.key) {
+        return lhs.key < rhs.key;
+    }
+    return JzRE::ToEntityId(lhs.entity) < JzRE::ToEntityId(rhs.entity);
+}
+
+} // namespace
+
 JzRE::JzHierarchy::JzHierarchy(const JzRE::String &name, JzRE::Bool is_opened) :
     JzPanelWindow(name, is_opened),
     m_actions(CreateWidget<JzGroup>()),
-    m_actors(CreateWidget<JzGroup>())
+    m_searchInput(CreateWidget<JzInputText>("", "Search")),
+    m_entityList(CreateWidget<JzVirtualList>())
 {
     // Create action buttons
     auto &addModelButton         = m_actions.CreateWidget<JzButton>("+ Add Model");
@@ -40,7 +64,23 @@ JzRE::JzHierarchy::JzHierarchy(const JzRE::String &name, JzRE::Bool is_opened) :
         DeleteSelectedEntity();
     };
 
-    CreateWidget<JzSeparator>();
+    m_searchInput.ContentChangedEvent += [this](String query) {
+        SetSearchQuery(query);
+    };
+
+    m_entityList.rowLabel = [this](U32 row) -> const String & {
+        return m_rows[GetRowIndex(row)].name;
+    };
+    m_entityList.RowClickedEvent += [this](U32 row) {
+        const JzEntity entity = m_rows[GetRowIndex(row)].entity;
+        SelectEntity(entity);
+        EntitySelectedEvent.Invoke(entity);
+    };
+}
+
+JzRE::JzHierarchy::~JzHierarchy()
+{
+    StopObservingWorld();
 }
 
 void JzRE::JzHierarchy::Update(JzRE::F32 deltaTime)
@@ -49,82 +89,232 @@ void JzRE::JzHierarchy::Update(JzRE::F32 deltaTime)
         return;
     }
 
+    auto &world = JzServiceContainer::Get<JzWorld>();
+    if (m_observedWorld != &world) {
+        ObserveWorld(world);
+    }
+
     if (m_needsRefresh) {
         RefreshEntityList();
         m_needsRefresh = false;
+    } else if (!m_pendingChanged.empty() || !m_pendingRemoved.empty()) {
+        ApplyPendingChanges();
     }
 }
 
-void JzRE::JzHierarchy::RefreshEntityList()
+void JzRE::JzHierarchy::ObserveWorld(JzRE::JzWorld &world)
 {
-    if (!JzServiceContainer::Has<JzWorld>()) {
+    StopObservingWorld();
+
+    m_observedWorld = &world;
+    world.OnConstruct<JzNameComponent>().connect<&JzHierarchy::OnNameChanged>(*this);
+    world.OnUpdate<JzNameComponent>().connect<&JzHierarchy::OnNameChanged>(*this);
+    world.OnDestroy<JzNameComponent>().connect<&JzHierarchy::OnNameRemoved>(*this);
+    m_needsRefresh = true;
+}
+
+void JzRE::JzHierarchy::StopObservingWorld()
+{
+    if (!m_observedWorld) {
         return;
     }
 
+    // The world may already be gone when the editor shuts down
+    if (JzServiceContainer::Has<JzWorld>() && &JzServiceContainer::Get<JzWorld>() == m_observedWorld) {
+        m_observedWorld->OnConstruct<JzNameComponent>().disconnect(this);
+        m_observedWorld->OnUpdate<JzNameComponent>().disconnect(this);
+        m_observedWorld->OnDestroy<JzNameComponent>().disconnect(this);
+    }
+    m_observedWorld = nullptr;
+}
+
+void JzRE::JzHierarchy::OnNameChanged(entt::registry &, JzRE::JzEntity entity)
+{
+    m_pendingChanged.push_back(entity);
+}
+
+void JzRE::JzHierarchy::OnNameRemoved(entt::registry &, JzRE::JzEntity entity)
+{
+    m_pendingRemoved.push_back(entity);
+}
+
+void JzRE::JzHierarchy::RefreshEntityList()
+{
     Clear();
 
-    auto &world = JzServiceContainer::Get<JzWorld>();
+    if (!m_observedWorld) {
+        return;
+    }
 
-    // Query all entities with JzNameComponent
-    auto view = world.View<JzNameComponent>();
+    auto view = m_observedWorld->View<JzNameComponent>();
+    m_rows.reserve(view.size());
+    m_indexedKeys.reserve(view.size());
     for (auto [entity, nameComp] : view.each()) {
-        // Create tree node for each entity
-        auto &node = m_actors.CreateWidget<JzTreeNode>(nameComp.name, false);
-        node.leaf  = true;
-
-        // Store entity-widget mapping
-        m_entityWidgetMap[entity] = &node;
-
-        // Wire click event to selection
-        node.ClickedEvent += [this, entity, &node]() {
-            SelectActorByWidget(node);
-            EntitySelectedEvent.Invoke(entity);
-        };
+        JzHierarchyRow row;
+        row.key    = ToSearchKey(nameComp.name);
+        row.name   = nameComp.name;
+        row.entity = entity;
+        m_indexedKeys.emplace(entity, row.key);
+        m_rows.push_back(std::move(row));
     }
+    std::sort(m_rows.begin(), m_rows.end(), RowLess<JzHierarchyRow>);
+
+    RebuildVisibleRows();
 }
 
-void JzRE::JzHierarchy::Clear()
+void JzRE::JzHierarchy::ApplyPendingChanges()
 {
-    m_actors.RemoveAllWidgets();
-    m_entityWidgetMap.clear();
+    // Renamed entities leave under their old key and come back under the new one
+    std::vector<JzHierarchyRow> removed;
+    for (const auto *pending : {&m_pendingRemoved, &m_pendingChanged}) {
+        for (const JzEntity entity : *pending) {
+            auto it = m_indexedKeys.find(entity);
+            if (it == m_indexedKeys.end()) {
+                continue;
+            }
+
+            JzHierarchyRow row;
+            row.key    = std::move(it->second);
+            row.entity = entity;
+            removed.push_back(std::move(row));
+            m_indexedKeys.erase(it);
+        }
+    }
+
+    if (!removed.empty()) {
+        std::sort(removed.begin(), removed.end(), RowLess<JzHierarchyRow>);
+        std::erase_if(m_rows, [&removed](const JzHierarchyRow &row) {
+            return std::binary_search(removed.begin(), removed.end(), row, RowLess<JzHierarchyRow>);
+        });
+    }
+
+    std::sort(m_pendingChanged.begin(), m_pendingChanged.end());
+    m_pendingChanged.erase(std::unique(m_pendingChanged.begin(), m_pendingChanged.end()), m_pendingChanged.end());
+
+    const Size previousCount = m_rows.size();
+    for (const JzEntity entity : m_pendingChanged) {
+        // Entities created and destroyed since the last update are skipped here
+        const auto *nameComp = m_observedWorld->IsValid(entity) ? m_observedWorld->TryGetComponent<JzNameComponent>(entity)
+                                                                : nullptr;
+        if (!nameComp || m_indexedKeys.contains(entity)) {
+            continue;
+        }
+
+        JzHierarchyRow row;
+        row.key    = ToSearchKey(nameComp->name);
+        row.name   = nameComp->name;
+        row.entity = entity;
+        m_indexedKeys.emplace(entity, row.key);
+        m_rows.push_back(std::move(row));
+    }
+    std::sort(m_rows.begin() + previousCount, m_rows.end(), RowLess<JzHierarchyRow>);
+    std::inplace_merge(m_rows.begin(), m_rows.begin() + previousCount, m_rows.end(), RowLess<JzHierarchyRow>);
+
+    m_pendingChanged.clear();
+    m_pendingRemoved.clear();
+
+    RebuildVisibleRows();
 }
 
-void JzRE::JzHierarchy::UnselectActorsWidgets()
+void JzRE::JzHierarchy::SetSearchQuery(const JzRE::String &query)
 {
-    for (auto &[entity, widget] : m_entityWidgetMap) {
-        widget->selected = false;
+    const String key = ToSearchKey(query);
+    if (key == m_searchQuery) {
+        return;
+    }
+
+    // Typing more characters only narrows the current matches
+    const Bool narrowing = !m_searchQuery.empty() && key.starts_with(m_searchQuery);
+    m_searchQuery        = key;
+
+    if (narrowing) {
+        std::erase_if(m_visibleRows, [this](U32 index) {
+            return m_rows[index].key.find(m_searchQuery) == String::npos;
+        });
+        m_entityList.rowCount = static_cast<U32>(m_visibleRows.size());
+        UpdateSelectedRow();
+    } else {
+        RebuildVisibleRows();
     }
 }
 
-void ExpandTreeNode(JzRE::JzTreeNode &node)
+void JzRE::JzHierarchy::RebuildVisibleRows()
 {
-    node.Open();
+    m_visibleRows.clear();
 
-    if (node.HasParent()) {
-        if (auto parent = dynamic_cast<JzRE::JzTreeNode *>(node.GetParent()); parent) {
-            ExpandTreeNode(*parent);
+    if (m_searchQuery.empty()) {
+        m_entityList.rowCount = static_cast<U32>(m_rows.size());
+    } else {
+        for (U32 index = 0; index < m_rows.size(); ++index) {
+            if (m_rows[index].key.find(m_searchQuery) != String::npos) {
+                m_visibleRows.push_back(index);
+            }
         }
+        m_entityList.rowCount = static_cast<U32>(m_visibleRows.size());
     }
+
+    UpdateSelectedRow();
 }
 
-void JzRE::JzHierarchy::SelectActorByWidget(JzRE::JzTreeNode &widget)
+void JzRE::JzHierarchy::UpdateSelectedRow()
 {
-    UnselectActorsWidgets();
+    m_entityList.selectedRow = -1;
 
-    widget.selected = true;
+    const auto keyIt = m_indexedKeys.find(m_selectedEntity);
+    if (keyIt == m_indexedKeys.end()) {
+        return;
+    }
 
-    if (widget.HasParent()) {
-        if (auto parent = dynamic_cast<JzTreeNode *>(widget.GetParent()); parent) {
-            ExpandTreeNode(*parent);
-        }
+    JzHierarchyRow probe;
+    probe.key    = keyIt->second;
+    probe.entity = m_selectedEntity;
+
+    const auto rowIt = std::lower_bound(m_rows.begin(), m_rows.end(), probe, RowLess<JzHierarchyRow>);
+    if (rowIt == m_rows.end() || rowIt->entity != m_selectedEntity) {
+        return;
     }
+
+    const U32 index = static_cast<U32>(rowIt - m_rows.begin());
+    if (m_searchQuery.empty()) {
+        m_entityList.selectedRow = static_cast<I32>(index);
+        return;
+    }
+
+    const auto visibleIt = std::lower_bound(m_visibleRows.begin(), m_visibleRows.end(), index);
+    if (visibleIt != m_visibleRows.end() && *visibleIt == index) {
+        m_entityList.selectedRow = static_cast<I32>(visibleIt - m_visibleRows.begin());
+    }
+}
+
+JzRE::U32 JzRE::JzHierarchy::GetRowIndex(JzRE::U32 listRow) const
+{
+    return m_searchQuery.empty() ? listRow : m_visibleRows[listRow];
+}
+
+void JzRE::JzHierarchy::Clear()
+{
+    m_rows.clear();
+    m_indexedKeys.clear();
+    m_visibleRows.clear();
+    m_pendingChanged.clear();
+    m_pendingRemoved.clear();
+    m_entityList.rowCount    = 0;
+    m_entityList.selectedRow = -1;
+}
+
+void JzRE::JzHierarchy::UnselectEntity()
+{
+    m_selectedEntity         = INVALID_ENTITY;
+    m_entityList.selectedRow = -1;
 }
 
 void JzRE::JzHierarchy::SelectEntity(JzRE::JzEntity entity)
 {
-    auto it = m_entityWidgetMap.find(entity);
-    if (it != m_entityWidgetMap.end()) {
-        SelectActorByWidget(*it->second);
+    m_selectedEntity = entity;
+    UpdateSelectedRow();
+
+    if (m_entityList.selectedRow >= 0) {
+        m_entityList.ScrollToRow(static_cast<U32>(m_entityList.selectedRow));
     }
 }
 
@@ -144,8 +334,6 @@ void JzRE::JzHierarchy::CreateEmptyEntity()
     world.AddComponent<JzNameComponent>(entity, entityName);
     world.AddComponent<JzTransformComponent>(entity);
     world.AddComponent<JzActiveTag>(entity);
-
-    m_needsRefresh = true;
 }
 
 void JzRE::JzHierarchy::DeleteSelectedEntity()
@@ -169,9 +357,8 @@ void JzRE::JzHierarchy::DeleteSelectedEntity()
 
     world.DestroyEntity(editorState.selectedEntity);
     editorState.ClearSelection();
+    UnselectEntity();
     SelectionClearedEvent.Invoke();
-
-    m_needsRefresh = true;
 }
 
 void JzRE::JzHierarchy::AddModelFromFile()
@@ -263,7 +450,9 @@ void JzRE::JzHierarchy::AddModelFromFile()
         }
 
         if (world.HasComponent<JzNameComponent>(entity)) {
-            world.GetComponent<JzNameComponent>(entity).name = entityName;
+            world.PatchComponent<JzNameComponent>(entity, [&entityName](JzNameComponent &nameComp) {
+                nameComp.name = entityName;
+            });
         } else {
             world.AddComponent<JzNameComponent>(entity, entityName);
         }
@@ -278,6 +467,4 @@ void JzRE::JzHierarchy::AddModelFromFile()
             world.AddComponent<JzActiveTag>(entity);
         }
     }
-
-    m_needsRefresh = true;
 }
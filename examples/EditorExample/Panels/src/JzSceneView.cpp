@@ -351,17 +351,20 @@ void JzRE::JzSceneView::UpdateSceneInputState()
 
     // Only update when panel is hovered/focused
     if (IsHovered() || IsFocused()) {
-        sceneInput->mouse.position       = primaryInput->mouse.position;
-        sceneInput->mouse.scrollDelta    = primaryInput->mouse.scrollDelta;
-        sceneInput->mouse.buttonsPressed = primaryInput->mouse.buttonsPressed;
-        sceneInput->mouse.buttonsDown    = primaryInput->mouse.buttonsDown;
-        sceneInput->mouse.buttonsUp      = primaryInput->mouse.buttonsUp;
-        sceneInput->keyboard             = primaryInput->keyboard;
+        sceneInput->mouse.position                = primaryInput->mouse.position;
+        sceneInput->mouse.scrollDelta             = primaryInput->mouse.scrollDelta;
+        sceneInput->mouse.buttonsPressed          = primaryInput->mouse.buttonsPressed;
+        sceneInput->mouse.buttonsDown             = primaryInput->mouse.buttonsDown;
+        sceneInput->mouse.buttonsUp               = primaryInput->mouse.buttonsUp;
+        sceneInput->mouse.buttonsHeldAtFrameStart = primaryInput->mouse.buttonsHeldAtFrameStart;
+        sceneInput->mouse.changedButtons          = primaryInput->mouse.changedButtons;
+        sceneInput->keyboard                      = primaryInput->keyboard;
     } else {
         // Clear input state when not focused
         sceneInput->mouse.buttonsPressed.reset();
         sceneInput->mouse.buttonsDown.reset();
         sceneInput->mouse.buttonsUp.reset();
+        sceneInput->mouse.changedButtons.clear();
         sceneInput->mouse.scrollDelta = JzVec2(0.0f, 0.0f);
     }
 }
@@ -100,7 +100,7 @@ void JzRE::JzUIManager::Render()
 
             auto &device = JzServiceContainer::Get<JzDevice>();
             auto *vkDevice = dynamic_cast<JzVulkanDevice *>(&device);
-            if (!vkDevice || !vkDevice->IsFrameRecording()) {
+            if (!vkDevice || !vkDevice->EnsureSwapchainRenderPass()) {
                 return;
             }
 
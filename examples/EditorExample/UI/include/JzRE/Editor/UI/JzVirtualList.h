@@ -0,0 +1,56 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <functional>
+#include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Core/JzVector.h"
+#include "JzRE/Editor/Core/JzEvent.h"
+#include "JzRE/Editor/UI/JzWidget.h"
+
+namespace JzRE {
+
+/**
+ * @brief Scrolling list that only submits its visible rows
+ *
+ * Rows are not widgets: labels are fetched from rowLabel for the rows the
+ * clipper reports visible, so drawing costs the same for ten rows or a
+ * hundred thousand.
+ */
+class JzVirtualList : public JzWidget {
+public:
+    /**
+     * @brief Constructor
+     */
+    JzVirtualList() = default;
+
+    /**
+     * @brief Scroll the given row into view on the next draw
+     *
+     * @param row
+     */
+    void ScrollToRow(U32 row);
+
+protected:
+    /**
+     * @brief Implementation of the Draw method
+     */
+    void _Draw_Impl() override;
+
+public:
+    U32                                    rowCount    = 0;
+    I32                                    selectedRow = -1;
+    Bool                                   selectable  = true; ///< False draws plain text rows
+    std::function<const String &(U32 row)> rowLabel;
+    std::function<JzVec4(U32 row)>         rowColor; ///< Optional text color of plain rows
+    JzEvent<U32>                           RowClickedEvent;
+    JzEvent<U32>                           RowDoubleClickedEvent;
+
+private:
+    I32 m_scrollToRow = -1;
+};
+
+} // namespace JzRE
@@ -0,0 +1,62 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <functional>
+#include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Core/JzVector.h"
+#include "JzRE/Runtime/Platform/RHI/JzGPUTextureObject.h"
+#include "JzRE/Editor/Core/JzEvent.h"
+#include "JzRE/Editor/UI/JzContextMenu.h"
+#include "JzRE/Editor/UI/JzWidget.h"
+
+namespace JzRE {
+
+/**
+ * @brief What a JzVirtualTree shows for one row
+ */
+struct JzVirtualTreeRow {
+    const String       *label    = nullptr;
+    U32                 depth    = 0;
+    Bool                isFolder = false;
+    Bool                isOpen   = false;
+    JzGPUTextureObject *icon     = nullptr; ///< Drawn before the label when set
+};
+
+/**
+ * @brief Tree drawn from a flattened list of its expanded rows
+ *
+ * Like JzVirtualList only the rows the clipper reports visible are fetched
+ * and submitted. The owner keeps the flattened rows and rebuilds them when a
+ * RowToggledEvent changes what is expanded.
+ */
+class JzVirtualTree : public JzWidget {
+public:
+    /**
+     * @brief Constructor
+     */
+    JzVirtualTree() = default;
+
+protected:
+    /**
+     * @brief Implementation of the Draw method
+     */
+    void _Draw_Impl() override;
+
+public:
+    U32                                      rowCount       = 0;
+    I32                                      selectedRow    = -1;
+    JzVec2                                   iconSize       = {16.0f, 16.0f};
+    std::function<JzVirtualTreeRow(U32 row)> rowData;
+    JzContextMenu                           *contextMenu    = nullptr; ///< Opened by right clicking contextMenuRow
+    I32                                      contextMenuRow = -1;
+    JzEvent<U32>                             RowToggledEvent;
+    JzEvent<U32>                             RowClickedEvent;
+    JzEvent<U32>                             RowDoubleClickedEvent;
+    JzEvent<U32>                             RowRightClickedEvent; ///< Set contextMenu here to open it on this row
+};
+
+} // namespace JzRE
@@ -0,0 +1,70 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Editor/UI/JzVirtualList.h"
+#include "JzRE/Editor/UI/JzConverter.h"
+#include <imgui.h>
+
+void JzRE::JzVirtualList::ScrollToRow(JzRE::U32 row)
+{
+    m_scrollToRow = static_cast<I32>(row);
+}
+
+void JzRE::JzVirtualList::_Draw_Impl()
+{
+    if (!ImGui::BeginChild(("##VirtualList" + m_widgetID).c_str())) {
+        ImGui::EndChild();
+        return;
+    }
+
+    const F32 rowHeight = ImGui::GetTextLineHeightWithSpacing();
+
+    if (m_scrollToRow >= 0 && static_cast<U32>(m_scrollToRow) < rowCount) {
+        const F32 rowTop  = rowHeight * static_cast<F32>(m_scrollToRow);
+        const F32 scrollY = ImGui::GetScrollY();
+        const F32 visible = ImGui::GetWindowHeight() - rowHeight;
+        if (rowTop < scrollY || rowTop > scrollY + visible) {
+            ImGui::SetScrollY(rowTop - visible * 0.5f);
+        }
+    }
+    m_scrollToRow = -1;
+
+    ImGuiListClipper clipper;
+    clipper.Begin(static_cast<int>(rowCount), rowHeight);
+    while (clipper.Step()) {
+        for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+            const char *label = rowLabel ? rowLabel(static_cast<U32>(row)).c_str() : "";
+
+            if (!selectable) {
+                if (rowColor) {
+                    ImGui::PushStyleColor(ImGuiCol_Text, JzConverter::ToImVec4(rowColor(static_cast<U32>(row))));
+                    ImGui::TextUnformatted(label);
+                    ImGui::PopStyleColor();
+                } else {
+                    ImGui::TextUnformatted(label);
+                }
+                continue;
+            }
+
+            ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen |
+                                       ImGuiTreeNodeFlags_SpanAvailWidth;
+            if (row == selectedRow) flags |= ImGuiTreeNodeFlags_Selected;
+
+            ImGui::PushID(row);
+            ImGui::TreeNodeEx(label, flags);
+            if (ImGui::IsItemClicked()) {
+                RowClickedEvent.Invoke(static_cast<U32>(row));
+
+                if (ImGui::IsMouseDoubleClicked(0)) {
+                    RowDoubleClickedEvent.Invoke(static_cast<U32>(row));
+                }
+            }
+            ImGui::PopID();
+        }
+    }
+    clipper.End();
+
+    ImGui::EndChild();
+}
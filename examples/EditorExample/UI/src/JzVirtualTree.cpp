@@ -0,0 +1,67 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Editor/UI/JzVirtualTree.h"
+#include "JzRE/Editor/UI/JzConverter.h"
+#include "JzRE/Editor/UI/JzImGuiTextureBridge.h"
+#include <imgui.h>
+
+void JzRE::JzVirtualTree::_Draw_Impl()
+{
+    if (!ImGui::BeginChild(("##VirtualTree" + m_widgetID).c_str())) {
+        ImGui::EndChild();
+        return;
+    }
+
+    const F32 indent = ImGui::GetStyle().IndentSpacing;
+
+    ImGuiListClipper clipper;
+    clipper.Begin(static_cast<int>(rowCount));
+    while (clipper.Step()) {
+        for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+            const JzVirtualTreeRow data  = rowData ? rowData(static_cast<U32>(row)) : JzVirtualTreeRow{};
+            const char            *label = data.label ? data.label->c_str() : "";
+
+            ImGui::PushID(row);
+            ImGui::SetCursorPosX(ImGui::GetCursorPosX() + indent * static_cast<F32>(data.depth));
+
+            if (data.icon) {
+                ImGui::Image(JzImGuiTextureBridge::Resolve(data.icon), JzConverter::ToImVec2(iconSize));
+                ImGui::SameLine();
+            }
+
+            ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_NoTreePushOnOpen | ImGuiTreeNodeFlags_SpanAvailWidth;
+            flags |= data.isFolder ? ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick : ImGuiTreeNodeFlags_Leaf;
+            if (row == selectedRow) flags |= ImGuiTreeNodeFlags_Selected;
+
+            if (data.isFolder) {
+                ImGui::SetNextItemOpen(data.isOpen);
+            }
+
+            const Bool open = ImGui::TreeNodeEx(label, flags);
+            if (data.isFolder && open != data.isOpen) {
+                RowToggledEvent.Invoke(static_cast<U32>(row));
+            } else if (ImGui::IsItemClicked()) {
+                RowClickedEvent.Invoke(static_cast<U32>(row));
+
+                if (!data.isFolder && ImGui::IsMouseDoubleClicked(0)) {
+                    RowDoubleClickedEvent.Invoke(static_cast<U32>(row));
+                }
+            }
+
+            if (ImGui::IsItemClicked(ImGuiMouseButton_Right)) {
+                RowRightClickedEvent.Invoke(static_cast<U32>(row));
+            }
+            if (contextMenu && row == contextMenuRow) {
+                contextMenu->Execute(JzEPluginExecutionContext::WIDGET);
+            }
+
+            ImGui::PopID();
+        }
+    }
+    clipper.End();
+
+    ImGui::EndChild();
+}
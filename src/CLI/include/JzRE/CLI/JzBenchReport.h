@@ -0,0 +1,85 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "JzRE/Runtime/Core/JzRETypes.h"
+
+namespace JzRE {
+
+/**
+ * @brief Distribution of one benchmark series.
+ */
+struct JzBenchStats {
+    Size samples = 0;
+    F64  mean    = 0.0;
+    F64  min     = 0.0;
+    F64  p50     = 0.0;
+    F64  p90     = 0.0;
+    F64  p95     = 0.0;
+    F64  p99     = 0.0;
+    F64  max     = 0.0;
+};
+
+/**
+ * @brief Flat benchmark metrics keyed by name, lower is better (e.g. "frameTimeMs.p95").
+ */
+using JzBenchMetrics = std::map<String, F64>;
+
+/**
+ * @brief A metric that got worse than the baseline allows.
+ */
+struct JzBenchRegression {
+    String metric;
+    F64    baseline = 0.0;
+    F64    current  = 0.0;
+};
+
+/**
+ * @brief Statistics and baseline comparison for `JzRE bench` results.
+ */
+class JzBenchReport {
+public:
+    /**
+     * @brief Compute mean and nearest-rank percentiles of a series.
+     *
+     * @param samples Sample values, in any order.
+     *
+     * @return JzBenchStats All zero when samples is empty.
+     */
+    static JzBenchStats ComputeStats(std::vector<F64> samples);
+
+    /**
+     * @brief Add the percentiles of a series to a metric map as "<prefix>.p50" etc.
+     *
+     * @param metrics Metric map to extend.
+     * @param prefix Metric name prefix.
+     * @param stats Series statistics.
+     */
+    static void AddStats(JzBenchMetrics &metrics, const String &prefix, const JzBenchStats &stats);
+
+    /**
+     * @brief Find metrics that exceed their baseline by more than the tolerance.
+     *
+     * Metrics missing from either side are skipped, so baselines stay usable
+     * when metrics are added or systems renamed.
+     *
+     * @param baseline Stored baseline metrics.
+     * @param current Metrics of this run.
+     * @param tolerance Allowed relative increase, e.g. 0.1 for 10%.
+     * @param absoluteSlack Increase always tolerated, so near-zero metrics do not flap.
+     *
+     * @return std::vector<JzBenchRegression> Regressions, ordered by metric name.
+     */
+    static std::vector<JzBenchRegression> Compare(const JzBenchMetrics &baseline,
+                                                  const JzBenchMetrics &current,
+                                                  F64                   tolerance,
+                                                  F64                   absoluteSlack = 0.05);
+};
+
+} // namespace JzRE
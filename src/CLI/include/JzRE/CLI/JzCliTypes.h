@@ -21,6 +21,7 @@ enum class JzCliExitCode : I32 {
     ProjectError     = 4,
     ToolError        = 5,
     RuntimeError     = 6,
+    Regression       = 7,
 };
 
 /**
@@ -8,9 +8,20 @@
 #include <filesystem>
 
 #include "JzRE/CLI/JzCliCommandRegistry.h"
+#include "JzRE/Runtime/Platform/RHI/JzGPUTextureObject.h"
 
 namespace JzRE {
 
+/**
+ * @brief Options of a project build.
+ */
+struct JzBuildOptions {
+    const String            *toolOverride  = nullptr;                           ///< Shader tool binary override
+    Bool                     shadersOnly   = false;                             ///< Skip texture cooking
+    JzETextureResourceFormat textureFormat = JzETextureResourceFormat::Unknown; ///< Unknown picks per image
+    Bool                     generateMips  = true;                              ///< Store a full mip chain
+};
+
 /**
  * @brief `build` command — cook project content (shaders, etc.).
  */
@@ -29,14 +40,14 @@ public:
      * @param context CLI context.
      * @param projectPath Absolute path to .jzreproject file.
      * @param format Output format.
-     * @param toolOverride Optional path to override the shader tool binary.
+     * @param options Build options.
      *
      * @return JzCliResult Build result.
      */
     static JzCliResult BuildProject(JzCliContext                &context,
                                     const std::filesystem::path &projectPath,
                                     JzCliOutputFormat            format,
-                                    const String               *toolOverride = nullptr);
+                                    const JzBuildOptions        &options = {});
 };
 
 } // namespace JzRE
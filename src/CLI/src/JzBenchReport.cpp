@@ -0,0 +1,75 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/CLI/JzBenchReport.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace JzRE {
+
+namespace {
+
+F64 NearestRank(const std::vector<F64> &sorted, F64 percentile)
+{
+    const auto rank = static_cast<Size>(std::ceil(percentile / 100.0 * static_cast<F64>(sorted.size())));
+    return sorted[std::clamp<Size>(rank, 1, sorted.size()) - 1];
+}
+
+} // namespace
+
+JzBenchStats JzBenchReport::ComputeStats(std::vector<F64> samples)
+{
+    JzBenchStats stats;
+    if (samples.empty()) {
+        return stats;
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    stats.samples = samples.size();
+    stats.mean    = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<F64>(samples.size());
+    stats.min     = samples.front();
+    stats.p50     = NearestRank(samples, 50.0);
+    stats.p90     = NearestRank(samples, 90.0);
+    stats.p95     = NearestRank(samples, 95.0);
+    stats.p99     = NearestRank(samples, 99.0);
+    stats.max     = samples.back();
+    return stats;
+}
+
+void JzBenchReport::AddStats(JzBenchMetrics &metrics, const String &prefix, const JzBenchStats &stats)
+{
+    metrics[prefix + ".mean"] = stats.mean;
+    metrics[prefix + ".p50"]  = stats.p50;
+    metrics[prefix + ".p90"]  = stats.p90;
+    metrics[prefix + ".p95"]  = stats.p95;
+    metrics[prefix + ".p99"]  = stats.p99;
+}
+
+std::vector<JzBenchRegression> JzBenchReport::Compare(const JzBenchMetrics &baseline,
+                                                      const JzBenchMetrics &current,
+                                                      F64                   tolerance,
+                                                      F64                   absoluteSlack)
+{
+    std::vector<JzBenchRegression> regressions;
+
+    for (const auto &[metric, value] : current) {
+        auto iter = baseline.find(metric);
+        if (iter == baseline.end()) {
+            continue;
+        }
+
+        const F64 limit = std::max(iter->second * (1.0 + tolerance), iter->second + absoluteSlack);
+        if (value > limit) {
+            regressions.push_back({metric, iter->second, value});
+        }
+    }
+
+    return regressions;
+}
+
+} // namespace JzRE
@@ -8,6 +8,7 @@
 #include <format>
 #include <sstream>
 
+#include "JzRE/CLI/commands/JzBenchCommand.h"
 #include "JzRE/CLI/commands/JzBuildCommand.h"
 #include "JzRE/CLI/commands/JzCreateCommand.h"
 #include "JzRE/CLI/commands/JzImportCommand.h"
@@ -32,6 +33,7 @@ void JzCliCommandRegistry::RegisterBuiltins()
     Register(std::make_unique<JzImportCommand>());
     Register(std::make_unique<JzBuildCommand>());
     Register(std::make_unique<JzRunCommand>());
+    Register(std::make_unique<JzBenchCommand>());
 }
 
 JzCliResult JzCliCommandRegistry::Execute(const String              &domain,
@@ -56,7 +58,7 @@ String JzCliCommandRegistry::BuildHelpText() const
     ss << "Commands:\n";
 
     // Emit in logical workflow order
-    const std::vector<String> order = {"init", "create", "import", "build", "run"};
+    const std::vector<String> order = {"init", "create", "import", "build", "run", "bench"};
     for (const auto &name : order) {
         auto iter = m_commands.find(name);
         if (iter != m_commands.end()) {
@@ -0,0 +1,639 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/CLI/commands/JzBenchCommand.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <initializer_list>
+#include <limits>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <tuple>
+
+#include <nlohmann/json.hpp>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include "JzRE/CLI/JzBenchReport.h"
+#include "JzRE/CLI/JzCliArgParser.h"
+#include "JzRE/Runtime/Core/JzVertex.h"
+#include "JzRE/Runtime/Function/ECS/JzCameraComponents.h"
+#include "JzRE/Runtime/Function/ECS/JzLightComponents.h"
+#include "JzRE/Runtime/Function/ECS/JzTransformComponents.h"
+#include "JzRE/Runtime/JzRERuntime.h"
+#include "JzRE/Runtime/Resource/JzMaterial.h"
+#include "JzRE/Runtime/Resource/JzMesh.h"
+
+namespace JzRE {
+
+namespace {
+
+using Json  = nlohmann::json;
+using Clock = std::chrono::steady_clock;
+
+const String kDomain = "bench";
+
+/**
+ * @brief Size of the generated stress scene.
+ */
+struct JzBenchSceneConfig {
+    U32 entities  = 1000;
+    U32 meshes    = 16;
+    U32 materials = 32;
+    U32 lights    = 4;
+    U32 seed      = 1;
+};
+
+String BuildHelp()
+{
+    return "bench command:\n"
+           "  JzRE bench [--entities <n>] [--meshes <n>] [--materials <n>] [--lights <n>]\n"
+           "             [--frames <n>] [--warmup <n>] [--delta <seconds>] [--seed <n>]\n"
+           "             [--rhi auto|opengl|vulkan] [--width <n>] [--height <n>] [--frame-latency 0|1]\n"
+           "             [--output <file.json>] [--baseline <file.json>] [--tolerance <percent>]\n"
+           "\n"
+           "  Renders a generated scene offscreen in a hidden window for a fixed number\n"
+           "  of frames with a fixed timestep, then reports frame time percentiles,\n"
+           "  per-system times, draw counts and peak memory. No project is needed.\n"
+           "\n"
+           "  --entities       Drawable entities (default: 1000).\n"
+           "  --meshes         Unique meshes shared by the entities (default: 16).\n"
+           "  --materials      Unique materials shared by the entities (default: 32).\n"
+           "  --lights         Point lights (default: 4).\n"
+           "  --frames         Measured frames (default: 300).\n"
+           "  --warmup         Frames run before measuring (default: 30).\n"
+           "  --delta          Timestep passed to systems in seconds (default: 1/60).\n"
+           "  --seed           Scene generation seed (default: 1).\n"
+           "  --rhi            Render API to use (default: auto).\n"
+           "  --width          Render size in pixels (default: 1280).\n"
+           "  --height         Render size in pixels (default: 720).\n"
+           "  --frame-latency  1 renders on a dedicated thread (default: 0).\n"
+           "  --output         Write the JSON report to this file.\n"
+           "  --baseline       Compare with a stored report; regressions exit with code 7.\n"
+           "  --tolerance      Allowed increase over the baseline in percent (default: 10).";
+}
+
+std::optional<I64> ParseInteger(const String &value)
+{
+    try {
+        Size       consumed = 0;
+        const auto parsed   = std::stoll(value, &consumed);
+        if (consumed != value.size()) {
+            return std::nullopt;
+        }
+        return parsed;
+    } catch (...) {
+        return std::nullopt;
+    }
+}
+
+std::optional<F64> ParseNumber(const String &value)
+{
+    try {
+        Size       consumed = 0;
+        const auto parsed   = std::stod(value, &consumed);
+        if (consumed != value.size()) {
+            return std::nullopt;
+        }
+        return parsed;
+    } catch (...) {
+        return std::nullopt;
+    }
+}
+
+JzERHIType ParseRhiOrDefault(const String &value)
+{
+    if (value == "opengl") return JzERHIType::OpenGL;
+    if (value == "vulkan") return JzERHIType::Vulkan;
+    return JzERHIType::Unknown;
+}
+
+String RhiToString(JzERHIType type)
+{
+    if (type == JzERHIType::OpenGL) return "opengl";
+    if (type == JzERHIType::Vulkan) return "vulkan";
+    return "auto";
+}
+
+/**
+ * @brief Integer hash used instead of <random> distributions, whose output differs between standard libraries.
+ */
+U32 Hash(U32 value)
+{
+    value ^= value >> 16;
+    value *= 0x7feb352dU;
+    value ^= value >> 15;
+    value *= 0x846ca68bU;
+    value ^= value >> 16;
+    return value;
+}
+
+F32 Random01(U32 seed, U32 index, U32 channel)
+{
+    const U32 bits = Hash(Hash(seed) ^ Hash(index * 16U + channel));
+    return static_cast<F32>(bits >> 8) / 16777216.0f;
+}
+
+/**
+ * @brief Peak resident set size of this process.
+ */
+F64 GetPeakMemoryMB()
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return 0.0;
+    }
+    return static_cast<F64>(counters.PeakWorkingSetSize) / (1024.0 * 1024.0);
+#else
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0.0;
+    }
+#if defined(__APPLE__)
+    return static_cast<F64>(usage.ru_maxrss) / (1024.0 * 1024.0); // bytes
+#else
+    return static_cast<F64>(usage.ru_maxrss) / 1024.0; // kilobytes
+#endif
+#endif
+}
+
+/**
+ * @brief System name without namespace or class-key, e.g. "JzRenderSystem".
+ */
+String ShortSystemName(std::string_view name)
+{
+    const auto separator = name.find_last_of(": ");
+    if (separator != std::string_view::npos) {
+        name.remove_prefix(separator + 1);
+    }
+    return String(name);
+}
+
+std::shared_ptr<JzMesh> CreateSphereMesh(U32 rings, U32 segments)
+{
+    constexpr F32 kPi = 3.14159265358979f;
+
+    std::vector<JzVertex> vertices;
+    std::vector<U32>      indices;
+    vertices.reserve(static_cast<Size>(rings + 1) * (segments + 1));
+    indices.reserve(static_cast<Size>(rings) * segments * 6);
+
+    for (U32 ring = 0; ring <= rings; ++ring) {
+        const F32 v     = static_cast<F32>(ring) / static_cast<F32>(rings);
+        const F32 theta = v * kPi;
+        for (U32 segment = 0; segment <= segments; ++segment) {
+            const F32 u   = static_cast<F32>(segment) / static_cast<F32>(segments);
+            const F32 phi = u * 2.0f * kPi;
+
+            JzVertex vertex{};
+            vertex.Normal    = JzVec3(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+            vertex.Position  = vertex.Normal * 0.5f;
+            vertex.TexCoords = JzVec2(u, v);
+            vertex.Tangent   = JzVec3(-std::sin(phi), 0.0f, std::cos(phi));
+            vertices.push_back(vertex);
+        }
+    }
+
+    for (U32 ring = 0; ring < rings; ++ring) {
+        for (U32 segment = 0; segment < segments; ++segment) {
+            const U32 current = ring * (segments + 1) + segment;
+            const U32 below   = current + segments + 1;
+            indices.insert(indices.end(), {current, below, current + 1, current + 1, below, below + 1});
+        }
+    }
+
+    auto mesh = std::make_shared<JzMesh>(std::move(vertices), std::move(indices));
+    mesh->Load();
+    return mesh;
+}
+
+/**
+ * @brief Runtime that generates the stress scene and samples every frame.
+ */
+class JzBenchRuntime final : public JzRERuntime {
+public:
+    JzBenchRuntime(const JzRERuntimeSettings &settings, const JzBenchSceneConfig &scene, U32 warmupFrames) :
+        JzRERuntime(settings),
+        m_scene(scene),
+        m_warmupFrames(warmupFrames) { }
+
+    std::vector<F64>                   frameTimesMs;
+    std::map<String, std::vector<F64>> systemTimesMs;
+    std::vector<F64>                   drawCalls;
+    std::vector<F64>                   triangles;
+    std::vector<F64>                   drawItems;
+
+protected:
+    void OnStart() override
+    {
+        GenerateScene();
+        GetWorld().SetSystemTimingEnabled(true);
+    }
+
+    void OnUpdate(F32 deltaTime) override
+    {
+        // Systems run after OnUpdate, so this samples the previous frame
+        const auto now = Clock::now();
+        if (m_updatedFrames > 0) {
+            RecordFrame(now);
+        }
+        m_lastUpdate = now;
+        m_updatedFrames++;
+
+        // Deterministic camera motion so culling and LOD see a changing view
+        if (auto *orbit = GetWorld().TryGetComponent<JzOrbitControllerComponent>(m_mainCameraEntity)) {
+            orbit->yaw += deltaTime * 0.25f;
+        }
+    }
+
+    void OnRender(F32 deltaTime) override
+    {
+        (void)deltaTime;
+
+        // Runs on the render thread with a frame latency of 1, hence its own counter
+        if (m_renderedFrames++ < m_warmupFrames || !m_graphicsContext || !m_graphicsContext->IsInitialized()) {
+            return;
+        }
+
+        const auto &stats = m_graphicsContext->GetDevice().GetStats();
+        drawCalls.push_back(static_cast<F64>(stats.drawCalls));
+        triangles.push_back(static_cast<F64>(stats.triangles));
+        drawItems.push_back(static_cast<F64>(m_renderSystem->GetRenderSnapshot().draws.size()));
+    }
+
+    void OnStop() override
+    {
+        if (m_updatedFrames > 0) {
+            RecordFrame(Clock::now());
+        }
+    }
+
+private:
+    void RecordFrame(Clock::time_point now)
+    {
+        if (m_updatedFrames <= m_warmupFrames) {
+            return;
+        }
+
+        frameTimesMs.push_back(std::chrono::duration<F64, std::milli>(now - m_lastUpdate).count());
+        for (const auto &timing : GetWorld().GetSystemTimings()) {
+            systemTimesMs[ShortSystemName(timing.name)].push_back(static_cast<F64>(timing.lastUpdateNs) / 1.0e6);
+        }
+    }
+
+    void GenerateScene()
+    {
+        auto &world       = GetWorld();
+        auto &assetSystem = GetAssetSystem();
+        const U32 seed    = m_scene.seed;
+
+        // Tessellation varies per mesh so the unique meshes differ in cost
+        std::vector<JzMeshHandle> meshes;
+        for (U32 i = 0; i < m_scene.meshes; ++i) {
+            const U32 rings = 6 + (i % 8) * 2;
+            meshes.push_back(assetSystem.RegisterAsset<JzMesh>(std::format("bench#mesh{}", i), CreateSphereMesh(rings, rings * 2)));
+        }
+
+        std::vector<JzMaterialHandle> materials;
+        for (U32 i = 0; i < m_scene.materials; ++i) {
+            JzMaterialProperties props;
+            props.name         = std::format("BenchMaterial{}", i);
+            props.diffuseColor = JzVec3(Random01(seed, i, 0), Random01(seed, i, 1), Random01(seed, i, 2));
+            materials.push_back(assetSystem.RegisterAsset<JzMaterial>(std::format("bench#mat{}", i), std::make_shared<JzMaterial>(props)));
+        }
+
+        const U32 side    = static_cast<U32>(std::ceil(std::sqrt(static_cast<F64>(m_scene.entities))));
+        const F32 spacing = 2.0f;
+        const F32 extent  = static_cast<F32>(side) * spacing;
+
+        for (U32 i = 0; i < m_scene.entities; ++i) {
+            const F32 x     = (static_cast<F32>(i % side) + 0.5f) * spacing - extent * 0.5f;
+            const F32 z     = (static_cast<F32>(i / side) + 0.5f) * spacing - extent * 0.5f;
+            const F32 y     = Random01(seed, i, 3) * spacing;
+            const F32 scale = 0.5f + Random01(seed, i, 4);
+
+            auto entity = world.CreateEntity();
+            world.AddComponent<JzTransformComponent>(entity, JzVec3(x, y, z), JzVec3(0.0f, 0.0f, 0.0f), JzVec3(scale, scale, scale));
+            assetSystem.AttachMesh(world, entity, meshes[Hash(seed ^ (i * 2U)) % meshes.size()]);
+            assetSystem.AttachMaterial(world, entity, materials[Hash(seed ^ (i * 2U + 1U)) % materials.size()]);
+        }
+
+        for (U32 i = 0; i < m_scene.lights; ++i) {
+            auto entity = world.CreateEntity();
+            world.AddComponent<JzTransformComponent>(
+                entity, JzVec3((Random01(seed, i, 5) - 0.5f) * extent, spacing * 3.0f, (Random01(seed, i, 6) - 0.5f) * extent));
+
+            auto &light = world.AddComponent<JzPointLightComponent>(entity);
+            light.color = JzVec3(Random01(seed, i, 7), Random01(seed, i, 8), Random01(seed, i, 9));
+            light.range = extent * 0.5f;
+        }
+
+        if (auto *camera = world.TryGetComponent<JzCameraComponent>(m_mainCameraEntity)) {
+            camera->farPlane = extent * 4.0f;
+        }
+        if (auto *orbit = world.TryGetComponent<JzOrbitControllerComponent>(m_mainCameraEntity)) {
+            orbit->distance    = extent;
+            orbit->maxDistance = std::max(orbit->maxDistance, extent * 2.0f);
+            orbit->pitch       = 0.6f;
+        }
+    }
+
+private:
+    JzBenchSceneConfig m_scene;
+    U32                m_warmupFrames   = 0;
+    U32                m_updatedFrames  = 0;
+    U32                m_renderedFrames = 0;
+    Clock::time_point  m_lastUpdate;
+};
+
+Json StatsToJson(const JzBenchStats &stats)
+{
+    Json json;
+    json["mean"] = stats.mean;
+    json["min"]  = stats.min;
+    json["p50"]  = stats.p50;
+    json["p90"]  = stats.p90;
+    json["p95"]  = stats.p95;
+    json["p99"]  = stats.p99;
+    json["max"]  = stats.max;
+    return json;
+}
+
+std::optional<JzBenchMetrics> LoadBaselineMetrics(const std::filesystem::path &path)
+{
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return std::nullopt;
+    }
+
+    const auto baseline = Json::parse(file, nullptr, false);
+    if (baseline.is_discarded() || !baseline.contains("metrics") || !baseline["metrics"].is_object()) {
+        return std::nullopt;
+    }
+
+    JzBenchMetrics metrics;
+    for (const auto &[name, value] : baseline["metrics"].items()) {
+        if (value.is_number()) {
+            metrics[name] = value.get<F64>();
+        }
+    }
+    return metrics;
+}
+
+} // namespace
+
+const String &JzBenchCommand::GetDomain() const
+{
+    return kDomain;
+}
+
+JzCliResult JzBenchCommand::Execute(JzCliContext              &context,
+                                    const std::vector<String> &args,
+                                    JzCliOutputFormat          format)
+{
+    (void)context;
+
+    if (!args.empty() && (args.front() == "--help" || args.front() == "-h")) {
+        return JzCliResult::Ok(BuildHelp());
+    }
+
+    const auto parsed = JzCliArgParser::Parse(args);
+
+    JzBenchSceneConfig scene;
+    U32                frames    = 300;
+    U32                warmup    = 30;
+    F64                tolerance = 10.0;
+
+    JzRERuntimeSettings settings;
+    settings.windowTitle    = "JzRE Bench";
+    settings.windowVisible  = false;
+    settings.fixedDeltaTime = 1.0f / 60.0f;
+
+    // Every count option is a non-negative integer; `minimum` rejects empty scenes
+    const auto readCount = [&parsed](const String &key, U32 &value, I64 minimum) -> std::optional<JzCliResult> {
+        const auto *text = parsed.GetFirstValue(key);
+        if (!text) {
+            return std::nullopt;
+        }
+        const auto number = ParseInteger(*text);
+        if (!number.has_value() || *number < minimum || *number > std::numeric_limits<I32>::max()) {
+            return JzCliResult::Error(JzCliExitCode::InvalidArguments, std::format("Invalid {} value: {}", key, *text));
+        }
+        value = static_cast<U32>(*number);
+        return std::nullopt;
+    };
+
+    U32 width   = static_cast<U32>(settings.windowSize.x);
+    U32 height  = static_cast<U32>(settings.windowSize.y);
+    U32 latency = 0;
+    for (const auto &[key, value, minimum] : std::initializer_list<std::tuple<String, U32 *, I64>>{
+             {"--entities", &scene.entities, 1},
+             {"--meshes", &scene.meshes, 1},
+             {"--materials", &scene.materials, 1},
+             {"--lights", &scene.lights, 0},
+             {"--seed", &scene.seed, 0},
+             {"--frames", &frames, 1},
+             {"--warmup", &warmup, 0},
+             {"--width", &width, 1},
+             {"--height", &height, 1},
+             {"--frame-latency", &latency, 0},
+         }) {
+        if (auto error = readCount(key, *value, minimum)) {
+            return *error;
+        }
+    }
+
+    if (latency > 1) {
+        return JzCliResult::Error(JzCliExitCode::InvalidArguments,
+                                  std::format("Invalid frame latency: {} (expected 0 or 1)", latency));
+    }
+
+    if (auto *deltaValue = parsed.GetFirstValue("--delta")) {
+        auto delta = ParseNumber(*deltaValue);
+        if (!delta.has_value() || *delta <= 0.0) {
+            return JzCliResult::Error(JzCliExitCode::InvalidArguments,
+                                      std::format("Invalid timestep: {}", *deltaValue));
+        }
+        settings.fixedDeltaTime = static_cast<F32>(*delta);
+    }
+
+    if (auto *toleranceValue = parsed.GetFirstValue("--tolerance")) {
+        auto value = ParseNumber(*toleranceValue);
+        if (!value.has_value() || *value < 0.0) {
+            return JzCliResult::Error(JzCliExitCode::InvalidArguments,
+                                      std::format("Invalid tolerance: {}", *toleranceValue));
+        }
+        tolerance = *value;
+    }
+
+    if (auto *rhi = parsed.GetFirstValue("--rhi")) {
+        settings.rhiType = ParseRhiOrDefault(*rhi);
+    }
+
+    settings.windowSize         = {static_cast<I32>(width), static_cast<I32>(height)};
+    settings.renderFrameLatency = latency;
+    settings.maxFrames          = warmup + frames;
+
+    std::optional<JzBenchMetrics> baselineMetrics;
+    std::filesystem::path         baselinePath;
+    if (auto *baselineValue = parsed.GetFirstValue("--baseline")) {
+        baselinePath    = std::filesystem::path(*baselineValue).lexically_normal();
+        baselineMetrics = LoadBaselineMetrics(baselinePath);
+        if (!baselineMetrics.has_value()) {
+            return JzCliResult::Error(JzCliExitCode::IoError,
+                                      std::format("Failed to read baseline metrics from '{}'", baselinePath.string()));
+        }
+    }
+
+    Json           report;
+    JzBenchMetrics metrics;
+
+    try {
+        JzBenchRuntime runtime(settings, scene, warmup);
+        runtime.Run();
+
+        if (runtime.frameTimesMs.empty()) {
+            return JzCliResult::Error(JzCliExitCode::RuntimeError, "Benchmark finished without measured frames");
+        }
+
+        const auto frameStats = JzBenchReport::ComputeStats(runtime.frameTimesMs);
+        const auto drawStats  = JzBenchReport::ComputeStats(runtime.drawCalls);
+        const auto triStats   = JzBenchReport::ComputeStats(runtime.triangles);
+        const auto itemStats  = JzBenchReport::ComputeStats(runtime.drawItems);
+        const F64  peakMemory = GetPeakMemoryMB();
+
+        report["scene"] = {
+            {"entities", scene.entities},
+            {"meshes", scene.meshes},
+            {"materials", scene.materials},
+            {"lights", scene.lights},
+            {"seed", scene.seed},
+        };
+        report["rhi"]            = RhiToString(settings.rhiType);
+        report["width"]          = width;
+        report["height"]         = height;
+        report["frameLatency"]   = latency;
+        report["frames"]         = frameStats.samples;
+        report["warmupFrames"]   = warmup;
+        report["fixedDeltaTime"] = settings.fixedDeltaTime;
+        report["frameTimeMs"]    = StatsToJson(frameStats);
+        report["drawCalls"]      = StatsToJson(drawStats);
+        report["triangles"]      = StatsToJson(triStats);
+        report["drawItems"]      = StatsToJson(itemStats);
+        report["peakMemoryMB"]   = peakMemory;
+
+        JzBenchReport::AddStats(metrics, "frameTimeMs", frameStats);
+        for (const auto &[name, samples] : runtime.systemTimesMs) {
+            const auto stats             = JzBenchReport::ComputeStats(samples);
+            report["systemTimeMs"][name] = StatsToJson(stats);
+
+            metrics["systemTimeMs." + name + ".p50"] = stats.p50;
+            metrics["systemTimeMs." + name + ".p95"] = stats.p95;
+        }
+        metrics["drawCalls.mean"] = drawStats.mean;
+        metrics["triangles.mean"] = triStats.mean;
+        metrics["peakMemoryMB"]   = peakMemory;
+        report["metrics"]         = metrics;
+    } catch (const std::exception &e) {
+        return JzCliResult::Error(JzCliExitCode::RuntimeError,
+                                  std::format("Benchmark runtime failed: {}", e.what()));
+    }
+
+    std::vector<JzBenchRegression> regressions;
+    if (baselineMetrics.has_value()) {
+        regressions = JzBenchReport::Compare(*baselineMetrics, metrics, tolerance / 100.0);
+
+        report["baseline"]    = baselinePath.string();
+        report["tolerance"]   = tolerance;
+        report["regressions"] = Json::array();
+        for (const auto &regression : regressions) {
+            report["regressions"].push_back({
+                {"metric", regression.metric},
+                {"baseline", regression.baseline},
+                {"current", regression.current},
+            });
+        }
+    }
+
+    if (auto *outputValue = parsed.GetFirstValue("--output")) {
+        const auto outputPath = std::filesystem::path(*outputValue).lexically_normal();
+        if (outputPath.has_parent_path()) {
+            std::error_code ec;
+            std::filesystem::create_directories(outputPath.parent_path(), ec);
+        }
+
+        std::ofstream file(outputPath, std::ios::out | std::ios::trunc);
+        if (!file.is_open()) {
+            return JzCliResult::Error(JzCliExitCode::IoError,
+                                      std::format("Failed to write report to '{}'", outputPath.string()));
+        }
+        file << report.dump(2) << "\n";
+    }
+
+    const auto code = regressions.empty() ? JzCliExitCode::Success : JzCliExitCode::Regression;
+
+    if (format == JzCliOutputFormat::Json) {
+        return {code, report.dump(2)};
+    }
+
+    const auto        &frameTime = report["frameTimeMs"];
+    std::ostringstream ss;
+    ss << std::format("Bench: {} entities, {} meshes, {} materials, {} lights, {} frames ({} warmup)\n",
+                      scene.entities, scene.meshes, scene.materials, scene.lights, frames, warmup);
+    ss << std::format("  frame time   mean {:.3f} ms, p50 {:.3f}, p95 {:.3f}, p99 {:.3f}, max {:.3f}\n",
+                      frameTime["mean"].get<F64>(), frameTime["p50"].get<F64>(), frameTime["p95"].get<F64>(),
+                      frameTime["p99"].get<F64>(), frameTime["max"].get<F64>());
+    ss << std::format("  draw calls   {:.0f} per frame, {:.0f} triangles, {:.0f} draw items\n",
+                      report["drawCalls"]["mean"].get<F64>(), report["triangles"]["mean"].get<F64>(),
+                      report["drawItems"]["mean"].get<F64>());
+    ss << std::format("  peak memory  {:.1f} MB\n", report["peakMemoryMB"].get<F64>());
+    if (report.contains("systemTimeMs")) {
+        for (const auto &[name, stats] : report["systemTimeMs"].items()) {
+            ss << std::format("  {:<20} p50 {:.3f} ms, p95 {:.3f}\n", name, stats["p50"].get<F64>(),
+                              stats["p95"].get<F64>());
+        }
+    }
+
+    if (baselineMetrics.has_value()) {
+        if (regressions.empty()) {
+            ss << std::format("No regressions against '{}' (tolerance {}%)", baselinePath.string(), tolerance);
+        } else {
+            ss << std::format("{} regression(s) against '{}' (tolerance {}%):", regressions.size(),
+                              baselinePath.string(), tolerance);
+            for (const auto &regression : regressions) {
+                ss << std::format("\n  {}: {:.3f} -> {:.3f}", regression.metric, regression.baseline,
+                                  regression.current);
+            }
+        }
+    }
+
+    String message = ss.str();
+    while (!message.empty() && message.back() == '\n') {
+        message.pop_back();
+    }
+    return {code, std::move(message)};
+}
+
+String JzBenchCommand::GetHelp() const
+{
+    return "  bench    Run a headless stress-scene benchmark";
+}
+
+} // namespace JzRE
@@ -6,15 +6,21 @@
 #include "JzRE/CLI/commands/JzBuildCommand.h"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstdlib>
 #include <format>
 #include <fstream>
+#include <mutex>
 #include <sstream>
+#include <utility>
 
 #include <nlohmann/json.hpp>
 
 #include "JzRE/CLI/JzCliArgParser.h"
+#include "JzRE/Runtime/Core/JzThreadPool.h"
+#include "JzRE/Runtime/Resource/JzTexture.h"
+#include "JzRE/Runtime/Resource/JzTextureCompressor.h"
 
 namespace JzRE {
 
@@ -29,11 +35,14 @@ String BuildHelp()
 {
     return "build command:\n"
            "  JzRE build [path] [--project <file.jzreproject>] [--shaders-only] [--tool <path>]\n"
+           "             [--texture-format auto|bc1|bc3|bc4|bc5|bc7|rgba8] [--no-mips]\n"
            "\n"
-           "  path          Project directory (default: current working directory).\n"
-           "  --project     Explicit path to .jzreproject file.\n"
-           "  --shaders-only Cook shaders only, skip other build steps.\n"
-           "  --tool        Path to JzREShaderTool (overrides JzRE_SHADER_TOOL_PATH env var).";
+           "  path             Project directory (default: current working directory).\n"
+           "  --project        Explicit path to .jzreproject file.\n"
+           "  --shaders-only   Cook shaders only, skip other build steps.\n"
+           "  --tool           Path to JzREShaderTool (overrides JzRE_SHADER_TOOL_PATH env var).\n"
+           "  --texture-format Block format of cooked textures (default: auto, BC1 or BC7 per image).\n"
+           "  --no-mips        Cook the base level only instead of a full mip chain.";
 }
 
 // ---------------------------------------------------------------------------
@@ -136,6 +145,7 @@ Bool CookOneManifest(const std::filesystem::path &toolPath,
 struct CookResult {
     Size                cookedCount{0};
     Size                totalCount{0};
+    Size                upToDateCount{0};
     std::vector<String> failedFiles;
 };
 
@@ -167,6 +177,156 @@ CookResult CookShaders(const std::filesystem::path &toolPath,
     return cookResult;
 }
 
+// ---------------------------------------------------------------------------
+// Texture cooking helpers
+// ---------------------------------------------------------------------------
+
+Bool IsTextureSourcePath(const std::filesystem::path &path)
+{
+    auto extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+    return extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".tga" ||
+           extension == ".bmp";
+}
+
+std::optional<JzETextureResourceFormat> ParseTextureFormat(const String &value)
+{
+    if (value == "auto") return JzETextureResourceFormat::Unknown;
+    if (value == "bc1") return JzETextureResourceFormat::BC1;
+    if (value == "bc3") return JzETextureResourceFormat::BC3;
+    if (value == "bc4") return JzETextureResourceFormat::BC4;
+    if (value == "bc5") return JzETextureResourceFormat::BC5;
+    if (value == "bc7") return JzETextureResourceFormat::BC7;
+    if (value == "rgba8") return JzETextureResourceFormat::RGBA8;
+    return std::nullopt;
+}
+
+String TextureFormatName(JzETextureResourceFormat format)
+{
+    switch (format) {
+        case JzETextureResourceFormat::BC1: return "bc1";
+        case JzETextureResourceFormat::BC3: return "bc3";
+        case JzETextureResourceFormat::BC4: return "bc4";
+        case JzETextureResourceFormat::BC5: return "bc5";
+        case JzETextureResourceFormat::BC7: return "bc7";
+        case JzETextureResourceFormat::RGBA8: return "rgba8";
+        default: return "auto";
+    }
+}
+
+/**
+ * @brief Options a cooked file was produced with, stored next to it.
+ */
+String CookOptionsStamp(const JzBuildOptions &options)
+{
+    return std::format("texture-format={}\nmips={}\n", TextureFormatName(options.textureFormat),
+                       options.generateMips ? "on" : "off");
+}
+
+std::filesystem::path GetCookOptionsPath(const std::filesystem::path &cooked)
+{
+    auto stampPath = cooked;
+    stampPath += ".options";
+    return stampPath;
+}
+
+Bool IsUpToDate(const std::filesystem::path &source, const std::filesystem::path &cooked, const String &optionsStamp)
+{
+    std::error_code ec;
+    const auto      cookedTime = std::filesystem::last_write_time(cooked, ec);
+    if (ec) {
+        return false;
+    }
+    const auto sourceTime = std::filesystem::last_write_time(source, ec);
+    if (ec || cookedTime < sourceTime) {
+        return false;
+    }
+
+    // Cooked with other options (or by a build that did not record them)
+    std::ifstream      ifs(GetCookOptionsPath(cooked));
+    std::ostringstream stored;
+    stored << ifs.rdbuf();
+    return ifs.is_open() && stored.str() == optionsStamp;
+}
+
+Bool CookTexture(const std::filesystem::path &source, const std::filesystem::path &cooked,
+                 const JzBuildOptions &options, const String &optionsStamp)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(cooked.parent_path(), ec);
+
+    // Drop the old stamp first so a failed cook is never taken as up to date
+    std::filesystem::remove(GetCookOptionsPath(cooked), ec);
+    if (!JzTextureCompressor::CookFile(source, cooked, options.textureFormat, options.generateMips)) {
+        return false;
+    }
+
+    std::ofstream ofs(GetCookOptionsPath(cooked), std::ios::binary | std::ios::trunc);
+    ofs << optionsStamp;
+    return static_cast<Bool>(ofs);
+}
+
+CookResult CookTextures(const std::filesystem::path &contentRoot, const std::filesystem::path &cookedRoot,
+                        const JzBuildOptions &options)
+{
+    CookResult cookResult;
+
+    std::vector<std::filesystem::path> sources;
+    std::error_code                    ec;
+    if (std::filesystem::is_directory(contentRoot, ec)) {
+        for (std::filesystem::recursive_directory_iterator it(
+                 contentRoot, std::filesystem::directory_options::skip_permission_denied, ec),
+             end;
+             it != end;
+             it.increment(ec)) {
+            if (ec || !it->is_regular_file(ec)) {
+                continue;
+            }
+            if (IsTextureSourcePath(it->path())) {
+                sources.push_back(it->path().lexically_normal());
+            }
+        }
+    }
+    std::sort(sources.begin(), sources.end());
+    cookResult.totalCount = sources.size();
+
+    // Sources changed, or cooked with other options, since the last build are the only ones cooked again
+    const String optionsStamp = CookOptionsStamp(options);
+
+    std::vector<std::pair<std::filesystem::path, std::filesystem::path>> stale; // Source and cooked path
+    for (const auto &source : sources) {
+        const auto cooked = JzTexture::GetCookedPath(source, contentRoot, cookedRoot);
+        if (IsUpToDate(source, cooked, optionsStamp)) {
+            ++cookResult.upToDateCount;
+        } else {
+            stale.emplace_back(source, cooked);
+        }
+    }
+
+    if (stale.empty()) {
+        return cookResult;
+    }
+
+    std::atomic<Size> cookedCount{0};
+    std::mutex        failedMutex;
+    JzThreadPool      pool;
+    pool.ParallelFor(0, stale.size(), 1, [&](Size chunkBegin, Size chunkEnd) {
+        for (Size i = chunkBegin; i < chunkEnd; ++i) {
+            const auto &[source, cooked] = stale[i];
+            if (CookTexture(source, cooked, options, optionsStamp)) {
+                cookedCount.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                std::lock_guard<std::mutex> lock(failedMutex);
+                cookResult.failedFiles.push_back(source.string());
+            }
+        }
+    });
+
+    cookResult.cookedCount = cookedCount.load();
+    std::sort(cookResult.failedFiles.begin(), cookResult.failedFiles.end());
+    return cookResult;
+}
+
 void WriteStampFile(const std::filesystem::path &projectDir)
 {
     const auto    stampPath = (projectDir / kBuildStamp).lexically_normal();
@@ -225,7 +385,7 @@ std::optional<std::filesystem::path> DiscoverProjectFile(const std::filesystem::
 JzCliResult JzBuildCommand::BuildProject(JzCliContext                &context,
                                          const std::filesystem::path &projectPath,
                                          JzCliOutputFormat            format,
-                                         const String               *toolOverride)
+                                         const JzBuildOptions        &options)
 {
     const auto loadResult = context.LoadProject(projectPath);
     if (loadResult != JzEProjectResult::Success) {
@@ -238,22 +398,36 @@ JzCliResult JzBuildCommand::BuildProject(JzCliContext                &context,
     const auto &cfg        = context.GetProjectManager().GetConfig();
     const auto  sourceRoot = cfg.GetShaderSourcePath();
     const auto  outputRoot = cfg.GetShaderCookedPath();
-    const auto  toolPath   = ResolveToolPath(toolOverride);
+    const auto  toolPath   = ResolveToolPath(options.toolOverride);
 
-    auto cookResult = CookShaders(toolPath, sourceRoot, outputRoot);
+    auto cookResult    = CookShaders(toolPath, sourceRoot, outputRoot);
+    auto textureResult = options.shadersOnly
+                             ? CookResult{}
+                             : CookTextures(cfg.GetContentPath(), cfg.GetTextureCookedPath(), options);
 
-    if (!cookResult.failedFiles.empty()) {
+    if (!cookResult.failedFiles.empty() || !textureResult.failedFiles.empty()) {
         std::ostringstream ss;
-        ss << "Build failed: " << cookResult.failedFiles.size() << " shader(s) could not be cooked\n";
-        for (const auto &f : cookResult.failedFiles) {
-            ss << "  - " << f << "\n";
+        if (!cookResult.failedFiles.empty()) {
+            ss << "Build failed: " << cookResult.failedFiles.size() << " shader(s) could not be cooked\n";
+            for (const auto &f : cookResult.failedFiles) {
+                ss << "  - " << f << "\n";
+            }
+        }
+        if (!textureResult.failedFiles.empty()) {
+            ss << "Build failed: " << textureResult.failedFiles.size() << " texture(s) could not be cooked\n";
+            for (const auto &f : textureResult.failedFiles) {
+                ss << "  - " << f << "\n";
+            }
         }
         if (format == JzCliOutputFormat::Json) {
             Json payload;
-            payload["ok"]           = false;
-            payload["cooked"]       = cookResult.cookedCount;
-            payload["total"]        = cookResult.totalCount;
-            payload["failed_files"] = cookResult.failedFiles;
+            payload["ok"]                       = false;
+            payload["cooked"]                   = cookResult.cookedCount;
+            payload["total"]                    = cookResult.totalCount;
+            payload["failed_files"]             = cookResult.failedFiles;
+            payload["textures"]["cooked"]       = textureResult.cookedCount;
+            payload["textures"]["total"]        = textureResult.totalCount;
+            payload["textures"]["failed_files"] = textureResult.failedFiles;
             return JzCliResult::Error(JzCliExitCode::ToolError, payload.dump(2));
         }
         return JzCliResult::Error(JzCliExitCode::ToolError, ss.str());
@@ -263,15 +437,27 @@ JzCliResult JzBuildCommand::BuildProject(JzCliContext                &context,
 
     if (format == JzCliOutputFormat::Json) {
         Json payload;
-        payload["ok"]      = true;
-        payload["project"] = projectPath.string();
-        payload["cooked"]  = cookResult.cookedCount;
-        payload["total"]   = cookResult.totalCount;
+        payload["ok"]                     = true;
+        payload["project"]                = projectPath.string();
+        payload["cooked"]                 = cookResult.cookedCount;
+        payload["total"]                  = cookResult.totalCount;
+        payload["textures"]["cooked"]     = textureResult.cookedCount;
+        payload["textures"]["total"]      = textureResult.totalCount;
+        payload["textures"]["up_to_date"] = textureResult.upToDateCount;
         return JzCliResult::Ok(payload.dump(2));
     }
 
-    return JzCliResult::Ok(
-        std::format("Build complete: {}/{} shaders cooked", cookResult.cookedCount, cookResult.totalCount));
+    if (options.shadersOnly) {
+        return JzCliResult::Ok(
+            std::format("Build complete: {}/{} shaders cooked", cookResult.cookedCount, cookResult.totalCount));
+    }
+
+    return JzCliResult::Ok(std::format("Build complete: {}/{} shaders cooked, {}/{} textures cooked ({} up to date)",
+                                       cookResult.cookedCount,
+                                       cookResult.totalCount,
+                                       textureResult.cookedCount,
+                                       textureResult.totalCount,
+                                       textureResult.upToDateCount));
 }
 
 // ---------------------------------------------------------------------------
@@ -291,7 +477,22 @@ JzCliResult JzBuildCommand::Execute(JzCliContext              &context,
         return JzCliResult::Ok(BuildHelp());
     }
 
-    auto parsed = JzCliArgParser::Parse(args);
+    auto parsed = JzCliArgParser::Parse(args, {"--shaders-only", "--no-mips"});
+
+    JzBuildOptions options;
+    options.toolOverride = parsed.GetFirstValue("--tool");
+    options.shadersOnly  = parsed.HasOption("--shaders-only");
+    options.generateMips = !parsed.HasOption("--no-mips");
+    if (auto *textureFormat = parsed.GetFirstValue("--texture-format")) {
+        const auto parsedFormat = ParseTextureFormat(*textureFormat);
+        if (!parsedFormat.has_value()) {
+            return JzCliResult::Error(JzCliExitCode::InvalidArguments,
+                                      std::format("Unknown texture format '{}'. Expected auto, bc1, bc3, bc4, "
+                                                  "bc5, bc7 or rgba8.",
+                                                  *textureFormat));
+        }
+        options.textureFormat = *parsedFormat;
+    }
 
     // Resolve project file
     std::filesystem::path projectPath;
@@ -325,12 +526,12 @@ JzCliResult JzBuildCommand::Execute(JzCliContext              &context,
         }
     }
 
-    return BuildProject(context, projectPath, format, parsed.GetFirstValue("--tool"));
+    return BuildProject(context, projectPath, format, options);
 }
 
 String JzBuildCommand::GetHelp() const
 {
-    return "  build    Cook project content (shaders, etc.)";
+    return "  build    Cook project content (shaders, textures)";
 }
 
 } // namespace JzRE
@@ -36,6 +36,8 @@ String BuildHelp()
     return "run command:\n"
            "  JzRE run [path] [--project <file.jzreproject>] [--rhi auto|opengl|vulkan]\n"
            "           [--width <n>] [--height <n>] [--title <name>] [--skip-build]\n"
+           "           [--profile-frames <n>] [--profile-output <file.json>] [--frame-latency 0|1]\n"
+           "           [--no-indirect-draw]\n"
            "\n"
            "  path          Project directory; searches it and parent directories for a\n"
            "                .jzreproject file. Omit to use the current working directory\n"
@@ -45,7 +47,14 @@ String BuildHelp()
            "  --width       Window width in pixels.\n"
            "  --height      Window height in pixels.\n"
            "  --title       Window title.\n"
-           "  --skip-build  Skip automatic build even if project has not been built yet.";
+           "  --skip-build  Skip automatic build even if project has not been built yet.\n"
+           "  --profile-frames  Capture CPU/GPU zones of the first n frames and export\n"
+           "                    a Chrome trace (chrome://tracing, ui.perfetto.dev).\n"
+           "  --profile-output  Trace file (default: <project>/Intermediate/Profiles/profile.json).\n"
+           "  --frame-latency   1 renders on a dedicated thread one frame behind the\n"
+           "                    simulation (default: 0, render on the main thread).\n"
+           "  --no-indirect-draw  Submit geometry one draw per entity instead of with\n"
+           "                      multi-draw indirect.";
 }
 
 std::optional<I32> ParseInteger(const String &value)
@@ -127,7 +136,7 @@ JzCliResult JzRunCommand::Execute(JzCliContext              &context,
         return JzCliResult::Ok(BuildHelp());
     }
 
-    const std::unordered_set<String> flags  = {"--skip-build"};
+    const std::unordered_set<String> flags  = {"--skip-build", "--no-indirect-draw"};
     auto                             parsed = JzCliArgParser::Parse(args, flags);
 
     // Resolve project file
@@ -217,6 +226,32 @@ JzCliResult JzRunCommand::Execute(JzCliContext              &context,
         settings.windowTitle = *title;
     }
 
+    if (auto *framesValue = parsed.GetFirstValue("--profile-frames")) {
+        auto frames = ParseInteger(*framesValue);
+        if (!frames.has_value() || *frames <= 0) {
+            return JzCliResult::Error(JzCliExitCode::InvalidArguments,
+                                      std::format("Invalid profile frame count: {}", *framesValue));
+        }
+        settings.profileFrames = static_cast<U32>(*frames);
+
+        if (auto *output = parsed.GetFirstValue("--profile-output")) {
+            settings.profileOutput = std::filesystem::path(*output).lexically_normal();
+        } else {
+            settings.profileOutput = projectPath.parent_path() / "Intermediate" / "Profiles" / "profile.json";
+        }
+    }
+
+    if (auto *latencyValue = parsed.GetFirstValue("--frame-latency")) {
+        auto latency = ParseInteger(*latencyValue);
+        if (!latency.has_value() || *latency < 0 || *latency > 1) {
+            return JzCliResult::Error(JzCliExitCode::InvalidArguments,
+                                      std::format("Invalid frame latency: {} (expected 0 or 1)", *latencyValue));
+        }
+        settings.renderFrameLatency = static_cast<U32>(*latency);
+    }
+
+    settings.indirectDraw = !parsed.HasOption("--no-indirect-draw");
+
     try {
         JzCliRuntime runtime(settings);
         runtime.Run();
@@ -233,6 +268,12 @@ JzCliResult JzRunCommand::Execute(JzCliContext              &context,
         payload["width"]   = settings.windowSize.x;
         payload["height"]  = settings.windowSize.y;
         payload["title"]   = settings.windowTitle;
+        if (settings.profileFrames > 0) {
+            payload["profileFrames"] = settings.profileFrames;
+            payload["profileOutput"] = settings.profileOutput.string();
+        }
+        payload["frameLatency"] = settings.renderFrameLatency;
+        payload["indirectDraw"] = settings.indirectDraw;
         return JzCliResult::Ok(payload.dump(2));
     }
 
@@ -12,6 +12,16 @@ struct VSInput
     float2 aTexCoords : TEXCOORD0;
     float3 aTangent   : TANGENT;
     float3 aBitangent : BINORMAL;
+#if USE_INDIRECT_DRAW
+    // Per-draw data, fetched through firstInstance of the indirect command
+    float4 aModelRow0 : TEXCOORD3;
+    float4 aModelRow1 : TEXCOORD4;
+    float4 aModelRow2 : TEXCOORD5;
+    float4 aModelRow3 : TEXCOORD6;
+    float4 aDiffuse   : COLOR0;
+    float4 aAmbient   : COLOR1;
+    float4 aSpecular  : COLOR2; // rgb specular, shininess in a
+#endif
 };
 
 struct VSOutput
@@ -20,20 +30,50 @@ struct VSOutput
     float3 FragPos   : TEXCOORD0;
     float3 Normal    : TEXCOORD1;
     float2 TexCoords : TEXCOORD2;
+#if USE_INDIRECT_DRAW
+    float3 Diffuse   : TEXCOORD3;
+#endif
+    float4 ClipPos   : TEXCOORD4;
+    float  ViewDepth : TEXCOORD5;
+#if USE_INDIRECT_DRAW
+    float3 Ambient   : TEXCOORD6;
+    float4 Specular  : TEXCOORD7;
+#endif
+#if USE_NORMAL_MAP
+    float3 Tangent   : TEXCOORD8;
+    float3 Bitangent : TEXCOORD9;
+#endif
 };
 
 VSOutput VSMain(VSInput input)
 {
     VSOutput output;
 
-    const float4 worldPos = mul(model, float4(input.aPos, 1.0));
+#if USE_INDIRECT_DRAW
+    const float4x4 drawModel = float4x4(input.aModelRow0, input.aModelRow1, input.aModelRow2, input.aModelRow3);
+    output.Diffuse  = input.aDiffuse.rgb;
+    output.Ambient  = input.aAmbient.rgb;
+    output.Specular = input.aSpecular;
+#else
+    const float4x4 drawModel = model;
+#endif
+
+    const float4 worldPos = mul(drawModel, float4(input.aPos, 1.0));
     output.FragPos = worldPos.xyz;
 
-    const float3x3 normalMatrix = (float3x3)model;
+    const float3x3 normalMatrix = (float3x3)drawModel;
     output.Normal = normalize(mul(normalMatrix, input.aNormal));
+#if USE_NORMAL_MAP
+    output.Tangent   = normalize(mul(normalMatrix, input.aTangent));
+    output.Bitangent = normalize(mul(normalMatrix, input.aBitangent));
+#endif
 
     output.TexCoords = input.aTexCoords;
-    output.Position = mul(projection, mul(view, worldPos));
+
+    const float4 viewPos = mul(view, worldPos);
+    output.Position  = mul(projection, viewPos);
+    output.ClipPos   = output.Position;
+    output.ViewDepth = -viewPos.z;
     return output;
 }
 
@@ -49,23 +89,208 @@ cbuffer JzStandardMaterialUniforms : register(b1, space0)
 {
     Material material;
     int      hasDiffuseTexture;
-    float3   _padding;
+    int      hasNormalTexture;
+    int      hasSpecularTexture;
+    float    _padding;
 };
 
-Texture2D    diffuseTexture        : register(t2, space0);
-SamplerState diffuseTextureSampler : register(s2, space0);
+Texture2D    diffuseTexture         : register(t2, space0);
+SamplerState diffuseTextureSampler  : register(s2, space0);
+Texture2D    normalTexture          : register(t9, space0);
+SamplerState normalTextureSampler   : register(s9, space0);
+Texture2D    specularTexture        : register(t10, space0);
+SamplerState specularTextureSampler : register(s10, space0);
+
+// Clustered forward lighting, filled by JzClusteredLighting
+cbuffer JzStandardLightingUniforms : register(b3, space0)
+{
+    float4 clusterGridSize;    // cluster counts in xyz, directional light count in w
+    float4 clusterDepthParams; // slice = term * x + y, term = log(depth) when z is 1, else depth
+    float3 viewPosition;
+    float  lightingEnabled;
+    float  shadowsEnabled;
+    float3 _shadowPadding;
+};
+
+Texture2D<float4> lightData           : register(t4, space0); // 4 texels per light row
+Texture2D<float2> clusterGrid         : register(t5, space0); // first index, light count
+Texture2D<float>  clusterLightIndices : register(t6, space0); // 1024 light rows per texture row
+
+// Shadow atlas, filled by JzShadowAtlas
+Texture2D<float>  shadowAtlas : register(t7, space0);
+Texture2D<float4> shadowViews : register(t8, space0); // 6 texels per view: matrix rows, params, tile rect
+
+float SampleShadow(uint viewIndex, float3 position, float3 normal, float lightDistance)
+{
+    const float4 params = shadowViews.Load(int3(4, viewIndex, 0)); // split depth, texel size, is spot, valid
+    if (params.w < 0.5)
+    {
+        return 1.0;
+    }
+
+    // Push the receiver along its normal by about a texel to avoid acne
+    const float  texelSize = params.y * (params.z > 0.5 ? lightDistance : 1.0);
+    const float4 world     = float4(position + normal * texelSize * 1.5, 1.0);
+    const float4 clip      = float4(dot(shadowViews.Load(int3(0, viewIndex, 0)), world),
+                                    dot(shadowViews.Load(int3(1, viewIndex, 0)), world),
+                                    dot(shadowViews.Load(int3(2, viewIndex, 0)), world),
+                                    dot(shadowViews.Load(int3(3, viewIndex, 0)), world));
+    const float3 atlasPos  = clip.xyz / clip.w;
+    const float4 tileRect  = shadowViews.Load(int3(5, viewIndex, 0));
+    if (clip.w <= 0.0 || atlasPos.z >= 1.0 || any(atlasPos.xy < tileRect.xy) || any(atlasPos.xy >= tileRect.zw))
+    {
+        return 1.0;
+    }
+
+    // 3x3 PCF, clamped to the tile so neighbouring views never bleed in
+    const int2 texel    = int2(atlasPos.xy);
+    const int2 minTexel = int2(tileRect.xy);
+    const int2 maxTexel = int2(tileRect.zw) - 1;
+    float      lit      = 0.0;
+    for (int y = -1; y <= 1; ++y)
+    {
+        for (int x = -1; x <= 1; ++x)
+        {
+            const int2 tap = clamp(texel + int2(x, y), minTexel, maxTexel);
+            lit += atlasPos.z - 0.0005 <= shadowAtlas.Load(int3(tap, 0)) ? 1.0 : 0.0;
+        }
+    }
+    return lit / 9.0;
+}
+
+float3 EvaluateLight(uint lightRow, float3 position, float3 normal, float3 viewDir, float3 albedo, float viewDepth,
+                     Material surface)
+{
+    const float4 positionRange = lightData.Load(int3(0, lightRow, 0));
+    const float4 radianceType  = lightData.Load(int3(1, lightRow, 0));
+    const float4 directionCone = lightData.Load(int3(2, lightRow, 0));
+    const float4 innerShadow   = lightData.Load(int3(3, lightRow, 0)); // inner cone, first shadow view, view count
+    const float  innerCone     = innerShadow.x;
+
+    float3 toLight     = -directionCone.xyz;
+    float  attenuation = 1.0;
+    if (radianceType.w > 0.5)
+    {
+        const float3 offset   = positionRange.xyz - position;
+        const float  distance = length(offset);
+        toLight = offset / max(distance, 1e-4);
+
+        // Inverse square, windowed to reach zero at the light range
+        const float window = saturate(1.0 - pow(distance / max(positionRange.w, 1e-4), 4.0));
+        attenuation = window * window / (distance * distance + 1.0);
+
+        if (radianceType.w > 1.5)
+        {
+            const float cosAngle = dot(-toLight, directionCone.xyz);
+            attenuation *= saturate((cosAngle - directionCone.w) / max(innerCone - directionCone.w, 1e-4));
+        }
+    }
+
+    const float nDotL = saturate(dot(normal, toLight));
+    if (nDotL <= 0.0 || attenuation <= 0.0)
+    {
+        return float3(0.0, 0.0, 0.0);
+    }
+
+    if (shadowsEnabled > 0.5 && innerShadow.z > 0.5)
+    {
+        // Directional lights pick the first cascade reaching this depth; past the last one is unshadowed
+        const uint firstView  = (uint)innerShadow.y;
+        const uint viewCount  = (uint)innerShadow.z;
+        uint       shadowView = firstView + viewCount;
+        for (uint cascade = 0; cascade < viewCount; ++cascade)
+        {
+            const float splitDepth = shadowViews.Load(int3(4, firstView + cascade, 0)).x;
+            if (radianceType.w > 0.5 || viewDepth <= splitDepth)
+            {
+                shadowView = firstView + cascade;
+                break;
+            }
+        }
+        if (shadowView < firstView + viewCount)
+        {
+            attenuation *= SampleShadow(shadowView, position, normal, distance(positionRange.xyz, position));
+        }
+    }
+
+    const float3 halfVector = normalize(toLight + viewDir);
+    const float  specular   = pow(saturate(dot(normal, halfVector)), max(surface.shininess, 1.0));
+    return radianceType.rgb * attenuation * (albedo * nDotL + surface.specular * specular);
+}
+
+float3 ShadeClustered(VSOutput input, float3 normal, float3 albedo, Material surface)
+{
+    const float3 viewDir = normalize(viewPosition - input.FragPos);
+    float3       color   = surface.ambient * albedo;
+
+    const uint directionalCount = (uint)clusterGridSize.w;
+    for (uint lightRow = 0; lightRow < directionalCount; ++lightRow)
+    {
+        color += EvaluateLight(lightRow, input.FragPos, normal, viewDir, albedo, input.ViewDepth, surface);
+    }
+
+    const float2 uv        = saturate(input.ClipPos.xy / input.ClipPos.w * 0.5 + 0.5);
+    const float  depthTerm = clusterDepthParams.z > 0.5 ? log(max(input.ViewDepth, 1e-4)) : input.ViewDepth;
+    const uint3  gridSize  = (uint3)clusterGridSize.xyz;
+    const uint3  cluster   = uint3(min((uint2)(uv * clusterGridSize.xy), gridSize.xy - 1),
+                                   (uint)clamp(depthTerm * clusterDepthParams.x + clusterDepthParams.y, 0.0, clusterGridSize.z - 1.0));
+
+    const float2 range = clusterGrid.Load(int3(cluster.x, cluster.y + cluster.z * gridSize.y, 0));
+    const uint   first = (uint)range.x;
+    const uint   count = (uint)range.y;
+    for (uint entry = first; entry < first + count; ++entry)
+    {
+        const uint lightRow = (uint)clusterLightIndices.Load(int3(entry % 1024, entry / 1024, 0));
+        color += EvaluateLight(lightRow, input.FragPos, normal, viewDir, albedo, input.ViewDepth, surface);
+    }
+
+    return color;
+}
 
 float4 PSMain(VSOutput input) : SV_Target0
 {
-    float3 finalColor = material.diffuse;
+#if USE_INDIRECT_DRAW
+    Material surface;
+    surface.ambient   = input.Ambient;
+    surface.diffuse   = input.Diffuse;
+    surface.specular  = input.Specular.rgb;
+    surface.shininess = input.Specular.a;
+#else
+    Material surface = material;
+#endif
+    const float3 diffuseColor = surface.diffuse;
+    float3       finalColor   = diffuseColor;
+    float3       normal       = normalize(input.Normal);
 
 #if USE_DIFFUSE_MAP
     if (hasDiffuseTexture != 0)
     {
         const float4 texColor = diffuseTexture.Sample(diffuseTextureSampler, input.TexCoords);
-        finalColor = texColor.rgb * material.diffuse;
+        finalColor = texColor.rgb * diffuseColor;
+    }
+#endif
+
+#if USE_NORMAL_MAP
+    if (hasNormalTexture != 0)
+    {
+        // Rows are the tangent frame, so the tangent-space sample maps to world space
+        const float3   tangentNormal = normalTexture.Sample(normalTextureSampler, input.TexCoords).xyz * 2.0 - 1.0;
+        const float3x3 tangentFrame  = float3x3(normalize(input.Tangent), normalize(input.Bitangent), normal);
+        normal = normalize(mul(tangentNormal, tangentFrame));
     }
 #endif
 
+#if USE_SPECULAR_MAP
+    if (hasSpecularTexture != 0)
+    {
+        surface.specular *= specularTexture.Sample(specularTextureSampler, input.TexCoords).rgb;
+    }
+#endif
+
+    if (lightingEnabled > 0.5)
+    {
+        finalColor = ShadeClustered(input, normal, finalColor, surface);
+    }
+
     return float4(finalColor, 1.0);
 }
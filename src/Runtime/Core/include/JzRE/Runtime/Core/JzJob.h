@@ -0,0 +1,142 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "JzRE/Runtime/Core/JzRETypes.h"
+
+namespace JzRE {
+
+/**
+ * @brief Move-only type-erased `void()` callable with inline storage.
+ *
+ * Callables up to InlineCapacity bytes that are nothrow-movable are stored in
+ * place, so scheduling them does not allocate. Larger callables fall back to
+ * the heap.
+ */
+class JzJob {
+public:
+    /**
+     * @brief Bytes available for captures before falling back to the heap.
+     */
+    static constexpr Size InlineCapacity = 48;
+
+    /**
+     * @brief Check whether a callable type is stored without heap allocation.
+     */
+    template <typename F>
+    static constexpr Bool IsStoredInline()
+    {
+        return sizeof(F) <= InlineCapacity && alignof(F) <= alignof(std::max_align_t) &&
+               std::is_nothrow_move_constructible_v<F>;
+    }
+
+    JzJob() = default;
+
+    template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, JzJob>>>
+    JzJob(F &&func)
+    {
+        using TFunc = std::decay_t<F>;
+        static_assert(std::is_invocable_v<TFunc &>, "JzJob requires a callable taking no arguments");
+
+        if constexpr (IsStoredInline<TFunc>()) {
+            ::new (static_cast<void *>(m_storage)) TFunc(std::forward<F>(func));
+            m_ops = &s_inlineOps<TFunc>;
+        } else {
+            ::new (static_cast<void *>(m_storage)) TFunc *(new TFunc(std::forward<F>(func)));
+            m_ops = &s_heapOps<TFunc>;
+        }
+    }
+
+    JzJob(JzJob &&other) noexcept
+    {
+        MoveFrom(other);
+    }
+
+    JzJob &operator=(JzJob &&other) noexcept
+    {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    JzJob(const JzJob &)            = delete;
+    JzJob &operator=(const JzJob &) = delete;
+
+    ~JzJob()
+    {
+        Reset();
+    }
+
+    /**
+     * @brief Invoke the callable. The job stays valid and may be invoked again.
+     */
+    void operator()()
+    {
+        m_ops->invoke(m_storage);
+    }
+
+    explicit operator bool() const
+    {
+        return m_ops != nullptr;
+    }
+
+    /**
+     * @brief Destroy the stored callable.
+     */
+    void Reset()
+    {
+        if (m_ops) {
+            m_ops->destroy(m_storage);
+            m_ops = nullptr;
+        }
+    }
+
+private:
+    struct JzOps {
+        void (*invoke)(void *storage);
+        void (*move)(void *dst, void *src); ///< Move-constructs dst and destroys src
+        void (*destroy)(void *storage);
+    };
+
+    template <typename F>
+    static constexpr JzOps s_inlineOps = {
+        [](void *storage) { (*std::launder(static_cast<F *>(storage)))(); },
+        [](void *dst, void *src) {
+            auto *source = std::launder(static_cast<F *>(src));
+            ::new (dst) F(std::move(*source));
+            source->~F();
+        },
+        [](void *storage) { std::launder(static_cast<F *>(storage))->~F(); },
+    };
+
+    template <typename F>
+    static constexpr JzOps s_heapOps = {
+        [](void *storage) { (**std::launder(static_cast<F **>(storage)))(); },
+        [](void *dst, void *src) { ::new (dst) F *(*std::launder(static_cast<F **>(src))); },
+        [](void *storage) { delete *std::launder(static_cast<F **>(storage)); },
+    };
+
+    void MoveFrom(JzJob &other) noexcept
+    {
+        if (other.m_ops) {
+            other.m_ops->move(m_storage, other.m_storage);
+            m_ops       = other.m_ops;
+            other.m_ops = nullptr;
+        }
+    }
+
+private:
+    alignas(std::max_align_t) unsigned char m_storage[InlineCapacity];
+    const JzOps *m_ops = nullptr;
+};
+
+} // namespace JzRE
@@ -22,12 +22,15 @@ template <typename Mutex>
 class JzLogSink : public spdlog::sinks::base_sink<Mutex> {
 public:
     /**
-     * @brief Constructor
+     * @brief Replace the callback. Waits for a running callback to return.
      *
      * @param callback
      */
-    explicit JzLogSink(std::function<void(const JzLogMessage &)> &callback) :
-        m_callback(callback) { }
+    void SetCallback(std::function<void(const JzLogMessage &)> callback)
+    {
+        std::lock_guard<Mutex> lock(spdlog::sinks::base_sink<Mutex>::mutex_);
+        m_callback = std::move(callback);
+    }
 
 protected:
     void sink_it_(const spdlog::details::log_msg &msg) override
@@ -72,7 +75,7 @@ protected:
     }
 
 private:
-    std::function<void(const JzLogMessage &)> &m_callback;
+    std::function<void(const JzLogMessage &)> m_callback;
 };
 
 } // namespace JzRE
\ No newline at end of file
@@ -5,30 +5,102 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <format>
 #include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 #include <spdlog/logger.h>
 #include "JzRE/Runtime/Core/JzRETypes.h"
 #include "JzELog.h"
+#include "JzLogSink.h"
 
 namespace JzRE {
 
+/**
+ * @brief Numeric log levels for JzRE_LOG_ACTIVE_LEVEL, matching JzELogLevel
+ */
+#define JzRE_LOG_LEVEL_TRACE 0
+#define JzRE_LOG_LEVEL_DEBUG 1
+#define JzRE_LOG_LEVEL_INFO 2
+#define JzRE_LOG_LEVEL_WARN 3
+#define JzRE_LOG_LEVEL_ERROR 4
+#define JzRE_LOG_LEVEL_CRITICAL 5
+#define JzRE_LOG_LEVEL_OFF 6
+
+/**
+ * @brief Lowest level compiled into the binary. Log calls below it are removed
+ * without evaluating their arguments. Release builds strip trace and debug logs.
+ */
+#ifndef JzRE_LOG_ACTIVE_LEVEL
+#ifdef NDEBUG
+#define JzRE_LOG_ACTIVE_LEVEL JzRE_LOG_LEVEL_INFO
+#else
+#define JzRE_LOG_ACTIVE_LEVEL JzRE_LOG_LEVEL_TRACE
+#endif
+#endif
+
 /**
  * @brief JzRE Log Macro
+ *
+ * The level is checked before any argument is evaluated; formatting happens on
+ * the logger thread.
  */
-#define JzRE_LOG_INFO(...) \
-    JzLogger::GetInstance().Info(std::format(__VA_ARGS__))
-#define JzRE_LOG_WARN(...) \
-    JzLogger::GetInstance().Warn(std::format(__VA_ARGS__))
-#define JzRE_LOG_ERROR(...) \
-    JzLogger::GetInstance().Error(std::format(__VA_ARGS__))
-#define JzRE_LOG_DEBUG(...) \
-    JzLogger::GetInstance().Debug(std::format(__VA_ARGS__))
+#define JzRE_LOG_AT(level, ...)                                                 \
+    do {                                                                        \
+        if constexpr (static_cast<int>(level) >= JzRE_LOG_ACTIVE_LEVEL) {       \
+            if (::JzRE::JzLogger::ShouldLog(level)) {                           \
+                ::JzRE::JzLogger::GetInstance().Write(level, __VA_ARGS__);      \
+            }                                                                   \
+        }                                                                       \
+    } while (0)
+
+#define JzRE_LOG_TRACE(...) JzRE_LOG_AT(::JzRE::JzELogLevel::Trace, __VA_ARGS__)
+#define JzRE_LOG_DEBUG(...) JzRE_LOG_AT(::JzRE::JzELogLevel::Debug, __VA_ARGS__)
+#define JzRE_LOG_INFO(...) JzRE_LOG_AT(::JzRE::JzELogLevel::Info, __VA_ARGS__)
+#define JzRE_LOG_WARN(...) JzRE_LOG_AT(::JzRE::JzELogLevel::Warning, __VA_ARGS__)
+#define JzRE_LOG_ERROR(...) JzRE_LOG_AT(::JzRE::JzELogLevel::Error, __VA_ARGS__)
+#define JzRE_LOG_CRITICAL(...) JzRE_LOG_AT(::JzRE::JzELogLevel::Critical, __VA_ARGS__)
 
 /**
  * @brief JzRE Singleton logger
+ *
+ * Every thread writes records into its own single-producer ring buffer. A
+ * record holds the format string pointer and the arguments serialized as raw
+ * bytes; strings are copied, other arguments are only deferred when they are
+ * arithmetic, enum or pointer values. Records with other argument types are
+ * formatted on the calling thread. A background thread merges the rings in
+ * timestamp order, formats the records and writes them to the spdlog sinks.
+ *
+ * When a ring is full the writer waits for the logger thread, so records are
+ * never dropped; only messages longer than MaxArgumentBytes are cut, with a
+ * visible marker. Critical records are flushed before the call returns. The
+ * logger thread sleeps until a record is pushed, and a thread's ring is
+ * released once the thread has exited and its records are written.
  */
 class JzLogger {
 public:
+    /**
+     * @brief Bytes buffered per thread.
+     */
+    static constexpr Size RingCapacity = 128 * 1024;
+
+    /**
+     * @brief Largest serialized argument block.
+     *
+     * Longer messages are cut to fit and end with "[truncated N bytes]".
+     */
+    static constexpr Size MaxArgumentBytes = 16 * 1024;
+
     /**
      * @brief Get the singleton instance
      *
@@ -36,6 +108,69 @@ public:
      */
     static JzLogger &GetInstance();
 
+    /**
+     * @brief Check a level against the runtime level without touching the instance
+     *
+     * @param level
+     */
+    static Bool ShouldLog(JzELogLevel level)
+    {
+        return static_cast<I32>(level) >= s_level.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Set the lowest level that is logged at runtime
+     *
+     * Levels stripped by JzRE_LOG_ACTIVE_LEVEL cannot be re-enabled.
+     *
+     * @param level
+     */
+    void SetLevel(JzELogLevel level);
+
+    /**
+     * @brief Get the lowest level that is logged at runtime
+     */
+    JzELogLevel GetLevel() const;
+
+    /**
+     * @brief Enable or disable the console sink, e.g. for tools writing to stdout
+     *
+     * @param enabled
+     */
+    void SetConsoleOutput(Bool enabled);
+
+    /**
+     * @brief Queue a record. Use the JzRE_LOG_* macros instead of calling this directly.
+     *
+     * @param level
+     * @param format
+     * @param args
+     */
+    template <typename... Args>
+    void Write(JzELogLevel level, std::format_string<Args...> format, Args &&...args)
+    {
+        if constexpr ((IsDeferredArgument<Args>() && ...)) {
+            const Size argumentBytes = (Size{0} + ... + ArgumentSize(args));
+            if (argumentBytes <= MaxArgumentBytes) {
+                std::byte *cursor = BeginRecord(level, format.get(), &FormatRecord<Args...>, argumentBytes);
+                (WriteArgument(cursor, args), ...);
+                EndRecord();
+                return;
+            }
+        }
+        WriteMessage(level, std::format(format, std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Block until every record queued before this call has been written to the sinks
+     */
+    void Flush();
+
+    /**
+     * @brief Get the number of per-thread rings currently allocated
+     */
+    Size GetRingCount();
+
     /**
      * @brief Log a message
      *
@@ -89,24 +224,128 @@ public:
     /**
      * @brief Set the log message callback
      *
+     * The callback runs on the logger thread and must not log itself.
+     *
      * @param callback
      */
     void SetLogMessageCallback(std::function<void(const JzLogMessage &)> callback);
 
     /**
      * @brief Clear the log message callback
+     *
+     * Once this returns the previous callback is no longer running.
      */
     void ClearLogMessageCallback();
 
 private:
+    struct JzLogRing;
+
+    using JzLogFormatFunc = void (*)(std::string_view format, const std::byte *arguments, String &output);
+
     JzLogger();
-    ~JzLogger()                           = default;
+    ~JzLogger();
     JzLogger(const JzLogger &)            = delete;
     JzLogger &operator=(const JzLogger &) = delete;
 
+    template <typename T>
+    static constexpr Bool IsStringArgument()
+    {
+        using TDecayed = std::decay_t<T>;
+        return std::is_same_v<TDecayed, String> || std::is_same_v<TDecayed, std::string_view> || std::is_same_v<TDecayed, const char *> || std::is_same_v<TDecayed, char *>;
+    }
+
+    template <typename T>
+    static constexpr Bool IsDeferredArgument()
+    {
+        // Other trivially copyable types may point at memory the caller frees before formatting
+        using TDecayed = std::decay_t<T>;
+        return IsStringArgument<T>() || std::is_arithmetic_v<TDecayed> || std::is_enum_v<TDecayed> || std::is_same_v<TDecayed, const void *> || std::is_same_v<TDecayed, void *> || std::is_same_v<TDecayed, std::nullptr_t>;
+    }
+
+    template <typename T>
+    using JzStoredArgument = std::conditional_t<IsStringArgument<T>(), std::string_view, std::decay_t<T>>;
+
+    template <typename T>
+    static Size ArgumentSize(const T &argument)
+    {
+        if constexpr (IsStringArgument<T>()) {
+            return sizeof(U32) + std::string_view(argument).size();
+        } else {
+            return sizeof(std::decay_t<T>);
+        }
+    }
+
+    template <typename T>
+    static void WriteArgument(std::byte *&cursor, const T &argument)
+    {
+        if constexpr (IsStringArgument<T>()) {
+            const std::string_view text(argument);
+            const U32              length = static_cast<U32>(text.size());
+            std::memcpy(cursor, &length, sizeof(length));
+            std::memcpy(cursor + sizeof(length), text.data(), length);
+            cursor += sizeof(length) + length;
+        } else {
+            const std::decay_t<T> value = argument;
+            std::memcpy(cursor, &value, sizeof(value));
+            cursor += sizeof(value);
+        }
+    }
+
+    template <typename T>
+    static JzStoredArgument<T> ReadArgument(const std::byte *&cursor)
+    {
+        if constexpr (IsStringArgument<T>()) {
+            U32 length = 0;
+            std::memcpy(&length, cursor, sizeof(length));
+            const std::string_view text(reinterpret_cast<const char *>(cursor + sizeof(length)), length);
+            cursor += sizeof(length) + length;
+            return text;
+        } else {
+            std::decay_t<T> value;
+            std::memcpy(&value, cursor, sizeof(value));
+            cursor += sizeof(value);
+            return value;
+        }
+    }
+
+    template <typename... Args>
+    static void FormatRecord(std::string_view format, const std::byte *arguments, String &output)
+    {
+        // Braced initialization reads the arguments left to right
+        std::tuple<JzStoredArgument<Args>...> values{ReadArgument<Args>(arguments)...};
+        std::apply([&](auto &...value) {
+            std::vformat_to(std::back_inserter(output), format, std::make_format_args(value...));
+        },
+                   values);
+    }
+
+    std::byte *BeginRecord(JzELogLevel level, std::string_view format, JzLogFormatFunc formatFunc, Size argumentBytes);
+    void       EndRecord();
+    void       WriteMessage(JzELogLevel level, std::string_view message);
+    JzLogRing &GetThreadRing();
+    void       WakeWorker();
+    void       WorkerThread();
+    Bool       DrainRings();
+    Bool       HasPendingRecords();
+    void       ReleaseRetiredRings(const std::vector<JzLogRing *> &rings);
+
 private:
-    std::shared_ptr<spdlog::logger>              m_logger;
-    std::function<void(const JzLogMessage &)>    m_logCallback;
+    static inline std::atomic<I32> s_level{static_cast<I32>(JzELogLevel::Info)};
+
+    std::shared_ptr<spdlog::logger>            m_logger;
+    std::shared_ptr<spdlog::sinks::sink>       m_consoleSink;
+    std::shared_ptr<JzLogSink<std::mutex>>     m_eventSink;
+    std::mutex                                 m_ringMutex; ///< Guards ring registration
+    std::vector<std::unique_ptr<JzLogRing>>    m_rings;
+    std::thread                                m_thread;
+    std::mutex                                 m_wakeMutex; ///< Guards the flush counters and m_stop
+    std::condition_variable                    m_wakeCondition;
+    std::condition_variable                    m_flushCondition;
+    std::atomic<Bool>                          m_wakeRequested{false};
+    std::atomic<Bool>                          m_workerIdle{false}; ///< Set while the logger thread waits for records
+    U64                                        m_flushRequested = 0;
+    U64                                        m_flushCompleted = 0;
+    Bool                                       m_stop           = false;
 };
 
-} // namespace JzRE
\ No newline at end of file
+} // namespace JzRE
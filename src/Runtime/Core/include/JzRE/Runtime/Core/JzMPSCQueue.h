@@ -0,0 +1,132 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "JzRE/Runtime/Core/JzRETypes.h"
+
+namespace JzRE {
+
+/**
+ * @brief Bounded lock-free multi-producer single-consumer queue.
+ *
+ * Based on Dmitry Vyukov's bounded queue: every cell carries a sequence number
+ * telling producers and the consumer whether it is free or filled, so pushing
+ * is one CAS on the enqueue position and popping needs no atomic RMW at all.
+ * Storage is allocated once in the constructor; TryPush and TryPop never
+ * allocate. TryPush fails instead of blocking when the queue is full.
+ *
+ * @tparam T Move-constructible element type.
+ */
+template <typename T>
+class JzMPSCQueue {
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param capacity Number of cells, rounded up to a power of two.
+     */
+    explicit JzMPSCQueue(Size capacity) :
+        m_capacity(std::bit_ceil(capacity < 2 ? Size{2} : capacity)),
+        m_cells(std::make_unique<JzCell[]>(m_capacity))
+    {
+        for (Size index = 0; index < m_capacity; ++index) {
+            m_cells[index].sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+
+    ~JzMPSCQueue()
+    {
+        // Destroy elements that were pushed but never popped
+        while (true) {
+            JzCell &cell = m_cells[m_dequeuePosition & (m_capacity - 1)];
+            if (cell.sequence.load(std::memory_order_acquire) != m_dequeuePosition + 1) {
+                break;
+            }
+            std::launder(reinterpret_cast<T *>(cell.storage))->~T();
+            ++m_dequeuePosition;
+        }
+    }
+
+    JzMPSCQueue(const JzMPSCQueue &)            = delete;
+    JzMPSCQueue &operator=(const JzMPSCQueue &) = delete;
+
+    /**
+     * @brief Push an element. Safe to call from any thread.
+     *
+     * @return Bool False if the queue is full.
+     */
+    template <typename U>
+    Bool TryPush(U &&value)
+    {
+        Size position = m_enqueuePosition.load(std::memory_order_relaxed);
+        while (true) {
+            JzCell    &cell     = m_cells[position & (m_capacity - 1)];
+            const Size sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff     = static_cast<std::make_signed_t<Size>>(sequence - position);
+            if (diff == 0) {
+                if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    ::new (static_cast<void *>(cell.storage)) T(std::forward<U>(value));
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                position = m_enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Pop the oldest element. Must only be called by the consumer thread.
+     *
+     * @return Bool False if the queue is empty.
+     */
+    Bool TryPop(T &value)
+    {
+        JzCell    &cell     = m_cells[m_dequeuePosition & (m_capacity - 1)];
+        const Size sequence = cell.sequence.load(std::memory_order_acquire);
+        if (sequence != m_dequeuePosition + 1) {
+            return false;
+        }
+
+        T *stored = std::launder(reinterpret_cast<T *>(cell.storage));
+        value     = std::move(*stored);
+        stored->~T();
+
+        cell.sequence.store(m_dequeuePosition + m_capacity, std::memory_order_release);
+        ++m_dequeuePosition;
+        return true;
+    }
+
+    /**
+     * @brief Get the number of cells.
+     */
+    Size GetCapacity() const
+    {
+        return m_capacity;
+    }
+
+private:
+    struct JzCell {
+        std::atomic<Size>        sequence{0};
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    Size                      m_capacity;
+    std::unique_ptr<JzCell[]> m_cells;
+
+    alignas(64) std::atomic<Size> m_enqueuePosition{0};
+    alignas(64) Size m_dequeuePosition = 0; ///< Consumer owned
+};
+
+} // namespace JzRE
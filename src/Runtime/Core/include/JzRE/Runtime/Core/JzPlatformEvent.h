@@ -25,6 +25,16 @@ struct JzPlatformEvent {
     U32 windowId{0}; // Window identifier for multi-window support
 };
 
+/**
+ * @brief Counter shared by all platform event types
+ *
+ * Lives outside the JzPlatformEventType template so every instantiation
+ * draws from the same sequence. Id 0 is left for empty wrappers.
+ */
+struct JzPlatformEventTypeCounter {
+    static inline std::atomic<U32> s_counter{1};
+};
+
 /**
  * @brief Compile-time type ID for platform events
  */
@@ -34,12 +44,9 @@ struct JzPlatformEventType {
     {
         static_assert(std::is_base_of_v<JzPlatformEvent, T>,
                       "T must inherit from JzPlatformEvent");
-        static U32 id = s_counter++;
+        static U32 id = JzPlatformEventTypeCounter::s_counter++;
         return id;
     }
-
-private:
-    static inline std::atomic<U32> s_counter{0};
 };
 
 /**
@@ -16,7 +16,7 @@ namespace JzRE {
 /**
  * @brief Thread-safe event queue for Platform layer events.
  *
- * Similar to JzEventQueue but without Function layer dependencies.
+ * Platform-layer counterpart of the Function layer event channels.
  * Used by JzIWindowBackend to queue platform events for consumption
  * by JzWindowSystem.
  */
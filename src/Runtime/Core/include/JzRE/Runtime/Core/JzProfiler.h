@@ -0,0 +1,172 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+#include "JzRE/Runtime/Core/JzRETypes.h"
+
+namespace JzRE {
+
+#define JzRE_PROFILE_CONCAT_INNER(a, b) a##b
+#define JzRE_PROFILE_CONCAT(a, b) JzRE_PROFILE_CONCAT_INNER(a, b)
+
+/**
+ * @brief Profile the enclosing scope as a CPU zone. The name must outlive the scope.
+ */
+#define JzRE_PROFILE_SCOPE(name) \
+    ::JzRE::JzProfileScope JzRE_PROFILE_CONCAT(__jzProfileScope, __LINE__)(name)
+
+/**
+ * @brief One recorded zone. Names are copied inline so recording never allocates.
+ */
+struct JzProfileEvent {
+    static constexpr Size MaxNameLength = 47;
+
+    char name[MaxNameLength + 1] = {};
+    U64  beginNs                 = 0;
+    U64  endNs                   = 0;
+};
+
+/**
+ * @brief Frame profiler collecting CPU and GPU zones into a Chrome trace.
+ *
+ * Every thread records into its own single-producer ring buffer, so recording
+ * is lock-free; the rings are drained by Collect() on the main thread. When a
+ * ring is full, new events are dropped and counted instead of blocking.
+ *
+ * GPU zones are submitted by the RHI device after readback and must already be
+ * converted to the NowNs() clock.
+ */
+class JzProfiler {
+public:
+    /**
+     * @brief Events buffered per thread between two Collect() calls.
+     */
+    static constexpr Size RingCapacity = 8192;
+
+    /**
+     * @brief Get the profiler instance.
+     */
+    static JzProfiler &GetInstance();
+
+    /**
+     * @brief Current time of the profiler clock in nanoseconds.
+     */
+    static U64 NowNs();
+
+    /**
+     * @brief Enable or disable recording. Zones opened while disabled are not recorded.
+     */
+    void SetEnabled(Bool enabled);
+
+    /**
+     * @brief Check whether zones are being recorded.
+     */
+    Bool IsEnabled() const
+    {
+        return m_enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Name the calling thread in exported traces.
+     */
+    void SetThreadName(const String &name);
+
+    /**
+     * @brief Record a CPU zone on the calling thread.
+     */
+    void RecordCpuZone(std::string_view name, U64 beginNs, U64 endNs);
+
+    /**
+     * @brief Record a resolved GPU zone. Must be called from a single thread.
+     *
+     * GPU zones arrive frames after they were recorded, so they are accepted
+     * even while disabled to let a capture drain.
+     */
+    void RecordGpuZone(std::string_view name, U64 beginNs, U64 endNs);
+
+    /**
+     * @brief Move buffered events of all threads into the capture.
+     */
+    void Collect();
+
+    /**
+     * @brief Write the capture in Chrome trace JSON format (chrome://tracing, Perfetto).
+     *
+     * @param path Output file.
+     *
+     * @return Bool True if the file was written.
+     */
+    Bool ExportChromeTrace(const std::filesystem::path &path);
+
+    /**
+     * @brief Discard captured events.
+     */
+    void ClearCapture();
+
+    /**
+     * @brief Get the number of captured events.
+     */
+    Size GetCapturedEventCount();
+
+    /**
+     * @brief Get the number of events dropped because a ring was full.
+     */
+    U64 GetDroppedEventCount();
+
+private:
+    struct JzThreadRing;
+
+    struct JzCapturedEvent {
+        JzProfileEvent event;
+        U32            trackId = 0;
+    };
+
+    JzProfiler();
+    ~JzProfiler();
+    JzProfiler(const JzProfiler &)            = delete;
+    JzProfiler &operator=(const JzProfiler &) = delete;
+
+    JzThreadRing &GetThreadRing();
+
+private:
+    std::atomic<Bool>                          m_enabled{false};
+    std::mutex                                 m_mutex; ///< Guards ring registration and the capture
+    std::vector<std::unique_ptr<JzThreadRing>> m_rings;
+    std::unique_ptr<JzThreadRing>              m_gpuRing;
+    std::vector<JzCapturedEvent>               m_captured;
+};
+
+/**
+ * @brief RAII CPU zone, see JzRE_PROFILE_SCOPE.
+ */
+class JzProfileScope {
+public:
+    explicit JzProfileScope(std::string_view name) :
+        m_name(name),
+        m_beginNs(JzProfiler::GetInstance().IsEnabled() ? JzProfiler::NowNs() : 0) { }
+
+    ~JzProfileScope()
+    {
+        if (m_beginNs != 0) {
+            JzProfiler::GetInstance().RecordCpuZone(m_name, m_beginNs, JzProfiler::NowNs());
+        }
+    }
+
+    JzProfileScope(const JzProfileScope &)            = delete;
+    JzProfileScope &operator=(const JzProfileScope &) = delete;
+
+private:
+    std::string_view m_name;
+    U64              m_beginNs;
+};
+
+} // namespace JzRE
@@ -0,0 +1,284 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+#include "JzRE/Runtime/Core/JzRETypes.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define JzRE_SIMD_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define JzRE_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace JzRE {
+
+/**
+ * @brief Four packed floats mapped to SSE2, NEON or a scalar fallback.
+ *
+ * Comparisons return lane masks (all bits set or clear) that feed And/Or,
+ * Select and MoveMask, so branch-free kernels read the same on every target.
+ */
+struct JzF32x4 {
+#if defined(JzRE_SIMD_SSE2)
+    __m128 value;
+#elif defined(JzRE_SIMD_NEON)
+    float32x4_t value;
+#else
+    F32 value[4];
+#endif
+
+    /**
+     * @brief Load four floats, no alignment required.
+     */
+    static JzF32x4 Load(const F32 *data)
+    {
+#if defined(JzRE_SIMD_SSE2)
+        return {_mm_loadu_ps(data)};
+#elif defined(JzRE_SIMD_NEON)
+        return {vld1q_f32(data)};
+#else
+        return {{data[0], data[1], data[2], data[3]}};
+#endif
+    }
+
+    /**
+     * @brief Broadcast one value to every lane.
+     */
+    static JzF32x4 Splat(F32 scalar)
+    {
+#if defined(JzRE_SIMD_SSE2)
+        return {_mm_set1_ps(scalar)};
+#elif defined(JzRE_SIMD_NEON)
+        return {vdupq_n_f32(scalar)};
+#else
+        return {{scalar, scalar, scalar, scalar}};
+#endif
+    }
+
+    /**
+     * @brief Build from four lanes, lane 0 first.
+     */
+    static JzF32x4 Set(F32 x, F32 y, F32 z, F32 w)
+    {
+#if defined(JzRE_SIMD_SSE2)
+        return {_mm_setr_ps(x, y, z, w)};
+#elif defined(JzRE_SIMD_NEON)
+        const F32 lanes[4] = {x, y, z, w};
+        return {vld1q_f32(lanes)};
+#else
+        return {{x, y, z, w}};
+#endif
+    }
+
+    /**
+     * @brief Store four floats, no alignment required.
+     */
+    void Store(F32 *data) const
+    {
+#if defined(JzRE_SIMD_SSE2)
+        _mm_storeu_ps(data, value);
+#elif defined(JzRE_SIMD_NEON)
+        vst1q_f32(data, value);
+#else
+        std::copy_n(value, 4, data);
+#endif
+    }
+
+    /**
+     * @brief One bit per lane, set where the lane mask is set.
+     */
+    U32 MoveMask() const
+    {
+#if defined(JzRE_SIMD_SSE2)
+        return static_cast<U32>(_mm_movemask_ps(value));
+#elif defined(JzRE_SIMD_NEON)
+        const uint32x4_t bits    = vshrq_n_u32(vreinterpretq_u32_f32(value), 31);
+        const uint32x4_t weights = {1, 2, 4, 8};
+        return vaddvq_u32(vmulq_u32(bits, weights));
+#else
+        U32 mask = 0;
+        for (U32 lane = 0; lane < 4; ++lane) {
+            mask |= (Bits(value[lane]) >> 31) << lane;
+        }
+        return mask;
+#endif
+    }
+
+#if !defined(JzRE_SIMD_SSE2) && !defined(JzRE_SIMD_NEON)
+    static U32 Bits(F32 lane)
+    {
+        U32 bits;
+        std::copy_n(reinterpret_cast<const U8 *>(&lane), sizeof(bits), reinterpret_cast<U8 *>(&bits));
+        return bits;
+    }
+
+    static F32 FromBits(U32 bits)
+    {
+        F32 lane;
+        std::copy_n(reinterpret_cast<const U8 *>(&bits), sizeof(lane), reinterpret_cast<U8 *>(&lane));
+        return lane;
+    }
+
+    template <typename TOp>
+    static JzF32x4 Map(const JzF32x4 &lhs, const JzF32x4 &rhs, TOp op)
+    {
+        return {{op(lhs.value[0], rhs.value[0]), op(lhs.value[1], rhs.value[1]),
+                 op(lhs.value[2], rhs.value[2]), op(lhs.value[3], rhs.value[3])}};
+    }
+
+    static F32 Mask(Bool condition)
+    {
+        return FromBits(condition ? 0xFFFFFFFFu : 0u);
+    }
+#endif
+};
+
+inline JzF32x4 operator+(const JzF32x4 &lhs, const JzF32x4 &rhs)
+{
+#if defined(JzRE_SIMD_SSE2)
+    return {_mm_add_ps(lhs.value, rhs.value)};
+#elif defined(JzRE_SIMD_NEON)
+    return {vaddq_f32(lhs.value, rhs.value)};
+#else
+    return JzF32x4::Map(lhs, rhs, [](F32 a, F32 b) { return a + b; });
+#endif
+}
+
+inline JzF32x4 operator-(const JzF32x4 &lhs, const JzF32x4 &rhs)
+{
+#if defined(JzRE_SIMD_SSE2)
+    return {_mm_sub_ps(lhs.value, rhs.value)};
+#elif defined(JzRE_SIMD_NEON)
+    return {vsubq_f32(lhs.value, rhs.value)};
+#else
+    return JzF32x4::Map(lhs, rhs, [](F32 a, F32 b) { return a - b; });
+#endif
+}
+
+inline JzF32x4 operator*(const JzF32x4 &lhs, const JzF32x4 &rhs)
+{
+#if defined(JzRE_SIMD_SSE2)
+    return {_mm_mul_ps(lhs.value, rhs.value)};
+#elif defined(JzRE_SIMD_NEON)
+    return {vmulq_f32(lhs.value, rhs.value)};
+#else
+    return JzF32x4::Map(lhs, rhs, [](F32 a, F32 b) { return a * b; });
+#endif
+}
+
+inline JzF32x4 Min(const JzF32x4 &lhs, const JzF32x4 &rhs)
+{
+#if defined(JzRE_SIMD_SSE2)
+    return {_mm_min_ps(lhs.value, rhs.value)};
+#elif defined(JzRE_SIMD_NEON)
+    return {vminq_f32(lhs.value, rhs.value)};
+#else
+    return JzF32x4::Map(lhs, rhs, [](F32 a, F32 b) { return std::min(a, b); });
+#endif
+}
+
+inline JzF32x4 Max(const JzF32x4 &lhs, const JzF32x4 &rhs)
+{
+#if defined(JzRE_SIMD_SSE2)
+    return {_mm_max_ps(lhs.value, rhs.value)};
+#elif defined(JzRE_SIMD_NEON)
+    return {vmaxq_f32(lhs.value, rhs.value)};
+#else
+    return JzF32x4::Map(lhs, rhs, [](F32 a, F32 b) { return std::max(a, b); });
+#endif
+}
+
+inline JzF32x4 Sqrt(const JzF32x4 &operand)
+{
+#if defined(JzRE_SIMD_SSE2)
+    return {_mm_sqrt_ps(operand.value)};
+#elif defined(JzRE_SIMD_NEON)
+    return {vsqrtq_f32(operand.value)};
+#else
+    return JzF32x4::Map(operand, operand, [](F32 a, F32) { return std::sqrt(a); });
+#endif
+}
+
+/**
+ * @brief Lane mask of lhs < rhs.
+ */
+inline JzF32x4 Less(const JzF32x4 &lhs, const JzF32x4 &rhs)
+{
+#if defined(JzRE_SIMD_SSE2)
+    return {_mm_cmplt_ps(lhs.value, rhs.value)};
+#elif defined(JzRE_SIMD_NEON)
+    return {vreinterpretq_f32_u32(vcltq_f32(lhs.value, rhs.value))};
+#else
+    return JzF32x4::Map(lhs, rhs, [](F32 a, F32 b) { return JzF32x4::Mask(a < b); });
+#endif
+}
+
+/**
+ * @brief Lane mask of lhs <= rhs.
+ */
+inline JzF32x4 LessEqual(const JzF32x4 &lhs, const JzF32x4 &rhs)
+{
+#if defined(JzRE_SIMD_SSE2)
+    return {_mm_cmple_ps(lhs.value, rhs.value)};
+#elif defined(JzRE_SIMD_NEON)
+    return {vreinterpretq_f32_u32(vcleq_f32(lhs.value, rhs.value))};
+#else
+    return JzF32x4::Map(lhs, rhs, [](F32 a, F32 b) { return JzF32x4::Mask(a <= b); });
+#endif
+}
+
+/**
+ * @brief Bitwise AND of two lane masks.
+ */
+inline JzF32x4 And(const JzF32x4 &lhs, const JzF32x4 &rhs)
+{
+#if defined(JzRE_SIMD_SSE2)
+    return {_mm_and_ps(lhs.value, rhs.value)};
+#elif defined(JzRE_SIMD_NEON)
+    return {vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(lhs.value), vreinterpretq_u32_f32(rhs.value)))};
+#else
+    return JzF32x4::Map(lhs, rhs, [](F32 a, F32 b) { return JzF32x4::FromBits(JzF32x4::Bits(a) & JzF32x4::Bits(b)); });
+#endif
+}
+
+/**
+ * @brief Bitwise OR of two lane masks.
+ */
+inline JzF32x4 Or(const JzF32x4 &lhs, const JzF32x4 &rhs)
+{
+#if defined(JzRE_SIMD_SSE2)
+    return {_mm_or_ps(lhs.value, rhs.value)};
+#elif defined(JzRE_SIMD_NEON)
+    return {vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(lhs.value), vreinterpretq_u32_f32(rhs.value)))};
+#else
+    return JzF32x4::Map(lhs, rhs, [](F32 a, F32 b) { return JzF32x4::FromBits(JzF32x4::Bits(a) | JzF32x4::Bits(b)); });
+#endif
+}
+
+/**
+ * @brief Pick onTrue where the lane mask is set and onFalse elsewhere.
+ */
+inline JzF32x4 Select(const JzF32x4 &mask, const JzF32x4 &onTrue, const JzF32x4 &onFalse)
+{
+#if defined(JzRE_SIMD_SSE2)
+    return {_mm_or_ps(_mm_and_ps(mask.value, onTrue.value), _mm_andnot_ps(mask.value, onFalse.value))};
+#elif defined(JzRE_SIMD_NEON)
+    return {vbslq_f32(vreinterpretq_u32_f32(mask.value), onTrue.value, onFalse.value)};
+#else
+    JzF32x4 result;
+    for (U32 lane = 0; lane < 4; ++lane) {
+        result.value[lane] = (JzF32x4::Bits(mask.value[lane]) >> 31) ? onTrue.value[lane] : onFalse.value[lane];
+    }
+    return result;
+#endif
+}
+
+} // namespace JzRE
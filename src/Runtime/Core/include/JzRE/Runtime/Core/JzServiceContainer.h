@@ -5,22 +5,47 @@
 
 #pragma once
 
-#include <any>
-#include <unordered_map>
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
 #include "JzRE/Runtime/Core/JzRETypes.h"
 
 namespace JzRE {
+
+/**
+ * @brief Slot of service type T in JzServiceContainer, assigned when T is first provided.
+ *
+ * Slot 0 is never assigned and always empty, so looking up a type that was
+ * never provided needs no extra check.
+ */
+template <typename T>
+inline Size JzServiceSlot = 0;
+
 /**
  * @brief Service Container
+ *
+ * Services are stored as pointers in a flat array indexed by JzServiceSlot,
+ * so Get is one indexed load. Slots are assigned by Provide, which is meant
+ * to run during startup on one thread. The container does not own services:
+ * callers keep them alive until they are removed or the container is cleared
+ * with Init().
  */
 class JzServiceContainer {
 public:
+    /**
+     * @brief Maximum number of distinct service types.
+     */
+    static constexpr Size MaxServices = 128;
+
+    using JzSlotArray = std::array<void *, MaxServices>;
+
     /**
      * @brief Init, clear all services
      */
     static void Init()
     {
-        __SERVICES.clear();
+        s_slots->fill(nullptr);
     }
 
     /**
@@ -32,7 +57,10 @@ public:
     template <typename T>
     static void Provide(T &service)
     {
-        __SERVICES[typeid(T).hash_code()] = std::any(&service);
+        if (JzServiceSlot<T> == 0) {
+            JzServiceSlot<T> = NextSlotIndex();
+        }
+        (*s_slots)[JzServiceSlot<T>] = &service;
     }
 
     /**
@@ -40,11 +68,17 @@ public:
      *
      * @tparam T The type of the service
      * @return The service
+     *
+     * @throw std::runtime_error If the service has not been provided.
      */
     template <typename T>
     static T &Get()
     {
-        return *std::any_cast<T *>(__SERVICES[typeid(T).hash_code()]);
+        void *service = (*s_slots)[JzServiceSlot<T>];
+        if (service == nullptr) [[unlikely]] {
+            ThrowNotProvided(typeid(T).name());
+        }
+        return *static_cast<T *>(service);
     }
 
     /**
@@ -56,7 +90,7 @@ public:
     template <typename T>
     static Bool Has()
     {
-        return __SERVICES.find(typeid(T).hash_code()) != __SERVICES.end();
+        return (*s_slots)[JzServiceSlot<T>] != nullptr;
     }
 
     /**
@@ -67,10 +101,47 @@ public:
     template <typename T>
     static void Remove()
     {
-        __SERVICES.erase(typeid(T).hash_code());
+        (*s_slots)[JzServiceSlot<T>] = nullptr;
+    }
+
+private:
+    friend class JzServiceScope;
+
+    static Size NextSlotIndex();
+
+    [[noreturn]] static void ThrowNotProvided(const char *typeName);
+
+private:
+    static JzSlotArray  s_globalSlots;
+    static JzSlotArray *s_slots; ///< Active table, the global one unless a JzServiceScope is alive
+};
+
+/**
+ * @brief Replaces the services with an empty table for its lifetime.
+ *
+ * Meant for tests: services provided inside the scope disappear with it and
+ * the previous registrations come back. Scopes nest but must not overlap
+ * across threads.
+ */
+class JzServiceScope {
+public:
+    JzServiceScope() :
+        m_previous(JzServiceContainer::s_slots)
+    {
+        m_slots.fill(nullptr);
+        JzServiceContainer::s_slots = &m_slots;
+    }
+
+    ~JzServiceScope()
+    {
+        JzServiceContainer::s_slots = m_previous;
     }
 
+    JzServiceScope(const JzServiceScope &)            = delete;
+    JzServiceScope &operator=(const JzServiceScope &) = delete;
+
 private:
-    static std::unordered_map<I32, std::any> __SERVICES;
+    JzServiceContainer::JzSlotArray  m_slots;
+    JzServiceContainer::JzSlotArray *m_previous;
 };
 } // namespace JzRE
@@ -0,0 +1,98 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "JzRE/Runtime/Core/JzJob.h"
+#include "JzRE/Runtime/Core/JzRETypes.h"
+
+namespace JzRE {
+
+class JzThreadPool;
+
+/**
+ * @brief Identifier of a task inside a JzTaskGraph.
+ */
+using JzTaskId = U32;
+
+/**
+ * @brief Directed acyclic graph of tasks executed by JzThreadPool::Run.
+ *
+ * A task starts once all of its predecessors have finished. The graph is
+ * built once and can be run any number of times, e.g. once per frame.
+ */
+class JzTaskGraph {
+public:
+    static constexpr JzTaskId InvalidTask = std::numeric_limits<JzTaskId>::max();
+
+    /**
+     * @brief Add a task.
+     *
+     * @param func Callable taking no arguments. It is invoked once per run.
+     *
+     * @return JzTaskId Identifier used to declare dependencies.
+     */
+    template <typename F>
+    JzTaskId AddTask(F &&func)
+    {
+        auto &node = m_nodes.emplace_back();
+        node.work  = JzJob(std::forward<F>(func));
+        m_validity = JzEValidity::Unknown;
+        return static_cast<JzTaskId>(m_nodes.size() - 1);
+    }
+
+    /**
+     * @brief Declare that `after` must not start before `before` has finished.
+     */
+    void AddDependency(JzTaskId before, JzTaskId after);
+
+    /**
+     * @brief Check that the graph has no cycle.
+     *
+     * The result is kept until the graph changes, so running a built graph
+     * again does not check it again.
+     */
+    Bool Validate() const;
+
+    /**
+     * @brief Remove all tasks.
+     */
+    void Clear();
+
+    /**
+     * @brief Get the number of tasks.
+     */
+    Size GetTaskCount() const
+    {
+        return m_nodes.size();
+    }
+
+private:
+    friend class JzThreadPool;
+
+    struct JzTaskNode {
+        JzJob                 work;
+        std::vector<JzTaskId> successors;
+        U32                   dependencyCount = 0;
+        std::atomic<U32>      remainingDependencies{0};
+    };
+
+    enum class JzEValidity : U8 {
+        Unknown,
+        Acyclic,
+        Cyclic
+    };
+
+    std::deque<JzTaskNode> m_nodes; ///< Deque keeps nodes in place, atomics cannot move
+    std::atomic<Size>      m_remainingTasks{0};
+    mutable JzEValidity    m_validity = JzEValidity::Acyclic; ///< Result of the last Validate(), reset by edits
+};
+
+} // namespace JzRE
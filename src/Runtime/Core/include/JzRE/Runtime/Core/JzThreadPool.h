@@ -6,131 +6,187 @@
 #pragma once
 
 #include <vector>
-#include <queue>
+#include <deque>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
+#include <exception>
 #include <future>
 #include <functional>
+#include <memory>
 #include <atomic>
 #include <type_traits>
 #include "JzRE/Runtime/Core/JzRETypes.h"
-#include "JzRE/Runtime/Core/JzLogger.h"
+#include "JzRE/Runtime/Core/JzJob.h"
+#include "JzRE/Runtime/Core/JzTaskGraph.h"
 
 namespace JzRE {
+
 /**
- * @brief Thread Pool
+ * @brief Work-stealing thread pool
+ *
+ * Every worker owns a Chase-Lev deque: it pushes and pops jobs at the bottom
+ * without locking while idle workers steal from the top. Jobs submitted from
+ * threads outside the pool go through a shared injection queue. Jobs are
+ * stored in JzJob, so small callables are scheduled without heap allocation.
+ *
+ * Blocking calls (ParallelFor, Run) execute queued jobs on the calling thread
+ * while they wait, so they may be nested inside jobs.
  */
 class JzThreadPool {
 public:
-    explicit JzThreadPool(Size num_threads = std::thread::hardware_concurrency()) :
-        m_stop(false)
-    {
-        m_workers.reserve(num_threads);
-        for (Size i = 0; i < num_threads; ++i) {
-            m_workers.emplace_back([this]() {
-                _WorkerThread();
-            });
-        }
-    }
+    explicit JzThreadPool(Size num_threads = std::thread::hardware_concurrency());
 
     JzThreadPool(const JzThreadPool &) = delete;
 
     JzThreadPool &operator=(const JzThreadPool &) = delete;
 
-    ~JzThreadPool()
-    {
-        Stop();
-    }
+    ~JzThreadPool();
 
+    /**
+     * @brief Queue a callable and get a future for its result.
+     *
+     * Exceptions thrown by the callable are stored in the future.
+     *
+     * @throw std::runtime_error If the pool has been stopped.
+     */
     template <typename F, typename... Args>
     auto Submit(F &&f, Args &&...args)
         -> std::future<std::invoke_result_t<F, Args...>>
     {
         using return_type = std::invoke_result_t<F, Args...>;
 
-        auto task = std::make_shared<std::packaged_task<return_type()>>(
-            std::bind(std::forward<F>(f), std::forward<Args>(args)...));
-
-        std::future<return_type> result = task->get_future();
-
-        {
-            std::unique_lock<std::mutex> lock(m_queueMutex);
-            if (m_stop) {
-                throw std::runtime_error("Submit on stopped ThreadPool");
-            }
-            m_tasks.emplace([task]() { (*task)(); });
-            m_pendingTasks++;
-        }
-
-        m_condition.notify_one();
+        std::promise<return_type> promise;
+        std::future<return_type>  result = promise.get_future();
+
+        // The pending count drops before the future becomes ready
+        Enqueue(JzJob([this,
+                       promise = std::move(promise),
+                       func    = std::forward<F>(f),
+                       ...args = std::forward<Args>(args)]() mutable {
+                    try {
+                        if constexpr (std::is_void_v<return_type>) {
+                            std::invoke(func, args...);
+                            m_pendingTasks--;
+                            promise.set_value();
+                        } else {
+                            return_type value = std::invoke(func, args...);
+                            m_pendingTasks--;
+                            promise.set_value(std::forward<return_type>(value));
+                        }
+                    } catch (...) {
+                        m_pendingTasks--;
+                        promise.set_exception(std::current_exception());
+                    }
+                }),
+                true);
 
         return result;
     }
 
-    void Stop()
+    /**
+     * @brief Process [begin, end) in chunks of at most `grain` items and wait for all of them.
+     *
+     * The calling thread runs chunks alongside the workers; a pool without
+     * workers runs the whole range on it as one chunk. The first exception
+     * thrown by `func` is rethrown on the calling thread.
+     *
+     * @param func Callable invoked as `func(chunkBegin, chunkEnd)`.
+     */
+    template <typename F>
+    void ParallelFor(Size begin, Size end, Size grain, F &&func)
     {
-        {
-            std::unique_lock<std::mutex> lock(m_queueMutex);
-            m_stop = true;
+        if (begin >= end) {
+            return;
         }
 
-        m_condition.notify_all();
+        JzParallelForState state;
+        state.context = const_cast<void *>(static_cast<const void *>(std::addressof(func)));
+        state.invoke  = [](void *context, Size chunkBegin, Size chunkEnd) {
+            (*static_cast<std::remove_reference_t<F> *>(context))(chunkBegin, chunkEnd);
+        };
+        state.grain = grain > 0 ? grain : 1;
+        state.remaining.store(end - begin, std::memory_order_relaxed);
 
-        for (auto &worker : m_workers) {
-            if (worker.joinable()) {
-                worker.join();
-            }
-        }
+        RunParallelFor(state, begin, end);
     }
 
+    /**
+     * @brief Run a task graph and wait for all of its tasks.
+     *
+     * @return Bool False if the graph contains a cycle, in which case nothing runs.
+     *         The check runs once after each change to the graph.
+     */
+    Bool Run(JzTaskGraph &graph);
+
+    /**
+     * @brief Execute one queued job on the calling thread, if any.
+     *
+     * @return Bool True if a job was executed.
+     */
+    Bool TryRunPendingJob();
+
+    void Stop();
+
     Size GetThreadCount() const
     {
         return m_workers.size();
     }
 
+    /**
+     * @brief Get the number of submitted tasks that have not finished yet.
+     */
     Size GetPendingTaskCount() const
     {
         return m_pendingTasks;
     }
 
 private:
-    void _WorkerThread()
+    struct JzWorker;
+    struct JzJobNode;
+
+    using JzRangeInvoke = void (*)(void *context, Size chunkBegin, Size chunkEnd);
+
+    struct JzParallelForState {
+        void              *context = nullptr;
+        JzRangeInvoke      invoke  = nullptr;
+        Size               grain   = 1;
+        std::atomic<Size>  remaining{0}; ///< Items not processed yet
+        std::atomic<Bool>  failed{false};
+        std::exception_ptr exception;
+    };
+
+    void       Enqueue(JzJob &&job, Bool isSubmit);
+    JzJobNode *FindJob(Size workerIndex);
+    void       Execute(JzJobNode *node);
+    void       WakeWorker();
+    void       WorkerThread(Size workerIndex);
+
+    void RunParallelFor(JzParallelForState &state, Size begin, Size end);
+    void ExecuteRange(JzParallelForState &state, Size begin, Size end);
+    void ExecuteGraphTask(JzTaskGraph &graph, JzTaskId id);
+
+    template <typename TPredicate>
+    void HelpUntil(TPredicate &&done)
     {
-        while (true) {
-            std::function<void()> task;
-
-            {
-                std::unique_lock<std::mutex> lock(m_queueMutex);
-                m_condition.wait(lock, [this] {
-                    return m_stop || !m_tasks.empty();
-                });
-
-                if (m_stop && m_tasks.empty()) {
-                    return;
-                }
-
-                task = std::move(m_tasks.front());
-                m_tasks.pop();
-            }
-
-            try {
-                task();
-                m_pendingTasks--;
-            } catch (const std::exception &e) {
-                JzRE_LOG_ERROR("ThreadPool task exception: {}", e.what());
-                m_pendingTasks--;
+        while (!done()) {
+            if (!TryRunPendingJob()) {
+                std::this_thread::yield();
             }
         }
     }
 
 private:
-    std::vector<std::thread>          m_workers;
-    std::queue<std::function<void()>> m_tasks;
-    std::mutex                        m_queueMutex;
-    std::condition_variable           m_condition;
-    std::atomic<Bool>                 m_stop{false};
-    std::atomic<Size>                 m_pendingTasks{0};
+    std::vector<std::unique_ptr<JzWorker>> m_workers;
+    std::deque<JzJobNode *>                m_injectionQueue;
+    std::mutex                             m_injectionMutex;
+    std::mutex                             m_sleepMutex;
+    std::condition_variable                m_condition;
+    std::atomic<Size>                      m_queuedJobs{0};      ///< Jobs waiting in any queue
+    std::atomic<Size>                      m_injectedJobs{0};    ///< Jobs waiting in the injection queue
+    std::atomic<Size>                      m_sleepingWorkers{0};
+    std::atomic<Bool>                      m_stop{false};
+    std::atomic<Size>                      m_pendingTasks{0};
 };
 
-} // namespace JzRE
\ No newline at end of file
+} // namespace JzRE
@@ -4,6 +4,8 @@
  */
 
 #include "JzRE/Runtime/Core/JzLogger.h"
+#include <algorithm>
+#include <chrono>
 #include <spdlog/common.h>
 #include <spdlog/spdlog.h>
 #include "spdlog/sinks/stdout_color_sinks.h"
@@ -11,14 +13,71 @@
 #include "JzRE/Runtime/Core/JzELog.h"
 #include "JzRE/Runtime/Core/JzLogSink.h"
 
+namespace {
+
+/**
+ * @brief Header in front of every record; a null formatFunc marks padding before a wrap.
+ */
+struct JzLogRecordHeader {
+    using JzFormatFunc = void (*)(std::string_view, const std::byte *, JzRE::String &);
+
+    JzFormatFunc                  formatFunc;
+    const char                   *formatData;
+    JzRE::U32                     formatSize;
+    JzRE::U32                     size; ///< Whole record including the header, 8-byte aligned
+    spdlog::log_clock::time_point time;
+    JzRE::JzELogLevel             level;
+};
+
+constexpr JzRE::Size kRecordAlignment = 8;
+constexpr JzRE::Size kHeaderSize      = (sizeof(JzLogRecordHeader) + kRecordAlignment - 1) & ~(kRecordAlignment - 1);
+
+spdlog::level::level_enum ToSpdLevel(JzRE::JzELogLevel level)
+{
+    switch (level) {
+        case JzRE::JzELogLevel::Trace:
+            return spdlog::level::trace;
+        case JzRE::JzELogLevel::Debug:
+            return spdlog::level::debug;
+        case JzRE::JzELogLevel::Info:
+            return spdlog::level::info;
+        case JzRE::JzELogLevel::Warning:
+            return spdlog::level::warn;
+        case JzRE::JzELogLevel::Error:
+            return spdlog::level::err;
+        case JzRE::JzELogLevel::Critical:
+            return spdlog::level::critical;
+        default:
+            return spdlog::level::info;
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Single-producer single-consumer byte ring owned by one thread.
+ */
+struct JzRE::JzLogger::JzLogRing {
+    alignas(kRecordAlignment) std::byte buffer[RingCapacity];
+    std::atomic<U64> head{0}; ///< Committed write position, producer owned
+    std::atomic<U64> tail{0}; ///< Read position, consumer owned
+    U64              pendingHead  = 0; ///< End of the record being written
+    JzELogLevel      pendingLevel = JzELogLevel::Info;
+    U64              drainEnd     = 0; ///< Consumer only
+    std::atomic<Bool> retired{false};  ///< Owning thread exited, release once drained
+};
+
+static_assert((JzRE::JzLogger::RingCapacity & (JzRE::JzLogger::RingCapacity - 1)) == 0, "Ring capacity must be a power of two");
+static_assert(JzRE::JzLogger::MaxArgumentBytes + kHeaderSize <= JzRE::JzLogger::RingCapacity / 2, "Records must fit the ring");
+
 JzRE::JzLogger::JzLogger()
 {
     try {
         std::vector<spdlog::sink_ptr> sinks;
 
         // console sink
-        auto console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
-        sinks.push_back(console_sink);
+        m_consoleSink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+        sinks.push_back(m_consoleSink);
 
         // file sink
         auto file_sink = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(
@@ -26,8 +85,8 @@ JzRE::JzLogger::JzLogger()
         sinks.push_back(file_sink);
 
         // custom event sink
-        auto event_sink = std::make_shared<JzLogSink<std::mutex>>(m_logCallback);
-        sinks.push_back(event_sink);
+        m_eventSink = std::make_shared<JzLogSink<std::mutex>>();
+        sinks.push_back(m_eventSink);
 
         // create multiple sink logger
         m_logger = std::make_shared<spdlog::logger>("main_logger", sinks.begin(), sinks.end());
@@ -35,15 +94,29 @@ JzRE::JzLogger::JzLogger()
         // log format
         m_logger->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%l] %v");
 
-        // log level
-        m_logger->set_level(spdlog::level::info);
-        m_logger->flush_on(spdlog::level::info);
+        // levels are filtered before records are queued
+        m_logger->set_level(spdlog::level::trace);
 
         spdlog::register_logger(m_logger);
     } catch (const spdlog::spdlog_ex &ex) {
         spdlog::stderr_color_mt("stderr");
         spdlog::get("stderr")->error("日志初始化失败: {}", ex.what());
     }
+
+    m_thread = std::thread(&JzLogger::WorkerThread, this);
+}
+
+JzRE::JzLogger::~JzLogger()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_stop = true;
+    }
+    m_wakeCondition.notify_one();
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
 }
 
 JzRE::JzLogger &JzRE::JzLogger::GetInstance()
@@ -52,38 +125,312 @@ JzRE::JzLogger &JzRE::JzLogger::GetInstance()
     return instance;
 }
 
-void JzRE::JzLogger::Log(const JzRE::String &message, JzRE::JzELogLevel level)
+void JzRE::JzLogger::SetLevel(JzRE::JzELogLevel level)
+{
+    s_level.store(static_cast<I32>(level), std::memory_order_relaxed);
+}
+
+JzRE::JzELogLevel JzRE::JzLogger::GetLevel() const
+{
+    return static_cast<JzELogLevel>(s_level.load(std::memory_order_relaxed));
+}
+
+void JzRE::JzLogger::SetConsoleOutput(JzRE::Bool enabled)
+{
+    if (m_consoleSink) {
+        m_consoleSink->set_level(enabled ? spdlog::level::trace : spdlog::level::off);
+    }
+}
+
+std::byte *JzRE::JzLogger::BeginRecord(JzRE::JzELogLevel level, std::string_view format, JzLogFormatFunc formatFunc, JzRE::Size argumentBytes)
+{
+    auto &ring = GetThreadRing();
+
+    const Size recordSize = (kHeaderSize + argumentBytes + kRecordAlignment - 1) & ~(kRecordAlignment - 1);
+
+    U64        head       = ring.head.load(std::memory_order_relaxed);
+    const Size offset     = static_cast<Size>(head & (RingCapacity - 1));
+    const Size contiguous = RingCapacity - offset;
+    const Size needed     = recordSize + (contiguous < recordSize ? contiguous : 0);
+
+    // Wait for the logger thread instead of dropping the record
+    while (head + needed - ring.tail.load(std::memory_order_acquire) > RingCapacity) {
+        WakeWorker();
+        std::this_thread::yield();
+    }
+
+    if (contiguous < recordSize) {
+        // Skip the end of the buffer; the consumer skips remainders too small for a header
+        if (contiguous >= kHeaderSize) {
+            auto *padding       = reinterpret_cast<JzLogRecordHeader *>(ring.buffer + offset);
+            padding->formatFunc = nullptr;
+            padding->size       = static_cast<U32>(contiguous);
+        }
+        head += contiguous;
+    }
+
+    auto *header       = reinterpret_cast<JzLogRecordHeader *>(ring.buffer + (head & (RingCapacity - 1)));
+    header->formatFunc = formatFunc;
+    header->formatData = format.data();
+    header->formatSize = static_cast<U32>(format.size());
+    header->size       = static_cast<U32>(recordSize);
+    header->time       = spdlog::log_clock::now();
+    header->level      = level;
+
+    ring.pendingHead  = head + recordSize;
+    ring.pendingLevel = level;
+    return reinterpret_cast<std::byte *>(header) + kHeaderSize;
+}
+
+void JzRE::JzLogger::EndRecord()
+{
+    auto &ring = GetThreadRing();
+    ring.head.store(ring.pendingHead, std::memory_order_release);
+
+    // Pairs with the fence in WorkerThread: either it sees this record or we see it idle
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    WakeWorker();
+
+    // Make sure fatal messages reach the sinks before a possible crash
+    if (ring.pendingLevel == JzELogLevel::Critical) {
+        Flush();
+    }
+}
+
+void JzRE::JzLogger::WriteMessage(JzRE::JzELogLevel level, std::string_view message)
+{
+    if (message.size() <= MaxArgumentBytes - sizeof(U32)) {
+        std::byte *cursor = BeginRecord(level, "{}", &FormatRecord<std::string_view>, sizeof(U32) + message.size());
+        WriteArgument(cursor, message);
+        EndRecord();
+        return;
+    }
+
+    // Keep what fits and say how much was cut, so a long message never loses content silently
+    const std::string_view kept    = message.substr(0, MaxArgumentBytes - sizeof(U32) - sizeof(U64));
+    const U64              dropped = message.size() - kept.size();
+
+    std::byte *cursor = BeginRecord(level, "{} [truncated {} bytes]", &FormatRecord<std::string_view, U64>,
+                                    sizeof(U32) + kept.size() + sizeof(U64));
+    WriteArgument(cursor, kept);
+    WriteArgument(cursor, dropped);
+    EndRecord();
+}
+
+void JzRE::JzLogger::Flush()
+{
+    std::unique_lock<std::mutex> lock(m_wakeMutex);
+    if (m_stop) {
+        return;
+    }
+
+    const U64 request = ++m_flushRequested;
+    m_wakeCondition.notify_one();
+    m_flushCondition.wait(lock, [this, request]() { return m_flushCompleted >= request; });
+}
+
+JzRE::Size JzRE::JzLogger::GetRingCount()
 {
-    // system log
-    m_logger->log([&]() {
-        switch (level) {
-            case JzELogLevel::Trace:
-                return spdlog::level::trace;
-            case JzELogLevel::Debug:
-                return spdlog::level::debug;
-            case JzELogLevel::Info:
-                return spdlog::level::info;
-            case JzELogLevel::Warning:
-                return spdlog::level::warn;
-            case JzELogLevel::Error:
-                return spdlog::level::err;
-            case JzELogLevel::Critical:
-                return spdlog::level::critical;
-            default:
-                return spdlog::level::info;
+    std::lock_guard<std::mutex> lock(m_ringMutex);
+    return m_rings.size();
+}
+
+JzRE::JzLogger::JzLogRing &JzRE::JzLogger::GetThreadRing()
+{
+    // Rings are owned by the logger so records survive their thread; the
+    // thread-exit hook hands the ring back to be released once drained
+    struct JzThreadRingOwner {
+        JzLogRing *ring = nullptr;
+
+        ~JzThreadRingOwner()
+        {
+            if (ring) {
+                ring->retired.store(true, std::memory_order_release);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                JzLogger::GetInstance().WakeWorker();
+            }
+        }
+    };
+    thread_local JzThreadRingOwner owner;
+
+    if (owner.ring == nullptr) {
+        auto owned = std::make_unique<JzLogRing>();
+
+        std::lock_guard<std::mutex> lock(m_ringMutex);
+        owner.ring = owned.get();
+        m_rings.push_back(std::move(owned));
+    }
+    return *owner.ring;
+}
+
+void JzRE::JzLogger::WakeWorker()
+{
+    // Only the first writer after the logger thread went idle pays for the notification
+    if (!m_workerIdle.load(std::memory_order_seq_cst) || !m_workerIdle.exchange(false, std::memory_order_seq_cst)) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_wakeRequested.store(true, std::memory_order_relaxed);
+    }
+    m_wakeCondition.notify_one();
+}
+
+void JzRE::JzLogger::WorkerThread()
+{
+    while (true) {
+        U64  flushRequest = 0;
+        Bool stop         = false;
+        {
+            std::lock_guard<std::mutex> lock(m_wakeMutex);
+            flushRequest = m_flushRequested;
+            stop         = m_stop;
+        }
+
+        // Everything queued before the flush request or the stop is drained here
+        const Bool drained = DrainRings();
+
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        if (m_flushCompleted < flushRequest) {
+            m_flushCompleted = flushRequest;
+            m_flushCondition.notify_all();
+        }
+        if (stop) {
+            break;
+        }
+        if (!drained) {
+            // Go idle before the last look at the rings, so a record pushed after it wakes us
+            m_workerIdle.store(true, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!HasPendingRecords()) {
+                m_wakeCondition.wait(lock, [this]() {
+                    return m_stop || m_flushRequested != m_flushCompleted || m_wakeRequested.load(std::memory_order_relaxed);
+                });
+            }
+            m_workerIdle.store(false, std::memory_order_relaxed);
+        }
+        m_wakeRequested.store(false, std::memory_order_relaxed);
+    }
+}
+
+JzRE::Bool JzRE::JzLogger::DrainRings()
+{
+    std::vector<JzLogRing *> rings;
+    {
+        std::lock_guard<std::mutex> lock(m_ringMutex);
+        rings.reserve(m_rings.size());
+        for (auto &ring : m_rings) {
+            rings.push_back(ring.get());
+        }
+    }
+
+    std::vector<const JzLogRecordHeader *> records;
+    for (auto *ring : rings) {
+        U64       position = ring->tail.load(std::memory_order_relaxed);
+        const U64 head     = ring->head.load(std::memory_order_acquire);
+        while (position < head) {
+            const Size offset     = static_cast<Size>(position & (RingCapacity - 1));
+            const Size contiguous = RingCapacity - offset;
+            if (contiguous < kHeaderSize) {
+                position += contiguous;
+                continue;
+            }
+
+            const auto *header = reinterpret_cast<const JzLogRecordHeader *>(ring->buffer + offset);
+            if (header->formatFunc != nullptr) {
+                records.push_back(header);
+            }
+            position += header->size;
         }
-    }(),
-                  message);
+        ring->drainEnd = position;
+    }
+
+    if (records.empty()) {
+        ReleaseRetiredRings(rings);
+        return false;
+    }
+
+    // Interleave the threads in call order
+    std::stable_sort(records.begin(), records.end(), [](const JzLogRecordHeader *lhs, const JzLogRecordHeader *rhs) {
+        return lhs->time < rhs->time;
+    });
+
+    String message;
+    for (const auto *header : records) {
+        message.clear();
+        try {
+            header->formatFunc(std::string_view(header->formatData, header->formatSize),
+                               reinterpret_cast<const std::byte *>(header) + kHeaderSize, message);
+        } catch (const std::exception &e) {
+            message = "Log format error: ";
+            message += e.what();
+        }
+
+        if (m_logger) {
+            m_logger->log(header->time, spdlog::source_loc{}, ToSpdLevel(header->level), message);
+        }
+    }
+
+    for (auto *ring : rings) {
+        ring->tail.store(ring->drainEnd, std::memory_order_release);
+    }
+
+    if (m_logger) {
+        m_logger->flush();
+    }
+
+    ReleaseRetiredRings(rings);
+    return true;
+}
+
+JzRE::Bool JzRE::JzLogger::HasPendingRecords()
+{
+    std::lock_guard<std::mutex> lock(m_ringMutex);
+    return std::any_of(m_rings.begin(), m_rings.end(), [](const std::unique_ptr<JzLogRing> &ring) {
+        return ring->head.load(std::memory_order_acquire) != ring->tail.load(std::memory_order_relaxed);
+    });
+}
+
+void JzRE::JzLogger::ReleaseRetiredRings(const std::vector<JzLogRing *> &rings)
+{
+    std::vector<const JzLogRing *> released;
+    for (const auto *ring : rings) {
+        // The owner's last record is published before its retired flag
+        if (ring->retired.load(std::memory_order_acquire) &&
+            ring->head.load(std::memory_order_acquire) == ring->tail.load(std::memory_order_relaxed)) {
+            released.push_back(ring);
+        }
+    }
+    if (released.empty()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_ringMutex);
+    std::erase_if(m_rings, [&released](const std::unique_ptr<JzLogRing> &ring) {
+        return std::find(released.begin(), released.end(), ring.get()) != released.end();
+    });
+}
+
+void JzRE::JzLogger::Log(const JzRE::String &message, JzRE::JzELogLevel level)
+{
+    if (ShouldLog(level)) {
+        WriteMessage(level, message);
+    }
 }
 
 void JzRE::JzLogger::SetLogMessageCallback(std::function<void(const JzLogMessage &)> callback)
 {
-    m_logCallback = std::move(callback);
+    if (m_eventSink) {
+        m_eventSink->SetCallback(std::move(callback));
+    }
 }
 
 void JzRE::JzLogger::ClearLogMessageCallback()
 {
-    m_logCallback = nullptr;
+    if (m_eventSink) {
+        m_eventSink->SetCallback(nullptr);
+    }
 }
 
 void JzRE::JzLogger::Trace(const JzRE::String &message)
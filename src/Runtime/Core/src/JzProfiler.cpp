@@ -0,0 +1,247 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Core/JzProfiler.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+
+namespace JzRE {
+
+namespace {
+
+constexpr U32 kGpuTrackId = 0;
+
+void CopyName(std::string_view name, JzProfileEvent &event)
+{
+    const Size length = std::min(name.size(), JzProfileEvent::MaxNameLength);
+    std::copy_n(name.data(), length, event.name);
+    event.name[length] = '\0';
+}
+
+void WriteJsonString(std::ostream &stream, std::string_view text)
+{
+    stream << '"';
+    for (const char c : text) {
+        switch (c) {
+            case '"':
+                stream << "\\\"";
+                break;
+            case '\\':
+                stream << "\\\\";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                    stream << escaped;
+                } else {
+                    stream << c;
+                }
+                break;
+        }
+    }
+    stream << '"';
+}
+
+} // namespace
+
+/**
+ * @brief Single-producer single-consumer event ring owned by one thread.
+ */
+struct JzProfiler::JzThreadRing {
+    std::array<JzProfileEvent, RingCapacity> events;
+    std::atomic<U64>                          head{0}; ///< Next slot to write, producer owned
+    std::atomic<U64>                          tail{0}; ///< Next slot to read, consumer owned
+    std::atomic<U64>                          dropped{0};
+    U32                                       trackId = 0;
+    String                                    name;
+
+    void Push(std::string_view zoneName, U64 beginNs, U64 endNs)
+    {
+        const U64 writeIndex = head.load(std::memory_order_relaxed);
+        if (writeIndex - tail.load(std::memory_order_acquire) >= RingCapacity) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        auto &event = events[writeIndex % RingCapacity];
+        CopyName(zoneName, event);
+        event.beginNs = beginNs;
+        event.endNs   = endNs;
+        head.store(writeIndex + 1, std::memory_order_release);
+    }
+
+    template <typename TFunc>
+    void Drain(TFunc &&func)
+    {
+        const U64 readIndex = tail.load(std::memory_order_relaxed);
+        const U64 endIndex  = head.load(std::memory_order_acquire);
+        for (U64 index = readIndex; index < endIndex; ++index) {
+            func(events[index % RingCapacity]);
+        }
+        tail.store(endIndex, std::memory_order_release);
+    }
+};
+
+JzProfiler &JzProfiler::GetInstance()
+{
+    static JzProfiler instance;
+    return instance;
+}
+
+JzProfiler::JzProfiler() :
+    m_gpuRing(std::make_unique<JzThreadRing>())
+{
+    m_gpuRing->trackId = kGpuTrackId;
+    m_gpuRing->name    = "GPU";
+}
+
+JzProfiler::~JzProfiler() = default;
+
+U64 JzProfiler::NowNs()
+{
+    return static_cast<U64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now().time_since_epoch())
+                                .count());
+}
+
+void JzProfiler::SetEnabled(Bool enabled)
+{
+    m_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void JzProfiler::SetThreadName(const String &name)
+{
+    auto &ring = GetThreadRing();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ring.name = name;
+}
+
+void JzProfiler::RecordCpuZone(std::string_view name, U64 beginNs, U64 endNs)
+{
+    GetThreadRing().Push(name, beginNs, endNs);
+}
+
+void JzProfiler::RecordGpuZone(std::string_view name, U64 beginNs, U64 endNs)
+{
+    m_gpuRing->Push(name, beginNs, endNs);
+}
+
+void JzProfiler::Collect()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto drainInto = [this](JzThreadRing &ring) {
+        ring.Drain([this, &ring](const JzProfileEvent &event) {
+            m_captured.push_back({event, ring.trackId});
+        });
+    };
+
+    for (auto &ring : m_rings) {
+        drainInto(*ring);
+    }
+    drainInto(*m_gpuRing);
+}
+
+Bool JzProfiler::ExportChromeTrace(const std::filesystem::path &path)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::error_code ec;
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path(), ec);
+    }
+
+    std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+    if (!stream.is_open()) {
+        return false;
+    }
+
+    U64 originNs = std::numeric_limits<U64>::max();
+    for (const auto &captured : m_captured) {
+        originNs = std::min(originNs, captured.event.beginNs);
+    }
+    if (m_captured.empty()) {
+        originNs = 0;
+    }
+
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    Bool first       = true;
+    auto writeHeader = [&](U32 trackId, const String &name) {
+        stream << (first ? "\n" : ",\n");
+        first = false;
+        stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << trackId << ",\"args\":{\"name\":";
+        WriteJsonString(stream, name);
+        stream << "}}";
+    };
+
+    writeHeader(m_gpuRing->trackId, m_gpuRing->name);
+    for (const auto &ring : m_rings) {
+        writeHeader(ring->trackId, ring->name.empty() ? "Thread " + std::to_string(ring->trackId) : ring->name);
+    }
+
+    char timing[96];
+    for (const auto &captured : m_captured) {
+        const auto &event = captured.event;
+        const F64   ts    = static_cast<F64>(event.beginNs - originNs) / 1000.0;
+        const F64   dur   = static_cast<F64>(event.endNs - std::min(event.beginNs, event.endNs)) / 1000.0;
+
+        stream << ",\n{\"name\":";
+        WriteJsonString(stream, event.name);
+        std::snprintf(timing, sizeof(timing), ",\"ts\":%.3f,\"dur\":%.3f", ts, dur);
+        stream << ",\"cat\":\"" << (captured.trackId == kGpuTrackId ? "gpu" : "cpu") << "\",\"ph\":\"X\""
+               << timing << ",\"pid\":1,\"tid\":" << captured.trackId << "}";
+    }
+
+    stream << "\n]}\n";
+    return stream.good();
+}
+
+void JzProfiler::ClearCapture()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_captured.clear();
+}
+
+Size JzProfiler::GetCapturedEventCount()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_captured.size();
+}
+
+U64 JzProfiler::GetDroppedEventCount()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    U64 dropped = m_gpuRing->dropped.load(std::memory_order_relaxed);
+    for (const auto &ring : m_rings) {
+        dropped += ring->dropped.load(std::memory_order_relaxed);
+    }
+    return dropped;
+}
+
+JzProfiler::JzThreadRing &JzProfiler::GetThreadRing()
+{
+    // Rings are owned by the profiler so events survive their thread
+    thread_local JzThreadRing *ring = nullptr;
+    if (ring == nullptr) {
+        auto owned = std::make_unique<JzThreadRing>();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        owned->trackId = static_cast<U32>(m_rings.size()) + 1;
+        ring           = owned.get();
+        m_rings.push_back(std::move(owned));
+    }
+    return *ring;
+}
+
+} // namespace JzRE
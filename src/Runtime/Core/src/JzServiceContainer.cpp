@@ -5,4 +5,24 @@
 
 #include "JzRE/Runtime/Core/JzServiceContainer.h"
 
-std::unordered_map<JzRE::I32, std::any> JzRE::JzServiceContainer::__SERVICES;
\ No newline at end of file
+#include <atomic>
+
+JzRE::JzServiceContainer::JzSlotArray  JzRE::JzServiceContainer::s_globalSlots{};
+JzRE::JzServiceContainer::JzSlotArray *JzRE::JzServiceContainer::s_slots = &JzRE::JzServiceContainer::s_globalSlots;
+
+JzRE::Size JzRE::JzServiceContainer::NextSlotIndex()
+{
+    // Slot 0 stays empty for types that were never provided
+    static std::atomic<Size> nextIndex{1};
+
+    const Size index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+    if (index >= MaxServices) {
+        throw std::runtime_error("Too many service types for JzServiceContainer");
+    }
+    return index;
+}
+
+void JzRE::JzServiceContainer::ThrowNotProvided(const char *typeName)
+{
+    throw std::runtime_error(std::string("Service not provided: ") + typeName);
+}
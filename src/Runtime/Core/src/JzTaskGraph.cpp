@@ -0,0 +1,59 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Core/JzTaskGraph.h"
+
+namespace JzRE {
+
+void JzTaskGraph::AddDependency(JzTaskId before, JzTaskId after)
+{
+    if (before >= m_nodes.size() || after >= m_nodes.size() || before == after) {
+        return;
+    }
+
+    m_nodes[before].successors.push_back(after);
+    m_nodes[after].dependencyCount++;
+    m_validity = JzEValidity::Unknown;
+}
+
+Bool JzTaskGraph::Validate() const
+{
+    if (m_validity != JzEValidity::Unknown) {
+        return m_validity == JzEValidity::Acyclic;
+    }
+
+    // Kahn's algorithm: every task must become ready exactly once
+    std::vector<U32>      remaining(m_nodes.size());
+    std::vector<JzTaskId> ready;
+    ready.reserve(m_nodes.size());
+
+    for (Size index = 0; index < m_nodes.size(); ++index) {
+        remaining[index] = m_nodes[index].dependencyCount;
+        if (remaining[index] == 0) {
+            ready.push_back(static_cast<JzTaskId>(index));
+        }
+    }
+
+    Size visited = 0;
+    while (visited < ready.size()) {
+        const JzTaskId id = ready[visited++];
+        for (const JzTaskId successor : m_nodes[id].successors) {
+            if (--remaining[successor] == 0) {
+                ready.push_back(successor);
+            }
+        }
+    }
+
+    m_validity = visited == m_nodes.size() ? JzEValidity::Acyclic : JzEValidity::Cyclic;
+    return m_validity == JzEValidity::Acyclic;
+}
+
+void JzTaskGraph::Clear()
+{
+    m_nodes.clear();
+    m_validity = JzEValidity::Acyclic;
+}
+
+} // namespace JzRE
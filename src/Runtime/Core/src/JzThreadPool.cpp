@@ -0,0 +1,500 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Core/JzThreadPool.h"
+
+#include <array>
+#include <limits>
+#include <stdexcept>
+
+#include "JzRE/Runtime/Core/JzLogger.h"
+
+namespace JzRE {
+
+namespace {
+
+constexpr Size kExternalThread = std::numeric_limits<Size>::max();
+constexpr U32  kSpinCount      = 64; ///< Polls before an idle worker goes to sleep
+
+/**
+ * @brief Fixed-capacity Chase-Lev deque (Le et al., "Correct and Efficient
+ * Work-Stealing for Weak Memory Models", 2013).
+ *
+ * The owner pushes and pops at the bottom, other threads steal from the top.
+ */
+template <typename T>
+class JzWorkStealingDeque {
+public:
+    static constexpr I64 Capacity = 4096;
+
+    /**
+     * @brief Push an item. Owner thread only.
+     *
+     * @return Bool False if the deque is full.
+     */
+    Bool Push(T *item)
+    {
+        const I64 bottom = m_bottom.load(std::memory_order_relaxed);
+        const I64 top    = m_top.load(std::memory_order_acquire);
+        if (bottom - top >= Capacity) {
+            return false;
+        }
+
+        m_buffer[bottom & (Capacity - 1)].store(item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @brief Pop the most recently pushed item. Owner thread only.
+     */
+    T *Pop()
+    {
+        const I64 bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        I64 top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        T *item = m_buffer[bottom & (Capacity - 1)].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // Last item: race against thieves
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    /**
+     * @brief Steal the oldest item. Any thread.
+     */
+    T *Steal()
+    {
+        I64 top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const I64 bottom = m_bottom.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return nullptr;
+        }
+
+        T *item = m_buffer[top & (Capacity - 1)].load(std::memory_order_relaxed);
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return item;
+    }
+
+private:
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    alignas(64) std::atomic<I64> m_top{0};
+    alignas(64) std::atomic<I64> m_bottom{0};
+    std::array<std::atomic<T *>, Capacity> m_buffer{};
+};
+
+/**
+ * @brief Node allocator with per-thread caches backed by a shared free list.
+ *
+ * Nodes are handed between threads in batches, so allocating and freeing a
+ * node only takes the shared lock once every BatchSize operations.
+ */
+template <typename TNode>
+class JzNodeFreeList {
+public:
+    static TNode *Allocate()
+    {
+        auto &cache = GetCache();
+        if (cache.head == nullptr) {
+            Refill(cache);
+        }
+
+        TNode *node = cache.head;
+        cache.head  = node->next;
+        cache.count--;
+        return node;
+    }
+
+    static void Free(TNode *node)
+    {
+        auto &cache = GetCache();
+        node->next  = cache.head;
+        cache.head  = node;
+        if (++cache.count > BatchSize * 2) {
+            Release(cache, BatchSize);
+        }
+    }
+
+private:
+    static constexpr Size BatchSize = 32;
+    static constexpr Size BlockSize = 256;
+
+    struct JzShared {
+        std::mutex                            mutex;
+        TNode                                *head = nullptr;
+        std::vector<std::unique_ptr<TNode[]>> blocks;
+    };
+
+    struct JzCache {
+        TNode *head  = nullptr;
+        Size   count = 0;
+
+        ~JzCache()
+        {
+            Release(*this, count);
+        }
+    };
+
+    static JzShared &GetShared()
+    {
+        static JzShared shared;
+        return shared;
+    }
+
+    static JzCache &GetCache()
+    {
+        thread_local JzCache cache;
+        return cache;
+    }
+
+    static void Refill(JzCache &cache)
+    {
+        auto                       &shared = GetShared();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+
+        if (shared.head == nullptr) {
+            auto block = std::make_unique<TNode[]>(BlockSize);
+            for (Size index = 0; index < BlockSize; ++index) {
+                block[index].next = shared.head;
+                shared.head       = &block[index];
+            }
+            shared.blocks.push_back(std::move(block));
+        }
+
+        for (Size moved = 0; moved < BatchSize && shared.head != nullptr; ++moved) {
+            TNode *node = shared.head;
+            shared.head = node->next;
+            node->next  = cache.head;
+            cache.head  = node;
+            cache.count++;
+        }
+    }
+
+    static void Release(JzCache &cache, Size count)
+    {
+        if (count == 0) {
+            return;
+        }
+
+        auto                       &shared = GetShared();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+
+        for (Size moved = 0; moved < count && cache.head != nullptr; ++moved) {
+            TNode *node = cache.head;
+            cache.head  = node->next;
+            node->next  = shared.head;
+            shared.head = node;
+            cache.count--;
+        }
+    }
+};
+
+thread_local JzThreadPool *t_currentPool = nullptr;
+thread_local Size          t_workerIndex = kExternalThread;
+thread_local U32           t_stealSeed   = 0x9E3779B9u;
+
+U32 NextRandom()
+{
+    // xorshift32
+    U32 x = t_stealSeed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    t_stealSeed = x;
+    return x;
+}
+
+} // namespace
+
+struct JzThreadPool::JzJobNode {
+    JzJob      job;
+    JzJobNode *next = nullptr;
+};
+
+struct JzThreadPool::JzWorker {
+    JzWorkStealingDeque<JzJobNode> deque;
+    std::thread                    thread;
+};
+
+JzThreadPool::JzThreadPool(Size num_threads)
+{
+    m_workers.reserve(num_threads);
+    for (Size i = 0; i < num_threads; ++i) {
+        m_workers.push_back(std::make_unique<JzWorker>());
+    }
+
+    // Start threads only after every deque exists, workers steal from each other
+    for (Size i = 0; i < num_threads; ++i) {
+        m_workers[i]->thread = std::thread([this, i]() {
+            WorkerThread(i);
+        });
+    }
+}
+
+JzThreadPool::~JzThreadPool()
+{
+    Stop();
+}
+
+void JzThreadPool::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_stop = true;
+    }
+
+    m_condition.notify_all();
+
+    for (auto &worker : m_workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+
+    // Jobs queued by the last running jobs after the workers exited
+    while (TryRunPendingJob()) { }
+}
+
+Bool JzThreadPool::TryRunPendingJob()
+{
+    const Size workerIndex = t_currentPool == this ? t_workerIndex : kExternalThread;
+    if (auto *node = FindJob(workerIndex)) {
+        Execute(node);
+        return true;
+    }
+    return false;
+}
+
+Bool JzThreadPool::Run(JzTaskGraph &graph)
+{
+    if (!graph.Validate()) {
+        JzRE_LOG_ERROR("JzThreadPool: task graph contains a cycle");
+        return false;
+    }
+    if (graph.m_nodes.empty()) {
+        return true;
+    }
+
+    for (auto &node : graph.m_nodes) {
+        node.remainingDependencies.store(node.dependencyCount, std::memory_order_relaxed);
+    }
+    graph.m_remainingTasks.store(graph.m_nodes.size(), std::memory_order_release);
+
+    for (Size index = 0; index < graph.m_nodes.size(); ++index) {
+        if (graph.m_nodes[index].dependencyCount == 0) {
+            const auto id = static_cast<JzTaskId>(index);
+            Enqueue(JzJob([this, &graph, id]() { ExecuteGraphTask(graph, id); }), false);
+        }
+    }
+
+    HelpUntil([&graph]() {
+        return graph.m_remainingTasks.load(std::memory_order_acquire) == 0;
+    });
+    return true;
+}
+
+void JzThreadPool::ExecuteGraphTask(JzTaskGraph &graph, JzTaskId id)
+{
+    while (id != JzTaskGraph::InvalidTask) {
+        auto &node = graph.m_nodes[id];
+
+        try {
+            node.work();
+        } catch (const std::exception &e) {
+            JzRE_LOG_ERROR("JzThreadPool: task graph task exception: {}", e.what());
+        } catch (...) {
+            JzRE_LOG_ERROR("JzThreadPool: task graph task exception");
+        }
+
+        // Continue with the first successor that became ready, queue the others
+        JzTaskId next = JzTaskGraph::InvalidTask;
+        for (const JzTaskId successor : node.successors) {
+            if (graph.m_nodes[successor].remainingDependencies.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                continue;
+            }
+            if (next == JzTaskGraph::InvalidTask) {
+                next = successor;
+            } else {
+                Enqueue(JzJob([this, &graph, successor]() { ExecuteGraphTask(graph, successor); }), false);
+            }
+        }
+
+        graph.m_remainingTasks.fetch_sub(1, std::memory_order_acq_rel);
+        id = next;
+    }
+}
+
+void JzThreadPool::RunParallelFor(JzParallelForState &state, Size begin, Size end)
+{
+    ExecuteRange(state, begin, end);
+
+    HelpUntil([&state]() {
+        return state.remaining.load(std::memory_order_acquire) == 0;
+    });
+
+    if (state.exception) {
+        std::rethrow_exception(state.exception);
+    }
+}
+
+void JzThreadPool::ExecuteRange(JzParallelForState &state, Size begin, Size end)
+{
+    // Split in halves and queue the upper half, idle workers steal the largest pieces first
+    while (end - begin > state.grain && !m_workers.empty()) {
+        const Size middle = begin + (end - begin) / 2;
+        Enqueue(JzJob([this, &state, middle, end]() { ExecuteRange(state, middle, end); }), false);
+        end = middle;
+    }
+
+    try {
+        if (!state.failed.load(std::memory_order_relaxed)) {
+            state.invoke(state.context, begin, end);
+        }
+    } catch (...) {
+        if (!state.failed.exchange(true, std::memory_order_acq_rel)) {
+            state.exception = std::current_exception();
+        }
+    }
+
+    state.remaining.fetch_sub(end - begin, std::memory_order_acq_rel);
+}
+
+void JzThreadPool::Enqueue(JzJob &&job, Bool isSubmit)
+{
+    // Internal jobs are accepted after Stop() so running ParallelFor/Run calls can finish
+    if (isSubmit) {
+        if (m_stop) {
+            throw std::runtime_error("Submit on stopped ThreadPool");
+        }
+        m_pendingTasks++;
+    }
+
+    auto *node = JzNodeFreeList<JzJobNode>::Allocate();
+    node->job  = std::move(job);
+
+    Bool queued = false;
+    if (t_currentPool == this) {
+        queued = m_workers[t_workerIndex]->deque.Push(node);
+    }
+    if (!queued) {
+        std::lock_guard<std::mutex> lock(m_injectionMutex);
+        m_injectionQueue.push_back(node);
+        m_injectedJobs++;
+    }
+
+    m_queuedJobs++;
+    WakeWorker();
+}
+
+JzThreadPool::JzJobNode *JzThreadPool::FindJob(Size workerIndex)
+{
+    JzJobNode *node = nullptr;
+
+    if (workerIndex != kExternalThread) {
+        node = m_workers[workerIndex]->deque.Pop();
+    }
+
+    if (node == nullptr && m_injectedJobs.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard<std::mutex> lock(m_injectionMutex);
+        if (!m_injectionQueue.empty()) {
+            node = m_injectionQueue.front();
+            m_injectionQueue.pop_front();
+            m_injectedJobs--;
+        }
+    }
+
+    if (node == nullptr && !m_workers.empty()) {
+        const Size workerCount = m_workers.size();
+        const Size start       = NextRandom() % workerCount;
+        for (Size offset = 0; offset < workerCount && node == nullptr; ++offset) {
+            const Size victim = (start + offset) % workerCount;
+            if (victim != workerIndex) {
+                node = m_workers[victim]->deque.Steal();
+            }
+        }
+    }
+
+    if (node != nullptr) {
+        m_queuedJobs--;
+    }
+    return node;
+}
+
+void JzThreadPool::Execute(JzJobNode *node)
+{
+    try {
+        node->job();
+    } catch (const std::exception &e) {
+        JzRE_LOG_ERROR("ThreadPool task exception: {}", e.what());
+    } catch (...) {
+        JzRE_LOG_ERROR("ThreadPool task exception");
+    }
+
+    node->job.Reset();
+    JzNodeFreeList<JzJobNode>::Free(node);
+}
+
+void JzThreadPool::WakeWorker()
+{
+    if (m_sleepingWorkers.load() > 0) {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_condition.notify_one();
+    }
+}
+
+void JzThreadPool::WorkerThread(Size workerIndex)
+{
+    t_currentPool = this;
+    t_workerIndex = workerIndex;
+    t_stealSeed   = 0x9E3779B9u ^ static_cast<U32>(workerIndex * 0x85EBCA6Bu + 1);
+
+    while (true) {
+        if (auto *node = FindJob(workerIndex)) {
+            Execute(node);
+            continue;
+        }
+
+        Bool hasWork = false;
+        for (U32 spin = 0; spin < kSpinCount && !hasWork; ++spin) {
+            std::this_thread::yield();
+            hasWork = m_queuedJobs.load() > 0;
+        }
+        if (hasWork) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_sleepingWorkers++;
+        m_condition.wait(lock, [this]() {
+            return m_stop || m_queuedJobs.load() > 0;
+        });
+        m_sleepingWorkers--;
+
+        if (m_stop && m_queuedJobs.load() == 0) {
+            break;
+        }
+    }
+
+    t_currentPool = nullptr;
+    t_workerIndex = kExternalThread;
+}
+
+} // namespace JzRE
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Platform/FileSystem/JzFileWatcher.h"
 
 namespace JzRE {
 
@@ -22,16 +23,20 @@ struct JzShaderCookServiceConfig {
     std::filesystem::path sourceRoot;                      ///< Shader source root directory.
     std::filesystem::path outputRoot;                      ///< Cooked shader output directory.
     std::filesystem::path shaderToolPath;                  ///< Optional explicit shader tool path.
-    F32                   scanIntervalSeconds = 0.5f;      ///< Polling interval.
+    F32                   scanIntervalSeconds = 0.5f;      ///< Polling interval, used without a JzFileWatcher service.
 };
 
 /**
- * @brief Polling-based auto-cook bridge from shader source to cooked runtime artifacts.
+ * @brief Auto-cook bridge from shader source to cooked runtime artifacts.
  *
  * The service watches source files under `sourceRoot` and invokes
  * `JzREShaderTool --input <manifest> --output-dir <outputRoot>` when
  * changes are detected. After successful cooking it requests an immediate
  * shader hot-reload pass through `JzAssetSystem`.
+ *
+ * When a JzFileWatcher service is provided the source tree is only scanned
+ * after a change notification; otherwise it is rescanned every
+ * `scanIntervalSeconds`.
  */
 class JzShaderCookService {
 public:
@@ -55,7 +60,7 @@ public:
     void Shutdown();
 
     /**
-     * @brief Poll source changes and trigger incremental cooking.
+     * @brief Check for source changes and trigger incremental cooking.
      *
      * @param deltaSeconds Frame delta time in seconds.
      * @param assetSystem Asset system used to trigger hot reload checks.
@@ -74,8 +79,10 @@ private:
     Bool ShouldRecookManifest(const std::filesystem::path &manifestPath);
     Bool CookManifest(const std::filesystem::path &manifestPath) const;
     std::filesystem::file_time_type ComputeManifestDependencyTimestamp(
-        const std::filesystem::path &manifestPath) const;
+        const std::filesystem::path &manifestPath, std::vector<std::filesystem::path> *outIncludeRoots = nullptr) const;
     std::filesystem::path ResolveShaderToolPath() const;
+    void                  WatchDirectory(const std::filesystem::path &directory);
+    void                  UnwatchAll();
 
 private:
     JzShaderCookServiceConfig m_config;
@@ -83,6 +90,10 @@ private:
     std::unordered_map<String, std::filesystem::file_time_type> m_manifestTimestamps;
     F32  m_timeSinceLastScan = 0.0f;
     Bool m_initialized       = false;
+
+    JzFileWatcher                                *m_fileWatcher = nullptr;
+    std::unordered_map<String, JzFileWatchHandle> m_watchedDirectories;
+    Bool                                          m_sourcesDirty = true; ///< Set by notifications, scan pending
 };
 
 } // namespace JzRE
@@ -70,6 +70,14 @@ struct JzMeshAssetComponent {
     I32  materialIndex = -1;    ///< Material slot index
     Bool isReady       = false; ///< Whether the asset is loaded and ready
 
+    // Level of detail (populated from JzMesh::GetLODs, selected by JzLODSystem)
+    std::vector<JzMeshHandle> lodMeshHandles;                      ///< Simplified levels 1..N (LOD0 is meshHandle)
+    std::vector<F32>          lodErrors;                           ///< Object-space error per level 1..N
+    JzVec3                    boundsCenter{0.0f, 0.0f, 0.0f};      ///< Object-space bounding sphere center
+    F32                       boundsRadius = 0.0f;                 ///< Object-space bounding sphere radius
+    U32                       activeLod    = 0;                    ///< Currently selected level (0 = full detail)
+    Bool                      occluded     = false;                ///< Hidden from the main camera (set by JzOcclusionCullingSystem)
+
     JzMeshAssetComponent() = default;
 
     explicit JzMeshAssetComponent(JzMeshHandle handle) :
@@ -82,6 +90,25 @@ struct JzMeshAssetComponent {
     {
         return meshHandle.IsValid();
     }
+
+    /**
+     * @brief Number of levels including LOD0
+     */
+    [[nodiscard]] U32 GetLODCount() const
+    {
+        return static_cast<U32>(lodMeshHandles.size()) + 1;
+    }
+
+    /**
+     * @brief Handle of the mesh to draw for the active level
+     */
+    [[nodiscard]] JzMeshHandle GetActiveMeshHandle() const
+    {
+        if (activeLod == 0 || activeLod > lodMeshHandles.size()) {
+            return meshHandle;
+        }
+        return lodMeshHandles[activeLod - 1];
+    }
 };
 
 /**
@@ -105,6 +132,8 @@ struct JzMaterialAssetComponent {
     static constexpr U64 KeywordUseNormalMap   = 1ULL << 1;
     static constexpr U64 KeywordUseSpecularMap = 1ULL << 2;
     static constexpr U64 KeywordUsePbr         = 1ULL << 3;
+    /// Set by JzRenderSystem for multi-draw indirect submission, never by materials.
+    static constexpr U64 KeywordUseIndirectDraw = 1ULL << 4;
 
     /// Shader variant keyword mask based on material features.
     U64 shaderKeywordMask = KeywordUsePbr;
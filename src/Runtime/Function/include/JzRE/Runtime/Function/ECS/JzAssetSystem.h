@@ -6,11 +6,14 @@
 #pragma once
 
 #include <memory>
+#include <typeindex>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "JzRE/Runtime/Function/ECS/JzEntity.h"
 #include "JzRE/Runtime/Function/ECS/JzSystem.h"
+#include "JzRE/Runtime/Platform/FileSystem/JzFileWatcher.h"
 #include "JzRE/Runtime/Resource/JzAssetHandle.h"
 #include "JzRE/Runtime/Resource/JzAssetManager.h"
 #include "JzRE/Runtime/Resource/JzMesh.h"
@@ -38,10 +41,16 @@ struct JzShaderComponent;
  * This system:
  * 1. Owns and manages JzAssetManager lifecycle
  * 2. Provides high-level API for loading, registering, and accessing assets
- * 3. Processes asset components each frame (cache updates, tag management)
+ * 3. Processes pending asset components (cache updates, tag management)
  * 4. Spawns entities from loaded models
  * 5. Hides low-level registry operations from external consumers
  *
+ * Only entities whose asset components were added, replaced or patched, or
+ * whose asset finished loading, are visited. Entities waiting on a loading
+ * asset are parked in a reverse index and woken by the asset manager's load
+ * result listener, by LoadSync/GetOrLoad and by shader reloads, so frames
+ * with nothing pending do no per-entity work.
+ *
  * Execution phase: Logic (runs before rendering to prepare data)
  */
 class JzAssetSystem : public JzSystem {
@@ -55,9 +64,15 @@ public:
     void Update(JzWorld &world, F32 delta) override;
     void OnShutdown(JzWorld &world) override;
 
+    /**
+     * @brief Asset system runs in RenderPrep phase.
+     *
+     * Finishing loads creates GPU resources, so the pipelined runtime runs it
+     * while the render thread is idle and the graphics context is free.
+     */
     JzSystemPhase GetPhase() const override
     {
-        return JzSystemPhase::Logic;
+        return JzSystemPhase::RenderPrep;
     }
 
     // ==================== Initialization ====================
@@ -244,6 +259,11 @@ public:
     [[nodiscard]] Size GetTotalMemoryUsage() const;
     [[nodiscard]] Size GetPendingLoadCount() const;
 
+    /**
+     * @brief Get the number of entities queued for a readiness pass next frame
+     */
+    [[nodiscard]] Size GetPendingEntityCount() const;
+
     // ==================== Hot Reload Configuration ====================
 
     /**
@@ -265,6 +285,9 @@ public:
     /**
      * @brief Set the interval between hot reload checks
      *
+     * With a JzFileWatcher service only notified files are checked; the
+     * interval then just controls how soon newly used shaders are watched.
+     *
      * @param seconds Time in seconds between file modification checks (default: 1.0)
      */
     void SetHotReloadCheckInterval(F32 seconds);
@@ -316,9 +339,12 @@ private:
     // ==================== Asset Component Processing ====================
     // (Absorbed from JzAssetLoadingSystem)
 
-    void ProcessMeshAssets(JzWorld &world);
-    void ProcessMaterialAssets(JzWorld &world);
-    void ProcessShaders(JzWorld &world);
+    void ProcessPendingEntities(JzWorld &world);
+
+    // Each returns true if the entity must be checked again next frame
+    Bool ProcessMeshAsset(JzWorld &world, JzEntity entity, JzMeshAssetComponent &meshComp);
+    Bool ProcessMaterialAsset(JzWorld &world, JzEntity entity, JzMaterialAssetComponent &matComp);
+    Bool ProcessShader(JzWorld &world, JzEntity entity, JzShaderComponent &shaderComp);
 
     void UpdateMeshComponentCache(JzMeshAssetComponent &comp, JzMesh *mesh);
     void UpdateMaterialComponentCache(JzMaterialAssetComponent &comp, JzMaterial *material);
@@ -326,10 +352,25 @@ private:
 
     void UpdateEntityAssetTags(JzWorld &world, JzEntity entity);
 
+    // ==================== Readiness Tracking ====================
+
+    void ConnectObservers(JzWorld &world);
+    void DisconnectObservers();
+    void OnAssetComponentChanged(entt::registry &registry, JzEntity entity);
+    void OnAssetLoadFinished(const JzAssetLoadResult &result);
+
+    template <typename T>
+    void WaitForAsset(JzAssetHandle<T> handle, JzEntity entity);
+    void WakeEntitiesWaitingOn(std::type_index type, JzAssetId id);
+
     // ==================== Hot Reload Internal ====================
 
-    void CheckForHotReloadUpdates(JzWorld &world);
-    void CheckShaderHotReload(JzWorld &world);
+    void CheckForHotReloadUpdates(JzWorld &world, Bool checkAll);
+    void CheckShaderHotReload(JzWorld &world, Bool checkAll);
+    Bool              HasChangedFile(const JzShader &shader) const;
+    Bool              WatchShaderFiles(const JzShader &shader);
+    JzFileWatchHandle WatchShaderDirectory(const std::filesystem::path &directory);
+    void              UnwatchAll();
     void NotifyShaderReloaded(JzShaderHandle handle, JzWorld &world);
 
     std::unordered_set<JzShaderHandle, JzAssetHandle<JzShader>::Hash>
@@ -346,6 +387,19 @@ private:
     Bool m_forceCheckNextFrame    = false;
     Size m_totalReloadCount       = 0;
     Size m_shaderReloadCount      = 0;
+
+    // Readiness tracking
+    using JzWaitingEntities = std::unordered_map<JzAssetId, std::unordered_set<JzEntity>, JzAssetId::Hash>;
+
+    JzWorld                                                *m_observedWorld = nullptr;
+    std::unordered_set<JzEntity>                           m_pendingEntities;
+    std::unordered_map<std::type_index, JzWaitingEntities> m_entitiesWaitingOnAsset; ///< Loading asset → entities
+
+    // File change notifications, used instead of polling when the service exists
+    JzFileWatcher                                *m_fileWatcher = nullptr;
+    std::unordered_map<String, JzFileWatchHandle> m_watchedDirectories;
+    std::unordered_set<String>                    m_changedFiles;
+    std::unordered_set<String>                    m_rescanDirectories;
 };
 
 } // namespace JzRE
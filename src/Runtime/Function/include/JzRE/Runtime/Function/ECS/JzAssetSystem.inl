@@ -22,13 +22,21 @@ void JzAssetSystem::RegisterFactory(std::unique_ptr<JzResourceFactory> factory)
 template <typename T>
 JzAssetHandle<T> JzAssetSystem::LoadSync(const String &path)
 {
-    return m_assetManager->LoadSync<T>(path);
+    auto handle = m_assetManager->LoadSync<T>(path);
+    if (handle.IsValid()) {
+        WakeEntitiesWaitingOn(std::type_index(typeid(T)), handle.GetId());
+    }
+    return handle;
 }
 
 template <typename T>
 JzAssetHandle<T> JzAssetSystem::GetOrLoad(const String &path)
 {
-    return m_assetManager->GetOrLoad<T>(path);
+    auto handle = m_assetManager->GetOrLoad<T>(path);
+    if (handle.IsValid()) {
+        WakeEntitiesWaitingOn(std::type_index(typeid(T)), handle.GetId());
+    }
+    return handle;
 }
 
 template <typename T>
@@ -110,4 +118,12 @@ void JzAssetSystem::Release(JzAssetHandle<T> handle)
     m_assetManager->Release(handle);
 }
 
+// ==================== Readiness Tracking ====================
+
+template <typename T>
+void JzAssetSystem::WaitForAsset(JzAssetHandle<T> handle, JzEntity entity)
+{
+    m_entitiesWaitingOnAsset[std::type_index(typeid(T))][handle.GetId()].insert(entity);
+}
+
 } // namespace JzRE
@@ -169,14 +169,94 @@ struct JzInputStateComponent {
     struct KeyboardState {
         static constexpr Size KEY_COUNT = 512;
 
-        std::bitset<KEY_COUNT> keysPressed;   ///< Keys currently held down
-        std::bitset<KEY_COUNT> keysDown;      ///< Keys pressed this frame
-        std::bitset<KEY_COUNT> keysUp;        ///< Keys released this frame
-        std::bitset<KEY_COUNT> keysRepeating; ///< Keys repeating (held)
+        std::bitset<KEY_COUNT> keysPressed;          ///< Keys currently held down
+        std::bitset<KEY_COUNT> keysDown;             ///< Keys pressed this frame
+        std::bitset<KEY_COUNT> keysUp;               ///< Keys released this frame
+        std::bitset<KEY_COUNT> keysRepeating;        ///< Keys repeating (held)
+        std::bitset<KEY_COUNT> keysHeldAtFrameStart; ///< Held state before the first edge, valid for changedKeys
+
+        std::vector<U16> changedKeys; ///< Keys with an edge bit set this frame
 
         String textBuffer;              ///< Text input buffer
         Bool   textInputEnabled{false}; ///< Whether text input mode is active
 
+        /**
+         * @brief Apply a key callback action
+         *
+         * Actions are applied in arrival order, so a press and a release
+         * within one frame both raise their edge bit.
+         *
+         * @param key GLFW key code
+         * @param action 0=release, 1=press, 2=repeat
+         *
+         * @return True if the key state changed
+         */
+        Bool ApplyKeyAction(I32 key, I32 action)
+        {
+            if (key < 0 || key >= static_cast<I32>(KEY_COUNT)) {
+                return false;
+            }
+
+            const Size index     = static_cast<Size>(key);
+            const Bool firstEdge = !keysDown[index] && !keysUp[index] && !keysRepeating[index];
+            const Bool wasHeld   = keysPressed[index];
+            switch (action) {
+                case 1:
+                    if (keysPressed[index]) {
+                        return false;
+                    }
+                    keysPressed.set(index);
+                    keysDown.set(index);
+                    break;
+                case 0:
+                    if (!keysPressed[index]) {
+                        return false;
+                    }
+                    keysPressed.reset(index);
+                    keysUp.set(index);
+                    break;
+                case 2:
+                    keysPressed.set(index);
+                    keysRepeating.set(index);
+                    break;
+                default:
+                    return false;
+            }
+
+            if (firstEdge) {
+                keysHeldAtFrameStart[index] = wasHeld;
+                changedKeys.push_back(static_cast<U16>(key));
+            }
+            return true;
+        }
+
+        /**
+         * @brief Get the press and release edges of a key in arrival order
+         *
+         * The edge bits alone cannot tell press, release, press from release,
+         * press, so the order is rebuilt from the state before the first edge
+         * and the state now. Repeated taps within a frame collapse to at most
+         * three edges.
+         *
+         * @param key Key listed in changedKeys
+         * @param edges Receives true for a press and false for a release
+         *
+         * @return Number of edges written
+         */
+        U32 GetKeyEdges(U16 key, std::array<Bool, 3> &edges) const
+        {
+            U32  count = 0;
+            Bool held  = keysHeldAtFrameStart[key];
+            if (keysDown[key] && keysUp[key]) {
+                edges[count++] = !held;
+                edges[count++] = held;
+            }
+            if (held != keysPressed[key]) {
+                edges[count++] = keysPressed[key];
+            }
+            return count;
+        }
+
         Bool IsKeyPressed(I32 key) const
         {
             return key >= 0 && key < static_cast<I32>(KEY_COUNT) && keysPressed[static_cast<Size>(key)];
@@ -214,9 +294,12 @@ struct JzInputStateComponent {
 
         void ClearFrameState()
         {
-            keysDown.reset();
-            keysUp.reset();
-            keysRepeating.reset();
+            for (U16 key : changedKeys) {
+                keysDown.reset(key);
+                keysUp.reset(key);
+                keysRepeating.reset(key);
+            }
+            changedKeys.clear();
             textBuffer.clear();
         }
     } keyboard;
@@ -230,9 +313,12 @@ struct JzInputStateComponent {
         JzVec2 scrollDelta{0.0f, 0.0f};   ///< Scroll wheel delta
         JzVec2 lastPosition{0.0f, 0.0f};  ///< Previous frame position
 
-        std::bitset<BUTTON_COUNT> buttonsPressed; ///< Buttons currently held
-        std::bitset<BUTTON_COUNT> buttonsDown;    ///< Buttons pressed this frame
-        std::bitset<BUTTON_COUNT> buttonsUp;      ///< Buttons released this frame
+        std::bitset<BUTTON_COUNT> buttonsPressed;          ///< Buttons currently held
+        std::bitset<BUTTON_COUNT> buttonsDown;             ///< Buttons pressed this frame
+        std::bitset<BUTTON_COUNT> buttonsUp;               ///< Buttons released this frame
+        std::bitset<BUTTON_COUNT> buttonsHeldAtFrameStart; ///< Held state before the first edge, valid for changedButtons
+
+        std::vector<U8> changedButtons; ///< Buttons with an edge bit set this frame
 
         /**
          * @brief Mouse cursor mode
@@ -260,6 +346,66 @@ struct JzInputStateComponent {
             return button >= 0 && button < static_cast<I32>(BUTTON_COUNT) && buttonsUp[static_cast<Size>(button)];
         }
 
+        /**
+         * @brief Apply a mouse button callback action
+         *
+         * Actions are applied in arrival order, like KeyboardState::ApplyKeyAction.
+         *
+         * @param button GLFW mouse button
+         * @param action 0=release, 1=press
+         *
+         * @return True if the button state changed
+         */
+        Bool ApplyButtonAction(I32 button, I32 action)
+        {
+            if (button < 0 || button >= static_cast<I32>(BUTTON_COUNT)) {
+                return false;
+            }
+
+            const Size index     = static_cast<Size>(button);
+            const Bool firstEdge = !buttonsDown[index] && !buttonsUp[index];
+            const Bool wasHeld   = buttonsPressed[index];
+            if (action == 1 && !wasHeld) {
+                buttonsPressed.set(index);
+                buttonsDown.set(index);
+            } else if (action == 0 && wasHeld) {
+                buttonsPressed.reset(index);
+                buttonsUp.set(index);
+            } else {
+                return false;
+            }
+
+            if (firstEdge) {
+                buttonsHeldAtFrameStart[index] = wasHeld;
+                changedButtons.push_back(static_cast<U8>(button));
+            }
+            return true;
+        }
+
+        /**
+         * @brief Get the press and release edges of a button in arrival order
+         *
+         * Same reconstruction as KeyboardState::GetKeyEdges.
+         *
+         * @param button Button listed in changedButtons
+         * @param edges Receives true for a press and false for a release
+         *
+         * @return Number of edges written
+         */
+        U32 GetButtonEdges(U8 button, std::array<Bool, 3> &edges) const
+        {
+            U32  count = 0;
+            Bool held  = buttonsHeldAtFrameStart[button];
+            if (buttonsDown[button] && buttonsUp[button]) {
+                edges[count++] = !held;
+                edges[count++] = held;
+            }
+            if (held != buttonsPressed[button]) {
+                edges[count++] = buttonsPressed[button];
+            }
+            return count;
+        }
+
         Bool IsButtonPressed(JzEMouseButton button) const
         {
             return IsButtonPressed(static_cast<I32>(button));
@@ -279,6 +425,7 @@ struct JzInputStateComponent {
         {
             buttonsDown.reset();
             buttonsUp.reset();
+            changedButtons.clear();
             positionDelta = {0.0f, 0.0f};
             scrollDelta   = {0.0f, 0.0f};
             entered       = false;
@@ -337,8 +484,14 @@ struct JzInputStateComponent {
         keyboard.ClearFrameState();
         mouse.ClearFrameState();
         gamepad.ClearFrameState();
+        changed = false;
     }
 
+    /**
+     * @brief Any key, button, cursor or scroll change since the last ClearFrameState
+     */
+    Bool changed{false};
+
     /**
      * @brief First frame flag for delta calculation
      */
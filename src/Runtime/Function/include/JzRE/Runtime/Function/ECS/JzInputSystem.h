@@ -5,7 +5,6 @@
 
 #pragma once
 
-#include <bitset>
 #include "JzRE/Runtime/Core/JzRETypes.h"
 #include "JzRE/Runtime/Function/ECS/JzSystem.h"
 #include "JzRE/Runtime/Function/ECS/JzWorld.h"
@@ -70,6 +69,8 @@ private:
 
     /**
      * @brief Sync higher-level input components from JzInputStateComponent.
+     *
+     * Skipped on frames where the input state did not change.
      */
     void SyncLegacyComponentsFromInputState(JzWorld &world);
 
@@ -92,16 +93,18 @@ private:
     /**
      * @brief Emit keyboard key events through the event dispatcher.
      *
-     * Diffs current keysPressed vs previous frame to emit
-     * JzKeyEvent with Pressed/Released action.
+     * Walks the keyboard delta list and emits JzKeyEvent with
+     * Pressed/Released action for each edge raised this frame, in the
+     * order given by KeyboardState::GetKeyEdges.
      */
     void EmitKeyboardEvents(JzWorld &world);
 
     /**
      * @brief Emit mouse events through the event dispatcher.
      *
-     * Emits JzMouseButtonEvent on button state changes,
-     * JzMouseMoveEvent on movement, JzMouseScrollEvent on scroll.
+     * Emits JzMouseButtonEvent for each button edge in the order given by
+     * MouseState::GetButtonEdges, JzMouseMoveEvent on movement and
+     * JzMouseScrollEvent on scroll.
      */
     void EmitMouseEvents(JzWorld &world);
 
@@ -117,9 +120,8 @@ private:
     // Cached primary window entity for quick access
     JzEntity m_primaryWindowEntity{};
 
-    // Cached previous input state for event emission (change detection)
-    std::bitset<512> m_prevKeysPressed;
-    std::bitset<8>   m_prevButtonsPressed;
+    // Legacy components still hold last frame's edges and need one more sync
+    Bool m_legacySyncPending{true};
 };
 
 } // namespace JzRE
@@ -0,0 +1,79 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Function/ECS/JzSystem.h"
+#include "JzRE/Runtime/Function/ECS/JzWorld.h"
+
+namespace JzRE {
+
+/**
+ * @brief System that selects the mesh level of detail for each renderable.
+ *
+ * Projects each level's object-space error to screen pixels using the main
+ * camera and picks the coarsest level whose error stays under the pixel
+ * threshold. Switching to a coarser level requires the error to fall below
+ * a hysteresis band so that objects near a boundary do not flicker.
+ */
+class JzLODSystem : public JzSystem {
+public:
+    JzLODSystem() = default;
+
+    void OnInit(JzWorld &world) override;
+    void Update(JzWorld &world, F32 delta) override;
+
+    /**
+     * @brief LOD system runs in Culling phase.
+     */
+    JzSystemPhase GetPhase() const override
+    {
+        return JzSystemPhase::Culling;
+    }
+
+    /**
+     * @brief Set the maximum allowed projected error in pixels.
+     *
+     * @param pixels Error threshold in pixels.
+     */
+    void SetErrorThreshold(F32 pixels)
+    {
+        m_errorThreshold = pixels;
+    }
+
+    /**
+     * @brief Set the relative hysteresis band used when coarsening.
+     *
+     * @param hysteresis Fraction in [0, 1).
+     */
+    void SetHysteresis(F32 hysteresis)
+    {
+        m_hysteresis = hysteresis;
+    }
+
+    /**
+     * @brief Select a level from per-level errors and the current projection scale.
+     *
+     * @param lodErrors Object-space errors of levels 1..N (monotonically increasing).
+     * @param currentLod Level selected in the previous frame.
+     * @param pixelsPerUnit Screen pixels covered by one object-space unit.
+     * @param errorThreshold Maximum allowed projected error in pixels.
+     * @param hysteresis Relative band required before switching to a coarser level.
+     *
+     * @return U32 Selected level (0 = full detail).
+     */
+    static U32 SelectLOD(const std::vector<F32> &lodErrors, U32 currentLod, F32 pixelsPerUnit,
+                         F32 errorThreshold, F32 hysteresis);
+
+private:
+    F32 m_errorThreshold  = 1.0f;  ///< Allowed projected error in pixels
+    F32 m_hysteresis      = 0.25f; ///< Coarsening requires error <= threshold * (1 - hysteresis)
+    F32 m_minScreenRadius = 2.0f;  ///< Below this projected radius the coarsest level is used
+};
+
+} // namespace JzRE
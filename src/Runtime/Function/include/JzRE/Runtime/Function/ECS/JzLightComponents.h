@@ -7,6 +7,7 @@
 
 #include "JzRE/Runtime/Core/JzRETypes.h"
 #include "JzRE/Runtime/Core/JzVector.h"
+#include "JzRE/Runtime/Function/ECS/JzEntity.h"
 
 namespace JzRE {
 
@@ -50,6 +51,34 @@ struct JzSpotLightComponent {
     F32    range       = 10.0f;
     F32    innerCutoff = 12.5f; ///< Inner cone angle in degrees
     F32    outerCutoff = 17.5f; ///< Outer cone angle in degrees
+    Bool   castShadow  = false;
+};
+
+// ==================== Collected Light Data ====================
+
+/**
+ * @brief Light type enumeration.
+ */
+enum class JzELightType : U32 {
+    Directional = 0,
+    Point       = 1,
+    Spot        = 2
+};
+
+/**
+ * @brief Collected light data for rendering.
+ */
+struct JzLightData {
+    JzVec3       position;
+    JzVec3       direction;
+    JzVec3       color;
+    F32          intensity;
+    F32          range;
+    F32          innerCutoff;
+    F32          outerCutoff;
+    JzELightType type;
+    JzEntity     entity     = INVALID_ENTITY; ///< Source entity, keys cached shadow tiles
+    Bool         castShadow = false;
 };
 
 } // namespace JzRE
@@ -9,34 +9,12 @@
 
 #include "JzRE/Runtime/Core/JzRETypes.h"
 #include "JzRE/Runtime/Core/JzVector.h"
+#include "JzRE/Runtime/Function/ECS/JzLightComponents.h"
 #include "JzRE/Runtime/Function/ECS/JzSystem.h"
 #include "JzRE/Runtime/Function/ECS/JzWorld.h"
 
 namespace JzRE {
 
-/**
- * @brief Light type enumeration.
- */
-enum class JzELightType : U32 {
-    Directional = 0,
-    Point       = 1,
-    Spot        = 2
-};
-
-/**
- * @brief Collected light data for rendering.
- */
-struct JzLightData {
-    JzVec3       position;
-    JzVec3       direction;
-    JzVec3       color;
-    F32          intensity;
-    F32          range;
-    F32          innerCutoff;
-    F32          outerCutoff;
-    JzELightType type;
-};
-
 /**
  * @brief System that collects and prepares light data for the render system.
  *
@@ -0,0 +1,76 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Core/JzThreadPool.h"
+#include "JzRE/Runtime/Function/ECS/JzEntity.h"
+#include "JzRE/Runtime/Function/ECS/JzSystem.h"
+#include "JzRE/Runtime/Function/ECS/JzWorld.h"
+#include "JzRE/Runtime/Function/Rendering/JzOcclusionCuller.h"
+
+namespace JzRE {
+
+/**
+ * @brief System that hides renderables occluded from the main camera.
+ *
+ * Entities with JzOccluderTag are rasterized into a JzOcclusionCuller from
+ * their coarsest level of detail, then the bounding sphere of every
+ * renderable is tested against it. The result is written to
+ * JzMeshAssetComponent::occluded and skipped by the main camera's geometry
+ * pass; shadow passes and other cameras still draw everything.
+ */
+class JzOcclusionCullingSystem : public JzSystem {
+public:
+    JzOcclusionCullingSystem() = default;
+
+    void Update(JzWorld &world, F32 delta) override;
+    void OnShutdown(JzWorld &world) override;
+
+    /**
+     * @brief Occlusion culling system runs in Culling phase.
+     */
+    JzSystemPhase GetPhase() const override
+    {
+        return JzSystemPhase::Culling;
+    }
+
+    void SetSettings(const JzOcclusionSettings &settings)
+    {
+        m_culler.SetSettings(settings);
+    }
+
+    const JzOcclusionSettings &GetSettings() const
+    {
+        return m_culler.GetSettings();
+    }
+
+    /**
+     * @brief Occluder and test counts of the last update.
+     */
+    const JzOcclusionStats &GetStats() const
+    {
+        return m_culler.GetStats();
+    }
+
+    /**
+     * @brief Mark every renderable visible again, e.g. before disabling the system.
+     */
+    void ClearResults(JzWorld &world);
+
+private:
+    JzOcclusionCuller             m_culler;
+    std::unique_ptr<JzThreadPool> m_threadPool;
+
+    std::vector<JzEntity> m_candidates; ///< Renderables tested this update
+    std::vector<JzVec4>   m_spheres;    ///< World bounding sphere per candidate
+    std::vector<U8>       m_occluded;   ///< Test result per candidate
+};
+
+} // namespace JzRE
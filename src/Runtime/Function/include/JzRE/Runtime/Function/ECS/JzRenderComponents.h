@@ -10,6 +10,7 @@
 #include "JzRE/Runtime/Core/JzRETypes.h"
 #include "JzRE/Runtime/Core/JzVector.h"
 #include "JzRE/Runtime/Core/JzVertex.h"
+#include "JzRE/Runtime/Function/ECS/JzEntity.h"
 #include "JzRE/Runtime/Platform/RHI/JzGPUBufferObject.h"
 #include "JzRE/Runtime/Platform/RHI/JzGPUVertexArrayObject.h"
 #include "JzRE/Runtime/Platform/RHI/JzGPUTextureObject.h"
@@ -156,6 +157,37 @@ struct JzOverlayRenderTag { };
  */
 struct JzIsolatedRenderTag { };
 
+// ==================== Static Batching ====================
+
+/**
+ * @brief Merged geometry of static entities, created by JzStaticBatchSystem.
+ *
+ * The entity draws one world-space chunk with an identity transform.
+ */
+struct JzStaticBatchComponent {
+    std::vector<JzEntity> sources; ///< Entities whose meshes were merged into this chunk
+};
+
+/**
+ * @brief Marks a static entity whose mesh is drawn by a batch.
+ *
+ * Rendering and LOD selection skip these entities.
+ */
+struct JzStaticBatchMemberComponent {
+    JzEntity batch = INVALID_ENTITY;
+};
+
+// ==================== Occlusion Culling ====================
+
+/**
+ * @brief Marks an entity whose mesh hides what is behind it.
+ *
+ * JzOcclusionCullingSystem rasterizes its coarsest level of detail into the
+ * software depth buffer. Good occluders are large, solid and closed: walls,
+ * floors, terrain and buildings.
+ */
+struct JzOccluderTag { };
+
 /**
  * @brief Component for skybox
  */
@@ -14,11 +14,15 @@
 #include "JzRE/Runtime/Function/ECS/JzEntity.h"
 #include "JzRE/Runtime/Function/ECS/JzSystem.h"
 #include "JzRE/Runtime/Function/ECS/JzWorld.h"
+#include "JzRE/Runtime/Function/Rendering/JzGeometryPool.h"
+#include "JzRE/Runtime/Function/Rendering/JzIndirectDrawBatcher.h"
 #include "JzRE/Runtime/Function/Rendering/JzRenderGraph.h"
 #include "JzRE/Runtime/Function/Rendering/JzRenderGraphContribution.h"
 #include "JzRE/Runtime/Function/Rendering/JzRenderOutput.h"
+#include "JzRE/Runtime/Function/Rendering/JzRenderSnapshot.h"
 #include "JzRE/Runtime/Function/Rendering/JzRenderTarget.h"
 #include "JzRE/Runtime/Function/Rendering/JzRenderVisibility.h"
+#include "JzRE/Runtime/Function/Rendering/JzShadowAtlas.h"
 #include "JzRE/Runtime/Platform/RHI/JzRHIPipeline.h"
 
 namespace JzRE {
@@ -26,6 +30,7 @@ namespace JzRE {
 class JzAssetManager;
 class JzDevice;
 class JzRHICommandList;
+class JzShader;
 
 /**
  * @brief Enhanced render system that integrates with camera system.
@@ -36,6 +41,12 @@ class JzRHICommandList;
  * - RenderGraph pass recording and execution
  * - Rendering all entities with Transform + Mesh + Material components
  * - Blitting to screen for standalone runtime
+ *
+ * A frame is split into Extract (game thread, reads the world, render target
+ * records and contributions), PrepareFrame (needs the graphics context,
+ * resolves shaders) and Render (draws the published snapshot). Update runs all
+ * three back to back; the runtime's pipelined loop calls them separately so
+ * Render can run on the render thread.
  */
 class JzRenderSystem : public JzSystem {
 public:
@@ -56,6 +67,44 @@ public:
         return JzSystemPhase::Render;
     }
 
+    // ==================== Frame Stages ====================
+
+    /**
+     * @brief Copy render-relevant world state into the back snapshot.
+     *
+     * Reads transforms, mesh and material references, cameras, lights and the
+     * window state, and resolves the render target and contribution callbacks.
+     * Touches no GPU resources.
+     */
+    void Extract(JzWorld &world);
+
+    /**
+     * @brief Publish the snapshot written by the last Extract.
+     *
+     * Must not overlap Render.
+     */
+    void PublishSnapshot();
+
+    /**
+     * @brief Resolve the shaders used by the next Render.
+     *
+     * May load and compile shaders, so it needs the graphics context.
+     */
+    void PrepareFrame();
+
+    /**
+     * @brief Record and execute the render graph for the published snapshot.
+     *
+     * Reads only the snapshot, so it may run while the game thread updates
+     * the world and the render target list.
+     */
+    void Render();
+
+    /**
+     * @brief Get the snapshot the next Render will draw.
+     */
+    const JzRenderSnapshot &GetRenderSnapshot() const;
+
     // ==================== Framebuffer Management ====================
 
     /**
@@ -108,6 +157,29 @@ public:
      */
     void ClearGraphContributions();
 
+    /**
+     * @brief Enable multi-draw indirect submission for the geometry stage. On by default.
+     *
+     * Only takes effect when the device supports it and the standard shader
+     * provides indirect variants; otherwise the per-entity path is used.
+     */
+    void SetIndirectDrawEnabled(Bool enabled);
+
+    /**
+     * @brief Check if multi-draw indirect submission is requested.
+     */
+    Bool IsIndirectDrawEnabled() const;
+
+    /**
+     * @brief Configure the shadow atlas. A new atlas or tile size redraws every tile.
+     */
+    void SetShadowSettings(const JzShadowAtlasSettings &settings);
+
+    /**
+     * @brief Get the shadow atlas configuration.
+     */
+    const JzShadowAtlasSettings &GetShadowSettings() const;
+
     // ==================== Render Target Registration ====================
 
     /**
@@ -156,36 +228,59 @@ private:
     JzRenderOutput *GetDefaultRenderOutput() const;
 
     /**
-     * @brief Resolve the geometry rendering pipeline from cooked shader resources.
+     * @brief Load the standard shader, or nullptr if it is not compiled.
+     */
+    JzShader *ResolveStandardShader() const;
+
+    /**
+     * @brief Resolve the geometry rendering pipeline from the standard shader.
      */
     std::shared_ptr<JzRHIPipeline> ResolveGeometryPipeline() const;
 
     /**
      * @brief Execute the built-in geometry stage for a render target.
      *
-     * Directly performs BeginRenderTargetPass -> DrawVisibleEntities.
+     * Directly performs BeginRenderTargetPass -> DrawVisibleEntities, after
+     * binning the snapshot lights into the target's light clusters.
      * Does NOT call ExecuteContribution to avoid contribution dispatch logic.
      */
-    void ExecuteGeometryStage(JzWorld                       &world,
+    void ExecuteGeometryStage(const JzRenderSnapshot        &snapshot,
                               const JzRGPassContext         &passContext,
                               JzEntity                       camera,
                               JzRenderVisibility             visibility,
-                              std::shared_ptr<JzRHIPipeline> geometryPipeline);
+                              std::shared_ptr<JzRHIPipeline> geometryPipeline,
+                              JzClusteredLighting           *lighting);
+
+    /**
+     * @brief Plan the frame's shadow views and add one pass per atlas tile to redraw.
+     *
+     * @return The atlas texture, or an empty handle when nothing casts shadows
+     */
+    JzRGTexture AddShadowPasses(const JzRenderSnapshot &snapshot, std::shared_ptr<JzRHIPipeline> geometryPipeline);
+
+    /**
+     * @brief Clear one shadow tile and draw its casters with the geometry pipeline.
+     */
+    void ExecuteShadowStage(const JzRenderSnapshot &snapshot, const JzRGPassContext &passContext, U32 viewIndex,
+                            std::shared_ptr<JzRHIPipeline> pipeline);
 
     /**
      * @brief Execute one contribution for a render target.
      */
-    void ExecuteContribution(JzWorld                         &world,
+    void ExecuteContribution(const JzRenderSnapshot          &snapshot,
                              const JzRGPassContext           &passContext,
-                             JzEntity                         camera,
-                             JzRenderVisibility               visibility,
-                             JzRenderTargetFeatures           targetFeatures,
+                             const JzRenderSnapshotTarget    &target,
                              const JzRenderGraphContribution &contribution);
 
+    /**
+     * @brief Blit a render output to the screen at its own size.
+     */
+    void BlitOutputToScreen(const JzRenderOutput &output, U32 screenWidth, U32 screenHeight);
+
     /**
      * @brief Resolve camera matrices and clear color for the current target.
      */
-    void ResolveCameraFrameData(JzWorld &world, JzEntity preferredCamera,
+    void ResolveCameraFrameData(const JzRenderSnapshot &snapshot, JzEntity preferredCamera,
                                 JzMat4 &viewMatrix, JzMat4 &projectionMatrix,
                                 JzVec3 &clearColor) const;
 
@@ -207,21 +302,53 @@ private:
 
     /**
      * @brief Render entities for a visibility mask.
+     *
+     * @param drawIndices Snapshot draws to consider, or nullptr for all of them
      */
-    void DrawVisibleEntities(JzWorld &world, JzRHICommandList &commandList,
+    void DrawVisibleEntities(const JzRenderSnapshot &snapshot, JzRHICommandList &commandList,
                              JzRenderVisibility visibility,
-                             std::shared_ptr<JzRHIPipeline> pipeline);
+                             std::shared_ptr<JzRHIPipeline> pipeline,
+                             const std::vector<U32>        *drawIndices = nullptr);
+
+    /**
+     * @brief Render entities for a visibility mask with multi-draw indirect submission.
+     *
+     * Meshes are drawn from the shared geometry pool, one indirect command per
+     * material texture set.
+     *
+     * @param drawIndices Snapshot draws to consider, or nullptr for all of them
+     *
+     * @return Bool False if the indirect path is unavailable and the caller should fall back.
+     */
+    Bool DrawVisibleEntitiesIndirect(const JzRenderSnapshot &snapshot, JzRHICommandList &commandList,
+                                     JzRenderVisibility visibility,
+                                     const JzMat4 &viewMatrix, const JzMat4 &projectionMatrix,
+                                     const JzClusteredLighting *lighting,
+                                     const std::vector<U32>    *drawIndices = nullptr);
 
     /**
      * @brief Draw a single renderable entity with the geometry pipeline.
      */
-    void DrawEntity(JzWorld &world, JzRHICommandList &commandList, JzEntity entity,
+    void DrawEntity(JzRHICommandList &commandList, const JzRenderSnapshotDraw &draw,
                     std::shared_ptr<JzRHIPipeline> pipeline);
 
     /**
-     * @brief Check if an entity should be rendered by the current visibility mask.
+     * @brief Resolve the diffuse, normal and specular textures of a draw. Missing ones stay null.
+     */
+    JzDrawTextureSet ResolveDrawTextures(JzAssetManager &assetManager, const JzRenderSnapshotDraw &draw) const;
+
+    /**
+     * @brief Bind a draw's material textures and set the matching sampler uniforms.
+     *
+     * Shared by the per-entity and indirect paths so both sample the same maps.
+     */
+    void BindDrawTextures(JzRHICommandList &commandList, JzRHIPipeline &pipeline,
+                          const JzDrawTextureSet &textures) const;
+
+    /**
+     * @brief Get the render channel an entity belongs to, from its render tags.
      */
-    Bool IsEntityVisible(JzWorld &world, JzEntity entity, JzRenderVisibility visibility) const;
+    JzRenderVisibility ResolveRenderChannel(JzWorld &world, JzEntity entity) const;
 
     /**
      * @brief Check if a contribution should run for a target feature mask.
@@ -242,6 +369,11 @@ private:
     void CleanupResources();
 
 private:
+    // Material texture units; 1-3 belong to clustered lighting and 4-5 to the shadow atlas
+    static constexpr U32 DiffuseTextureSlot  = 0;
+    static constexpr U32 NormalTextureSlot   = 6;
+    static constexpr U32 SpecularTextureSlot = 7;
+
     JzIVec2 m_frameSize{1280, 720};
     Bool    m_frameSizeChanged = true;
     Bool    m_isInitialized    = false;
@@ -252,6 +384,14 @@ private:
 
     JzRenderGraph                          m_renderGraph;
     std::vector<JzRenderGraphContribution> m_graphContributions;
+
+    JzGeometryPool m_geometryPool;
+    Bool           m_indirectDrawEnabled = true;
+    JzShadowAtlas  m_shadowAtlas;
+
+    JzRenderSnapshotBuffer         m_snapshots;
+    JzShader                      *m_standardShader = nullptr;
+    std::shared_ptr<JzRHIPipeline> m_geometryPipeline;
 };
 
 } // namespace JzRE
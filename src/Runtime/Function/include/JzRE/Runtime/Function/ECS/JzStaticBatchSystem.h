@@ -0,0 +1,88 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <unordered_set>
+#include <vector>
+
+#include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Function/ECS/JzEntity.h"
+#include "JzRE/Runtime/Function/ECS/JzSystem.h"
+#include "JzRE/Runtime/Function/ECS/JzWorld.h"
+#include "JzRE/Runtime/Function/Rendering/JzStaticBatcher.h"
+
+namespace JzRE {
+
+/**
+ * @brief System that merges static entities into batched world-space chunks.
+ *
+ * Entities with JzStaticTag, a mesh and a material are grouped by material
+ * and render channel and merged with JzStaticBatcher once all of their assets
+ * are ready. Every chunk becomes a batch entity with its own mesh asset and
+ * world bounds; the merged entities get JzStaticBatchMemberComponent so
+ * rendering and LOD selection skip them, and no longer touch their transforms.
+ *
+ * A batch is dissolved and its remaining entities batched again when one of
+ * them is destroyed, moved, loses JzStaticTag or its assets. A move is seen
+ * through PatchComponent() or the transform's dirty flag.
+ */
+class JzStaticBatchSystem : public JzSystem {
+public:
+    JzStaticBatchSystem() = default;
+
+    void OnInit(JzWorld &world) override;
+    void Update(JzWorld &world, F32 delta) override;
+    void OnShutdown(JzWorld &world) override;
+
+    /**
+     * @brief Static batching creates GPU meshes, so it runs in RenderPrep phase.
+     */
+    JzSystemPhase GetPhase() const override
+    {
+        return JzSystemPhase::RenderPrep;
+    }
+
+    /**
+     * @brief Configure chunking. Takes effect on the next Rebuild().
+     */
+    void SetSettings(const JzStaticBatchSettings &settings)
+    {
+        m_settings = settings;
+    }
+
+    const JzStaticBatchSettings &GetSettings() const
+    {
+        return m_settings;
+    }
+
+    /**
+     * @brief Dissolve every batch and merge the static entities again on the next update.
+     */
+    void Rebuild(JzWorld &world);
+
+private:
+    void ConnectObservers(JzWorld &world);
+    void DisconnectObservers();
+    void OnStaticEntityChanged(entt::registry &registry, JzEntity entity);
+    void OnMemberChanged(entt::registry &registry, JzEntity entity);
+    void OnTransformChanged(entt::registry &registry, JzEntity entity);
+    void OnBatchRemoved(entt::registry &registry, JzEntity entity);
+
+    void DissolveBatch(JzWorld &world, JzEntity batch);
+    void BuildBatches(JzWorld &world);
+
+private:
+    JzStaticBatchSettings m_settings;
+    JzWorld              *m_observedWorld = nullptr;
+    Bool                  m_scanPending   = true;
+    Bool                  m_dissolving    = false;
+    U32                   m_nextBatchId   = 0;
+
+    std::unordered_set<JzEntity> m_dirtyBatches;    ///< Batches to dissolve on the next update
+    std::vector<JzEntity>        m_orphanedMembers; ///< Members of batches destroyed from outside
+};
+
+} // namespace JzRE
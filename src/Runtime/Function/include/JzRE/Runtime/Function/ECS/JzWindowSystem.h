@@ -245,7 +245,6 @@ private:
     // Cached previous window state for event emission (change detection)
     JzIVec2 m_prevSize{0, 0};
     JzIVec2 m_prevPosition{0, 0};
-    JzVec2  m_pendingScrollDelta{0.0f, 0.0f};
     Bool    m_prevFocused{false};
     Bool    m_prevMinimized{false};
     Bool    m_prevMaximized{false};
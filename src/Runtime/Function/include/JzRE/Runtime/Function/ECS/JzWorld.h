@@ -6,6 +6,7 @@
 #pragma once
 
 #include <memory>
+#include <string_view>
 #include <vector>
 #include <entt/entt.hpp>
 #include "JzRE/Runtime/Core/JzRETypes.h"
@@ -14,6 +15,20 @@
 
 namespace JzRE {
 
+/**
+ * @brief Components a view must not have, see JzWorld::View.
+ */
+template <typename... Components>
+inline constexpr entt::exclude_t<Components...> JzExclude{};
+
+/**
+ * @brief Duration of a system's most recent update.
+ */
+struct JzSystemTiming {
+    std::string_view name;             ///< System type name, as used for profiler zones.
+    U64              lastUpdateNs = 0; ///< Zero until the system ran with timing enabled.
+};
+
 /**
  * @brief The EnTT-based World class that manages entities, components, and systems.
  *
@@ -206,6 +221,69 @@ public:
     template <typename... Components>
     auto View() const;
 
+    /**
+     * @brief Creates a view over entities with Components and none of Excludes.
+     *
+     * @code
+     * for (auto entity : world.View<JzTransformComponent>(JzExclude<JzStaticTag>)) { ... }
+     * @endcode
+     */
+    template <typename... Components, typename... Excludes>
+    auto View(entt::exclude_t<Excludes...> excludes);
+
+    /**
+     * @brief Creates a view with excluded components (const version).
+     */
+    template <typename... Components, typename... Excludes>
+    auto View(entt::exclude_t<Excludes...> excludes) const;
+
+    // ==================== Component Observers ====================
+
+    /**
+     * @brief Sink notified after a component of type T is added to an entity.
+     *
+     * Listeners take (entt::registry &, JzEntity), e.g.
+     * world.OnConstruct<T>().connect<&MySystem::OnAdded>(system).
+     *
+     * @tparam T The component type.
+     *
+     * @return An EnTT sink to connect listeners to.
+     */
+    template <typename T>
+    auto OnConstruct();
+
+    /**
+     * @brief Sink notified after a component of type T is replaced or patched.
+     *
+     * @tparam T The component type.
+     *
+     * @return An EnTT sink to connect listeners to.
+     */
+    template <typename T>
+    auto OnUpdate();
+
+    /**
+     * @brief Sink notified before a component of type T is removed.
+     *
+     * @tparam T The component type.
+     *
+     * @return An EnTT sink to connect listeners to.
+     */
+    template <typename T>
+    auto OnDestroy();
+
+    /**
+     * @brief Modifies a component in place and notifies OnUpdate listeners.
+     *
+     * @tparam T The component type.
+     * @param entity The entity owning the component.
+     * @param func Callables invoked with the component.
+     *
+     * @return A reference to the patched component.
+     */
+    template <typename T, typename... Func>
+    decltype(auto) PatchComponent(JzEntity entity, Func &&...func);
+
     // ==================== Context Management ====================
 
     /**
@@ -313,6 +391,18 @@ public:
      */
     void Update(F32 delta);
 
+    /**
+     * @brief Updates the registered systems whose phase lies in [first, last].
+     *
+     * Systems still run in registration order. Used by the pipelined runtime
+     * loop to split a frame around the render thread.
+     *
+     * @param delta The delta time since the last frame.
+     * @param first The first phase to run.
+     * @param last The last phase to run.
+     */
+    void Update(F32 delta, JzSystemPhase first, JzSystemPhase last);
+
     /**
      * @brief Shutdown all registered systems and release their references.
      *
@@ -322,9 +412,39 @@ public:
      */
     void ShutdownSystems();
 
+    /**
+     * @brief Enable recording of per-system update times.
+     *
+     * Off by default; when enabled every system update reads the clock twice.
+     */
+    void SetSystemTimingEnabled(Bool enabled);
+
+    /**
+     * @brief Get the last update time of every registered system, in registration order.
+     */
+    const std::vector<JzSystemTiming> &GetSystemTimings() const;
+
+    /**
+     * @brief Record the update time of a system the runtime drives outside Update.
+     *
+     * Used for the render system in the pipelined loop, whose stages run at
+     * the sync point and on the render thread. Ignored while timing is
+     * disabled or if the system is not registered.
+     */
+    void RecordSystemTiming(const JzSystem &system, U64 updateNs);
+
+private:
+    /**
+     * @brief Update one system inside its profiler zone.
+     */
+    void UpdateSystem(Size index, F32 delta);
+
 private:
-    entt::registry                         m_registry; ///< The EnTT registry holding all entities and components.
-    std::vector<std::shared_ptr<JzSystem>> m_systems;  ///< Registered systems.
+    entt::registry                         m_registry;                    ///< The EnTT registry holding all entities and components.
+    std::vector<std::shared_ptr<JzSystem>> m_systems;                     ///< Registered systems.
+    std::vector<std::string_view>          m_systemNames;                 ///< Profiler zone names, parallel to m_systems.
+    std::vector<JzSystemTiming>            m_systemTimings;               ///< Last update times, parallel to m_systems.
+    Bool                                   m_systemTimingEnabled = false; ///< Whether UpdateSystem records m_systemTimings.
 };
 
 } // namespace JzRE
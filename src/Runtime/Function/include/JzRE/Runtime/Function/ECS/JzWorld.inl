@@ -83,6 +83,44 @@ auto JzWorld::View() const
     return m_registry.view<Components...>();
 }
 
+template <typename... Components, typename... Excludes>
+auto JzWorld::View(entt::exclude_t<Excludes...> excludes)
+{
+    return m_registry.view<Components...>(excludes);
+}
+
+template <typename... Components, typename... Excludes>
+auto JzWorld::View(entt::exclude_t<Excludes...> excludes) const
+{
+    return m_registry.view<Components...>(excludes);
+}
+
+// ==================== Component Observers ====================
+
+template <typename T>
+auto JzWorld::OnConstruct()
+{
+    return m_registry.on_construct<T>();
+}
+
+template <typename T>
+auto JzWorld::OnUpdate()
+{
+    return m_registry.on_update<T>();
+}
+
+template <typename T>
+auto JzWorld::OnDestroy()
+{
+    return m_registry.on_destroy<T>();
+}
+
+template <typename T, typename... Func>
+decltype(auto) JzWorld::PatchComponent(JzEntity entity, Func &&...func)
+{
+    return m_registry.patch<T>(entity, std::forward<Func>(func)...);
+}
+
 // ==================== Context Management ====================
 
 template <typename T, typename... Args>
@@ -136,6 +174,8 @@ std::shared_ptr<T> JzWorld::RegisterSystem(Args &&...args)
     static_assert(std::is_base_of_v<JzSystem, T>, "T must derive from JzSystem");
     auto system = std::make_shared<T>(std::forward<Args>(args)...);
     m_systems.push_back(system);
+    m_systemNames.push_back(entt::type_id<T>().name());
+    m_systemTimings.push_back({m_systemNames.back(), 0});
     return system;
 }
 
@@ -0,0 +1,209 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "JzRE/Runtime/Core/JzLogger.h"
+#include "JzRE/Runtime/Core/JzMPSCQueue.h"
+#include "JzRE/Runtime/Function/Event/JzIEventHandler.h"
+
+namespace JzRE {
+
+/**
+ * @brief Type-erased view of a JzEventChannel used by JzEventSystem
+ */
+class JzIEventChannel {
+public:
+    virtual ~JzIEventChannel() = default;
+
+    /**
+     * @brief Move events sent from other threads into the pending buffer.
+     *
+     * @return Size Number of events moved, one send-order entry each.
+     */
+    virtual Size DrainRemote() = 0;
+
+    /**
+     * @brief Move delayed events into the pending buffer.
+     *
+     * @return Size Number of events moved.
+     */
+    virtual Size PromoteDelayed() = 0;
+
+    /**
+     * @brief Make the pending events the dispatch buffer and start a new pending buffer.
+     */
+    virtual void BeginDispatch() = 0;
+
+    /**
+     * @brief Deliver the next event of the dispatch buffer to every handler.
+     *
+     * @return Bool False if the channel has no handlers.
+     */
+    virtual Bool DispatchNext() = 0;
+
+    /**
+     * @brief Reset the dispatch buffer, keeping its capacity.
+     */
+    virtual void EndDispatch() = 0;
+
+    virtual Bool RemoveHandler(const JzIEventHandler *handler) = 0;
+
+    virtual Size GetHandlerCount() const = 0;
+};
+
+/**
+ * @brief Handlers and event storage of one event type.
+ *
+ * Handlers live in one array sorted by priority when they are registered
+ * (ascending, registration order within a priority). Events are stored by
+ * value in contiguous per-type buffers that are cleared, not freed, after
+ * every dispatch, so sending stops allocating once the buffers have grown to
+ * the frame's peak. Events from other threads go through a bounded lock-free
+ * queue; only when it is full do they fall back to a mutex-guarded overflow
+ * buffer.
+ */
+template <typename T>
+class JzEventChannel final : public JzIEventChannel {
+public:
+    /**
+     * @brief Cross-thread events buffered per type between two dispatches.
+     */
+    static constexpr Size RemoteCapacity = 256;
+
+    JzEventChannel() :
+        m_remote(RemoteCapacity) { }
+
+    JzEventHandler<T> *AddHandler(std::unique_ptr<JzEventHandler<T>> handler)
+    {
+        auto *ptr      = handler.get();
+        auto  position = std::upper_bound(m_handlers.begin(), m_handlers.end(), ptr->GetPriority(),
+                                          [](I32 priority, const auto &other) { return priority < other->GetPriority(); });
+        m_handlers.insert(position, std::move(handler));
+        return ptr;
+    }
+
+    Bool RemoveHandler(const JzIEventHandler *handler) override
+    {
+        const auto it = std::find_if(m_handlers.begin(), m_handlers.end(),
+                                     [handler](const auto &h) { return h.get() == handler; });
+        if (it == m_handlers.end()) {
+            return false;
+        }
+        m_handlers.erase(it);
+        return true;
+    }
+
+    Size GetHandlerCount() const override
+    {
+        return m_handlers.size();
+    }
+
+    /**
+     * @brief Queue an event on the owning thread.
+     */
+    template <typename U>
+    void Push(U &&event)
+    {
+        m_pending.emplace_back(std::forward<U>(event));
+    }
+
+    /**
+     * @brief Queue an event for the next dispatch, after the regular events.
+     */
+    template <typename U>
+    void PushDelayed(U &&event)
+    {
+        m_delayed.emplace_back(std::forward<U>(event));
+    }
+
+    /**
+     * @brief Queue an event from any thread.
+     */
+    template <typename U>
+    void PushRemote(U &&event)
+    {
+        // TryPush leaves the event untouched when the queue is full
+        if (m_remote.TryPush(std::forward<U>(event))) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_overflowMutex);
+        m_overflow.emplace_back(std::forward<U>(event));
+        m_hasOverflow.store(true, std::memory_order_release);
+    }
+
+    Size DrainRemote() override
+    {
+        const Size before = m_pending.size();
+
+        T event;
+        while (m_remote.TryPop(event)) {
+            m_pending.push_back(std::move(event));
+        }
+
+        if (m_hasOverflow.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(m_overflowMutex);
+            std::move(m_overflow.begin(), m_overflow.end(), std::back_inserter(m_pending));
+            m_overflow.clear();
+            m_hasOverflow.store(false, std::memory_order_relaxed);
+        }
+
+        return m_pending.size() - before;
+    }
+
+    Size PromoteDelayed() override
+    {
+        const Size count = m_delayed.size();
+        std::move(m_delayed.begin(), m_delayed.end(), std::back_inserter(m_pending));
+        m_delayed.clear();
+        return count;
+    }
+
+    void BeginDispatch() override
+    {
+        m_dispatching.swap(m_pending);
+        m_cursor = 0;
+    }
+
+    Bool DispatchNext() override
+    {
+        const T &event = m_dispatching[m_cursor++];
+        for (const auto &handler : m_handlers) {
+            try {
+                handler->Invoke(event);
+            } catch (const std::exception &e) {
+                JzRE_LOG_ERROR("Event handler error: {}", e.what());
+            }
+        }
+        return !m_handlers.empty();
+    }
+
+    void EndDispatch() override
+    {
+        m_dispatching.clear();
+        m_cursor = 0;
+    }
+
+private:
+    std::vector<std::unique_ptr<JzEventHandler<T>>> m_handlers;
+    std::vector<T>                                  m_pending;     ///< Sent since the last dispatch
+    std::vector<T>                                  m_dispatching; ///< Being delivered
+    std::vector<T>                                  m_delayed;
+    Size                                            m_cursor = 0;
+    JzMPSCQueue<T>                                  m_remote;
+    std::mutex                                      m_overflowMutex;
+    std::vector<T>                                  m_overflow;
+    std::atomic<Bool>                               m_hasOverflow{false};
+};
+
+} // namespace JzRE
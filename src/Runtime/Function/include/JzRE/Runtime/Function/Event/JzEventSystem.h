@@ -5,20 +5,51 @@
 
 #pragma once
 
-#include <algorithm>
-#include <map>
-#include <vector>
-#include <unordered_map>
+#include <array>
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
 #include "JzRE/Runtime/Function/ECS/JzSystem.h"
-#include "JzRE/Runtime/Function/Event/JzEventQueue.h"
+#include "JzRE/Runtime/Function/Event/JzEventChannel.h"
 #include "JzRE/Runtime/Function/Event/JzIEventHandler.h"
 #include "JzRE/Runtime/Core/JzLogger.h"
 
 namespace JzRE {
 
+/**
+ * @brief Dispatches ECS events through one channel per event type.
+ *
+ * Sending appends the event to its type's buffer and its type id to a send
+ * order list, so dispatch delivers events in the order they were sent and
+ * only visits the handlers registered for that type. Events sent from other
+ * threads than the one running the system go through the channel's lock-free
+ * queue and are dispatched at the next update. Events sent while dispatching
+ * are delivered in the same update.
+ *
+ * Handlers must be registered and removed on the owning thread, outside of
+ * dispatch.
+ */
 class JzEventSystem : public JzSystem {
 public:
+    /**
+     * @brief Maximum number of distinct event types.
+     */
+    static constexpr Size MaxEventTypes = 256;
+
+    JzEventSystem() :
+        m_ownerThread(std::this_thread::get_id()) { }
+
+    ~JzEventSystem() override
+    {
+        for (auto &channel : m_channels) {
+            delete channel.load(std::memory_order_acquire);
+        }
+    }
+
     void OnInit(JzWorld &world) override
     {
         // Initialization if needed
@@ -26,14 +57,7 @@ public:
 
     void Update(JzWorld &world, F32 delta) override
     {
-        // Process delayed events
-        ProcessDelayedEvents();
-
-        // Process global events
-        ProcessGlobalQueue();
-
-        // Dispatch to systems (if we were tracking other systems queues, but here we keep it simple for now as per design doc logic adapted)
-        DispatchToSystems();
+        DispatchEvents();
 
         // Update stats
         UpdateStats(delta);
@@ -48,22 +72,22 @@ public:
     template <typename T>
     JzEventHandler<T> *RegisterHandler(std::function<void(const T &)> handler, I32 priority = 0)
     {
-        auto  u32EventId   = JzECSEventType<T>::Id();
-        auto  eventHandler = std::make_unique<JzEventHandler<T>>(std::move(handler), priority);
-        auto *ptr          = eventHandler.get();
-
-        m_handlers[u32EventId].push_back(std::move(eventHandler));
-        m_priorityQueues[priority].push_back(ptr);
-
-        return ptr;
+        return GetChannel<T>().AddHandler(std::make_unique<JzEventHandler<T>>(std::move(handler), priority));
     }
 
     // Send Event
     template <typename T>
     void Send(T &&event)
     {
-        m_globalQueue.Push(std::forward<T>(event));
-        m_stats.eventsByType[JzECSEventType<T>::Id()]++;
+        using TEvent = std::decay_t<T>;
+
+        auto &channel = GetChannel<TEvent>();
+        if (IsOwnerThread()) {
+            channel.Push(std::forward<T>(event));
+            m_sendOrder.push_back(JzECSEventType<TEvent>::Id());
+        } else {
+            channel.PushRemote(std::forward<T>(event));
+        }
     }
 
     // Send to Entity
@@ -74,97 +98,115 @@ public:
         Send(std::forward<T>(event));
     }
 
-    // Delayed events simply pushed to a vector to be re-queued next frame
+    // Delayed events are dispatched at the next update. Owning thread only.
     template <typename T>
     void SendDelayed(T &&event, F32 delay = 0.0f)
     {
-        // Simple implementation: if delay <= 0, add to delayedEvents to process next frame
-        // Complex timed events not fully implemented to keep it simple, treating all delayed as "Next Frame" for now unless we add a specific timinq queue.
-        // Design doc uses TimeDelta.
-        m_delayedEvents.emplace_back(std::forward<T>(event));
+        using TEvent = std::decay_t<T>;
+
+        GetChannel<TEvent>().PushDelayed(std::forward<T>(event));
+        m_delayedOrder.push_back(JzECSEventType<TEvent>::Id());
     }
 
     void RemoveHandler(JzIEventHandler *handler)
     {
         if (!handler) return;
 
-        auto  u32EventId  = handler->GetEventType();
-        auto &handlerList = m_handlers[u32EventId];
-
-        handlerList.erase(std::remove_if(handlerList.begin(), handlerList.end(),
-                                         [handler](const auto &h) { return h.get() == handler; }),
-                          handlerList.end());
+        const U32 u32EventId = handler->GetEventType();
+        if (u32EventId >= MaxEventTypes) return;
 
-        // Also remove from priority queues
-        // This is slow (O(N)), but removal is rare.
-        for (auto &pair : m_priorityQueues) {
-            auto &vec = pair.second;
-            vec.erase(std::remove(vec.begin(), vec.end(), handler), vec.end());
+        if (auto *channel = m_channels[u32EventId].load(std::memory_order_acquire)) {
+            channel->RemoveHandler(handler);
         }
     }
 
-private:
-    void ProcessGlobalQueue()
+    /**
+     * @brief Deliver all queued events. Called by Update on the owning thread.
+     */
+    void DispatchEvents()
     {
-        std::vector<JzECSEventWrapper> events;
-        const size_t                   batchSize = 100;
+        m_ownerThread.store(std::this_thread::get_id(), std::memory_order_relaxed);
 
-        while (true) {
-            size_t count = m_globalQueue.PopBatch(events, batchSize);
-            if (count == 0) break;
+        const Size channelCount = m_channelCount.load(std::memory_order_acquire);
 
-            for (auto &event : events) {
-                ProcessSingleEvent(event);
+        // Delayed events follow the ones sent since the last update
+        for (Size id = 0; id < channelCount; ++id) {
+            if (auto *channel = m_channels[id].load(std::memory_order_acquire)) {
+                channel->PromoteDelayed();
             }
+        }
+        m_sendOrder.insert(m_sendOrder.end(), m_delayedOrder.begin(), m_delayedOrder.end());
+        m_delayedOrder.clear();
 
-            m_stats.eventsProcessed += count;
-            events.clear();
+        // Events from other threads have no order relative to this thread's
+        for (Size id = 0; id < channelCount; ++id) {
+            if (auto *channel = m_channels[id].load(std::memory_order_acquire)) {
+                m_sendOrder.insert(m_sendOrder.end(), channel->DrainRemote(), static_cast<U32>(id));
+            }
         }
-    }
 
-    void ProcessSingleEvent(const JzECSEventWrapper &event)
-    {
-        auto u32EventId = event.GetTypeId();
-        auto it         = m_handlers.find(u32EventId);
-
-        if (it != m_handlers.end()) {
-            // Process by priority
-            // Iterate priority map (ordered)
-            // std::map sorts by key ascending. Design doc uses priority. Usually higher number = higher priority?
-            // Or lower number? Design doc doesn't specify, but `return priority`.
-            // Standard: Higher is better, or Lower is earlier?
-            // Let's assume standard map iteration (ascending). So 0 first, then 1...
-            // If we want High Priority first, we should iterate reverse or use std::greater.
-            // But existing code uses `std::map<int, ...>`.
-            // I'll stick to map iteration order (ascending keys).
-            for (const auto &priorityGroup : m_priorityQueues) {
-                for (auto *handler : priorityGroup.second) {
-                    if (handler->GetEventType() == u32EventId) {
-                        try {
-                            handler->HandleEvent(event);
-                        } catch (const std::exception &e) {
-                            JzRE_LOG_ERROR("Event handler error: {}", e.what());
-                        }
-                    }
+        // Handlers may send more events; keep going until none are left
+        while (!m_sendOrder.empty()) {
+            m_dispatchOrder.swap(m_sendOrder);
+
+            const Size roundChannelCount = m_channelCount.load(std::memory_order_acquire);
+            for (Size id = 0; id < roundChannelCount; ++id) {
+                if (auto *channel = m_channels[id].load(std::memory_order_acquire)) {
+                    channel->BeginDispatch();
                 }
             }
-        } else {
-            m_stats.eventsDropped++;
+
+            for (const U32 u32EventId : m_dispatchOrder) {
+                if (!m_channels[u32EventId].load(std::memory_order_relaxed)->DispatchNext()) {
+                    m_stats.eventsDropped++;
+                }
+            }
+            m_stats.eventsProcessed += m_dispatchOrder.size();
+
+            for (Size id = 0; id < roundChannelCount; ++id) {
+                if (auto *channel = m_channels[id].load(std::memory_order_acquire)) {
+                    channel->EndDispatch();
+                }
+            }
+            m_dispatchOrder.clear();
         }
     }
 
-    void DispatchToSystems()
+    /**
+     * @brief Get the number of handlers registered for an event type.
+     */
+    template <typename T>
+    Size GetHandlerCount()
+    {
+        return GetChannel<T>().GetHandlerCount();
+    }
+
+private:
+    Bool IsOwnerThread() const
     {
-        // Placeholder: If systems have their own queues
-        // for (auto& [system, queue] : systemQueues_) ...
+        return m_ownerThread.load(std::memory_order_relaxed) == std::this_thread::get_id();
     }
 
-    void ProcessDelayedEvents()
+    template <typename T>
+    JzEventChannel<T> &GetChannel()
     {
-        for (auto &event : m_delayedEvents) {
-            m_globalQueue.PushWrapper(std::move(event));
+        const U32 u32EventId = JzECSEventType<T>::Id();
+        if (u32EventId >= MaxEventTypes) {
+            throw std::runtime_error("Too many event types for JzEventSystem");
+        }
+
+        JzIEventChannel *channel = m_channels[u32EventId].load(std::memory_order_acquire);
+        if (!channel) {
+            // Channels may be created by remote senders, so publish them with a CAS
+            auto created = std::make_unique<JzEventChannel<T>>();
+            if (m_channels[u32EventId].compare_exchange_strong(channel, created.get(), std::memory_order_acq_rel)) {
+                channel = created.release();
+
+                Size count = m_channelCount.load(std::memory_order_relaxed);
+                while (count < u32EventId + 1 && !m_channelCount.compare_exchange_weak(count, u32EventId + 1, std::memory_order_release)) { }
+            }
         }
-        m_delayedEvents.clear();
+        return *static_cast<JzEventChannel<T> *>(channel);
     }
 
     void UpdateStats(F32 delta)
@@ -179,15 +221,16 @@ private:
     }
 
 private:
-    std::unordered_map<U32, std::vector<std::unique_ptr<JzIEventHandler>>> m_handlers;
-    std::map<I32, std::vector<JzIEventHandler *>>                          m_priorityQueues;
-    JzEventQueue                                                           m_globalQueue;
-    std::vector<JzECSEventWrapper>                                         m_delayedEvents;
+    std::array<std::atomic<JzIEventChannel *>, MaxEventTypes> m_channels{}; ///< Indexed by JzECSEventType id
+    std::atomic<Size>                                          m_channelCount{0};
+    std::atomic<std::thread::id>                               m_ownerThread;
+    std::vector<U32>                                           m_sendOrder;     ///< Type id per event sent since the last round
+    std::vector<U32>                                           m_dispatchOrder; ///< Type id per event being delivered
+    std::vector<U32>                                           m_delayedOrder;
 
     struct Stats {
-        std::atomic<U64>             eventsProcessed{0};
-        std::atomic<U64>             eventsDropped{0};
-        std::unordered_map<U32, U64> eventsByType;
+        std::atomic<U64> eventsProcessed{0};
+        std::atomic<U64> eventsDropped{0};
     } m_stats;
 };
 
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <functional>
 #include "JzECSEvent.h"
 
 namespace JzRE {
@@ -14,10 +15,9 @@ namespace JzRE {
  */
 class JzIEventHandler {
 public:
-    virtual ~JzIEventHandler()                               = default;
-    virtual void HandleEvent(const JzECSEventWrapper &event) = 0;
-    virtual U32  GetEventType() const                        = 0;
-    virtual I32  GetPriority() const
+    virtual ~JzIEventHandler()           = default;
+    virtual U32 GetEventType() const     = 0;
+    virtual I32 GetPriority() const
     {
         return 0;
     }
@@ -35,11 +35,9 @@ public:
         m_handler(std::move(func)),
         m_priority(priority) { }
 
-    void HandleEvent(const JzECSEventWrapper &event) override
+    void Invoke(const T &event) const
     {
-        if (auto *typedEvent = event.As<T>()) {
-            m_handler(*typedEvent);
-        }
+        m_handler(event);
     }
 
     U32 GetEventType() const override
@@ -10,6 +10,7 @@
 #include "JzRE/Runtime/Core/JzPlatformEvent.h"
 #include "JzRE/Runtime/Core/JzPlatformEventQueue.h"
 #include "JzRE/Runtime/Function/ECS/JzEntity.h"
+#include "JzRE/Runtime/Function/ECS/JzInputComponents.h"
 #include "JzRE/Runtime/Function/Event/JzEventSystem.h"
 #include "JzRE/Runtime/Function/Event/JzInputEvents.h"
 #include "JzRE/Runtime/Function/Event/JzWindowEvents.h"
@@ -23,6 +24,8 @@ namespace JzRE {
  * This class bridges the Platform layer (no entity awareness) with the
  * Function layer ECS event system. It consumes events from JzPlatformEventQueue
  * and dispatches them as JzECSEvent-derived types through JzEventSystem.
+ * Key, button, scroll and cursor-enter events are also applied to the
+ * window's JzInputStateComponent in arrival order.
  */
 class JzPlatformEventAdapter {
 public:
@@ -30,15 +33,17 @@ public:
      * @brief Process all pending platform events and dispatch as ECS events.
      *
      * @param platformQueue Source queue from JzIWindowBackend
-     * @param dispatcher Target ECS event dispatcher
+     * @param dispatcher Target ECS event dispatcher (nullptr to skip dispatching)
      * @param windowEntity The window entity to use as source
+     * @param inputState Input state of the window (nullptr to skip)
      * @param maxEvents Maximum number of events to process per call (0 = unlimited)
      */
     void ProcessPlatformEvents(
-        JzPlatformEventQueue &platformQueue,
-        JzEventSystem        &dispatcher,
-        JzEntity              windowEntity,
-        size_t                maxEvents = 256)
+        JzPlatformEventQueue  &platformQueue,
+        JzEventSystem         *dispatcher,
+        JzEntity               windowEntity,
+        JzInputStateComponent *inputState,
+        size_t                 maxEvents = 256)
     {
         std::vector<JzPlatformEventWrapper> events;
         events.reserve(maxEvents > 0 ? maxEvents : 64);
@@ -46,11 +51,43 @@ public:
         size_t count = platformQueue.PopBatch(events, maxEvents > 0 ? maxEvents : SIZE_MAX);
 
         for (size_t i = 0; i < count; ++i) {
-            DispatchAsECSEvent(events[i], dispatcher, windowEntity);
+            if (inputState) {
+                ApplyToInputState(events[i], *inputState);
+            }
+            if (dispatcher) {
+                DispatchAsECSEvent(events[i], *dispatcher, windowEntity);
+            }
         }
     }
 
 private:
+    void ApplyToInputState(const JzPlatformEventWrapper &wrapper, JzInputStateComponent &input)
+    {
+        if (auto *platformEvent = wrapper.As<JzPlatformKeyEvent>()) {
+            input.changed |= input.keyboard.ApplyKeyAction(platformEvent->key, platformEvent->action);
+            return;
+        }
+
+        if (auto *platformEvent = wrapper.As<JzPlatformMouseButtonEvent>()) {
+            input.changed |= input.mouse.ApplyButtonAction(platformEvent->button, platformEvent->action);
+            return;
+        }
+
+        if (auto *platformEvent = wrapper.As<JzPlatformMouseScrollEvent>()) {
+            input.mouse.scrollDelta += platformEvent->offset;
+            input.changed            = true;
+            return;
+        }
+
+        if (auto *platformEvent = wrapper.As<JzPlatformMouseEnterEvent>()) {
+            if (platformEvent->entered) {
+                input.mouse.entered = true;
+                input.changed       = true;
+            }
+            return;
+        }
+    }
+
     void DispatchAsECSEvent(
         const JzPlatformEventWrapper &wrapper,
         JzEventSystem                &dispatcher,
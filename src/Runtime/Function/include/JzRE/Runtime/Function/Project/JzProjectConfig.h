@@ -90,6 +90,7 @@ struct JzProjectConfig {
     std::filesystem::path shaderSourceRoot{"Content/Shaders/src"};
     std::filesystem::path shaderCookedRoot{"Content/Shaders"};
     Bool                  shaderAutoCook{true};
+    std::filesystem::path textureCookedRoot{"Intermediate/CookedTextures"};
     std::filesystem::path buildOutput{"Build"};
 
     std::vector<JzImportRule> importRules;
@@ -155,6 +156,14 @@ struct JzProjectConfig {
         return rootPath / shaderCookedRoot;
     }
 
+    /**
+     * @brief Get the absolute cooked texture directory path.
+     */
+    [[nodiscard]] std::filesystem::path GetTextureCookedPath() const
+    {
+        return rootPath / textureCookedRoot;
+    }
+
     /**
      * @brief Get the absolute build output path.
      */
@@ -0,0 +1,156 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Core/JzThreadPool.h"
+#include "JzRE/Runtime/Platform/FileSystem/JzFileWatcher.h"
+
+namespace JzRE {
+
+/**
+ * @brief A file or directory known to the project file index
+ */
+struct JzProjectFileEntry {
+    String name;
+    Bool   isDirectory = false;
+    U64    size        = 0; ///< File size in bytes, 0 for directories
+    U64    revision    = 0; ///< Changes every time the file is modified
+};
+
+/**
+ * @brief Persistent index of the files under a project directory
+ *
+ * The tree is scanned once on a background thread; until the scan finishes
+ * the index reports not ready. Afterwards it is kept current from
+ * JzFileWatcher notifications (when that service is provided) or from
+ * changes passed to ApplyChanges, so a file change touches one directory
+ * listing instead of rescanning the project.
+ *
+ * Every directory keeps its entries sorted: subdirectories first, then
+ * files, each by case-insensitive name. All calls must come from one thread.
+ */
+class JzProjectFileIndex {
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param root The directory to index
+     */
+    explicit JzProjectFileIndex(const std::filesystem::path &root);
+
+    /**
+     * @brief Destructor, cancels a running scan
+     */
+    ~JzProjectFileIndex();
+
+    JzProjectFileIndex(const JzProjectFileIndex &)            = delete;
+    JzProjectFileIndex &operator=(const JzProjectFileIndex &) = delete;
+
+    /**
+     * @brief Start a full background scan, replacing the index when it completes.
+     *
+     * The first call also subscribes to the JzFileWatcher service if one is provided.
+     */
+    void Rebuild();
+
+    /**
+     * @brief Pick up the result of a finished background scan.
+     */
+    void Update();
+
+    /**
+     * @brief Apply file changes to the index. Changes outside the root are ignored.
+     *
+     * Changes that arrive during a background scan are kept and applied on top of its result.
+     *
+     * @param changes Changes with absolute, normalized paths
+     */
+    void ApplyChanges(const std::vector<JzFileChange> &changes);
+
+    /**
+     * @brief Whether a scan has completed
+     */
+    Bool IsReady() const
+    {
+        return m_ready;
+    }
+
+    /**
+     * @brief Whether a background scan is running
+     */
+    Bool IsBuilding() const
+    {
+        return m_buildResult.valid();
+    }
+
+    /**
+     * @brief Get the indexed root directory
+     */
+    const std::filesystem::path &GetRoot() const
+    {
+        return m_root;
+    }
+
+    /**
+     * @brief Get a counter that changes whenever the indexed tree changes
+     */
+    U64 GetVersion() const
+    {
+        return m_version;
+    }
+
+    /**
+     * @brief Get the sorted entries of a directory.
+     *
+     * @param directory Absolute, normalized directory path
+     *
+     * @return const std::vector<JzProjectFileEntry>* The entries, nullptr if the directory is not indexed
+     */
+    const std::vector<JzProjectFileEntry> *GetEntries(const std::filesystem::path &directory) const;
+
+    /**
+     * @brief Find the entry of a path.
+     *
+     * @param path Absolute, normalized path
+     *
+     * @return const JzProjectFileEntry* The entry, nullptr if the path is not indexed
+     */
+    const JzProjectFileEntry *Find(const std::filesystem::path &path) const;
+
+private:
+    using JzDirectoryMap = std::unordered_map<String, std::vector<JzProjectFileEntry>>;
+
+    static void ScanTree(const std::filesystem::path &directory, JzDirectoryMap &directories, const std::atomic<Bool> *cancel);
+    static Bool EntryLess(const JzProjectFileEntry &lhs, const JzProjectFileEntry &rhs);
+
+    void CancelBuild();
+    void ApplyChange(const JzFileChange &change);
+    void IndexPath(const std::filesystem::path &path);
+    void RemovePath(const std::filesystem::path &path);
+    Bool IsUnderRoot(const std::filesystem::path &path) const;
+
+private:
+    std::filesystem::path         m_root;
+    JzDirectoryMap                m_directories; ///< Keyed by normalized directory path
+    Bool                          m_ready        = false;
+    U64                           m_version      = 0;
+    U64                           m_nextRevision = 1;
+    std::unique_ptr<JzThreadPool> m_scanPool;
+    std::future<JzDirectoryMap>   m_buildResult;
+    std::atomic<Bool>             m_cancelBuild{false};
+    std::vector<JzFileChange>     m_pendingChanges; ///< Received while a scan runs
+    JzFileWatcher                *m_fileWatcher = nullptr;
+    JzFileWatchHandle             m_watchHandle = 0;
+};
+
+} // namespace JzRE
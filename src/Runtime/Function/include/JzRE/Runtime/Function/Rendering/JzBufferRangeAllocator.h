@@ -0,0 +1,87 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <map>
+#include <optional>
+
+#include "JzRE/Runtime/Core/JzRETypes.h"
+
+namespace JzRE {
+
+/**
+ * @brief First-fit sub-allocator for element ranges inside a shared GPU buffer.
+ *
+ * Only tracks offsets; the owner is responsible for the buffer itself. Freed
+ * ranges are merged with their neighbours so that long-running sessions do not
+ * fragment the buffer into unusable slivers.
+ */
+class JzBufferRangeAllocator {
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param capacity Number of elements managed by the allocator.
+     */
+    explicit JzBufferRangeAllocator(U64 capacity = 0);
+
+    /**
+     * @brief Allocate a contiguous range.
+     *
+     * @param count Number of elements.
+     *
+     * @return Offset of the range, or std::nullopt if no free range is large enough.
+     */
+    std::optional<U64> Allocate(U64 count);
+
+    /**
+     * @brief Return a range previously obtained from Allocate().
+     *
+     * @param offset Offset of the range.
+     * @param count Number of elements.
+     */
+    void Free(U64 offset, U64 count);
+
+    /**
+     * @brief Extend the managed capacity; the new tail becomes free.
+     *
+     * @param capacity New capacity, ignored if not larger than the current one.
+     */
+    void Grow(U64 capacity);
+
+    /**
+     * @brief Drop all allocations.
+     */
+    void Reset();
+
+    /**
+     * @brief Get the managed capacity.
+     */
+    U64 GetCapacity() const
+    {
+        return m_capacity;
+    }
+
+    /**
+     * @brief Get the number of allocated elements.
+     */
+    U64 GetUsed() const
+    {
+        return m_used;
+    }
+
+    /**
+     * @brief Get the size of the largest free range.
+     */
+    U64 GetLargestFreeRange() const;
+
+private:
+    std::map<U64, U64> m_freeRanges; ///< offset -> count
+    U64                m_capacity = 0;
+    U64                m_used     = 0;
+};
+
+} // namespace JzRE
@@ -0,0 +1,187 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "JzRE/Runtime/Core/JzMatrix.h"
+#include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Core/JzVector.h"
+#include "JzRE/Runtime/Function/ECS/JzLightComponents.h"
+#include "JzRE/Runtime/Function/Rendering/JzShadowAtlas.h"
+#include "JzRE/Runtime/Platform/RHI/JzGPUTextureObject.h"
+
+namespace JzRE {
+
+class JzDevice;
+class JzRHICommandList;
+class JzRHIPipeline;
+
+/**
+ * @brief Clustered forward light assignment for one camera.
+ *
+ * The view frustum is split into a grid of froxels: screen tiles in x/y and
+ * depth slices that grow exponentially for perspective cameras and linearly
+ * for orthographic ones. Point and spot lights are binned into the froxels
+ * they touch with four-wide sphere-vs-AABB and cone-vs-sphere tests;
+ * directional lights apply everywhere and are not binned.
+ *
+ * The result is uploaded as three float textures, which every backend can
+ * fetch from, including GLSL 330:
+ * - light data: TexelsPerLight RGBA32F texels per light row, directional lights first;
+ *   the last texel also carries the light's range of shadow views
+ * - cluster grid: RG32F (first index, light count) per froxel, x by y * z texels
+ * - light indices: R32F light rows, IndexTextureWidth texels per row
+ */
+class JzClusteredLighting {
+public:
+    static constexpr U32 DefaultClusterCountX = 16;
+    static constexpr U32 DefaultClusterCountY = 9;
+    static constexpr U32 DefaultClusterCountZ = 24;
+    static constexpr U32 TexelsPerLight       = 4;
+    static constexpr U32 IndexTextureWidth    = 1024;
+    static constexpr U32 MaxLights            = 8192;
+    static constexpr U32 MaxLightIndices      = IndexTextureWidth * 4096;
+
+    /**
+     * @brief Texture slots used by Bind(); slot 0 stays with the diffuse map.
+     */
+    static constexpr U32 LightDataSlot    = 1;
+    static constexpr U32 ClusterGridSlot  = 2;
+    static constexpr U32 LightIndicesSlot = 3;
+
+    JzClusteredLighting(U32 countX = DefaultClusterCountX, U32 countY = DefaultClusterCountY,
+                        U32 countZ = DefaultClusterCountZ);
+
+    /**
+     * @brief Assign lights to clusters for a camera. CPU only.
+     *
+     * Lights beyond MaxLights and list entries beyond MaxLightIndices are
+     * dropped with a warning.
+     *
+     * @param shadows Shadow views planned for the same light list, if any
+     */
+    void Build(const std::vector<JzLightData> &lights, const JzMat4 &viewMatrix, const JzMat4 &projectionMatrix,
+               const JzShadowAtlas *shadows = nullptr);
+
+    /**
+     * @brief Upload the last Build() to the light textures, growing them as needed.
+     */
+    void Upload(JzDevice &device);
+
+    /**
+     * @brief Bind the light textures and set the lighting uniforms of a pipeline.
+     */
+    void Bind(JzRHICommandList &commandList, JzRHIPipeline &pipeline) const;
+
+    /**
+     * @brief Release the light textures.
+     */
+    void Reset();
+
+    U32 GetClusterCountX() const
+    {
+        return m_countX;
+    }
+
+    U32 GetClusterCountY() const
+    {
+        return m_countY;
+    }
+
+    U32 GetClusterCountZ() const
+    {
+        return m_countZ;
+    }
+
+    /**
+     * @brief Flat cluster index, the same order as the cluster grid texture.
+     */
+    U32 GetClusterIndex(U32 x, U32 y, U32 z) const
+    {
+        return (z * m_countY + y) * m_countX + x;
+    }
+
+    /**
+     * @brief Light rows assigned to a cluster, ascending.
+     */
+    std::span<const U32> GetClusterLights(U32 clusterIndex) const;
+
+    /**
+     * @brief Depth slice containing a view-space distance, or -1 outside the grid.
+     */
+    I32 GetDepthSlice(F32 viewDepth) const;
+
+    /**
+     * @brief Number of light rows, directional lights first.
+     */
+    U32 GetLightCount() const
+    {
+        return m_lightCount;
+    }
+
+    U32 GetDirectionalLightCount() const
+    {
+        return m_directionalLightCount;
+    }
+
+    F32 GetNearPlane() const
+    {
+        return m_nearPlane;
+    }
+
+    F32 GetFarPlane() const
+    {
+        return m_farPlane;
+    }
+
+private:
+    void BuildClusterBounds(const JzMat4 &projectionMatrix);
+    void AssignLight(U32 lightRow, const JzLightData &light, const JzMat4 &viewMatrix);
+    void PackLight(U32 lightRow, const JzLightData &light, const JzShadowRange &shadow);
+    void BuildIndexLists();
+
+private:
+    U32 m_countX;
+    U32 m_countY;
+    U32 m_countZ;
+    U32 m_tileStride; ///< Clusters per depth slice, padded to a multiple of four
+
+    // Projection the bounds were built for, and its depth mapping
+    JzMat4 m_boundsProjection = JzMat4x4::Identity();
+    Bool   m_hasBounds        = false;
+    Bool   m_gridValid        = false; ///< False when the projection has no usable depth range
+    Bool   m_logarithmic      = true;
+    F32    m_nearPlane        = 0.0f;
+    F32    m_farPlane         = 0.0f;
+    F32    m_sliceScale       = 0.0f;
+    F32    m_sliceBias        = 0.0f;
+    JzVec3 m_viewPosition{0.0f, 0.0f, 0.0f};
+
+    // Structure-of-arrays cluster bounds in view space, m_tileStride entries per slice
+    std::vector<F32> m_minX, m_minY, m_minZ;
+    std::vector<F32> m_maxX, m_maxY, m_maxZ;
+    std::vector<F32> m_centerX, m_centerY, m_centerZ, m_radius;
+
+    U32              m_lightCount            = 0;
+    U32              m_directionalLightCount = 0;
+    std::vector<F32> m_lightTexels;
+    std::vector<U64> m_assignments; ///< (cluster << 32 | light row), in light order
+    std::vector<U32> m_clusterOffsets;
+    std::vector<U32> m_clusterCounts;
+    std::vector<U32> m_lightIndices;
+    std::vector<F32> m_clusterTexels;
+    std::vector<F32> m_indexTexels;
+    Bool             m_warnedOverflow = false;
+
+    std::shared_ptr<JzGPUTextureObject> m_lightTexture;
+    std::shared_ptr<JzGPUTextureObject> m_clusterTexture;
+    std::shared_ptr<JzGPUTextureObject> m_indexTexture;
+};
+
+} // namespace JzRE
@@ -0,0 +1,165 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Core/JzVertex.h"
+#include "JzRE/Runtime/Function/Rendering/JzBufferRangeAllocator.h"
+#include "JzRE/Runtime/Platform/Command/JzRHIDrawIndexedIndirectCommand.h"
+#include "JzRE/Runtime/Platform/RHI/JzGPUBufferObject.h"
+#include "JzRE/Runtime/Platform/RHI/JzGPUVertexArrayObject.h"
+#include "JzRE/Runtime/Resource/JzAssetHandle.h"
+
+namespace JzRE {
+
+class JzMesh;
+
+/**
+ * @brief Location of a mesh inside the shared geometry buffers.
+ */
+struct JzGeometryAllocation {
+    U32 firstIndex   = 0; ///< First index in the shared index buffer
+    U32 indexCount   = 0; ///< Number of indices
+    I32 vertexOffset = 0; ///< Base vertex added to every index
+    U32 vertexCount  = 0; ///< Number of vertices
+};
+
+/**
+ * @brief Per-draw data streamed as instance-rate vertex attributes.
+ *
+ * Each indirect draw uses its own index as firstInstance, so the vertex shader
+ * fetches the matching element without needing draw parameters or storage buffers.
+ */
+struct JzGeometryInstanceData {
+    F32 modelRows[16];    ///< Row-major world matrix
+    F32 diffuseColor[4];  ///< Material diffuse color (rgb) and padding
+    F32 ambientColor[4];  ///< Material ambient color (rgb) and padding
+    F32 specularColor[4]; ///< Material specular color (rgb) and shininess (a)
+};
+
+static_assert(sizeof(JzGeometryInstanceData) == 112, "Instance layout must match the 'indirect' vertex layout");
+
+/**
+ * @brief GPU buffers consumed by one multi-draw indirect submission.
+ */
+struct JzGeometryDrawStream {
+    std::shared_ptr<JzGPUVertexArrayObject> vertexArray;
+    std::shared_ptr<JzGPUBufferObject>      instanceBuffer;
+    std::shared_ptr<JzGPUBufferObject>      indirectBuffer;
+    U32                                     drawCapacity    = 0;
+    U64                                     geometryVersion = 0;
+};
+
+/**
+ * @brief Shared vertex/index mega-buffer for multi-draw indirect rendering.
+ *
+ * Meshes are sub-allocated on first use and stay resident until they have not
+ * been drawn for a while. The buffers grow by doubling; a CPU mirror is kept so
+ * that grown buffers can be refilled without reading back from the GPU.
+ *
+ * Draw streams are double-buffered by frame parity so that the instance and
+ * argument data of the previous frame is never overwritten while in flight.
+ */
+class JzGeometryPool {
+public:
+    /**
+     * @brief First vertex attribute location used by the per-draw instance data.
+     */
+    static constexpr U32 InstanceAttributeLocation = 5;
+
+    /**
+     * @brief Frames a mesh may stay unused before its ranges are released.
+     */
+    static constexpr U64 EvictAfterFrames = 600;
+
+    /**
+     * @brief Constructor
+     *
+     * @param initialVertexCapacity Initial vertex capacity of the shared vertex buffer.
+     * @param initialIndexCapacity Initial index capacity of the shared index buffer.
+     */
+    JzGeometryPool(U32 initialVertexCapacity = 1u << 18, U32 initialIndexCapacity = 1u << 20);
+
+    /**
+     * @brief Advance the frame: rotate draw streams and evict stale meshes.
+     */
+    void BeginFrame();
+
+    /**
+     * @brief Make a mesh resident in the shared buffers.
+     *
+     * @param handle Handle used as residency key.
+     * @param mesh Mesh whose CPU-side data is uploaded on first use.
+     *
+     * @return const JzGeometryAllocation* Allocation, or nullptr if the mesh has no data or the upload failed.
+     */
+    const JzGeometryAllocation *Acquire(JzMeshHandle handle, const JzMesh &mesh);
+
+    /**
+     * @brief Upload the per-draw data of one submission.
+     *
+     * @param instances Per-draw instance data, indexed by firstInstance.
+     * @param args Indirect arguments, one per draw.
+     *
+     * @return const JzGeometryDrawStream* Stream to bind, or nullptr on failure.
+     */
+    const JzGeometryDrawStream *Upload(const std::vector<JzGeometryInstanceData>   &instances,
+                                       const std::vector<JzDrawIndexedIndirectArgs> &args);
+
+    /**
+     * @brief Release all GPU resources and residency.
+     */
+    void Clear();
+
+    /**
+     * @brief Get the number of resident meshes.
+     */
+    Size GetResidentMeshCount() const
+    {
+        return m_entries.size();
+    }
+
+private:
+    struct JzEntry {
+        JzGeometryAllocation allocation;
+        U64                  lastUsedFrame = 0;
+    };
+
+    struct JzRetiredBuffer {
+        std::shared_ptr<JzGPUResource> resource;
+        U64                            retiredFrame = 0;
+    };
+
+    Bool EnsureGeometryBuffers(U64 vertexCapacity, U64 indexCapacity);
+    Bool EnsureStreamCapacity(JzGeometryDrawStream &stream, U32 drawCount);
+    void RebuildVertexArray(JzGeometryDrawStream &stream);
+    void Retire(std::shared_ptr<JzGPUResource> resource);
+    void EvictUnused();
+
+private:
+    std::unordered_map<JzMeshHandle, JzEntry, JzMeshHandle::Hash> m_entries;
+
+    std::vector<JzVertex>              m_vertexData;
+    std::vector<U32>                   m_indexData;
+    JzBufferRangeAllocator             m_vertexRanges;
+    JzBufferRangeAllocator             m_indexRanges;
+    std::shared_ptr<JzGPUBufferObject> m_vertexBuffer;
+    std::shared_ptr<JzGPUBufferObject> m_indexBuffer;
+    U64                                m_geometryVersion = 1;
+
+    std::vector<JzGeometryDrawStream> m_streams[2];
+    U32                               m_streamCursor = 0;
+    U32                               m_frameParity  = 0;
+    U64                               m_frameIndex   = 0;
+
+    std::vector<JzRetiredBuffer> m_retired;
+};
+
+} // namespace JzRE
@@ -0,0 +1,75 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Function/Rendering/JzGeometryPool.h"
+#include "JzRE/Runtime/Platform/Command/JzRHIDrawIndexedIndirectCommand.h"
+#include "JzRE/Runtime/Platform/RHI/JzGPUTextureObject.h"
+
+namespace JzRE {
+
+/**
+ * @brief Material textures bound for one draw. Null entries are not sampled.
+ */
+struct JzDrawTextureSet {
+    std::shared_ptr<JzGPUTextureObject> diffuse;
+    std::shared_ptr<JzGPUTextureObject> normal;
+    std::shared_ptr<JzGPUTextureObject> specular;
+
+    Bool operator==(const JzDrawTextureSet &other) const
+    {
+        return diffuse == other.diffuse && normal == other.normal && specular == other.specular;
+    }
+};
+
+/**
+ * @brief One visible draw before grouping.
+ */
+struct JzIndirectDrawInput {
+    JzDrawTextureSet          textures;
+    JzDrawIndexedIndirectArgs args;     ///< firstInstance is assigned by the batcher
+    JzGeometryInstanceData    instance;
+};
+
+/**
+ * @brief Consecutive indirect commands sharing one texture set.
+ */
+struct JzIndirectDrawGroup {
+    JzDrawTextureSet textures;
+    U32              firstDraw = 0; ///< Index of the first command in the argument buffer
+    U32              drawCount = 0;
+};
+
+/**
+ * @brief Instance data, indirect arguments and groups of one submission.
+ */
+struct JzIndirectDrawBatch {
+    std::vector<JzGeometryInstanceData>    instances;
+    std::vector<JzDrawIndexedIndirectArgs> args;
+    std::vector<JzIndirectDrawGroup>       groups;
+};
+
+/**
+ * @brief Groups visible draws into multi-draw indirect commands. CPU only.
+ *
+ * Draws are stably sorted by texture set, so every group is one indirect
+ * command range and draws keep their submission order within a group. Each
+ * draw's firstInstance is its own index, which is where the vertex shader
+ * fetches its instance data from.
+ */
+class JzIndirectDrawBatcher {
+public:
+    /**
+     * @brief Build the batch. Inputs are consumed.
+     */
+    static JzIndirectDrawBatch Build(std::vector<JzIndirectDrawInput> inputs);
+};
+
+} // namespace JzRE
@@ -0,0 +1,170 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "JzRE/Runtime/Core/JzMatrix.h"
+#include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Core/JzVector.h"
+#include "JzRE/Runtime/Core/JzVertex.h"
+
+namespace JzRE {
+
+class JzThreadPool;
+
+/**
+ * @brief Software occlusion configuration.
+ */
+struct JzOcclusionSettings {
+    U32 width                = 256;   ///< Depth buffer width, rounded up to whole tiles
+    U32 height               = 128;   ///< Depth buffer height, rounded up to whole tiles
+    U32 maxOccluders         = 64;    ///< Occluders rasterized per frame, largest on screen first
+    U32 maxOccluderTriangles = 16384; ///< Triangle budget shared by the rasterized occluders
+};
+
+/**
+ * @brief Counts of the last frame.
+ */
+struct JzOcclusionStats {
+    U32 occluders         = 0; ///< Occluders rasterized
+    U32 occluderTriangles = 0; ///< Triangles submitted by the rasterized occluders
+    U32 tested            = 0; ///< Bounding spheres tested
+    U32 occluded          = 0; ///< Bounding spheres found hidden
+};
+
+/**
+ * @brief One occluder mesh, usually a coarse proxy of the drawn mesh.
+ */
+struct JzOccluderMesh {
+    const std::vector<JzVertex> *vertices    = nullptr;
+    const std::vector<U32>      *indices     = nullptr;
+    JzMat4                       worldMatrix = JzMat4x4::Identity();
+    JzVec3                       boundsCenter{0.0f, 0.0f, 0.0f}; ///< World-space, used to rank occluders
+    F32                          boundsRadius = 0.0f;
+};
+
+/**
+ * @brief CPU occlusion culling against a small software depth buffer. Touches no GPU resources.
+ *
+ * Occluders are rasterized into a low resolution depth buffer that keeps
+ * the nearest depth per pixel, plus the farthest depth of every 8x8 tile.
+ * Rows are split into bands rasterized in parallel, four pixels at a time
+ * with JzF32x4. A bounding sphere is occluded when its nearest depth lies
+ * behind the buffer over its whole screen rectangle: tiles whose farthest
+ * depth is nearer than the sphere settle it at once, the others are checked
+ * per pixel.
+ *
+ * Triangles crossing the near plane are dropped, so occluders only ever
+ * shrink and culling stays conservative; spheres crossing the near plane
+ * are always visible.
+ */
+class JzOcclusionCuller {
+public:
+    static constexpr U32 TileSize = 8;
+
+    explicit JzOcclusionCuller(JzOcclusionSettings settings = {});
+
+    /**
+     * @brief Change the configuration. Takes effect on the next BeginFrame().
+     */
+    void SetSettings(const JzOcclusionSettings &settings);
+
+    const JzOcclusionSettings &GetSettings() const
+    {
+        return m_settings;
+    }
+
+    /**
+     * @brief Rasterize and test on the pool's workers, or on the calling thread for nullptr.
+     */
+    void SetThreadPool(JzThreadPool *threadPool)
+    {
+        m_threadPool = threadPool;
+    }
+
+    /**
+     * @brief Clear the depth buffer, the occluders and the stats for a new camera.
+     */
+    void BeginFrame(const JzMat4 &viewMatrix, const JzMat4 &projectionMatrix);
+
+    /**
+     * @brief Queue an occluder. The mesh data must stay alive until Rasterize() returns.
+     */
+    void AddOccluder(const JzOccluderMesh &occluder);
+
+    /**
+     * @brief Pick the occluders within the budget and rasterize them.
+     */
+    void Rasterize();
+
+    /**
+     * @brief Test one world-space bounding sphere. Does not count towards the stats.
+     */
+    Bool IsOccluded(const JzVec3 &center, F32 radius) const;
+
+    /**
+     * @brief Test bounding spheres (center in xyz, radius in w) in parallel.
+     *
+     * @param occluded Resized to the sphere count; 1 where a sphere is hidden
+     */
+    void TestSpheres(const std::vector<JzVec4> &spheres, std::vector<U8> &occluded);
+
+    const JzOcclusionStats &GetStats() const
+    {
+        return m_stats;
+    }
+
+    U32 GetWidth() const
+    {
+        return m_width;
+    }
+
+    U32 GetHeight() const
+    {
+        return m_height;
+    }
+
+    /**
+     * @brief Nearest occluder depth of a pixel, row 0 at the bottom; a large value where empty.
+     */
+    F32 GetDepth(U32 x, U32 y) const
+    {
+        return m_depth[static_cast<Size>(y) * m_width + x];
+    }
+
+private:
+    struct JzScreenTriangle {
+        F32 x[3];
+        F32 y[3];
+        F32 z[3];
+        I32 minY = 0;
+        I32 maxY = 0;
+    };
+
+    void SetupTriangles();
+    void RasterizeBand(U32 firstRow, U32 rowCount);
+    void RasterizeTriangle(const JzScreenTriangle &triangle, I32 firstRow, I32 lastRow);
+    void UpdateTiles(U32 firstRow, U32 rowCount);
+
+private:
+    JzOcclusionSettings m_settings;
+    JzThreadPool       *m_threadPool = nullptr;
+
+    U32    m_width          = 0;
+    U32    m_height         = 0;
+    U32    m_tilesPerRow    = 0;
+    JzMat4 m_viewMatrix     = JzMat4x4::Identity();
+    JzMat4 m_viewProjection = JzMat4x4::Identity();
+
+    std::vector<JzOccluderMesh>   m_occluders;
+    std::vector<JzScreenTriangle> m_triangles;
+    std::vector<F32>              m_depth;        ///< Nearest depth per pixel
+    std::vector<F32>              m_tileMaxDepth; ///< Farthest depth per tile
+    JzOcclusionStats              m_stats;
+};
+
+} // namespace JzRE
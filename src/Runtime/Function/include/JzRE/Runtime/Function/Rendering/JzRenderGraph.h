@@ -36,6 +36,12 @@ struct JzRGBuffer {
     U32 id = 0;
 };
 
+/**
+ * @brief Logical texture description.
+ *
+ * Transient textures only live for one frame: unbound ones come from the pool,
+ * and an attachment nothing reads afterwards is not stored back to memory.
+ */
 struct JzRGTextureDesc {
     JzIVec2                  size{0, 0};
     JzETextureResourceFormat format    = JzETextureResourceFormat::RGBA8;
@@ -56,11 +62,25 @@ enum class JzRGResourceType : U8 {
     Buffer,
 };
 
+/**
+ * @brief Resource transition between two passes.
+ *
+ * The usages are resolved from the declared JzRGUsage, the pass render
+ * targets, the buffer type and the pass type. When other passes run between
+ * producer and consumer the transition is split: the Begin half is reported
+ * after the producer and the End half before the consumer.
+ */
 struct JzRGTransition {
-    JzRGResourceType type;
-    U32              id     = 0;
-    JzRGUsage        before = JzRGUsage::Read;
-    JzRGUsage        after  = JzRGUsage::Read;
+    JzRGResourceType    type;
+    U32                 id          = 0;
+    JzRGUsage           before      = JzRGUsage::Read;
+    JzRGUsage           after       = JzRGUsage::Read;
+    JzERHIResourceUsage beforeUsage = JzERHIResourceUsage::Unknown;
+    JzERHIResourceUsage afterUsage  = JzERHIResourceUsage::Unknown;
+    JzERHIPassType      beforePass  = JzERHIPassType::Graphics;
+    JzERHIPassType      afterPass   = JzERHIPassType::Graphics;
+    JzERHIBarrierSplit  split       = JzERHIBarrierSplit::None;
+    U32                 splitId     = 0;
 };
 
 /**
@@ -74,6 +94,7 @@ struct JzRGPassContext {
     std::shared_ptr<JzGPUFramebufferObject> framebuffer;
     std::shared_ptr<JzGPUTextureObject>     colorTexture;
     std::shared_ptr<JzGPUTextureObject>     depthTexture;
+    JzRHIAttachmentOps                      attachmentOps;
 };
 
 class JzRGBuilder {
@@ -93,6 +114,16 @@ public:
      */
     virtual JzRGTexture Write(JzRGTexture tex, JzRGUsage usage = JzRGUsage::Write) = 0;
 
+    /**
+     * @brief Declare a read usage for a buffer.
+     */
+    virtual JzRGBuffer Read(JzRGBuffer buffer, JzRGUsage usage = JzRGUsage::Read) = 0;
+
+    /**
+     * @brief Declare a write usage for a buffer.
+     */
+    virtual JzRGBuffer Write(JzRGBuffer buffer, JzRGUsage usage = JzRGUsage::Write) = 0;
+
     /**
      * @brief Set render target attachments for this pass.
      */
@@ -112,6 +143,7 @@ struct JzRGPassDesc {
     std::function<Bool()>                        enabledExecute = nullptr;
     std::function<void(JzRGBuilder &)>           setup;
     std::function<void(const JzRGPassContext &)> execute;
+    JzERHIPassType                               type = JzERHIPassType::Graphics;
 };
 
 /**
@@ -200,7 +232,9 @@ public:
     /**
      * @brief Set transition callback (optional).
      *
-     * This can be used to insert backend-specific barriers/state changes.
+     * This can be used to insert backend-specific barriers/state changes. It
+     * runs before each pass with the transitions the pass needs, and after a
+     * pass with the Begin halves of split transitions it produces.
      */
     void SetTransitionCallback(TransitionCallback callback);
 
@@ -221,9 +255,11 @@ private:
         JzRGPassDesc                   desc;
         std::vector<JzRGResourceUsage> usages;
         std::vector<JzRGTransition>    transitions;
+        std::vector<JzRGTransition>    endTransitions; ///< Begin halves of split transitions
         JzRGTexture                    colorTarget;
         JzRGTexture                    depthTarget;
         JzIVec2                        viewport{0, 0};
+        JzRHIAttachmentOps             attachmentOps; ///< Store ops from Compile, load ops from Execute
     };
 
     class JzRGBuilderImpl final : public JzRGBuilder {
@@ -238,6 +274,8 @@ private:
 
         JzRGTexture Read(JzRGTexture tex, JzRGUsage usage) override;
         JzRGTexture Write(JzRGTexture tex, JzRGUsage usage) override;
+        JzRGBuffer  Read(JzRGBuffer buffer, JzRGUsage usage) override;
+        JzRGBuffer  Write(JzRGBuffer buffer, JzRGUsage usage) override;
         void        SetRenderTarget(JzRGTexture color, JzRGTexture depth) override;
         void        SetViewport(JzIVec2 size) override;
 
@@ -258,8 +296,10 @@ private:
     Bool                                                             m_hasCycle = false;
     JzRGBuilderImpl                                                  m_builder;
 
-    void BuildTransitions(const std::vector<size_t> &order);
-    void AllocateResources();
+    void                BuildTransitions(const std::vector<size_t> &order);
+    void                BuildAttachmentOps(const std::vector<size_t> &order);
+    void                AllocateResources();
+    JzERHIResourceUsage ResolveUsage(const JzRGPassData &pass, const JzRGResourceUsage &usage) const;
 
     struct JzRGTexturePoolEntry {
         JzRGTextureDesc                     desc;
@@ -17,22 +17,25 @@
 namespace JzRE {
 
 struct JzRGPassContext;
+struct JzRenderSnapshot;
 class JzRHICommandList;
-class JzWorld;
 
 /**
  * @brief Per-pass execution context for render graph contributions.
+ *
+ * Contributions may run on the render thread while the game thread updates
+ * the world, so scene state is read from the snapshot only.
  */
 struct JzRenderGraphContributionContext {
-    JzWorld               &world;
-    JzEntity               camera;
-    JzRenderVisibility     visibility;
-    JzRenderTargetFeatures targetFeatures;
-    JzIVec2                targetSize;
-    const JzMat4          &viewMatrix;
-    const JzMat4          &projectionMatrix;
-    JzRHICommandList      *commandList = nullptr;
-    const JzRGPassContext *passContext = nullptr;
+    const JzRenderSnapshot &snapshot; ///< Frame being drawn
+    JzEntity                camera;
+    JzRenderVisibility      visibility;
+    JzRenderTargetFeatures  targetFeatures;
+    JzIVec2                 targetSize;
+    const JzMat4           &viewMatrix;
+    const JzMat4           &projectionMatrix;
+    JzRHICommandList       *commandList = nullptr;
+    const JzRGPassContext  *passContext = nullptr;
 };
 
 /**
@@ -74,7 +77,7 @@ struct JzRenderGraphContribution {
     JzRenderTargetFeatures                                        requiredFeature = JzRenderTargetFeatures::None;
     JzRenderGraphContributionScope                                scope           = JzRenderGraphContributionScope::RegisteredTarget;
     Bool                                                          clearTarget     = false;
-    std::function<Bool()>                                         enabledExecute  = nullptr;
+    std::function<Bool()>                                         enabledExecute  = nullptr; ///< Called on the game thread at extract time
     std::function<void(const JzRenderGraphContributionContext &)> execute;
 };
 
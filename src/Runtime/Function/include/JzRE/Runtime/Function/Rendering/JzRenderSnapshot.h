@@ -0,0 +1,143 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "JzRE/Runtime/Core/JzMatrix.h"
+#include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Core/JzVector.h"
+#include "JzRE/Runtime/Function/ECS/JzEntity.h"
+#include "JzRE/Runtime/Function/ECS/JzLightComponents.h"
+#include "JzRE/Runtime/Function/Rendering/JzRenderGraphContribution.h"
+#include "JzRE/Runtime/Function/Rendering/JzRenderTarget.h"
+#include "JzRE/Runtime/Function/Rendering/JzRenderVisibility.h"
+#include "JzRE/Runtime/Resource/JzAssetHandle.h"
+
+namespace JzRE {
+
+/**
+ * @brief Camera state copied out of the world for one frame.
+ */
+struct JzRenderSnapshotCamera {
+    JzEntity entity           = INVALID_ENTITY;
+    JzMat4   viewMatrix       = JzMat4x4::Identity();
+    JzMat4   projectionMatrix = JzMat4x4::Identity();
+    JzVec3   clearColor{0.1f, 0.1f, 0.1f};
+    Bool     isMainCamera = false;
+};
+
+/**
+ * @brief One renderable entity copied out of the world for one frame.
+ *
+ * Assets are referenced by handle and resolved by the render system when the
+ * frame is drawn.
+ */
+struct JzRenderSnapshotDraw {
+    JzEntity           entity      = INVALID_ENTITY;
+    JzMat4             modelMatrix = JzMat4x4::Identity();
+    JzMeshHandle       meshHandle;         ///< Level selected by JzLODSystem
+    JzMeshHandle       fallbackMeshHandle; ///< Full detail level, used if the selected one is not resident
+    JzMaterialHandle   materialHandle;
+    JzVec3             ambientColor{0.1f, 0.1f, 0.1f};
+    JzVec3             diffuseColor{0.8f, 0.8f, 0.8f};
+    JzVec3             specularColor{0.5f, 0.5f, 0.5f};
+    F32                shininess  = 32.0f;
+    JzTextureHandle    normalTextureHandle;   ///< Invalid when the material has no normal map
+    JzTextureHandle    specularTextureHandle; ///< Invalid when the material has no specular map
+    JzRenderVisibility visibility = JzRenderVisibility::MainScene; ///< The single channel the entity renders in
+    JzVec3             boundsCenter{0.0f, 0.0f, 0.0f}; ///< World-space bounding sphere center
+    F32                boundsRadius = 0.0f;            ///< World-space bounding sphere radius, 0 if unknown
+    Bool               isStatic     = false;           ///< Entity has JzStaticTag
+    Bool               occluded     = false;           ///< Hidden from the main camera by occlusion culling
+};
+
+/**
+ * @brief Render target state copied out of the render system for one frame.
+ *
+ * The desc callbacks are evaluated at extract time, so the renderer never
+ * calls into editor or game code. The output and lighting are shared with the
+ * target record and stay alive if the target is unregistered mid-frame.
+ */
+struct JzRenderSnapshotTarget {
+    JzRenderTargetHandle                 handle = INVALID_RENDER_TARGET_HANDLE;
+    String                               name;
+    JzEntity                             camera     = INVALID_ENTITY;
+    JzRenderVisibility                   visibility = JzRenderVisibility::MainScene;
+    JzRenderTargetFeatures               features   = JzRenderTargetFeatures::None;
+    JzIVec2                              desiredSize{0, 0}; ///< From getDesiredSize; zero keeps the output's size
+    Bool                                 isDefault = false;
+    std::shared_ptr<JzRenderOutput>      output;
+    std::shared_ptr<JzClusteredLighting> lighting;
+};
+
+/**
+ * @brief Render-relevant world state for one frame.
+ *
+ * Written by JzRenderSystem::Extract on the game thread and read by the
+ * render pass, so rendering never touches components or render system state
+ * the game thread is updating.
+ */
+struct JzRenderSnapshot {
+    U64                                    frameIndex = 0;
+    JzIVec2                                frameSize{0, 0};
+    Bool                                   hasWindow     = false;
+    Bool                                   windowVisible = false;
+    std::vector<JzRenderSnapshotCamera>    cameras;
+    std::vector<JzLightData>               lights;
+    std::vector<JzRenderSnapshotDraw>      draws;
+    std::vector<JzRenderSnapshotTarget>    targets;       ///< Targets whose shouldRender passed
+    std::vector<JzRenderGraphContribution> contributions; ///< Contributions whose enabledExecute passed
+
+    /**
+     * @brief Find the camera a render target should use.
+     *
+     * Prefers the given entity, then the main camera, then the first camera.
+     *
+     * @return Camera state, or nullptr if the frame has no camera
+     */
+    const JzRenderSnapshotCamera *FindCamera(JzEntity preferredCamera) const;
+
+    /**
+     * @brief Empty all lists, keeping their storage.
+     */
+    void Clear();
+};
+
+/**
+ * @brief Double buffer handing render snapshots from the game thread to the renderer.
+ *
+ * The game thread fills the back snapshot while the renderer reads the
+ * published one. Publish() swaps them and must not overlap a frame that is
+ * reading the published snapshot; the runtime calls it while the render
+ * thread is idle.
+ */
+class JzRenderSnapshotBuffer {
+public:
+    /**
+     * @brief Clear the back snapshot and return it for writing.
+     */
+    JzRenderSnapshot &BeginWrite();
+
+    /**
+     * @brief Make the back snapshot the published one.
+     */
+    void Publish();
+
+    /**
+     * @brief Get the last published snapshot.
+     */
+    const JzRenderSnapshot &GetPublished() const;
+
+private:
+    std::array<JzRenderSnapshot, 2> m_snapshots;
+    U32                             m_publishedIndex = 0;
+    U64                             m_nextFrameIndex = 1;
+};
+
+} // namespace JzRE
@@ -11,6 +11,7 @@
 #include "JzRE/Runtime/Core/JzRETypes.h"
 #include "JzRE/Runtime/Core/JzVector.h"
 #include "JzRE/Runtime/Function/ECS/JzEntity.h"
+#include "JzRE/Runtime/Function/Rendering/JzClusteredLighting.h"
 #include "JzRE/Runtime/Function/Rendering/JzRenderOutput.h"
 #include "JzRE/Runtime/Function/Rendering/JzRenderVisibility.h"
 
@@ -83,9 +84,10 @@ struct JzRenderTargetDesc {
  * @brief Runtime render target instance.
  */
 struct JzRenderTarget {
-    JzRenderTargetHandle            handle = INVALID_RENDER_TARGET_HANDLE;
-    JzRenderTargetDesc              desc;
-    std::shared_ptr<JzRenderOutput> output;
+    JzRenderTargetHandle                 handle = INVALID_RENDER_TARGET_HANDLE;
+    JzRenderTargetDesc                   desc;
+    std::shared_ptr<JzRenderOutput>      output;
+    std::shared_ptr<JzClusteredLighting> lighting; ///< Per target, since each camera bins lights differently
 };
 
 } // namespace JzRE
@@ -0,0 +1,201 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "JzRE/Runtime/Core/JzMatrix.h"
+#include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Core/JzVector.h"
+#include "JzRE/Runtime/Function/ECS/JzLightComponents.h"
+#include "JzRE/Runtime/Function/Rendering/JzRenderSnapshot.h"
+#include "JzRE/Runtime/Platform/RHI/JzGPUFramebufferObject.h"
+#include "JzRE/Runtime/Platform/RHI/JzGPUTextureObject.h"
+
+namespace JzRE {
+
+class JzDevice;
+class JzRHICommandList;
+class JzRHIPipeline;
+
+/**
+ * @brief Shadow atlas configuration.
+ */
+struct JzShadowAtlasSettings {
+    U32 atlasSize          = 4096;  ///< Atlas width and height in texels
+    U32 tileSize           = 1024;  ///< Every shadow view gets one square tile
+    U32 cascadeCount       = 3;     ///< Cascades per shadowed directional light
+    F32 cascadeSplitLambda = 0.75f; ///< 1 splits logarithmically, 0 uniformly
+    F32 shadowDistance     = 80.0f; ///< Cascades end here or at the camera far plane
+    U32 refreshBudget      = 6;     ///< Tiles redrawn per frame
+};
+
+/**
+ * @brief Views of one light, contiguous in the shadow view list.
+ */
+struct JzShadowRange {
+    U32 firstView = 0;
+    U32 viewCount = 0;
+};
+
+/**
+ * @brief One cascade of a directional light or one spot light, drawn into one atlas tile.
+ */
+struct JzShadowView {
+    U64              key              = 0;                    ///< Light entity and cascade, stable across frames
+    U32              lightIndex       = 0;                    ///< Index into the planned light list
+    U32              cascade          = 0;
+    U32              tile             = 0;
+    JzMat4           viewMatrix       = JzMat4x4::Identity();
+    JzMat4           projectionMatrix = JzMat4x4::Identity();
+    JzMat4           atlasMatrix      = JzMat4x4::Identity(); ///< World to atlas texel x/y and depth
+    F32              splitDepth       = 0.0f;                 ///< Far view depth of a cascade, 0 for spot lights
+    F32              texelWorldSize   = 0.0f;                 ///< Per unit of distance for spot lights
+    F32              coverage         = 0.0f;                 ///< Estimated fraction of the screen it shades
+    Bool             staticOnly       = true;                 ///< Every caster is static, so the tile may be cached
+    Bool             valid            = false;                ///< The tile holds depth for this view
+    std::vector<U32> casters;                                 ///< Indices into the planned draws
+};
+
+/**
+ * @brief Shared depth atlas for directional cascades and spot light shadows.
+ *
+ * Plan() lays out the shadow views of a frame and decides which tiles to
+ * redraw. Cascades are fitted to bounding spheres of the camera frustum
+ * slices and snapped to whole texels, so they only change when the camera
+ * moves by a texel or turns. A tile whose casters are all static keeps its
+ * depth until the light, a caster or the caster set changes; other tiles are
+ * redrawn every frame. At most refreshBudget tiles are redrawn per frame,
+ * chosen by screen coverage plus a bonus for every frame they have waited. A
+ * tile that is not redrawn keeps sampling with the matrix it was drawn with.
+ *
+ * Point lights do not cast shadows.
+ */
+class JzShadowAtlas {
+public:
+    static constexpr U32 TexelsPerView = 6;
+
+    /**
+     * @brief Texture slots used by Bind(), after the clustered lighting slots.
+     */
+    static constexpr U32 AtlasSlot      = 4;
+    static constexpr U32 ShadowDataSlot = 5;
+
+    explicit JzShadowAtlas(JzShadowAtlasSettings settings = {});
+
+    /**
+     * @brief Change the configuration. A new atlas or tile size drops every cached tile.
+     */
+    void SetSettings(const JzShadowAtlasSettings &settings);
+
+    const JzShadowAtlasSettings &GetSettings() const
+    {
+        return m_settings;
+    }
+
+    /**
+     * @brief Lay out the shadow views for a camera and pick the tiles to redraw. CPU only.
+     *
+     * Draws in the main scene channel cast shadows; the rest are ignored.
+     */
+    void Plan(const std::vector<JzLightData> &lights, const std::vector<JzRenderSnapshotDraw> &draws,
+              const JzMat4 &viewMatrix, const JzMat4 &projectionMatrix);
+
+    /**
+     * @brief Create the atlas if needed and upload the sampling data of the last Plan().
+     */
+    void Upload(JzDevice &device);
+
+    /**
+     * @brief Bind the atlas and set the shadow uniforms of a pipeline.
+     */
+    void Bind(JzRHICommandList &commandList, JzRHIPipeline &pipeline) const;
+
+    /**
+     * @brief Release the GPU resources and forget every cached tile.
+     */
+    void Reset();
+
+    /**
+     * @brief Views of the last Plan(), grouped by light.
+     */
+    const std::vector<JzShadowView> &GetViews() const
+    {
+        return m_views;
+    }
+
+    /**
+     * @brief Indices of the views to redraw this frame, highest priority first.
+     */
+    const std::vector<U32> &GetRefreshViews() const
+    {
+        return m_refreshViews;
+    }
+
+    /**
+     * @brief Views of a light from the last Plan(), empty when it casts no shadow.
+     */
+    JzShadowRange GetLightShadow(U32 lightIndex) const;
+
+    /**
+     * @brief Top-left texel of a tile.
+     */
+    JzIVec2 GetTileOrigin(U32 tile) const;
+
+    U32 GetTileCount() const
+    {
+        return m_tilesPerRow * m_tilesPerRow;
+    }
+
+    std::shared_ptr<JzGPUTextureObject> GetAtlasTexture() const
+    {
+        return m_atlasTexture;
+    }
+
+    std::shared_ptr<JzGPUFramebufferObject> GetFramebuffer() const
+    {
+        return m_framebuffer;
+    }
+
+private:
+    struct JzShadowTileState {
+        U32    tile        = 0;
+        U64    contentHash = 0;
+        U32    staleFrames = 0;
+        Bool   valid       = false;
+        Bool   used        = false;
+        JzMat4 atlasMatrix = JzMat4x4::Identity(); ///< Matrix the tile was last drawn with
+        F32    texelSize   = 0.0f;
+    };
+
+    void AddCascades(U32 lightIndex, const JzLightData &light, const std::vector<JzRenderSnapshotDraw> &draws,
+                     const JzMat4 &viewMatrix, const JzMat4 &projectionMatrix);
+    void AddSpotView(U32 lightIndex, const JzLightData &light, const std::vector<JzRenderSnapshotDraw> &draws,
+                     const JzMat4 &viewMatrix, const JzMat4 &projectionMatrix);
+    void AssignTiles();
+    void SelectRefreshViews(const std::vector<JzRenderSnapshotDraw> &draws);
+    void FinishView(JzShadowView &view) const;
+
+private:
+    JzShadowAtlasSettings m_settings;
+    U32                   m_tilesPerRow = 1;
+
+    std::vector<JzShadowView>                  m_views;
+    std::vector<U32>                           m_refreshViews;
+    std::vector<JzShadowRange>                 m_lightRanges;
+    std::unordered_map<U64, JzShadowTileState> m_tileStates;
+    std::vector<U32>                           m_freeTiles;
+    std::vector<F32>                           m_viewTexels;
+    Bool                                       m_warnedTileOverflow = false;
+
+    std::shared_ptr<JzGPUTextureObject>     m_atlasTexture;
+    std::shared_ptr<JzGPUFramebufferObject> m_framebuffer;
+    std::shared_ptr<JzGPUTextureObject>     m_viewTexture;
+};
+
+} // namespace JzRE
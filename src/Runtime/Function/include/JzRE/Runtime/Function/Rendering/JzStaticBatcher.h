@@ -0,0 +1,65 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "JzRE/Runtime/Core/JzMatrix.h"
+#include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Core/JzVector.h"
+#include "JzRE/Runtime/Core/JzVertex.h"
+
+namespace JzRE {
+
+/**
+ * @brief Static batching configuration.
+ */
+struct JzStaticBatchSettings {
+    F32 chunkSize           = 32.0f;  ///< Edge length of the world-space grid cells meshes are binned into
+    U32 maxVerticesPerChunk = 262144; ///< A chunk is split before it grows past this
+};
+
+/**
+ * @brief One static mesh instance to merge.
+ */
+struct JzStaticBatchInput {
+    const std::vector<JzVertex> *vertices    = nullptr;
+    const std::vector<U32>      *indices     = nullptr;
+    JzMat4                       worldMatrix = JzMat4x4::Identity();
+    U64                          groupKey    = 0; ///< Only inputs with equal keys share a chunk
+};
+
+/**
+ * @brief Pre-transformed geometry of the inputs of one group in one grid cell.
+ */
+struct JzStaticBatchChunk {
+    U64                   groupKey = 0;
+    std::vector<JzVertex> vertices;
+    std::vector<U32>      indices;
+    JzVec3                boundsCenter{0.0f, 0.0f, 0.0f}; ///< World-space bounding sphere center
+    F32                   boundsRadius = 0.0f;            ///< World-space bounding sphere radius
+    std::vector<U32>      inputs;                         ///< Indices of the merged inputs
+};
+
+/**
+ * @brief Merges static meshes into world-space chunks. CPU only.
+ *
+ * Inputs are binned by the center of their world bounds into a uniform grid,
+ * so a chunk stays spatially compact and can still be culled on its own.
+ * Vertices are transformed into world space: normals by the inverse
+ * transpose, tangents by the matrix, both renormalized. Triangles of inputs
+ * with a mirroring transform are rewound so they keep facing outward.
+ */
+class JzStaticBatcher {
+public:
+    /**
+     * @brief Build the chunks, ordered by group key and then by cell.
+     */
+    static std::vector<JzStaticBatchChunk> Build(const std::vector<JzStaticBatchInput> &inputs,
+                                                 const JzStaticBatchSettings           &settings = {});
+};
+
+} // namespace JzRE
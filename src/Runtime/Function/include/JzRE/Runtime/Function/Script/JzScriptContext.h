@@ -8,12 +8,14 @@
 #include <filesystem>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <sol/sol.hpp>
 
 #include "JzRE/Runtime/Core/JzRETypes.h"
 #include "JzRE/Runtime/Function/ECS/JzEntity.h"
+#include "JzRE/Runtime/Platform/FileSystem/JzFileWatcher.h"
 
 namespace JzRE {
 
@@ -38,10 +40,11 @@ class JzWorld;
  * map 1-to-1 with the underlying entt::entity value.
  *
  * Hot reload:
- *   Call CheckHotReload() every frame.  When a script file's modification
- *   time changes, the file is reloaded into the existing per-entity
- *   environment and the entity's started flag is reset so OnStart fires
- *   again on the next frame.
+ *   Call CheckHotReload() every frame.  When a script file changes, the file
+ *   is reloaded into the existing per-entity environment and the entity's
+ *   started flag is reset so OnStart fires again on the next frame.  Changes
+ *   come from the JzFileWatcher service if one is provided at Initialize();
+ *   otherwise modification times are polled.
  */
 class JzScriptContext {
 public:
@@ -116,9 +119,10 @@ public:
     // ==================== Hot Reload ====================
 
     /**
-     * @brief Accumulate delta and check file timestamps every reload interval.
+     * @brief Reload the scripts whose files changed.
      *
-     * When a script file's modification time has advanced, the file is
+     * With a file watcher only notified scripts are reloaded. Without one,
+     * file timestamps are checked every reload interval. A changed file is
      * re-executed into its existing environment and the entity's started
      * flag is reset via the JzScriptComponent.
      *
@@ -127,7 +131,7 @@ public:
     void CheckHotReload(F32 delta);
 
     /**
-     * @brief Set how often (in seconds) file timestamps are polled.
+     * @brief Set how often (in seconds) file timestamps are polled without a file watcher.
      *
      * Default is 0.5 seconds.
      */
@@ -160,6 +164,15 @@ private:
      */
     Bool ExecuteFile(const String &scriptPath, sol::environment &env);
 
+    /**
+     * @brief Re-execute a script for every entity using it.
+     */
+    void ReloadScript(const String &scriptPath, std::vector<JzEntity> &entities,
+                      std::filesystem::file_time_type newMtime);
+
+    void WatchScript(const String &scriptPath);
+    void UnwatchScript(const String &scriptPath);
+
     // ==================== Per-entity script state ====================
 
     struct ScriptInstance {
@@ -180,6 +193,16 @@ private:
     JzWorld *m_world{nullptr};
     F32      m_reloadInterval{0.5f};
     F32      m_timeSinceCheck{0.0f};
+
+    struct WatchedDirectory {
+        JzFileWatchHandle handle   = 0;
+        U32               refCount = 0;
+    };
+
+    JzFileWatcher                               *m_fileWatcher{nullptr};
+    std::unordered_map<String, WatchedDirectory> m_watchedDirectories;
+    std::unordered_set<String>                   m_changedFiles;      ///< Normalized paths
+    std::unordered_set<String>                   m_rescanDirectories; ///< Events were lost here
 };
 
 } // namespace JzRE
@@ -15,6 +15,7 @@
 
 #include "JzRE/Runtime/Core/JzFileSystemUtils.h"
 #include "JzRE/Runtime/Core/JzLogger.h"
+#include "JzRE/Runtime/Core/JzServiceContainer.h"
 #include "JzRE/Runtime/Function/ECS/JzAssetSystem.h"
 
 namespace JzRE {
@@ -30,6 +31,13 @@ Bool IsShaderSourceFile(const std::filesystem::path &path)
     return ext == ".hlsl" || ext == ".hlsli";
 }
 
+Bool IsShaderManifestFile(const std::filesystem::path &path)
+{
+    auto lowered = path.filename().string();
+    std::transform(lowered.begin(), lowered.end(), lowered.begin(), ::tolower);
+    return lowered.size() >= 18 && lowered.ends_with(".jzshader.src.json");
+}
+
 String Quote(const String &value)
 {
     String out = "\"";
@@ -84,14 +92,23 @@ Bool JzShaderCookService::Initialize()
 
     m_manifestTimestamps.clear();
     m_timeSinceLastScan = m_config.scanIntervalSeconds;
+    m_sourcesDirty      = true;
     m_initialized       = true;
-    JzRE_LOG_INFO("JzShaderCookService: watching '{}' -> '{}'",
-                  m_config.sourceRoot.string(), m_config.outputRoot.string());
+
+    if (JzServiceContainer::Has<JzFileWatcher>()) {
+        m_fileWatcher = &JzServiceContainer::Get<JzFileWatcher>();
+        WatchDirectory(m_config.sourceRoot);
+    }
+
+    JzRE_LOG_INFO("JzShaderCookService: watching '{}' -> '{}' ({})",
+                  m_config.sourceRoot.string(), m_config.outputRoot.string(),
+                  m_fileWatcher ? "file notifications" : "polling");
     return true;
 }
 
 void JzShaderCookService::Shutdown()
 {
+    UnwatchAll();
     m_manifestTimestamps.clear();
     m_resolvedShaderToolPath.clear();
     m_timeSinceLastScan = 0.0f;
@@ -104,11 +121,18 @@ void JzShaderCookService::Update(F32 deltaSeconds, JzAssetSystem &assetSystem)
         return;
     }
 
-    m_timeSinceLastScan += deltaSeconds;
-    if (m_timeSinceLastScan < std::max(0.05f, m_config.scanIntervalSeconds)) {
-        return;
+    if (m_fileWatcher) {
+        if (!m_sourcesDirty) {
+            return;
+        }
+        m_sourcesDirty = false;
+    } else {
+        m_timeSinceLastScan += deltaSeconds;
+        if (m_timeSinceLastScan < std::max(0.05f, m_config.scanIntervalSeconds)) {
+            return;
+        }
+        m_timeSinceLastScan = 0.0f;
     }
-    m_timeSinceLastScan = 0.0f;
 
     std::vector<std::filesystem::path> manifests;
     if (!ScanShaderManifests(manifests)) {
@@ -122,9 +146,17 @@ void JzShaderCookService::Update(F32 deltaSeconds, JzAssetSystem &assetSystem)
         }
 
         if (CookManifest(manifestPath)) {
+            std::vector<std::filesystem::path> includeRoots;
             m_manifestTimestamps[manifestPath.lexically_normal().string()] =
-                ComputeManifestDependencyTimestamp(manifestPath);
+                ComputeManifestDependencyTimestamp(manifestPath, &includeRoots);
             anyCooked = true;
+
+            // Include directories may live outside of sourceRoot
+            if (m_fileWatcher) {
+                for (const auto &includeRoot : includeRoots) {
+                    WatchDirectory(includeRoot);
+                }
+            }
         }
     }
 
@@ -157,11 +189,8 @@ Bool JzShaderCookService::ScanShaderManifests(std::vector<std::filesystem::path>
             continue;
         }
 
-        const auto filePath = it->path();
-        auto       lowered  = filePath.filename().string();
-        std::transform(lowered.begin(), lowered.end(), lowered.begin(), ::tolower);
-        if (lowered.size() >= 18 && lowered.ends_with(".jzshader.src.json")) {
-            outManifests.push_back(filePath.lexically_normal());
+        if (IsShaderManifestFile(it->path())) {
+            outManifests.push_back(it->path().lexically_normal());
         }
     }
 
@@ -212,7 +241,7 @@ Bool JzShaderCookService::CookManifest(const std::filesystem::path &manifestPath
 }
 
 std::filesystem::file_time_type JzShaderCookService::ComputeManifestDependencyTimestamp(
-    const std::filesystem::path &manifestPath) const
+    const std::filesystem::path &manifestPath, std::vector<std::filesystem::path> *outIncludeRoots) const
 {
     namespace fs = std::filesystem;
 
@@ -277,6 +306,10 @@ std::filesystem::file_time_type JzShaderCookService::ComputeManifestDependencyTi
         }
     }
 
+    if (outIncludeRoots) {
+        *outIncludeRoots = includeRoots;
+    }
+
     for (const auto &root : includeRoots) {
         if (!fs::exists(root, ec) || !fs::is_directory(root, ec)) {
             continue;
@@ -320,4 +353,41 @@ std::filesystem::path JzShaderCookService::ResolveShaderToolPath() const
     return (JzFileSystemUtils::GetExecutableDirectory() / toolName).lexically_normal();
 }
 
+void JzShaderCookService::WatchDirectory(const std::filesystem::path &directory)
+{
+    const auto normalized = JzFileWatcher::NormalizePath(directory);
+    for (const auto &[watched, handle] : m_watchedDirectories) {
+        const std::filesystem::path watchedPath = watched;
+        auto [dirIt, pathIt] = std::mismatch(watchedPath.begin(), watchedPath.end(), normalized.begin(), normalized.end());
+        if (dirIt == watchedPath.end()) {
+            return; // Already covered by a recursive watch
+        }
+    }
+
+    const auto handle = m_fileWatcher->Watch(normalized, true, [this](const std::vector<JzFileChange> &changes) {
+        for (const auto &change : changes) {
+            // A renamed directory moves the sources below it
+            if (change.kind == JzEFileChangeKind::Rescan || change.kind == JzEFileChangeKind::Renamed ||
+                IsShaderSourceFile(change.path) || IsShaderManifestFile(change.path)) {
+                m_sourcesDirty = true;
+                return;
+            }
+        }
+    });
+    if (handle != 0) {
+        m_watchedDirectories.emplace(normalized.string(), handle);
+    }
+}
+
+void JzShaderCookService::UnwatchAll()
+{
+    if (m_fileWatcher) {
+        for (const auto &[directory, handle] : m_watchedDirectories) {
+            m_fileWatcher->Unwatch(handle);
+        }
+    }
+    m_watchedDirectories.clear();
+    m_fileWatcher = nullptr;
+}
+
 } // namespace JzRE
@@ -42,17 +42,17 @@ void JzAssetSystem::Update(JzWorld &world, F32 delta)
     // Process async results and LRU eviction
     m_assetManager->Update();
 
-    // Process asset components (absorbed from JzAssetLoadingSystem)
-    ProcessMeshAssets(world);
-    ProcessMaterialAssets(world);
-    ProcessShaders(world);
+    // Visit only entities whose asset components changed or whose asset finished loading
+    ProcessPendingEntities(world);
 
     // Hot reload check (development mode only)
     if (m_hotReloadEnabled) {
         m_timeSinceLastCheck += delta;
 
-        if (m_forceCheckNextFrame || m_timeSinceLastCheck >= m_hotReloadCheckInterval) {
-            CheckForHotReloadUpdates(world);
+        const Bool filesChanged = !m_changedFiles.empty() || !m_rescanDirectories.empty();
+        if (m_forceCheckNextFrame || filesChanged || m_timeSinceLastCheck >= m_hotReloadCheckInterval) {
+            // With a watcher, only notified files are stat'ed; the interval pass just watches new shaders
+            CheckForHotReloadUpdates(world, m_forceCheckNextFrame || !m_fileWatcher);
             m_timeSinceLastCheck  = 0.0f;
             m_forceCheckNextFrame = false;
         }
@@ -61,6 +61,9 @@ void JzAssetSystem::Update(JzWorld &world, F32 delta)
 
 void JzAssetSystem::OnShutdown(JzWorld &world)
 {
+    UnwatchAll();
+    DisconnectObservers();
+
     if (world.HasContext<JzAssetManager *>()) {
         world.RemoveContext<JzAssetManager *>();
     }
@@ -92,9 +95,18 @@ void JzAssetSystem::Initialize(JzWorld &world, const JzAssetManagerConfig &confi
     JzServiceContainer::Provide<JzAssetManager>(*m_assetManager);
     world.SetContext<JzAssetManager *>(m_assetManager.get());
 
+    m_assetManager->SetLoadResultListener([this](const JzAssetLoadResult &result) {
+        OnAssetLoadFinished(result);
+    });
+    ConnectObservers(world);
+
+    if (JzServiceContainer::Has<JzFileWatcher>()) {
+        m_fileWatcher = &JzServiceContainer::Get<JzFileWatcher>();
+    }
+
     if (m_hotReloadEnabled) {
-        JzRE_LOG_INFO("JzAssetSystem: Hot reload enabled with {}s check interval",
-                      m_hotReloadCheckInterval);
+        JzRE_LOG_INFO("JzAssetSystem: Hot reload enabled with {}s check interval ({})",
+                      m_hotReloadCheckInterval, m_fileWatcher ? "file notifications" : "polling");
     }
 }
 
@@ -148,7 +160,22 @@ std::vector<JzEntity> JzAssetSystem::SpawnModel(JzWorld &world, JzModelHandle mo
             meshComp.isReady       = true;
             meshComp.indexCount    = mesh->GetIndexCount();
             meshComp.materialIndex = mesh->GetMaterialIndex();
+            meshComp.boundsCenter  = mesh->GetBoundsCenter();
+            meshComp.boundsRadius  = mesh->GetBoundsRadius();
             assetRef.AddMesh(meshHandle);
+
+            // Register simplified levels so the LOD system can swap handles
+            const auto &lods = mesh->GetLODs();
+            for (Size lodIdx = 0; lodIdx < lods.size(); ++lodIdx) {
+                auto lodPath   = meshPath + "#lod" + std::to_string(lodIdx + 1);
+                auto lodHandle = RegisterAsset<JzMesh>(lodPath, lods[lodIdx].mesh);
+                if (!lodHandle.IsValid()) {
+                    break;
+                }
+                meshComp.lodMeshHandles.push_back(lodHandle);
+                meshComp.lodErrors.push_back(lods[lodIdx].error);
+                assetRef.AddMesh(lodHandle);
+            }
         }
 
         // Get associated material (if any)
@@ -280,6 +307,11 @@ Size JzAssetSystem::GetPendingLoadCount() const
     return m_assetManager ? m_assetManager->GetPendingLoadCount() : 0;
 }
 
+Size JzAssetSystem::GetPendingEntityCount() const
+{
+    return m_pendingEntities.size();
+}
+
 // ==================== Internal Access ====================
 
 JzAssetManager &JzAssetSystem::GetAssetManager()
@@ -295,140 +327,168 @@ const JzAssetManager &JzAssetSystem::GetAssetManager() const
 // ==================== Asset Component Processing ====================
 // (Absorbed from JzAssetLoadingSystem)
 
-void JzAssetSystem::ProcessMeshAssets(JzWorld &world)
+void JzAssetSystem::ProcessPendingEntities(JzWorld &world)
 {
-    auto view = world.View<JzMeshAssetComponent>();
+    if (m_pendingEntities.empty()) {
+        return;
+    }
 
-    for (auto entity : view) {
-        auto &meshComp = view.get<JzMeshAssetComponent>(entity);
+    std::vector<JzEntity> entities(m_pendingEntities.begin(), m_pendingEntities.end());
+    m_pendingEntities.clear();
 
-        if (meshComp.isReady || !meshComp.meshHandle.IsValid()) {
+    for (auto entity : entities) {
+        if (!world.IsValid(entity)) {
             continue;
         }
 
-        auto loadState = m_assetManager->GetLoadState(meshComp.meshHandle);
+        Bool recheck = false;
+        if (auto *meshComp = world.TryGetComponent<JzMeshAssetComponent>(entity)) {
+            recheck |= ProcessMeshAsset(world, entity, *meshComp);
+        }
+        if (auto *matComp = world.TryGetComponent<JzMaterialAssetComponent>(entity)) {
+            recheck |= ProcessMaterialAsset(world, entity, *matComp);
+        }
+        if (auto *shaderComp = world.TryGetComponent<JzShaderComponent>(entity)) {
+            recheck |= ProcessShader(world, entity, *shaderComp);
+        }
 
-        switch (loadState) {
-            case JzEAssetLoadState::Loaded:
-            {
-                JzMesh *mesh = m_assetManager->Get(meshComp.meshHandle);
-                if (mesh) {
-                    UpdateMeshComponentCache(meshComp, mesh);
-                    meshComp.isReady = true;
+        if (recheck) {
+            m_pendingEntities.insert(entity);
+        }
+    }
+}
 
-                    world.RemoveComponent<JzAssetLoadingTag>(entity);
-                    world.AddOrReplaceComponent<JzAssetReadyTag>(entity);
+Bool JzAssetSystem::ProcessMeshAsset(JzWorld &world, JzEntity entity, JzMeshAssetComponent &meshComp)
+{
+    if (meshComp.isReady || !meshComp.meshHandle.IsValid()) {
+        return false;
+    }
 
-                    JzRE_LOG_DEBUG("JzAssetSystem: Mesh asset ready for entity {}",
-                                   static_cast<U32>(entity));
-                }
-                break;
-            }
+    auto loadState = m_assetManager->GetLoadState(meshComp.meshHandle);
 
-            case JzEAssetLoadState::Loading:
-                if (!world.HasComponent<JzAssetLoadingTag>(entity)) {
-                    world.AddComponent<JzAssetLoadingTag>(entity);
-                }
-                break;
+    switch (loadState) {
+        case JzEAssetLoadState::Loaded:
+        {
+            JzMesh *mesh = m_assetManager->Get(meshComp.meshHandle);
+            if (mesh) {
+                UpdateMeshComponentCache(meshComp, mesh);
+                meshComp.isReady = true;
 
-            case JzEAssetLoadState::Failed:
                 world.RemoveComponent<JzAssetLoadingTag>(entity);
-                world.AddOrReplaceComponent<JzAssetLoadFailedTag>(entity);
-                JzRE_LOG_WARN("JzAssetSystem: Mesh asset load failed for entity {}",
-                              static_cast<U32>(entity));
-                break;
+                world.AddOrReplaceComponent<JzAssetReadyTag>(entity);
 
-            default:
-                break;
+                JzRE_LOG_DEBUG("JzAssetSystem: Mesh asset ready for entity {}",
+                               static_cast<U32>(entity));
+            }
+            break;
         }
+
+        case JzEAssetLoadState::Loading:
+            if (!world.HasComponent<JzAssetLoadingTag>(entity)) {
+                world.AddComponent<JzAssetLoadingTag>(entity);
+            }
+            WaitForAsset(meshComp.meshHandle, entity);
+            break;
+
+        case JzEAssetLoadState::Failed:
+            world.RemoveComponent<JzAssetLoadingTag>(entity);
+            world.AddOrReplaceComponent<JzAssetLoadFailedTag>(entity);
+            JzRE_LOG_WARN("JzAssetSystem: Mesh asset load failed for entity {}",
+                          static_cast<U32>(entity));
+            break;
+
+        default:
+            WaitForAsset(meshComp.meshHandle, entity);
+            break;
     }
+
+    return false;
 }
 
-void JzAssetSystem::ProcessMaterialAssets(JzWorld &world)
+Bool JzAssetSystem::ProcessMaterialAsset(JzWorld &world, JzEntity entity, JzMaterialAssetComponent &matComp)
 {
-    auto view = world.View<JzMaterialAssetComponent>();
-
-    for (auto entity : view) {
-        auto &matComp = view.get<JzMaterialAssetComponent>(entity);
-
-        if (matComp.isReady || !matComp.materialHandle.IsValid()) {
-            continue;
-        }
+    if (matComp.isReady || !matComp.materialHandle.IsValid()) {
+        return false;
+    }
 
-        auto loadState = m_assetManager->GetLoadState(matComp.materialHandle);
+    auto loadState = m_assetManager->GetLoadState(matComp.materialHandle);
 
-        switch (loadState) {
-            case JzEAssetLoadState::Loaded:
-            {
-                JzMaterial *material = m_assetManager->Get(matComp.materialHandle);
-                if (material) {
-                    UpdateMaterialComponentCache(matComp, material);
-                    matComp.isReady = true;
+    switch (loadState) {
+        case JzEAssetLoadState::Loaded:
+        {
+            JzMaterial *material = m_assetManager->Get(matComp.materialHandle);
+            if (material) {
+                UpdateMaterialComponentCache(matComp, material);
+                matComp.isReady = true;
 
-                    JzRE_LOG_DEBUG("JzAssetSystem: Material asset ready for entity {}",
-                                   static_cast<U32>(entity));
-                }
-                break;
+                JzRE_LOG_DEBUG("JzAssetSystem: Material asset ready for entity {}",
+                               static_cast<U32>(entity));
             }
+            break;
+        }
 
-            case JzEAssetLoadState::Loading:
-                break;
-
-            case JzEAssetLoadState::Failed:
-                JzRE_LOG_WARN("JzAssetSystem: Material asset load failed for entity {}",
-                              static_cast<U32>(entity));
-                break;
+        case JzEAssetLoadState::Failed:
+            JzRE_LOG_WARN("JzAssetSystem: Material asset load failed for entity {}",
+                          static_cast<U32>(entity));
+            break;
 
-            default:
-                break;
-        }
+        default:
+            WaitForAsset(matComp.materialHandle, entity);
+            break;
     }
+
+    return false;
 }
 
-void JzAssetSystem::ProcessShaders(JzWorld &world)
+Bool JzAssetSystem::ProcessShader(JzWorld &world, JzEntity entity, JzShaderComponent &shaderComp)
 {
-    auto view = world.View<JzShaderComponent>();
+    if (shaderComp.isReady || !shaderComp.shaderHandle.IsValid()) {
+        return false;
+    }
 
-    for (auto entity : view) {
-        auto &shaderComp = view.get<JzShaderComponent>(entity);
+    auto loadState = m_assetManager->GetLoadState(shaderComp.shaderHandle);
 
-        if (shaderComp.isReady || !shaderComp.shaderHandle.IsValid()) {
-            continue;
-        }
+    switch (loadState) {
+        case JzEAssetLoadState::Loaded:
+        {
+            JzShader *shader = m_assetManager->Get(shaderComp.shaderHandle);
+            if (!shader || !shader->IsCompiled()) {
+                // Compilation has no completion signal, so keep checking this entity
+                return true;
+            }
 
-        auto loadState = m_assetManager->GetLoadState(shaderComp.shaderHandle);
+            UpdateShaderComponentCache(shaderComp, shader);
+            // Keep polling while the requested variant compiles in the background
+            if (shader->IsVariantPending(shaderComp.keywordMask)) {
+                return true;
+            }
+            shaderComp.isReady = true;
 
-        switch (loadState) {
-            case JzEAssetLoadState::Loaded:
-            {
-                JzShader *shader = m_assetManager->Get(shaderComp.shaderHandle);
-                if (shader && shader->IsCompiled()) {
-                    UpdateShaderComponentCache(shaderComp, shader);
-                    shaderComp.isReady = true;
+            JzRE_LOG_DEBUG("JzAssetSystem: Shader ready for entity {}",
+                           static_cast<U32>(entity));
+            break;
+        }
 
-                    JzRE_LOG_DEBUG("JzAssetSystem: Shader ready for entity {}",
-                                   static_cast<U32>(entity));
-                }
-                break;
+        case JzEAssetLoadState::Loading:
+            if (!world.HasComponent<JzAssetLoadingTag>(entity)) {
+                world.AddComponent<JzAssetLoadingTag>(entity);
             }
+            WaitForAsset(shaderComp.shaderHandle, entity);
+            break;
 
-            case JzEAssetLoadState::Loading:
-                if (!world.HasComponent<JzAssetLoadingTag>(entity)) {
-                    world.AddComponent<JzAssetLoadingTag>(entity);
-                }
-                break;
-
-            case JzEAssetLoadState::Failed:
-                world.RemoveComponent<JzAssetLoadingTag>(entity);
-                world.AddOrReplaceComponent<JzAssetLoadFailedTag>(entity);
-                JzRE_LOG_WARN("JzAssetSystem: Shader load failed for entity {}",
-                              static_cast<U32>(entity));
-                break;
+        case JzEAssetLoadState::Failed:
+            world.RemoveComponent<JzAssetLoadingTag>(entity);
+            world.AddOrReplaceComponent<JzAssetLoadFailedTag>(entity);
+            JzRE_LOG_WARN("JzAssetSystem: Shader load failed for entity {}",
+                          static_cast<U32>(entity));
+            break;
 
-            default:
-                break;
-        }
+        default:
+            WaitForAsset(shaderComp.shaderHandle, entity);
+            break;
     }
+
+    return false;
 }
 
 void JzAssetSystem::UpdateMeshComponentCache(JzMeshAssetComponent &comp, JzMesh *mesh)
@@ -458,8 +518,8 @@ void JzAssetSystem::UpdateMaterialComponentCache(JzMaterialAssetComponent &comp,
     comp.baseColor = JzVec4(props.diffuseColor.x, props.diffuseColor.y, props.diffuseColor.z, props.opacity);
 
     comp.hasDiffuseTexture  = material->HasDiffuseTexture();
-    comp.hasNormalTexture   = false;
-    comp.hasSpecularTexture = false;
+    comp.hasNormalTexture   = comp.normalTextureHandle.IsValid();
+    comp.hasSpecularTexture = comp.specularTextureHandle.IsValid();
     comp.UpdateShaderKeywordMask();
 }
 
@@ -518,6 +578,76 @@ void JzAssetSystem::UpdateEntityAssetTags(JzWorld &world, JzEntity entity)
     }
 }
 
+// ==================== Readiness Tracking ====================
+
+void JzAssetSystem::ConnectObservers(JzWorld &world)
+{
+    DisconnectObservers();
+    m_observedWorld = &world;
+
+    world.OnConstruct<JzMeshAssetComponent>().connect<&JzAssetSystem::OnAssetComponentChanged>(*this);
+    world.OnUpdate<JzMeshAssetComponent>().connect<&JzAssetSystem::OnAssetComponentChanged>(*this);
+    world.OnConstruct<JzMaterialAssetComponent>().connect<&JzAssetSystem::OnAssetComponentChanged>(*this);
+    world.OnUpdate<JzMaterialAssetComponent>().connect<&JzAssetSystem::OnAssetComponentChanged>(*this);
+    world.OnConstruct<JzShaderComponent>().connect<&JzAssetSystem::OnAssetComponentChanged>(*this);
+    world.OnUpdate<JzShaderComponent>().connect<&JzAssetSystem::OnAssetComponentChanged>(*this);
+
+    // Components added before the system was initialized get one pass
+    for (auto entity : world.View<JzMeshAssetComponent>()) {
+        m_pendingEntities.insert(entity);
+    }
+    for (auto entity : world.View<JzMaterialAssetComponent>()) {
+        m_pendingEntities.insert(entity);
+    }
+    for (auto entity : world.View<JzShaderComponent>()) {
+        m_pendingEntities.insert(entity);
+    }
+}
+
+void JzAssetSystem::DisconnectObservers()
+{
+    if (!m_observedWorld) {
+        return;
+    }
+
+    m_observedWorld->OnConstruct<JzMeshAssetComponent>().disconnect(this);
+    m_observedWorld->OnUpdate<JzMeshAssetComponent>().disconnect(this);
+    m_observedWorld->OnConstruct<JzMaterialAssetComponent>().disconnect(this);
+    m_observedWorld->OnUpdate<JzMaterialAssetComponent>().disconnect(this);
+    m_observedWorld->OnConstruct<JzShaderComponent>().disconnect(this);
+    m_observedWorld->OnUpdate<JzShaderComponent>().disconnect(this);
+
+    m_observedWorld = nullptr;
+    m_pendingEntities.clear();
+    m_entitiesWaitingOnAsset.clear();
+}
+
+void JzAssetSystem::OnAssetComponentChanged(entt::registry &, JzEntity entity)
+{
+    m_pendingEntities.insert(entity);
+}
+
+void JzAssetSystem::OnAssetLoadFinished(const JzAssetLoadResult &result)
+{
+    WakeEntitiesWaitingOn(result.typeIndex, result.id);
+}
+
+void JzAssetSystem::WakeEntitiesWaitingOn(std::type_index type, JzAssetId id)
+{
+    auto typeIt = m_entitiesWaitingOnAsset.find(type);
+    if (typeIt == m_entitiesWaitingOnAsset.end()) {
+        return;
+    }
+
+    auto it = typeIt->second.find(id);
+    if (it == typeIt->second.end()) {
+        return;
+    }
+
+    m_pendingEntities.insert(it->second.begin(), it->second.end());
+    typeIt->second.erase(it);
+}
+
 // ==================== Hot Reload Configuration ====================
 
 void JzAssetSystem::SetHotReloadEnabled(Bool enabled)
@@ -567,6 +697,7 @@ Bool JzAssetSystem::ReloadShader(JzShaderHandle shaderHandle)
     if (success) {
         ++m_shaderReloadCount;
         ++m_totalReloadCount;
+        WakeEntitiesWaitingOn(std::type_index(typeid(JzShader)), shaderHandle.GetId());
         JzRE_LOG_INFO("JzAssetSystem: Reloaded shader '{}'", shader->GetName());
     } else {
         JzRE_LOG_ERROR("JzAssetSystem: Failed to reload shader '{}'", shader->GetName());
@@ -589,16 +720,19 @@ Size JzAssetSystem::GetShaderReloadCount() const
 
 // ==================== Hot Reload Internal ====================
 
-void JzAssetSystem::CheckForHotReloadUpdates(JzWorld &world)
+void JzAssetSystem::CheckForHotReloadUpdates(JzWorld &world, Bool checkAll)
 {
     // Check shaders (currently the only asset type with hot reload support)
-    CheckShaderHotReload(world);
+    CheckShaderHotReload(world, checkAll);
 
     // Future: Add CheckTextureHotReload(world);
     // Future: Add CheckMaterialHotReload(world);
+
+    m_changedFiles.clear();
+    m_rescanDirectories.clear();
 }
 
-void JzAssetSystem::CheckShaderHotReload(JzWorld &world)
+void JzAssetSystem::CheckShaderHotReload(JzWorld &world, Bool checkAll)
 {
     auto usedShaders = CollectUsedShaders(world);
 
@@ -608,6 +742,12 @@ void JzAssetSystem::CheckShaderHotReload(JzWorld &world)
             continue;
         }
 
+        // Shaders whose files cannot be watched keep being polled
+        const Bool watched = m_fileWatcher && WatchShaderFiles(*shader);
+        if (!checkAll && watched && !HasChangedFile(*shader)) {
+            continue;
+        }
+
         if (shader->NeedsReload()) {
             JzRE_LOG_INFO("JzAssetSystem: Detected change in shader '{}'", shader->GetName());
 
@@ -624,8 +764,73 @@ void JzAssetSystem::CheckShaderHotReload(JzWorld &world)
     }
 }
 
+Bool JzAssetSystem::HasChangedFile(const JzShader &shader) const
+{
+    for (const auto &file : shader.GetDependentFiles()) {
+        if (file.empty()) {
+            continue;
+        }
+
+        const auto path = JzFileWatcher::NormalizePath(file);
+        if (m_changedFiles.contains(path.string()) || m_rescanDirectories.contains(path.parent_path().string())) {
+            return true;
+        }
+    }
+    return false;
+}
+
+Bool JzAssetSystem::WatchShaderFiles(const JzShader &shader)
+{
+    Bool allWatched = true;
+    for (const auto &file : shader.GetDependentFiles()) {
+        if (file.empty()) {
+            continue;
+        }
+
+        const auto directory = JzFileWatcher::NormalizePath(file).parent_path();
+        const auto key       = directory.string();
+
+        auto iter = m_watchedDirectories.find(key);
+        if (iter == m_watchedDirectories.end()) {
+            iter = m_watchedDirectories.emplace(key, WatchShaderDirectory(directory)).first;
+        }
+        allWatched = allWatched && iter->second != 0;
+    }
+    return allWatched;
+}
+
+JzFileWatchHandle JzAssetSystem::WatchShaderDirectory(const std::filesystem::path &directory)
+{
+    return m_fileWatcher->Watch(directory, false, [this](const std::vector<JzFileChange> &changes) {
+        for (const auto &change : changes) {
+            if (change.kind == JzEFileChangeKind::Rescan) {
+                m_rescanDirectories.insert(change.path.string());
+            } else {
+                m_changedFiles.insert(change.path.string());
+            }
+        }
+    });
+}
+
+void JzAssetSystem::UnwatchAll()
+{
+    if (m_fileWatcher) {
+        for (const auto &[directory, handle] : m_watchedDirectories) {
+            if (handle != 0) {
+                m_fileWatcher->Unwatch(handle);
+            }
+        }
+    }
+    m_watchedDirectories.clear();
+    m_changedFiles.clear();
+    m_rescanDirectories.clear();
+    m_fileWatcher = nullptr;
+}
+
 void JzAssetSystem::NotifyShaderReloaded(JzShaderHandle shaderHandle, JzWorld &world)
 {
+    WakeEntitiesWaitingOn(std::type_index(typeid(JzShader)), shaderHandle.GetId());
+
     // Mark all entities with this shader as dirty
     auto shaderView = world.View<JzShaderComponent>();
     for (auto entity : shaderView) {
@@ -634,6 +839,7 @@ void JzAssetSystem::NotifyShaderReloaded(JzShaderHandle shaderHandle, JzWorld &w
             // Reset ready state to trigger recompilation
             shaderComp.isReady       = false;
             shaderComp.cachedVariant = nullptr;
+            m_pendingEntities.insert(entity);
 
             // Add dirty tag for render systems
             world.AddOrReplaceComponent<JzShaderDirtyTag>(entity);
@@ -80,6 +80,13 @@ void JzInputSystem::SyncLegacyComponentsFromInputState(JzWorld &world)
         return;
     }
 
+    // Sync once more on the first quiet frame so per-frame fields read false again,
+    // then skip until the input state changes
+    if (!primaryInput->changed && !m_legacySyncPending) {
+        return;
+    }
+    m_legacySyncPending = primaryInput->changed;
+
     const auto &inputState = *primaryInput;
 
     // Sync JzMouseInputComponent from JzInputStateComponent
@@ -308,26 +315,19 @@ void JzInputSystem::EmitKeyboardEvents(JzWorld &world)
 
     const auto &keyboard = inputState->keyboard;
 
-    for (I32 key = 0; key < static_cast<I32>(JzInputStateComponent::KeyboardState::KEY_COUNT); ++key) {
-        Bool currentPressed = keyboard.keysPressed[static_cast<Size>(key)];
-        Bool wasPressed     = m_prevKeysPressed[static_cast<Size>(key)];
+    // Only keys in the delta list can have edges this frame
+    for (U16 key : keyboard.changedKeys) {
+        std::array<Bool, 3> edges;
+        const U32           edgeCount = keyboard.GetKeyEdges(key, edges);
 
-        if (currentPressed && !wasPressed) {
-            JzKeyEvent event;
-            event.source = m_primaryWindowEntity;
-            event.key    = static_cast<JzEKeyCode>(key);
-            event.action = JzEKeyAction::Pressed;
-            dispatcher->Send(std::move(event));
-        } else if (!currentPressed && wasPressed) {
+        for (U32 edge = 0; edge < edgeCount; ++edge) {
             JzKeyEvent event;
             event.source = m_primaryWindowEntity;
             event.key    = static_cast<JzEKeyCode>(key);
-            event.action = JzEKeyAction::Released;
+            event.action = edges[edge] ? JzEKeyAction::Pressed : JzEKeyAction::Released;
             dispatcher->Send(std::move(event));
         }
     }
-
-    m_prevKeysPressed = keyboard.keysPressed;
 }
 
 void JzInputSystem::EmitMouseEvents(JzWorld &world)
@@ -341,28 +341,20 @@ void JzInputSystem::EmitMouseEvents(JzWorld &world)
 
     const auto &mouse = inputState->mouse;
 
-    // Mouse button events
-    for (I32 button = 0; button < static_cast<I32>(JzInputStateComponent::MouseState::BUTTON_COUNT); ++button) {
-        Bool currentPressed = mouse.buttonsPressed[static_cast<Size>(button)];
-        Bool wasPressed     = m_prevButtonsPressed[static_cast<Size>(button)];
+    // Mouse button events, in arrival order like keys
+    for (U8 button : mouse.changedButtons) {
+        std::array<Bool, 3> edges;
+        const U32           edgeCount = mouse.GetButtonEdges(button, edges);
 
-        if (currentPressed && !wasPressed) {
-            JzMouseButtonEvent event;
-            event.source   = m_primaryWindowEntity;
-            event.button   = static_cast<JzEMouseButton>(button);
-            event.action   = JzEKeyAction::Pressed;
-            event.position = mouse.position;
-            dispatcher->Send(std::move(event));
-        } else if (!currentPressed && wasPressed) {
+        for (U32 edge = 0; edge < edgeCount; ++edge) {
             JzMouseButtonEvent event;
             event.source   = m_primaryWindowEntity;
             event.button   = static_cast<JzEMouseButton>(button);
-            event.action   = JzEKeyAction::Released;
+            event.action   = edges[edge] ? JzEKeyAction::Pressed : JzEKeyAction::Released;
             event.position = mouse.position;
             dispatcher->Send(std::move(event));
         }
     }
-    m_prevButtonsPressed = mouse.buttonsPressed;
 
     // Mouse move event (only if delta is non-zero)
     if (mouse.positionDelta.x != 0.0f || mouse.positionDelta.y != 0.0f) {
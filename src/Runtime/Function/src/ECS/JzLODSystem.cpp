@@ -0,0 +1,116 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Function/ECS/JzLODSystem.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "JzRE/Runtime/Function/ECS/JzAssetComponents.h"
+#include "JzRE/Runtime/Function/ECS/JzCameraComponents.h"
+#include "JzRE/Runtime/Function/ECS/JzRenderComponents.h"
+#include "JzRE/Runtime/Function/ECS/JzTransformComponents.h"
+#include "JzRE/Runtime/Function/ECS/JzWindowComponents.h"
+
+namespace JzRE {
+
+void JzLODSystem::OnInit(JzWorld &world)
+{
+    // Nothing to initialize
+}
+
+void JzLODSystem::Update(JzWorld &world, F32 delta)
+{
+    // Find the main camera
+    const JzCameraComponent *mainCamera = nullptr;
+    auto                     cameraView = world.View<JzCameraComponent>();
+    for (auto entity : cameraView) {
+        const auto &camera = world.GetComponent<JzCameraComponent>(entity);
+        if (camera.isMainCamera) {
+            mainCamera = &camera;
+            break;
+        }
+    }
+    if (!mainCamera) {
+        return;
+    }
+
+    F32  viewportHeight = 720.0f;
+    auto windowView     = world.View<JzWindowStateComponent>();
+    if (!windowView.empty()) {
+        const auto &windowState = world.GetComponent<JzWindowStateComponent>(windowView.front());
+        viewportHeight          = static_cast<F32>(std::max(windowState.framebufferSize.y, 1));
+    }
+
+    // Pixels covered by one world unit at distance 1
+    const F32 fovRadians = mainCamera->fov * 3.14159265358979323846f / 180.0f;
+    const F32 projScale  = viewportHeight / (2.0f * std::tan(fovRadians * 0.5f));
+
+    auto view = world.View<JzTransformComponent, JzMeshAssetComponent, JzAssetReadyTag>(
+        JzExclude<JzStaticBatchMemberComponent>);
+    for (auto entity : view) {
+        auto &meshComp = world.GetComponent<JzMeshAssetComponent>(entity);
+        if (meshComp.lodMeshHandles.empty()) {
+            meshComp.activeLod = 0;
+            continue;
+        }
+
+        auto         &transform = world.GetComponent<JzTransformComponent>(entity);
+        const JzMat4 &world4    = transform.GetWorldMatrix();
+        const JzVec4  center    = world4 * JzVec4(meshComp.boundsCenter.x, meshComp.boundsCenter.y,
+                                                  meshComp.boundsCenter.z, 1.0f);
+        const F32     maxScale  = std::max({std::abs(transform.scale.x), std::abs(transform.scale.y),
+                                            std::abs(transform.scale.z)});
+        const F32     radius    = meshComp.boundsRadius * maxScale;
+
+        const JzVec3 toCenter = JzVec3(center.x, center.y, center.z) - mainCamera->position;
+        const F32    distance = std::max(toCenter.Length() - radius, mainCamera->nearPlane);
+
+        // Errors are in object space, so fold the transform scale into the projection
+        const F32 pixelsPerUnit = projScale * maxScale / distance;
+
+        if (meshComp.boundsRadius * pixelsPerUnit < m_minScreenRadius) {
+            meshComp.activeLod = static_cast<U32>(meshComp.lodMeshHandles.size());
+            continue;
+        }
+
+        meshComp.activeLod = SelectLOD(meshComp.lodErrors, meshComp.activeLod, pixelsPerUnit,
+                                       m_errorThreshold, m_hysteresis);
+    }
+}
+
+U32 JzLODSystem::SelectLOD(const std::vector<F32> &lodErrors, U32 currentLod, F32 pixelsPerUnit,
+                           F32 errorThreshold, F32 hysteresis)
+{
+    const U32 levelCount = static_cast<U32>(lodErrors.size());
+    currentLod           = std::min(currentLod, levelCount);
+
+    // Coarsest level whose projected error fits the threshold
+    U32 desired = 0;
+    for (U32 level = 1; level <= levelCount; ++level) {
+        if (lodErrors[level - 1] * pixelsPerUnit > errorThreshold) {
+            break;
+        }
+        desired = level;
+    }
+
+    if (desired <= currentLod) {
+        // Refining is applied immediately to avoid visible popping of detail
+        return desired;
+    }
+
+    // Coarsening only happens once the error is comfortably below the threshold
+    const F32 coarsenThreshold = errorThreshold * (1.0f - hysteresis);
+    U32       selected         = currentLod;
+    for (U32 level = currentLod + 1; level <= desired; ++level) {
+        if (lodErrors[level - 1] * pixelsPerUnit > coarsenThreshold) {
+            break;
+        }
+        selected = level;
+    }
+    return selected;
+}
+
+} // namespace JzRE
@@ -37,6 +37,8 @@ void JzLightSystem::Update(JzWorld &world, F32 delta)
             data.innerCutoff = 0.0f;
             data.outerCutoff = 0.0f;
             data.type        = JzELightType::Directional;
+            data.entity      = entity;
+            data.castShadow  = lightComp.castShadow;
 
             m_lights.push_back(data);
 
@@ -66,6 +68,7 @@ void JzLightSystem::Update(JzWorld &world, F32 delta)
             data.innerCutoff = 0.0f;
             data.outerCutoff = 0.0f;
             data.type        = JzELightType::Point;
+            data.entity      = entity;
 
             m_lights.push_back(data);
         }
@@ -87,6 +90,8 @@ void JzLightSystem::Update(JzWorld &world, F32 delta)
             data.innerCutoff = lightComp.innerCutoff;
             data.outerCutoff = lightComp.outerCutoff;
             data.type        = JzELightType::Spot;
+            data.entity      = entity;
+            data.castShadow  = lightComp.castShadow;
 
             m_lights.push_back(data);
         }
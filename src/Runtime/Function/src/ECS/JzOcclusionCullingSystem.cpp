@@ -0,0 +1,132 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Function/ECS/JzOcclusionCullingSystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#include "JzRE/Runtime/Core/JzProfiler.h"
+#include "JzRE/Runtime/Core/JzServiceContainer.h"
+#include "JzRE/Runtime/Function/ECS/JzAssetComponents.h"
+#include "JzRE/Runtime/Function/ECS/JzAssetSystem.h"
+#include "JzRE/Runtime/Function/ECS/JzCameraComponents.h"
+#include "JzRE/Runtime/Function/ECS/JzRenderComponents.h"
+#include "JzRE/Runtime/Function/ECS/JzTransformComponents.h"
+#include "JzRE/Runtime/Resource/JzMesh.h"
+
+namespace JzRE {
+
+namespace {
+
+/**
+ * @brief World-space bounding sphere of a mesh, as in JzLODSystem.
+ */
+JzVec4 WorldBounds(JzTransformComponent &transform, const JzMeshAssetComponent &meshComp)
+{
+    const JzVec4 center = transform.GetWorldMatrix() *
+                          JzVec4(meshComp.boundsCenter.x, meshComp.boundsCenter.y, meshComp.boundsCenter.z, 1.0f);
+    const F32    scale  = std::max({std::abs(transform.scale.x), std::abs(transform.scale.y),
+                                    std::abs(transform.scale.z)});
+    return JzVec4(center.x, center.y, center.z, meshComp.boundsRadius * scale);
+}
+
+} // namespace
+
+void JzOcclusionCullingSystem::Update(JzWorld &world, F32 delta)
+{
+    // Find the main camera
+    const JzCameraComponent *mainCamera = nullptr;
+    auto                     cameraView = world.View<JzCameraComponent>();
+    for (auto entity : cameraView) {
+        const auto &camera = world.GetComponent<JzCameraComponent>(entity);
+        if (camera.isMainCamera) {
+            mainCamera = &camera;
+            break;
+        }
+    }
+    if (!mainCamera || !JzServiceContainer::Has<JzAssetSystem>()) {
+        ClearResults(world);
+        return;
+    }
+
+    JzRE_PROFILE_SCOPE("OcclusionCullingSystem_Update");
+
+    if (!m_threadPool) {
+        m_threadPool = std::make_unique<JzThreadPool>(std::max<Size>(std::thread::hardware_concurrency() / 2, 1));
+        m_culler.SetThreadPool(m_threadPool.get());
+    }
+
+    m_culler.BeginFrame(mainCamera->viewMatrix, mainCamera->projectionMatrix);
+
+    // Occluders draw their coarsest level; the mesh data stays resident until Rasterize returns
+    auto &assetSystem  = JzServiceContainer::Get<JzAssetSystem>();
+    auto  occluderView = world.View<JzOccluderTag, JzTransformComponent, JzMeshAssetComponent, JzAssetReadyTag>();
+    for (auto entity : occluderView) {
+        auto       &transform = world.GetComponent<JzTransformComponent>(entity);
+        const auto &meshComp  = world.GetComponent<JzMeshAssetComponent>(entity);
+
+        const JzMeshHandle proxyHandle = meshComp.lodMeshHandles.empty() ? meshComp.meshHandle
+                                                                         : meshComp.lodMeshHandles.back();
+        const auto        *mesh        = assetSystem.Get(proxyHandle);
+        if (!mesh) {
+            mesh = assetSystem.Get(meshComp.meshHandle);
+        }
+        if (!mesh || mesh->GetVertices().empty()) {
+            continue;
+        }
+
+        const JzVec4   bounds = WorldBounds(transform, meshComp);
+        JzOccluderMesh occluder;
+        occluder.vertices     = &mesh->GetVertices();
+        occluder.indices      = &mesh->GetIndices();
+        occluder.worldMatrix  = transform.GetWorldMatrix();
+        occluder.boundsCenter = JzVec3(bounds.x, bounds.y, bounds.z);
+        occluder.boundsRadius = bounds.w;
+        m_culler.AddOccluder(occluder);
+    }
+    m_culler.Rasterize();
+
+    m_candidates.clear();
+    m_spheres.clear();
+    auto view = world.View<JzTransformComponent, JzMeshAssetComponent, JzMaterialAssetComponent, JzAssetReadyTag>(
+        JzExclude<JzStaticBatchMemberComponent>);
+    for (auto entity : view) {
+        auto &transform = world.GetComponent<JzTransformComponent>(entity);
+        auto &meshComp  = world.GetComponent<JzMeshAssetComponent>(entity);
+
+        // Unknown bounds and the occluders themselves are always drawn
+        if (meshComp.boundsRadius <= 0.0f || world.HasComponent<JzOccluderTag>(entity)) {
+            meshComp.occluded = false;
+            continue;
+        }
+        m_candidates.push_back(entity);
+        m_spheres.push_back(WorldBounds(transform, meshComp));
+    }
+
+    m_culler.TestSpheres(m_spheres, m_occluded);
+
+    for (Size i = 0; i < m_candidates.size(); ++i) {
+        world.GetComponent<JzMeshAssetComponent>(m_candidates[i]).occluded = m_occluded[i] != 0;
+    }
+}
+
+void JzOcclusionCullingSystem::OnShutdown(JzWorld &world)
+{
+    ClearResults(world);
+    m_culler.SetThreadPool(nullptr);
+    m_threadPool.reset();
+}
+
+void JzOcclusionCullingSystem::ClearResults(JzWorld &world)
+{
+    auto view = world.View<JzMeshAssetComponent>();
+    for (auto entity : view) {
+        world.GetComponent<JzMeshAssetComponent>(entity).occluded = false;
+    }
+}
+
+} // namespace JzRE
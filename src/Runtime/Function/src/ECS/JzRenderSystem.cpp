@@ -8,9 +8,12 @@
 #include <algorithm>
 
 #include "JzRE/Runtime/Core/JzLogger.h"
+#include "JzRE/Runtime/Core/JzProfiler.h"
 #include "JzRE/Runtime/Core/JzServiceContainer.h"
 #include "JzRE/Runtime/Function/ECS/JzAssetComponents.h"
 #include "JzRE/Runtime/Function/ECS/JzCameraComponents.h"
+#include "JzRE/Runtime/Function/ECS/JzEntityComponents.h"
+#include "JzRE/Runtime/Function/ECS/JzLightSystem.h"
 #include "JzRE/Runtime/Function/ECS/JzRenderComponents.h"
 #include "JzRE/Runtime/Function/ECS/JzTransformComponents.h"
 #include "JzRE/Runtime/Function/ECS/JzWindowComponents.h"
@@ -20,6 +23,7 @@
 #include "JzRE/Runtime/Resource/JzMaterial.h"
 #include "JzRE/Runtime/Resource/JzMesh.h"
 #include "JzRE/Runtime/Resource/JzShader.h"
+#include "JzRE/Runtime/Resource/JzTexture.h"
 
 namespace JzRE {
 
@@ -47,24 +51,145 @@ void JzRenderSystem::Update(JzWorld &world, F32 delta)
 {
     (void)delta;
 
-    auto windowView = world.View<JzWindowStateComponent>();
-    Bool shouldBlit = false;
+    Extract(world);
+    PublishSnapshot();
+    PrepareFrame();
+    Render();
+}
+
+void JzRenderSystem::Extract(JzWorld &world)
+{
+    JzRE_PROFILE_SCOPE("RenderExtract");
 
+    auto &snapshot = m_snapshots.BeginWrite();
+
+    auto windowView = world.View<JzWindowStateComponent>();
     if (!windowView.empty()) {
         const auto &windowState = world.GetComponent<JzWindowStateComponent>(windowView.front());
+        snapshot.hasWindow      = true;
+        snapshot.frameSize      = windowState.framebufferSize;
+        snapshot.windowVisible  = windowState.visible;
+
+        // Read by the default target's getDesiredSize below
         if (m_frameSize != windowState.framebufferSize) {
             m_frameSize        = windowState.framebufferSize;
             m_frameSizeChanged = true;
         }
-        shouldBlit = windowState.visible;
     }
 
-    if (m_frameSizeChanged) {
-        m_frameSizeChanged = false;
+    // Target records and contribution callbacks belong to the game thread, so they are resolved here
+    for (const auto &record : m_renderTargets) {
+        if (!record.output || (record.desc.shouldRender && !record.desc.shouldRender())) {
+            continue;
+        }
+
+        JzIVec2 desiredSize(0, 0);
+        if (record.desc.getDesiredSize) {
+            desiredSize = record.desc.getDesiredSize();
+            if (desiredSize.x <= 0 || desiredSize.y <= 0) {
+                continue;
+            }
+        }
+
+        auto &target       = snapshot.targets.emplace_back();
+        target.handle      = record.handle;
+        target.name        = record.desc.name;
+        target.camera      = record.desc.camera;
+        target.visibility  = record.desc.visibility;
+        target.features    = record.desc.features;
+        target.desiredSize = desiredSize;
+        target.isDefault   = record.handle == m_defaultRenderTargetHandle;
+        target.output      = record.output;
+        target.lighting    = record.lighting;
+    }
+
+    for (const auto &contribution : m_graphContributions) {
+        if (contribution.enabledExecute && !contribution.enabledExecute()) {
+            continue;
+        }
+        snapshot.contributions.push_back(contribution);
+    }
+
+    auto cameraView = world.View<JzCameraComponent>();
+    for (auto entity : cameraView) {
+        const auto &camera = world.GetComponent<JzCameraComponent>(entity);
+
+        auto &cameraData            = snapshot.cameras.emplace_back();
+        cameraData.entity           = entity;
+        cameraData.viewMatrix       = camera.viewMatrix;
+        cameraData.projectionMatrix = camera.projectionMatrix;
+        cameraData.clearColor       = camera.clearColor;
+        cameraData.isMainCamera     = camera.isMainCamera;
+    }
+
+    if (auto **lightSystem = world.TryGetContext<JzLightSystem *>(); lightSystem && *lightSystem) {
+        snapshot.lights = (*lightSystem)->GetLights();
+    }
+
+    // Entities merged into a static batch are drawn by the batch entity
+    auto views = world.View<JzTransformComponent, JzMeshAssetComponent, JzMaterialAssetComponent,
+                            JzAssetReadyTag>(JzExclude<JzStaticBatchMemberComponent>);
+
+    for (auto entity : views) {
+        auto &transform = world.GetComponent<JzTransformComponent>(entity);
+        auto &meshComp  = world.GetComponent<JzMeshAssetComponent>(entity);
+        auto &matComp   = world.GetComponent<JzMaterialAssetComponent>(entity);
+
+        auto &draw              = snapshot.draws.emplace_back();
+        draw.entity             = entity;
+        draw.modelMatrix        = transform.GetWorldMatrix();
+        draw.meshHandle         = meshComp.GetActiveMeshHandle();
+        draw.fallbackMeshHandle = meshComp.meshHandle;
+        draw.materialHandle     = matComp.materialHandle;
+        draw.ambientColor       = matComp.ambientColor;
+        draw.diffuseColor       = matComp.diffuseColor;
+        draw.specularColor      = matComp.specularColor;
+        draw.shininess          = matComp.shininess;
+        if (matComp.hasNormalTexture) {
+            draw.normalTextureHandle = matComp.normalTextureHandle;
+        }
+        if (matComp.hasSpecularTexture) {
+            draw.specularTextureHandle = matComp.specularTextureHandle;
+        }
+        draw.visibility         = ResolveRenderChannel(world, entity);
+        draw.isStatic           = world.HasComponent<JzStaticTag>(entity);
+        draw.occluded           = meshComp.occluded;
+
+        const JzVec4 center = draw.modelMatrix * JzVec4(meshComp.boundsCenter.x, meshComp.boundsCenter.y,
+                                                        meshComp.boundsCenter.z, 1.0f);
+        const F32    scale  = std::max({std::abs(transform.scale.x), std::abs(transform.scale.y),
+                                        std::abs(transform.scale.z)});
+        draw.boundsCenter   = JzVec3(center.x, center.y, center.z);
+        draw.boundsRadius   = meshComp.boundsRadius * scale;
     }
+}
 
-    auto geometryPipeline = ResolveGeometryPipeline();
-    m_isInitialized       = geometryPipeline != nullptr;
+void JzRenderSystem::PublishSnapshot()
+{
+    m_snapshots.Publish();
+}
+
+void JzRenderSystem::PrepareFrame()
+{
+    m_standardShader   = ResolveStandardShader();
+    m_geometryPipeline = ResolveGeometryPipeline();
+    m_isInitialized    = m_geometryPipeline != nullptr;
+}
+
+const JzRenderSnapshot &JzRenderSystem::GetRenderSnapshot() const
+{
+    return m_snapshots.GetPublished();
+}
+
+void JzRenderSystem::Render()
+{
+    const auto &snapshot = m_snapshots.GetPublished();
+
+    m_geometryPool.BeginFrame();
+
+    const Bool shouldBlit = snapshot.hasWindow && snapshot.windowVisible;
+
+    auto geometryPipeline = m_geometryPipeline;
 
     m_renderGraph.SetTransitionCallback(
         [this](JzRHICommandList                  &commandList,
@@ -95,17 +220,14 @@ void JzRenderSystem::Update(JzWorld &world, F32 delta)
 
     m_renderGraph.Reset();
 
-    // Unified render target loop: default target and registered targets share the same path.
-    for (auto &record : m_renderTargets) {
-        auto &desc = record.desc;
-        if (!record.output) {
-            continue;
-        }
+    const JzRGTexture shadowAtlas = AddShadowPasses(snapshot, geometryPipeline);
 
-        auto   &output      = *record.output;
+    // Unified render target loop: default target and registered targets share the same path.
+    for (const auto &target : snapshot.targets) {
+        auto   &output      = *target.output;
         JzIVec2 desiredSize = output.GetSize();
-        if (desc.getDesiredSize) {
-            desiredSize = desc.getDesiredSize();
+        if (target.desiredSize.x > 0 && target.desiredSize.y > 0) {
+            desiredSize = target.desiredSize;
             output.EnsureSize(desiredSize);
         }
 
@@ -113,75 +235,63 @@ void JzRenderSystem::Update(JzWorld &world, F32 delta)
             continue;
         }
 
-        const String colorName   = desc.name + "_Color";
-        const String depthName   = desc.name + "_Depth";
+        const String colorName   = target.name + "_Color";
+        const String depthName   = target.name + "_Depth";
         JzRGTexture  targetColor = m_renderGraph.CreateTexture(
             {desiredSize, JzETextureResourceFormat::RGBA8, false, colorName});
+        // Depth only matters within the frame, so the last pass need not store it
         JzRGTexture targetDepth = m_renderGraph.CreateTexture(
-            {desiredSize, JzETextureResourceFormat::Depth24, false, depthName});
+            {desiredSize, JzETextureResourceFormat::Depth24, true, depthName});
 
         m_renderGraph.BindTexture(targetColor, output.GetColorTexture());
         m_renderGraph.BindTexture(targetDepth, output.GetDepthTexture());
         m_renderGraph.BindRenderTarget(targetColor, targetDepth, output.GetFramebuffer());
 
         // Determine contribution scope for this target.
-        const Bool isDefault   = (record.handle == m_defaultRenderTargetHandle);
-        const auto targetScope = isDefault ? JzRenderGraphContributionScope::MainScene : JzRenderGraphContributionScope::RegisteredTarget;
+        const auto targetScope = target.isDefault ? JzRenderGraphContributionScope::MainScene : JzRenderGraphContributionScope::RegisteredTarget;
 
         // Geometry pass: direct execution, no contribution dispatch.
         m_renderGraph.AddPass({
-            desc.name + "_GeometryPass",
-            desc.shouldRender ? desc.shouldRender : nullptr,
-            [desiredSize, targetColor, targetDepth](JzRGBuilder &builder) {
+            target.name + "_GeometryPass",
+            nullptr,
+            [desiredSize, targetColor, targetDepth, shadowAtlas](JzRGBuilder &builder) {
                 builder.Write(targetColor, JzRGUsage::Write);
                 builder.Write(targetDepth, JzRGUsage::Write);
+                if (shadowAtlas.id != 0) {
+                    builder.Read(shadowAtlas, JzRGUsage::Read);
+                }
                 builder.SetRenderTarget(targetColor, targetDepth);
                 builder.SetViewport(desiredSize);
             },
-            [this, &world, camera = desc.camera, visibility = desc.visibility,
-             geometryPipeline](const JzRGPassContext &passContext) {
-                ExecuteGeometryStage(world, passContext, camera, visibility, geometryPipeline);
+            [this, &snapshot, camera = target.camera, visibility = target.visibility,
+             geometryPipeline, lighting = target.lighting](const JzRGPassContext &passContext) {
+                ExecuteGeometryStage(snapshot, passContext, camera, visibility, geometryPipeline, lighting.get());
             },
         });
 
         // Contribution passes for this target.
-        for (const auto &contribution : m_graphContributions) {
-            const auto contributionName = contribution.name;
-            if (contributionName.empty()) {
+        for (const auto &contribution : snapshot.contributions) {
+            if (contribution.name.empty()) {
                 continue;
             }
             if (!HasContributionScope(contribution.scope, targetScope)) {
                 continue;
             }
+            if (!IsContributionEnabled(target.features, contribution.requiredFeature)) {
+                continue;
+            }
 
             m_renderGraph.AddPass({
-                desc.name + "_" + contributionName + "_ContributionPass",
-                [this,
-                 shouldRender        = desc.shouldRender,
-                 targetFeatures      = desc.features,
-                 requiredFeature     = contribution.requiredFeature,
-                 contributionEnabled = contribution.enabledExecute]() {
-                    if (shouldRender && !shouldRender()) {
-                        return false;
-                    }
-                    if (!IsContributionEnabled(targetFeatures, requiredFeature)) {
-                        return false;
-                    }
-                    if (contributionEnabled && !contributionEnabled()) {
-                        return false;
-                    }
-                    return true;
-                },
+                target.name + "_" + contribution.name + "_ContributionPass",
+                nullptr,
                 [desiredSize, targetColor, targetDepth](JzRGBuilder &builder) {
                     builder.Write(targetColor, JzRGUsage::Write);
                     builder.Write(targetDepth, JzRGUsage::Write);
                     builder.SetRenderTarget(targetColor, targetDepth);
                     builder.SetViewport(desiredSize);
                 },
-                [this, &world, camera = desc.camera,
-                 visibility = desc.visibility, features = desc.features, contribution](const JzRGPassContext &passContext) {
-                    ExecuteContribution(world, passContext, camera, visibility, features,
-                                        contribution);
+                [this, &snapshot, &target, &contribution](const JzRGPassContext &passContext) {
+                    ExecuteContribution(snapshot, passContext, target, contribution);
                 },
             });
         }
@@ -191,7 +301,12 @@ void JzRenderSystem::Update(JzWorld &world, F32 delta)
     m_renderGraph.Execute(device);
 
     if (shouldBlit) {
-        BlitToScreen(static_cast<U32>(m_frameSize.x), static_cast<U32>(m_frameSize.y));
+        for (const auto &target : snapshot.targets) {
+            if (target.isDefault) {
+                BlitOutputToScreen(*target.output, static_cast<U32>(snapshot.frameSize.x),
+                                   static_cast<U32>(snapshot.frameSize.y));
+            }
+        }
     }
 }
 
@@ -255,7 +370,16 @@ void JzRenderSystem::EndFrame()
 void JzRenderSystem::BlitToScreen(U32 screenWidth, U32 screenHeight)
 {
     auto *output = GetDefaultRenderOutput();
-    if (!output || !output->IsValid()) {
+    if (!output) {
+        return;
+    }
+
+    BlitOutputToScreen(*output, screenWidth, screenHeight);
+}
+
+void JzRenderSystem::BlitOutputToScreen(const JzRenderOutput &output, U32 screenWidth, U32 screenHeight)
+{
+    if (!output.IsValid()) {
         return;
     }
 
@@ -266,9 +390,9 @@ void JzRenderSystem::BlitToScreen(U32 screenWidth, U32 screenHeight)
     }
 
     commandList->Begin();
-    commandList->BlitFramebufferToScreen(output->GetFramebuffer(),
-                                         static_cast<U32>(m_frameSize.x),
-                                         static_cast<U32>(m_frameSize.y),
+    commandList->BlitFramebufferToScreen(output.GetFramebuffer(),
+                                         static_cast<U32>(output.GetSize().x),
+                                         static_cast<U32>(output.GetSize().y),
                                          screenWidth,
                                          screenHeight);
     commandList->End();
@@ -302,20 +426,54 @@ void JzRenderSystem::ClearGraphContributions()
     m_graphContributions.clear();
 }
 
-std::shared_ptr<JzRHIPipeline> JzRenderSystem::ResolveGeometryPipeline() const
+void JzRenderSystem::SetIndirectDrawEnabled(Bool enabled)
+{
+    m_indirectDrawEnabled = enabled;
+}
+
+Bool JzRenderSystem::IsIndirectDrawEnabled() const
+{
+    return m_indirectDrawEnabled;
+}
+
+void JzRenderSystem::SetShadowSettings(const JzShadowAtlasSettings &settings)
+{
+    m_shadowAtlas.SetSettings(settings);
+}
+
+const JzShadowAtlasSettings &JzRenderSystem::GetShadowSettings() const
+{
+    return m_shadowAtlas.GetSettings();
+}
+
+JzShader *JzRenderSystem::ResolveStandardShader() const
 {
     auto &assetManager = JzServiceContainer::Get<JzAssetManager>();
     auto  handle       = assetManager.LoadSync<JzShader>("shaders/standard.jzshader");
-    auto *shader  = assetManager.Get(handle);
+    auto *shader       = assetManager.Get(handle);
     if (!shader || !shader->IsCompiled()) {
         return nullptr;
     }
+    return shader;
+}
+
+std::shared_ptr<JzRHIPipeline> JzRenderSystem::ResolveGeometryPipeline() const
+{
+    auto *shader = m_standardShader;
+    if (!shader) {
+        return nullptr;
+    }
 
-    const U64 preferredMask = JzMaterialAssetComponent::KeywordUsePbr | JzMaterialAssetComponent::KeywordUseDiffuseMap;
+    // Every map is gated by a runtime flag, so the full variant serves all materials
+    const U64 fullMask = JzMaterialAssetComponent::KeywordUsePbr | JzMaterialAssetComponent::KeywordUseDiffuseMap |
+                         JzMaterialAssetComponent::KeywordUseNormalMap |
+                         JzMaterialAssetComponent::KeywordUseSpecularMap;
+    const U64 diffuseMask = JzMaterialAssetComponent::KeywordUsePbr | JzMaterialAssetComponent::KeywordUseDiffuseMap;
 
-    auto preferredPipeline = shader->GetVariant(preferredMask);
-    if (preferredPipeline) {
-        return preferredPipeline;
+    for (const U64 preferredMask : {fullMask, diffuseMask}) {
+        if (auto preferredPipeline = shader->GetVariant(preferredMask)) {
+            return preferredPipeline;
+        }
     }
 
     auto mainPipeline = shader->GetMainVariant();
@@ -327,8 +485,9 @@ std::shared_ptr<JzRHIPipeline> JzRenderSystem::ResolveGeometryPipeline() const
 }
 
 void JzRenderSystem::ExecuteGeometryStage(
-    JzWorld &world, const JzRGPassContext &passContext, JzEntity camera,
-    JzRenderVisibility visibility, std::shared_ptr<JzRHIPipeline> geometryPipeline)
+    const JzRenderSnapshot &snapshot, const JzRGPassContext &passContext, JzEntity camera,
+    JzRenderVisibility visibility, std::shared_ptr<JzRHIPipeline> geometryPipeline,
+    JzClusteredLighting *lighting)
 {
     if (!passContext.framebuffer || !geometryPipeline) {
         return;
@@ -340,43 +499,177 @@ void JzRenderSystem::ExecuteGeometryStage(
     JzMat4 viewMatrix       = JzMat4x4::Identity();
     JzMat4 projectionMatrix = JzMat4x4::Identity();
     JzVec3 clearColor(0.1f, 0.1f, 0.1f);
-    ResolveCameraFrameData(world, camera, viewMatrix, projectionMatrix, clearColor);
+    ResolveCameraFrameData(snapshot, camera, viewMatrix, projectionMatrix, clearColor);
+
+    // Upload before recording: the textures are per target, so earlier targets' draws keep their data
+    if (lighting) {
+        lighting->Build(snapshot.lights, viewMatrix, projectionMatrix, &m_shadowAtlas);
+        lighting->Upload(JzServiceContainer::Get<JzDevice>());
+    }
 
     BeginRenderTargetPass(passContext, passContext.commandList, viewMatrix, projectionMatrix, clearColor,
                           geometryPipeline);
-    DrawVisibleEntities(world, passContext.commandList, visibility, geometryPipeline);
+    if (lighting) {
+        lighting->Bind(passContext.commandList, *geometryPipeline);
+        m_shadowAtlas.Bind(passContext.commandList, *geometryPipeline);
+    }
+
+    // Occlusion was tested from the main camera, so only its targets may skip occluded draws
+    std::vector<U32>        visibleDraws;
+    const std::vector<U32> *drawIndices = nullptr;
+    const auto             *cameraData  = snapshot.FindCamera(camera);
+    if (cameraData && cameraData->isMainCamera) {
+        for (U32 index = 0; index < snapshot.draws.size(); ++index) {
+            if (!snapshot.draws[index].occluded) {
+                visibleDraws.push_back(index);
+            }
+        }
+        if (visibleDraws.size() < snapshot.draws.size()) {
+            drawIndices = &visibleDraws;
+        }
+    }
+
+    if (m_indirectDrawEnabled &&
+        DrawVisibleEntitiesIndirect(snapshot, passContext.commandList, visibility, viewMatrix, projectionMatrix,
+                                    lighting, drawIndices)) {
+        return;
+    }
+    DrawVisibleEntities(snapshot, passContext.commandList, visibility, geometryPipeline, drawIndices);
 }
 
-void JzRenderSystem::ExecuteContribution(
-    JzWorld &world, const JzRGPassContext &passContext, JzEntity camera,
-    JzRenderVisibility visibility, JzRenderTargetFeatures targetFeatures,
-    const JzRenderGraphContribution &contribution)
+JzRGTexture JzRenderSystem::AddShadowPasses(const JzRenderSnapshot              &snapshot,
+                                            std::shared_ptr<JzRHIPipeline> geometryPipeline)
 {
-    if (!passContext.framebuffer || !contribution.execute) {
+    JzRGTexture atlasTexture;
+    if (!geometryPipeline) {
+        return atlasTexture;
+    }
+
+    // Cascades follow the default target's camera; other targets sample the same atlas
+    JzEntity camera = INVALID_ENTITY;
+    for (const auto &target : snapshot.targets) {
+        if (target.isDefault) {
+            camera = target.camera;
+        }
+    }
+
+    JzMat4 viewMatrix       = JzMat4x4::Identity();
+    JzMat4 projectionMatrix = JzMat4x4::Identity();
+    JzVec3 clearColor(0.1f, 0.1f, 0.1f);
+    ResolveCameraFrameData(snapshot, camera, viewMatrix, projectionMatrix, clearColor);
+
+    m_shadowAtlas.Plan(snapshot.lights, snapshot.draws, viewMatrix, projectionMatrix);
+    if (m_shadowAtlas.GetViews().empty()) {
+        return atlasTexture;
+    }
+
+    m_shadowAtlas.Upload(JzServiceContainer::Get<JzDevice>());
+    if (!m_shadowAtlas.GetAtlasTexture() || !m_shadowAtlas.GetFramebuffer()) {
+        return atlasTexture;
+    }
+
+    // Cached tiles live across frames, so the atlas is stored and every tile pass loads it
+    const I32 atlasSize = static_cast<I32>(m_shadowAtlas.GetSettings().atlasSize);
+    atlasTexture        = m_renderGraph.CreateTexture(
+        {JzIVec2(atlasSize, atlasSize), JzETextureResourceFormat::Depth24, false, "ShadowAtlas"});
+    m_renderGraph.BindTexture(atlasTexture, m_shadowAtlas.GetAtlasTexture());
+    m_renderGraph.BindRenderTarget({}, atlasTexture, m_shadowAtlas.GetFramebuffer());
+
+    // One pass per tile: pipeline uniforms apply per pass, and each tile has its own matrices
+    for (const U32 viewIndex : m_shadowAtlas.GetRefreshViews()) {
+        m_renderGraph.AddPass({
+            "ShadowAtlas_Tile" + std::to_string(m_shadowAtlas.GetViews()[viewIndex].tile),
+            nullptr,
+            [atlasTexture, atlasSize](JzRGBuilder &builder) {
+                builder.Write(atlasTexture, JzRGUsage::ReadWrite);
+                builder.SetRenderTarget({}, atlasTexture);
+                builder.SetViewport(JzIVec2(atlasSize, atlasSize));
+            },
+            [this, &snapshot, viewIndex, geometryPipeline](const JzRGPassContext &passContext) {
+                ExecuteShadowStage(snapshot, passContext, viewIndex, geometryPipeline);
+            },
+        });
+    }
+
+    return atlasTexture;
+}
+
+void JzRenderSystem::ExecuteShadowStage(const JzRenderSnapshot &snapshot, const JzRGPassContext &passContext,
+                                        U32 viewIndex, std::shared_ptr<JzRHIPipeline> pipeline)
+{
+    if (!passContext.framebuffer || !pipeline) {
         return;
     }
-    if (passContext.viewport.x <= 0 || passContext.viewport.y <= 0) {
+
+    const auto   &shadowView  = m_shadowAtlas.GetViews()[viewIndex];
+    const JzIVec2 origin      = m_shadowAtlas.GetTileOrigin(shadowView.tile);
+    const U32     tileSize    = m_shadowAtlas.GetSettings().tileSize;
+    auto         &commandList = passContext.commandList;
+
+    commandList.BindFramebuffer(passContext.framebuffer, passContext.attachmentOps);
+    commandList.BindPipeline(pipeline);
+
+    JzViewport viewport;
+    viewport.x        = static_cast<F32>(origin.x);
+    viewport.y        = static_cast<F32>(origin.y);
+    viewport.width    = static_cast<F32>(tileSize);
+    viewport.height   = static_cast<F32>(tileSize);
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+    commandList.SetViewport(viewport);
+
+    // The scissor keeps the clear and the draws inside this tile
+    JzScissorRect scissor;
+    scissor.x      = origin.x;
+    scissor.y      = origin.y;
+    scissor.width  = tileSize;
+    scissor.height = tileSize;
+    commandList.SetScissor(scissor);
+
+    JzClearParams clearParams;
+    clearParams.clearColor   = false;
+    clearParams.clearDepth   = true;
+    clearParams.clearStencil = false;
+    clearParams.depth        = 1.0f;
+    commandList.Clear(clearParams);
+
+    pipeline->SetUniform("view", shadowView.viewMatrix);
+    pipeline->SetUniform("projection", shadowView.projectionMatrix);
+    pipeline->SetUniform("lightingEnabled", 0.0f);
+
+    if (m_indirectDrawEnabled &&
+        DrawVisibleEntitiesIndirect(snapshot, commandList, JzRenderVisibility::MainScene, shadowView.viewMatrix,
+                                    shadowView.projectionMatrix, nullptr, &shadowView.casters)) {
         return;
     }
-    if (!IsContributionEnabled(targetFeatures, contribution.requiredFeature)) {
+    for (const U32 caster : shadowView.casters) {
+        DrawEntity(commandList, snapshot.draws[caster], pipeline);
+    }
+}
+
+void JzRenderSystem::ExecuteContribution(
+    const JzRenderSnapshot &snapshot, const JzRGPassContext &passContext, const JzRenderSnapshotTarget &target,
+    const JzRenderGraphContribution &contribution)
+{
+    if (!passContext.framebuffer || !contribution.execute) {
         return;
     }
-    if (contribution.enabledExecute && !contribution.enabledExecute()) {
+    if (passContext.viewport.x <= 0 || passContext.viewport.y <= 0) {
         return;
     }
 
     JzMat4 viewMatrix       = JzMat4x4::Identity();
     JzMat4 projectionMatrix = JzMat4x4::Identity();
     JzVec3 clearColor(0.1f, 0.1f, 0.1f);
-    ResolveCameraFrameData(world, camera, viewMatrix, projectionMatrix, clearColor);
+    ResolveCameraFrameData(snapshot, target.camera, viewMatrix, projectionMatrix, clearColor);
 
     BeginContributionTargetPass(passContext, passContext.commandList);
 
     JzRenderGraphContributionContext context{
-        world,
-        camera,
-        visibility,
-        targetFeatures,
+        snapshot,
+        target.camera,
+        target.visibility,
+        target.features,
         passContext.viewport,
         viewMatrix,
         projectionMatrix,
@@ -386,37 +679,18 @@ void JzRenderSystem::ExecuteContribution(
 }
 
 void JzRenderSystem::ResolveCameraFrameData(
-    JzWorld &world, JzEntity preferredCamera, JzMat4 &viewMatrix,
+    const JzRenderSnapshot &snapshot, JzEntity preferredCamera, JzMat4 &viewMatrix,
     JzMat4 &projectionMatrix, JzVec3 &clearColor) const
 {
     viewMatrix       = JzMat4x4::Identity();
     projectionMatrix = JzMat4x4::Identity();
     clearColor       = JzVec3(0.1f, 0.1f, 0.1f);
 
-    if (IsValidEntity(preferredCamera) && world.HasComponent<JzCameraComponent>(preferredCamera)) {
-        const auto &camera = world.GetComponent<JzCameraComponent>(preferredCamera);
-        viewMatrix         = camera.viewMatrix;
-        projectionMatrix   = camera.projectionMatrix;
-        clearColor         = camera.clearColor;
-        return;
-    }
-
-    auto cameraView = world.View<JzCameraComponent>();
-    for (auto entity : cameraView) {
-        const auto &camera = world.GetComponent<JzCameraComponent>(entity);
-        if (camera.isMainCamera) {
-            viewMatrix       = camera.viewMatrix;
-            projectionMatrix = camera.projectionMatrix;
-            clearColor       = camera.clearColor;
-            return;
-        }
-    }
-
-    if (!cameraView.empty()) {
-        const auto &camera = world.GetComponent<JzCameraComponent>(cameraView.front());
-        viewMatrix         = camera.viewMatrix;
-        projectionMatrix   = camera.projectionMatrix;
-        clearColor         = camera.clearColor;
+    const auto *camera = snapshot.FindCamera(preferredCamera);
+    if (camera) {
+        viewMatrix       = camera->viewMatrix;
+        projectionMatrix = camera->projectionMatrix;
+        clearColor       = camera->clearColor;
     }
 }
 
@@ -430,7 +704,7 @@ void JzRenderSystem::BeginRenderTargetPass(
         return;
     }
 
-    commandList.BindFramebuffer(passContext.framebuffer);
+    commandList.BindFramebuffer(passContext.framebuffer, passContext.attachmentOps);
     commandList.BindPipeline(pipeline);
 
     JzViewport viewport;
@@ -463,7 +737,7 @@ void JzRenderSystem::BeginRenderTargetPass(
 void JzRenderSystem::BeginContributionTargetPass(const JzRGPassContext &passContext,
                                                  JzRHICommandList      &commandList)
 {
-    commandList.BindFramebuffer(passContext.framebuffer);
+    commandList.BindFramebuffer(passContext.framebuffer, passContext.attachmentOps);
 
     JzViewport viewport;
     viewport.x        = 0.0f;
@@ -477,6 +751,10 @@ void JzRenderSystem::BeginContributionTargetPass(const JzRGPassContext &passCont
 
 void JzRenderSystem::CleanupResources()
 {
+    m_geometryPool.Clear();
+    m_shadowAtlas.Reset();
+    m_geometryPipeline.reset();
+    m_standardShader = nullptr;
     m_graphContributions.clear();
     m_renderTargets.clear();
     m_defaultRenderTargetHandle = INVALID_RENDER_TARGET_HANDLE;
@@ -500,9 +778,10 @@ JzRenderTargetHandle JzRenderSystem::RegisterRenderTarget(JzRenderTargetDesc des
     desc.name = renderTargetName;
 
     JzRenderTarget record;
-    record.handle = handle;
-    record.desc   = std::move(desc);
-    record.output = std::make_shared<JzRenderOutput>(record.desc.name + "_Output");
+    record.handle   = handle;
+    record.desc     = std::move(desc);
+    record.output   = std::make_shared<JzRenderOutput>(record.desc.name + "_Output");
+    record.lighting = std::make_shared<JzClusteredLighting>();
     m_renderTargets.push_back(std::move(record));
     return handle;
 }
@@ -558,26 +837,154 @@ void JzRenderSystem::UpdateRenderTargetVisibility(JzRenderTargetHandle handle,
     }
 }
 
-void JzRenderSystem::DrawVisibleEntities(JzWorld &world, JzRHICommandList &commandList,
+void JzRenderSystem::DrawVisibleEntities(const JzRenderSnapshot &snapshot, JzRHICommandList &commandList,
                                          JzRenderVisibility             visibility,
-                                         std::shared_ptr<JzRHIPipeline> pipeline)
+                                         std::shared_ptr<JzRHIPipeline> pipeline,
+                                         const std::vector<U32>        *drawIndices)
 {
     if (!pipeline) {
         return;
     }
 
-    auto views = world.View<JzTransformComponent, JzMeshAssetComponent, JzMaterialAssetComponent,
-                            JzAssetReadyTag>();
+    const Size drawCount = drawIndices ? drawIndices->size() : snapshot.draws.size();
+    for (Size index = 0; index < drawCount; ++index) {
+        const auto &draw = snapshot.draws[drawIndices ? (*drawIndices)[index] : index];
+        if (!HasVisibility(visibility, draw.visibility)) {
+            continue;
+        }
+        DrawEntity(commandList, draw, pipeline);
+    }
+}
 
-    for (auto entity : views) {
-        if (!IsEntityVisible(world, entity, visibility)) {
+Bool JzRenderSystem::DrawVisibleEntitiesIndirect(const JzRenderSnapshot &snapshot, JzRHICommandList &commandList,
+                                                 JzRenderVisibility visibility,
+                                                 const JzMat4 &viewMatrix, const JzMat4 &projectionMatrix,
+                                                 const JzClusteredLighting *lighting,
+                                                 const std::vector<U32>    *drawIndices)
+{
+    auto &device = JzServiceContainer::Get<JzDevice>();
+    if (!device.SupportsMultiDrawIndirect()) {
+        return false;
+    }
+
+    auto *shader = m_standardShader;
+    if (!shader) {
+        return false;
+    }
+
+    auto &assetManager = JzServiceContainer::Get<JzAssetManager>();
+
+    std::vector<JzIndirectDrawInput> inputs;
+
+    const Size drawCount = drawIndices ? drawIndices->size() : snapshot.draws.size();
+    for (Size index = 0; index < drawCount; ++index) {
+        const auto &snapshotDraw = snapshot.draws[drawIndices ? (*drawIndices)[index] : index];
+        if (!HasVisibility(visibility, snapshotDraw.visibility)) {
+            continue;
+        }
+
+        // Same LOD fallback as DrawEntity; each level is its own pool resident
+        JzMeshHandle meshHandle = snapshotDraw.meshHandle;
+        auto        *mesh       = assetManager.Get(meshHandle);
+        if (!mesh) {
+            meshHandle = snapshotDraw.fallbackMeshHandle;
+            mesh       = assetManager.Get(meshHandle);
+        }
+        if (!mesh) {
+            continue;
+        }
+
+        const auto *allocation = m_geometryPool.Acquire(meshHandle, *mesh);
+        if (!allocation) {
             continue;
         }
-        DrawEntity(world, commandList, entity, pipeline);
+
+        JzIndirectDrawInput input;
+        input.args.indexCount    = allocation->indexCount;
+        input.args.instanceCount = 1;
+        input.args.firstIndex    = allocation->firstIndex;
+        input.args.vertexOffset  = allocation->vertexOffset;
+
+        // The instance carries what DrawEntity sets as per-draw material uniforms
+        auto &instance = input.instance;
+        std::copy_n(snapshotDraw.modelMatrix.Data(), 16, instance.modelRows);
+        std::copy_n(snapshotDraw.diffuseColor.Data(), 3, instance.diffuseColor);
+        std::copy_n(snapshotDraw.ambientColor.Data(), 3, instance.ambientColor);
+        std::copy_n(snapshotDraw.specularColor.Data(), 3, instance.specularColor);
+        instance.diffuseColor[3]  = 1.0f;
+        instance.ambientColor[3]  = 1.0f;
+        instance.specularColor[3] = snapshotDraw.shininess;
+
+        input.textures = ResolveDrawTextures(assetManager, snapshotDraw);
+        inputs.push_back(std::move(input));
+    }
+
+    if (inputs.empty()) {
+        return true;
     }
+
+    auto batch = JzIndirectDrawBatcher::Build(std::move(inputs));
+
+    // Each texture set draws with the variant that samples exactly its maps
+    std::vector<std::shared_ptr<JzRHIPipeline>> groupPipelines;
+    groupPipelines.reserve(batch.groups.size());
+    for (const auto &group : batch.groups) {
+        U64 keywordMask = JzMaterialAssetComponent::KeywordUsePbr | JzMaterialAssetComponent::KeywordUseIndirectDraw;
+        if (group.textures.diffuse) {
+            keywordMask |= JzMaterialAssetComponent::KeywordUseDiffuseMap;
+        }
+        if (group.textures.normal) {
+            keywordMask |= JzMaterialAssetComponent::KeywordUseNormalMap;
+        }
+        if (group.textures.specular) {
+            keywordMask |= JzMaterialAssetComponent::KeywordUseSpecularMap;
+        }
+
+        auto pipeline = shader->GetVariant(keywordMask);
+        if (!pipeline) {
+            return false;
+        }
+        groupPipelines.push_back(std::move(pipeline));
+    }
+
+    const auto *stream = m_geometryPool.Upload(batch.instances, batch.args);
+    if (!stream) {
+        return false;
+    }
+
+    commandList.BindVertexArray(stream->vertexArray);
+
+    std::shared_ptr<JzRHIPipeline> boundPipeline;
+    for (Size groupIndex = 0; groupIndex < batch.groups.size(); ++groupIndex) {
+        const auto &group    = batch.groups[groupIndex];
+        const auto &pipeline = groupPipelines[groupIndex];
+
+        if (pipeline != boundPipeline) {
+            pipeline->SetUniform("view", viewMatrix);
+            pipeline->SetUniform("projection", projectionMatrix);
+            if (lighting) {
+                lighting->Bind(commandList, *pipeline);
+                m_shadowAtlas.Bind(commandList, *pipeline);
+            } else {
+                pipeline->SetUniform("lightingEnabled", 0.0f);
+            }
+            commandList.BindPipeline(pipeline);
+            boundPipeline = pipeline;
+        }
+        BindDrawTextures(commandList, *pipeline, group.textures);
+
+        JzDrawIndexedIndirectParams drawParams;
+        drawParams.primitiveType  = JzEPrimitiveType::Triangles;
+        drawParams.indirectBuffer = stream->indirectBuffer;
+        drawParams.offset         = group.firstDraw * sizeof(JzDrawIndexedIndirectArgs);
+        drawParams.drawCount      = group.drawCount;
+        commandList.DrawIndexedIndirect(drawParams);
+    }
+
+    return true;
 }
 
-void JzRenderSystem::DrawEntity(JzWorld &world, JzRHICommandList &commandList, JzEntity entity,
+void JzRenderSystem::DrawEntity(JzRHICommandList &commandList, const JzRenderSnapshotDraw &draw,
                                 std::shared_ptr<JzRHIPipeline> pipeline)
 {
     if (!pipeline) {
@@ -586,11 +993,11 @@ void JzRenderSystem::DrawEntity(JzWorld &world, JzRHICommandList &commandList, J
 
     auto &assetManager = JzServiceContainer::Get<JzAssetManager>();
 
-    auto &transform = world.GetComponent<JzTransformComponent>(entity);
-    auto &meshComp  = world.GetComponent<JzMeshAssetComponent>(entity);
-    auto &matComp   = world.GetComponent<JzMaterialAssetComponent>(entity);
-
-    auto *mesh = assetManager.Get(meshComp.meshHandle);
+    // Draw the level selected by JzLODSystem, falling back to full detail
+    auto *mesh = assetManager.Get(draw.meshHandle);
+    if (!mesh) {
+        mesh = assetManager.Get(draw.fallbackMeshHandle);
+    }
     if (!mesh) {
         return;
     }
@@ -600,20 +1007,13 @@ void JzRenderSystem::DrawEntity(JzWorld &world, JzRHICommandList &commandList, J
         return;
     }
 
-    pipeline->SetUniform("model", transform.GetWorldMatrix());
-    pipeline->SetUniform("material.ambient", matComp.ambientColor);
-    pipeline->SetUniform("material.diffuse", matComp.diffuseColor);
-    pipeline->SetUniform("material.specular", matComp.specularColor);
-    pipeline->SetUniform("material.shininess", matComp.shininess);
+    pipeline->SetUniform("model", draw.modelMatrix);
+    pipeline->SetUniform("material.ambient", draw.ambientColor);
+    pipeline->SetUniform("material.diffuse", draw.diffuseColor);
+    pipeline->SetUniform("material.specular", draw.specularColor);
+    pipeline->SetUniform("material.shininess", draw.shininess);
 
-    JzMaterial *material          = assetManager.Get(matComp.materialHandle);
-    Bool        hasDiffuseTexture = material && material->HasDiffuseTexture();
-    pipeline->SetUniform("hasDiffuseTexture", hasDiffuseTexture);
-    if (hasDiffuseTexture) {
-        commandList.BindTexture(material->GetDiffuseTexture(), 0);
-        pipeline->SetUniform("diffuseTexture", 0);
-        pipeline->SetUniform("SPIRV_Cross_CombineddiffuseTexturediffuseTextureSampler", 0);
-    }
+    BindDrawTextures(commandList, *pipeline, ResolveDrawTextures(assetManager, draw));
 
     commandList.BindVertexArray(vertexArray);
 
@@ -627,24 +1027,66 @@ void JzRenderSystem::DrawEntity(JzWorld &world, JzRHICommandList &commandList, J
     commandList.DrawIndexed(drawParams);
 }
 
-Bool JzRenderSystem::IsEntityVisible(JzWorld &world, JzEntity entity,
-                                     JzRenderVisibility visibility) const
+JzDrawTextureSet JzRenderSystem::ResolveDrawTextures(JzAssetManager &assetManager,
+                                                     const JzRenderSnapshotDraw &draw) const
 {
-    const Bool allowOverlay   = HasVisibility(visibility, JzRenderVisibility::Overlay);
-    const Bool allowIsolated  = HasVisibility(visibility, JzRenderVisibility::Isolated);
-    const Bool allowMainScene = HasVisibility(visibility, JzRenderVisibility::MainScene);
+    JzDrawTextureSet textures;
+
+    JzMaterial *material = assetManager.Get(draw.materialHandle);
+    if (material && material->HasDiffuseTexture()) {
+        textures.diffuse = material->GetDiffuseTexture();
+    }
+
+    // Maps still loading are skipped until they become resident
+    if (auto *normal = draw.normalTextureHandle.IsValid() ? assetManager.Get(draw.normalTextureHandle) : nullptr) {
+        textures.normal = normal->GetRhiTexture();
+    }
+    if (auto *specular =
+            draw.specularTextureHandle.IsValid() ? assetManager.Get(draw.specularTextureHandle) : nullptr) {
+        textures.specular = specular->GetRhiTexture();
+    }
 
-    const Bool hasOverlayTag  = world.HasComponent<JzOverlayRenderTag>(entity);
-    const Bool hasIsolatedTag = world.HasComponent<JzIsolatedRenderTag>(entity);
+    return textures;
+}
 
-    if (hasOverlayTag) {
-        return allowOverlay;
+void JzRenderSystem::BindDrawTextures(JzRHICommandList &commandList, JzRHIPipeline &pipeline,
+                                      const JzDrawTextureSet &textures) const
+{
+    pipeline.SetUniform("hasDiffuseTexture", textures.diffuse != nullptr);
+    pipeline.SetUniform("hasNormalTexture", textures.normal != nullptr);
+    pipeline.SetUniform("hasSpecularTexture", textures.specular != nullptr);
+
+    if (textures.diffuse) {
+        commandList.BindTexture(textures.diffuse, DiffuseTextureSlot);
+        pipeline.SetUniform("diffuseTexture", static_cast<I32>(DiffuseTextureSlot));
+        pipeline.SetUniform("SPIRV_Cross_CombineddiffuseTexturediffuseTextureSampler",
+                            static_cast<I32>(DiffuseTextureSlot));
     }
-    if (hasIsolatedTag) {
-        return allowIsolated;
+    if (textures.normal) {
+        commandList.BindTexture(textures.normal, NormalTextureSlot);
+        pipeline.SetUniform("normalTexture", static_cast<I32>(NormalTextureSlot));
+        pipeline.SetUniform("SPIRV_Cross_CombinednormalTexturenormalTextureSampler",
+                            static_cast<I32>(NormalTextureSlot));
     }
+    if (textures.specular) {
+        commandList.BindTexture(textures.specular, SpecularTextureSlot);
+        pipeline.SetUniform("specularTexture", static_cast<I32>(SpecularTextureSlot));
+        pipeline.SetUniform("SPIRV_Cross_CombinedspecularTexturespecularTextureSampler",
+                            static_cast<I32>(SpecularTextureSlot));
+    }
+}
 
-    return allowMainScene;
+JzRenderVisibility JzRenderSystem::ResolveRenderChannel(JzWorld &world, JzEntity entity) const
+{
+    // Overlay takes precedence when an entity carries both tags
+    if (world.HasComponent<JzOverlayRenderTag>(entity)) {
+        return JzRenderVisibility::Overlay;
+    }
+    if (world.HasComponent<JzIsolatedRenderTag>(entity)) {
+        return JzRenderVisibility::Isolated;
+    }
+
+    return JzRenderVisibility::MainScene;
 }
 
 Bool JzRenderSystem::IsContributionEnabled(JzRenderTargetFeatures targetFeatures,
@@ -687,31 +1129,32 @@ void JzRenderSystem::ApplyRenderGraphTransitions(
             continue;
         }
 
+        JzRHIResourceBarrier barrier;
         if (transition.type == JzRGResourceType::Texture) {
             auto resource = m_renderGraph.GetTextureResource(JzRGTexture{transition.id});
             if (!resource) {
                 continue;
             }
-
-            JzRHIResourceBarrier barrier;
             barrier.type     = JzEResourceType::Texture;
             barrier.resource = std::static_pointer_cast<JzGPUResource>(resource);
-            barrier.before   = toState(transition.before);
-            barrier.after    = toState(transition.after);
-            barriers.push_back(std::move(barrier));
         } else {
             auto resource = m_renderGraph.GetBufferResource(JzRGBuffer{transition.id});
             if (!resource) {
                 continue;
             }
-
-            JzRHIResourceBarrier barrier;
             barrier.type     = JzEResourceType::Buffer;
             barrier.resource = std::static_pointer_cast<JzGPUResource>(resource);
-            barrier.before   = toState(transition.before);
-            barrier.after    = toState(transition.after);
-            barriers.push_back(std::move(barrier));
         }
+
+        barrier.before      = toState(transition.before);
+        barrier.after       = toState(transition.after);
+        barrier.beforeUsage = transition.beforeUsage;
+        barrier.afterUsage  = transition.afterUsage;
+        barrier.beforePass  = transition.beforePass;
+        barrier.afterPass   = transition.afterPass;
+        barrier.split       = transition.split;
+        barrier.splitId     = transition.splitId;
+        barriers.push_back(std::move(barrier));
     }
 
     if (!barriers.empty()) {
@@ -0,0 +1,357 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Function/ECS/JzStaticBatchSystem.h"
+
+#include <memory>
+
+#include "JzRE/Runtime/Core/JzLogger.h"
+#include "JzRE/Runtime/Core/JzProfiler.h"
+#include "JzRE/Runtime/Core/JzServiceContainer.h"
+#include "JzRE/Runtime/Function/ECS/JzAssetComponents.h"
+#include "JzRE/Runtime/Function/ECS/JzAssetSystem.h"
+#include "JzRE/Runtime/Function/ECS/JzEntityComponents.h"
+#include "JzRE/Runtime/Function/ECS/JzRenderComponents.h"
+#include "JzRE/Runtime/Function/ECS/JzTransformComponents.h"
+#include "JzRE/Runtime/Resource/JzMesh.h"
+
+namespace JzRE {
+
+namespace {
+
+/**
+ * @brief Entities that can share a chunk: same material state and render channel.
+ */
+struct JzStaticBatchGroup {
+    JzEntity                        source   = INVALID_ENTITY; ///< First entity of the group
+    const JzMaterialAssetComponent *material = nullptr;
+    Bool                            overlay  = false;
+    Bool                            isolated = false;
+};
+
+Bool SameMaterial(const JzMaterialAssetComponent &a, const JzMaterialAssetComponent &b)
+{
+    return a.materialHandle == b.materialHandle && a.shaderHandle == b.shaderHandle &&
+           a.diffuseTextureHandle == b.diffuseTextureHandle && a.normalTextureHandle == b.normalTextureHandle &&
+           a.specularTextureHandle == b.specularTextureHandle && a.shaderKeywordMask == b.shaderKeywordMask &&
+           a.ambientColor == b.ambientColor && a.diffuseColor == b.diffuseColor &&
+           a.specularColor == b.specularColor && a.shininess == b.shininess && a.opacity == b.opacity;
+}
+
+} // namespace
+
+void JzStaticBatchSystem::OnInit(JzWorld &world)
+{
+    ConnectObservers(world);
+}
+
+void JzStaticBatchSystem::Update(JzWorld &world, F32 delta)
+{
+    if (m_observedWorld != &world) {
+        ConnectObservers(world);
+    }
+
+    // Members of batches destroyed from outside are drawn on their own again
+    if (!m_orphanedMembers.empty()) {
+        m_dissolving = true;
+        for (auto entity : m_orphanedMembers) {
+            if (!world.IsValid(entity)) {
+                continue;
+            }
+            const auto *member = world.TryGetComponent<JzStaticBatchMemberComponent>(entity);
+            if (member && !world.IsValid(member->batch)) {
+                world.RemoveComponent<JzStaticBatchMemberComponent>(entity);
+            }
+        }
+        m_dissolving = false;
+        m_orphanedMembers.clear();
+        m_scanPending = true;
+    }
+
+    // Transforms edited in place only raise their dirty flag, so look at the members too
+    for (auto entity : world.View<JzStaticBatchMemberComponent, JzTransformComponent>()) {
+        if (world.GetComponent<JzTransformComponent>(entity).isDirty) {
+            m_dirtyBatches.insert(world.GetComponent<JzStaticBatchMemberComponent>(entity).batch);
+        }
+    }
+
+    if (!m_dirtyBatches.empty()) {
+        const std::vector<JzEntity> dirty(m_dirtyBatches.begin(), m_dirtyBatches.end());
+        m_dirtyBatches.clear();
+        for (auto batch : dirty) {
+            DissolveBatch(world, batch);
+        }
+        m_scanPending = true;
+    }
+
+    if (m_scanPending) {
+        BuildBatches(world);
+    }
+}
+
+void JzStaticBatchSystem::OnShutdown(JzWorld &world)
+{
+    DisconnectObservers();
+}
+
+void JzStaticBatchSystem::Rebuild(JzWorld &world)
+{
+    std::vector<JzEntity> batches;
+    for (auto entity : world.View<JzStaticBatchComponent>()) {
+        batches.push_back(entity);
+    }
+    for (auto batch : batches) {
+        DissolveBatch(world, batch);
+    }
+
+    m_dirtyBatches.clear();
+    m_scanPending = true;
+}
+
+// ==================== Change Tracking ====================
+
+void JzStaticBatchSystem::ConnectObservers(JzWorld &world)
+{
+    DisconnectObservers();
+    m_observedWorld = &world;
+    m_scanPending   = true;
+
+    world.OnConstruct<JzStaticTag>().connect<&JzStaticBatchSystem::OnStaticEntityChanged>(*this);
+    world.OnConstruct<JzAssetReadyTag>().connect<&JzStaticBatchSystem::OnStaticEntityChanged>(*this);
+
+    world.OnDestroy<JzStaticTag>().connect<&JzStaticBatchSystem::OnMemberChanged>(*this);
+    world.OnDestroy<JzAssetReadyTag>().connect<&JzStaticBatchSystem::OnMemberChanged>(*this);
+    world.OnDestroy<JzMeshAssetComponent>().connect<&JzStaticBatchSystem::OnMemberChanged>(*this);
+    world.OnUpdate<JzMeshAssetComponent>().connect<&JzStaticBatchSystem::OnMemberChanged>(*this);
+    world.OnDestroy<JzMaterialAssetComponent>().connect<&JzStaticBatchSystem::OnMemberChanged>(*this);
+    world.OnUpdate<JzMaterialAssetComponent>().connect<&JzStaticBatchSystem::OnMemberChanged>(*this);
+    world.OnDestroy<JzStaticBatchMemberComponent>().connect<&JzStaticBatchSystem::OnMemberChanged>(*this);
+    world.OnUpdate<JzTransformComponent>().connect<&JzStaticBatchSystem::OnTransformChanged>(*this);
+
+    world.OnDestroy<JzStaticBatchComponent>().connect<&JzStaticBatchSystem::OnBatchRemoved>(*this);
+}
+
+void JzStaticBatchSystem::DisconnectObservers()
+{
+    if (!m_observedWorld) {
+        return;
+    }
+
+    m_observedWorld->OnConstruct<JzStaticTag>().disconnect(this);
+    m_observedWorld->OnConstruct<JzAssetReadyTag>().disconnect(this);
+    m_observedWorld->OnDestroy<JzStaticTag>().disconnect(this);
+    m_observedWorld->OnDestroy<JzAssetReadyTag>().disconnect(this);
+    m_observedWorld->OnDestroy<JzMeshAssetComponent>().disconnect(this);
+    m_observedWorld->OnUpdate<JzMeshAssetComponent>().disconnect(this);
+    m_observedWorld->OnDestroy<JzMaterialAssetComponent>().disconnect(this);
+    m_observedWorld->OnUpdate<JzMaterialAssetComponent>().disconnect(this);
+    m_observedWorld->OnDestroy<JzStaticBatchMemberComponent>().disconnect(this);
+    m_observedWorld->OnUpdate<JzTransformComponent>().disconnect(this);
+    m_observedWorld->OnDestroy<JzStaticBatchComponent>().disconnect(this);
+
+    m_observedWorld = nullptr;
+    m_dirtyBatches.clear();
+    m_orphanedMembers.clear();
+}
+
+void JzStaticBatchSystem::OnStaticEntityChanged(entt::registry &registry, JzEntity entity)
+{
+    if (registry.all_of<JzStaticTag>(entity) && !registry.all_of<JzStaticBatchComponent>(entity)) {
+        m_scanPending = true;
+    }
+}
+
+void JzStaticBatchSystem::OnMemberChanged(entt::registry &registry, JzEntity entity)
+{
+    if (m_dissolving) {
+        return;
+    }
+    if (const auto *member = registry.try_get<JzStaticBatchMemberComponent>(entity)) {
+        m_dirtyBatches.insert(member->batch);
+    }
+}
+
+void JzStaticBatchSystem::OnTransformChanged(entt::registry &registry, JzEntity entity)
+{
+    if (m_dissolving || !registry.all_of<JzStaticTag>(entity) || registry.all_of<JzStaticBatchComponent>(entity)) {
+        return;
+    }
+    if (const auto *member = registry.try_get<JzStaticBatchMemberComponent>(entity)) {
+        m_dirtyBatches.insert(member->batch);
+    } else {
+        // An unbatched static entity may now share a chunk with others
+        m_scanPending = true;
+    }
+}
+
+void JzStaticBatchSystem::OnBatchRemoved(entt::registry &registry, JzEntity entity)
+{
+    if (m_dissolving) {
+        return;
+    }
+    const auto &sources = registry.get<JzStaticBatchComponent>(entity).sources;
+    m_orphanedMembers.insert(m_orphanedMembers.end(), sources.begin(), sources.end());
+}
+
+// ==================== Batching ====================
+
+void JzStaticBatchSystem::DissolveBatch(JzWorld &world, JzEntity batch)
+{
+    if (!world.IsValid(batch)) {
+        return;
+    }
+
+    m_dissolving = true;
+
+    if (const auto *batchComp = world.TryGetComponent<JzStaticBatchComponent>(batch)) {
+        for (auto source : batchComp->sources) {
+            if (!world.IsValid(source)) {
+                continue;
+            }
+            const auto *member = world.TryGetComponent<JzStaticBatchMemberComponent>(source);
+            if (member && member->batch == batch) {
+                world.RemoveComponent<JzStaticBatchMemberComponent>(source);
+            }
+        }
+    }
+
+    if (JzServiceContainer::Has<JzAssetSystem>()) {
+        JzServiceContainer::Get<JzAssetSystem>().DetachAllAssets(world, batch);
+    }
+    world.DestroyEntity(batch);
+
+    m_dissolving = false;
+}
+
+void JzStaticBatchSystem::BuildBatches(JzWorld &world)
+{
+    if (!JzServiceContainer::Has<JzAssetSystem>()) {
+        return;
+    }
+
+    JzRE_PROFILE_SCOPE("StaticBatchSystem_Build");
+
+    auto &assetSystem = JzServiceContainer::Get<JzAssetSystem>();
+    auto  view        = world.View<JzStaticTag, JzTransformComponent, JzMeshAssetComponent, JzMaterialAssetComponent>(
+        JzExclude<JzStaticBatchMemberComponent, JzStaticBatchComponent>);
+
+    // Batch a loading scene once, after its static assets have settled
+    for (auto entity : view) {
+        if (world.HasComponent<JzAssetLoadingTag>(entity)) {
+            return;
+        }
+    }
+
+    std::vector<JzEntity>           entities;
+    std::vector<JzStaticBatchInput> inputs;
+    std::vector<JzStaticBatchGroup> groups;
+    for (auto entity : view) {
+        if (!world.HasComponent<JzAssetReadyTag>(entity)) {
+            continue;
+        }
+
+        const auto &meshComp = world.GetComponent<JzMeshAssetComponent>(entity);
+        const auto *mesh     = assetSystem.Get(meshComp.meshHandle);
+        if (!mesh || mesh->GetVertices().empty()) {
+            continue;
+        }
+
+        const auto &matComp  = world.GetComponent<JzMaterialAssetComponent>(entity);
+        const Bool  overlay  = world.HasComponent<JzOverlayRenderTag>(entity);
+        const Bool  isolated = world.HasComponent<JzIsolatedRenderTag>(entity);
+
+        U64 groupIndex = 0;
+        while (groupIndex < groups.size()) {
+            const auto &group = groups[groupIndex];
+            if (group.overlay == overlay && group.isolated == isolated && SameMaterial(*group.material, matComp)) {
+                break;
+            }
+            ++groupIndex;
+        }
+        if (groupIndex == groups.size()) {
+            groups.push_back({entity, &matComp, overlay, isolated});
+        }
+
+        auto &input       = inputs.emplace_back();
+        input.vertices    = &mesh->GetVertices();
+        input.indices     = &mesh->GetIndices();
+        input.worldMatrix = world.GetComponent<JzTransformComponent>(entity).GetWorldMatrix();
+        input.groupKey    = groupIndex;
+        entities.push_back(entity);
+    }
+
+    auto chunks = JzStaticBatcher::Build(inputs, m_settings);
+
+    U32 batchCount  = 0;
+    U32 mergedCount = 0;
+    for (auto &chunk : chunks) {
+        // A single entity gains nothing from a copy of its mesh
+        if (chunk.inputs.size() < 2) {
+            continue;
+        }
+
+        const U32 indexCount = static_cast<U32>(chunk.indices.size());
+        auto      mesh       = std::make_shared<JzMesh>(std::move(chunk.vertices), std::move(chunk.indices));
+        if (!mesh->Load()) {
+            JzRE_LOG_WARN("JzStaticBatchSystem: Failed to create a batch of {} entities", chunk.inputs.size());
+            continue;
+        }
+        auto meshHandle = assetSystem.RegisterAsset<JzMesh>("static_batch#" + std::to_string(m_nextBatchId++), mesh);
+        if (!meshHandle.IsValid()) {
+            continue;
+        }
+
+        const auto &group = groups[chunk.groupKey];
+        const auto  batch = world.CreateEntity();
+
+        world.AddComponent<JzTransformComponent>(batch);
+        auto &assetRef = world.AddComponent<JzAssetReferenceComponent>(batch);
+
+        auto &meshComp        = world.AddComponent<JzMeshAssetComponent>(batch, meshHandle);
+        meshComp.isReady      = true;
+        meshComp.indexCount   = indexCount;
+        meshComp.boundsCenter = chunk.boundsCenter;
+        meshComp.boundsRadius = chunk.boundsRadius;
+        assetRef.AddMesh(meshHandle);
+
+        // The group pointer may dangle once components are added, so copy through the source
+        const auto material = world.GetComponent<JzMaterialAssetComponent>(group.source);
+        world.AddComponent<JzMaterialAssetComponent>(batch, material);
+        if (material.materialHandle.IsValid()) {
+            assetSystem.AddRef(material.materialHandle);
+            assetRef.AddMaterial(material.materialHandle);
+        }
+
+        if (group.overlay) {
+            world.AddComponent<JzOverlayRenderTag>(batch);
+        }
+        if (group.isolated) {
+            world.AddComponent<JzIsolatedRenderTag>(batch);
+        }
+
+        auto &batchComp = world.AddComponent<JzStaticBatchComponent>(batch);
+        for (U32 input : chunk.inputs) {
+            batchComp.sources.push_back(entities[input]);
+        }
+        world.AddComponent<JzStaticTag>(batch);
+        world.AddComponent<JzAssetReadyTag>(batch);
+
+        for (auto source : world.GetComponent<JzStaticBatchComponent>(batch).sources) {
+            world.AddComponent<JzStaticBatchMemberComponent>(source).batch = batch;
+        }
+
+        ++batchCount;
+        mergedCount += static_cast<U32>(chunk.inputs.size());
+    }
+
+    if (batchCount > 0) {
+        JzRE_LOG_INFO("JzStaticBatchSystem: Merged {} static entities into {} batches", mergedCount, batchCount);
+    }
+
+    // Creating the batches above notifies the observers; nothing is left to merge
+    m_scanPending = false;
+}
+
+} // namespace JzRE
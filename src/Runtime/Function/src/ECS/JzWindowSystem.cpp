@@ -356,20 +356,21 @@ void JzWindowSystem::ProcessPlatformEvents(JzWorld &world)
     if (!m_backend || !m_backend->IsValid()) return;
     if (m_primaryWindow == INVALID_ENTITY) return;
 
-    // Get event dispatcher (optional - gracefully skip if not registered)
+    // Get event dispatcher (optional - input state is still updated without one)
     JzEventSystem **dispatcherPtr = world.TryGetContext<JzEventSystem *>();
-    if (!dispatcherPtr || !*dispatcherPtr) {
-        // No dispatcher registered, just drain the queue without dispatching
-        m_backend->GetEventQueue().Clear();
-        return;
+    JzEventSystem  *dispatcher    = (dispatcherPtr && *dispatcherPtr) ? *dispatcherPtr : nullptr;
+
+    JzInputStateComponent *inputState = nullptr;
+    if (world.IsValid(m_primaryWindow) && world.HasComponent<JzInputStateComponent>(m_primaryWindow)) {
+        inputState = &world.GetComponent<JzInputStateComponent>(m_primaryWindow);
     }
-    JzEventSystem *dispatcher = *dispatcherPtr;
 
-    // Process platform events and convert to ECS events
+    // Key and button callbacks drive the input state edges, then become ECS events
     m_eventAdapter.ProcessPlatformEvents(
         m_backend->GetEventQueue(),
-        *dispatcher,
-        m_primaryWindow);
+        dispatcher,
+        m_primaryWindow,
+        inputState);
 }
 
 void JzWindowSystem::PollEvents(JzWorld &world)
@@ -435,7 +436,7 @@ void JzWindowSystem::SyncInputFromBackend(JzWorld &world, JzEntity windowEntity)
 
     // Calculate mouse delta
     if (!input.firstFrame) {
-        input.mouse.positionDelta = currentMousePos - input.mouse.lastPosition;
+        input.mouse.positionDelta = currentMousePos - input.mouse.position;
     } else {
         input.mouse.positionDelta = JzVec2(0.0f, 0.0f);
     }
@@ -444,58 +445,11 @@ void JzWindowSystem::SyncInputFromBackend(JzWorld &world, JzEntity windowEntity)
     input.mouse.position     = currentMousePos;
     input.firstFrame         = false;
 
-    // Update keyboard state
-    auto updateKey = [&](I32 key) {
-        Bool pressed    = m_backend->GetKeyState(key);
-        Bool wasPressed = input.keyboard.keysPressed[static_cast<Size>(key)];
-
-        if (pressed && !wasPressed) {
-            input.keyboard.keysDown.set(static_cast<Size>(key));
-        }
-        if (!pressed && wasPressed) {
-            input.keyboard.keysUp.set(static_cast<Size>(key));
-        }
-
-        if (pressed) {
-            input.keyboard.keysPressed.set(static_cast<Size>(key));
-        } else {
-            input.keyboard.keysPressed.reset(static_cast<Size>(key));
-        }
-    };
-
-    // Update common keys (GLFW key range: KEY_SPACE=32 to KEY_LAST=348)
-    for (I32 key = 32; key <= 348; ++key) {
-        if (key < static_cast<I32>(JzInputStateComponent::KeyboardState::KEY_COUNT)) {
-            updateKey(key);
-        }
-    }
-
-    // Update mouse buttons
-    for (I32 button = 0; button < static_cast<I32>(JzInputStateComponent::MouseState::BUTTON_COUNT); ++button) {
-        Bool pressed    = m_backend->GetMouseButtonState(button);
-        Bool wasPressed = input.mouse.buttonsPressed[static_cast<Size>(button)];
-
-        if (pressed && !wasPressed) {
-            input.mouse.buttonsDown.set(static_cast<Size>(button));
-        }
-        if (!pressed && wasPressed) {
-            input.mouse.buttonsUp.set(static_cast<Size>(button));
-        }
-
-        if (pressed) {
-            input.mouse.buttonsPressed.set(static_cast<Size>(button));
-        } else {
-            input.mouse.buttonsPressed.reset(static_cast<Size>(button));
-        }
+    if (input.mouse.positionDelta.x != 0.0f || input.mouse.positionDelta.y != 0.0f) {
+        input.changed = true;
     }
 
-    // Apply accumulated scroll delta from platform events
-    // Note: Scroll events are now dispatched through the event system,
-    // but we still track scroll state in the input component for polling queries.
-    // The scroll delta is reset each frame after being read.
-    // Individual systems can subscribe to JzMouseScrollEvent for event-driven handling.
-    input.mouse.scrollDelta = m_pendingScrollDelta;
-    m_pendingScrollDelta    = JzVec2(0.0f, 0.0f);
+    // Keys, buttons and scroll are applied from platform events in ProcessPlatformEvents
 }
 
 void JzWindowSystem::ProcessWindowEvents(JzWorld &world)
@@ -5,6 +5,8 @@
 
 #include "JzRE/Runtime/Function/ECS/JzWorld.h"
 
+#include "JzRE/Runtime/Core/JzProfiler.h"
+
 namespace JzRE {
 
 JzEntity JzWorld::CreateEntity()
@@ -31,11 +33,43 @@ Size JzWorld::GetEntityCount() const
 
 void JzWorld::Update(F32 delta)
 {
-    for (auto &system : m_systems) {
+    for (Size index = 0; index < m_systems.size(); ++index) {
+        auto &system = m_systems[index];
         if (system && system->IsEnabled()) {
-            system->Update(*this, delta);
+            UpdateSystem(index, delta);
+        }
+    }
+}
+
+void JzWorld::Update(F32 delta, JzSystemPhase first, JzSystemPhase last)
+{
+    for (Size index = 0; index < m_systems.size(); ++index) {
+        auto &system = m_systems[index];
+        if (!system || !system->IsEnabled()) {
+            continue;
+        }
+
+        const auto phase = system->GetPhase();
+        if (phase < first || phase > last) {
+            continue;
         }
+
+        UpdateSystem(index, delta);
+    }
+}
+
+void JzWorld::UpdateSystem(Size index, F32 delta)
+{
+    JzRE_PROFILE_SCOPE(m_systemNames[index]);
+
+    if (!m_systemTimingEnabled) {
+        m_systems[index]->Update(*this, delta);
+        return;
     }
+
+    const U64 beginNs = JzProfiler::NowNs();
+    m_systems[index]->Update(*this, delta);
+    m_systemTimings[index].lastUpdateNs = JzProfiler::NowNs() - beginNs;
 }
 
 void JzWorld::ShutdownSystems()
@@ -47,6 +81,32 @@ void JzWorld::ShutdownSystems()
     }
 
     m_systems.clear();
+    m_systemNames.clear();
+    m_systemTimings.clear();
+}
+
+void JzWorld::SetSystemTimingEnabled(Bool enabled)
+{
+    m_systemTimingEnabled = enabled;
+}
+
+const std::vector<JzSystemTiming> &JzWorld::GetSystemTimings() const
+{
+    return m_systemTimings;
+}
+
+void JzWorld::RecordSystemTiming(const JzSystem &system, U64 updateNs)
+{
+    if (!m_systemTimingEnabled) {
+        return;
+    }
+
+    for (Size index = 0; index < m_systems.size(); ++index) {
+        if (m_systems[index].get() == &system) {
+            m_systemTimings[index].lastUpdateNs = updateNs;
+            return;
+        }
+    }
 }
 
 } // namespace JzRE
@@ -0,0 +1,302 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Function/Project/JzProjectFileIndex.h"
+
+#include <algorithm>
+#include <cctype>
+
+#include "JzRE/Runtime/Core/JzLogger.h"
+#include "JzRE/Runtime/Core/JzServiceContainer.h"
+
+namespace JzRE {
+
+namespace {
+
+namespace fs = std::filesystem;
+
+Bool HasPrefix(const String &value, const String &prefix)
+{
+    return value.size() >= prefix.size() && value.compare(0, prefix.size(), prefix) == 0;
+}
+
+} // namespace
+
+JzProjectFileIndex::JzProjectFileIndex(const std::filesystem::path &root) :
+    m_root(JzFileWatcher::NormalizePath(root))
+{
+    if (!m_root.has_filename()) {
+        m_root = m_root.parent_path();
+    }
+}
+
+JzProjectFileIndex::~JzProjectFileIndex()
+{
+    CancelBuild();
+
+    if (m_fileWatcher && m_watchHandle != 0) {
+        m_fileWatcher->Unwatch(m_watchHandle);
+    }
+}
+
+void JzProjectFileIndex::Rebuild()
+{
+    CancelBuild();
+
+    if (!m_fileWatcher && JzServiceContainer::Has<JzFileWatcher>()) {
+        m_fileWatcher = &JzServiceContainer::Get<JzFileWatcher>();
+        m_watchHandle = m_fileWatcher->Watch(m_root, true, [this](const std::vector<JzFileChange> &changes) {
+            ApplyChanges(changes);
+        });
+    }
+
+    if (!m_scanPool) {
+        m_scanPool = std::make_unique<JzThreadPool>(1);
+    }
+
+    m_pendingChanges.clear();
+    m_cancelBuild = false;
+    m_buildResult = m_scanPool->Submit([root = m_root, cancel = &m_cancelBuild]() {
+        JzDirectoryMap directories;
+        ScanTree(root, directories, cancel);
+        return directories;
+    });
+}
+
+void JzProjectFileIndex::Update()
+{
+    if (!m_buildResult.valid() || m_buildResult.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        return;
+    }
+
+    try {
+        m_directories = m_buildResult.get();
+    } catch (const std::exception &e) {
+        JzRE_LOG_ERROR("JzProjectFileIndex: scan of '{}' failed: {}", m_root.string(), e.what());
+        m_directories.clear();
+    }
+    m_ready = true;
+    m_version++;
+
+    auto pendingChanges = std::move(m_pendingChanges);
+    m_pendingChanges.clear();
+    for (const auto &change : pendingChanges) {
+        ApplyChange(change);
+    }
+}
+
+void JzProjectFileIndex::ApplyChanges(const std::vector<JzFileChange> &changes)
+{
+    for (const auto &change : changes) {
+        ApplyChange(change);
+    }
+}
+
+const std::vector<JzProjectFileEntry> *JzProjectFileIndex::GetEntries(const std::filesystem::path &directory) const
+{
+    auto it = m_directories.find(directory.string());
+    return it != m_directories.end() ? &it->second : nullptr;
+}
+
+const JzProjectFileEntry *JzProjectFileIndex::Find(const std::filesystem::path &path) const
+{
+    const auto *entries = GetEntries(path.parent_path());
+    if (!entries) {
+        return nullptr;
+    }
+
+    const auto name = path.filename().string();
+    for (const auto &entry : *entries) {
+        if (entry.name == name) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void JzProjectFileIndex::ScanTree(const std::filesystem::path &directory, JzDirectoryMap &directories, const std::atomic<Bool> *cancel)
+{
+    std::vector<fs::path> stack{directory};
+
+    while (!stack.empty()) {
+        if (cancel && cancel->load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        const fs::path current = std::move(stack.back());
+        stack.pop_back();
+
+        std::vector<JzProjectFileEntry> entries;
+        std::error_code                 ec;
+        for (fs::directory_iterator it(current, fs::directory_options::skip_permission_denied, ec), end; !ec && it != end; it.increment(ec)) {
+            JzProjectFileEntry entry;
+            entry.name        = it->path().filename().string();
+            entry.isDirectory = it->is_directory(ec);
+
+            if (entry.isDirectory) {
+                // Symlinked directories are listed but not followed, so links cannot form cycles
+                if (!it->is_symlink(ec)) {
+                    stack.push_back(it->path());
+                }
+            } else {
+                entry.size = it->file_size(ec);
+            }
+            ec.clear();
+
+            entries.push_back(std::move(entry));
+        }
+
+        std::sort(entries.begin(), entries.end(), EntryLess);
+        directories[current.string()] = std::move(entries);
+    }
+}
+
+Bool JzProjectFileIndex::EntryLess(const JzProjectFileEntry &lhs, const JzProjectFileEntry &rhs)
+{
+    if (lhs.isDirectory != rhs.isDirectory) {
+        return lhs.isDirectory;
+    }
+
+    const auto lowerLess = [](char a, char b) {
+        return std::tolower(static_cast<unsigned char>(a)) < std::tolower(static_cast<unsigned char>(b));
+    };
+    if (std::lexicographical_compare(lhs.name.begin(), lhs.name.end(), rhs.name.begin(), rhs.name.end(), lowerLess)) {
+        return true;
+    }
+    if (std::lexicographical_compare(rhs.name.begin(), rhs.name.end(), lhs.name.begin(), lhs.name.end(), lowerLess)) {
+        return false;
+    }
+    return lhs.name < rhs.name;
+}
+
+void JzProjectFileIndex::CancelBuild()
+{
+    if (!m_buildResult.valid()) {
+        return;
+    }
+
+    m_cancelBuild = true;
+    m_buildResult.wait();
+    m_buildResult = {};
+}
+
+void JzProjectFileIndex::ApplyChange(const JzFileChange &change)
+{
+    if (m_buildResult.valid()) {
+        m_pendingChanges.push_back(change);
+        return;
+    }
+
+    if (change.path == m_root) {
+        // The whole tree may have changed, which is what a full scan is for
+        Rebuild();
+        return;
+    }
+
+    if (change.kind == JzEFileChangeKind::Renamed && IsUnderRoot(change.previousPath)) {
+        RemovePath(change.previousPath);
+    }
+
+    if (!IsUnderRoot(change.path)) {
+        return;
+    }
+
+    switch (change.kind) {
+        case JzEFileChangeKind::Added:
+        case JzEFileChangeKind::Modified:
+        case JzEFileChangeKind::Renamed:
+            IndexPath(change.path);
+            break;
+        case JzEFileChangeKind::Removed:
+            RemovePath(change.path);
+            break;
+        case JzEFileChangeKind::Rescan:
+            RemovePath(change.path);
+            IndexPath(change.path);
+            break;
+    }
+}
+
+void JzProjectFileIndex::IndexPath(const std::filesystem::path &path)
+{
+    std::error_code ec;
+    const auto      status = fs::status(path, ec);
+    if (ec || !fs::exists(status)) {
+        RemovePath(path);
+        return;
+    }
+
+    const auto parent   = path.parent_path();
+    auto       parentIt = m_directories.find(parent.string());
+    if (parentIt == m_directories.end()) {
+        // Indexing the parent lists this path as well
+        if (parent != m_root && IsUnderRoot(parent)) {
+            IndexPath(parent);
+        }
+        return;
+    }
+
+    JzProjectFileEntry entry;
+    entry.name        = path.filename().string();
+    entry.isDirectory = fs::is_directory(status);
+    entry.size        = entry.isDirectory ? 0 : fs::file_size(path, ec);
+    entry.revision    = m_nextRevision++;
+
+    auto &entries = parentIt->second;
+    auto  it      = std::lower_bound(entries.begin(), entries.end(), entry, EntryLess);
+    if (it != entries.end() && it->name == entry.name && it->isDirectory == entry.isDirectory) {
+        // Directory modifications need no work, their children report their own changes
+        if (!entry.isDirectory) {
+            it->size     = entry.size;
+            it->revision = entry.revision;
+            m_version++;
+        }
+        return;
+    }
+
+    // A directory replaced by a file of the same name or the other way around
+    auto sameName = std::find_if(entries.begin(), entries.end(), [&](const JzProjectFileEntry &other) { return other.name == entry.name; });
+    if (sameName != entries.end()) {
+        RemovePath(path);
+        parentIt = m_directories.find(parent.string());
+    }
+
+    auto &parentEntries = parentIt->second;
+    parentEntries.insert(std::lower_bound(parentEntries.begin(), parentEntries.end(), entry, EntryLess), entry);
+
+    if (entry.isDirectory && !fs::is_symlink(path, ec)) {
+        ScanTree(path, m_directories, nullptr);
+    }
+    m_version++;
+}
+
+void JzProjectFileIndex::RemovePath(const std::filesystem::path &path)
+{
+    auto parentIt = m_directories.find(path.parent_path().string());
+    if (parentIt != m_directories.end()) {
+        const auto name    = path.filename().string();
+        auto      &entries = parentIt->second;
+        entries.erase(std::remove_if(entries.begin(), entries.end(), [&](const JzProjectFileEntry &entry) { return entry.name == name; }),
+                      entries.end());
+    }
+
+    const auto key    = path.string();
+    const auto prefix = (path / "").string();
+    for (auto it = m_directories.begin(); it != m_directories.end();) {
+        if (it->first == key || HasPrefix(it->first, prefix)) {
+            it = m_directories.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    m_version++;
+}
+
+Bool JzProjectFileIndex::IsUnderRoot(const std::filesystem::path &path) const
+{
+    return HasPrefix(path.string(), (m_root / "").string());
+}
+
+} // namespace JzRE
@@ -32,6 +32,7 @@ constexpr const char *ShaderCache       = "shader_cache";
 constexpr const char *ShaderSourceRoot  = "shader_source_root";
 constexpr const char *ShaderCookedRoot  = "shader_cooked_root";
 constexpr const char *ShaderAutoCook    = "shader_auto_cook";
+constexpr const char *TextureCookedRoot = "texture_cooked_root";
 constexpr const char *BuildOutput       = "build_output";
 constexpr const char *ImportRules       = "import_rules";
 constexpr const char *Modules           = "modules";
@@ -516,6 +517,9 @@ JzEProjectResult JzProjectManager::ParseProjectFile(const std::filesystem::path
         if (json.contains(Keys::ShaderAutoCook)) {
             outConfig.shaderAutoCook = json[Keys::ShaderAutoCook].get<Bool>();
         }
+        if (json.contains(Keys::TextureCookedRoot)) {
+            outConfig.textureCookedRoot = json[Keys::TextureCookedRoot].get<String>();
+        }
         if (json.contains(Keys::BuildOutput)) {
             outConfig.buildOutput = json[Keys::BuildOutput].get<String>();
         }
@@ -594,6 +598,7 @@ JzEProjectResult JzProjectManager::WriteProjectFile(const std::filesystem::path
         json[Keys::ShaderSourceRoot] = config.shaderSourceRoot.string();
         json[Keys::ShaderCookedRoot] = config.shaderCookedRoot.string();
         json[Keys::ShaderAutoCook]   = config.shaderAutoCook;
+        json[Keys::TextureCookedRoot] = config.textureCookedRoot.string();
         json[Keys::BuildOutput]   = config.buildOutput.string();
 
         // Import rules
@@ -665,6 +670,8 @@ Bool JzProjectManager::CreateProjectDirectories(const std::filesystem::path &pro
     // Create Intermediate directory for caches
     std::filesystem::create_directories(projectRoot / "Intermediate" / "ShaderCache", ec);
     if (ec) return false;
+    std::filesystem::create_directories(projectRoot / "Intermediate" / "CookedTextures", ec);
+    if (ec) return false;
 
     // Create Build directory
     std::filesystem::create_directories(projectRoot / "Build", ec);
@@ -0,0 +1,103 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Function/Rendering/JzBufferRangeAllocator.h"
+
+#include <algorithm>
+
+namespace JzRE {
+
+JzBufferRangeAllocator::JzBufferRangeAllocator(U64 capacity)
+{
+    Grow(capacity);
+}
+
+std::optional<U64> JzBufferRangeAllocator::Allocate(U64 count)
+{
+    if (count == 0) {
+        return std::nullopt;
+    }
+
+    for (auto it = m_freeRanges.begin(); it != m_freeRanges.end(); ++it) {
+        if (it->second < count) {
+            continue;
+        }
+
+        const U64 offset    = it->first;
+        const U64 remaining = it->second - count;
+        m_freeRanges.erase(it);
+        if (remaining > 0) {
+            m_freeRanges.emplace(offset + count, remaining);
+        }
+
+        m_used += count;
+        return offset;
+    }
+
+    return std::nullopt;
+}
+
+void JzBufferRangeAllocator::Free(U64 offset, U64 count)
+{
+    if (count == 0) {
+        return;
+    }
+
+    m_used -= std::min(m_used, count);
+
+    auto next = m_freeRanges.lower_bound(offset);
+
+    // Merge with the following range
+    if (next != m_freeRanges.end() && offset + count == next->first) {
+        count += next->second;
+        next   = m_freeRanges.erase(next);
+    }
+
+    // Merge with the preceding range
+    if (next != m_freeRanges.begin()) {
+        auto prev = std::prev(next);
+        if (prev->first + prev->second == offset) {
+            prev->second += count;
+            return;
+        }
+    }
+
+    m_freeRanges.emplace(offset, count);
+}
+
+void JzBufferRangeAllocator::Grow(U64 capacity)
+{
+    if (capacity <= m_capacity) {
+        return;
+    }
+
+    const U64 oldCapacity = m_capacity;
+    m_capacity            = capacity;
+
+    // Free() does the merge with a free tail; undo its usage bookkeeping
+    const U64 used = m_used;
+    Free(oldCapacity, capacity - oldCapacity);
+    m_used = used;
+}
+
+void JzBufferRangeAllocator::Reset()
+{
+    m_freeRanges.clear();
+    m_used = 0;
+    if (m_capacity > 0) {
+        m_freeRanges.emplace(0, m_capacity);
+    }
+}
+
+U64 JzBufferRangeAllocator::GetLargestFreeRange() const
+{
+    U64 largest = 0;
+    for (const auto &[offset, count] : m_freeRanges) {
+        largest = std::max(largest, count);
+    }
+    return largest;
+}
+
+} // namespace JzRE
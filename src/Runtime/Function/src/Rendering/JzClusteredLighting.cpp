@@ -0,0 +1,461 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Function/Rendering/JzClusteredLighting.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "JzRE/Runtime/Core/JzLogger.h"
+#include "JzRE/Runtime/Core/JzProfiler.h"
+#include "JzRE/Runtime/Core/JzSIMD.h"
+#include "JzRE/Runtime/Platform/Command/JzRHICommandList.h"
+#include "JzRE/Runtime/Platform/RHI/JzDevice.h"
+#include "JzRE/Runtime/Platform/RHI/JzRHIPipeline.h"
+
+namespace JzRE {
+
+namespace {
+
+constexpr U32 kMinLightCapacity = 64;
+constexpr F32 kDegreesToRadians = 3.14159265358979f / 180.0f;
+
+/**
+ * @brief Positive view-space distance at an NDC depth, for perspective and orthographic projections.
+ */
+F32 ViewDepthAtNdc(const JzMat4 &projection, F32 ndcZ)
+{
+    // ndcZ * (m32 * z + m33) = m22 * z + m23
+    const F32 denominator = ndcZ * projection.m32 - projection.m22;
+    if (std::abs(denominator) < 1e-12f) {
+        return std::numeric_limits<F32>::quiet_NaN();
+    }
+    return -(projection.m23 - ndcZ * projection.m33) / denominator;
+}
+
+std::shared_ptr<JzGPUTextureObject> EnsureTexture(JzDevice &device, std::shared_ptr<JzGPUTextureObject> texture,
+                                                  JzETextureResourceFormat format, U32 width, U32 height,
+                                                  const void *data, const String &debugName)
+{
+    if (texture && texture->GetWidth() == width && texture->GetHeight() == height) {
+        texture->UpdateData(data);
+        return texture;
+    }
+
+    JzGPUTextureObjectDesc desc;
+    desc.type      = JzETextureResourceType::Texture2D;
+    desc.format    = format;
+    desc.width     = width;
+    desc.height    = height;
+    desc.minFilter = JzETextureResourceFilter::Nearest;
+    desc.magFilter = JzETextureResourceFilter::Nearest;
+    desc.wrapS     = JzETextureResourceWrap::ClampToEdge;
+    desc.wrapT     = JzETextureResourceWrap::ClampToEdge;
+    desc.data      = data;
+    desc.debugName = debugName;
+    return device.CreateTexture(desc);
+}
+
+} // namespace
+
+JzClusteredLighting::JzClusteredLighting(U32 countX, U32 countY, U32 countZ) :
+    m_countX(std::max(countX, 1u)),
+    m_countY(std::max(countY, 1u)),
+    m_countZ(std::max(countZ, 1u))
+{
+    m_tileStride = (m_countX * m_countY + 3) & ~3u;
+
+    const Size boundsSize = static_cast<Size>(m_tileStride) * m_countZ;
+    for (auto *bounds : {&m_minX, &m_minY, &m_minZ, &m_maxX, &m_maxY, &m_maxZ,
+                         &m_centerX, &m_centerY, &m_centerZ, &m_radius}) {
+        bounds->assign(boundsSize, 0.0f);
+    }
+
+    const Size clusterCount = static_cast<Size>(m_countX) * m_countY * m_countZ;
+    m_clusterOffsets.assign(clusterCount, 0);
+    m_clusterCounts.assign(clusterCount, 0);
+}
+
+void JzClusteredLighting::Build(const std::vector<JzLightData> &lights, const JzMat4 &viewMatrix,
+                                const JzMat4 &projectionMatrix, const JzShadowAtlas *shadows)
+{
+    JzRE_PROFILE_SCOPE("ClusteredLighting_Build");
+
+    BuildClusterBounds(projectionMatrix);
+
+    // Camera position is -R^T * t of the rigid view transform
+    const JzMat4 &v = viewMatrix;
+    m_viewPosition  = JzVec3(-(v.m00 * v.m03 + v.m10 * v.m13 + v.m20 * v.m23),
+                             -(v.m01 * v.m03 + v.m11 * v.m13 + v.m21 * v.m23),
+                             -(v.m02 * v.m03 + v.m12 * v.m13 + v.m22 * v.m23));
+
+    m_lightTexels.clear();
+    m_assignments.clear();
+    m_lightCount            = 0;
+    m_directionalLightCount = 0;
+
+    Bool droppedLights = false;
+
+    // Directional lights take the first rows so the shader can loop over them without a list
+    const auto shadowOf = [shadows](U32 lightIndex) {
+        return shadows ? shadows->GetLightShadow(lightIndex) : JzShadowRange{};
+    };
+
+    for (U32 lightIndex = 0; lightIndex < lights.size(); ++lightIndex) {
+        const auto &light = lights[lightIndex];
+        if (light.type != JzELightType::Directional) {
+            continue;
+        }
+        if (m_lightCount == MaxLights) {
+            droppedLights = true;
+            break;
+        }
+        PackLight(m_lightCount++, light, shadowOf(lightIndex));
+    }
+    m_directionalLightCount = m_lightCount;
+
+    for (U32 lightIndex = 0; lightIndex < lights.size(); ++lightIndex) {
+        const auto &light = lights[lightIndex];
+        if (light.type == JzELightType::Directional) {
+            continue;
+        }
+        if (m_lightCount == MaxLights) {
+            droppedLights = true;
+            break;
+        }
+        const U32 lightRow = m_lightCount++;
+        PackLight(lightRow, light, shadowOf(lightIndex));
+        if (m_gridValid) {
+            AssignLight(lightRow, light, viewMatrix);
+        }
+    }
+
+    if (m_assignments.size() > MaxLightIndices) {
+        m_assignments.resize(MaxLightIndices);
+        droppedLights = true;
+    }
+    if (droppedLights && !m_warnedOverflow) {
+        JzRE_LOG_WARN("JzClusteredLighting: more than {} lights or {} cluster entries, extra lights are ignored",
+                      MaxLights, MaxLightIndices);
+        m_warnedOverflow = true;
+    }
+
+    BuildIndexLists();
+}
+
+void JzClusteredLighting::Upload(JzDevice &device)
+{
+    JzRE_PROFILE_SCOPE("ClusteredLighting_Upload");
+
+    // Grow by powers of two so a changing light count does not recreate textures every frame
+    const U32 lightCapacity = std::max(kMinLightCapacity, std::bit_ceil(m_lightCount));
+    m_lightTexels.resize(static_cast<Size>(lightCapacity) * TexelsPerLight * 4, 0.0f);
+    m_lightTexture = EnsureTexture(device, std::move(m_lightTexture), JzETextureResourceFormat::RGBA32F,
+                                   TexelsPerLight, lightCapacity, m_lightTexels.data(), "ClusteredLighting_Lights");
+
+    const Size clusterCount = m_clusterCounts.size();
+    m_clusterTexels.resize(clusterCount * 2);
+    for (Size cluster = 0; cluster < clusterCount; ++cluster) {
+        m_clusterTexels[cluster * 2]     = static_cast<F32>(m_clusterOffsets[cluster]);
+        m_clusterTexels[cluster * 2 + 1] = static_cast<F32>(m_clusterCounts[cluster]);
+    }
+    m_clusterTexture = EnsureTexture(device, std::move(m_clusterTexture), JzETextureResourceFormat::RG32F,
+                                     m_countX, m_countY * m_countZ, m_clusterTexels.data(),
+                                     "ClusteredLighting_Clusters");
+
+    const U32 indexRows = std::bit_ceil(std::max<U32>(
+        1, static_cast<U32>((m_lightIndices.size() + IndexTextureWidth - 1) / IndexTextureWidth)));
+    m_indexTexels.assign(static_cast<Size>(indexRows) * IndexTextureWidth, 0.0f);
+    std::transform(m_lightIndices.begin(), m_lightIndices.end(), m_indexTexels.begin(),
+                   [](U32 lightRow) { return static_cast<F32>(lightRow); });
+    m_indexTexture = EnsureTexture(device, std::move(m_indexTexture), JzETextureResourceFormat::R32F,
+                                   IndexTextureWidth, indexRows, m_indexTexels.data(), "ClusteredLighting_Indices");
+}
+
+void JzClusteredLighting::Bind(JzRHICommandList &commandList, JzRHIPipeline &pipeline) const
+{
+    const Bool enabled = m_lightCount > 0 && m_lightTexture && m_clusterTexture && m_indexTexture;
+    pipeline.SetUniform("lightingEnabled", enabled ? 1.0f : 0.0f);
+    if (!enabled) {
+        return;
+    }
+
+    commandList.BindTexture(m_lightTexture, LightDataSlot);
+    commandList.BindTexture(m_clusterTexture, ClusterGridSlot);
+    commandList.BindTexture(m_indexTexture, LightIndicesSlot);
+
+    pipeline.SetUniform("clusterGridSize", JzVec4(static_cast<F32>(m_countX), static_cast<F32>(m_countY),
+                                                  static_cast<F32>(m_countZ),
+                                                  static_cast<F32>(m_directionalLightCount)));
+    pipeline.SetUniform("clusterDepthParams", JzVec4(m_sliceScale, m_sliceBias, m_logarithmic ? 1.0f : 0.0f, 0.0f));
+    pipeline.SetUniform("viewPosition", m_viewPosition);
+
+    // Texel fetches carry no sampler, so GLSL sees them combined with SPIRV-Cross's dummy sampler
+    pipeline.SetUniform("lightData", static_cast<I32>(LightDataSlot));
+    pipeline.SetUniform("clusterGrid", static_cast<I32>(ClusterGridSlot));
+    pipeline.SetUniform("clusterLightIndices", static_cast<I32>(LightIndicesSlot));
+    pipeline.SetUniform("SPIRV_Cross_CombinedlightDataSPIRV_Cross_DummySampler", static_cast<I32>(LightDataSlot));
+    pipeline.SetUniform("SPIRV_Cross_CombinedclusterGridSPIRV_Cross_DummySampler", static_cast<I32>(ClusterGridSlot));
+    pipeline.SetUniform("SPIRV_Cross_CombinedclusterLightIndicesSPIRV_Cross_DummySampler",
+                        static_cast<I32>(LightIndicesSlot));
+}
+
+void JzClusteredLighting::Reset()
+{
+    m_lightTexture.reset();
+    m_clusterTexture.reset();
+    m_indexTexture.reset();
+}
+
+std::span<const U32> JzClusteredLighting::GetClusterLights(U32 clusterIndex) const
+{
+    if (clusterIndex >= m_clusterCounts.size()) {
+        return {};
+    }
+    return {m_lightIndices.data() + m_clusterOffsets[clusterIndex], m_clusterCounts[clusterIndex]};
+}
+
+I32 JzClusteredLighting::GetDepthSlice(F32 viewDepth) const
+{
+    if (!m_gridValid || !(viewDepth >= m_nearPlane && viewDepth <= m_farPlane)) {
+        return -1;
+    }
+
+    const F32 depthTerm = m_logarithmic ? std::log(viewDepth) : viewDepth;
+    const F32 slice     = std::floor(depthTerm * m_sliceScale + m_sliceBias);
+    return std::clamp(static_cast<I32>(slice), 0, static_cast<I32>(m_countZ) - 1);
+}
+
+void JzClusteredLighting::BuildClusterBounds(const JzMat4 &projectionMatrix)
+{
+    if (m_hasBounds && std::memcmp(m_boundsProjection.Data(), projectionMatrix.Data(), sizeof(F32) * 16) == 0) {
+        return;
+    }
+    m_boundsProjection = projectionMatrix;
+    m_hasBounds        = true;
+
+    const JzMat4 &p = projectionMatrix;
+    m_logarithmic   = std::abs(p.m33) < 1e-6f;
+    m_nearPlane     = ViewDepthAtNdc(p, -1.0f);
+    m_farPlane      = ViewDepthAtNdc(p, 1.0f);
+    if (!m_logarithmic && m_nearPlane > m_farPlane) {
+        std::swap(m_nearPlane, m_farPlane);
+    }
+
+    m_gridValid = std::isfinite(m_nearPlane) && std::isfinite(m_farPlane) && m_farPlane > m_nearPlane &&
+                  (!m_logarithmic || m_nearPlane > 0.0f) && std::abs(p.m00) > 1e-12f && std::abs(p.m11) > 1e-12f;
+
+    // Empty boxes and negative radii never pass a test, covering padding lanes and invalid grids
+    std::fill(m_minX.begin(), m_minX.end(), std::numeric_limits<F32>::max());
+    std::fill(m_minY.begin(), m_minY.end(), std::numeric_limits<F32>::max());
+    std::fill(m_minZ.begin(), m_minZ.end(), std::numeric_limits<F32>::max());
+    std::fill(m_maxX.begin(), m_maxX.end(), std::numeric_limits<F32>::lowest());
+    std::fill(m_maxY.begin(), m_maxY.end(), std::numeric_limits<F32>::lowest());
+    std::fill(m_maxZ.begin(), m_maxZ.end(), std::numeric_limits<F32>::lowest());
+    std::fill(m_radius.begin(), m_radius.end(), std::numeric_limits<F32>::lowest());
+
+    if (!m_gridValid) {
+        m_sliceScale = 0.0f;
+        m_sliceBias  = 0.0f;
+        return;
+    }
+
+    const auto sliceDepth = [this](U32 slice) {
+        const F32 t = static_cast<F32>(slice) / static_cast<F32>(m_countZ);
+        return m_logarithmic ? m_nearPlane * std::pow(m_farPlane / m_nearPlane, t)
+                             : m_nearPlane + (m_farPlane - m_nearPlane) * t;
+    };
+
+    if (m_logarithmic) {
+        const F32 logRatio = std::log(m_farPlane / m_nearPlane);
+        m_sliceScale       = static_cast<F32>(m_countZ) / logRatio;
+        m_sliceBias        = -static_cast<F32>(m_countZ) * std::log(m_nearPlane) / logRatio;
+    } else {
+        m_sliceScale = static_cast<F32>(m_countZ) / (m_farPlane - m_nearPlane);
+        m_sliceBias  = -m_nearPlane * m_sliceScale;
+    }
+
+    // View-space point on the ray through an NDC x/y at a view distance
+    const auto unproject = [&p](F32 ndcX, F32 ndcY, F32 depth) {
+        const F32 z = -depth;
+        const F32 w = p.m32 * z + p.m33;
+        return JzVec3((ndcX * w - p.m02 * z - p.m03) / p.m00, (ndcY * w - p.m12 * z - p.m13) / p.m11, z);
+    };
+
+    for (U32 slice = 0; slice < m_countZ; ++slice) {
+        const F32 nearDepth = sliceDepth(slice);
+        const F32 farDepth  = sliceDepth(slice + 1);
+
+        for (U32 y = 0; y < m_countY; ++y) {
+            const F32 ndcY0 = -1.0f + 2.0f * static_cast<F32>(y) / static_cast<F32>(m_countY);
+            const F32 ndcY1 = -1.0f + 2.0f * static_cast<F32>(y + 1) / static_cast<F32>(m_countY);
+
+            for (U32 x = 0; x < m_countX; ++x) {
+                const F32 ndcX0 = -1.0f + 2.0f * static_cast<F32>(x) / static_cast<F32>(m_countX);
+                const F32 ndcX1 = -1.0f + 2.0f * static_cast<F32>(x + 1) / static_cast<F32>(m_countX);
+
+                JzVec3 boundsMin(std::numeric_limits<F32>::max(), std::numeric_limits<F32>::max(),
+                                 std::numeric_limits<F32>::max());
+                JzVec3 boundsMax(std::numeric_limits<F32>::lowest(), std::numeric_limits<F32>::lowest(),
+                                 std::numeric_limits<F32>::lowest());
+                for (F32 depth : {nearDepth, farDepth}) {
+                    for (F32 ndcX : {ndcX0, ndcX1}) {
+                        for (F32 ndcY : {ndcY0, ndcY1}) {
+                            const JzVec3 corner = unproject(ndcX, ndcY, depth);
+                            boundsMin           = JzVec3(std::min(boundsMin.x, corner.x), std::min(boundsMin.y, corner.y),
+                                                         std::min(boundsMin.z, corner.z));
+                            boundsMax           = JzVec3(std::max(boundsMax.x, corner.x), std::max(boundsMax.y, corner.y),
+                                                         std::max(boundsMax.z, corner.z));
+                        }
+                    }
+                }
+
+                const Size   index  = static_cast<Size>(slice) * m_tileStride + y * m_countX + x;
+                const JzVec3 extent = (boundsMax - boundsMin) * 0.5f;
+                m_minX[index]       = boundsMin.x;
+                m_minY[index]       = boundsMin.y;
+                m_minZ[index]       = boundsMin.z;
+                m_maxX[index]       = boundsMax.x;
+                m_maxY[index]       = boundsMax.y;
+                m_maxZ[index]       = boundsMax.z;
+                m_centerX[index]    = boundsMin.x + extent.x;
+                m_centerY[index]    = boundsMin.y + extent.y;
+                m_centerZ[index]    = boundsMin.z + extent.z;
+                m_radius[index]     = extent.Length();
+            }
+        }
+    }
+}
+
+void JzClusteredLighting::AssignLight(U32 lightRow, const JzLightData &light, const JzMat4 &viewMatrix)
+{
+    if (light.range <= 0.0f) {
+        return;
+    }
+
+    const JzVec4 center = viewMatrix * JzVec4(light.position.x, light.position.y, light.position.z, 1.0f);
+    const F32    depth  = -center.z;
+    if (depth + light.range < m_nearPlane || depth - light.range > m_farPlane) {
+        return;
+    }
+
+    const auto sliceOf = [this](F32 viewDepth) {
+        const F32 depthTerm = m_logarithmic ? std::log(viewDepth) : viewDepth;
+        return std::clamp(static_cast<I32>(std::floor(depthTerm * m_sliceScale + m_sliceBias)), 0,
+                          static_cast<I32>(m_countZ) - 1);
+    };
+    const I32 firstSlice = sliceOf(std::max(depth - light.range, m_nearPlane));
+    const I32 lastSlice  = sliceOf(std::min(depth + light.range, m_farPlane));
+
+    const JzF32x4 centerX = JzF32x4::Splat(center.x);
+    const JzF32x4 centerY = JzF32x4::Splat(center.y);
+    const JzF32x4 centerZ = JzF32x4::Splat(center.z);
+    const JzF32x4 range   = JzF32x4::Splat(light.range);
+    const JzF32x4 rangeSq = JzF32x4::Splat(light.range * light.range);
+    const JzF32x4 zero    = JzF32x4::Splat(0.0f);
+
+    // Spot lights also test the cone against each cluster's bounding sphere
+    const Bool isCone = light.type == JzELightType::Spot && light.outerCutoff < 90.0f;
+    JzVec4     axis(0.0f, 0.0f, 0.0f, 0.0f);
+    if (isCone) {
+        axis = viewMatrix * JzVec4(light.direction.x, light.direction.y, light.direction.z, 0.0f);
+    }
+    const F32     axisLength = std::sqrt(axis.x * axis.x + axis.y * axis.y + axis.z * axis.z);
+    const F32     axisScale  = axisLength > 0.0f ? 1.0f / axisLength : 0.0f;
+    const JzF32x4 axisX      = JzF32x4::Splat(axis.x * axisScale);
+    const JzF32x4 axisY      = JzF32x4::Splat(axis.y * axisScale);
+    const JzF32x4 axisZ      = JzF32x4::Splat(axis.z * axisScale);
+    const JzF32x4 coneCos    = JzF32x4::Splat(std::cos(light.outerCutoff * kDegreesToRadians));
+    const JzF32x4 coneSin    = JzF32x4::Splat(std::sin(light.outerCutoff * kDegreesToRadians));
+
+    const U32 tilesPerSlice = m_countX * m_countY;
+    for (I32 slice = firstSlice; slice <= lastSlice; ++slice) {
+        const Size sliceBase = static_cast<Size>(slice) * m_tileStride;
+
+        for (U32 tile = 0; tile < tilesPerSlice; tile += 4) {
+            const Size index = sliceBase + tile;
+
+            // Squared distance from the sphere center to the box
+            const JzF32x4 dx  = Max(Max(JzF32x4::Load(&m_minX[index]) - centerX, centerX - JzF32x4::Load(&m_maxX[index])), zero);
+            const JzF32x4 dy  = Max(Max(JzF32x4::Load(&m_minY[index]) - centerY, centerY - JzF32x4::Load(&m_maxY[index])), zero);
+            const JzF32x4 dz  = Max(Max(JzF32x4::Load(&m_minZ[index]) - centerZ, centerZ - JzF32x4::Load(&m_maxZ[index])), zero);
+            JzF32x4       hit = LessEqual(dx * dx + dy * dy + dz * dz, rangeSq);
+
+            if (isCone) {
+                const JzF32x4 radius   = JzF32x4::Load(&m_radius[index]);
+                const JzF32x4 toX      = JzF32x4::Load(&m_centerX[index]) - centerX;
+                const JzF32x4 toY      = JzF32x4::Load(&m_centerY[index]) - centerY;
+                const JzF32x4 toZ      = JzF32x4::Load(&m_centerZ[index]) - centerZ;
+                const JzF32x4 lengthSq = toX * toX + toY * toY + toZ * toZ;
+                const JzF32x4 along    = toX * axisX + toY * axisY + toZ * axisZ;
+                const JzF32x4 across   = Sqrt(Max(lengthSq - along * along, zero));
+                const JzF32x4 distance = coneCos * across - along * coneSin;
+
+                const JzF32x4 insideAngle = LessEqual(distance, radius);
+                const JzF32x4 beforeEnd   = LessEqual(along, radius + range);
+                const JzF32x4 afterApex   = LessEqual(zero - radius, along);
+                hit                       = And(hit, And(insideAngle, And(beforeEnd, afterApex)));
+            }
+
+            U32 mask = hit.MoveMask();
+            while (mask != 0) {
+                const U32 lane = static_cast<U32>(std::countr_zero(mask));
+                mask &= mask - 1;
+
+                const U32 tileIndex = tile + lane;
+                if (tileIndex >= tilesPerSlice) {
+                    continue;
+                }
+                const U64 cluster = static_cast<U64>(slice) * tilesPerSlice + tileIndex;
+                m_assignments.push_back((cluster << 32) | lightRow);
+            }
+        }
+    }
+}
+
+void JzClusteredLighting::PackLight(U32 lightRow, const JzLightData &light, const JzShadowRange &shadow)
+{
+    const Size offset = static_cast<Size>(lightRow) * TexelsPerLight * 4;
+    if (m_lightTexels.size() < offset + TexelsPerLight * 4) {
+        m_lightTexels.resize(offset + TexelsPerLight * 4, 0.0f);
+    }
+
+    const Bool   hasCone  = light.type == JzELightType::Spot;
+    const JzVec3 radiance = light.color * light.intensity;
+    const F32    packed[] = {
+        light.position.x, light.position.y, light.position.z, light.range,
+        radiance.x, radiance.y, radiance.z, static_cast<F32>(static_cast<U32>(light.type)),
+        light.direction.x, light.direction.y, light.direction.z,
+        hasCone ? std::cos(light.outerCutoff * kDegreesToRadians) : -1.0f,
+        hasCone ? std::cos(light.innerCutoff * kDegreesToRadians) : -1.0f,
+        static_cast<F32>(shadow.firstView), static_cast<F32>(shadow.viewCount), 0.0f};
+    std::copy(std::begin(packed), std::end(packed), m_lightTexels.begin() + static_cast<std::ptrdiff_t>(offset));
+}
+
+void JzClusteredLighting::BuildIndexLists()
+{
+    std::fill(m_clusterCounts.begin(), m_clusterCounts.end(), 0u);
+    for (const U64 assignment : m_assignments) {
+        ++m_clusterCounts[static_cast<Size>(assignment >> 32)];
+    }
+
+    U32 offset = 0;
+    for (Size cluster = 0; cluster < m_clusterCounts.size(); ++cluster) {
+        m_clusterOffsets[cluster]  = offset;
+        offset                    += m_clusterCounts[cluster];
+    }
+
+    // Assignments are in light order, so a stable scatter keeps every list ascending
+    m_lightIndices.resize(offset);
+    std::vector<U32> cursor = m_clusterOffsets;
+    for (const U64 assignment : m_assignments) {
+        m_lightIndices[cursor[static_cast<Size>(assignment >> 32)]++] = static_cast<U32>(assignment);
+    }
+}
+
+} // namespace JzRE
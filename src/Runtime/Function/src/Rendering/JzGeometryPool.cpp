@@ -0,0 +1,294 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Function/Rendering/JzGeometryPool.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+
+#include "JzRE/Runtime/Core/JzLogger.h"
+#include "JzRE/Runtime/Core/JzServiceContainer.h"
+#include "JzRE/Runtime/Platform/RHI/JzDevice.h"
+#include "JzRE/Runtime/Resource/JzMesh.h"
+
+namespace JzRE {
+
+namespace {
+
+constexpr U64 kEvictionInterval = 64; ///< Frames between residency sweeps
+constexpr U64 kRetireLatency    = 2;  ///< Frames a replaced buffer may still be in flight
+constexpr U32 kMinDrawCapacity  = 64;
+
+} // namespace
+
+JzGeometryPool::JzGeometryPool(U32 initialVertexCapacity, U32 initialIndexCapacity) :
+    m_vertexRanges(initialVertexCapacity),
+    m_indexRanges(initialIndexCapacity) { }
+
+void JzGeometryPool::BeginFrame()
+{
+    m_frameIndex++;
+    m_frameParity  = static_cast<U32>(m_frameIndex & 1u);
+    m_streamCursor = 0;
+
+    std::erase_if(m_retired, [this](const JzRetiredBuffer &retired) {
+        return m_frameIndex - retired.retiredFrame > kRetireLatency;
+    });
+
+    if (m_frameIndex % kEvictionInterval == 0) {
+        EvictUnused();
+    }
+}
+
+const JzGeometryAllocation *JzGeometryPool::Acquire(JzMeshHandle handle, const JzMesh &mesh)
+{
+    auto iter = m_entries.find(handle);
+    if (iter != m_entries.end()) {
+        iter->second.lastUsedFrame = m_frameIndex;
+        return &iter->second.allocation;
+    }
+
+    const auto &vertices = mesh.GetVertices();
+    const auto &indices  = mesh.GetIndices();
+    if (vertices.empty() || indices.empty()) {
+        return nullptr;
+    }
+
+    if (!m_vertexBuffer && !EnsureGeometryBuffers(m_vertexRanges.GetCapacity(), m_indexRanges.GetCapacity())) {
+        return nullptr;
+    }
+
+    auto vertexOffset = m_vertexRanges.Allocate(vertices.size());
+    if (!vertexOffset) {
+        const U64 capacity = m_vertexRanges.GetCapacity();
+        if (!EnsureGeometryBuffers(std::max(capacity * 2, capacity + vertices.size()), m_indexRanges.GetCapacity())) {
+            return nullptr;
+        }
+        vertexOffset = m_vertexRanges.Allocate(vertices.size());
+    }
+
+    auto indexOffset = m_indexRanges.Allocate(indices.size());
+    if (!indexOffset) {
+        const U64 capacity = m_indexRanges.GetCapacity();
+        if (!EnsureGeometryBuffers(m_vertexRanges.GetCapacity(), std::max(capacity * 2, capacity + indices.size()))) {
+            if (vertexOffset) {
+                m_vertexRanges.Free(*vertexOffset, vertices.size());
+            }
+            return nullptr;
+        }
+        indexOffset = m_indexRanges.Allocate(indices.size());
+    }
+
+    if (!vertexOffset || !indexOffset) {
+        return nullptr;
+    }
+
+    std::copy(vertices.begin(), vertices.end(), m_vertexData.begin() + static_cast<std::ptrdiff_t>(*vertexOffset));
+    std::copy(indices.begin(), indices.end(), m_indexData.begin() + static_cast<std::ptrdiff_t>(*indexOffset));
+
+    m_vertexBuffer->UpdateData(vertices.data(), vertices.size() * sizeof(JzVertex), *vertexOffset * sizeof(JzVertex));
+    m_indexBuffer->UpdateData(indices.data(), indices.size() * sizeof(U32), *indexOffset * sizeof(U32));
+
+    JzEntry entry;
+    entry.allocation.firstIndex   = static_cast<U32>(*indexOffset);
+    entry.allocation.indexCount   = static_cast<U32>(indices.size());
+    entry.allocation.vertexOffset = static_cast<I32>(*vertexOffset);
+    entry.allocation.vertexCount  = static_cast<U32>(vertices.size());
+    entry.lastUsedFrame           = m_frameIndex;
+
+    auto [inserted, _] = m_entries.emplace(handle, entry);
+    return &inserted->second.allocation;
+}
+
+const JzGeometryDrawStream *JzGeometryPool::Upload(const std::vector<JzGeometryInstanceData>   &instances,
+                                                   const std::vector<JzDrawIndexedIndirectArgs> &args)
+{
+    if (args.empty() || instances.size() != args.size() || !m_vertexBuffer) {
+        return nullptr;
+    }
+
+    auto &streams = m_streams[m_frameParity];
+    if (m_streamCursor >= streams.size()) {
+        streams.emplace_back();
+    }
+    auto &stream = streams[m_streamCursor++];
+
+    if (!EnsureStreamCapacity(stream, static_cast<U32>(args.size()))) {
+        return nullptr;
+    }
+    if (!stream.vertexArray || stream.geometryVersion != m_geometryVersion) {
+        RebuildVertexArray(stream);
+        if (!stream.vertexArray) {
+            return nullptr;
+        }
+    }
+
+    stream.instanceBuffer->UpdateData(instances.data(), instances.size() * sizeof(JzGeometryInstanceData));
+    stream.indirectBuffer->UpdateData(args.data(), args.size() * sizeof(JzDrawIndexedIndirectArgs));
+    return &stream;
+}
+
+void JzGeometryPool::Clear()
+{
+    m_entries.clear();
+    m_retired.clear();
+    m_streams[0].clear();
+    m_streams[1].clear();
+    m_streamCursor = 0;
+
+    m_vertexBuffer = nullptr;
+    m_indexBuffer  = nullptr;
+    m_vertexData.clear();
+    m_vertexData.shrink_to_fit();
+    m_indexData.clear();
+    m_indexData.shrink_to_fit();
+    m_vertexRanges.Reset();
+    m_indexRanges.Reset();
+    m_geometryVersion++;
+}
+
+Bool JzGeometryPool::EnsureGeometryBuffers(U64 vertexCapacity, U64 indexCapacity)
+{
+    if (m_vertexBuffer && m_indexBuffer && vertexCapacity == m_vertexData.size() &&
+        indexCapacity == m_indexData.size()) {
+        return true;
+    }
+    if (!JzServiceContainer::Has<JzDevice>()) {
+        return false;
+    }
+
+    auto &device = JzServiceContainer::Get<JzDevice>();
+
+    m_vertexData.resize(vertexCapacity);
+    m_indexData.resize(indexCapacity);
+
+    // Recreate from the CPU mirror: the old buffers may still be read by in-flight frames
+    JzGPUBufferObjectDesc vbDesc;
+    vbDesc.type      = JzEGPUBufferObjectType::Vertex;
+    vbDesc.usage     = JzEGPUBufferObjectUsage::DynamicDraw;
+    vbDesc.size      = m_vertexData.size() * sizeof(JzVertex);
+    vbDesc.data      = m_vertexData.data();
+    vbDesc.debugName = "GeometryPoolVB";
+
+    auto vertexBuffer = device.CreateBuffer(vbDesc);
+
+    JzGPUBufferObjectDesc ibDesc;
+    ibDesc.type      = JzEGPUBufferObjectType::Index;
+    ibDesc.usage     = JzEGPUBufferObjectUsage::DynamicDraw;
+    ibDesc.size      = m_indexData.size() * sizeof(U32);
+    ibDesc.data      = m_indexData.data();
+    ibDesc.debugName = "GeometryPoolIB";
+
+    auto indexBuffer = device.CreateBuffer(ibDesc);
+
+    if (!vertexBuffer || !indexBuffer) {
+        JzRE_LOG_ERROR("JzGeometryPool: failed to allocate shared geometry buffers ({} vertices, {} indices)",
+                       vertexCapacity, indexCapacity);
+        return false;
+    }
+
+    Retire(m_vertexBuffer);
+    Retire(m_indexBuffer);
+    m_vertexBuffer = std::move(vertexBuffer);
+    m_indexBuffer  = std::move(indexBuffer);
+    m_vertexRanges.Grow(vertexCapacity);
+    m_indexRanges.Grow(indexCapacity);
+    m_geometryVersion++;
+    return true;
+}
+
+Bool JzGeometryPool::EnsureStreamCapacity(JzGeometryDrawStream &stream, U32 drawCount)
+{
+    if (stream.instanceBuffer && stream.indirectBuffer && stream.drawCapacity >= drawCount) {
+        return true;
+    }
+
+    auto      &device   = JzServiceContainer::Get<JzDevice>();
+    const U32  capacity = std::max(kMinDrawCapacity, std::bit_ceil(drawCount));
+
+    JzGPUBufferObjectDesc instanceDesc;
+    instanceDesc.type      = JzEGPUBufferObjectType::Vertex;
+    instanceDesc.usage     = JzEGPUBufferObjectUsage::StreamDraw;
+    instanceDesc.size      = static_cast<Size>(capacity) * sizeof(JzGeometryInstanceData);
+    instanceDesc.data      = nullptr;
+    instanceDesc.debugName = "GeometryPoolInstances";
+    auto instanceBuffer    = device.CreateBuffer(instanceDesc);
+
+    JzGPUBufferObjectDesc indirectDesc;
+    indirectDesc.type      = JzEGPUBufferObjectType::Indirect;
+    indirectDesc.usage     = JzEGPUBufferObjectUsage::StreamDraw;
+    indirectDesc.size      = static_cast<Size>(capacity) * sizeof(JzDrawIndexedIndirectArgs);
+    indirectDesc.data      = nullptr;
+    indirectDesc.debugName = "GeometryPoolIndirectArgs";
+    auto indirectBuffer    = device.CreateBuffer(indirectDesc);
+
+    if (!instanceBuffer || !indirectBuffer) {
+        return false;
+    }
+
+    Retire(stream.instanceBuffer);
+    Retire(stream.indirectBuffer);
+    stream.instanceBuffer  = std::move(instanceBuffer);
+    stream.indirectBuffer  = std::move(indirectBuffer);
+    stream.drawCapacity    = capacity;
+    stream.geometryVersion = 0;
+    return true;
+}
+
+void JzGeometryPool::RebuildVertexArray(JzGeometryDrawStream &stream)
+{
+    auto &device      = JzServiceContainer::Get<JzDevice>();
+    auto  vertexArray = device.CreateVertexArray("GeometryPoolVAO");
+    if (!vertexArray) {
+        return;
+    }
+
+    // Binding 0: shared vertices, same layout as JzMesh
+    vertexArray->BindVertexBuffer(m_vertexBuffer, 0);
+    vertexArray->BindIndexBuffer(m_indexBuffer);
+    vertexArray->SetVertexAttribute(0, 3, sizeof(JzVertex), offsetof(JzVertex, Position));
+    vertexArray->SetVertexAttribute(1, 3, sizeof(JzVertex), offsetof(JzVertex, Normal));
+    vertexArray->SetVertexAttribute(2, 2, sizeof(JzVertex), offsetof(JzVertex, TexCoords));
+    vertexArray->SetVertexAttribute(3, 3, sizeof(JzVertex), offsetof(JzVertex, Tangent));
+    vertexArray->SetVertexAttribute(4, 3, sizeof(JzVertex), offsetof(JzVertex, Bitangent));
+
+    // Binding 1: per-draw data, four matrix rows followed by the material colors
+    vertexArray->BindVertexBuffer(stream.instanceBuffer, 1);
+    constexpr U32 kInstanceSlots = sizeof(JzGeometryInstanceData) / (4 * sizeof(F32));
+    for (U32 slot = 0; slot < kInstanceSlots; ++slot) {
+        const U32 location = InstanceAttributeLocation + slot;
+        vertexArray->SetVertexAttribute(location, 4, sizeof(JzGeometryInstanceData), slot * 4 * sizeof(F32));
+        vertexArray->SetVertexAttributeDivisor(location, 1);
+    }
+
+    Retire(stream.vertexArray);
+    stream.vertexArray     = std::move(vertexArray);
+    stream.geometryVersion = m_geometryVersion;
+}
+
+void JzGeometryPool::Retire(std::shared_ptr<JzGPUResource> resource)
+{
+    if (resource) {
+        m_retired.push_back({std::move(resource), m_frameIndex});
+    }
+}
+
+void JzGeometryPool::EvictUnused()
+{
+    for (auto iter = m_entries.begin(); iter != m_entries.end();) {
+        const auto &entry = iter->second;
+        if (m_frameIndex - entry.lastUsedFrame <= EvictAfterFrames) {
+            ++iter;
+            continue;
+        }
+
+        m_vertexRanges.Free(static_cast<U64>(entry.allocation.vertexOffset), entry.allocation.vertexCount);
+        m_indexRanges.Free(entry.allocation.firstIndex, entry.allocation.indexCount);
+        iter = m_entries.erase(iter);
+    }
+}
+
+} // namespace JzRE
@@ -0,0 +1,42 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Function/Rendering/JzIndirectDrawBatcher.h"
+
+#include <algorithm>
+#include <tuple>
+
+namespace JzRE {
+
+JzIndirectDrawBatch JzIndirectDrawBatcher::Build(std::vector<JzIndirectDrawInput> inputs)
+{
+    std::stable_sort(inputs.begin(), inputs.end(), [](const JzIndirectDrawInput &lhs, const JzIndirectDrawInput &rhs) {
+        return std::make_tuple(lhs.textures.diffuse.get(), lhs.textures.normal.get(), lhs.textures.specular.get()) <
+               std::make_tuple(rhs.textures.diffuse.get(), rhs.textures.normal.get(), rhs.textures.specular.get());
+    });
+
+    JzIndirectDrawBatch batch;
+    batch.instances.reserve(inputs.size());
+    batch.args.reserve(inputs.size());
+
+    for (auto &input : inputs) {
+        const U32 drawIndex = static_cast<U32>(batch.args.size());
+        if (batch.groups.empty() || !(batch.groups.back().textures == input.textures)) {
+            JzIndirectDrawGroup group;
+            group.textures  = std::move(input.textures);
+            group.firstDraw = drawIndex;
+            batch.groups.push_back(std::move(group));
+        }
+        batch.groups.back().drawCount++;
+
+        batch.args.push_back(input.args);
+        batch.args.back().firstInstance = drawIndex;
+        batch.instances.push_back(input.instance);
+    }
+
+    return batch;
+}
+
+} // namespace JzRE
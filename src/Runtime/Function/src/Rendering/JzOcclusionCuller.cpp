@@ -0,0 +1,378 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Function/Rendering/JzOcclusionCuller.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "JzRE/Runtime/Core/JzProfiler.h"
+#include "JzRE/Runtime/Core/JzSIMD.h"
+#include "JzRE/Runtime/Core/JzThreadPool.h"
+
+namespace JzRE {
+
+namespace {
+
+constexpr F32 kEmptyDepth   = std::numeric_limits<F32>::max();
+constexpr F32 kMinClipW     = 1e-4f; ///< Vertices closer to the eye plane count as crossing the near plane
+constexpr U32 kBandRows     = JzOcclusionCuller::TileSize * 2;
+constexpr U32 kSphereGrain  = 64;
+constexpr F32 kMinTriangleArea = 1e-6f;
+
+U32 RoundUpToTile(U32 value)
+{
+    const U32 tiles = std::max<U32>((value + JzOcclusionCuller::TileSize - 1) / JzOcclusionCuller::TileSize, 1);
+    return tiles * JzOcclusionCuller::TileSize;
+}
+
+JzVec4 TransformPoint(const JzMat4 &m, const JzVec3 &p)
+{
+    return m * JzVec4(p.x, p.y, p.z, 1.0f);
+}
+
+/**
+ * @brief Run func(begin, end) over [0, count) on the pool, or inline without one.
+ */
+template <typename F>
+void RunParallel(JzThreadPool *threadPool, Size count, Size grain, F &&func)
+{
+    if (threadPool && count > grain) {
+        threadPool->ParallelFor(0, count, grain, func);
+    } else if (count > 0) {
+        func(Size{0}, count);
+    }
+}
+
+} // namespace
+
+JzOcclusionCuller::JzOcclusionCuller(JzOcclusionSettings settings)
+{
+    SetSettings(settings);
+    BeginFrame(JzMat4x4::Identity(), JzMat4x4::Identity());
+}
+
+void JzOcclusionCuller::SetSettings(const JzOcclusionSettings &settings)
+{
+    m_settings = settings;
+}
+
+void JzOcclusionCuller::BeginFrame(const JzMat4 &viewMatrix, const JzMat4 &projectionMatrix)
+{
+    m_width       = RoundUpToTile(m_settings.width);
+    m_height      = RoundUpToTile(m_settings.height);
+    m_tilesPerRow = m_width / TileSize;
+
+    m_viewMatrix     = viewMatrix;
+    m_viewProjection = projectionMatrix * viewMatrix;
+
+    m_depth.assign(static_cast<Size>(m_width) * m_height, kEmptyDepth);
+    m_tileMaxDepth.assign(static_cast<Size>(m_tilesPerRow) * (m_height / TileSize), kEmptyDepth);
+    m_occluders.clear();
+    m_triangles.clear();
+    m_stats = {};
+}
+
+void JzOcclusionCuller::AddOccluder(const JzOccluderMesh &occluder)
+{
+    if (occluder.vertices && occluder.indices && occluder.indices->size() >= 3) {
+        m_occluders.push_back(occluder);
+    }
+}
+
+void JzOcclusionCuller::Rasterize()
+{
+    JzRE_PROFILE_SCOPE("OcclusionCuller_Rasterize");
+
+    // Largest on screen first: bounding radius over distance from the eye
+    std::vector<F32> screenSize(m_occluders.size(), 0.0f);
+    for (Size i = 0; i < m_occluders.size(); ++i) {
+        const JzVec4 center   = TransformPoint(m_viewMatrix, m_occluders[i].boundsCenter);
+        const F32    distance = JzVec3(center.x, center.y, center.z).Length();
+        screenSize[i]         = m_occluders[i].boundsRadius / std::max(distance, 1e-3f);
+    }
+
+    std::vector<Size> order(m_occluders.size());
+    std::iota(order.begin(), order.end(), Size{0});
+    std::stable_sort(order.begin(), order.end(), [&](Size a, Size b) { return screenSize[a] > screenSize[b]; });
+
+    std::vector<JzOccluderMesh> selected;
+    U32                         triangleCount = 0;
+    for (Size index : order) {
+        if (selected.size() >= m_settings.maxOccluders) {
+            break;
+        }
+        const U32 triangles = static_cast<U32>(m_occluders[index].indices->size() / 3);
+        if (triangleCount + triangles > m_settings.maxOccluderTriangles) {
+            continue;
+        }
+        selected.push_back(m_occluders[index]);
+        triangleCount += triangles;
+    }
+    m_occluders = std::move(selected);
+
+    m_stats.occluders         = static_cast<U32>(m_occluders.size());
+    m_stats.occluderTriangles = triangleCount;
+
+    SetupTriangles();
+
+    // Bands own disjoint rows and tiles, so they need no synchronization
+    const U32 bandCount = (m_height + kBandRows - 1) / kBandRows;
+    RunParallel(m_threadPool, bandCount, 1, [this](Size begin, Size end) {
+        for (Size band = begin; band < end; ++band) {
+            const U32 firstRow = static_cast<U32>(band) * kBandRows;
+            const U32 rowCount = std::min(kBandRows, m_height - firstRow);
+            RasterizeBand(firstRow, rowCount);
+            UpdateTiles(firstRow, rowCount);
+        }
+    });
+}
+
+void JzOcclusionCuller::SetupTriangles()
+{
+    m_triangles.clear();
+
+    const F32          width  = static_cast<F32>(m_width);
+    const F32          height = static_cast<F32>(m_height);
+    std::vector<JzVec4> clip;
+    for (const auto &occluder : m_occluders) {
+        const JzMat4 worldViewProjection = m_viewProjection * occluder.worldMatrix;
+
+        clip.resize(occluder.vertices->size());
+        for (Size i = 0; i < clip.size(); ++i) {
+            clip[i] = TransformPoint(worldViewProjection, (*occluder.vertices)[i].Position);
+        }
+
+        const auto &indices = *occluder.indices;
+        for (Size i = 0; i + 2 < indices.size(); i += 3) {
+            JzScreenTriangle triangle;
+            Bool             crossesNear = false;
+            for (U32 corner = 0; corner < 3; ++corner) {
+                const U32 index = indices[i + corner];
+                if (index >= clip.size() || clip[index].w < kMinClipW) {
+                    crossesNear = true;
+                    break;
+                }
+                const JzVec4 &position = clip[index];
+                const F32     invW     = 1.0f / position.w;
+                triangle.x[corner]     = (position.x * invW * 0.5f + 0.5f) * width;
+                triangle.y[corner]     = (position.y * invW * 0.5f + 0.5f) * height;
+                triangle.z[corner]     = position.z * invW;
+            }
+            if (crossesNear) {
+                continue;
+            }
+
+            const F32 minX = std::min({triangle.x[0], triangle.x[1], triangle.x[2]});
+            const F32 maxX = std::max({triangle.x[0], triangle.x[1], triangle.x[2]});
+            const F32 minY = std::min({triangle.y[0], triangle.y[1], triangle.y[2]});
+            const F32 maxY = std::max({triangle.y[0], triangle.y[1], triangle.y[2]});
+            if (maxX < 0.0f || minX > width || maxY < 0.0f || minY > height) {
+                continue;
+            }
+
+            const F32 area = (triangle.x[1] - triangle.x[0]) * (triangle.y[2] - triangle.y[0]) -
+                             (triangle.x[2] - triangle.x[0]) * (triangle.y[1] - triangle.y[0]);
+            if (std::abs(area) < kMinTriangleArea) {
+                continue;
+            }
+
+            // Both windings are kept; the nearest depth wins either way
+            if (area < 0.0f) {
+                std::swap(triangle.x[1], triangle.x[2]);
+                std::swap(triangle.y[1], triangle.y[2]);
+                std::swap(triangle.z[1], triangle.z[2]);
+            }
+
+            triangle.minY = std::max(static_cast<I32>(std::floor(minY)), 0);
+            triangle.maxY = std::min(static_cast<I32>(std::ceil(maxY)), static_cast<I32>(m_height) - 1);
+            m_triangles.push_back(triangle);
+        }
+    }
+}
+
+void JzOcclusionCuller::RasterizeBand(U32 firstRow, U32 rowCount)
+{
+    const I32 lastRow = static_cast<I32>(firstRow + rowCount) - 1;
+    for (const auto &triangle : m_triangles) {
+        if (triangle.maxY < static_cast<I32>(firstRow) || triangle.minY > lastRow) {
+            continue;
+        }
+        RasterizeTriangle(triangle, static_cast<I32>(firstRow), lastRow);
+    }
+}
+
+void JzOcclusionCuller::RasterizeTriangle(const JzScreenTriangle &t, I32 firstRow, I32 lastRow)
+{
+    // Edge i runs from vertex i to vertex i + 1; the triangle is counter-clockwise, so inside is E >= 0.
+    // Pixels on a shared edge go to both triangles, which only matters for coverage, not for the nearest depth
+    F32 edgeA[3];
+    F32 edgeB[3];
+    F32 edgeC[3];
+    for (U32 i = 0; i < 3; ++i) {
+        const U32 next = (i + 1) % 3;
+        edgeA[i]       = t.y[i] - t.y[next];
+        edgeB[i]       = t.x[next] - t.x[i];
+        edgeC[i]       = -(edgeA[i] * t.x[i] + edgeB[i] * t.y[i]);
+    }
+
+    // NDC depth is affine in screen space
+    const F32 area = (t.x[1] - t.x[0]) * (t.y[2] - t.y[0]) - (t.x[2] - t.x[0]) * (t.y[1] - t.y[0]);
+    const F32 dzdx = ((t.z[1] - t.z[0]) * (t.y[2] - t.y[0]) - (t.z[2] - t.z[0]) * (t.y[1] - t.y[0])) / area;
+    const F32 dzdy = ((t.z[2] - t.z[0]) * (t.x[1] - t.x[0]) - (t.z[1] - t.z[0]) * (t.x[2] - t.x[0])) / area;
+    const F32 dzc  = t.z[0] - dzdx * t.x[0] - dzdy * t.y[0];
+
+    const F32 minX  = std::min({t.x[0], t.x[1], t.x[2]});
+    const F32 maxX  = std::max({t.x[0], t.x[1], t.x[2]});
+    const I32 startX = std::max(static_cast<I32>(std::floor(minX)), 0) & ~3;
+    const I32 endX   = std::min(static_cast<I32>(std::ceil(maxX)), static_cast<I32>(m_width) - 1);
+
+    const JzF32x4 zero        = JzF32x4::Splat(0.0f);
+    const JzF32x4 laneCenters = JzF32x4::Set(0.5f, 1.5f, 2.5f, 3.5f);
+    const JzF32x4 a0          = JzF32x4::Splat(edgeA[0]);
+    const JzF32x4 a1          = JzF32x4::Splat(edgeA[1]);
+    const JzF32x4 a2          = JzF32x4::Splat(edgeA[2]);
+    const JzF32x4 zx          = JzF32x4::Splat(dzdx);
+
+    const I32 rowBegin = std::max(firstRow, t.minY);
+    const I32 rowEnd   = std::min(lastRow, t.maxY);
+    for (I32 y = rowBegin; y <= rowEnd; ++y) {
+        const F32     py   = static_cast<F32>(y) + 0.5f;
+        const JzF32x4 row0 = JzF32x4::Splat(edgeB[0] * py + edgeC[0]);
+        const JzF32x4 row1 = JzF32x4::Splat(edgeB[1] * py + edgeC[1]);
+        const JzF32x4 row2 = JzF32x4::Splat(edgeB[2] * py + edgeC[2]);
+        const JzF32x4 rowZ = JzF32x4::Splat(dzdy * py + dzc);
+        F32          *line = m_depth.data() + static_cast<Size>(y) * m_width;
+
+        for (I32 x = startX; x <= endX; x += 4) {
+            const JzF32x4 px     = JzF32x4::Splat(static_cast<F32>(x)) + laneCenters;
+            const JzF32x4 inside = And(And(LessEqual(zero, a0 * px + row0), LessEqual(zero, a1 * px + row1)),
+                                       LessEqual(zero, a2 * px + row2));
+            if (inside.MoveMask() == 0) {
+                continue;
+            }
+            const JzF32x4 depth = JzF32x4::Load(line + x);
+            const JzF32x4 z     = zx * px + rowZ;
+            Select(inside, Min(depth, z), depth).Store(line + x);
+        }
+    }
+}
+
+void JzOcclusionCuller::UpdateTiles(U32 firstRow, U32 rowCount)
+{
+    for (U32 tileY = firstRow / TileSize; tileY < (firstRow + rowCount) / TileSize; ++tileY) {
+        for (U32 tileX = 0; tileX < m_tilesPerRow; ++tileX) {
+            JzF32x4 farthest = JzF32x4::Splat(-kEmptyDepth);
+            for (U32 row = 0; row < TileSize; ++row) {
+                const F32 *line = m_depth.data() + static_cast<Size>(tileY * TileSize + row) * m_width + tileX * TileSize;
+                farthest        = Max(farthest, Max(JzF32x4::Load(line), JzF32x4::Load(line + 4)));
+            }
+            F32 lanes[4];
+            farthest.Store(lanes);
+            m_tileMaxDepth[static_cast<Size>(tileY) * m_tilesPerRow + tileX] =
+                std::max({lanes[0], lanes[1], lanes[2], lanes[3]});
+        }
+    }
+}
+
+Bool JzOcclusionCuller::IsOccluded(const JzVec3 &center, F32 radius) const
+{
+    if (m_triangles.empty()) {
+        return false;
+    }
+
+    // Screen rectangle and nearest depth of the sphere's bounding box
+    F32 minX = kEmptyDepth, minY = kEmptyDepth, minZ = kEmptyDepth;
+    F32 maxX = -kEmptyDepth, maxY = -kEmptyDepth;
+    for (U32 corner = 0; corner < 8; ++corner) {
+        const JzVec3 offset((corner & 1) ? radius : -radius, (corner & 2) ? radius : -radius,
+                            (corner & 4) ? radius : -radius);
+        const JzVec4 clip = TransformPoint(m_viewProjection, center + offset);
+        if (clip.w < kMinClipW) {
+            return false;
+        }
+        const F32 invW = 1.0f / clip.w;
+        minX           = std::min(minX, clip.x * invW);
+        maxX           = std::max(maxX, clip.x * invW);
+        minY           = std::min(minY, clip.y * invW);
+        maxY           = std::max(maxY, clip.y * invW);
+        minZ           = std::min(minZ, clip.z * invW);
+    }
+
+    const F32 width  = static_cast<F32>(m_width);
+    const F32 height = static_cast<F32>(m_height);
+    const F32 left   = (minX * 0.5f + 0.5f) * width;
+    const F32 right  = (maxX * 0.5f + 0.5f) * width;
+    const F32 bottom = (minY * 0.5f + 0.5f) * height;
+    const F32 top    = (maxY * 0.5f + 0.5f) * height;
+    if (right < 0.0f || left >= width || top < 0.0f || bottom >= height) {
+        return false;
+    }
+
+    const I32 x0 = std::max(static_cast<I32>(std::floor(left)), 0);
+    const I32 x1 = std::min(static_cast<I32>(std::floor(right)), static_cast<I32>(m_width) - 1);
+    const I32 y0 = std::max(static_cast<I32>(std::floor(bottom)), 0);
+    const I32 y1 = std::min(static_cast<I32>(std::floor(top)), static_cast<I32>(m_height) - 1);
+
+    const JzF32x4 sphereDepth = JzF32x4::Splat(minZ);
+    const JzF32x4 lanes       = JzF32x4::Set(0.0f, 1.0f, 2.0f, 3.0f);
+    const I32     tileSize    = static_cast<I32>(TileSize);
+
+    for (I32 tileY = y0 / tileSize; tileY <= y1 / tileSize; ++tileY) {
+        for (I32 tileX = x0 / tileSize; tileX <= x1 / tileSize; ++tileX) {
+            // The whole tile is nearer than the sphere
+            if (m_tileMaxDepth[static_cast<Size>(tileY) * m_tilesPerRow + tileX] < minZ) {
+                continue;
+            }
+
+            const I32     cx0     = std::max(x0, tileX * tileSize);
+            const I32     cx1     = std::min(x1, tileX * tileSize + tileSize - 1);
+            const I32     cy0     = std::max(y0, tileY * tileSize);
+            const I32     cy1     = std::min(y1, tileY * tileSize + tileSize - 1);
+            const JzF32x4 columnLo = JzF32x4::Splat(static_cast<F32>(cx0));
+            const JzF32x4 columnHi = JzF32x4::Splat(static_cast<F32>(cx1));
+            for (I32 y = cy0; y <= cy1; ++y) {
+                const F32 *line = m_depth.data() + static_cast<Size>(y) * m_width;
+                for (I32 x = cx0 & ~3; x <= cx1; x += 4) {
+                    const JzF32x4 column  = JzF32x4::Splat(static_cast<F32>(x)) + lanes;
+                    const JzF32x4 inRect  = And(LessEqual(columnLo, column), LessEqual(column, columnHi));
+                    const JzF32x4 visible = And(inRect, LessEqual(sphereDepth, JzF32x4::Load(line + x)));
+                    if (visible.MoveMask() != 0) {
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+void JzOcclusionCuller::TestSpheres(const std::vector<JzVec4> &spheres, std::vector<U8> &occluded)
+{
+    JzRE_PROFILE_SCOPE("OcclusionCuller_Test");
+
+    occluded.assign(spheres.size(), 0);
+
+    std::atomic<U32> occludedCount{0};
+    RunParallel(m_threadPool, spheres.size(), kSphereGrain, [&](Size begin, Size end) {
+        U32 count = 0;
+        for (Size i = begin; i < end; ++i) {
+            const auto &sphere = spheres[i];
+            if (IsOccluded(JzVec3(sphere.x, sphere.y, sphere.z), sphere.w)) {
+                occluded[i] = 1;
+                ++count;
+            }
+        }
+        occludedCount.fetch_add(count, std::memory_order_relaxed);
+    });
+
+    m_stats.tested += static_cast<U32>(spheres.size());
+    m_stats.occluded += occludedCount.load(std::memory_order_relaxed);
+}
+
+} // namespace JzRE
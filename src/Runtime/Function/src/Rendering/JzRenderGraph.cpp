@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <fstream>
 
+#include "JzRE/Runtime/Core/JzProfiler.h"
 #include "JzRE/Runtime/Platform/RHI/JzDevice.h"
 
 namespace JzRE {
@@ -38,6 +39,8 @@ JzRGBuffer JzRenderGraph::CreateBuffer(const JzRGBufferDesc &desc)
 
 void JzRenderGraph::Compile()
 {
+    JzRE_PROFILE_SCOPE("RenderGraph::Compile");
+
     m_executionOrder.clear();
     m_hasCycle = false;
 
@@ -130,11 +133,16 @@ void JzRenderGraph::Compile()
     }
 
     BuildTransitions(order);
+    BuildAttachmentOps(order);
     AllocateResources();
 }
 
 void JzRenderGraph::Execute(JzDevice &device)
 {
+    JzRE_PROFILE_SCOPE("RenderGraph::Execute");
+
+    const Bool profiling = JzProfiler::GetInstance().IsEnabled();
+
     std::vector<size_t> order;
     if (m_executionOrder.empty()) {
         order.resize(m_passes.size());
@@ -145,20 +153,62 @@ void JzRenderGraph::Execute(JzDevice &device)
         order = m_executionOrder;
     }
 
+    // An attachment no executed pass has touched yet is cleared instead of loaded
+    // when its pass only writes it, so skipped passes still leave a valid first writer
+    std::vector<Bool> touchedTextures(m_textures.size() + 1, false);
+    const auto        resolveLoadOp = [&touchedTextures](const JzRGPassData &pass, JzRGTexture target) {
+        if (target.id == 0 || target.id >= touchedTextures.size() || touchedTextures[target.id]) {
+            return JzERHILoadOp::Load;
+        }
+
+        Bool writes = false;
+        for (const auto &usage : pass.usages) {
+            if (usage.type != JzRGResourceType::Texture || usage.id != target.id) {
+                continue;
+            }
+            if (usage.usage != JzRGUsage::Write) {
+                return JzERHILoadOp::Load;
+            }
+            writes = true;
+        }
+        return writes ? JzERHILoadOp::Clear : JzERHILoadOp::Load;
+    };
+    const auto markTouched = [&touchedTextures](U32 id) {
+        if (id != 0 && id < touchedTextures.size()) {
+            touchedTextures[id] = true;
+        }
+    };
+
     for (size_t index : order) {
         auto &pass = m_passes[index];
         if (pass.desc.enabledExecute && !pass.desc.enabledExecute()) {
             continue;
         }
 
+        pass.attachmentOps.colorLoad = resolveLoadOp(pass, pass.colorTarget);
+        pass.attachmentOps.depthLoad = resolveLoadOp(pass, pass.depthTarget);
+        for (const auto &usage : pass.usages) {
+            if (usage.type == JzRGResourceType::Texture) {
+                markTouched(usage.id);
+            }
+        }
+        markTouched(pass.colorTarget.id);
+        markTouched(pass.depthTarget.id);
+
         m_builder.SetActivePassIndex(index);
 
+        JzRE_PROFILE_SCOPE(pass.desc.name);
+
         auto commandList = device.CreateCommandList("RenderGraph_" + pass.desc.name);
         if (!commandList) {
             continue;
         }
         commandList->Begin();
 
+        if (profiling) {
+            commandList->BeginGpuZone(pass.desc.name);
+        }
+
         if (m_transitionCallback && !pass.transitions.empty()) {
             m_transitionCallback(*commandList, pass.desc, pass.transitions);
         }
@@ -169,7 +219,7 @@ void JzRenderGraph::Execute(JzDevice &device)
             auto framebuffer  = ResolveFramebuffer(device, pass, colorTexture, depthTexture);
 
             if (pass.colorTarget.id != 0 || pass.depthTarget.id != 0 || framebuffer) {
-                commandList->BindFramebuffer(framebuffer);
+                commandList->BindFramebuffer(framebuffer, pass.attachmentOps);
             }
 
             if (pass.viewport.x > 0 && pass.viewport.y > 0) {
@@ -190,10 +240,19 @@ void JzRenderGraph::Execute(JzDevice &device)
                 pass.depthTarget,
                 framebuffer,
                 colorTexture,
-                depthTexture};
+                depthTexture,
+                pass.attachmentOps};
             pass.desc.execute(context);
         }
 
+        if (m_transitionCallback && !pass.endTransitions.empty()) {
+            m_transitionCallback(*commandList, pass.desc, pass.endTransitions);
+        }
+
+        if (profiling) {
+            commandList->EndGpuZone();
+        }
+
         commandList->End();
         device.ExecuteCommandList(commandList);
     }
@@ -267,7 +326,16 @@ void JzRenderGraph::DumpGraph(const String &path) const
         out << "- " << pass.desc.name << "\n";
         for (const auto &t : pass.transitions) {
             out << "  - " << (t.type == JzRGResourceType::Texture ? "Texture" : "Buffer")
-                << " #" << t.id << "\n";
+                << " #" << t.id << " usage " << static_cast<U32>(t.beforeUsage) << " -> "
+                << static_cast<U32>(t.afterUsage);
+            if (t.split == JzERHIBarrierSplit::End) {
+                out << " (split #" << t.splitId << " end)";
+            }
+            out << "\n";
+        }
+        for (const auto &t : pass.endTransitions) {
+            out << "  - " << (t.type == JzRGResourceType::Texture ? "Texture" : "Buffer")
+                << " #" << t.id << " (split #" << t.splitId << " begin, after pass)\n";
         }
     }
 }
@@ -425,6 +493,28 @@ JzRGTexture JzRenderGraph::JzRGBuilderImpl::Write(JzRGTexture tex, JzRGUsage usa
     return tex;
 }
 
+JzRGBuffer JzRenderGraph::JzRGBuilderImpl::Read(JzRGBuffer buffer, JzRGUsage usage)
+{
+    if (m_activePass >= m_graph.m_passes.size()) {
+        return buffer;
+    }
+
+    m_graph.m_passes[m_activePass].usages.push_back(
+        {JzRGResourceType::Buffer, buffer.id, usage});
+    return buffer;
+}
+
+JzRGBuffer JzRenderGraph::JzRGBuilderImpl::Write(JzRGBuffer buffer, JzRGUsage usage)
+{
+    if (m_activePass >= m_graph.m_passes.size()) {
+        return buffer;
+    }
+
+    m_graph.m_passes[m_activePass].usages.push_back(
+        {JzRGResourceType::Buffer, buffer.id, usage});
+    return buffer;
+}
+
 void JzRenderGraph::JzRGBuilderImpl::SetRenderTarget(JzRGTexture color, JzRGTexture depth)
 {
     if (m_activePass >= m_graph.m_passes.size()) {
@@ -447,39 +537,156 @@ void JzRenderGraph::JzRGBuilderImpl::SetViewport(JzIVec2 size)
 
 void JzRenderGraph::BuildTransitions(const std::vector<size_t> &order)
 {
-    std::unordered_map<U32, JzRGUsage> lastTextureUsage;
-    std::unordered_map<U32, JzRGUsage> lastBufferUsage;
-
-    for (size_t passIndex : order) {
-        auto &pass = m_passes[passIndex];
+    struct JzRGLastAccess {
+        JzRGUsage           usage;
+        JzERHIResourceUsage access;
+        JzERHIPassType      passType;
+        size_t              passIndex;
+        size_t              position;
+    };
+
+    std::unordered_map<U32, JzRGLastAccess> lastTextureAccess;
+    std::unordered_map<U32, JzRGLastAccess> lastBufferAccess;
+    U32                                     nextSplitId = 1;
+
+    for (auto &pass : m_passes) {
         pass.transitions.clear();
+        pass.endTransitions.clear();
+    }
+
+    for (size_t position = 0; position < order.size(); ++position) {
+        const size_t passIndex = order[position];
+        auto        &pass      = m_passes[passIndex];
 
         for (const auto &usage : pass.usages) {
             if (usage.id == 0) {
                 continue;
             }
 
-            if (usage.type == JzRGResourceType::Texture) {
-                const auto      last   = lastTextureUsage.find(usage.id);
-                const JzRGUsage before = last != lastTextureUsage.end() ? last->second : usage.usage;
-                if (before != usage.usage) {
-                    pass.transitions.push_back(
-                        {JzRGResourceType::Texture, usage.id, before, usage.usage});
-                }
-                lastTextureUsage[usage.id] = usage.usage;
-            } else {
-                const auto      last   = lastBufferUsage.find(usage.id);
-                const JzRGUsage before = last != lastBufferUsage.end() ? last->second : usage.usage;
-                if (before != usage.usage) {
-                    pass.transitions.push_back(
-                        {JzRGResourceType::Buffer, usage.id, before, usage.usage});
+            auto &lastAccess = usage.type == JzRGResourceType::Texture ? lastTextureAccess : lastBufferAccess;
+            const JzRGLastAccess current{usage.usage, ResolveUsage(pass, usage), pass.desc.type, passIndex, position};
+
+            const auto last = lastAccess.find(usage.id);
+            if (last == lastAccess.end()) {
+                lastAccess.emplace(usage.id, current);
+                continue;
+            }
+
+            // A pass declaring the same resource twice keeps its writing usage
+            const auto previous = last->second;
+            if (previous.position == position) {
+                if (usage.usage != JzRGUsage::Read) {
+                    last->second = current;
                 }
-                lastBufferUsage[usage.id] = usage.usage;
+                continue;
+            }
+            last->second = current;
+
+            // Read after read in the same way needs no barrier; every hazard with a write does
+            const Bool sameReadOnlyAccess = previous.usage == JzRGUsage::Read && usage.usage == JzRGUsage::Read &&
+                                            previous.access == current.access &&
+                                            previous.passType == current.passType;
+            if (sameReadOnlyAccess) {
+                continue;
+            }
+
+            JzRGTransition transition;
+            transition.type        = usage.type;
+            transition.id          = usage.id;
+            transition.before      = previous.usage;
+            transition.after       = usage.usage;
+            transition.beforeUsage = previous.access;
+            transition.afterUsage  = current.access;
+            transition.beforePass  = previous.passType;
+            transition.afterPass   = current.passType;
+
+            // Passes in between give the transition room to overlap with their work
+            if (position - previous.position > 1) {
+                transition.split   = JzERHIBarrierSplit::Begin;
+                transition.splitId = nextSplitId++;
+                m_passes[previous.passIndex].endTransitions.push_back(transition);
+                transition.split = JzERHIBarrierSplit::End;
             }
+
+            pass.transitions.push_back(transition);
         }
     }
 }
 
+void JzRenderGraph::BuildAttachmentOps(const std::vector<size_t> &order)
+{
+    // Last position in the execution order that accesses each texture
+    std::unordered_map<U32, size_t> lastTextureAccess;
+    for (size_t position = 0; position < order.size(); ++position) {
+        const auto &pass = m_passes[order[position]];
+        for (const auto &usage : pass.usages) {
+            if (usage.type == JzRGResourceType::Texture && usage.id != 0) {
+                lastTextureAccess[usage.id] = position;
+            }
+        }
+        for (const auto target : {pass.colorTarget, pass.depthTarget}) {
+            if (target.id != 0) {
+                lastTextureAccess[target.id] = position;
+            }
+        }
+    }
+
+    // A transient attachment nothing reads afterwards never needs to reach memory
+    const auto resolveStoreOp = [this, &lastTextureAccess](JzRGTexture target, size_t position) {
+        if (target.id == 0 || target.id > m_textures.size() || !m_textures[target.id - 1].transient) {
+            return JzERHIStoreOp::Store;
+        }
+        return lastTextureAccess[target.id] > position ? JzERHIStoreOp::Store : JzERHIStoreOp::DontCare;
+    };
+
+    for (size_t position = 0; position < order.size(); ++position) {
+        auto &pass                    = m_passes[order[position]];
+        pass.attachmentOps            = JzRHIAttachmentOps{};
+        pass.attachmentOps.colorStore = resolveStoreOp(pass.colorTarget, position);
+        pass.attachmentOps.depthStore = resolveStoreOp(pass.depthTarget, position);
+    }
+}
+
+JzERHIResourceUsage JzRenderGraph::ResolveUsage(const JzRGPassData &pass, const JzRGResourceUsage &usage) const
+{
+    const Bool reads = usage.usage == JzRGUsage::Read;
+
+    if (pass.desc.type == JzERHIPassType::Transfer) {
+        return reads ? JzERHIResourceUsage::TransferSrc : JzERHIResourceUsage::TransferDst;
+    }
+
+    if (usage.type == JzRGResourceType::Texture) {
+        if (pass.colorTarget.id == usage.id) {
+            return JzERHIResourceUsage::ColorAttachment;
+        }
+        if (pass.depthTarget.id == usage.id) {
+            return reads ? JzERHIResourceUsage::DepthStencilRead : JzERHIResourceUsage::DepthStencilWrite;
+        }
+        return reads ? JzERHIResourceUsage::ShaderRead : JzERHIResourceUsage::ShaderWrite;
+    }
+
+    if (!reads) {
+        return JzERHIResourceUsage::ShaderWrite;
+    }
+    if (pass.desc.type == JzERHIPassType::Compute || usage.id > m_buffers.size()) {
+        return JzERHIResourceUsage::ShaderRead;
+    }
+
+    switch (m_buffers[usage.id - 1].type) {
+        case JzEGPUBufferObjectType::Vertex:
+            return JzERHIResourceUsage::VertexBuffer;
+        case JzEGPUBufferObjectType::Index:
+            return JzERHIResourceUsage::IndexBuffer;
+        case JzEGPUBufferObjectType::Uniform:
+            return JzERHIResourceUsage::UniformBuffer;
+        case JzEGPUBufferObjectType::Indirect:
+            return JzERHIResourceUsage::IndirectBuffer;
+        case JzEGPUBufferObjectType::Storage:
+            break;
+    }
+    return JzERHIResourceUsage::ShaderRead;
+}
+
 void JzRenderGraph::AllocateResources()
 {
     if (m_textureResources.size() != m_textures.size()) {
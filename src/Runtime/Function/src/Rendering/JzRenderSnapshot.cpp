@@ -0,0 +1,61 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Function/Rendering/JzRenderSnapshot.h"
+
+namespace JzRE {
+
+const JzRenderSnapshotCamera *JzRenderSnapshot::FindCamera(JzEntity preferredCamera) const
+{
+    if (IsValidEntity(preferredCamera)) {
+        for (const auto &camera : cameras) {
+            if (camera.entity == preferredCamera) {
+                return &camera;
+            }
+        }
+    }
+
+    for (const auto &camera : cameras) {
+        if (camera.isMainCamera) {
+            return &camera;
+        }
+    }
+
+    return cameras.empty() ? nullptr : &cameras.front();
+}
+
+void JzRenderSnapshot::Clear()
+{
+    frameIndex    = 0;
+    frameSize     = JzIVec2(0, 0);
+    hasWindow     = false;
+    windowVisible = false;
+    cameras.clear();
+    lights.clear();
+    draws.clear();
+    targets.clear();
+    contributions.clear();
+}
+
+JzRenderSnapshot &JzRenderSnapshotBuffer::BeginWrite()
+{
+    auto &snapshot = m_snapshots[m_publishedIndex ^ 1u];
+    snapshot.Clear();
+    snapshot.frameIndex = m_nextFrameIndex;
+    return snapshot;
+}
+
+void JzRenderSnapshotBuffer::Publish()
+{
+    m_publishedIndex ^= 1u;
+    m_nextFrameIndex++;
+}
+
+const JzRenderSnapshot &JzRenderSnapshotBuffer::GetPublished() const
+{
+    return m_snapshots[m_publishedIndex];
+}
+
+} // namespace JzRE
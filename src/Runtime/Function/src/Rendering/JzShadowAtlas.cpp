@@ -0,0 +1,581 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Function/Rendering/JzShadowAtlas.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+#include "JzRE/Runtime/Core/JzLogger.h"
+#include "JzRE/Runtime/Core/JzProfiler.h"
+#include "JzRE/Runtime/Platform/Command/JzRHICommandList.h"
+#include "JzRE/Runtime/Platform/RHI/JzDevice.h"
+#include "JzRE/Runtime/Platform/RHI/JzRHIPipeline.h"
+
+namespace JzRE {
+
+namespace {
+
+constexpr U32 kMinViewCapacity  = 16;
+constexpr F32 kDegreesToRadians = 3.14159265358979f / 180.0f;
+constexpr F32 kMaxSpotFov       = 170.0f * kDegreesToRadians;
+constexpr F32 kAgingPerFrame    = 1.0f / 16.0f; ///< Priority a waiting tile gains per frame
+
+U64 HashCombine(U64 seed, U64 value)
+{
+    return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6U) + (seed >> 2U));
+}
+
+U64 HashMatrix(U64 seed, const JzMat4 &matrix)
+{
+    for (U32 i = 0; i < 16; ++i) {
+        seed = HashCombine(seed, std::bit_cast<U32>(matrix.Data()[i]));
+    }
+    return seed;
+}
+
+/**
+ * @brief Stable identity of a light, from its entity when it has one.
+ */
+U64 LightKey(const JzLightData &light, U32 lightIndex)
+{
+    if (IsValidEntity(light.entity)) {
+        return static_cast<U64>(ToEntityId(light.entity)) << 8;
+    }
+    return ((1ULL << 40) | lightIndex) << 8;
+}
+
+/**
+ * @brief Positive view-space distance at an NDC depth, for perspective and orthographic projections.
+ */
+F32 ViewDepthAtNdc(const JzMat4 &projection, F32 ndcZ)
+{
+    const F32 denominator = ndcZ * projection.m32 - projection.m22;
+    if (std::abs(denominator) < 1e-12f) {
+        return std::numeric_limits<F32>::quiet_NaN();
+    }
+    return -(projection.m23 - ndcZ * projection.m33) / denominator;
+}
+
+/**
+ * @brief Rotation-only view matrix looking along a direction.
+ */
+JzMat4 LookAlong(const JzVec3 &forward)
+{
+    const JzVec3 back  = -forward;
+    const JzVec3 up    = std::abs(forward.y) > 0.99f ? JzVec3(1.0f, 0.0f, 0.0f) : JzVec3(0.0f, 1.0f, 0.0f);
+    const JzVec3 right = up.Cross(back).Normalized();
+    const JzVec3 upAxis = back.Cross(right);
+    return JzMat4(right.x, right.y, right.z, 0.0f,
+                  upAxis.x, upAxis.y, upAxis.z, 0.0f,
+                  back.x, back.y, back.z, 0.0f,
+                  0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+JzVec3 Transform(const JzMat4 &matrix, const JzVec3 &point)
+{
+    const JzVec4 result = matrix * JzVec4(point.x, point.y, point.z, 1.0f);
+    return JzVec3(result.x, result.y, result.z);
+}
+
+/**
+ * @brief Estimated fraction of the screen covered by a world-space sphere.
+ */
+F32 ScreenCoverage(const JzVec3 &center, F32 radius, const JzMat4 &viewMatrix, const JzMat4 &projectionMatrix)
+{
+    const JzVec3 viewCenter = Transform(viewMatrix, center);
+    if (viewCenter.LengthSquared() <= radius * radius) {
+        return 1.0f;
+    }
+
+    const JzMat4 &p = projectionMatrix;
+    const F32     w = p.m32 * viewCenter.z + p.m33;
+    if (std::abs(p.m32) > 0.0f && -viewCenter.z + radius <= 0.0f) {
+        return 0.0f;
+    }
+
+    const F32 safeW   = std::max(w, 1e-4f);
+    const F32 ndcX    = (p.m00 * viewCenter.x + p.m02 * viewCenter.z + p.m03) / safeW;
+    const F32 ndcY    = (p.m11 * viewCenter.y + p.m12 * viewCenter.z + p.m13) / safeW;
+    const F32 radiusX = radius * std::abs(p.m00) / safeW;
+    const F32 radiusY = radius * std::abs(p.m11) / safeW;
+    const F32 overlapX = std::max(0.0f, std::min(1.0f, ndcX + radiusX) - std::max(-1.0f, ndcX - radiusX));
+    const F32 overlapY = std::max(0.0f, std::min(1.0f, ndcY + radiusY) - std::max(-1.0f, ndcY - radiusY));
+
+    // The screen spans 2x2 in NDC; the sphere covers about pi/4 of its box
+    return std::min(1.0f, overlapX * overlapY * 0.25f * 0.785398f);
+}
+
+std::shared_ptr<JzGPUTextureObject> EnsureTexture(JzDevice &device, std::shared_ptr<JzGPUTextureObject> texture,
+                                                  JzETextureResourceFormat format, U32 width, U32 height,
+                                                  const void *data, const String &debugName)
+{
+    if (texture && texture->GetWidth() == width && texture->GetHeight() == height) {
+        if (data) {
+            texture->UpdateData(data);
+        }
+        return texture;
+    }
+
+    JzGPUTextureObjectDesc desc;
+    desc.type      = JzETextureResourceType::Texture2D;
+    desc.format    = format;
+    desc.width     = width;
+    desc.height    = height;
+    desc.minFilter = JzETextureResourceFilter::Nearest;
+    desc.magFilter = JzETextureResourceFilter::Nearest;
+    desc.wrapS     = JzETextureResourceWrap::ClampToEdge;
+    desc.wrapT     = JzETextureResourceWrap::ClampToEdge;
+    desc.data      = data;
+    desc.debugName = debugName;
+    return device.CreateTexture(desc);
+}
+
+} // namespace
+
+JzShadowAtlas::JzShadowAtlas(JzShadowAtlasSettings settings)
+{
+    SetSettings(settings);
+}
+
+void JzShadowAtlas::SetSettings(const JzShadowAtlasSettings &settings)
+{
+    const Bool layoutChanged = settings.atlasSize != m_settings.atlasSize || settings.tileSize != m_settings.tileSize ||
+                               m_freeTiles.size() + m_tileStates.size() == 0;
+
+    m_settings              = settings;
+    m_settings.tileSize     = std::clamp(m_settings.tileSize, 16u, std::max(m_settings.atlasSize, 16u));
+    m_settings.atlasSize    = std::max(m_settings.atlasSize, m_settings.tileSize);
+    m_settings.cascadeCount = std::clamp(m_settings.cascadeCount, 1u, 8u);
+
+    if (layoutChanged) {
+        Reset();
+    }
+}
+
+void JzShadowAtlas::Plan(const std::vector<JzLightData> &lights, const std::vector<JzRenderSnapshotDraw> &draws,
+                         const JzMat4 &viewMatrix, const JzMat4 &projectionMatrix)
+{
+    JzRE_PROFILE_SCOPE("ShadowAtlas_Plan");
+
+    m_views.clear();
+    m_refreshViews.clear();
+    m_lightRanges.assign(lights.size(), JzShadowRange{});
+
+    for (U32 lightIndex = 0; lightIndex < lights.size(); ++lightIndex) {
+        const auto &light = lights[lightIndex];
+        if (!light.castShadow) {
+            continue;
+        }
+        if (light.type == JzELightType::Directional) {
+            AddCascades(lightIndex, light, draws, viewMatrix, projectionMatrix);
+        } else if (light.type == JzELightType::Spot) {
+            AddSpotView(lightIndex, light, draws, viewMatrix, projectionMatrix);
+        }
+    }
+
+    AssignTiles();
+    SelectRefreshViews(draws);
+}
+
+void JzShadowAtlas::Upload(JzDevice &device)
+{
+    JzRE_PROFILE_SCOPE("ShadowAtlas_Upload");
+
+    if (!m_atlasTexture || !m_framebuffer) {
+        m_atlasTexture = EnsureTexture(device, nullptr, JzETextureResourceFormat::Depth24, m_settings.atlasSize,
+                                       m_settings.atlasSize, nullptr, "ShadowAtlas_Depth");
+        m_framebuffer  = device.CreateFramebuffer("ShadowAtlas_FB");
+        if (!m_atlasTexture || !m_framebuffer) {
+            Reset();
+            return;
+        }
+        m_framebuffer->AttachDepthTexture(m_atlasTexture);
+    }
+
+    const U32 viewCapacity = std::max(kMinViewCapacity, std::bit_ceil(static_cast<U32>(m_views.size())));
+    m_viewTexels.assign(static_cast<Size>(viewCapacity) * TexelsPerView * 4, 0.0f);
+
+    for (Size index = 0; index < m_views.size(); ++index) {
+        const auto   &view   = m_views[index];
+        const auto   &state  = m_tileStates.at(view.key);
+        const JzIVec2 origin = GetTileOrigin(view.tile);
+        F32          *texels = &m_viewTexels[index * TexelsPerView * 4];
+
+        // Rows of the matrix the tile was drawn with, so a tile waiting for its refresh stays consistent
+        std::copy_n(state.atlasMatrix.Data(), 16, texels);
+        const F32 params[] = {
+            view.splitDepth, state.texelSize, view.splitDepth == 0.0f ? 1.0f : 0.0f,
+            state.valid ? 1.0f : 0.0f,
+            static_cast<F32>(origin.x), static_cast<F32>(origin.y),
+            static_cast<F32>(origin.x + static_cast<I32>(m_settings.tileSize)),
+            static_cast<F32>(origin.y + static_cast<I32>(m_settings.tileSize))};
+        std::copy(std::begin(params), std::end(params), texels + 16);
+    }
+
+    m_viewTexture = EnsureTexture(device, std::move(m_viewTexture), JzETextureResourceFormat::RGBA32F, TexelsPerView,
+                                  viewCapacity, m_viewTexels.data(), "ShadowAtlas_Views");
+}
+
+void JzShadowAtlas::Bind(JzRHICommandList &commandList, JzRHIPipeline &pipeline) const
+{
+    const Bool enabled = !m_views.empty() && m_atlasTexture && m_viewTexture;
+    pipeline.SetUniform("shadowsEnabled", enabled ? 1.0f : 0.0f);
+    if (!enabled) {
+        return;
+    }
+
+    commandList.BindTexture(m_atlasTexture, AtlasSlot);
+    commandList.BindTexture(m_viewTexture, ShadowDataSlot);
+
+    pipeline.SetUniform("shadowAtlas", static_cast<I32>(AtlasSlot));
+    pipeline.SetUniform("shadowViews", static_cast<I32>(ShadowDataSlot));
+    pipeline.SetUniform("SPIRV_Cross_CombinedshadowAtlasSPIRV_Cross_DummySampler", static_cast<I32>(AtlasSlot));
+    pipeline.SetUniform("SPIRV_Cross_CombinedshadowViewsSPIRV_Cross_DummySampler", static_cast<I32>(ShadowDataSlot));
+}
+
+void JzShadowAtlas::Reset()
+{
+    m_atlasTexture.reset();
+    m_framebuffer.reset();
+    m_viewTexture.reset();
+
+    m_views.clear();
+    m_refreshViews.clear();
+    m_lightRanges.clear();
+    m_tileStates.clear();
+
+    m_tilesPerRow = std::max(1u, m_settings.atlasSize / m_settings.tileSize);
+    m_freeTiles.clear();
+    for (U32 tile = GetTileCount(); tile > 0; --tile) {
+        m_freeTiles.push_back(tile - 1);
+    }
+}
+
+JzShadowRange JzShadowAtlas::GetLightShadow(U32 lightIndex) const
+{
+    return lightIndex < m_lightRanges.size() ? m_lightRanges[lightIndex] : JzShadowRange{};
+}
+
+JzIVec2 JzShadowAtlas::GetTileOrigin(U32 tile) const
+{
+    return JzIVec2(static_cast<I32>((tile % m_tilesPerRow) * m_settings.tileSize),
+                   static_cast<I32>((tile / m_tilesPerRow) * m_settings.tileSize));
+}
+
+void JzShadowAtlas::AddCascades(U32 lightIndex, const JzLightData &light,
+                                const std::vector<JzRenderSnapshotDraw> &draws, const JzMat4 &viewMatrix,
+                                const JzMat4 &projectionMatrix)
+{
+    const JzMat4 &p         = projectionMatrix;
+    const F32     nearPlane = std::max(ViewDepthAtNdc(p, -1.0f), 1e-3f);
+    const F32     farPlane  = std::min(ViewDepthAtNdc(p, 1.0f), m_settings.shadowDistance);
+    if (!std::isfinite(nearPlane) || !std::isfinite(farPlane) || farPlane <= nearPlane ||
+        std::abs(p.m00) < 1e-12f || std::abs(p.m11) < 1e-12f || light.direction.LengthSquared() < 1e-12f) {
+        return;
+    }
+
+    // Practical split scheme: a blend of logarithmic and uniform splits
+    const U32  cascadeCount = m_settings.cascadeCount;
+    const auto splitDepth   = [&](U32 split) {
+        const F32 t = static_cast<F32>(split) / static_cast<F32>(cascadeCount);
+        return m_settings.cascadeSplitLambda * nearPlane * std::pow(farPlane / nearPlane, t) +
+               (1.0f - m_settings.cascadeSplitLambda) * (nearPlane + (farPlane - nearPlane) * t);
+    };
+
+    // View-space point on the ray through an NDC x/y at a view distance
+    const auto unproject = [&p](F32 ndcX, F32 ndcY, F32 depth) {
+        const F32 z = -depth;
+        const F32 w = p.m32 * z + p.m33;
+        return JzVec3((ndcX * w - p.m02 * z - p.m03) / p.m00, (ndcY * w - p.m12 * z - p.m13) / p.m11, z);
+    };
+
+    // The view matrix is rigid, so its inverse is the transposed rotation around the camera position
+    const JzMat4 &v        = viewMatrix;
+    const JzVec3  position = JzVec3(-(v.m00 * v.m03 + v.m10 * v.m13 + v.m20 * v.m23),
+                                    -(v.m01 * v.m03 + v.m11 * v.m13 + v.m21 * v.m23),
+                                    -(v.m02 * v.m03 + v.m12 * v.m13 + v.m22 * v.m23));
+    const auto    toWorld  = [&](const JzVec3 &point) {
+        return position + JzVec3(v.m00, v.m01, v.m02) * point.x + JzVec3(v.m10, v.m11, v.m12) * point.y +
+               JzVec3(v.m20, v.m21, v.m22) * point.z;
+    };
+
+    const JzMat4 lightView = LookAlong(light.direction.Normalized());
+    const U64    lightKey  = LightKey(light, lightIndex);
+
+    for (U32 cascade = 0; cascade < cascadeCount; ++cascade) {
+        const F32 nearDepth = splitDepth(cascade);
+        const F32 farDepth  = splitDepth(cascade + 1);
+
+        JzVec3 corners[8];
+        U32    cornerCount = 0;
+        for (F32 depth : {nearDepth, farDepth}) {
+            for (F32 ndcX : {-1.0f, 1.0f}) {
+                for (F32 ndcY : {-1.0f, 1.0f}) {
+                    corners[cornerCount++] = unproject(ndcX, ndcY, depth);
+                }
+            }
+        }
+
+        // Bounding sphere from the projection alone, so turning the camera keeps its size
+        F32 axisX = 0.0f;
+        F32 axisY = 0.0f;
+        for (const auto &corner : corners) {
+            axisX += corner.x * 0.125f;
+            axisY += corner.y * 0.125f;
+        }
+        F32 nearSq = 0.0f;
+        F32 farSq  = 0.0f;
+        for (U32 corner = 0; corner < 8; ++corner) {
+            const F32 dx       = corners[corner].x - axisX;
+            const F32 dy       = corners[corner].y - axisY;
+            F32      &extentSq = corner < 4 ? nearSq : farSq;
+            extentSq           = std::max(extentSq, dx * dx + dy * dy);
+        }
+        const F32 centerDepth = std::clamp((farSq - nearSq + farDepth * farDepth - nearDepth * nearDepth) /
+                                               (2.0f * (farDepth - nearDepth)),
+                                           nearDepth, farDepth);
+        F32       radius      = std::sqrt(std::max(nearSq + (centerDepth - nearDepth) * (centerDepth - nearDepth),
+                                                   farSq + (farDepth - centerDepth) * (farDepth - centerDepth)));
+        radius                = std::ceil(radius * 16.0f) / 16.0f;
+
+        // Snap the center to whole texels in light space so the cascade does not shimmer
+        const F32 texelSize   = 2.0f * radius / static_cast<F32>(m_settings.tileSize);
+        JzVec3    lightCenter = Transform(lightView, toWorld(JzVec3(axisX, axisY, -centerDepth)));
+        lightCenter.x         = std::floor(lightCenter.x / texelSize) * texelSize;
+        lightCenter.y         = std::floor(lightCenter.y / texelSize) * texelSize;
+        lightCenter.z         = std::floor(lightCenter.z / texelSize) * texelSize;
+
+        JzShadowView view;
+        view.key            = lightKey | cascade;
+        view.lightIndex     = lightIndex;
+        view.cascade        = cascade;
+        view.viewMatrix     = lightView;
+        view.splitDepth     = farDepth;
+        view.texelWorldSize = texelSize;
+        view.coverage       = 1.0f; // every cascade spans the whole screen; ties keep near cascades first
+
+        // Casters toward the light still shadow the sphere, so the near plane moves back to them
+        F32 nearDistance = -lightCenter.z - radius;
+        F32 farDistance  = -lightCenter.z + radius;
+        for (U32 drawIndex = 0; drawIndex < draws.size(); ++drawIndex) {
+            const auto &draw = draws[drawIndex];
+            if (draw.visibility != JzRenderVisibility::MainScene) {
+                continue;
+            }
+            // Draws without bounds always cast, but cannot move the near plane
+            const JzVec3 center   = Transform(lightView, draw.boundsCenter);
+            const F32    reach    = radius + draw.boundsRadius;
+            const F32    distance = -center.z;
+            if (draw.boundsRadius > 0.0f) {
+                if (std::abs(center.x - lightCenter.x) > reach || std::abs(center.y - lightCenter.y) > reach ||
+                    distance - draw.boundsRadius > farDistance) {
+                    continue;
+                }
+                nearDistance = std::min(nearDistance, distance - draw.boundsRadius);
+            }
+            view.casters.push_back(drawIndex);
+            view.staticOnly = view.staticOnly && draw.isStatic;
+        }
+
+        view.projectionMatrix = JzMat4x4::Orthographic(lightCenter.x - radius, lightCenter.x + radius,
+                                                       lightCenter.y - radius, lightCenter.y + radius,
+                                                       nearDistance, farDistance);
+        m_views.push_back(std::move(view));
+    }
+}
+
+void JzShadowAtlas::AddSpotView(U32 lightIndex, const JzLightData &light,
+                                const std::vector<JzRenderSnapshotDraw> &draws, const JzMat4 &viewMatrix,
+                                const JzMat4 &projectionMatrix)
+{
+    if (light.range <= 0.0f || light.direction.LengthSquared() < 1e-12f) {
+        return;
+    }
+
+    const JzVec3 direction = light.direction.Normalized();
+    const F32    halfAngle = std::clamp(light.outerCutoff * kDegreesToRadians, 0.01f, kMaxSpotFov * 0.5f);
+    const F32    fov       = std::min(halfAngle * 2.0f, kMaxSpotFov);
+    const F32    nearPlane = std::max(light.range * 0.01f, 0.05f);
+    const JzVec3 up        = std::abs(direction.y) > 0.99f ? JzVec3(1.0f, 0.0f, 0.0f) : JzVec3(0.0f, 1.0f, 0.0f);
+
+    JzShadowView view;
+    view.key              = LightKey(light, lightIndex);
+    view.lightIndex       = lightIndex;
+    view.viewMatrix       = JzMat4x4::LookAt(light.position, light.position + direction, up);
+    view.projectionMatrix = JzMat4x4::Perspective(fov, 1.0f, nearPlane, light.range);
+    view.texelWorldSize   = 2.0f * std::tan(fov * 0.5f) / static_cast<F32>(m_settings.tileSize);
+    view.coverage         = ScreenCoverage(light.position, light.range, viewMatrix, projectionMatrix);
+
+    const F32 coneCos = std::cos(halfAngle);
+    const F32 coneSin = std::sin(halfAngle);
+    for (U32 drawIndex = 0; drawIndex < draws.size(); ++drawIndex) {
+        const auto &draw = draws[drawIndex];
+        if (draw.visibility != JzRenderVisibility::MainScene) {
+            continue;
+        }
+
+        // Sphere against the cone: distance from the center to the cone surface
+        const JzVec3 offset   = draw.boundsCenter - light.position;
+        const F32    along    = offset.Dot(direction);
+        const F32    across   = std::sqrt(std::max(offset.LengthSquared() - along * along, 0.0f));
+        const F32    distance = coneCos * across - along * coneSin;
+        if (draw.boundsRadius > 0.0f && (distance > draw.boundsRadius || along < -draw.boundsRadius ||
+                                         along > light.range + draw.boundsRadius)) {
+            continue;
+        }
+        view.casters.push_back(drawIndex);
+        view.staticOnly = view.staticOnly && draw.isStatic;
+    }
+
+    m_views.push_back(std::move(view));
+}
+
+void JzShadowAtlas::AssignTiles()
+{
+    for (auto &[key, state] : m_tileStates) {
+        state.used = false;
+    }
+
+    std::vector<U32> pending;
+    for (U32 index = 0; index < m_views.size(); ++index) {
+        auto iter = m_tileStates.find(m_views[index].key);
+        if (iter != m_tileStates.end()) {
+            iter->second.used = true;
+        } else {
+            pending.push_back(index);
+        }
+    }
+
+    // Tiles of lights and cascades that are gone go back to the pool
+    for (auto iter = m_tileStates.begin(); iter != m_tileStates.end();) {
+        if (!iter->second.used) {
+            m_freeTiles.push_back(iter->second.tile);
+            iter = m_tileStates.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+
+    // New views take the remaining tiles, most visible first
+    std::stable_sort(pending.begin(), pending.end(), [this](U32 lhs, U32 rhs) {
+        return m_views[lhs].coverage > m_views[rhs].coverage;
+    });
+
+    std::vector<Bool> dropped(m_views.size(), false);
+    for (U32 index : pending) {
+        if (m_freeTiles.empty()) {
+            dropped[index] = true;
+            continue;
+        }
+        JzShadowTileState state;
+        state.tile = m_freeTiles.back();
+        state.used = true;
+        m_freeTiles.pop_back();
+        m_tileStates.emplace(m_views[index].key, state);
+    }
+
+    if (std::find(dropped.begin(), dropped.end(), true) != dropped.end() && !m_warnedTileOverflow) {
+        JzRE_LOG_WARN("JzShadowAtlas: more shadow views than the {} atlas tiles, extra views cast no shadow",
+                      GetTileCount());
+        m_warnedTileOverflow = true;
+    }
+
+    // Compact, keeping each light's views contiguous
+    Size kept = 0;
+    for (Size index = 0; index < m_views.size(); ++index) {
+        if (dropped[index]) {
+            continue;
+        }
+        if (kept != index) {
+            m_views[kept] = std::move(m_views[index]);
+        }
+        auto &view = m_views[kept];
+        view.tile  = m_tileStates.at(view.key).tile;
+
+        auto &range = m_lightRanges[view.lightIndex];
+        if (range.viewCount == 0) {
+            range.firstView = static_cast<U32>(kept);
+        }
+        ++range.viewCount;
+        ++kept;
+    }
+    m_views.resize(kept);
+}
+
+void JzShadowAtlas::SelectRefreshViews(const std::vector<JzRenderSnapshotDraw> &draws)
+{
+    struct JzRefreshCandidate {
+        U32 view;
+        F32 priority;
+        U64 contentHash;
+    };
+    std::vector<JzRefreshCandidate> candidates;
+
+    for (U32 index = 0; index < m_views.size(); ++index) {
+        auto &view  = m_views[index];
+        auto &state = m_tileStates.at(view.key);
+        FinishView(view);
+
+        // Static tiles are keyed on everything that shapes their depth
+        U64 contentHash = 0;
+        if (view.staticOnly) {
+            contentHash = HashMatrix(HashCombine(view.tile, view.casters.size()), view.atlasMatrix);
+            for (U32 caster : view.casters) {
+                contentHash = HashCombine(contentHash, ToEntityId(draws[caster].entity));
+                contentHash = HashMatrix(contentHash, draws[caster].modelMatrix);
+            }
+        }
+
+        const Bool upToDate = state.valid && view.staticOnly && contentHash == state.contentHash;
+        if (!upToDate && view.coverage > 0.0f) {
+            candidates.push_back({index, view.coverage + kAgingPerFrame * static_cast<F32>(state.staleFrames),
+                                  contentHash});
+        }
+    }
+
+    // Coverage picks the order; waiting raises the priority so small lights are not starved
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [](const JzRefreshCandidate &lhs, const JzRefreshCandidate &rhs) {
+                         return lhs.priority > rhs.priority;
+                     });
+
+    for (Size rank = 0; rank < candidates.size(); ++rank) {
+        const auto &candidate = candidates[rank];
+        auto       &view      = m_views[candidate.view];
+        auto       &state     = m_tileStates.at(view.key);
+        if (rank >= m_settings.refreshBudget) {
+            ++state.staleFrames;
+            continue;
+        }
+
+        state.valid       = true;
+        state.contentHash = view.staticOnly ? candidate.contentHash : 0;
+        state.staleFrames = 0;
+        state.atlasMatrix = view.atlasMatrix;
+        state.texelSize   = view.texelWorldSize;
+        m_refreshViews.push_back(candidate.view);
+    }
+
+    for (auto &view : m_views) {
+        view.valid = m_tileStates.at(view.key).valid;
+    }
+}
+
+void JzShadowAtlas::FinishView(JzShadowView &view) const
+{
+    // Clip space to this tile's texels, and depth from [-1, 1] to [0, 1]
+    const JzIVec2 origin   = GetTileOrigin(view.tile);
+    const F32     halfSize = 0.5f * static_cast<F32>(m_settings.tileSize);
+    const JzMat4  toTile(halfSize, 0.0f, 0.0f, static_cast<F32>(origin.x) + halfSize,
+                         0.0f, halfSize, 0.0f, static_cast<F32>(origin.y) + halfSize,
+                         0.0f, 0.0f, 0.5f, 0.5f,
+                         0.0f, 0.0f, 0.0f, 1.0f);
+    view.atlasMatrix = toTile * view.projectionMatrix * view.viewMatrix;
+}
+
+} // namespace JzRE
@@ -0,0 +1,186 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Function/Rendering/JzStaticBatcher.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "JzRE/Runtime/Core/JzProfiler.h"
+
+namespace JzRE {
+
+namespace {
+
+struct JzBinnedInput {
+    Size               index = 0;
+    U64                key   = 0;
+    std::array<I32, 3> cell{};
+};
+
+JzVec3 TransformPoint(const JzMat4 &m, const JzVec3 &p)
+{
+    return JzVec3(m.m00 * p.x + m.m01 * p.y + m.m02 * p.z + m.m03,
+                  m.m10 * p.x + m.m11 * p.y + m.m12 * p.z + m.m13,
+                  m.m20 * p.x + m.m21 * p.y + m.m22 * p.z + m.m23);
+}
+
+JzVec3 TransformDirection(const JzMat4 &m, const JzVec3 &d)
+{
+    return JzVec3(m.m00 * d.x + m.m01 * d.y + m.m02 * d.z,
+                  m.m10 * d.x + m.m11 * d.y + m.m12 * d.z,
+                  m.m20 * d.x + m.m21 * d.y + m.m22 * d.z);
+}
+
+/**
+ * @brief Cofactor matrix of the upper 3x3, which is the inverse transpose scaled by the determinant.
+ */
+JzMat4 NormalMatrix(const JzMat4 &m, F32 &determinant)
+{
+    JzMat4 c = JzMat4x4::Identity();
+    c.m00    = m.m11 * m.m22 - m.m12 * m.m21;
+    c.m01    = m.m12 * m.m20 - m.m10 * m.m22;
+    c.m02    = m.m10 * m.m21 - m.m11 * m.m20;
+    c.m10    = m.m02 * m.m21 - m.m01 * m.m22;
+    c.m11    = m.m00 * m.m22 - m.m02 * m.m20;
+    c.m12    = m.m01 * m.m20 - m.m00 * m.m21;
+    c.m20    = m.m01 * m.m12 - m.m02 * m.m11;
+    c.m21    = m.m02 * m.m10 - m.m00 * m.m12;
+    c.m22    = m.m00 * m.m11 - m.m01 * m.m10;
+
+    determinant = m.m00 * c.m00 + m.m01 * c.m01 + m.m02 * c.m02;
+    return c;
+}
+
+JzVec3 SafeNormalize(const JzVec3 &v)
+{
+    const F32 length = v.Length();
+    return length > 0.0f ? v * (1.0f / length) : v;
+}
+
+void AppendInput(JzStaticBatchChunk &chunk, const JzStaticBatchInput &input)
+{
+    F32          determinant  = 1.0f;
+    const JzMat4 normalMatrix = NormalMatrix(input.worldMatrix, determinant);
+    const F32    normalSign   = determinant < 0.0f ? -1.0f : 1.0f;
+    const U32    baseVertex   = static_cast<U32>(chunk.vertices.size());
+
+    chunk.vertices.reserve(chunk.vertices.size() + input.vertices->size());
+    for (const auto &source : *input.vertices) {
+        JzVertex vertex  = source;
+        vertex.Position  = TransformPoint(input.worldMatrix, source.Position);
+        vertex.Normal    = SafeNormalize(TransformDirection(normalMatrix, source.Normal) * normalSign);
+        vertex.Tangent   = SafeNormalize(TransformDirection(input.worldMatrix, source.Tangent));
+        vertex.Bitangent = SafeNormalize(TransformDirection(input.worldMatrix, source.Bitangent));
+        chunk.vertices.push_back(vertex);
+    }
+
+    // A mirroring transform turns the triangles inside out
+    const Bool  flip    = determinant < 0.0f;
+    const auto &indices = *input.indices;
+    const Size  count   = indices.size() - indices.size() % 3;
+    chunk.indices.reserve(chunk.indices.size() + count);
+    for (Size i = 0; i < count; i += 3) {
+        chunk.indices.push_back(baseVertex + indices[i]);
+        chunk.indices.push_back(baseVertex + indices[flip ? i + 2 : i + 1]);
+        chunk.indices.push_back(baseVertex + indices[flip ? i + 1 : i + 2]);
+    }
+}
+
+void ComputeChunkBounds(JzStaticBatchChunk &chunk)
+{
+    if (chunk.vertices.empty()) {
+        return;
+    }
+
+    JzVec3 minPos = chunk.vertices.front().Position;
+    JzVec3 maxPos = minPos;
+    for (const auto &vertex : chunk.vertices) {
+        for (U16 axis = 0; axis < 3; ++axis) {
+            minPos[axis] = std::min(minPos[axis], vertex.Position[axis]);
+            maxPos[axis] = std::max(maxPos[axis], vertex.Position[axis]);
+        }
+    }
+
+    chunk.boundsCenter = (minPos + maxPos) * 0.5f;
+    chunk.boundsRadius = 0.0f;
+    for (const auto &vertex : chunk.vertices) {
+        chunk.boundsRadius = std::max(chunk.boundsRadius, (vertex.Position - chunk.boundsCenter).Length());
+    }
+}
+
+} // namespace
+
+std::vector<JzStaticBatchChunk> JzStaticBatcher::Build(const std::vector<JzStaticBatchInput> &inputs,
+                                                       const JzStaticBatchSettings           &settings)
+{
+    JzRE_PROFILE_SCOPE("StaticBatchBuild");
+
+    const F32 cellSize = settings.chunkSize > 0.0f ? settings.chunkSize : 1.0f;
+
+    std::vector<JzBinnedInput> binned;
+    binned.reserve(inputs.size());
+    for (Size i = 0; i < inputs.size(); ++i) {
+        const auto &input = inputs[i];
+        if (!input.vertices || !input.indices || input.vertices->empty() || input.indices->size() < 3) {
+            continue;
+        }
+
+        JzVec3 minPos = TransformPoint(input.worldMatrix, input.vertices->front().Position);
+        JzVec3 maxPos = minPos;
+        for (const auto &vertex : *input.vertices) {
+            const JzVec3 position = TransformPoint(input.worldMatrix, vertex.Position);
+            for (U16 axis = 0; axis < 3; ++axis) {
+                minPos[axis] = std::min(minPos[axis], position[axis]);
+                maxPos[axis] = std::max(maxPos[axis], position[axis]);
+            }
+        }
+
+        auto &entry = binned.emplace_back();
+        entry.index = i;
+        entry.key   = input.groupKey;
+        for (U16 axis = 0; axis < 3; ++axis) {
+            const F32 center = (minPos[axis] + maxPos[axis]) * 0.5f;
+            entry.cell[axis] = static_cast<I32>(std::floor(center / cellSize));
+        }
+    }
+
+    std::sort(binned.begin(), binned.end(), [](const JzBinnedInput &a, const JzBinnedInput &b) {
+        if (a.key != b.key) {
+            return a.key < b.key;
+        }
+        if (a.cell != b.cell) {
+            return a.cell < b.cell;
+        }
+        return a.index < b.index;
+    });
+
+    std::vector<JzStaticBatchChunk> chunks;
+    const JzBinnedInput            *previous = nullptr;
+    for (const auto &entry : binned) {
+        const auto &input   = inputs[entry.index];
+        const Bool  sameBin = previous && previous->key == entry.key && previous->cell == entry.cell;
+        const Bool  fits    = sameBin && chunks.back().vertices.size() + input.vertices->size() <=
+                                         settings.maxVerticesPerChunk;
+        if (!fits) {
+            auto &chunk    = chunks.emplace_back();
+            chunk.groupKey = entry.key;
+        }
+
+        auto &chunk = chunks.back();
+        AppendInput(chunk, input);
+        chunk.inputs.push_back(static_cast<U32>(entry.index));
+        previous = &entry;
+    }
+
+    for (auto &chunk : chunks) {
+        ComputeChunkBounds(chunk);
+    }
+
+    return chunks;
+}
+
+} // namespace JzRE
@@ -7,6 +7,7 @@
 #include "JzRE/Runtime/Function/Script/JzScriptComponent.h"
 
 #include "JzRE/Runtime/Core/JzLogger.h"
+#include "JzRE/Runtime/Core/JzServiceContainer.h"
 #include "JzRE/Runtime/Core/JzVector.h"
 #include "JzRE/Runtime/Function/ECS/JzWorld.h"
 #include "JzRE/Runtime/Function/ECS/JzTransformComponents.h"
@@ -34,11 +35,25 @@ void JzScriptContext::Initialize(JzWorld &world)
     RegisterWorldBindings(world);
     RegisterLogBindings();
 
+    if (JzServiceContainer::Has<JzFileWatcher>()) {
+        m_fileWatcher = &JzServiceContainer::Get<JzFileWatcher>();
+    }
+
     JzRE_LOG_INFO("JzScriptContext: Lua {} initialized", LUA_VERSION);
 }
 
 void JzScriptContext::Shutdown()
 {
+    if (m_fileWatcher) {
+        for (const auto &[directory, watched] : m_watchedDirectories) {
+            m_fileWatcher->Unwatch(watched.handle);
+        }
+    }
+    m_watchedDirectories.clear();
+    m_changedFiles.clear();
+    m_rescanDirectories.clear();
+    m_fileWatcher = nullptr;
+
     m_instances.clear();
     m_pathToEntities.clear();
     m_world = nullptr;
@@ -72,7 +87,12 @@ Bool JzScriptContext::LoadScript(JzEntity entity, const String &scriptPath)
     inst.lastWriteTime  = mtime;
 
     m_instances[entity] = std::move(inst);
-    m_pathToEntities[scriptPath].push_back(entity);
+
+    auto &entities = m_pathToEntities[scriptPath];
+    if (entities.empty()) {
+        WatchScript(scriptPath);
+    }
+    entities.push_back(entity);
     return true;
 }
 
@@ -89,6 +109,7 @@ void JzScriptContext::UnloadScript(JzEntity entity)
                      entityList.end());
     if (entityList.empty()) {
         m_pathToEntities.erase(it->second.scriptPath);
+        UnwatchScript(it->second.scriptPath);
     }
 
     m_instances.erase(it);
@@ -158,6 +179,33 @@ void JzScriptContext::CallOnStop(JzEntity entity)
 
 void JzScriptContext::CheckHotReload(F32 delta)
 {
+    if (m_fileWatcher) {
+        if (m_changedFiles.empty() && m_rescanDirectories.empty()) return;
+
+        for (auto &[path, entities] : m_pathToEntities) {
+            if (entities.empty()) continue;
+
+            const auto normalized = JzFileWatcher::NormalizePath(path);
+            if (m_changedFiles.contains(normalized.string())) {
+                ReloadScript(path, entities, {});
+                continue;
+            }
+
+            // Notifications were lost, fall back to the timestamp for this directory
+            if (m_rescanDirectories.contains(normalized.parent_path().string())) {
+                std::error_code ec;
+                const auto      newMtime = std::filesystem::last_write_time(path, ec);
+                if (!ec && newMtime > m_instances[entities[0]].lastWriteTime) {
+                    ReloadScript(path, entities, newMtime);
+                }
+            }
+        }
+
+        m_changedFiles.clear();
+        m_rescanDirectories.clear();
+        return;
+    }
+
     m_timeSinceCheck += delta;
     if (m_timeSinceCheck < m_reloadInterval) return;
     m_timeSinceCheck = 0.0f;
@@ -176,36 +224,78 @@ void JzScriptContext::CheckHotReload(F32 delta)
         auto &refInst = m_instances[entities[0]];
         if (newMtime <= refInst.lastWriteTime) continue;
 
-        JzRE_LOG_INFO("JzScriptContext: Hot-reloading '{}'", path);
+        ReloadScript(path, entities, newMtime);
+    }
+}
 
-        for (JzEntity e : entities) {
-            auto it = m_instances.find(e);
-            if (it == m_instances.end()) continue;
+void JzScriptContext::ReloadScript(const String &path, std::vector<JzEntity> &entities,
+                                   std::filesystem::file_time_type newMtime)
+{
+    if (newMtime == std::filesystem::file_time_type{}) {
+        std::error_code ec;
+        newMtime = std::filesystem::last_write_time(path, ec);
+    }
 
-            auto &inst = it->second;
+    JzRE_LOG_INFO("JzScriptContext: Hot-reloading '{}'", path);
 
-            // Re-execute the file into the existing environment
-            if (!ExecuteFile(path, inst.env)) {
-                // Keep old functions on failure
-                continue;
-            }
+    for (JzEntity e : entities) {
+        auto it = m_instances.find(e);
+        if (it == m_instances.end()) continue;
 
-            // Refresh cached function handles
-            inst.onStart       = inst.env.get<sol::protected_function>("OnStart");
-            inst.onUpdate      = inst.env.get<sol::protected_function>("OnUpdate");
-            inst.onStop        = inst.env.get<sol::protected_function>("OnStop");
-            inst.lastWriteTime = newMtime;
+        auto &inst = it->second;
 
-            // Reset started so OnStart fires again on next frame
-            if (m_world) {
-                if (auto *comp = m_world->TryGetComponent<JzScriptComponent>(e)) {
-                    comp->started = false;
-                }
+        // Re-execute the file into the existing environment
+        if (!ExecuteFile(path, inst.env)) {
+            // Keep old functions on failure
+            continue;
+        }
+
+        // Refresh cached function handles
+        inst.onStart       = inst.env.get<sol::protected_function>("OnStart");
+        inst.onUpdate      = inst.env.get<sol::protected_function>("OnUpdate");
+        inst.onStop        = inst.env.get<sol::protected_function>("OnStop");
+        inst.lastWriteTime = newMtime;
+
+        // Reset started so OnStart fires again on next frame
+        if (m_world) {
+            if (auto *comp = m_world->TryGetComponent<JzScriptComponent>(e)) {
+                comp->started = false;
             }
         }
     }
 }
 
+void JzScriptContext::WatchScript(const String &scriptPath)
+{
+    if (!m_fileWatcher) return;
+
+    const auto directory = JzFileWatcher::NormalizePath(scriptPath).parent_path();
+    auto      &watched   = m_watchedDirectories[directory.string()];
+    if (watched.refCount++ > 0) return;
+
+    watched.handle = m_fileWatcher->Watch(directory, false, [this](const std::vector<JzFileChange> &changes) {
+        for (const auto &change : changes) {
+            if (change.kind == JzEFileChangeKind::Rescan) {
+                m_rescanDirectories.insert(change.path.string());
+            } else {
+                m_changedFiles.insert(change.path.string());
+            }
+        }
+    });
+}
+
+void JzScriptContext::UnwatchScript(const String &scriptPath)
+{
+    if (!m_fileWatcher) return;
+
+    const auto key = JzFileWatcher::NormalizePath(scriptPath).parent_path().string();
+    auto       it  = m_watchedDirectories.find(key);
+    if (it == m_watchedDirectories.end() || --it->second.refCount > 0) return;
+
+    m_fileWatcher->Unwatch(it->second.handle);
+    m_watchedDirectories.erase(it);
+}
+
 // ---------------------------------------------------------------------------
 // Private: Bindings
 // ---------------------------------------------------------------------------
@@ -16,12 +16,16 @@
 #include "JzRE/Runtime/Function/ECS/JzWindowSystem.h"
 #include "JzRE/Runtime/Function/ECS/JzCameraSystem.h"
 #include "JzRE/Runtime/Function/ECS/JzLightSystem.h"
+#include "JzRE/Runtime/Function/ECS/JzLODSystem.h"
+#include "JzRE/Runtime/Function/ECS/JzOcclusionCullingSystem.h"
 #include "JzRE/Runtime/Function/ECS/JzRenderSystem.h"
+#include "JzRE/Runtime/Function/ECS/JzStaticBatchSystem.h"
 #include "JzRE/Runtime/Function/ECS/JzAssetSystem.h"
 #include "JzRE/Runtime/Function/Event/JzEventSystem.h"
 #include "JzRE/Runtime/Function/Script/JzScriptSystem.h"
 #include "JzRE/Runtime/Platform/RHI/JzDevice.h"
 #include "JzRE/Runtime/Platform/RHI/JzGraphicsContext.h"
+#include "JzRE/Runtime/Platform/Threading/JzRenderThread.h"
 
 namespace JzRE {
 
@@ -29,13 +33,21 @@ namespace JzRE {
 class JzAssetImporter;
 class JzAssetExporter;
 class JzShaderCookService;
+class JzFileWatcher;
 
 struct JzRERuntimeSettings {
     String                windowTitle     = "JzRE Runtime";
     JzIVec2               windowSize      = {1280, 720};
     Bool                  windowDecorated = true;
+    Bool                  windowVisible   = true; // Hidden windows only own the context; the scene renders offscreen
     JzERHIType            rhiType         = JzERHIType::Unknown;
-    std::filesystem::path projectFile; // Optional: path to .jzreproject file
+    std::filesystem::path projectFile;               // Optional: path to .jzreproject file
+    U32                   profileFrames      = 0;    // Frames to capture with the profiler, 0 disables it
+    std::filesystem::path profileOutput;             // Chrome trace written after the capture
+    U32                   renderFrameLatency = 0;    // 0 renders on the game thread, 1 renders frame N on a render thread while N+1 simulates
+    F32                   fixedDeltaTime     = 0.0f; // Seconds passed to systems every frame, 0 uses the measured frame time
+    U32                   maxFrames          = 0;    // Frames to run before the loop exits, 0 runs until the window closes
+    Bool                  indirectDraw       = true; // Multi-draw indirect geometry submission where the device supports it
 };
 
 /**
@@ -123,6 +135,8 @@ protected:
      * @param deltaTime Time elapsed since the last frame in seconds
      *
      * Override this method to update game logic, camera movement, etc.
+     * With a render frame latency of 1 the render thread holds the graphics
+     * context at this point, so do not create GPU resources here.
      */
     virtual void OnUpdate(F32 deltaTime);
 
@@ -133,6 +147,8 @@ protected:
      *
      * Override this method to render additional content (e.g., host UI).
      * The 3D scene has already been rendered to the framebuffer at this point.
+     * With a render frame latency of 1 this runs on the render thread while
+     * the next frame simulates, so it must not touch the world.
      */
     virtual void OnRender(F32 deltaTime);
 
@@ -163,10 +179,24 @@ private:
 
     void UpdateSystems(F32 deltaTime);
 
-    void SynchronizeSystems();
+    void SynchronizeSystems(F32 deltaTime);
+
+    void UpdateHotReload(F32 deltaTime);
+
+    void KickRenderFrame(F32 deltaTime);
+
+    void StartRenderThread();
+
+    void StopRenderThread();
 
     void OnFrameEnd();
 
+    void BeginProfileCapture();
+
+    void UpdateProfileCapture();
+
+    void FinishProfileCapture();
+
     void Shutdown();
 
     void SaveGameState();
@@ -199,23 +229,39 @@ protected:
     std::unique_ptr<JzGraphicsContext> m_graphicsContext;
 
     // ECS world and systems
-    std::unique_ptr<JzWorld>        m_world;
-    std::shared_ptr<JzWindowSystem> m_windowSystem;
-    std::shared_ptr<JzInputSystem>  m_inputSystem;
-    std::shared_ptr<JzCameraSystem> m_cameraSystem;
-    std::shared_ptr<JzLightSystem>  m_lightSystem;
-    std::shared_ptr<JzRenderSystem> m_renderSystem;
-    std::shared_ptr<JzAssetSystem>  m_assetSystem;
-    std::shared_ptr<JzEventSystem>  m_eventSystem;
-    std::shared_ptr<JzScriptSystem> m_scriptSystem;
+    std::unique_ptr<JzWorld>                  m_world;
+    std::shared_ptr<JzWindowSystem>           m_windowSystem;
+    std::shared_ptr<JzInputSystem>            m_inputSystem;
+    std::shared_ptr<JzCameraSystem>           m_cameraSystem;
+    std::shared_ptr<JzLightSystem>            m_lightSystem;
+    std::shared_ptr<JzLODSystem>              m_lodSystem;
+    std::shared_ptr<JzOcclusionCullingSystem> m_occlusionCullingSystem;
+    std::shared_ptr<JzStaticBatchSystem>      m_staticBatchSystem;
+    std::shared_ptr<JzRenderSystem>           m_renderSystem;
+    std::shared_ptr<JzAssetSystem>            m_assetSystem;
+    std::shared_ptr<JzEventSystem>            m_eventSystem;
+    std::shared_ptr<JzScriptSystem>           m_scriptSystem;
 
     // Asset import/export services
     std::unique_ptr<JzAssetImporter> m_assetImporter;
     std::unique_ptr<JzAssetExporter> m_assetExporter;
     std::unique_ptr<JzShaderCookService> m_shaderCookService;
+    std::unique_ptr<JzFileWatcher>       m_fileWatcher;
 
     JzEntity m_mainCameraEntity = INVALID_ENTITY;
     JzEntity m_windowEntity     = INVALID_ENTITY; ///< Primary window ECS entity
+
+    // Render thread, running only with a render frame latency of 1
+    JzRenderThread m_renderThread;
+    U64            m_renderExtractNs = 0; ///< Extract time of the frame being simulated
+    U64            m_renderDrawNs    = 0; ///< Render time of the last kicked frame, written on the render thread
+
+    // Frame profiler capture
+    Bool m_profileCaptureActive = false;
+    U32  m_profiledFrames       = 0;
+
+    // Frames completed by Run, checked against JzRERuntimeSettings::maxFrames
+    U32 m_frameCount = 0;
 };
 
 } // namespace JzRE
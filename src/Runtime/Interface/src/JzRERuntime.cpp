@@ -7,6 +7,8 @@
 
 #include "JzRE/Runtime/Core/JzClock.h"
 #include "JzRE/Runtime/Core/JzFileSystemUtils.h"
+#include "JzRE/Runtime/Core/JzLogger.h"
+#include "JzRE/Runtime/Core/JzProfiler.h"
 #include "JzRE/Runtime/Core/JzServiceContainer.h"
 #include "JzRE/Runtime/Function/Project/JzProjectConfig.h"
 
@@ -16,8 +18,10 @@
 #include "JzRE/Runtime/Function/ECS/JzInputComponents.h"
 #include "JzRE/Runtime/Function/ECS/JzWindowComponents.h"
 
+#include "JzRE/Runtime/Platform/FileSystem/JzFileWatcher.h"
 #include "JzRE/Runtime/Platform/RHI/JzGraphicsContext.h"
 #include "JzRE/Runtime/Platform/RHI/JzDeviceFactory.h"
+#include "JzRE/Runtime/Platform/Threading/JzRenderThreadContext.h"
 
 // Resource factories for JzAssetManager
 #include "JzRE/Runtime/Resource/JzShaderFactory.h"
@@ -133,6 +137,10 @@ void JzRE::JzRERuntime::CreateSubsystems()
     // Create graphics context (after window is created in RegisterSystems)
     // Note: device creation is deferred until after window system initialization
 
+    // Shared file change notifications for hot reload and auto-cook
+    m_fileWatcher = std::make_unique<JzFileWatcher>();
+    JzServiceContainer::Provide<JzFileWatcher>(*m_fileWatcher);
+
     // Initialize ECS world first (needed for system registration)
     // Asset system is created as an ECS system in RegisterSystems()
     m_world = std::make_unique<JzWorld>();
@@ -193,6 +201,7 @@ void JzRE::JzRERuntime::RegisterSystems()
     windowConfig.width     = m_settings.windowSize.x;
     windowConfig.height    = m_settings.windowSize.y;
     windowConfig.decorated = m_settings.windowDecorated;
+    windowConfig.visible   = m_settings.windowVisible;
     m_windowSystem->InitializeWindow(m_settings.rhiType, windowConfig);
     m_windowSystem->SetAlignCentered();
 
@@ -215,13 +224,22 @@ void JzRE::JzRERuntime::RegisterSystems()
     m_assetSystem = m_world->RegisterSystem<JzAssetSystem>();
     JzServiceContainer::Provide<JzAssetSystem>(*m_assetSystem);
 
+    // Merges static entities once their assets are ready, so it follows the asset system
+    m_staticBatchSystem = m_world->RegisterSystem<JzStaticBatchSystem>();
+
     m_scriptSystem = m_world->RegisterSystem<JzScriptSystem>();
     JzServiceContainer::Provide<JzScriptSystem>(*m_scriptSystem);
 
-    m_cameraSystem = m_world->RegisterSystem<JzCameraSystem>();
-    m_lightSystem  = m_world->RegisterSystem<JzLightSystem>();
-    m_renderSystem = m_world->RegisterSystem<JzRenderSystem>();
+    m_cameraSystem           = m_world->RegisterSystem<JzCameraSystem>();
+    m_lightSystem            = m_world->RegisterSystem<JzLightSystem>();
+    m_lodSystem              = m_world->RegisterSystem<JzLODSystem>();
+    m_occlusionCullingSystem = m_world->RegisterSystem<JzOcclusionCullingSystem>();
+    m_renderSystem           = m_world->RegisterSystem<JzRenderSystem>();
     JzServiceContainer::Provide<JzRenderSystem>(*m_renderSystem);
+    m_renderSystem->SetIndirectDrawEnabled(m_settings.indirectDraw);
+
+    // Render extraction copies the collected lights into the frame snapshot
+    m_world->SetContext<JzLightSystem *>(m_lightSystem.get());
 }
 
 void JzRE::JzRERuntime::InitializeSubsystems()
@@ -268,6 +286,14 @@ void JzRE::JzRERuntime::InitializeSubsystems()
         m_assetSystem->AddSearchPath(config.GetShaderCookedPath().string());
         m_assetSystem->AddSearchPath((contentPath / "Materials").string());
         m_assetSystem->AddSearchPath((contentPath / "Scripts").string());
+
+        // Textures prefer what `JzRE build` cooked for them
+        JzTexture::SetCookedRoot(contentPath, config.GetTextureCookedPath());
+
+        // Linked program binaries live next to the project's shader cache
+        if (JzServiceContainer::Has<JzDevice>()) {
+            JzServiceContainer::Get<JzDevice>().SetPipelineCacheDirectory(config.GetShaderCachePath() / "ProgramBinaries");
+        }
     }
 
     m_assetSystem->AddSearchPath(enginePath.string());
@@ -365,17 +391,113 @@ void JzRE::JzRERuntime::UpdateSystems(F32 deltaTime)
     // plan B
     // systemManager.ExecuteSystems(deltaTime);
 
-    if (m_shaderCookService && m_assetSystem) {
-        m_shaderCookService->Update(deltaTime, *m_assetSystem);
+    if (m_renderThread.IsRunning()) {
+        // Runs while the render thread draws the previous frame. Phases up to
+        // Culling only touch the world; asset readiness and rendering need the
+        // graphics context and run in SynchronizeSystems and on the render thread.
+        m_world->Update(deltaTime, JzSystemPhase::Input, JzSystemPhase::Culling);
+
+        const U64 extractBeginNs = JzProfiler::NowNs();
+        m_renderSystem->Extract(*m_world);
+        m_renderExtractNs = JzProfiler::NowNs() - extractBeginNs;
+        return;
     }
 
+    UpdateHotReload(deltaTime);
+
     // Update all systems (camera matrices, light collection, culling)
     m_world->Update(deltaTime);
 }
 
-void JzRE::JzRERuntime::SynchronizeSystems()
+void JzRE::JzRERuntime::SynchronizeSystems(F32 deltaTime)
+{
+    // The serial loop already ran every phase in UpdateSystems
+    if (!m_renderThread.IsRunning()) {
+        return;
+    }
+
+    // Sync point: the previous frame is done, so the graphics context is free
+    // and its snapshot can be replaced by the one extracted this frame
+    m_renderThread.Wait();
+
+    JzRenderThreadContext threadContext(*m_graphicsContext);
+
+    UpdateHotReload(deltaTime);
+
+    // Entities readied here are picked up by next frame's extraction
+    m_world->Update(deltaTime, JzSystemPhase::RenderPrep, JzSystemPhase::RenderPrep);
+
+    const U64 prepareBeginNs = JzProfiler::NowNs();
+    m_renderSystem->PrepareFrame();
+    m_renderSystem->PublishSnapshot();
+
+    // The render system skips world updates here, so its timing is its stages'
+    // sum; the draw time is the previous frame's, which the Wait above finished
+    m_world->RecordSystemTiming(*m_renderSystem,
+                                m_renderExtractNs + (JzProfiler::NowNs() - prepareBeginNs) + m_renderDrawNs);
+
+    UpdateProfileCapture();
+}
+
+void JzRE::JzRERuntime::UpdateHotReload(F32 deltaTime)
+{
+    if (m_fileWatcher) {
+        m_fileWatcher->Update(deltaTime);
+    }
+
+    if (m_shaderCookService && m_assetSystem) {
+        m_shaderCookService->Update(deltaTime, *m_assetSystem);
+    }
+}
+
+void JzRE::JzRERuntime::KickRenderFrame(F32 deltaTime)
 {
-    // Synchronize ECS systems (e.g., physics, animation) with the main thread
+    m_renderThread.Kick([this, deltaTime] {
+        JzRenderThreadContext threadContext(*m_graphicsContext);
+
+        m_graphicsContext->BeginFrame();
+
+        const U64 renderBeginNs = JzProfiler::NowNs();
+        m_renderSystem->Render();
+        m_renderDrawNs = JzProfiler::NowNs() - renderBeginNs;
+
+        OnRender(deltaTime);
+        m_graphicsContext->EndFrame();
+        m_graphicsContext->Present();
+    });
+}
+
+void JzRE::JzRERuntime::StartRenderThread()
+{
+    if (m_settings.renderFrameLatency == 0) {
+        return;
+    }
+
+    if (m_settings.renderFrameLatency > 1) {
+        JzRE_LOG_WARN("JzRERuntime: render frame latency {} is not supported, using 1",
+                      m_settings.renderFrameLatency);
+    }
+
+    if (!m_graphicsContext || !m_graphicsContext->IsInitialized() || !m_renderSystem) {
+        JzRE_LOG_WARN("JzRERuntime: no graphics context, rendering on the main thread");
+        return;
+    }
+
+    // From here on the render thread and the sync point take the context in turns
+    m_graphicsContext->ReleaseCurrentContext();
+    m_renderThread.Start("Render");
+}
+
+void JzRE::JzRERuntime::StopRenderThread()
+{
+    if (!m_renderThread.IsRunning()) {
+        return;
+    }
+
+    m_renderThread.Stop();
+
+    // Shutdown releases GPU resources from the main thread
+    m_graphicsContext->MakeCurrentContext();
 }
 
 void JzRE::JzRERuntime::OnFrameEnd()
@@ -390,6 +512,8 @@ void JzRE::JzRERuntime::SaveGameState()
 
 void JzRE::JzRERuntime::ShutdownSubsystems()
 {
+    StopRenderThread();
+
     if (m_shaderCookService) {
         m_shaderCookService->Shutdown();
         m_shaderCookService.reset();
@@ -413,6 +537,9 @@ void JzRE::JzRERuntime::ShutdownSubsystems()
     JzServiceContainer::Remove<JzEventSystem>();
     JzServiceContainer::Remove<JzWindowSystem>();
     m_renderSystem.reset();
+    m_occlusionCullingSystem.reset();
+    m_lodSystem.reset();
+    m_staticBatchSystem.reset();
     m_lightSystem.reset();
     m_cameraSystem.reset();
     m_assetSystem.reset();
@@ -429,6 +556,9 @@ void JzRE::JzRERuntime::ShutdownSubsystems()
     m_windowSystem.reset();
     JzServiceContainer::Remove<JzWorld>();
     m_world.reset();
+
+    JzServiceContainer::Remove<JzFileWatcher>();
+    m_fileWatcher.reset();
 }
 
 void JzRE::JzRERuntime::CleanupGlobals()
@@ -513,8 +643,14 @@ void JzRE::JzRERuntime::Run()
 
     JzRE::JzClock clock;
 
+    BeginProfileCapture();
+
+    StartRenderThread();
+
     while (IsRunning()) {
-        auto deltaTime = clock.GetDeltaTime();
+        JzRE_PROFILE_SCOPE("Frame");
+
+        auto deltaTime = m_settings.fixedDeltaTime > 0.0f ? m_settings.fixedDeltaTime : clock.GetDeltaTime();
 
         m_windowSystem->PollWindowEvents();
 
@@ -523,13 +659,32 @@ void JzRE::JzRERuntime::Run()
         // Call user update logic
         OnUpdate(deltaTime);
 
+        if (m_renderThread.IsRunning()) {
+            // Simulate this frame while the render thread draws the previous one
+            UpdateSystems(deltaTime);
+
+            SynchronizeSystems(deltaTime);
+
+            KickRenderFrame(deltaTime);
+
+            OnFrameEnd();
+
+            if (m_inputSystem) {
+                m_inputSystem->ClearFrameState(*m_world);
+            }
+
+            clock.Update();
+            m_frameCount++;
+            continue;
+        }
+
         if (m_graphicsContext) {
             m_graphicsContext->BeginFrame();
         }
 
         UpdateSystems(deltaTime);
 
-        SynchronizeSystems();
+        SynchronizeSystems(deltaTime);
 
         // Call render hook for additional rendering (e.g., host UI)
         OnRender(deltaTime);
@@ -552,13 +707,94 @@ void JzRE::JzRERuntime::Run()
 
         // Update clock for next frame
         clock.Update();
+        m_frameCount++;
+
+        UpdateProfileCapture();
     }
 
+    StopRenderThread();
+
+    FinishProfileCapture();
+
     OnStop();
 }
 
+void JzRE::JzRERuntime::BeginProfileCapture()
+{
+    if (m_settings.profileFrames == 0 || !m_graphicsContext || !m_graphicsContext->IsInitialized()) {
+        return;
+    }
+
+    auto &profiler = JzProfiler::GetInstance();
+    profiler.ClearCapture();
+    profiler.SetThreadName("Main");
+    profiler.SetEnabled(true);
+    m_graphicsContext->GetDevice().SetGpuProfilingEnabled(true);
+
+    m_profileCaptureActive = true;
+    m_profiledFrames       = 0;
+    JzRE_LOG_INFO("Profiler: capturing {} frames", m_settings.profileFrames);
+}
+
+void JzRE::JzRERuntime::UpdateProfileCapture()
+{
+    if (!m_profileCaptureActive) {
+        return;
+    }
+
+    // GPU results trail the CPU by a few frames; keep resolving them after the CPU capture stops
+    constexpr U32 kGpuDrainFrames = 4;
+
+    auto &profiler = JzProfiler::GetInstance();
+    for (const auto &zone : m_graphicsContext->GetDevice().ConsumeGpuZones()) {
+        profiler.RecordGpuZone(zone.name, zone.beginNs, zone.endNs);
+    }
+    profiler.Collect();
+
+    m_profiledFrames++;
+    if (m_profiledFrames == m_settings.profileFrames) {
+        profiler.SetEnabled(false);
+    }
+    if (m_profiledFrames >= m_settings.profileFrames + kGpuDrainFrames) {
+        FinishProfileCapture();
+    }
+}
+
+void JzRE::JzRERuntime::FinishProfileCapture()
+{
+    if (!m_profileCaptureActive) {
+        return;
+    }
+    m_profileCaptureActive = false;
+
+    auto &profiler = JzProfiler::GetInstance();
+    auto &device   = m_graphicsContext->GetDevice();
+    for (const auto &zone : device.ConsumeGpuZones()) {
+        profiler.RecordGpuZone(zone.name, zone.beginNs, zone.endNs);
+    }
+    device.SetGpuProfilingEnabled(false);
+    profiler.SetEnabled(false);
+    profiler.Collect();
+
+    auto output = m_settings.profileOutput;
+    if (output.empty()) {
+        output = "profile.json";
+    }
+
+    if (!profiler.ExportChromeTrace(output)) {
+        JzRE_LOG_ERROR("Profiler: failed to write trace to '{}'", output.string());
+    } else {
+        JzRE_LOG_INFO("Profiler: wrote {} events to '{}' ({} dropped)", profiler.GetCapturedEventCount(),
+                      output.string(), profiler.GetDroppedEventCount());
+    }
+    profiler.ClearCapture();
+}
+
 JzRE::Bool JzRE::JzRERuntime::IsRunning() const
 {
+    if (m_settings.maxFrames > 0 && m_frameCount >= m_settings.maxFrames) {
+        return false;
+    }
     return !m_windowSystem->ShouldClose();
 }
 
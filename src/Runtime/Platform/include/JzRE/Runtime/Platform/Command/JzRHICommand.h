@@ -16,6 +16,7 @@ enum class JzRHIECommandType : U8 {
     Clear,
     Draw,
     DrawIndexed,
+    DrawIndexedIndirect,
     BindPipeline,
     BindVertexArray,
     BindTexture,
@@ -25,7 +26,9 @@ enum class JzRHIECommandType : U8 {
     BeginRenderPass,
     EndRenderPass,
     ResourceBarrier,
-    BlitFramebufferToScreen
+    BlitFramebufferToScreen,
+    BeginGpuZone,
+    EndGpuZone
 };
 
 /**
@@ -15,6 +15,7 @@
 #include "JzRE/Runtime/Platform/Command/JzRHIClearCommand.h"
 #include "JzRE/Runtime/Platform/Command/JzRHIDrawCommand.h"
 #include "JzRE/Runtime/Platform/Command/JzRHIDrawIndexedCommand.h"
+#include "JzRE/Runtime/Platform/Command/JzRHIDrawIndexedIndirectCommand.h"
 #include "JzRE/Runtime/Platform/Command/JzRHISetViewportCommand.h"
 #include "JzRE/Runtime/Platform/Command/JzRHISetScissorCommand.h"
 #include "JzRE/Runtime/Platform/RHI/JzRHIResourceBarrier.h"
@@ -53,6 +54,8 @@ struct JzRHIBindTexturePayload {
  */
 struct JzRHIBindFramebufferPayload {
     std::shared_ptr<JzGPUFramebufferObject> framebuffer;
+    JzRHIAttachmentOps                      attachmentOps;
+    Bool                                    hasAttachmentOps = false; ///< False keeps the backend defaults
 };
 
 /**
@@ -88,6 +91,13 @@ struct JzRHIEndRenderPassPayload {
     std::shared_ptr<JzRHIRenderPass> renderPass;
 };
 
+/**
+ * @brief Payload for begin GPU timing zone command.
+ */
+struct JzRHIGpuZonePayload {
+    String name;
+};
+
 /**
  * @brief Variant payload used by recorded commands.
  */
@@ -96,6 +106,7 @@ using JzRHICommandPayload = std::variant<
     JzClearParams,
     JzDrawParams,
     JzDrawIndexedParams,
+    JzDrawIndexedIndirectParams,
     JzViewport,
     JzScissorRect,
     JzRHIBindPipelinePayload,
@@ -105,7 +116,8 @@ using JzRHICommandPayload = std::variant<
     JzRHIResourceBarrierPayload,
     JzRHIBlitFramebufferToScreenPayload,
     JzRHIBeginRenderPassPayload,
-    JzRHIEndRenderPassPayload>;
+    JzRHIEndRenderPassPayload,
+    JzRHIGpuZonePayload>;
 
 /**
  * @brief Recorded RHI command with type + payload.
@@ -193,6 +205,16 @@ public:
      */
     void DrawIndexed(const JzDrawIndexedParams &params);
 
+    /**
+     * @brief Buffer Draw Indexed Indirect Command
+     *
+     * Submits params.drawCount draws whose arguments are read from the
+     * indirect buffer, using the currently bound vertex array.
+     *
+     * @param params The parameters of the draw indexed indirect command
+     */
+    void DrawIndexedIndirect(const JzDrawIndexedIndirectParams &params);
+
     /**
      * @brief Buffer Bind Pipeline Command
      *
@@ -222,6 +244,15 @@ public:
      */
     void BindFramebuffer(std::shared_ptr<JzGPUFramebufferObject> framebuffer);
 
+    /**
+     * @brief Buffer Bind Framebuffer Command with explicit load/store ops
+     *
+     * @param framebuffer The framebuffer to bind
+     * @param attachmentOps How the attachments are loaded and stored
+     */
+    void BindFramebuffer(std::shared_ptr<JzGPUFramebufferObject> framebuffer,
+                         const JzRHIAttachmentOps               &attachmentOps);
+
     /**
      * @brief Buffer Set Viewport Command
      *
@@ -283,6 +314,20 @@ public:
      */
     void EndRenderPass(std::shared_ptr<JzRHIRenderPass> renderPass);
 
+    /**
+     * @brief Buffer Begin GPU Zone Command
+     *
+     * Backends with GPU profiling enabled write a timestamp here; zones may nest.
+     *
+     * @param name Zone name shown in profiler captures
+     */
+    void BeginGpuZone(const String &name);
+
+    /**
+     * @brief Buffer End GPU Zone Command
+     */
+    void EndGpuZone();
+
 private:
     template <typename TPayload>
     void AddCommand(JzRHIECommandType type, TPayload &&payload);
@@ -0,0 +1,43 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <memory>
+#include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Platform/Command/JzRHICommand.h"
+#include "JzRE/Runtime/Platform/RHI/JzGPUBufferObject.h"
+
+namespace JzRE {
+
+/**
+ * @brief GPU layout of one indexed indirect draw.
+ *
+ * Matches DrawElementsIndirectCommand (OpenGL), VkDrawIndexedIndirectCommand
+ * (Vulkan) and D3D12_DRAW_INDEXED_ARGUMENTS, so the same buffer contents are
+ * valid for every backend.
+ */
+struct JzDrawIndexedIndirectArgs {
+    U32 indexCount    = 0;
+    U32 instanceCount = 1;
+    U32 firstIndex    = 0;
+    I32 vertexOffset  = 0;
+    U32 firstInstance = 0;
+};
+
+static_assert(sizeof(JzDrawIndexedIndirectArgs) == 20, "Indirect draw arguments must be tightly packed");
+
+/**
+ * @brief Draw indexed indirect parameters
+ */
+struct JzDrawIndexedIndirectParams {
+    JzEPrimitiveType                   primitiveType = JzEPrimitiveType::Triangles;
+    std::shared_ptr<JzGPUBufferObject> indirectBuffer; ///< Buffer of type Indirect holding JzDrawIndexedIndirectArgs
+    Size                               offset    = 0;  ///< Byte offset of the first draw
+    U32                                drawCount = 0;
+    U32                                stride    = sizeof(JzDrawIndexedIndirectArgs);
+};
+
+} // namespace JzRE
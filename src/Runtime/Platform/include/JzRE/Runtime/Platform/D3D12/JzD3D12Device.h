@@ -62,6 +62,9 @@ public:
     void Finish() override;
 
     Bool SupportsMultithreading() const override;
+    Bool SupportsMultiDrawIndirect() const override;
+
+    const JzRHIStats &GetStats() const override;
 
     ID3D12Device              *GetDevice() const;
     ID3D12GraphicsCommandList *GetCommandList() const;
@@ -99,6 +102,8 @@ private:
     void Clear(const JzClearParams &params);
     void Draw(const JzDrawParams &params);
     void DrawIndexed(const JzDrawIndexedParams &params);
+    void DrawIndexedIndirect(const JzDrawIndexedIndirectParams &params);
+    Bool BindIndexedDrawState(JzEPrimitiveType primitiveType);
     void ResourceBarrier(const std::vector<JzRHIResourceBarrier> &barriers);
     void BlitFramebufferToScreen(std::shared_ptr<JzGPUFramebufferObject> framebuffer,
                                  U32 srcWidth, U32 srcHeight,
@@ -114,6 +119,7 @@ private:
 
     JzRHICapabilities m_capabilities;
     JzRHIStats        m_stats;
+    U64               m_lastFrameBeginNs = 0;
 
     Microsoft::WRL::ComPtr<IDXGIFactory6>             m_factory;
     Microsoft::WRL::ComPtr<ID3D12Device>              m_device;
@@ -125,6 +131,8 @@ private:
     Microsoft::WRL::ComPtr<ID3D12Resource>            m_backBuffers[__FRAME_COUNT];
     Microsoft::WRL::ComPtr<ID3D12Resource>            m_depthBuffer;
     Microsoft::WRL::ComPtr<ID3D12Fence>               m_fence;
+    Microsoft::WRL::ComPtr<ID3D12CommandSignature>    m_drawIndexedSignature;
+    UINT                                              m_drawIndexedSignatureStride = 0;
     HANDLE                                            m_fenceEvent = nullptr;
 
     FrameResources m_frames[__FRAME_COUNT];
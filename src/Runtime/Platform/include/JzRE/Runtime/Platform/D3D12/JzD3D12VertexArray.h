@@ -18,10 +18,11 @@ namespace JzRE {
  * @brief D3D12 vertex attribute snapshot.
  */
 struct JzD3D12VertexAttribute {
-    U32 index  = 0;
-    U32 size   = 0;
-    U32 stride = 0;
-    U32 offset = 0;
+    U32 index   = 0;
+    U32 size    = 0;
+    U32 stride  = 0;
+    U32 offset  = 0;
+    U32 divisor = 0;
 };
 
 /**
@@ -35,6 +36,7 @@ public:
     void BindVertexBuffer(std::shared_ptr<JzGPUBufferObject> buffer, U32 binding = 0) override;
     void BindIndexBuffer(std::shared_ptr<JzGPUBufferObject> buffer) override;
     void SetVertexAttribute(U32 index, U32 size, U32 stride, U32 offset) override;
+    void SetVertexAttributeDivisor(U32 index, U32 divisor) override;
 
     const std::unordered_map<U32, std::shared_ptr<JzGPUBufferObject>> &GetVertexBuffers() const;
     const std::shared_ptr<JzGPUBufferObject>                          &GetIndexBuffer() const;
@@ -0,0 +1,139 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include "JzRE/Runtime/Platform/FileSystem/JzIFileWatchBackend.h"
+
+namespace JzRE {
+
+/**
+ * @brief Configuration for the file watcher
+ */
+struct JzFileWatcherConfig {
+    F32  debounceSeconds     = 0.1f;  ///< A path must be quiet this long before its change is delivered
+    F32  pollIntervalSeconds = 0.5f;  ///< Scan interval of the polling fallback
+    Bool forcePolling        = false; ///< Use the polling backend even if the OS has notifications
+};
+
+/**
+ * @brief Handle of a watch subscription, 0 is invalid
+ */
+using JzFileWatchHandle = U64;
+
+/**
+ * @brief Receives the debounced changes under a watched directory
+ */
+using JzFileWatchCallback = std::function<void(const std::vector<JzFileChange> &)>;
+
+/**
+ * @brief Shared file change notification service
+ *
+ * Subscribers watch a directory and get its changes as path keyed
+ * notifications. Raw events come from the OS backend (inotify on Linux) or
+ * from the polling fallback. A burst of events for one path is coalesced into
+ * a single change that is delivered once the path has been quiet for the
+ * debounce time. Callbacks run on the thread that calls Update().
+ */
+class JzFileWatcher {
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param config Watcher configuration
+     */
+    explicit JzFileWatcher(const JzFileWatcherConfig &config = {});
+
+    /**
+     * @brief Constructor with an explicit backend
+     *
+     * @param backend Source of raw change events
+     * @param config Watcher configuration
+     */
+    JzFileWatcher(std::unique_ptr<JzIFileWatchBackend> backend, const JzFileWatcherConfig &config = {});
+
+    /**
+     * @brief Destructor
+     */
+    ~JzFileWatcher();
+
+    JzFileWatcher(const JzFileWatcher &)            = delete;
+    JzFileWatcher &operator=(const JzFileWatcher &) = delete;
+
+    /**
+     * @brief Subscribe to changes under a directory.
+     *
+     * @param directory Directory to watch
+     * @param recursive Whether changes in subdirectories are delivered too
+     * @param callback Receives the changes
+     *
+     * @return JzFileWatchHandle The subscription, 0 if the directory cannot be watched
+     */
+    JzFileWatchHandle Watch(const std::filesystem::path &directory, Bool recursive, JzFileWatchCallback callback);
+
+    /**
+     * @brief Cancel a subscription. Safe to call from a callback.
+     *
+     * @param handle The subscription returned by Watch
+     */
+    void Unwatch(JzFileWatchHandle handle);
+
+    /**
+     * @brief Collect backend events and deliver the changes that have settled.
+     *
+     * @param deltaSeconds Frame delta time in seconds
+     */
+    void Update(F32 deltaSeconds);
+
+    /**
+     * @brief Get the backend name, for logging
+     */
+    const char *GetBackendName() const;
+
+    /**
+     * @brief Make a path absolute and lexically normal, the form used for change paths.
+     *
+     * @param path The path
+     *
+     * @return std::filesystem::path The normalized path
+     */
+    static std::filesystem::path NormalizePath(const std::filesystem::path &path);
+
+private:
+    struct JzSubscription {
+        std::filesystem::path directory;
+        Bool                  recursive = false;
+        JzFileWatchCallback   callback;
+    };
+
+    struct JzWatchedDirectory {
+        U32  refCount  = 0;
+        Bool recursive = false;
+    };
+
+    struct JzPendingChange {
+        JzEFileChangeKind     kind;
+        F32                   quietSeconds = 0.0f;
+        std::filesystem::path previousPath;
+    };
+
+    void        Coalesce(const JzFileChange &change);
+    void        Deliver(std::vector<JzFileChange> &changes);
+    static Bool Covers(const JzSubscription &subscription, const std::filesystem::path &path);
+
+private:
+    JzFileWatcherConfig                                   m_config;
+    std::unique_ptr<JzIFileWatchBackend>                  m_backend;
+    std::unordered_map<JzFileWatchHandle, JzSubscription> m_subscriptions;
+    std::unordered_map<String, JzWatchedDirectory>        m_directories;
+    std::unordered_map<String, JzPendingChange>           m_pending; ///< Keyed by path, waiting for the debounce time
+    std::vector<JzFileChange>                             m_rawChanges;
+    JzFileWatchHandle                                     m_nextHandle = 1;
+};
+
+} // namespace JzRE
@@ -0,0 +1,90 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <vector>
+#include "JzRE/Runtime/Core/JzRETypes.h"
+
+namespace JzRE {
+
+/**
+ * @brief Enums of file change kinds
+ */
+enum class JzEFileChangeKind : U8 {
+    Added,
+    Modified,
+    Removed,
+    Renamed, ///< A directory moved within the watched tree, from previousPath to path
+    Rescan   ///< Events were lost; everything under the path may have changed
+};
+
+/**
+ * @brief A single change reported for a path
+ */
+struct JzFileChange {
+    std::filesystem::path path; ///< Absolute, lexically normalized path
+    JzEFileChangeKind     kind = JzEFileChangeKind::Modified;
+    std::filesystem::path previousPath; ///< Old path of a Renamed change, empty otherwise
+};
+
+/**
+ * @brief OS specific source of raw file change events
+ *
+ * Backends only report what they see; debouncing, coalescing and routing to
+ * subscribers is done by JzFileWatcher. All calls come from the thread that
+ * updates the watcher.
+ */
+class JzIFileWatchBackend {
+public:
+    /**
+     * @brief Destructor
+     */
+    virtual ~JzIFileWatchBackend() = default;
+
+    /**
+     * @brief Start watching a directory. Watching it again with recursive = true widens the watch.
+     *
+     * @param directory Absolute, normalized directory path
+     * @param recursive Whether subdirectories are watched as well
+     *
+     * @return Bool True if the directory is being watched
+     */
+    virtual Bool AddDirectory(const std::filesystem::path &directory, Bool recursive) = 0;
+
+    /**
+     * @brief Stop watching a directory previously passed to AddDirectory.
+     *
+     * @param directory Absolute, normalized directory path
+     */
+    virtual void RemoveDirectory(const std::filesystem::path &directory) = 0;
+
+    /**
+     * @brief Append the changes observed since the last call. Never blocks.
+     *
+     * @param deltaSeconds Time since the last call
+     * @param outChanges Receives the raw changes
+     */
+    virtual void Poll(F32 deltaSeconds, std::vector<JzFileChange> &outChanges) = 0;
+
+    /**
+     * @brief Get the backend name, for logging
+     */
+    virtual const char *GetName() const = 0;
+
+    /**
+     * @brief Create the OS notification backend.
+     *
+     * Only Linux has one (inotify, src/Linux/); elsewhere this returns nullptr
+     * and JzFileWatcher polls.
+     *
+     * @return The backend, or nullptr if the platform has none
+     */
+    static std::unique_ptr<JzIFileWatchBackend> CreateNative();
+};
+
+} // namespace JzRE
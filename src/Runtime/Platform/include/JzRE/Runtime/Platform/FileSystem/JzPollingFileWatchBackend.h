@@ -0,0 +1,55 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include "JzRE/Runtime/Platform/FileSystem/JzIFileWatchBackend.h"
+
+namespace JzRE {
+
+/**
+ * @brief Fallback backend that rescans the watched directories on an interval
+ *
+ * Keeps a size and modification time snapshot per file and reports the
+ * difference after each scan. Used where no OS notification backend exists.
+ */
+class JzPollingFileWatchBackend : public JzIFileWatchBackend {
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param intervalSeconds Time between scans
+     */
+    explicit JzPollingFileWatchBackend(F32 intervalSeconds = 0.5f);
+
+    Bool        AddDirectory(const std::filesystem::path &directory, Bool recursive) override;
+    void        RemoveDirectory(const std::filesystem::path &directory) override;
+    void        Poll(F32 deltaSeconds, std::vector<JzFileChange> &outChanges) override;
+    const char *GetName() const override;
+
+private:
+    struct JzFileStamp {
+        std::filesystem::file_time_type writeTime;
+        std::uintmax_t                  size = 0;
+    };
+
+    using JzSnapshot = std::unordered_map<String, JzFileStamp>;
+
+    struct JzWatchedDirectory {
+        Bool       recursive = false;
+        JzSnapshot snapshot;
+    };
+
+    static JzSnapshot Scan(const std::filesystem::path &directory, Bool recursive);
+
+private:
+    F32                                            m_interval;
+    F32                                            m_timeSinceScan = 0.0f;
+    std::unordered_map<String, JzWatchedDirectory> m_directories;
+};
+
+} // namespace JzRE
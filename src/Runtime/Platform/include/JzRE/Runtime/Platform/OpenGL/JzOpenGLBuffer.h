@@ -51,6 +51,12 @@ public:
      */
     GLuint GetHandle() const;
 
+private:
+    /**
+     * @brief Unbind the current VAO before touching an index buffer binding
+     */
+    void DetachVertexArray() const;
+
 private:
     GLuint m_handle = 0;
     GLenum m_target;
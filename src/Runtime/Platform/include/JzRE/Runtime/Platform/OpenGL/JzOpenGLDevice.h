@@ -5,11 +5,15 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "JzRE/Runtime/Core/JzRETypes.h"
 #include "JzRE/Runtime/Platform/OpenGL/JzOpenGLFramebuffer.h"
+#include "JzRE/Runtime/Platform/OpenGL/JzOpenGLGpuTimer.h"
 #include "JzRE/Runtime/Platform/OpenGL/JzOpenGLPipeline.h"
+#include "JzRE/Runtime/Platform/OpenGL/JzOpenGLProgramCache.h"
+#include "JzRE/Runtime/Platform/OpenGL/JzOpenGLStateCache.h"
 #include "JzRE/Runtime/Platform/OpenGL/JzOpenGLVertexArray.h"
 #include "JzRE/Runtime/Platform/RHI/JzDevice.h"
 #include "JzRE/Runtime/Platform/RHI/JzRHICapabilities.h"
@@ -37,6 +41,8 @@ public:
     std::shared_ptr<JzGPUVertexArrayObject>   CreateVertexArray(const String &debugName = "") override;
     std::shared_ptr<JzRHICommandList>         CreateCommandList(const String &debugName = "") override;
 
+    void SetPipelineCacheDirectory(const std::filesystem::path &directory) override;
+
     void ExecuteCommandList(std::shared_ptr<JzRHICommandList> commandList) override;
     void ExecuteCommandLists(const std::vector<std::shared_ptr<JzRHICommandList>> &commandLists) override;
 
@@ -46,6 +52,14 @@ public:
     void Flush() override;
     void Finish() override;
     Bool SupportsMultithreading() const override;
+    Bool SupportsMultiDrawIndirect() const override;
+    Bool SupportsTextureFormat(JzETextureResourceFormat format) const override;
+    Bool SupportsMipmapGeneration() const override;
+
+    const JzRHIStats &GetStats() const override;
+
+    void                      SetGpuProfilingEnabled(Bool enabled) override;
+    std::vector<JzRHIGpuZone> ConsumeGpuZones() override;
 
     /**
      * @brief Get device capabilities.
@@ -53,12 +67,16 @@ public:
     const JzRHICapabilities &GetCapabilities() const;
 
     /**
-     * @brief Get frame statistics.
+     * @brief Drop the shadow GL state.
+     *
+     * Call this after GL state was changed by code outside the device
+     * (e.g. a third-party renderer that does not restore its state).
      */
-    JzRHIStats &GetStats();
+    void InvalidateStateCache();
 
 private:
     void InitializeCapabilities();
+    Bool HasExtension(const char *name) const;
     void CheckOpenGLError(const String &operation) const;
 
     void DispatchCommand(const JzRHIRecordedCommand &command);
@@ -69,6 +87,7 @@ private:
     void Clear(const JzClearParams &params);
     void Draw(const JzDrawParams &params);
     void DrawIndexed(const JzDrawIndexedParams &params);
+    void DrawIndexedIndirect(const JzDrawIndexedIndirectParams &params);
     void BindPipeline(std::shared_ptr<JzRHIPipeline> pipeline);
     void BindVertexArray(std::shared_ptr<JzGPUVertexArrayObject> vertexArray);
     void BindTexture(std::shared_ptr<JzGPUTextureObject> texture, U32 slot);
@@ -89,12 +108,16 @@ private:
     static GLenum ConvertCullMode(JzECullMode mode);
 
 private:
-    JzRHICapabilities                    m_capabilities;
-    JzRHIStats                           m_stats;
-    JzRenderState                        m_currentRenderState;
-    std::shared_ptr<JzOpenGLPipeline>    m_currentPipeline;
-    std::shared_ptr<JzOpenGLVertexArray> m_currentVertexArray;
-    std::shared_ptr<JzOpenGLFramebuffer> m_currentFramebuffer;
+    JzRHICapabilities                     m_capabilities;
+    JzRHIStats                            m_stats;
+    JzOpenGLStateCache                    m_stateCache;
+    std::unique_ptr<JzOpenGLProgramCache> m_programCache;
+    std::unique_ptr<JzOpenGLGpuTimer>     m_gpuTimer;
+    U64                                   m_lastFrameBeginNs = 0;
+    JzRenderState                         m_currentRenderState;
+    std::shared_ptr<JzOpenGLPipeline>     m_currentPipeline;
+    std::shared_ptr<JzOpenGLVertexArray>  m_currentVertexArray;
+    std::shared_ptr<JzOpenGLFramebuffer>  m_currentFramebuffer;
 };
 
 } // namespace JzRE
@@ -0,0 +1,86 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <glad/glad.h>
+#include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Platform/RHI/JzRHIGpuZone.h"
+
+namespace JzRE {
+
+/**
+ * @brief GPU zone timer based on GL_TIMESTAMP queries (glQueryCounter).
+ *
+ * Queries of a frame are read back FrameLatency frames later, when they are
+ * normally available; zones whose results are still pending are dropped
+ * rather than stalling the pipeline. GPU times are mapped to the profiler
+ * clock with a glGetInteger64v(GL_TIMESTAMP) calibration taken every frame.
+ */
+class JzOpenGLGpuTimer {
+public:
+    static constexpr U32 FrameLatency = 4;
+
+    JzOpenGLGpuTimer() = default;
+    ~JzOpenGLGpuTimer();
+
+    JzOpenGLGpuTimer(const JzOpenGLGpuTimer &)            = delete;
+    JzOpenGLGpuTimer &operator=(const JzOpenGLGpuTimer &) = delete;
+
+    /**
+     * @brief Resolve the oldest frame and start recording a new one.
+     */
+    void BeginFrame();
+
+    /**
+     * @brief Write the begin timestamp of a zone.
+     */
+    void BeginZone(const String &name);
+
+    /**
+     * @brief Write the end timestamp of the innermost open zone.
+     */
+    void EndZone();
+
+    /**
+     * @brief Take resolved zones.
+     */
+    std::vector<JzRHIGpuZone> Consume();
+
+    /**
+     * @brief GPU span of the most recently resolved frame in milliseconds.
+     */
+    F32 GetLastFrameGpuTime() const
+    {
+        return m_lastFrameGpuTime;
+    }
+
+private:
+    struct JzZone {
+        String name;
+        GLuint beginQuery = 0;
+        GLuint endQuery   = 0;
+    };
+
+    struct JzFrame {
+        std::vector<JzZone> zones;
+        I64                 calibrationOffsetNs = 0; ///< cpuNs - gpuNs
+    };
+
+    GLuint AcquireQuery();
+    void   ResolveFrame(JzFrame &frame);
+
+private:
+    std::array<JzFrame, FrameLatency> m_frames;
+    U32                               m_frameSlot = 0;
+    std::vector<Size>                 m_openZones;
+    std::vector<GLuint>               m_freeQueries;
+    std::vector<JzRHIGpuZone>         m_resolved;
+    F32                               m_lastFrameGpuTime = 0.0f;
+};
+
+} // namespace JzRE
@@ -13,6 +13,9 @@
 #include "JzRE/Runtime/Platform/OpenGL/JzOpenGLShader.h"
 
 namespace JzRE {
+
+class JzOpenGLProgramCache;
+
 /**
  * @brief OpenGL Implementation of RHI Pipeline
  */
@@ -22,8 +25,11 @@ public:
      * @brief Constructor
      *
      * @param desc The description of the pipeline
+     * @param programCache Optional program binary cache, used when desc.cacheKey is set
+     * @param parallelCompile Submit compile/link without waiting (GL_KHR_parallel_shader_compile)
      */
-    JzOpenGLPipeline(const JzPipelineDesc &desc);
+    JzOpenGLPipeline(const JzPipelineDesc &desc, const JzOpenGLProgramCache *programCache = nullptr,
+                     Bool parallelCompile = false);
 
     /**
      * @brief Destructor
@@ -40,9 +46,28 @@ public:
     /**
      * @brief Check if the pipeline is linked
      *
+     * Waits for a pending parallel link to finish.
+     *
      * @return True if the pipeline is linked, false otherwise
      */
-    Bool IsLinked() const;
+    Bool IsLinked();
+
+    /**
+     * @brief Check if the pipeline is loaded from the program binary cache
+     */
+    Bool IsLoadedFromCache() const;
+
+    /**
+     * @brief Poll a pending parallel link without blocking.
+     *
+     * @return True once the link finished (successfully or not)
+     */
+    Bool IsReady() override;
+
+    /**
+     * @brief Whether the finished link failed.
+     */
+    Bool HasFailed() override;
 
     /**
      * @brief Get the link log
@@ -53,6 +78,9 @@ public:
 
     /**
      * @brief Upload cached parameters to OpenGL uniforms.
+     *
+     * @note The program must already be bound; JzOpenGLDevice does this
+     *       when binding the pipeline, so no extra glUseProgram is issued.
      */
     void CommitParameters() override;
 
@@ -63,6 +91,12 @@ private:
      */
     Bool LinkProgram();
 
+    /**
+     * @brief Collect the link result and store the program binary on success
+     * @return True if the program is linked, false otherwise
+     */
+    Bool FinalizeLink();
+
     /**
      * @brief Get the uniform location
      * @param name The name of the uniform
@@ -76,8 +110,11 @@ private:
     void BuildUniformAliasMap();
 
 private:
-    GLuint                                       m_program  = 0;
-    Bool                                         m_isLinked = false;
+    const JzOpenGLProgramCache                  *m_programCache    = nullptr;
+    GLuint                                       m_program         = 0;
+    Bool                                         m_isLinked        = false;
+    Bool                                         m_linkPending     = false;
+    Bool                                         m_loadedFromCache = false;
     String                                       m_linkLog;
     std::vector<std::shared_ptr<JzOpenGLShader>> m_shaders;
     std::unordered_map<String, GLint>            m_uniformLocations;
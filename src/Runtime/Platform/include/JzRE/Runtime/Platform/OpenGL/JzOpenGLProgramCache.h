@@ -0,0 +1,93 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <vector>
+#include <glad/glad.h>
+#include "JzRE/Runtime/Core/JzRETypes.h"
+
+namespace JzRE {
+
+/**
+ * @brief Linked program binary as returned by glGetProgramBinary.
+ */
+struct JzOpenGLProgramBinary {
+    GLenum            format = 0;
+    std::vector<char> data;
+};
+
+/**
+ * @brief On-disk cache of linked OpenGL program binaries.
+ *
+ * Entries are keyed by a pipeline cache key (shader source hash + keyword mask)
+ * combined with the GL vendor/renderer/version strings, because program
+ * binaries are only valid for the driver that produced them. A rejected
+ * binary is removed so that the caller can fall back to a full compile.
+ */
+class JzOpenGLProgramCache {
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param directory Directory that stores the binaries.
+     * @param driverIdentity GL vendor/renderer/version string of the current context.
+     */
+    JzOpenGLProgramCache(std::filesystem::path directory, String driverIdentity);
+
+    /**
+     * @brief Try to load a cached binary into a program object.
+     *
+     * @param cacheKey Pipeline cache key.
+     * @param program Program object that receives the binary.
+     *
+     * @return True if the binary was accepted and the program is linked.
+     */
+    Bool Load(const String &cacheKey, GLuint program) const;
+
+    /**
+     * @brief Store the binary of a linked program.
+     *
+     * @param cacheKey Pipeline cache key.
+     * @param program Linked program created with GL_PROGRAM_BINARY_RETRIEVABLE_HINT.
+     */
+    void Store(const String &cacheKey, GLuint program) const;
+
+    /**
+     * @brief Read the entry of a key if it was written for the current driver.
+     *
+     * @return False if the entry is missing, truncated or from another driver.
+     */
+    Bool ReadBinary(const String &cacheKey, JzOpenGLProgramBinary &outBinary) const;
+
+    /**
+     * @brief Write the entry of a key, replacing any previous one atomically.
+     */
+    Bool WriteBinary(const String &cacheKey, const JzOpenGLProgramBinary &binary) const;
+
+    /**
+     * @brief Remove the entry of a key.
+     */
+    void Remove(const String &cacheKey) const;
+
+    /**
+     * @brief Get the cache directory.
+     */
+    const std::filesystem::path &GetDirectory() const
+    {
+        return m_directory;
+    }
+
+private:
+    std::filesystem::path GetEntryPath(const String &cacheKey) const;
+
+private:
+    std::filesystem::path m_directory;
+    String                m_driverIdentity;
+    U64                   m_driverHash = 0;
+};
+
+} // namespace JzRE
@@ -18,8 +18,9 @@ public:
     /**
      * @brief Constructor
      * @param desc The description of the shader
+     * @param deferStatusCheck Skip the blocking compile status query, see ResolveCompileStatus()
      */
-    JzOpenGLShader(const JzShaderProgramDesc &desc);
+    JzOpenGLShader(const JzShaderProgramDesc &desc, Bool deferStatusCheck = false);
 
     /**
      * @brief Destructor
@@ -44,6 +45,16 @@ public:
      */
     const String &GetCompileLog() const;
 
+    /**
+     * @brief Query the compile status of a shader created with deferStatusCheck.
+     *
+     * Until this is called IsCompiled() only reports that the source was
+     * submitted. Blocks if the driver is still compiling.
+     *
+     * @return True if the shader is compiled, false otherwise
+     */
+    Bool ResolveCompileStatus();
+
 private:
     /**
      * @brief Convert shader type to OpenGL shader type
@@ -56,11 +67,12 @@ private:
      * @brief Compile the shader
      * @return True if the shader is compiled, false otherwise
      */
-    Bool CompileShader();
+    Bool CompileShader(Bool deferStatusCheck);
 
 private:
-    GLuint m_handle     = 0;
-    Bool   m_isCompiled = false;
+    GLuint m_handle        = 0;
+    Bool   m_isCompiled    = false;
+    Bool   m_statusPending = false;
     String m_compileLog;
 };
 } // namespace JzRE
\ No newline at end of file
@@ -0,0 +1,165 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <array>
+#include <glad/glad.h>
+#include "JzRE/Runtime/Core/JzRETypes.h"
+
+namespace JzRE {
+
+/**
+ * @brief Shadow copy of OpenGL context state used to elide redundant calls.
+ *
+ * Every setter compares the requested value against the last value the
+ * backend issued and returns true only if the GL call is actually needed.
+ * The cache itself never touches GL, so the caller issues the call when a
+ * setter returns true. Invalidated entries always report a change, which is
+ * how code that binds objects outside the device resynchronizes.
+ */
+class JzOpenGLStateCache {
+public:
+    /**
+     * @brief Maximum number of texture units tracked by the cache.
+     */
+    static constexpr U32 kMaxTextureUnits = 32;
+
+    /**
+     * @brief Forget all cached state. The next setter of every kind issues.
+     */
+    void Invalidate();
+
+    /**
+     * @brief Forget the bindings that resource objects change while uploading.
+     *
+     * Textures bind to the active unit and vertex arrays bind themselves when
+     * they are created or updated, and GL hands the names of deleted textures
+     * to new ones. Every unit's texture entry and the vertex array entry are
+     * therefore stale after any resource work done outside the device.
+     */
+    void InvalidateResourceBindings();
+
+    // Each setter records the value and returns true if the GL call must be issued.
+
+    Bool SetProgram(GLuint program);
+    Bool SetVertexArray(GLuint vertexArray);
+    Bool SetFramebuffer(GLuint framebuffer);
+    Bool SetActiveTextureUnit(U32 unit);
+    Bool SetTexture(U32 unit, GLenum target, GLuint texture);
+
+    Bool SetDepthTestEnabled(Bool enabled);
+    Bool SetDepthFunc(GLenum func);
+    Bool SetDepthMask(Bool writeEnabled);
+    Bool SetCullFaceEnabled(Bool enabled);
+    Bool SetCullFace(GLenum face);
+    Bool SetBlendEnabled(Bool enabled);
+    Bool SetBlendFunc(GLenum srcFactor, GLenum dstFactor);
+    Bool SetPolygonMode(GLenum mode);
+    Bool SetScissorTestEnabled(Bool enabled);
+    Bool SetScissor(I32 x, I32 y, U32 width, U32 height);
+    Bool SetViewport(I32 x, I32 y, I32 width, I32 height);
+    Bool SetDepthRange(F32 nearValue, F32 farValue);
+
+    /**
+     * @brief Number of GL state calls issued since the last ResetCounters().
+     */
+    U32 GetIssuedCount() const
+    {
+        return m_issued;
+    }
+
+    /**
+     * @brief Number of GL state calls skipped since the last ResetCounters().
+     */
+    U32 GetSkippedCount() const
+    {
+        return m_skipped;
+    }
+
+    /**
+     * @brief Reset issued/skipped counters (typically once per frame).
+     */
+    void ResetCounters()
+    {
+        m_issued  = 0;
+        m_skipped = 0;
+    }
+
+private:
+    template <typename T>
+    struct JzCachedValue {
+        T    value{};
+        Bool valid = false;
+    };
+
+    template <typename T>
+    Bool Update(JzCachedValue<T> &cached, const T &value)
+    {
+        if (cached.valid && cached.value == value) {
+            ++m_skipped;
+            return false;
+        }
+        cached.value = value;
+        cached.valid = true;
+        ++m_issued;
+        return true;
+    }
+
+    struct JzTextureBinding {
+        GLenum target  = 0;
+        GLuint texture = 0;
+
+        Bool operator==(const JzTextureBinding &other) const = default;
+    };
+
+    struct JzRect {
+        I32 x      = 0;
+        I32 y      = 0;
+        I32 width  = 0;
+        I32 height = 0;
+
+        Bool operator==(const JzRect &other) const = default;
+    };
+
+    struct JzBlendFunc {
+        GLenum src = 0;
+        GLenum dst = 0;
+
+        Bool operator==(const JzBlendFunc &other) const = default;
+    };
+
+    struct JzDepthRange {
+        F32 nearValue = 0.0f;
+        F32 farValue  = 1.0f;
+
+        Bool operator==(const JzDepthRange &other) const = default;
+    };
+
+private:
+    JzCachedValue<GLuint>                                         m_program;
+    JzCachedValue<GLuint>                                         m_vertexArray;
+    JzCachedValue<GLuint>                                         m_framebuffer;
+    JzCachedValue<U32>                                            m_activeTextureUnit;
+    std::array<JzCachedValue<JzTextureBinding>, kMaxTextureUnits> m_textures;
+
+    JzCachedValue<Bool>         m_depthTest;
+    JzCachedValue<GLenum>       m_depthFunc;
+    JzCachedValue<Bool>         m_depthMask;
+    JzCachedValue<Bool>         m_cullFace;
+    JzCachedValue<GLenum>       m_cullFaceMode;
+    JzCachedValue<Bool>         m_blend;
+    JzCachedValue<JzBlendFunc>  m_blendFunc;
+    JzCachedValue<GLenum>       m_polygonMode;
+    JzCachedValue<Bool>         m_scissorTest;
+    JzCachedValue<JzRect>       m_scissor;
+    JzCachedValue<JzRect>       m_viewport;
+    JzCachedValue<JzDepthRange> m_depthRange;
+
+    U32 m_issued  = 0;
+    U32 m_skipped = 0;
+};
+
+} // namespace JzRE
@@ -110,6 +110,7 @@ private:
     GLenum m_internalFormat;
     GLenum m_format;
     GLenum m_type;
+    Bool   m_compressed = false;
 };
 
 } // namespace JzRE
\ No newline at end of file
@@ -51,6 +51,13 @@ public:
      */
     void SetVertexAttribute(U32 index, U32 size, U32 stride, U32 offset) override;
 
+    /**
+     * @brief Set the instance step rate of a vertex attribute
+     * @param index The index of the vertex attribute
+     * @param divisor 0 for per-vertex data, N to advance once every N instances
+     */
+    void SetVertexAttributeDivisor(U32 index, U32 divisor) override;
+
     /**
      * @brief Get the handle of the vertex array
      * @return The handle of the vertex array
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <filesystem>
 #include <memory>
 #include <vector>
 
@@ -15,7 +16,9 @@
 #include "JzRE/Runtime/Platform/RHI/JzGPUShaderProgramObject.h"
 #include "JzRE/Runtime/Platform/RHI/JzGPUTextureObject.h"
 #include "JzRE/Runtime/Platform/RHI/JzGPUVertexArrayObject.h"
+#include "JzRE/Runtime/Platform/RHI/JzRHIGpuZone.h"
 #include "JzRE/Runtime/Platform/RHI/JzRHIPipeline.h"
+#include "JzRE/Runtime/Platform/RHI/JzRHIStats.h"
 
 namespace JzRE {
 
@@ -101,6 +104,20 @@ public:
      */
     virtual std::shared_ptr<JzRHIPipeline> CreatePipeline(const JzPipelineDesc &desc) = 0;
 
+    /**
+     * @brief Set the directory of the on-disk pipeline cache.
+     *
+     * Pipelines created afterwards with a non-empty JzPipelineDesc::cacheKey
+     * may be loaded from and stored to this directory. Backends without a
+     * pipeline cache ignore the call.
+     *
+     * @param directory Cache directory, created if missing.
+     */
+    virtual void SetPipelineCacheDirectory(const std::filesystem::path &directory)
+    {
+        (void)directory;
+    }
+
     /**
      * @brief Create a framebuffer object.
      */
@@ -151,6 +168,64 @@ public:
      */
     virtual Bool SupportsMultithreading() const = 0;
 
+    /**
+     * @brief Whether DrawIndexedIndirect submits many draws in one call.
+     *
+     * Backends return false when indirect draws have to be replayed one by one.
+     */
+    virtual Bool SupportsMultiDrawIndirect() const = 0;
+
+    /**
+     * @brief Whether textures of the given format can be created and sampled.
+     *
+     * Block-compressed formats depend on the driver; loaders fall back to
+     * uncompressed data when this returns false.
+     */
+    virtual Bool SupportsTextureFormat(JzETextureResourceFormat format) const
+    {
+        return !IsCompressedTextureFormat(format);
+    }
+
+    /**
+     * @brief Whether GenerateMipmaps() fills the mip chain of uncompressed textures.
+     *
+     * Loaders only request a full chain for images without cooked mips when
+     * this returns true; otherwise the extra levels would stay undefined.
+     */
+    virtual Bool SupportsMipmapGeneration() const
+    {
+        return false;
+    }
+
+    /**
+     * @brief Statistics of the current frame.
+     *
+     * frameTime is the CPU time between the last two BeginFrame() calls and
+     * gpuTime the span of the latest resolved GPU zones, both in milliseconds.
+     */
+    virtual const JzRHIStats &GetStats() const = 0;
+
+    /**
+     * @brief Enable timestamp queries for BeginGpuZone/EndGpuZone commands.
+     *
+     * Backends without GPU timers ignore the call.
+     */
+    virtual void SetGpuProfilingEnabled(Bool enabled)
+    {
+        (void)enabled;
+    }
+
+    /**
+     * @brief Take the GPU zones resolved since the last call.
+     *
+     * Results are read back a few frames after submission so that the CPU
+     * never waits for the GPU.
+     */
+    virtual std::vector<JzRHIGpuZone> ConsumeGpuZones()
+    {
+        return {};
+    }
+
 protected:
     JzERHIType rhiType;
 };
@@ -17,7 +17,8 @@ enum class JzEGPUBufferObjectType : U8 {
     Vertex,
     Index,
     Uniform,
-    Storage
+    Storage,
+    Indirect
 };
 
 /**
@@ -11,6 +11,37 @@
 
 namespace JzRE {
 
+/**
+ * @brief What happens to an attachment's contents when a pass starts
+ */
+enum class JzERHILoadOp : U8 {
+    Load,
+    Clear,
+    DontCare,
+};
+
+/**
+ * @brief Whether an attachment's contents are written back when a pass ends
+ */
+enum class JzERHIStoreOp : U8 {
+    Store,
+    DontCare,
+};
+
+/**
+ * @brief Load and store behaviour of the attachments of a framebuffer bind.
+ *
+ * Backends with explicit render passes turn these into attachment load/store
+ * ops, which lets tile-based GPUs skip reading or writing back whole targets.
+ * Clear values come from the first Clear command recorded after the bind.
+ */
+struct JzRHIAttachmentOps {
+    JzERHILoadOp  colorLoad  = JzERHILoadOp::Load;
+    JzERHIStoreOp colorStore = JzERHIStoreOp::Store;
+    JzERHILoadOp  depthLoad  = JzERHILoadOp::Load;
+    JzERHIStoreOp depthStore = JzERHIStoreOp::Store;
+};
+
 /**
  * @brief Interface of GPU Framebuffer Object
  */
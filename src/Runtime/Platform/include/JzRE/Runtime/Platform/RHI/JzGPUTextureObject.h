@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "JzRE/Runtime/Core/JzRETypes.h"
 #include "JzRE/Runtime/Platform/RHI/JzGPUResource.h"
 
@@ -41,9 +43,44 @@ enum class JzETextureResourceFormat : U8 {
     Depth16,
     Depth24,
     Depth32F,
-    Depth24Stencil8
+    Depth24Stencil8,
+    BC1,       ///< RGB + 1-bit alpha, 8 bytes per 4x4 block
+    BC3,       ///< RGBA, 16 bytes per 4x4 block
+    BC4,       ///< R, 8 bytes per 4x4 block
+    BC5,       ///< RG, 16 bytes per 4x4 block
+    BC7,       ///< RGBA, 16 bytes per 4x4 block
+    ETC2RGB8,  ///< RGB, 8 bytes per 4x4 block
+    ETC2RGBA8, ///< RGBA, 16 bytes per 4x4 block
+    ASTC4x4    ///< RGBA, 16 bytes per 4x4 block
 };
 
+/**
+ * @brief Whether the format stores 4x4 texel blocks instead of single texels
+ */
+Bool IsCompressedTextureFormat(JzETextureResourceFormat format);
+
+/**
+ * @brief Bytes of one 4x4 block for compressed formats, or of one texel otherwise
+ *
+ * @return 0 for Unknown
+ */
+U32 GetTextureFormatBlockSize(JzETextureResourceFormat format);
+
+/**
+ * @brief Bytes of one mip level of a 2D image
+ */
+Size GetTextureLevelSize(JzETextureResourceFormat format, U32 width, U32 height, U32 mipLevel = 0);
+
+/**
+ * @brief Number of levels of a full mip chain down to 1x1
+ */
+U32 GetTextureMipCount(U32 width, U32 height);
+
+/**
+ * @brief Width or height of a mip level, never below 1
+ */
+U32 GetTextureLevelExtent(U32 extent, U32 mipLevel);
+
 /**
  * @brief Enums of texture resource filters
  */
@@ -66,26 +103,66 @@ enum class JzETextureResourceWrap : U8 {
     ClampToBorder
 };
 
+/**
+ * @brief Pre-built data of one mip level
+ */
+struct JzGPUTextureMipData {
+    const void *data = nullptr;
+    Size        size = 0;
+};
+
+/**
+ * @brief Place of one mip level in a staging buffer holding several levels
+ */
+struct JzGPUTextureUploadRegion {
+    Size offset   = 0; ///< Byte offset in the staging buffer
+    U32  mipLevel = 0;
+    U32  width    = 1;
+    U32  height   = 1;
+};
+
+/**
+ * @brief Lay out consecutive levels, starting at firstMip, in one staging buffer
+ *
+ * Every offset is a multiple of 16 and of the format's block size, as buffer
+ * to image copies require.
+ *
+ * @return Bytes of the staging buffer
+ */
+Size GetTextureUploadRegions(JzETextureResourceFormat format, U32 width, U32 height, U32 firstMip,
+                             const std::vector<JzGPUTextureMipData> &levels,
+                             std::vector<JzGPUTextureUploadRegion>  &outRegions);
+
 /**
  * @brief GPU texture object description
+ *
+ * When mipData is set, it supplies every level from 0 up to mipLevels and
+ * data is ignored. Block-compressed formats need mipData or data because
+ * their mips cannot be generated on the GPU.
  */
 struct JzGPUTextureObjectDesc {
-    JzETextureResourceType   type      = JzETextureResourceType::Texture2D;
-    JzETextureResourceFormat format    = JzETextureResourceFormat::RGBA8;
-    U32                      width     = 1;
-    U32                      height    = 1;
-    U32                      depth     = 1;
-    U32                      mipLevels = 1;
-    U32                      arraySize = 1;
-    JzETextureResourceFilter minFilter = JzETextureResourceFilter::Linear;
-    JzETextureResourceFilter magFilter = JzETextureResourceFilter::Linear;
-    JzETextureResourceWrap   wrapS     = JzETextureResourceWrap::Repeat;
-    JzETextureResourceWrap   wrapT     = JzETextureResourceWrap::Repeat;
-    JzETextureResourceWrap   wrapR     = JzETextureResourceWrap::Repeat;
-    const void              *data      = nullptr;
-    String                   debugName;
+    JzETextureResourceType           type      = JzETextureResourceType::Texture2D;
+    JzETextureResourceFormat         format    = JzETextureResourceFormat::RGBA8;
+    U32                              width     = 1;
+    U32                              height    = 1;
+    U32                              depth     = 1;
+    U32                              mipLevels = 1;
+    U32                              arraySize = 1;
+    JzETextureResourceFilter         minFilter = JzETextureResourceFilter::Linear;
+    JzETextureResourceFilter         magFilter = JzETextureResourceFilter::Linear;
+    JzETextureResourceWrap           wrapS     = JzETextureResourceWrap::Repeat;
+    JzETextureResourceWrap           wrapT     = JzETextureResourceWrap::Repeat;
+    JzETextureResourceWrap           wrapR     = JzETextureResourceWrap::Repeat;
+    const void                      *data      = nullptr;
+    std::vector<JzGPUTextureMipData> mipData;
+    String                           debugName;
 };
 
+/**
+ * @brief Bytes of GPU memory taken by every level, layer and slice of a texture
+ */
+Size GetTextureMemorySize(const JzGPUTextureObjectDesc &desc);
+
 /**
  * @brief Interface of GPU texture object, to store and sample image data
  */
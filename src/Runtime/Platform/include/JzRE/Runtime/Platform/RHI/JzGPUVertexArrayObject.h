@@ -53,6 +53,14 @@ public:
      * @param offset The offset of the attribute
      */
     virtual void SetVertexAttribute(U32 index, U32 size, U32 stride, U32 offset) = 0;
+
+    /**
+     * @brief Set the instance step rate of a vertex attribute
+     *
+     * @param index The index of the attribute
+     * @param divisor 0 for per-vertex data, N to advance once every N instances
+     */
+    virtual void SetVertexAttributeDivisor(U32 index, U32 divisor) = 0;
 };
 
 } // namespace JzRE
\ No newline at end of file
@@ -67,6 +67,13 @@ public:
      */
     void MakeCurrentContext(U32 threadIndex = 0);
 
+    /**
+     * @brief Release the window context from the calling thread.
+     *
+     * Required before another thread can make an OpenGL context current.
+     */
+    void ReleaseCurrentContext();
+
     /**
      * @brief Begin a frame on the device.
      */
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Platform/RHI/JzGPUTextureObject.h"
 
 namespace JzRE {
 /**
@@ -31,5 +32,16 @@ struct JzRHICapabilities {
     Bool supportsTessellationShaders    = false;     // Tessellation Shader Support
     Bool supportsMultithreadedRendering = false;     // Multithreaded Rendering Support
     U32  maxRenderThreads               = 1;         //
+    Bool supportsProgramBinary          = false;     // Pipeline Cache Support
+    Bool supportsParallelShaderCompile  = false;     //
+    Bool supportsMultiDrawIndirect      = false;     // Indirect Draw Support
+    Bool supportsTextureCompressionBC   = false;     // Compressed Texture Support (BC1-BC7)
+    Bool supportsTextureCompressionETC2 = false;     //
+    Bool supportsTextureCompressionASTC = false;     //
+
+    /**
+     * @brief Whether the format is uncompressed or its compression family is supported
+     */
+    Bool SupportsTextureFormat(JzETextureResourceFormat format) const;
 };
 } // namespace JzRE
\ No newline at end of file
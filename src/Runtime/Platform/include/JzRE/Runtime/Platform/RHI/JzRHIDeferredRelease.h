@@ -0,0 +1,76 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "JzRE/Runtime/Core/JzRETypes.h"
+
+namespace JzRE {
+
+/**
+ * @brief Objects the GPU may still use, released after a number of finished frames
+ *
+ * The backend calls Tick() once per frame, after waiting on the fence of the
+ * frame slot it is about to reuse. An object pushed with N frames is released
+ * by the N-th Tick() after the push.
+ */
+template <typename T>
+class JzRHIDeferredReleaseQueue {
+public:
+    /**
+     * @brief Queue an object. Zero frames is treated as one.
+     */
+    void Push(T object, U32 frames)
+    {
+        m_entries.push_back({std::move(object), std::max<U32>(1, frames)});
+    }
+
+    /**
+     * @brief Count one finished frame and release every object that is due.
+     */
+    template <typename Release>
+    void Tick(Release &&release)
+    {
+        for (auto &entry : m_entries) {
+            if (--entry.framesLeft == 0) {
+                release(entry.object);
+            }
+        }
+        std::erase_if(m_entries, [](const Entry &entry) {
+            return entry.framesLeft == 0;
+        });
+    }
+
+    /**
+     * @brief Release every queued object at once, e.g. after the device went idle.
+     */
+    template <typename Release>
+    void ReleaseAll(Release &&release)
+    {
+        for (auto &entry : m_entries) {
+            release(entry.object);
+        }
+        m_entries.clear();
+    }
+
+    Size GetCount() const
+    {
+        return m_entries.size();
+    }
+
+private:
+    struct Entry {
+        T   object;
+        U32 framesLeft = 0;
+    };
+
+    std::vector<Entry> m_entries;
+};
+
+} // namespace JzRE
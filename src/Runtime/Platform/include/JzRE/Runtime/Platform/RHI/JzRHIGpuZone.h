@@ -0,0 +1,23 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include "JzRE/Runtime/Core/JzRETypes.h"
+
+namespace JzRE {
+
+/**
+ * @brief GPU timing of a command range bracketed by BeginGpuZone/EndGpuZone.
+ *
+ * Times are converted to the JzProfiler::NowNs() clock by the backend.
+ */
+struct JzRHIGpuZone {
+    String name;
+    U64    beginNs = 0;
+    U64    endNs   = 0;
+};
+
+} // namespace JzRE
@@ -166,6 +166,7 @@ struct JzPipelineDesc {
     JzVertexLayoutDesc               vertexLayout;
     JzShaderLayoutDesc               shaderLayout;
     String                           debugName;
+    String                           cacheKey; ///< Stable key for backend program caches, empty to disable caching
 };
 
 /**
@@ -276,6 +277,27 @@ public:
      */
     virtual void CommitParameters() = 0;
 
+    /**
+     * @brief Whether backend compilation has finished without blocking.
+     *
+     * Backends that compile asynchronously return false while the program
+     * is still being built; binding such a pipeline waits for completion.
+     */
+    virtual Bool IsReady()
+    {
+        return true;
+    }
+
+    /**
+     * @brief Whether backend compilation finished with an error.
+     *
+     * Only meaningful once IsReady() returned true.
+     */
+    virtual Bool HasFailed()
+    {
+        return false;
+    }
+
     /**
      * @brief Whether any cached parameter changed since last commit.
      */
@@ -31,14 +31,66 @@ enum class JzERHIResourceState : U8 {
     ReadWrite
 };
 
+/**
+ * @brief Precise way a pass accesses a resource.
+ *
+ * Backends with explicit synchronization derive pipeline stages, access
+ * masks and image layouts from it. Unknown falls back to JzERHIResourceState.
+ */
+enum class JzERHIResourceUsage : U8 {
+    Unknown,
+    VertexBuffer,
+    IndexBuffer,
+    UniformBuffer,
+    IndirectBuffer,
+    ShaderRead,        ///< Sampled texture or read-only storage buffer
+    ShaderWrite,       ///< Storage image or buffer, read and written
+    ColorAttachment,
+    DepthStencilWrite,
+    DepthStencilRead,  ///< Read-only depth attachment that shaders may also sample
+    TransferSrc,
+    TransferDst
+};
+
+/**
+ * @brief Kind of work on either side of a barrier.
+ */
+enum class JzERHIPassType : U8 {
+    Graphics,
+    Compute,
+    Transfer
+};
+
+/**
+ * @brief Half of a split barrier.
+ *
+ * A Begin half is recorded right after the producing pass and the matching
+ * End half (same splitId) right before the consumer, so unrelated passes in
+ * between can overlap with the transition. An End half always describes the
+ * full transition; backends without split barriers ignore Begin halves.
+ */
+enum class JzERHIBarrierSplit : U8 {
+    None,
+    Begin,
+    End
+};
+
 /**
  * @brief One resource transition item recorded into command lists.
+ *
+ * Texture barriers cover every mip level and array layer.
  */
 struct JzRHIResourceBarrier {
     JzEResourceType                type;
     std::shared_ptr<JzGPUResource> resource;
-    JzERHIResourceState            before = JzERHIResourceState::Unknown;
-    JzERHIResourceState            after  = JzERHIResourceState::Unknown;
+    JzERHIResourceState            before      = JzERHIResourceState::Unknown;
+    JzERHIResourceState            after       = JzERHIResourceState::Unknown;
+    JzERHIResourceUsage            beforeUsage = JzERHIResourceUsage::Unknown;
+    JzERHIResourceUsage            afterUsage  = JzERHIResourceUsage::Unknown;
+    JzERHIPassType                 beforePass  = JzERHIPassType::Graphics;
+    JzERHIPassType                 afterPass   = JzERHIPassType::Graphics;
+    JzERHIBarrierSplit             split       = JzERHIBarrierSplit::None;
+    U32                            splitId     = 0; ///< Pairs the Begin and End halves
 };
 
 } // namespace JzRE
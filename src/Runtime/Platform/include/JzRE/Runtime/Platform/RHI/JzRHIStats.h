@@ -13,9 +13,10 @@ namespace JzRE {
  */
 struct JzRHIStats {
     // 绘制调用统计
-    U32 drawCalls = 0;
-    U32 triangles = 0;
-    U32 vertices  = 0;
+    U32 drawCalls     = 0;
+    U32 triangles     = 0;
+    U32 vertices      = 0;
+    U32 indirectDraws = 0; // draws submitted through DrawIndexedIndirect (not counted in triangles/vertices)
 
     // 资源统计
     U32 buffers   = 0;
@@ -32,6 +33,10 @@ struct JzRHIStats {
     F32 frameTime = 0.0f;
     F32 gpuTime   = 0.0f;
 
+    // 状态缓存统计 (backends without a state cache leave these at zero)
+    U32 stateChangesIssued  = 0;
+    U32 stateChangesSkipped = 0;
+
     void Reset();
 };
 
@@ -0,0 +1,96 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "JzRE/Runtime/Core/JzJob.h"
+#include "JzRE/Runtime/Core/JzRETypes.h"
+
+namespace JzRE {
+
+/**
+ * @brief Dedicated thread that executes one render frame at a time.
+ *
+ * The game thread hands a frame over with Kick() and keeps simulating the next
+ * one. At most one frame is in flight: Kick() first waits for the previous
+ * frame, so the game thread runs at most one frame ahead. Everything the game
+ * thread wrote before Kick() is visible to the frame, and everything the frame
+ * wrote is visible to the game thread once Wait() returns.
+ */
+class JzRenderThread {
+public:
+    JzRenderThread() = default;
+
+    /**
+     * @brief Destructor, stops the thread
+     */
+    ~JzRenderThread();
+
+    JzRenderThread(const JzRenderThread &)            = delete;
+    JzRenderThread &operator=(const JzRenderThread &) = delete;
+
+    /**
+     * @brief Start the thread
+     *
+     * @param name Thread name shown in profiler captures
+     */
+    void Start(const String &name = "Render");
+
+    /**
+     * @brief Wait for the frame in flight, then join the thread
+     */
+    void Stop();
+
+    /**
+     * @brief Check whether the thread is running
+     */
+    Bool IsRunning() const;
+
+    /**
+     * @brief Check whether the caller is the render thread
+     */
+    Bool IsRenderThread() const;
+
+    /**
+     * @brief Hand a frame to the render thread
+     *
+     * Waits for the previous frame first. Runs the frame on the calling thread
+     * if the render thread is not running.
+     *
+     * @param frame Work for one frame
+     */
+    void Kick(JzJob frame);
+
+    /**
+     * @brief Block until the frame in flight has finished
+     */
+    void Wait();
+
+    /**
+     * @brief Number of frames that have finished executing
+     */
+    U64 GetCompletedFrameCount() const;
+
+private:
+    void ThreadMain(String name);
+
+private:
+    std::thread             m_thread;
+    std::mutex              m_mutex;
+    std::condition_variable m_frameReady;
+    std::condition_variable m_frameDone;
+    JzJob                   m_frame;
+    Bool                    m_hasFrame = false;
+    Bool                    m_stop     = false;
+    std::atomic<Bool>       m_running{false};
+    std::atomic<U64>        m_completedFrames{0};
+};
+
+} // namespace JzRE
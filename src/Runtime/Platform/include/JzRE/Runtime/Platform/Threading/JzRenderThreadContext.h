@@ -8,44 +8,34 @@
 #include "JzRE/Runtime/Core/JzRETypes.h"
 
 namespace JzRE {
+
+class JzGraphicsContext;
+
 /**
- * @brief Render Thread Context, maintains an independent OpenGL context for each thread
+ * @brief Binds the graphics context to the calling thread for the lifetime of the object.
+ *
+ * OpenGL contexts are current on at most one thread. When the game and render
+ * threads take turns on the device, each side opens a scope around its GPU
+ * work so the context moves between them explicitly. Other backends have no
+ * thread affinity and the binding is a no-op.
  */
 class JzRenderThreadContext {
 public:
     /**
-     * @brief Constructor
+     * @brief Constructor, makes the context current on the calling thread
      *
-     * @param threadId
+     * @param context Graphics context to bind
+     * @param threadId Index of the calling thread, forwarded to the context
      */
-    JzRenderThreadContext(U32 threadId);
+    explicit JzRenderThreadContext(JzGraphicsContext &context, U32 threadId = 0);
 
     /**
-     * @brief Destructor
+     * @brief Destructor, releases the context from the calling thread
      */
     ~JzRenderThreadContext();
 
-    /**
-     * @brief Initialize the Render Thread Context
-     *
-     * @return Bool
-     */
-    Bool Initialize();
-
-    /**
-     * @brief Make the Render Thread Context Current
-     */
-    void MakeCurrent();
-
-    /**
-     * @brief Swap the Buffers of the Render Thread Context
-     */
-    void SwapBuffers();
-
-    /**
-     * @brief Cleanup the Render Thread Context
-     */
-    void Cleanup();
+    JzRenderThreadContext(const JzRenderThreadContext &)            = delete;
+    JzRenderThreadContext &operator=(const JzRenderThreadContext &) = delete;
 
     /**
      * @brief Get the Thread Id of the Render Thread Context
@@ -54,19 +44,9 @@ public:
      */
     U32 GetThreadId() const;
 
-    /**
-     * @brief Get the Thread Id of the Render Thread Context
-     *
-     * @return U32
-     */
-    Bool IsInitialized() const;
-
 private:
-    U32  threadId;
-    Bool isInitialized = false;
-
-    // OpenGL上下文相关
-    // GLFWwindow* sharedContext = nullptr;
-    // 具体实现依赖于窗口系统
+    JzGraphicsContext &m_context;
+    U32                m_threadId;
 };
-} // namespace JzRE
\ No newline at end of file
+
+} // namespace JzRE
@@ -8,14 +8,18 @@
 #include <array>
 #include <atomic>
 #include <functional>
+#include <map>
 #include <memory>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <vulkan/vulkan.h>
 
 #include "JzRE/Runtime/Core/JzRETypes.h"
 #include "JzRE/Runtime/Platform/RHI/JzDevice.h"
+#include "JzRE/Runtime/Platform/RHI/JzGPUFramebufferObject.h"
+#include "JzRE/Runtime/Platform/RHI/JzRHIDeferredRelease.h"
 #include "JzRE/Runtime/Platform/RHI/JzRHICapabilities.h"
 #include "JzRE/Runtime/Platform/RHI/JzRHIStats.h"
 
@@ -61,11 +65,49 @@ public:
     void Flush() override;
     void Finish() override;
     Bool SupportsMultithreading() const override;
+    Bool SupportsMultiDrawIndirect() const override;
+    Bool SupportsTextureFormat(JzETextureResourceFormat format) const override;
+    Bool SupportsMipmapGeneration() const override;
+
+    const JzRHIStats &GetStats() const override;
+
+    void                      SetGpuProfilingEnabled(Bool enabled) override;
+    std::vector<JzRHIGpuZone> ConsumeGpuZones() override;
 
     void RequestSwapchainRecreate();
 
     Bool ExecuteImmediate(const std::function<void(VkCommandBuffer)> &recordFn);
 
+    /**
+     * @brief Command buffer for copies into resources, submitted ahead of the next frame.
+     *
+     * Records for the dedicated transfer queue when HasDedicatedTransferQueue();
+     * images written there must be released to the graphics queue family and
+     * acquired again in GetUploadGraphicsCommands(). Otherwise this is the
+     * graphics upload command buffer.
+     *
+     * @return VkCommandBuffer VK_NULL_HANDLE if the device is not initialized.
+     */
+    VkCommandBuffer GetUploadTransferCommands();
+
+    /**
+     * @brief Graphics queue command buffer executed right before the next frame's commands.
+     *
+     * Holds ownership acquires, mip generation blits and layout transitions of
+     * new resources.
+     */
+    VkCommandBuffer GetUploadGraphicsCommands();
+
+    /**
+     * @brief Free a staging buffer once the upload batch reading it has executed.
+     */
+    void RetireStagingBuffer(VkBuffer buffer, VkDeviceMemory memory);
+
+    /**
+     * @brief Destroy a texture's objects once no recorded or in-flight work can use them.
+     */
+    void RetireImage(VkImage image, VkDeviceMemory memory, VkImageView imageView, VkSampler sampler);
+
     U32 FindMemoryType(U32 typeFilter, VkMemoryPropertyFlags properties) const;
 
     VkInstance GetVkInstance() const
@@ -103,6 +145,19 @@ public:
         return m_presentQueueFamilyIndex;
     }
 
+    /**
+     * @brief Whether uploads run on a queue family without graphics support.
+     */
+    Bool HasDedicatedTransferQueue() const
+    {
+        return m_transferQueueFamilyIndex != m_graphicsQueueFamilyIndex;
+    }
+
+    U32 GetTransferQueueFamilyIndex() const
+    {
+        return m_transferQueueFamilyIndex;
+    }
+
     VkExtent2D GetSwapchainExtent() const
     {
         return m_swapchainExtent;
@@ -118,6 +173,20 @@ public:
         return m_swapchainRenderPass;
     }
 
+    /**
+     * @brief Render pass that framebuffers and pipelines for an attachment
+     * signature are created against.
+     *
+     * @param colorFormat Color attachment format, VK_FORMAT_UNDEFINED for none.
+     * @param depthFormat Depth attachment format, VK_FORMAT_UNDEFINED for none.
+     */
+    VkRenderPass GetCompatibleRenderPass(VkFormat colorFormat, VkFormat depthFormat);
+
+    /**
+     * @brief Destroy a framebuffer once the frame that may still use it has finished.
+     */
+    void RetireFramebuffer(VkFramebuffer framebuffer);
+
     VkCommandPool GetCurrentCommandPool() const;
     VkCommandBuffer GetCurrentCommandBuffer() const;
 
@@ -131,6 +200,12 @@ public:
         return m_isFrameActive;
     }
 
+    /**
+     * @brief Make the swapchain render pass instance current, so overlays such
+     * as ImGui can record into GetCurrentCommandBuffer().
+     */
+    Bool EnsureSwapchainRenderPass();
+
     std::shared_ptr<JzVulkanTexture> GetFallbackTexture() const
     {
         return m_fallbackTexture;
@@ -144,11 +219,83 @@ private:
     };
 
     struct JzVulkanFrameSync {
-        VkCommandPool   commandPool   = VK_NULL_HANDLE;
-        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
-        VkSemaphore     imageAvailable = VK_NULL_HANDLE;
-        VkSemaphore     renderFinished = VK_NULL_HANDLE;
-        VkFence         inFlight       = VK_NULL_HANDLE;
+        VkCommandPool        commandPool   = VK_NULL_HANDLE;
+        VkCommandBuffer      commandBuffer = VK_NULL_HANDLE;
+        VkSemaphore          imageAvailable = VK_NULL_HANDLE;
+        VkSemaphore          renderFinished = VK_NULL_HANDLE;
+        VkFence              inFlight       = VK_NULL_HANDLE;
+        std::vector<VkEvent> events;         ///< Split barrier events, reused every frame
+        U32                  usedEvents = 0;
+    };
+
+    /**
+     * @brief Render pass cache key: attachment formats, load/store ops and initial layouts.
+     */
+    struct JzVulkanRenderPassKey {
+        VkFormat            colorFormat        = VK_FORMAT_UNDEFINED;
+        VkFormat            depthFormat        = VK_FORMAT_UNDEFINED;
+        VkAttachmentLoadOp  colorLoadOp        = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        VkAttachmentStoreOp colorStoreOp       = VK_ATTACHMENT_STORE_OP_STORE;
+        VkAttachmentLoadOp  depthLoadOp        = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        VkAttachmentStoreOp depthStoreOp       = VK_ATTACHMENT_STORE_OP_STORE;
+        VkImageLayout       colorInitialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        VkImageLayout       depthInitialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+        auto operator<=>(const JzVulkanRenderPassKey &) const = default;
+    };
+
+    /**
+     * @brief Begin half of a split barrier waiting for its End half.
+     */
+    struct JzVulkanSplitBarrier {
+        VkEvent                event   = VK_NULL_HANDLE;
+        Bool                   isImage = false;
+        VkImageMemoryBarrier2  imageBarrier{};
+        VkBufferMemoryBarrier2 bufferBarrier{};
+    };
+
+    /**
+     * @brief Upload work of one frame in flight, submitted together with that frame.
+     */
+    struct JzVulkanUploadBatch {
+        VkCommandPool   transferPool      = VK_NULL_HANDLE; ///< On the transfer queue family
+        VkCommandBuffer transferCommands  = VK_NULL_HANDLE;
+        VkCommandPool   graphicsPool      = VK_NULL_HANDLE;
+        VkCommandBuffer graphicsCommands  = VK_NULL_HANDLE;
+        VkSemaphore     transferFinished  = VK_NULL_HANDLE; ///< Graphics submit waits on it
+        Bool            transferRecording = false;
+        Bool            graphicsRecording = false;
+        Bool            inFlight          = false; ///< Submitted, the frame fence not waited on yet
+
+        std::vector<std::pair<VkBuffer, VkDeviceMemory>> stagingBuffers;         ///< Read by the recording batch
+        std::vector<std::pair<VkBuffer, VkDeviceMemory>> inFlightStagingBuffers; ///< Read by the submitted batch
+    };
+
+    /**
+     * @brief Texture objects waiting for the frames that may use them.
+     */
+    struct JzVulkanRetiredImage {
+        VkImage        image     = VK_NULL_HANDLE;
+        VkDeviceMemory memory    = VK_NULL_HANDLE;
+        VkImageView    imageView = VK_NULL_HANDLE;
+        VkSampler      sampler   = VK_NULL_HANDLE;
+    };
+
+    struct JzVulkanGpuZone {
+        String name;
+        U32    beginQuery = 0;
+        U32    endQuery   = 0;
+    };
+
+    /**
+     * @brief Timestamp queries written by one frame in flight.
+     */
+    struct JzVulkanGpuZoneFrame {
+        std::vector<JzVulkanGpuZone> zones;
+        std::vector<U32>             openZones;
+        U32                          queryCount   = 0;
+        U64                          submitNs     = 0; ///< Profiler clock at vkQueueSubmit
+        Bool                         queriesReset = false;
     };
 
     Bool CreateInstance();
@@ -163,6 +310,7 @@ private:
     Bool CreateFrameSyncObjects();
     void DestroySwapchainObjects();
     void DestroyFrameSyncObjects();
+    void DestroyTimestampQueryPool();
 
     Bool RecreateSwapchain();
 
@@ -174,9 +322,36 @@ private:
     VkFormat           FindSupportedDepthFormat() const;
 
     Bool BeginSwapchainRenderPass();
-    void EndSwapchainRenderPass();
+    Bool BeginOffscreenRenderPass();
+    Bool EnsureRenderPass();
+    void EndActiveRenderPass();
+
+    VkRenderPass GetOrCreateRenderPass(const JzVulkanRenderPassKey &key);
+    void         DestroyRenderPassCache();
     Bool SubmitAndPresent();
 
+    /**
+     * @brief End the upload batch and submit its transfer side.
+     *
+     * Appends what the graphics submit must wait on and execute, and hands
+     * the staging buffers to the slot's fence.
+     */
+    void EndUploadBatch(JzVulkanUploadBatch &batch, std::vector<VkSemaphore> &waitSemaphores,
+                        std::vector<VkPipelineStageFlags> &waitStages, std::vector<VkCommandBuffer> &commandBuffers);
+
+    /**
+     * @brief Submit to the graphics queue. On failure the wait semaphores are
+     *        still consumed and the fence still signals.
+     */
+    Bool SubmitGraphics(const std::vector<VkSemaphore> &waitSemaphores,
+                        const std::vector<VkPipelineStageFlags> &waitStages,
+                        const std::vector<VkCommandBuffer> &commandBuffers, VkSemaphore signalSemaphore, VkFence fence);
+
+    /**
+     * @brief Submit the current upload batch on its own when no frame is presented.
+     */
+    void SubmitPendingUploads();
+
     void DispatchCommand(const JzRHIRecordedCommand &command);
 
     void SetRenderState(const JzRenderState &state);
@@ -185,20 +360,39 @@ private:
     void Clear(const JzClearParams &params);
     void Draw(const JzDrawParams &params);
     void DrawIndexed(const JzDrawIndexedParams &params);
+    void DrawIndexedIndirect(const JzDrawIndexedIndirectParams &params);
+    Bool BindIndexedDrawState(VkCommandBuffer commandBuffer);
     void BindPipeline(std::shared_ptr<JzRHIPipeline> pipeline);
     void BindVertexArray(std::shared_ptr<JzGPUVertexArrayObject> vertexArray);
     void BindTexture(std::shared_ptr<JzGPUTextureObject> texture, U32 slot);
-    void BindFramebuffer(std::shared_ptr<JzGPUFramebufferObject> framebuffer);
+    void BindFramebuffer(std::shared_ptr<JzGPUFramebufferObject> framebuffer,
+                         const JzRHIAttachmentOps               *attachmentOps = nullptr);
     void BlitFramebufferToScreen(std::shared_ptr<JzGPUFramebufferObject> framebuffer,
                                  U32 srcWidth, U32 srcHeight,
                                  U32 dstWidth, U32 dstHeight);
     void ResourceBarrier(const std::vector<JzRHIResourceBarrier> &barriers);
+    void FlushResourceBarriers();
+    Bool BuildImageBarrier(const JzRHIResourceBarrier &barrier, VkImageMemoryBarrier2 &out);
+    Bool BuildBufferBarrier(const JzRHIResourceBarrier &barrier, VkBufferMemoryBarrier2 &out);
+    void RecordPipelineBarrier(VkCommandBuffer                            commandBuffer,
+                               const std::vector<VkImageMemoryBarrier2>  &imageBarriers,
+                               const std::vector<VkBufferMemoryBarrier2> &bufferBarriers);
+    VkEvent AcquireFrameEvent();
+
+    JzVulkanUploadBatch &PrepareUploadBatch();
+    void                 ReclaimUploadBatch(JzVulkanUploadBatch &batch);
+    void                 DestroyRetiredImage(const JzVulkanRetiredImage &retired);
 
     void BeginRenderPass(const JzRHIBeginRenderPassPayload &payload);
     void EndRenderPass(const JzRHIEndRenderPassPayload &payload);
 
+    void BeginGpuZone(const String &name);
+    void EndGpuZone();
+    void ResolveGpuZones(JzVulkanGpuZoneFrame &zoneFrame);
+
 private:
-    static constexpr U32 __MAX_FRAMES_IN_FLIGHT = 2;
+    static constexpr U32 __MAX_FRAMES_IN_FLIGHT    = 2;
+    static constexpr U32 __MAX_GPU_ZONES_PER_FRAME = 128;
 
     JzIWindowBackend *m_windowBackend = nullptr;
 
@@ -206,6 +400,17 @@ private:
     Bool m_isFrameActive         = false;
     Bool m_readyForPresent       = false;
     Bool m_needsSwapchainRecreate = false;
+    Bool m_isRenderPassActive    = false;
+    Bool m_swapchainPassStarted  = false; ///< The clearing swapchain pass already ran this frame
+
+    // VK_KHR_synchronization2 entry points, null when the extension is unavailable
+    PFN_vkCmdPipelineBarrier2KHR m_cmdPipelineBarrier2 = nullptr;
+    PFN_vkCmdSetEvent2KHR        m_cmdSetEvent2        = nullptr;
+    PFN_vkCmdWaitEvents2KHR      m_cmdWaitEvents2      = nullptr;
+
+    // Barriers queued by ResourceBarrier(), recorded once no render pass instance is active
+    std::vector<JzRHIResourceBarrier>             m_pendingBarriers;
+    std::unordered_map<U32, JzVulkanSplitBarrier> m_openSplitBarriers;
 
     JzRHICapabilities m_capabilities;
     JzRHIStats        m_stats;
@@ -213,6 +418,7 @@ private:
     JzRenderState m_currentRenderState;
     JzViewport    m_currentViewport;
     JzScissorRect m_currentScissor;
+    Bool          m_scissorSet = false; ///< SetScissor was called since the last framebuffer bind
     JzClearParams m_currentClear;
 
     std::shared_ptr<JzVulkanPipeline>    m_currentPipeline;
@@ -220,6 +426,19 @@ private:
     std::shared_ptr<JzVulkanFramebuffer> m_currentFramebuffer;
     std::unordered_map<U32, std::shared_ptr<JzVulkanTexture>> m_boundTextures;
 
+    // Render pass instances begin at the first draw or clear after a framebuffer bind
+    JzRHIAttachmentOps                            m_currentAttachmentOps;
+    JzClearParams                                 m_renderPassClear;
+    VkRenderPass                                  m_activeCompatibleRenderPass = VK_NULL_HANDLE;
+    VkExtent2D                                    m_activeRenderArea{};
+    Bool                                          m_activeHasColor = true;
+    Bool                                          m_activeHasDepth = true;
+    std::map<JzVulkanRenderPassKey, VkRenderPass> m_renderPassCache;
+
+    // Destroyed once the frames that may still use them have finished
+    JzRHIDeferredReleaseQueue<VkFramebuffer>        m_retiredFramebuffers;
+    JzRHIDeferredReleaseQueue<JzVulkanRetiredImage> m_retiredImages;
+
     VkInstance       m_instance       = VK_NULL_HANDLE;
     VkSurfaceKHR     m_surface        = VK_NULL_HANDLE;
     VkPhysicalDevice m_physicalDevice = VK_NULL_HANDLE;
@@ -227,9 +446,11 @@ private:
 
     VkQueue m_graphicsQueue = VK_NULL_HANDLE;
     VkQueue m_presentQueue  = VK_NULL_HANDLE;
+    VkQueue m_transferQueue = VK_NULL_HANDLE; ///< Same as the graphics queue without a dedicated family
 
     U32 m_graphicsQueueFamilyIndex = 0;
     U32 m_presentQueueFamilyIndex  = 0;
+    U32 m_transferQueueFamilyIndex = 0;
 
     VkSwapchainKHR             m_swapchain           = VK_NULL_HANDLE;
     VkFormat                   m_swapchainImageFormat = VK_FORMAT_B8G8R8A8_UNORM;
@@ -241,14 +462,23 @@ private:
     std::vector<VkDeviceMemory> m_swapchainDepthImageMemories;
     std::vector<VkImageView>   m_swapchainDepthImageViews;
     VkRenderPass               m_swapchainRenderPass = VK_NULL_HANDLE;
+    VkRenderPass               m_swapchainLoadRenderPass = VK_NULL_HANDLE; ///< Resumes the swapchain after offscreen passes
     std::vector<VkFramebuffer> m_swapchainFramebuffers;
 
-    std::array<JzVulkanFrameSync, __MAX_FRAMES_IN_FLIGHT> m_frames{};
-    std::vector<VkFence>                                   m_imagesInFlight;
+    std::array<JzVulkanFrameSync, __MAX_FRAMES_IN_FLIGHT>   m_frames{};
+    std::array<JzVulkanUploadBatch, __MAX_FRAMES_IN_FLIGHT> m_uploadBatches{};
+    std::vector<VkFence>                                     m_imagesInFlight;
 
     U32 m_currentFrameIndex = 0;
     U32 m_currentImageIndex = 0;
 
+    VkQueryPool                                              m_timestampQueryPool = VK_NULL_HANDLE;
+    F64                                                      m_timestampPeriod    = 1.0; ///< Nanoseconds per tick
+    U64                                                      m_timestampMask      = ~0ULL;
+    std::array<JzVulkanGpuZoneFrame, __MAX_FRAMES_IN_FLIGHT> m_gpuZoneFrames{};
+    std::vector<JzRHIGpuZone>                                m_resolvedGpuZones;
+    U64                                                      m_lastFrameBeginNs = 0;
+
     std::shared_ptr<JzVulkanTexture> m_pendingBlitTexture;
     std::shared_ptr<JzVulkanTexture> m_fallbackTexture;
     U32                              m_pendingBlitSrcWidth  = 0;
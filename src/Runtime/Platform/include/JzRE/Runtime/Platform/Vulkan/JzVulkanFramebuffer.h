@@ -8,19 +8,25 @@
 #include <memory>
 #include <vector>
 
+#include <vulkan/vulkan.h>
+
 #include "JzRE/Runtime/Platform/RHI/JzGPUFramebufferObject.h"
 
 namespace JzRE {
 
+class JzVulkanDevice;
+class JzVulkanTexture;
+
 /**
  * @brief Vulkan framebuffer abstraction used by render output and render graph.
  *
- * The backend keeps attachment references and resolves concrete Vulkan render
- * pass/framebuffer objects in the device path when needed.
+ * The backend keeps attachment references and builds the native VkFramebuffer
+ * on first use. The handle only depends on attachment formats, so one handle
+ * serves every render pass variant (load/store ops, layouts) of the target.
  */
 class JzVulkanFramebuffer : public JzGPUFramebufferObject {
 public:
-    explicit JzVulkanFramebuffer(const String &debugName = "");
+    JzVulkanFramebuffer(JzVulkanDevice &device, const String &debugName = "");
     ~JzVulkanFramebuffer() override;
 
     void AttachColorTexture(std::shared_ptr<JzGPUTextureObject> texture, U32 attachmentIndex = 0) override;
@@ -52,10 +58,37 @@ public:
         return m_depthStencilAttachment;
     }
 
+    /**
+     * @brief Color attachment 0 as a Vulkan texture, null when absent.
+     */
+    std::shared_ptr<JzVulkanTexture> GetVulkanColorAttachment() const;
+
+    /**
+     * @brief Depth or depth-stencil attachment as a Vulkan texture, null when absent.
+     */
+    std::shared_ptr<JzVulkanTexture> GetVulkanDepthAttachment() const;
+
+    /**
+     * @brief Native framebuffer for the current attachments.
+     *
+     * Rebuilt when an attachment's image view or size changed; the old handle
+     * is retired to the device until the GPU finished the frame using it.
+     *
+     * @param renderPass Any render pass compatible with the attachment formats.
+     */
+    VkFramebuffer GetOrCreateHandle(VkRenderPass renderPass);
+
+private:
+    void RetireHandle();
+
 private:
+    JzVulkanDevice                                  *m_owner = nullptr;
     std::vector<std::shared_ptr<JzGPUTextureObject>> m_colorAttachments;
     std::shared_ptr<JzGPUTextureObject>              m_depthAttachment;
     std::shared_ptr<JzGPUTextureObject>              m_depthStencilAttachment;
+    VkFramebuffer                                    m_handle = VK_NULL_HANDLE;
+    std::vector<VkImageView>                         m_handleViews;
+    VkExtent2D                                       m_handleExtent{};
 };
 
 } // namespace JzRE
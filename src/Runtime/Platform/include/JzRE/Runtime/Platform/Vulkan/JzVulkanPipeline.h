@@ -70,6 +70,18 @@ public:
         return m_pipeline;
     }
 
+    /**
+     * @brief Pipeline compatible with a render pass.
+     *
+     * The swapchain render pass uses the pipeline built at creation. Other
+     * attachment signatures get a variant built on first use and cached by
+     * render pass, so the device should pass one render pass per signature.
+     *
+     * @param renderPass Render pass the pipeline will be used in.
+     * @param hasColorAttachment Whether the subpass writes a color attachment.
+     */
+    VkPipeline GetPipeline(VkRenderPass renderPass, Bool hasColorAttachment);
+
     /**
      * @brief Native Vulkan pipeline layout handle.
      */
@@ -109,7 +121,8 @@ private:
         String           name;
     };
 
-    Bool CreateGraphicsPipeline();
+    Bool       CreateGraphicsPipeline();
+    VkPipeline BuildPipeline(VkRenderPass renderPass, Bool hasColorAttachment) const;
     void DestroyDescriptorResources();
     void DestroyDescriptorSetLayouts();
     void UploadUniformParameters();
@@ -117,16 +130,19 @@ private:
     void BindDescriptorSets(VkCommandBuffer commandBuffer);
 
 private:
-    JzVulkanDevice                              *m_owner   = nullptr;
-    Bool                                         m_isValid = false;
-    std::vector<std::shared_ptr<JzVulkanShader>> m_shaders;
-    VkPipelineLayout                             m_pipelineLayout = VK_NULL_HANDLE;
-    VkPipeline                                   m_pipeline       = VK_NULL_HANDLE;
-    std::vector<VkDescriptorSetLayout>           m_descriptorSetLayouts;
-    VkDescriptorPool                             m_descriptorPool = VK_NULL_HANDLE;
-    std::vector<VkDescriptorSet>                 m_descriptorSets;
-    std::vector<JzUniformBindingDesc>            m_uniformBindings;
-    std::vector<JzSamplerBindingDesc>            m_samplerBindings;
+    JzVulkanDevice                                *m_owner   = nullptr;
+    Bool                                           m_isValid = false;
+    std::vector<std::shared_ptr<JzVulkanShader>>   m_shaders;
+    VkPipelineLayout                               m_pipelineLayout = VK_NULL_HANDLE;
+    VkPipeline                                     m_pipeline       = VK_NULL_HANDLE;
+    std::vector<VkDescriptorSetLayout>             m_descriptorSetLayouts;
+    VkDescriptorPool                               m_descriptorPool = VK_NULL_HANDLE;
+    std::vector<VkDescriptorSet>                   m_descriptorSets;
+    std::vector<JzUniformBindingDesc>              m_uniformBindings;
+    std::vector<JzSamplerBindingDesc>              m_samplerBindings;
+    std::vector<VkVertexInputBindingDescription>   m_vertexBindings;
+    std::vector<VkVertexInputAttributeDescription> m_vertexAttributes;
+    std::unordered_map<VkRenderPass, VkPipeline>   m_pipelineVariants; ///< Offscreen variants by render pass
 };
 
 } // namespace JzRE
@@ -0,0 +1,43 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include "JzRE/Runtime/Core/JzRETypes.h"
+
+namespace JzRE {
+
+/**
+ * @brief Queue family that can copy but not draw, preferring pure copy engines over async compute.
+ */
+std::optional<U32> FindDedicatedTransferQueueFamily(const std::vector<VkQueueFamilyProperties> &queueFamilies);
+
+/**
+ * @brief Barriers that make an uploaded image readable by shaders
+ */
+struct JzVulkanUploadBarriers {
+    Bool                 onTransferQueue = false; ///< Copy on the transfer queue and hand the image over
+    VkImageMemoryBarrier release{};               ///< Recorded on the transfer queue, only with onTransferQueue
+    VkImageMemoryBarrier acquire{};               ///< Recorded on the graphics queue
+};
+
+/**
+ * @brief Pick the queue for an upload copy and its ownership transfer.
+ *
+ * Only the first upload of an image goes through a dedicated transfer queue;
+ * later ones are ordered against rendering on the graphics queue. The release
+ * and acquire pair carries the same layout change and queue family indices.
+ *
+ * @param toTransfer Barrier that moved the image into TRANSFER_DST_OPTIMAL
+ */
+JzVulkanUploadBarriers GetUploadBarriers(const VkImageMemoryBarrier &toTransfer, Bool initialUpload,
+                                         U32 transferQueueFamily, U32 graphicsQueueFamily);
+
+} // namespace JzRE
@@ -5,6 +5,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+
 #include <vulkan/vulkan.h>
 
 #include "JzRE/Runtime/Platform/RHI/JzGPUTextureObject.h"
@@ -84,17 +87,34 @@ public:
     }
 
 private:
+    /**
+     * @brief Upload consecutive mip levels of one array layer through a single staging buffer.
+     *
+     * @param initialUpload The image has never been used: the copy may run on the
+     *                      transfer queue and moves every subresource to shader read.
+     */
+    void UploadLevels(const std::vector<JzGPUTextureMipData> &levels, U32 firstMip, U32 arrayIndex,
+                      Bool initialUpload = false);
+
+    /**
+     * @brief Record the transition of a new image out of the undefined layout.
+     */
+    void RecordInitialLayout(VkImageLayout layout);
+
     static VkFormat ConvertTextureFormat(JzETextureResourceFormat format);
     static VkImageAspectFlags GetImageAspectMask(JzETextureResourceFormat format);
 
 private:
-    JzVulkanDevice *m_owner     = nullptr;
-    VkImage         m_image     = VK_NULL_HANDLE;
-    VkDeviceMemory  m_memory    = VK_NULL_HANDLE;
-    VkImageView     m_imageView = VK_NULL_HANDLE;
-    VkSampler       m_sampler   = VK_NULL_HANDLE;
-    VkFormat        m_format    = VK_FORMAT_UNDEFINED;
-    VkImageLayout   m_layout    = VK_IMAGE_LAYOUT_UNDEFINED;
+    JzVulkanDevice                   *m_owner = nullptr;
+    std::shared_ptr<std::atomic_bool> m_deviceAlive;
+    VkImage                           m_image      = VK_NULL_HANDLE;
+    VkDeviceMemory                    m_memory     = VK_NULL_HANDLE;
+    VkImageView                       m_imageView  = VK_NULL_HANDLE;
+    VkSampler                         m_sampler    = VK_NULL_HANDLE;
+    VkFormat                          m_format     = VK_FORMAT_UNDEFINED;
+    VkImageLayout                     m_layout     = VK_IMAGE_LAYOUT_UNDEFINED;
+    U32                               m_levelCount = 1;
+    U32                               m_layerCount = 1;
 };
 
 } // namespace JzRE
@@ -22,6 +22,7 @@ struct JzVulkanVertexAttribute {
     U32 stride  = 0;
     U32 offset  = 0;
     U32 binding = 0;
+    U32 divisor = 0;
 };
 
 /**
@@ -35,6 +36,7 @@ public:
     void BindVertexBuffer(std::shared_ptr<JzGPUBufferObject> buffer, U32 binding = 0) override;
     void BindIndexBuffer(std::shared_ptr<JzGPUBufferObject> buffer) override;
     void SetVertexAttribute(U32 index, U32 size, U32 stride, U32 offset) override;
+    void SetVertexAttributeDivisor(U32 index, U32 divisor) override;
 
     /**
      * @brief Bound vertex buffer map.
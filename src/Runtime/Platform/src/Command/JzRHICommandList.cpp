@@ -94,6 +94,11 @@ void JzRE::JzRHICommandList::DrawIndexed(const JzRE::JzDrawIndexedParams &params
     AddCommand(JzRHIECommandType::DrawIndexed, params);
 }
 
+void JzRE::JzRHICommandList::DrawIndexedIndirect(const JzRE::JzDrawIndexedIndirectParams &params)
+{
+    AddCommand(JzRHIECommandType::DrawIndexedIndirect, params);
+}
+
 void JzRE::JzRHICommandList::BindPipeline(std::shared_ptr<JzRE::JzRHIPipeline> pipeline)
 {
     JzRHIBindPipelinePayload payload;
@@ -123,6 +128,16 @@ void JzRE::JzRHICommandList::BindFramebuffer(std::shared_ptr<JzRE::JzGPUFramebuf
     AddCommand(JzRHIECommandType::BindFramebuffer, std::move(payload));
 }
 
+void JzRE::JzRHICommandList::BindFramebuffer(std::shared_ptr<JzRE::JzGPUFramebufferObject> framebuffer,
+                                             const JzRE::JzRHIAttachmentOps               &attachmentOps)
+{
+    JzRHIBindFramebufferPayload payload;
+    payload.framebuffer      = std::move(framebuffer);
+    payload.attachmentOps    = attachmentOps;
+    payload.hasAttachmentOps = true;
+    AddCommand(JzRHIECommandType::BindFramebuffer, std::move(payload));
+}
+
 void JzRE::JzRHICommandList::SetViewport(const JzRE::JzViewport &viewport)
 {
     AddCommand(JzRHIECommandType::SetViewport, viewport);
@@ -184,6 +199,18 @@ void JzRE::JzRHICommandList::EndRenderPass(std::shared_ptr<JzRE::JzRHIRenderPass
     AddCommand(JzRHIECommandType::EndRenderPass, std::move(payload));
 }
 
+void JzRE::JzRHICommandList::BeginGpuZone(const JzRE::String &name)
+{
+    JzRHIGpuZonePayload payload;
+    payload.name = name;
+    AddCommand(JzRHIECommandType::BeginGpuZone, std::move(payload));
+}
+
+void JzRE::JzRHICommandList::EndGpuZone()
+{
+    AddCommand(JzRHIECommandType::EndGpuZone, std::monostate{});
+}
+
 template <typename TPayload>
 void JzRE::JzRHICommandList::AddCommand(JzRE::JzRHIECommandType type, TPayload &&payload)
 {
@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "JzRE/Runtime/Core/JzLogger.h"
+#include "JzRE/Runtime/Core/JzProfiler.h"
 #include "JzRE/Runtime/Platform/D3D12/JzD3D12Buffer.h"
 #include "JzRE/Runtime/Platform/D3D12/JzD3D12Framebuffer.h"
 #include "JzRE/Runtime/Platform/D3D12/JzD3D12Pipeline.h"
@@ -408,9 +409,16 @@ void JzD3D12Device::BeginFrame()
     scissor.bottom = static_cast<LONG>(m_currentScissor.y + m_currentScissor.height);
     m_commandList->RSSetScissorRects(1, &scissor);
 
-    m_stats.drawCalls = 0;
-    m_stats.triangles = 0;
-    m_stats.vertices  = 0;
+    m_stats.drawCalls     = 0;
+    m_stats.triangles     = 0;
+    m_stats.vertices      = 0;
+    m_stats.indirectDraws = 0;
+
+    const U64 now = JzProfiler::NowNs();
+    if (m_lastFrameBeginNs != 0) {
+        m_stats.frameTime = static_cast<F32>(static_cast<F64>(now - m_lastFrameBeginNs) / 1.0e6);
+    }
+    m_lastFrameBeginNs = now;
 
     m_boundTextures.clear();
     m_isFrameActive   = true;
@@ -477,6 +485,16 @@ Bool JzD3D12Device::SupportsMultithreading() const
     return true;
 }
 
+Bool JzD3D12Device::SupportsMultiDrawIndirect() const
+{
+    return m_capabilities.supportsMultiDrawIndirect;
+}
+
+const JzRHIStats &JzD3D12Device::GetStats() const
+{
+    return m_stats;
+}
+
 ID3D12Device *JzD3D12Device::GetDevice() const
 {
     return m_device.Get();
@@ -553,6 +571,7 @@ void JzD3D12Device::InitializeCapabilities()
     m_capabilities.supportsTessellationShaders    = false;
     m_capabilities.supportsMultithreadedRendering = true;
     m_capabilities.maxRenderThreads               = 4;
+    m_capabilities.supportsMultiDrawIndirect      = true;
 }
 
 Bool JzD3D12Device::CreateDevice()
@@ -894,6 +913,13 @@ void JzD3D12Device::DispatchCommand(const JzRHIRecordedCommand &command)
             }
             break;
         }
+        case JzRHIECommandType::DrawIndexedIndirect:
+        {
+            if (const auto *payload = std::get_if<JzDrawIndexedIndirectParams>(&command.payload)) {
+                DrawIndexedIndirect(*payload);
+            }
+            break;
+        }
         case JzRHIECommandType::BindPipeline:
         {
             if (const auto *payload = std::get_if<JzRHIBindPipelinePayload>(&command.payload)) {
@@ -974,6 +1000,10 @@ void JzD3D12Device::DispatchCommand(const JzRHIRecordedCommand &command)
             }
             break;
         }
+        case JzRHIECommandType::BeginGpuZone:
+        case JzRHIECommandType::EndGpuZone:
+            // GPU timestamps are not implemented on D3D12 yet
+            break;
     }
 }
 
@@ -1116,13 +1146,72 @@ void JzD3D12Device::DrawIndexed(const JzDrawIndexedParams &params)
         return;
     }
 
-    if (!m_currentPipeline || !m_currentPipeline->IsValid()) {
+    if (!BindIndexedDrawState(params.primitiveType)) {
+        return;
+    }
+
+    m_commandList->DrawIndexedInstanced(params.indexCount, params.instanceCount, params.firstIndex, params.vertexOffset, params.firstInstance);
+
+    m_stats.drawCalls++;
+    m_stats.vertices += params.indexCount;
+    if (params.primitiveType == JzEPrimitiveType::Triangles) {
+        m_stats.triangles += params.indexCount / 3;
+    }
+}
+
+void JzD3D12Device::DrawIndexedIndirect(const JzDrawIndexedIndirectParams &params)
+{
+    if (!m_isFrameActive || !m_commandList || params.drawCount == 0) {
+        return;
+    }
+
+    auto indirectBuffer = std::dynamic_pointer_cast<JzD3D12Buffer>(params.indirectBuffer);
+    if (!indirectBuffer || !indirectBuffer->GetResource()) {
+        return;
+    }
+
+    // D3D12_DRAW_INDEXED_ARGUMENTS has the same layout as JzDrawIndexedIndirectArgs
+    if (!m_drawIndexedSignature || m_drawIndexedSignatureStride != params.stride) {
+        D3D12_INDIRECT_ARGUMENT_DESC argumentDesc{};
+        argumentDesc.Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED;
+
+        D3D12_COMMAND_SIGNATURE_DESC signatureDesc{};
+        signatureDesc.ByteStride       = params.stride;
+        signatureDesc.NumArgumentDescs = 1;
+        signatureDesc.pArgumentDescs   = &argumentDesc;
+
+        m_drawIndexedSignature.Reset();
+        if (FAILED(m_device->CreateCommandSignature(&signatureDesc, nullptr, IID_PPV_ARGS(&m_drawIndexedSignature)))) {
+            JzRE_LOG_ERROR("JzD3D12Device: failed to create indexed indirect command signature");
+            return;
+        }
+        m_drawIndexedSignatureStride = params.stride;
+    }
+
+    if (!BindIndexedDrawState(params.primitiveType)) {
         return;
     }
 
+    m_commandList->ExecuteIndirect(m_drawIndexedSignature.Get(),
+                                   params.drawCount,
+                                   indirectBuffer->GetResource(),
+                                   static_cast<UINT64>(params.offset),
+                                   nullptr,
+                                   0);
+
+    m_stats.drawCalls++;
+    m_stats.indirectDraws += params.drawCount;
+}
+
+Bool JzD3D12Device::BindIndexedDrawState(JzEPrimitiveType primitiveType)
+{
+    if (!m_currentPipeline || !m_currentPipeline->IsValid()) {
+        return false;
+    }
+
     m_commandList->SetPipelineState(m_currentPipeline->GetPipelineState());
     m_currentPipeline->BindResources(m_commandList.Get(), m_boundTextures);
-    m_commandList->IASetPrimitiveTopology(ConvertPrimitiveTopology(params.primitiveType));
+    m_commandList->IASetPrimitiveTopology(ConvertPrimitiveTopology(primitiveType));
 
     if (m_currentVertexArray) {
         for (const auto &binding : m_currentPipeline->GetVertexBindings()) {
@@ -1144,7 +1233,7 @@ void JzD3D12Device::DrawIndexed(const JzDrawIndexedParams &params)
 
         auto indexBuffer = std::dynamic_pointer_cast<JzD3D12Buffer>(m_currentVertexArray->GetIndexBuffer());
         if (!indexBuffer || !indexBuffer->GetResource()) {
-            return;
+            return false;
         }
 
         D3D12_INDEX_BUFFER_VIEW indexView{};
@@ -1154,13 +1243,7 @@ void JzD3D12Device::DrawIndexed(const JzDrawIndexedParams &params)
         m_commandList->IASetIndexBuffer(&indexView);
     }
 
-    m_commandList->DrawIndexedInstanced(params.indexCount, params.instanceCount, params.firstIndex, params.vertexOffset, params.firstInstance);
-
-    m_stats.drawCalls++;
-    m_stats.vertices += params.indexCount;
-    if (params.primitiveType == JzEPrimitiveType::Triangles) {
-        m_stats.triangles += params.indexCount / 3;
-    }
+    return true;
 }
 
 void JzD3D12Device::ResourceBarrier(const std::vector<JzRHIResourceBarrier> &barriers)
@@ -1177,6 +1260,11 @@ void JzD3D12Device::ResourceBarrier(const std::vector<JzRHIResourceBarrier> &bar
             continue;
         }
 
+        // The End half of a split barrier carries the whole transition
+        if (barrier.split == JzERHIBarrierSplit::Begin) {
+            continue;
+        }
+
         auto texture = std::dynamic_pointer_cast<JzD3D12Texture>(barrier.resource);
         if (!texture || !texture->GetResource()) {
             continue;
@@ -53,6 +53,17 @@ void JzD3D12VertexArray::SetVertexAttribute(U32 index, U32 size, U32 stride, U32
     iter->offset = offset;
 }
 
+void JzD3D12VertexArray::SetVertexAttributeDivisor(U32 index, U32 divisor)
+{
+    // Instance step rate comes from the pipeline input layout; keep it as metadata
+    for (auto &attr : m_attributes) {
+        if (attr.index == index) {
+            attr.divisor = divisor;
+            return;
+        }
+    }
+}
+
 const std::unordered_map<U32, std::shared_ptr<JzGPUBufferObject>> &JzD3D12VertexArray::GetVertexBuffers() const
 {
     return m_vertexBuffers;
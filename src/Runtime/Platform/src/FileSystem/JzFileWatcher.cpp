@@ -0,0 +1,229 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Platform/FileSystem/JzFileWatcher.h"
+
+#include <algorithm>
+#include <atomic>
+#include "JzRE/Runtime/Core/JzLogger.h"
+#include "JzRE/Runtime/Platform/FileSystem/JzPollingFileWatchBackend.h"
+
+namespace JzRE {
+
+namespace {
+
+Bool IsWithin(const std::filesystem::path &path, const std::filesystem::path &directory)
+{
+    auto [dirIt, pathIt] = std::mismatch(directory.begin(), directory.end(), path.begin(), path.end());
+    return dirIt == directory.end();
+}
+
+std::unique_ptr<JzIFileWatchBackend> CreateBackend(const JzFileWatcherConfig &config)
+{
+    if (!config.forcePolling) {
+        if (auto backend = JzIFileWatchBackend::CreateNative()) {
+            return backend;
+        }
+
+        static std::atomic<Bool> s_fallbackLogged{false};
+        if (!s_fallbackLogged.exchange(true)) {
+            JzRE_LOG_WARN("JzFileWatcher: no native file notifications, polling every {}s", config.pollIntervalSeconds);
+        }
+    }
+    return std::make_unique<JzPollingFileWatchBackend>(config.pollIntervalSeconds);
+}
+
+} // namespace
+
+#ifndef __linux__
+std::unique_ptr<JzIFileWatchBackend> JzIFileWatchBackend::CreateNative()
+{
+    return nullptr;
+}
+#endif
+
+JzFileWatcher::JzFileWatcher(const JzFileWatcherConfig &config) :
+    JzFileWatcher(CreateBackend(config), config) { }
+
+JzFileWatcher::JzFileWatcher(std::unique_ptr<JzIFileWatchBackend> backend, const JzFileWatcherConfig &config) :
+    m_config(config),
+    m_backend(std::move(backend))
+{
+    JzRE_LOG_INFO("JzFileWatcher: using {} backend", m_backend->GetName());
+}
+
+JzFileWatcher::~JzFileWatcher()
+{
+    for (const auto &[directory, watched] : m_directories) {
+        m_backend->RemoveDirectory(directory);
+    }
+}
+
+JzFileWatchHandle JzFileWatcher::Watch(const std::filesystem::path &directory, Bool recursive, JzFileWatchCallback callback)
+{
+    const auto normalized = NormalizePath(directory);
+    const auto key        = normalized.string();
+
+    auto &watched = m_directories[key];
+    if (watched.refCount == 0 || (recursive && !watched.recursive)) {
+        if (!m_backend->AddDirectory(normalized, recursive || watched.recursive)) {
+            if (watched.refCount == 0) {
+                m_directories.erase(key);
+            }
+            JzRE_LOG_WARN("JzFileWatcher: cannot watch '{}'", key);
+            return 0;
+        }
+        watched.recursive = watched.recursive || recursive;
+    }
+    ++watched.refCount;
+
+    const JzFileWatchHandle handle = m_nextHandle++;
+    m_subscriptions.emplace(handle, JzSubscription{normalized, recursive, std::move(callback)});
+    return handle;
+}
+
+void JzFileWatcher::Unwatch(JzFileWatchHandle handle)
+{
+    auto subscription = m_subscriptions.find(handle);
+    if (subscription == m_subscriptions.end()) {
+        return;
+    }
+
+    const auto key     = subscription->second.directory.string();
+    auto       watched = m_directories.find(key);
+    if (watched != m_directories.end() && --watched->second.refCount == 0) {
+        m_backend->RemoveDirectory(subscription->second.directory);
+        m_directories.erase(watched);
+    }
+    m_subscriptions.erase(subscription);
+}
+
+void JzFileWatcher::Update(F32 deltaSeconds)
+{
+    for (auto &[path, pending] : m_pending) {
+        pending.quietSeconds += deltaSeconds;
+    }
+
+    m_rawChanges.clear();
+    m_backend->Poll(deltaSeconds, m_rawChanges);
+    for (const auto &change : m_rawChanges) {
+        Coalesce(change);
+    }
+
+    std::vector<JzFileChange> settled;
+    for (auto it = m_pending.begin(); it != m_pending.end();) {
+        if (it->second.quietSeconds >= m_config.debounceSeconds) {
+            settled.push_back({it->first, it->second.kind, it->second.previousPath});
+            it = m_pending.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    if (!settled.empty()) {
+        Deliver(settled);
+    }
+}
+
+const char *JzFileWatcher::GetBackendName() const
+{
+    return m_backend->GetName();
+}
+
+std::filesystem::path JzFileWatcher::NormalizePath(const std::filesystem::path &path)
+{
+    std::error_code ec;
+    auto            absolute = std::filesystem::absolute(path, ec);
+    if (ec) {
+        absolute = path;
+    }
+
+    auto normalized = absolute.lexically_normal();
+    if (!normalized.has_filename() && normalized.has_parent_path() && normalized != normalized.root_path()) {
+        normalized = normalized.parent_path();
+    }
+    return normalized;
+}
+
+void JzFileWatcher::Coalesce(const JzFileChange &change)
+{
+    const auto key  = change.path.string();
+    auto       iter = m_pending.find(key);
+    if (iter == m_pending.end()) {
+        m_pending.emplace(key, JzPendingChange{change.kind, 0.0f, change.previousPath});
+        return;
+    }
+
+    auto &pending        = iter->second;
+    pending.quietSeconds = 0.0f;
+
+    if (pending.kind == JzEFileChangeKind::Rescan || change.kind == JzEFileChangeKind::Rescan) {
+        pending.kind = JzEFileChangeKind::Rescan;
+    } else if (pending.kind == JzEFileChangeKind::Added && change.kind == JzEFileChangeKind::Removed) {
+        // Temporary file, nothing to report
+        m_pending.erase(iter);
+    } else if (pending.kind == JzEFileChangeKind::Added) {
+        // Still new to subscribers
+    } else if (pending.kind == JzEFileChangeKind::Removed && change.kind == JzEFileChangeKind::Added) {
+        // Replaced by an atomic save
+        pending.kind = JzEFileChangeKind::Modified;
+    } else if (pending.kind == JzEFileChangeKind::Renamed && change.kind != JzEFileChangeKind::Removed) {
+        // Subscribers still need the old path
+    } else {
+        pending.kind         = change.kind;
+        pending.previousPath = change.previousPath;
+    }
+}
+
+void JzFileWatcher::Deliver(std::vector<JzFileChange> &changes)
+{
+    std::sort(changes.begin(), changes.end(), [](const JzFileChange &lhs, const JzFileChange &rhs) {
+        return lhs.path < rhs.path;
+    });
+
+    std::vector<JzFileWatchHandle> handles;
+    handles.reserve(m_subscriptions.size());
+    for (const auto &[handle, subscription] : m_subscriptions) {
+        handles.push_back(handle);
+    }
+    std::sort(handles.begin(), handles.end());
+
+    std::vector<JzFileChange> matched;
+    for (const JzFileWatchHandle handle : handles) {
+        // Earlier callbacks may have unsubscribed this one
+        auto subscription = m_subscriptions.find(handle);
+        if (subscription == m_subscriptions.end()) {
+            continue;
+        }
+
+        matched.clear();
+        for (const auto &change : changes) {
+            if (change.kind == JzEFileChangeKind::Rescan) {
+                if (IsWithin(subscription->second.directory, change.path) || IsWithin(change.path, subscription->second.directory)) {
+                    matched.push_back({subscription->second.directory, JzEFileChangeKind::Rescan});
+                }
+            } else if (Covers(subscription->second, change.path) ||
+                       (change.kind == JzEFileChangeKind::Renamed && Covers(subscription->second, change.previousPath))) {
+                matched.push_back(change);
+            }
+        }
+
+        if (!matched.empty()) {
+            // Copy, the callback may add subscriptions and rehash the map
+            auto callback = subscription->second.callback;
+            callback(matched);
+        }
+    }
+}
+
+Bool JzFileWatcher::Covers(const JzSubscription &subscription, const std::filesystem::path &path)
+{
+    if (subscription.recursive) {
+        return path != subscription.directory && IsWithin(path, subscription.directory);
+    }
+    return path.parent_path() == subscription.directory;
+}
+
+} // namespace JzRE
@@ -0,0 +1,103 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Platform/FileSystem/JzPollingFileWatchBackend.h"
+
+namespace JzRE {
+
+JzPollingFileWatchBackend::JzPollingFileWatchBackend(F32 intervalSeconds) :
+    m_interval(intervalSeconds) { }
+
+Bool JzPollingFileWatchBackend::AddDirectory(const std::filesystem::path &directory, Bool recursive)
+{
+    std::error_code ec;
+    if (!std::filesystem::is_directory(directory, ec)) {
+        return false;
+    }
+
+    auto &watched     = m_directories[directory.string()];
+    watched.recursive = watched.recursive || recursive;
+    watched.snapshot  = Scan(directory, watched.recursive);
+    return true;
+}
+
+void JzPollingFileWatchBackend::RemoveDirectory(const std::filesystem::path &directory)
+{
+    m_directories.erase(directory.string());
+}
+
+void JzPollingFileWatchBackend::Poll(F32 deltaSeconds, std::vector<JzFileChange> &outChanges)
+{
+    m_timeSinceScan += deltaSeconds;
+    if (m_timeSinceScan < m_interval) {
+        return;
+    }
+    m_timeSinceScan = 0.0f;
+
+    for (auto &[directory, watched] : m_directories) {
+        JzSnapshot current = Scan(directory, watched.recursive);
+
+        for (const auto &[path, stamp] : current) {
+            auto previous = watched.snapshot.find(path);
+            if (previous == watched.snapshot.end()) {
+                outChanges.push_back({path, JzEFileChangeKind::Added});
+            } else if (previous->second.writeTime != stamp.writeTime || previous->second.size != stamp.size) {
+                outChanges.push_back({path, JzEFileChangeKind::Modified});
+            }
+        }
+        for (const auto &[path, stamp] : watched.snapshot) {
+            if (!current.contains(path)) {
+                outChanges.push_back({path, JzEFileChangeKind::Removed});
+            }
+        }
+
+        watched.snapshot = std::move(current);
+    }
+}
+
+const char *JzPollingFileWatchBackend::GetName() const
+{
+    return "polling";
+}
+
+JzPollingFileWatchBackend::JzSnapshot JzPollingFileWatchBackend::Scan(const std::filesystem::path &directory, Bool recursive)
+{
+    namespace fs = std::filesystem;
+
+    JzSnapshot snapshot;
+
+    const auto record = [&snapshot](const fs::directory_entry &entry) {
+        std::error_code ec;
+        if (!entry.is_regular_file(ec)) {
+            return;
+        }
+
+        JzFileStamp stamp;
+        stamp.writeTime = entry.last_write_time(ec);
+        stamp.size      = entry.file_size(ec);
+        snapshot.emplace(entry.path().lexically_normal().string(), stamp);
+    };
+
+    std::error_code ec;
+    if (recursive) {
+        for (fs::recursive_directory_iterator it(directory, fs::directory_options::skip_permission_denied, ec), end;
+             it != end; it.increment(ec)) {
+            if (!ec) {
+                record(*it);
+            }
+        }
+    } else {
+        for (fs::directory_iterator it(directory, fs::directory_options::skip_permission_denied, ec), end;
+             it != end; it.increment(ec)) {
+            if (!ec) {
+                record(*it);
+            }
+        }
+    }
+
+    return snapshot;
+}
+
+} // namespace JzRE
@@ -0,0 +1,291 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#ifdef __linux__
+
+#include "JzRE/Runtime/Platform/FileSystem/JzIFileWatchBackend.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <unordered_map>
+#include <sys/inotify.h>
+#include <unistd.h>
+#include "JzRE/Runtime/Core/JzLogger.h"
+
+namespace JzRE {
+
+namespace {
+
+/**
+ * @brief inotify backend
+ *
+ * inotify watches single directories, so recursive roots get one watch per
+ * subdirectory and directories created later are added as they appear. The
+ * descriptor is non-blocking and drained in Poll, no thread is needed.
+ *
+ * A directory rename arrives as IN_MOVED_FROM and IN_MOVED_TO with the same
+ * cookie. Watches follow the inode, so the pair only rekeys the watches of
+ * the moved subtree to the new path and reports one Renamed change.
+ */
+class JzInotifyFileWatchBackend : public JzIFileWatchBackend {
+public:
+    explicit JzInotifyFileWatchBackend(int fd) :
+        m_fd(fd) { }
+
+    ~JzInotifyFileWatchBackend() override
+    {
+        close(m_fd);
+    }
+
+    Bool AddDirectory(const std::filesystem::path &directory, Bool recursive) override
+    {
+        std::error_code ec;
+        if (!std::filesystem::is_directory(directory, ec)) {
+            return false;
+        }
+
+        Bool &rootRecursive = m_roots[directory.string()];
+        rootRecursive       = rootRecursive || recursive;
+
+        if (!AddWatch(directory)) {
+            return false;
+        }
+        if (rootRecursive) {
+            AddSubdirectoryWatches(directory, nullptr);
+        }
+        return true;
+    }
+
+    void RemoveDirectory(const std::filesystem::path &directory) override
+    {
+        m_roots.erase(directory.string());
+        RemoveWatches(directory, false);
+    }
+
+    void Poll(F32 deltaSeconds, std::vector<JzFileChange> &outChanges) override
+    {
+        alignas(inotify_event) char buffer[16 * 1024];
+
+        while (true) {
+            const ssize_t length = read(m_fd, buffer, sizeof(buffer));
+            if (length <= 0) {
+                if (length < 0 && errno != EAGAIN && errno != EINTR) {
+                    JzRE_LOG_WARN("JzInotifyFileWatchBackend: read failed: {}", std::strerror(errno));
+                }
+                FinishUnpairedMoves(outChanges);
+                return;
+            }
+
+            for (const char *cursor = buffer; cursor < buffer + length;) {
+                const auto *event = reinterpret_cast<const inotify_event *>(cursor);
+                cursor += sizeof(inotify_event) + event->len;
+                HandleEvent(*event, outChanges);
+            }
+        }
+    }
+
+    const char *GetName() const override
+    {
+        return "inotify";
+    }
+
+private:
+    static constexpr U32 WatchMask = IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB |
+                                     IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_ONLYDIR;
+
+    static Bool IsWithin(const std::filesystem::path &path, const std::filesystem::path &directory)
+    {
+        auto [dirIt, pathIt] = std::mismatch(directory.begin(), directory.end(), path.begin(), path.end());
+        return dirIt == directory.end();
+    }
+
+    /**
+     * @brief Whether a directory still belongs to one of the watched roots
+     */
+    Bool IsCovered(const std::filesystem::path &directory) const
+    {
+        for (const auto &[root, recursive] : m_roots) {
+            if (directory == std::filesystem::path(root) || (recursive && IsWithin(directory, root))) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    Bool AddWatch(const std::filesystem::path &directory)
+    {
+        const int watch = inotify_add_watch(m_fd, directory.c_str(), WatchMask);
+        if (watch < 0) {
+            JzRE_LOG_WARN("JzInotifyFileWatchBackend: cannot watch '{}': {}", directory.string(), std::strerror(errno));
+            return false;
+        }
+
+        m_watchToDirectory[watch]              = directory;
+        m_directoryToWatch[directory.string()] = watch;
+        return true;
+    }
+
+    /**
+     * @brief Drop the watches on `directory` and below, keeping the ones a root still covers unless `all`
+     */
+    void RemoveWatches(const std::filesystem::path &directory, Bool all)
+    {
+        for (auto it = m_directoryToWatch.begin(); it != m_directoryToWatch.end();) {
+            const std::filesystem::path watchedDirectory = it->first;
+            if (IsWithin(watchedDirectory, directory) && (all || !IsCovered(watchedDirectory))) {
+                inotify_rm_watch(m_fd, it->second);
+                m_watchToDirectory.erase(it->second);
+                it = m_directoryToWatch.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    /**
+     * @brief Rekey the watches of a moved subtree from `from` to `to`
+     */
+    void MoveWatches(const std::filesystem::path &from, const std::filesystem::path &to)
+    {
+        std::vector<std::pair<std::filesystem::path, int>> moved;
+        for (auto it = m_directoryToWatch.begin(); it != m_directoryToWatch.end();) {
+            const std::filesystem::path watchedDirectory = it->first;
+            if (IsWithin(watchedDirectory, from)) {
+                const auto relative = watchedDirectory.lexically_relative(from);
+                moved.emplace_back(relative == "." ? to : to / relative, it->second);
+                it = m_directoryToWatch.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        for (const auto &[directory, watch] : moved) {
+            m_watchToDirectory[watch]              = directory;
+            m_directoryToWatch[directory.string()] = watch;
+        }
+    }
+
+    /**
+     * @brief A directory moved out of the watched tree has no IN_MOVED_TO, report it as removed
+     */
+    void FinishUnpairedMoves(std::vector<JzFileChange> &outChanges)
+    {
+        for (const auto &[cookie, path] : m_movedFrom) {
+            RemoveWatches(path, true);
+            outChanges.push_back({path, JzEFileChangeKind::Removed});
+        }
+        m_movedFrom.clear();
+    }
+
+    /**
+     * @brief Watch every directory below `directory`, reporting the files found as added if requested
+     */
+    void AddSubdirectoryWatches(const std::filesystem::path &directory, std::vector<JzFileChange> *outAdded)
+    {
+        namespace fs = std::filesystem;
+
+        std::error_code ec;
+        for (fs::recursive_directory_iterator it(directory, fs::directory_options::skip_permission_denied, ec), end;
+             it != end; it.increment(ec)) {
+            if (ec) {
+                continue;
+            }
+            if (it->is_directory(ec)) {
+                AddWatch(it->path().lexically_normal());
+            } else if (outAdded) {
+                outAdded->push_back({it->path().lexically_normal(), JzEFileChangeKind::Added});
+            }
+        }
+    }
+
+    void HandleEvent(const inotify_event &event, std::vector<JzFileChange> &outChanges)
+    {
+        if (event.mask & IN_Q_OVERFLOW) {
+            JzRE_LOG_WARN("JzInotifyFileWatchBackend: event queue overflowed, requesting rescan");
+            for (const auto &[root, recursive] : m_roots) {
+                outChanges.push_back({root, JzEFileChangeKind::Rescan});
+            }
+            return;
+        }
+
+        auto directory = m_watchToDirectory.find(event.wd);
+        if (directory == m_watchToDirectory.end()) {
+            return;
+        }
+
+        if (event.mask & IN_IGNORED) {
+            // The directory was deleted or unwatched
+            m_directoryToWatch.erase(directory->second.string());
+            m_watchToDirectory.erase(directory);
+            return;
+        }
+        if (event.len == 0) {
+            return;
+        }
+
+        const auto path = directory->second / event.name;
+
+        if (event.mask & IN_ISDIR) {
+            if (event.mask & IN_MOVED_FROM) {
+                // Paired with IN_MOVED_TO by cookie, or reported as removed once Poll drained the queue
+                m_movedFrom[event.cookie] = path;
+                return;
+            }
+
+            auto movedFrom = m_movedFrom.end();
+            if (event.mask & IN_MOVED_TO) {
+                movedFrom = m_movedFrom.find(event.cookie);
+            }
+            if (movedFrom != m_movedFrom.end()) {
+                const auto previousPath = movedFrom->second;
+                m_movedFrom.erase(movedFrom);
+
+                if (IsCovered(path)) {
+                    MoveWatches(previousPath, path);
+                } else {
+                    RemoveWatches(previousPath, true);
+                }
+                outChanges.push_back({path, JzEFileChangeKind::Renamed, previousPath});
+            } else if ((event.mask & (IN_CREATE | IN_MOVED_TO)) && IsCovered(path)) {
+                // Files written before the new directory's watch existed are reported here
+                AddWatch(path);
+                AddSubdirectoryWatches(path, &outChanges);
+            }
+            return;
+        }
+
+        if (event.mask & (IN_CREATE | IN_MOVED_TO)) {
+            outChanges.push_back({path, JzEFileChangeKind::Added});
+        } else if (event.mask & (IN_DELETE | IN_MOVED_FROM)) {
+            outChanges.push_back({path, JzEFileChangeKind::Removed});
+        } else if (event.mask & (IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB)) {
+            outChanges.push_back({path, JzEFileChangeKind::Modified});
+        }
+    }
+
+private:
+    int                                            m_fd;
+    std::unordered_map<String, Bool>               m_roots; ///< Watched root -> recursive
+    std::unordered_map<int, std::filesystem::path> m_watchToDirectory;
+    std::unordered_map<String, int>                m_directoryToWatch;
+    std::unordered_map<U32, std::filesystem::path> m_movedFrom; ///< Cookie -> old path of a directory waiting for IN_MOVED_TO
+};
+
+} // namespace
+
+std::unique_ptr<JzIFileWatchBackend> JzIFileWatchBackend::CreateNative()
+{
+    const int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd < 0) {
+        JzRE_LOG_WARN("JzInotifyFileWatchBackend: inotify unavailable: {}", std::strerror(errno));
+        return nullptr;
+    }
+    return std::make_unique<JzInotifyFileWatchBackend>(fd);
+}
+
+} // namespace JzRE
+
+#endif // __linux__
@@ -22,6 +22,9 @@ JzRE::JzOpenGLBuffer::JzOpenGLBuffer(const JzRE::JzGPUBufferObjectDesc &desc) :
         case JzEGPUBufferObjectType::Storage:
             m_target = GL_SHADER_STORAGE_BUFFER;
             break;
+        case JzEGPUBufferObjectType::Indirect:
+            m_target = GL_DRAW_INDIRECT_BUFFER;
+            break;
         default:
             m_target = GL_ARRAY_BUFFER;
             break;
@@ -47,6 +50,7 @@ JzRE::JzOpenGLBuffer::JzOpenGLBuffer(const JzRE::JzGPUBufferObjectDesc &desc) :
     glGenBuffers(1, &m_handle);
 
     // Bind buffer and allocate memory
+    DetachVertexArray();
     glBindBuffer(m_target, m_handle);
     glBufferData(m_target, desc.size, desc.data, m_usage);
     glBindBuffer(m_target, 0);
@@ -67,6 +71,7 @@ void JzRE::JzOpenGLBuffer::UpdateData(const void *data, JzRE::Size size, JzRE::S
     }
 
     // Bind buffer
+    DetachVertexArray();
     glBindBuffer(m_target, m_handle);
 
     // Update buffer data
@@ -86,6 +91,7 @@ void JzRE::JzOpenGLBuffer::UpdateData(const void *data, JzRE::Size size, JzRE::S
 void *JzRE::JzOpenGLBuffer::MapBuffer()
 {
     // Bind buffer
+    DetachVertexArray();
     glBindBuffer(m_target, m_handle);
 
     // Map buffer to memory, allow read and write access
@@ -107,4 +113,13 @@ void JzRE::JzOpenGLBuffer::UnmapBuffer()
 GLuint JzRE::JzOpenGLBuffer::GetHandle() const
 {
     return m_handle;
-}
\ No newline at end of file
+}
+
+void JzRE::JzOpenGLBuffer::DetachVertexArray() const
+{
+    // GL_ELEMENT_ARRAY_BUFFER is VAO state: binding it while a VAO is bound would
+    // overwrite (and the trailing unbind would clear) that VAO's index buffer.
+    if (m_target == GL_ELEMENT_ARRAY_BUFFER) {
+        glBindVertexArray(0);
+    }
+}
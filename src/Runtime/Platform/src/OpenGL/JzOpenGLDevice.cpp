@@ -5,8 +5,10 @@
 
 #include "JzRE/Runtime/Platform/OpenGL/JzOpenGLDevice.h"
 
+#include <cstring>
 #include <iostream>
 
+#include "JzRE/Runtime/Core/JzProfiler.h"
 #include "JzRE/Runtime/Platform/OpenGL/JzOpenGLBuffer.h"
 #include "JzRE/Runtime/Platform/OpenGL/JzOpenGLTexture.h"
 
@@ -52,6 +54,7 @@ std::shared_ptr<JzRE::JzGPUTextureObject> JzRE::JzOpenGLDevice::CreateTexture(co
 {
     auto texture = std::make_shared<JzOpenGLTexture>(desc);
     m_stats.textures++;
+    m_stats.textureMemory += GetTextureMemorySize(desc);
     return texture;
 }
 
@@ -64,11 +67,24 @@ std::shared_ptr<JzRE::JzGPUShaderProgramObject> JzRE::JzOpenGLDevice::CreateShad
 
 std::shared_ptr<JzRE::JzRHIPipeline> JzRE::JzOpenGLDevice::CreatePipeline(const JzRE::JzPipelineDesc &desc)
 {
-    auto pipeline = std::make_shared<JzOpenGLPipeline>(desc);
+    auto pipeline = std::make_shared<JzOpenGLPipeline>(desc, m_programCache.get(),
+                                                       m_capabilities.supportsParallelShaderCompile);
     m_stats.pipelines++;
     return pipeline;
 }
 
+void JzRE::JzOpenGLDevice::SetPipelineCacheDirectory(const std::filesystem::path &directory)
+{
+    if (!m_capabilities.supportsProgramBinary) {
+        m_programCache.reset();
+        return;
+    }
+
+    // 驱动更新后旧的二进制不再有效，因此用驱动标识区分缓存项
+    const String driverIdentity = GetVendorName() + "|" + GetDeviceName() + "|" + GetDriverVersion();
+    m_programCache              = std::make_unique<JzOpenGLProgramCache>(directory, driverIdentity);
+}
+
 std::shared_ptr<JzRE::JzGPUFramebufferObject> JzRE::JzOpenGLDevice::CreateFramebuffer(const JzRE::String &debugName)
 {
     return std::make_shared<JzOpenGLFramebuffer>(debugName);
@@ -90,10 +106,16 @@ void JzRE::JzOpenGLDevice::ExecuteCommandList(std::shared_ptr<JzRE::JzRHICommand
         return;
     }
 
+    // Resource uploads between command lists bind textures/VAOs behind the cache
+    m_stateCache.InvalidateResourceBindings();
+
     const auto commands = commandList->GetCommands();
     for (const auto &command : commands) {
         DispatchCommand(command);
     }
+
+    m_stats.stateChangesIssued  = m_stateCache.GetIssuedCount();
+    m_stats.stateChangesSkipped = m_stateCache.GetSkippedCount();
 }
 
 void JzRE::JzOpenGLDevice::ExecuteCommandLists(
@@ -125,6 +147,12 @@ void JzRE::JzOpenGLDevice::DispatchCommand(const JzRE::JzRHIRecordedCommand &com
             }
             break;
         }
+        case JzRHIECommandType::DrawIndexedIndirect: {
+            if (const auto *payload = std::get_if<JzDrawIndexedIndirectParams>(&command.payload)) {
+                DrawIndexedIndirect(*payload);
+            }
+            break;
+        }
         case JzRHIECommandType::BindPipeline: {
             if (const auto *payload = std::get_if<JzRHIBindPipelinePayload>(&command.payload)) {
                 BindPipeline(payload->pipeline);
@@ -190,6 +218,19 @@ void JzRE::JzOpenGLDevice::DispatchCommand(const JzRE::JzRHIRecordedCommand &com
             }
             break;
         }
+        case JzRHIECommandType::BeginGpuZone: {
+            const auto *payload = std::get_if<JzRHIGpuZonePayload>(&command.payload);
+            if (payload && m_gpuTimer) {
+                m_gpuTimer->BeginZone(payload->name);
+            }
+            break;
+        }
+        case JzRHIECommandType::EndGpuZone: {
+            if (m_gpuTimer) {
+                m_gpuTimer->EndZone();
+            }
+            break;
+        }
     }
 }
 
@@ -213,9 +254,28 @@ void JzRE::JzOpenGLDevice::EndRenderPass(const JzRE::JzRHIEndRenderPassPayload &
 void JzRE::JzOpenGLDevice::BeginFrame()
 {
     // 重置统计信息
-    m_stats.drawCalls = 0;
-    m_stats.triangles = 0;
-    m_stats.vertices  = 0;
+    m_stats.drawCalls           = 0;
+    m_stats.triangles           = 0;
+    m_stats.vertices            = 0;
+    m_stats.indirectDraws       = 0;
+    m_stats.stateChangesIssued  = 0;
+    m_stats.stateChangesSkipped = 0;
+
+    // 帧耗时与 GPU 耗时
+    const U64 now = JzProfiler::NowNs();
+    if (m_lastFrameBeginNs != 0) {
+        m_stats.frameTime = static_cast<F32>(static_cast<F64>(now - m_lastFrameBeginNs) / 1.0e6);
+    }
+    m_lastFrameBeginNs = now;
+
+    if (m_gpuTimer) {
+        m_gpuTimer->BeginFrame();
+        m_stats.gpuTime = m_gpuTimer->GetLastFrameGpuTime();
+    }
+
+    // UI and platform code may touch GL between frames
+    m_stateCache.Invalidate();
+    m_stateCache.ResetCounters();
 }
 
 void JzRE::JzOpenGLDevice::EndFrame()
@@ -232,15 +292,26 @@ void JzRE::JzOpenGLDevice::SetRenderState(const JzRE::JzRenderState &state)
 
 void JzRE::JzOpenGLDevice::SetViewport(const JzRE::JzViewport &viewport)
 {
-    glViewport(static_cast<GLint>(viewport.x), static_cast<GLint>(viewport.y),
-               static_cast<GLsizei>(viewport.width), static_cast<GLsizei>(viewport.height));
-    glDepthRange(static_cast<F64>(viewport.minDepth), static_cast<F64>(viewport.maxDepth));
+    const auto x      = static_cast<GLint>(viewport.x);
+    const auto y      = static_cast<GLint>(viewport.y);
+    const auto width  = static_cast<GLsizei>(viewport.width);
+    const auto height = static_cast<GLsizei>(viewport.height);
+    if (m_stateCache.SetViewport(x, y, width, height)) {
+        glViewport(x, y, width, height);
+    }
+    if (m_stateCache.SetDepthRange(viewport.minDepth, viewport.maxDepth)) {
+        glDepthRange(static_cast<F64>(viewport.minDepth), static_cast<F64>(viewport.maxDepth));
+    }
 }
 
 void JzRE::JzOpenGLDevice::SetScissor(const JzRE::JzScissorRect &scissor)
 {
-    glEnable(GL_SCISSOR_TEST);
-    glScissor(scissor.x, scissor.y, static_cast<GLsizei>(scissor.width), static_cast<GLsizei>(scissor.height));
+    if (m_stateCache.SetScissorTestEnabled(true)) {
+        glEnable(GL_SCISSOR_TEST);
+    }
+    if (m_stateCache.SetScissor(scissor.x, scissor.y, scissor.width, scissor.height)) {
+        glScissor(scissor.x, scissor.y, static_cast<GLsizei>(scissor.width), static_cast<GLsizei>(scissor.height));
+    }
 }
 
 void JzRE::JzOpenGLDevice::Clear(const JzRE::JzClearParams &params)
@@ -326,11 +397,43 @@ void JzRE::JzOpenGLDevice::DrawIndexed(const JzRE::JzDrawIndexedParams &params)
     }
 }
 
+void JzRE::JzOpenGLDevice::DrawIndexedIndirect(const JzRE::JzDrawIndexedIndirectParams &params)
+{
+    // 每条绘制通过 baseInstance 读取实例属性，没有多重间接绘制时调用方不会走到这里
+    auto indirectBuffer = std::dynamic_pointer_cast<JzOpenGLBuffer>(params.indirectBuffer);
+    if (!indirectBuffer || params.drawCount == 0 || !m_capabilities.supportsMultiDrawIndirect) {
+        return;
+    }
+
+    if (m_currentPipeline) {
+        m_currentPipeline->CommitParameters();
+    }
+
+    GLenum mode = ConvertPrimitiveType(params.primitiveType);
+
+    // 间接缓冲区不经过状态缓存，每次绘制前重新绑定
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer->GetHandle());
+
+    glMultiDrawElementsIndirect(mode,
+                                GL_UNSIGNED_INT,
+                                reinterpret_cast<const void *>(params.offset),
+                                static_cast<GLsizei>(params.drawCount),
+                                static_cast<GLsizei>(params.stride));
+    m_stats.drawCalls++;
+
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+
+    // 更新统计信息
+    m_stats.indirectDraws += params.drawCount;
+}
+
 void JzRE::JzOpenGLDevice::BindPipeline(std::shared_ptr<JzRE::JzRHIPipeline> pipeline)
 {
     auto glPipeline = std::static_pointer_cast<JzOpenGLPipeline>(pipeline);
     if (glPipeline && glPipeline->IsLinked()) {
-        glUseProgram(glPipeline->GetProgram());
+        if (m_stateCache.SetProgram(glPipeline->GetProgram())) {
+            glUseProgram(glPipeline->GetProgram());
+        }
         ApplyRenderState(pipeline->GetRenderState());
         glPipeline->CommitParameters();
         m_currentPipeline = glPipeline;
@@ -341,7 +444,9 @@ void JzRE::JzOpenGLDevice::BindVertexArray(std::shared_ptr<JzRE::JzGPUVertexArra
 {
     auto glVertexArray = std::static_pointer_cast<JzOpenGLVertexArray>(vertexArray);
     if (glVertexArray) {
-        glBindVertexArray(glVertexArray->GetHandle());
+        if (m_stateCache.SetVertexArray(glVertexArray->GetHandle())) {
+            glBindVertexArray(glVertexArray->GetHandle());
+        }
         m_currentVertexArray = glVertexArray;
     }
 }
@@ -350,21 +455,30 @@ void JzRE::JzOpenGLDevice::BindTexture(std::shared_ptr<JzRE::JzGPUTextureObject>
 {
     auto glTexture = std::static_pointer_cast<JzOpenGLTexture>(texture);
     if (glTexture) {
-        glActiveTexture(GL_TEXTURE0 + slot);
-        glBindTexture(glTexture->GetTarget(), (GLuint)(uintptr_t)glTexture->GetTextureID());
+        const GLenum target = glTexture->GetTarget();
+        const GLuint handle = (GLuint)(uintptr_t)glTexture->GetTextureID();
+        if (m_stateCache.SetTexture(slot, target, handle)) {
+            if (m_stateCache.SetActiveTextureUnit(slot)) {
+                glActiveTexture(GL_TEXTURE0 + slot);
+            }
+            glBindTexture(target, handle);
+        }
     }
 }
 
 void JzRE::JzOpenGLDevice::BindFramebuffer(std::shared_ptr<JzRE::JzGPUFramebufferObject> framebuffer)
 {
     auto glFramebuffer = std::static_pointer_cast<JzOpenGLFramebuffer>(framebuffer);
-    if (glFramebuffer) {
-        glBindFramebuffer(GL_FRAMEBUFFER, glFramebuffer->GetHandle());
-        m_currentFramebuffer = glFramebuffer;
-    } else {
-        // 绑定到默认帧缓冲区
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
-        m_currentFramebuffer = nullptr;
+    // 0 绑定到默认帧缓冲区
+    const GLuint handle = glFramebuffer ? glFramebuffer->GetHandle() : 0;
+    if (m_stateCache.SetFramebuffer(handle)) {
+        glBindFramebuffer(GL_FRAMEBUFFER, handle);
+    }
+    m_currentFramebuffer = glFramebuffer;
+
+    // A scissor only lasts until the next framebuffer bind, as on Vulkan
+    if (m_stateCache.SetScissorTestEnabled(false)) {
+        glDisable(GL_SCISSOR_TEST);
     }
 }
 
@@ -389,6 +503,7 @@ void JzRE::JzOpenGLDevice::BlitFramebufferToScreen(std::shared_ptr<JzRE::JzGPUFr
 
     // Reset to default framebuffer
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    m_stateCache.SetFramebuffer(0);
     m_currentFramebuffer = nullptr;
 }
 
@@ -413,16 +528,56 @@ JzRE::Bool JzRE::JzOpenGLDevice::SupportsMultithreading() const
     return false;
 }
 
+JzRE::Bool JzRE::JzOpenGLDevice::SupportsMultiDrawIndirect() const
+{
+    return m_capabilities.supportsMultiDrawIndirect;
+}
+
+JzRE::Bool JzRE::JzOpenGLDevice::SupportsTextureFormat(JzRE::JzETextureResourceFormat format) const
+{
+    return m_capabilities.SupportsTextureFormat(format);
+}
+
+JzRE::Bool JzRE::JzOpenGLDevice::SupportsMipmapGeneration() const
+{
+    return true;
+}
+
 const JzRE::JzRHICapabilities &JzRE::JzOpenGLDevice::GetCapabilities() const
 {
     return m_capabilities;
 }
 
-JzRE::JzRHIStats &JzRE::JzOpenGLDevice::GetStats()
+const JzRE::JzRHIStats &JzRE::JzOpenGLDevice::GetStats() const
 {
     return m_stats;
 }
 
+void JzRE::JzOpenGLDevice::SetGpuProfilingEnabled(JzRE::Bool enabled)
+{
+    if (!enabled) {
+        m_gpuTimer.reset();
+        m_stats.gpuTime = 0.0f;
+        return;
+    }
+    if (!m_gpuTimer) {
+        m_gpuTimer = std::make_unique<JzOpenGLGpuTimer>();
+    }
+}
+
+std::vector<JzRE::JzRHIGpuZone> JzRE::JzOpenGLDevice::ConsumeGpuZones()
+{
+    if (!m_gpuTimer) {
+        return {};
+    }
+    return m_gpuTimer->Consume();
+}
+
+void JzRE::JzOpenGLDevice::InvalidateStateCache()
+{
+    m_stateCache.Invalidate();
+}
+
 void JzRE::JzOpenGLDevice::InitializeCapabilities()
 {
     // 获取纹理支持
@@ -461,54 +616,102 @@ void JzRE::JzOpenGLDevice::InitializeCapabilities()
     // OpenGL 不支持多线程渲染
     m_capabilities.supportsMultithreadedRendering = false;
     m_capabilities.maxRenderThreads               = 1;
+
+    // 检查程序二进制缓存与并行着色器编译支持
+    GLint programBinaryFormats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &programBinaryFormats);
+    m_capabilities.supportsProgramBinary         = programBinaryFormats > 0;
+    m_capabilities.supportsParallelShaderCompile = HasExtension("GL_KHR_parallel_shader_compile") ||
+                                                   HasExtension("GL_ARB_parallel_shader_compile");
+
+    GLint majorVersion = 0;
+    GLint minorVersion = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &majorVersion);
+    glGetIntegerv(GL_MINOR_VERSION, &minorVersion);
+    const Bool hasGL42 = majorVersion > 4 || (majorVersion == 4 && minorVersion >= 2);
+    const Bool hasGL43 = majorVersion > 4 || (majorVersion == 4 && minorVersion >= 3);
+
+    // 检查多重间接绘制支持 (OpenGL 4.3)，逐绘制的实例属性还需要 baseInstance (OpenGL 4.2)
+    const Bool hasBaseInstance               = hasGL42 || HasExtension("GL_ARB_base_instance");
+    m_capabilities.supportsMultiDrawIndirect = hasGL43 || (HasExtension("GL_ARB_multi_draw_indirect") && hasBaseInstance);
+
+    // 检查压缩纹理支持 (BC4/BC5 为 OpenGL 3.0 核心, BC7 为 OpenGL 4.2, ETC2 为 OpenGL 4.3)
+    m_capabilities.supportsTextureCompressionBC   = HasExtension("GL_EXT_texture_compression_s3tc") &&
+                                                    (hasGL42 || HasExtension("GL_ARB_texture_compression_bptc"));
+    m_capabilities.supportsTextureCompressionETC2 = hasGL43 || HasExtension("GL_ARB_ES3_compatibility");
+    m_capabilities.supportsTextureCompressionASTC = HasExtension("GL_KHR_texture_compression_astc_ldr");
+}
+
+JzRE::Bool JzRE::JzOpenGLDevice::HasExtension(const char *name) const
+{
+    GLint extensionCount = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+    for (GLint index = 0; index < extensionCount; ++index) {
+        const char *extension = reinterpret_cast<const char *>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(index)));
+        if (extension && std::strcmp(extension, name) == 0) {
+            return true;
+        }
+    }
+    return false;
 }
 
 void JzRE::JzOpenGLDevice::ApplyRenderState(const JzRE::JzRenderState &state)
 {
     // 设置深度测试
-    if (state.depthTest) {
-        glEnable(GL_DEPTH_TEST);
+    if (m_stateCache.SetDepthTestEnabled(state.depthTest)) {
+        state.depthTest ? glEnable(GL_DEPTH_TEST) : glDisable(GL_DEPTH_TEST);
+    }
+    if (state.depthTest && m_stateCache.SetDepthFunc(ConvertDepthFunc(state.depthFunc))) {
         glDepthFunc(ConvertDepthFunc(state.depthFunc));
-    } else {
-        glDisable(GL_DEPTH_TEST);
     }
 
     // 设置深度写入
-    glDepthMask(state.depthWrite ? GL_TRUE : GL_FALSE);
+    if (m_stateCache.SetDepthMask(state.depthWrite)) {
+        glDepthMask(state.depthWrite ? GL_TRUE : GL_FALSE);
+    }
 
     // 设置面剪裁
-    if (state.cullMode != JzECullMode::None) {
-        glEnable(GL_CULL_FACE);
+    const Bool cullEnabled = state.cullMode != JzECullMode::None;
+    if (m_stateCache.SetCullFaceEnabled(cullEnabled)) {
+        cullEnabled ? glEnable(GL_CULL_FACE) : glDisable(GL_CULL_FACE);
+    }
+    if (cullEnabled && m_stateCache.SetCullFace(ConvertCullMode(state.cullMode))) {
         glCullFace(ConvertCullMode(state.cullMode));
-    } else {
-        glDisable(GL_CULL_FACE);
     }
 
     // 设置混合模式
-    if (state.blendMode != JzEBlendMode::None) {
-        glEnable(GL_BLEND);
+    const Bool blendEnabled = state.blendMode != JzEBlendMode::None;
+    if (m_stateCache.SetBlendEnabled(blendEnabled)) {
+        blendEnabled ? glEnable(GL_BLEND) : glDisable(GL_BLEND);
+    }
+    if (blendEnabled) {
+        GLenum srcFactor = GL_ONE;
+        GLenum dstFactor = GL_ZERO;
         switch (state.blendMode) {
             case JzEBlendMode::Alpha:
-                glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+                srcFactor = GL_SRC_ALPHA;
+                dstFactor = GL_ONE_MINUS_SRC_ALPHA;
                 break;
             case JzEBlendMode::Additive:
-                glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+                srcFactor = GL_SRC_ALPHA;
+                dstFactor = GL_ONE;
                 break;
             case JzEBlendMode::Multiply:
-                glBlendFunc(GL_DST_COLOR, GL_ZERO);
+                srcFactor = GL_DST_COLOR;
+                dstFactor = GL_ZERO;
                 break;
             default:
                 break;
         }
-    } else {
-        glDisable(GL_BLEND);
+        if (m_stateCache.SetBlendFunc(srcFactor, dstFactor)) {
+            glBlendFunc(srcFactor, dstFactor);
+        }
     }
 
     // 设置线框模式
-    if (state.wireframe) {
-        glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-    } else {
-        glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+    const GLenum polygonMode = state.wireframe ? GL_LINE : GL_FILL;
+    if (m_stateCache.SetPolygonMode(polygonMode)) {
+        glPolygonMode(GL_FRONT_AND_BACK, polygonMode);
     }
 }
 
@@ -75,6 +75,12 @@ void JzRE::JzOpenGLFramebuffer::AttachDepthTexture(std::shared_ptr<JzRE::JzGPUTe
     // Attach depth texture
     glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, glTexture->GetTarget(), (GLuint)(uintptr_t)glTexture->GetTextureID(), 0);
 
+    // A depth-only framebuffer is incomplete while it still reads and draws color
+    if (m_colorAttachments.empty()) {
+        glDrawBuffer(GL_NONE);
+        glReadBuffer(GL_NONE);
+    }
+
     // Store attached texture
     m_depthAttachment = texture;
 
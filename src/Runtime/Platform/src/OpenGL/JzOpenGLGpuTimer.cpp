@@ -0,0 +1,119 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Platform/OpenGL/JzOpenGLGpuTimer.h"
+
+#include <algorithm>
+#include <limits>
+#include "JzRE/Runtime/Core/JzProfiler.h"
+
+JzRE::JzOpenGLGpuTimer::~JzOpenGLGpuTimer()
+{
+    for (auto &frame : m_frames) {
+        for (const auto &zone : frame.zones) {
+            m_freeQueries.push_back(zone.beginQuery);
+            m_freeQueries.push_back(zone.endQuery);
+        }
+        frame.zones.clear();
+    }
+
+    if (!m_freeQueries.empty()) {
+        glDeleteQueries(static_cast<GLsizei>(m_freeQueries.size()), m_freeQueries.data());
+    }
+}
+
+void JzRE::JzOpenGLGpuTimer::BeginFrame()
+{
+    // Zones left open by the previous frame are closed so their queries resolve
+    while (!m_openZones.empty()) {
+        EndZone();
+    }
+
+    m_frameSlot = (m_frameSlot + 1) % FrameLatency;
+    auto &frame = m_frames[m_frameSlot];
+    ResolveFrame(frame);
+
+    GLint64 gpuNow = 0;
+    glGetInteger64v(GL_TIMESTAMP, &gpuNow);
+    frame.calibrationOffsetNs = static_cast<I64>(JzProfiler::NowNs()) - static_cast<I64>(gpuNow);
+}
+
+void JzRE::JzOpenGLGpuTimer::BeginZone(const JzRE::String &name)
+{
+    auto &frame = m_frames[m_frameSlot];
+
+    JzZone zone;
+    zone.name       = name;
+    zone.beginQuery = AcquireQuery();
+    zone.endQuery   = AcquireQuery();
+    glQueryCounter(zone.beginQuery, GL_TIMESTAMP);
+
+    m_openZones.push_back(frame.zones.size());
+    frame.zones.push_back(std::move(zone));
+}
+
+void JzRE::JzOpenGLGpuTimer::EndZone()
+{
+    if (m_openZones.empty()) {
+        return;
+    }
+
+    auto &zone = m_frames[m_frameSlot].zones[m_openZones.back()];
+    m_openZones.pop_back();
+    glQueryCounter(zone.endQuery, GL_TIMESTAMP);
+}
+
+std::vector<JzRE::JzRHIGpuZone> JzRE::JzOpenGLGpuTimer::Consume()
+{
+    std::vector<JzRHIGpuZone> zones;
+    zones.swap(m_resolved);
+    return zones;
+}
+
+GLuint JzRE::JzOpenGLGpuTimer::AcquireQuery()
+{
+    if (m_freeQueries.empty()) {
+        m_freeQueries.resize(32);
+        glGenQueries(static_cast<GLsizei>(m_freeQueries.size()), m_freeQueries.data());
+    }
+
+    const GLuint query = m_freeQueries.back();
+    m_freeQueries.pop_back();
+    return query;
+}
+
+void JzRE::JzOpenGLGpuTimer::ResolveFrame(JzFrame &frame)
+{
+    U64 frameBegin = std::numeric_limits<U64>::max();
+    U64 frameEnd   = 0;
+
+    for (const auto &zone : frame.zones) {
+        GLint available = GL_FALSE;
+        glGetQueryObjectiv(zone.endQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+
+        if (available == GL_TRUE) {
+            GLuint64 gpuBegin = 0;
+            GLuint64 gpuEnd   = 0;
+            glGetQueryObjectui64v(zone.beginQuery, GL_QUERY_RESULT, &gpuBegin);
+            glGetQueryObjectui64v(zone.endQuery, GL_QUERY_RESULT, &gpuEnd);
+
+            JzRHIGpuZone resolved;
+            resolved.name    = zone.name;
+            resolved.beginNs = static_cast<U64>(static_cast<I64>(gpuBegin) + frame.calibrationOffsetNs);
+            resolved.endNs   = static_cast<U64>(static_cast<I64>(gpuEnd) + frame.calibrationOffsetNs);
+            frameBegin       = std::min(frameBegin, resolved.beginNs);
+            frameEnd         = std::max(frameEnd, resolved.endNs);
+            m_resolved.push_back(std::move(resolved));
+        }
+
+        m_freeQueries.push_back(zone.beginQuery);
+        m_freeQueries.push_back(zone.endQuery);
+    }
+
+    if (frameEnd > frameBegin) {
+        m_lastFrameGpuTime = static_cast<F32>(static_cast<F64>(frameEnd - frameBegin) / 1.0e6);
+    }
+    frame.zones.clear();
+}
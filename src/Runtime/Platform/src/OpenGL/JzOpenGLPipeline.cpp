@@ -8,21 +8,46 @@
 #include <array>
 #include <type_traits>
 
-JzRE::JzOpenGLPipeline::JzOpenGLPipeline(const JzRE::JzPipelineDesc &desc) :
-    JzRE::JzRHIPipeline(desc)
+#include "JzRE/Runtime/Platform/OpenGL/JzOpenGLProgramCache.h"
+
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+JzRE::JzOpenGLPipeline::JzOpenGLPipeline(const JzRE::JzPipelineDesc &desc, const JzRE::JzOpenGLProgramCache *programCache,
+                                         JzRE::Bool parallelCompile) :
+    JzRE::JzRHIPipeline(desc),
+    m_programCache(desc.cacheKey.empty() ? nullptr : programCache)
 {
     // Create OpenGL program object
     m_program = glCreateProgram();
 
+    // A cached binary skips compilation entirely
+    if (m_programCache && m_programCache->Load(desc.cacheKey, m_program)) {
+        m_isLinked        = true;
+        m_loadedFromCache = true;
+        return;
+    }
+    if (m_programCache) {
+        glProgramParameteri(m_program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
     // Create and add all shaders
     for (const auto &shaderDesc : desc.shaders) {
-        auto shader = std::make_shared<JzOpenGLShader>(shaderDesc);
+        auto shader = std::make_shared<JzOpenGLShader>(shaderDesc, parallelCompile);
         if (shader->IsCompiled()) {
             m_shaders.push_back(shader);
             glAttachShader(m_program, shader->GetHandle());
         }
     }
 
+    // Parallel compile: the result is collected by IsReady()/IsLinked()
+    if (parallelCompile) {
+        glLinkProgram(m_program);
+        m_linkPending = true;
+        return;
+    }
+
     // Try to link program
     LinkProgram();
 }
@@ -44,11 +69,38 @@ GLuint JzRE::JzOpenGLPipeline::GetProgram() const
     return m_program;
 }
 
-JzRE::Bool JzRE::JzOpenGLPipeline::IsLinked() const
+JzRE::Bool JzRE::JzOpenGLPipeline::IsLinked()
 {
+    if (m_linkPending) {
+        FinalizeLink();
+    }
     return m_isLinked;
 }
 
+JzRE::Bool JzRE::JzOpenGLPipeline::IsLoadedFromCache() const
+{
+    return m_loadedFromCache;
+}
+
+JzRE::Bool JzRE::JzOpenGLPipeline::IsReady()
+{
+    if (!m_linkPending) {
+        return true;
+    }
+
+    GLint completed = GL_FALSE;
+    glGetProgramiv(m_program, GL_COMPLETION_STATUS_KHR, &completed);
+    if (completed == GL_TRUE) {
+        FinalizeLink();
+    }
+    return !m_linkPending;
+}
+
+JzRE::Bool JzRE::JzOpenGLPipeline::HasFailed()
+{
+    return IsReady() && !m_isLinked;
+}
+
 const JzRE::String &JzRE::JzOpenGLPipeline::GetLinkLog() const
 {
     return m_linkLog;
@@ -56,11 +108,11 @@ const JzRE::String &JzRE::JzOpenGLPipeline::GetLinkLog() const
 
 void JzRE::JzOpenGLPipeline::CommitParameters()
 {
-    if (!m_isLinked || !HasDirtyParameters()) {
+    if (!IsLinked() || !HasDirtyParameters()) {
         return;
     }
 
-    glUseProgram(m_program);
+    // The device binds the program through its state cache before committing
 
     for (const auto &[name, value] : GetParameterCache()) {
         const GLint location = GetUniformLocation(name);
@@ -103,6 +155,25 @@ JzRE::Bool JzRE::JzOpenGLPipeline::LinkProgram()
     // Link program
     glLinkProgram(m_program);
 
+    return FinalizeLink();
+}
+
+JzRE::Bool JzRE::JzOpenGLPipeline::FinalizeLink()
+{
+    m_linkPending = false;
+
+    // Resolve deferred shader compile results so their logs are available
+    for (auto it = m_shaders.begin(); it != m_shaders.end();) {
+        const GLuint handle = (*it)->GetHandle();
+        if (!(*it)->ResolveCompileStatus()) {
+            glDetachShader(m_program, handle);
+            m_linkLog += (*it)->GetCompileLog();
+            it = m_shaders.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
     // Check link status
     GLint linkStatus;
     glGetProgramiv(m_program, GL_LINK_STATUS, &linkStatus);
@@ -114,7 +185,7 @@ JzRE::Bool JzRE::JzOpenGLPipeline::LinkProgram()
     if (logLength > 0) {
         std::vector<char> log(logLength);
         glGetProgramInfoLog(m_program, logLength, nullptr, log.data());
-        m_linkLog = String(log.data());
+        m_linkLog += String(log.data());
     }
 
     // If link failed, add error information
@@ -122,9 +193,14 @@ JzRE::Bool JzRE::JzOpenGLPipeline::LinkProgram()
         if (m_linkLog.empty()) {
             m_linkLog = "Program linking failed with unknown error";
         }
+        return false;
     }
 
-    return m_isLinked;
+    if (m_programCache) {
+        m_programCache->Store(desc.cacheKey, m_program);
+    }
+
+    return true;
 }
 
 GLint JzRE::JzOpenGLPipeline::GetUniformLocation(const JzRE::String &name)
@@ -0,0 +1,159 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Platform/OpenGL/JzOpenGLProgramCache.h"
+
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include "JzRE/Runtime/Core/JzLogger.h"
+
+namespace {
+
+constexpr JzRE::U32 kProgramCacheMagic   = 0x42505A4A; // "JZPB"
+constexpr JzRE::U32 kProgramCacheVersion = 1;
+
+struct JzProgramCacheHeader {
+    JzRE::U32 magic        = kProgramCacheMagic;
+    JzRE::U32 version      = kProgramCacheVersion;
+    JzRE::U64 driverHash   = 0;
+    JzRE::U32 binaryFormat = 0;
+    JzRE::U32 binarySize   = 0;
+};
+
+JzRE::U64 Fnv1a64(const JzRE::String &text)
+{
+    JzRE::U64 hash = 1469598103934665603ULL;
+    for (const unsigned char c : text) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+} // namespace
+
+JzRE::JzOpenGLProgramCache::JzOpenGLProgramCache(std::filesystem::path directory, String driverIdentity) :
+    m_directory(std::move(directory)),
+    m_driverIdentity(std::move(driverIdentity)),
+    m_driverHash(Fnv1a64(m_driverIdentity))
+{
+    std::error_code ec;
+    std::filesystem::create_directories(m_directory, ec);
+    if (ec) {
+        JzRE_LOG_WARN("JzOpenGLProgramCache: cannot create '{}': {}", m_directory.string(), ec.message());
+    }
+}
+
+JzRE::Bool JzRE::JzOpenGLProgramCache::Load(const String &cacheKey, GLuint program) const
+{
+    JzOpenGLProgramBinary binary;
+    if (!ReadBinary(cacheKey, binary)) {
+        return false;
+    }
+
+    glProgramBinary(program, binary.format, binary.data.data(), static_cast<GLsizei>(binary.data.size()));
+
+    GLint linkStatus = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    if (linkStatus != GL_TRUE) {
+        // Driver update or corrupt entry: drop it and let the caller recompile
+        Remove(cacheKey);
+        return false;
+    }
+
+    return true;
+}
+
+void JzRE::JzOpenGLProgramCache::Store(const String &cacheKey, GLuint program) const
+{
+    GLint binaryLength = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+    if (binaryLength <= 0) {
+        return;
+    }
+
+    JzOpenGLProgramBinary binary;
+    binary.data.resize(static_cast<Size>(binaryLength));
+    GLsizei written = 0;
+    glGetProgramBinary(program, binaryLength, &written, &binary.format, binary.data.data());
+    if (written <= 0) {
+        return;
+    }
+
+    binary.data.resize(static_cast<Size>(written));
+    WriteBinary(cacheKey, binary);
+}
+
+JzRE::Bool JzRE::JzOpenGLProgramCache::ReadBinary(const String &cacheKey, JzOpenGLProgramBinary &outBinary) const
+{
+    std::ifstream file(GetEntryPath(cacheKey), std::ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    JzProgramCacheHeader header;
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!file || header.magic != kProgramCacheMagic || header.version != kProgramCacheVersion ||
+        header.driverHash != m_driverHash || header.binarySize == 0) {
+        return false;
+    }
+
+    outBinary.format = header.binaryFormat;
+    outBinary.data.resize(header.binarySize);
+    file.read(outBinary.data.data(), static_cast<std::streamsize>(outBinary.data.size()));
+    return static_cast<Bool>(file);
+}
+
+JzRE::Bool JzRE::JzOpenGLProgramCache::WriteBinary(const String &cacheKey, const JzOpenGLProgramBinary &binary) const
+{
+    if (binary.data.empty()) {
+        return false;
+    }
+
+    JzProgramCacheHeader header;
+    header.driverHash   = m_driverHash;
+    header.binaryFormat = binary.format;
+    header.binarySize   = static_cast<U32>(binary.data.size());
+
+    // Write to a temporary file first so a crash never leaves a truncated entry
+    const auto path     = GetEntryPath(cacheKey);
+    auto       tempPath = path;
+    tempPath += ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.write(binary.data.data(), static_cast<std::streamsize>(binary.data.size()));
+        if (!file) {
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tempPath, path, ec);
+    if (ec) {
+        std::filesystem::remove(tempPath, ec);
+        return false;
+    }
+    return true;
+}
+
+void JzRE::JzOpenGLProgramCache::Remove(const String &cacheKey) const
+{
+    std::error_code ec;
+    std::filesystem::remove(GetEntryPath(cacheKey), ec);
+}
+
+std::filesystem::path JzRE::JzOpenGLProgramCache::GetEntryPath(const String &cacheKey) const
+{
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.glbin",
+                  static_cast<unsigned long long>(Fnv1a64(cacheKey + "|" + m_driverIdentity)));
+    return m_directory / name;
+}
@@ -5,10 +5,10 @@
 
 #include "JzRE/Runtime/Platform/OpenGL/JzOpenGLShader.h"
 
-JzRE::JzOpenGLShader::JzOpenGLShader(const JzRE::JzShaderProgramDesc &desc) :
+JzRE::JzOpenGLShader::JzOpenGLShader(const JzRE::JzShaderProgramDesc &desc, JzRE::Bool deferStatusCheck) :
     JzRE::JzGPUShaderProgramObject(desc)
 {
-    CompileShader();
+    CompileShader(deferStatusCheck);
 }
 
 JzRE::JzOpenGLShader::~JzOpenGLShader()
@@ -54,14 +54,47 @@ GLenum JzRE::JzOpenGLShader::ConvertShaderType(JzRE::JzEShaderProgramType type)
     }
 }
 
-JzRE::Bool JzRE::JzOpenGLShader::CompileShader()
+JzRE::Bool JzRE::JzOpenGLShader::ResolveCompileStatus()
+{
+    if (!m_statusPending) {
+        return m_isCompiled;
+    }
+    m_statusPending = false;
+
+    // Check compilation status
+    GLint compileStatus;
+    glGetShaderiv(m_handle, GL_COMPILE_STATUS, &compileStatus);
+
+    // Get compilation log
+    GLint logLength;
+    glGetShaderiv(m_handle, GL_INFO_LOG_LENGTH, &logLength);
+    if (logLength > 1) {
+        m_compileLog.resize(logLength);
+        glGetShaderInfoLog(m_handle, logLength, nullptr, m_compileLog.data());
+        // Remove trailing null characters
+        m_compileLog.resize(logLength - 1);
+    }
+
+    m_isCompiled = (compileStatus == GL_TRUE);
+
+    // If compilation failed, clean up resources
+    if (!m_isCompiled) {
+        glDeleteShader(m_handle);
+        m_handle = 0;
+    }
+
+    return m_isCompiled;
+}
+
+JzRE::Bool JzRE::JzOpenGLShader::CompileShader(JzRE::Bool deferStatusCheck)
 {
     // Clear previous compilation state
     if (m_handle != 0) {
         glDeleteShader(m_handle);
         m_handle = 0;
     }
-    m_isCompiled = false;
+    m_isCompiled    = false;
+    m_statusPending = false;
     m_compileLog.clear();
 
     // Convert shader type
@@ -95,27 +128,13 @@ JzRE::Bool JzRE::JzOpenGLShader::CompileShader()
     // Compile shader
     glCompileShader(m_handle);
 
-    // Check compilation status
-    GLint compileStatus;
-    glGetShaderiv(m_handle, GL_COMPILE_STATUS, &compileStatus);
-
-    // Get compilation log
-    GLint logLength;
-    glGetShaderiv(m_handle, GL_INFO_LOG_LENGTH, &logLength);
-    if (logLength > 1) {
-        m_compileLog.resize(logLength);
-        glGetShaderInfoLog(m_handle, logLength, nullptr, m_compileLog.data());
-        // Remove trailing null characters
-        m_compileLog.resize(logLength - 1);
-    }
-
-    m_isCompiled = (compileStatus == GL_TRUE);
-
-    // If compilation failed, clean up resources
-    if (!m_isCompiled) {
-        glDeleteShader(m_handle);
-        m_handle = 0;
+    // With parallel compilation the status query would stall until the driver
+    // finishes, so the caller resolves it once the program link completed
+    m_isCompiled    = true;
+    m_statusPending = true;
+    if (deferStatusCheck) {
+        return true;
     }
 
-    return m_isCompiled;
-}
+    return ResolveCompileStatus();
+}
\ No newline at end of file
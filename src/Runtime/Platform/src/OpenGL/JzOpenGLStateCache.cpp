@@ -0,0 +1,117 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Platform/OpenGL/JzOpenGLStateCache.h"
+
+void JzRE::JzOpenGLStateCache::Invalidate()
+{
+    const U32 issued  = m_issued;
+    const U32 skipped = m_skipped;
+
+    *this = JzOpenGLStateCache();
+
+    m_issued  = issued;
+    m_skipped = skipped;
+}
+
+void JzRE::JzOpenGLStateCache::InvalidateResourceBindings()
+{
+    m_vertexArray.valid = false;
+
+    // Deleted texture names are recycled, so any unit may name a different texture now
+    for (auto &texture : m_textures) {
+        texture.valid = false;
+    }
+}
+
+JzRE::Bool JzRE::JzOpenGLStateCache::SetProgram(GLuint program)
+{
+    return Update(m_program, program);
+}
+
+JzRE::Bool JzRE::JzOpenGLStateCache::SetVertexArray(GLuint vertexArray)
+{
+    return Update(m_vertexArray, vertexArray);
+}
+
+JzRE::Bool JzRE::JzOpenGLStateCache::SetFramebuffer(GLuint framebuffer)
+{
+    return Update(m_framebuffer, framebuffer);
+}
+
+JzRE::Bool JzRE::JzOpenGLStateCache::SetActiveTextureUnit(U32 unit)
+{
+    return Update(m_activeTextureUnit, unit);
+}
+
+JzRE::Bool JzRE::JzOpenGLStateCache::SetTexture(U32 unit, GLenum target, GLuint texture)
+{
+    if (unit >= kMaxTextureUnits) {
+        // Untracked unit: always issue
+        ++m_issued;
+        return true;
+    }
+    return Update(m_textures[unit], JzTextureBinding{target, texture});
+}
+
+JzRE::Bool JzRE::JzOpenGLStateCache::SetDepthTestEnabled(Bool enabled)
+{
+    return Update(m_depthTest, enabled);
+}
+
+JzRE::Bool JzRE::JzOpenGLStateCache::SetDepthFunc(GLenum func)
+{
+    return Update(m_depthFunc, func);
+}
+
+JzRE::Bool JzRE::JzOpenGLStateCache::SetDepthMask(Bool writeEnabled)
+{
+    return Update(m_depthMask, writeEnabled);
+}
+
+JzRE::Bool JzRE::JzOpenGLStateCache::SetCullFaceEnabled(Bool enabled)
+{
+    return Update(m_cullFace, enabled);
+}
+
+JzRE::Bool JzRE::JzOpenGLStateCache::SetCullFace(GLenum face)
+{
+    return Update(m_cullFaceMode, face);
+}
+
+JzRE::Bool JzRE::JzOpenGLStateCache::SetBlendEnabled(Bool enabled)
+{
+    return Update(m_blend, enabled);
+}
+
+JzRE::Bool JzRE::JzOpenGLStateCache::SetBlendFunc(GLenum srcFactor, GLenum dstFactor)
+{
+    return Update(m_blendFunc, JzBlendFunc{srcFactor, dstFactor});
+}
+
+JzRE::Bool JzRE::JzOpenGLStateCache::SetPolygonMode(GLenum mode)
+{
+    return Update(m_polygonMode, mode);
+}
+
+JzRE::Bool JzRE::JzOpenGLStateCache::SetScissorTestEnabled(Bool enabled)
+{
+    return Update(m_scissorTest, enabled);
+}
+
+JzRE::Bool JzRE::JzOpenGLStateCache::SetScissor(I32 x, I32 y, U32 width, U32 height)
+{
+    return Update(m_scissor, JzRect{x, y, static_cast<I32>(width), static_cast<I32>(height)});
+}
+
+JzRE::Bool JzRE::JzOpenGLStateCache::SetViewport(I32 x, I32 y, I32 width, I32 height)
+{
+    return Update(m_viewport, JzRect{x, y, width, height});
+}
+
+JzRE::Bool JzRE::JzOpenGLStateCache::SetDepthRange(F32 nearValue, F32 farValue)
+{
+    return Update(m_depthRange, JzDepthRange{nearValue, farValue});
+}
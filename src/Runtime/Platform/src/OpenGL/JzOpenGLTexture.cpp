@@ -5,6 +5,28 @@
 
 #include "JzRE/Runtime/Platform/OpenGL/JzOpenGLTexture.h"
 
+#include <algorithm>
+
+// S3TC, ASTC and the BPTC/ETC2 core tokens are missing from older glad profiles
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+#ifndef GL_COMPRESSED_RGBA_BPTC_UNORM
+#define GL_COMPRESSED_RGBA_BPTC_UNORM 0x8E8C
+#endif
+#ifndef GL_COMPRESSED_RGB8_ETC2
+#define GL_COMPRESSED_RGB8_ETC2 0x9274
+#endif
+#ifndef GL_COMPRESSED_RGBA8_ETC2_EAC
+#define GL_COMPRESSED_RGBA8_ETC2_EAC 0x9278
+#endif
+#ifndef GL_COMPRESSED_RGBA_ASTC_4x4_KHR
+#define GL_COMPRESSED_RGBA_ASTC_4x4_KHR 0x93B0
+#endif
+
 JzRE::JzOpenGLTexture::JzOpenGLTexture(const JzRE::JzGPUTextureObjectDesc &desc) :
     JzRE::JzGPUTextureObject(desc)
 {
@@ -27,6 +49,30 @@ JzRE::JzOpenGLTexture::JzOpenGLTexture(const JzRE::JzGPUTextureObjectDesc &desc)
         glTexParameteri(m_target, GL_TEXTURE_WRAP_R, ConvertWrap(desc.wrapR));
     }
 
+    // Pre-built levels (e.g. cooked KTX2 data) are uploaded as they are, compressed or not
+    m_compressed = IsCompressedTextureFormat(desc.format);
+    if (desc.type == JzETextureResourceType::Texture2D && (!desc.mipData.empty() || m_compressed)) {
+        const U32 levelCount = desc.mipData.empty() ? 1 : std::min<U32>(std::max<U32>(1, desc.mipLevels),
+                                                                         static_cast<U32>(desc.mipData.size()));
+        glTexParameteri(m_target, GL_TEXTURE_BASE_LEVEL, 0);
+        glTexParameteri(m_target, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(levelCount - 1));
+
+        for (U32 level = 0; level < levelCount; ++level) {
+            const GLsizei width  = static_cast<GLsizei>(std::max<U32>(1, desc.width >> level));
+            const GLsizei height = static_cast<GLsizei>(std::max<U32>(1, desc.height >> level));
+            const void   *data   = desc.mipData.empty() ? desc.data : desc.mipData[level].data;
+            if (m_compressed) {
+                const auto size = static_cast<GLsizei>(GetTextureLevelSize(desc.format, desc.width, desc.height, level));
+                glCompressedTexImage2D(m_target, level, m_internalFormat, width, height, 0, size, data);
+            } else {
+                glTexImage2D(m_target, level, m_internalFormat, width, height, 0, m_format, m_type, data);
+            }
+        }
+
+        glBindTexture(m_target, 0);
+        return;
+    }
+
     // Allocate texture storage space
     switch (desc.type) {
         case JzETextureResourceType::Texture1D:
@@ -71,6 +117,16 @@ void JzRE::JzOpenGLTexture::UpdateData(const void *data, JzRE::U32 mipLevel, U32
 
     glBindTexture(m_target, m_handle);
 
+    if (m_compressed) {
+        if (desc.type == JzETextureResourceType::Texture2D) {
+            const auto size = static_cast<GLsizei>(GetTextureLevelSize(desc.format, desc.width, desc.height, mipLevel));
+            glCompressedTexSubImage2D(m_target, mipLevel, 0, 0, std::max<U32>(1, desc.width >> mipLevel),
+                                      std::max<U32>(1, desc.height >> mipLevel), m_internalFormat, size, data);
+        }
+        glBindTexture(m_target, 0);
+        return;
+    }
+
     switch (desc.type) {
         case JzETextureResourceType::Texture1D:
             glTexSubImage1D(m_target, mipLevel, 0, desc.width >> mipLevel, m_format, m_type, data);
@@ -97,6 +153,11 @@ void JzRE::JzOpenGLTexture::UpdateData(const void *data, JzRE::U32 mipLevel, U32
 
 void JzRE::JzOpenGLTexture::GenerateMipmaps()
 {
+    // Compressed mips are cooked offline; GL cannot render into compressed formats
+    if (m_compressed) {
+        return;
+    }
+
     glBindTexture(m_target, m_handle);
     glGenerateMipmap(m_target);
     glBindTexture(m_target, 0);
@@ -165,6 +226,22 @@ GLenum JzRE::JzOpenGLTexture::ConvertInternalFormat(JzRE::JzETextureResourceForm
             return GL_DEPTH_COMPONENT32F;
         case JzETextureResourceFormat::Depth24Stencil8:
             return GL_DEPTH24_STENCIL8;
+        case JzETextureResourceFormat::BC1:
+            return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+        case JzETextureResourceFormat::BC3:
+            return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        case JzETextureResourceFormat::BC4:
+            return GL_COMPRESSED_RED_RGTC1;
+        case JzETextureResourceFormat::BC5:
+            return GL_COMPRESSED_RG_RGTC2;
+        case JzETextureResourceFormat::BC7:
+            return GL_COMPRESSED_RGBA_BPTC_UNORM;
+        case JzETextureResourceFormat::ETC2RGB8:
+            return GL_COMPRESSED_RGB8_ETC2;
+        case JzETextureResourceFormat::ETC2RGBA8:
+            return GL_COMPRESSED_RGBA8_ETC2_EAC;
+        case JzETextureResourceFormat::ASTC4x4:
+            return GL_COMPRESSED_RGBA_ASTC_4x4_KHR;
         default:
             return GL_RGBA8;
     }
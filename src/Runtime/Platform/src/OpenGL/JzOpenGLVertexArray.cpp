@@ -101,6 +101,15 @@ void JzRE::JzOpenGLVertexArray::SetVertexAttribute(JzRE::U32 index, JzRE::U32 si
     );
 }
 
+void JzRE::JzOpenGLVertexArray::SetVertexAttributeDivisor(JzRE::U32 index, JzRE::U32 divisor)
+{
+    // Bind current VAO
+    glBindVertexArray(m_handle);
+
+    // Instanced attributes also honor the base instance of (multi-)indirect draws
+    glVertexAttribDivisor(index, divisor);
+}
+
 GLuint JzRE::JzOpenGLVertexArray::GetHandle() const
 {
     return m_handle;
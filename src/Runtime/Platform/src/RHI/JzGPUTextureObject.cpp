@@ -0,0 +1,138 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Platform/RHI/JzGPUTextureObject.h"
+
+#include <algorithm>
+#include <numeric>
+
+JzRE::Bool JzRE::IsCompressedTextureFormat(JzRE::JzETextureResourceFormat format)
+{
+    switch (format) {
+        case JzETextureResourceFormat::BC1:
+        case JzETextureResourceFormat::BC3:
+        case JzETextureResourceFormat::BC4:
+        case JzETextureResourceFormat::BC5:
+        case JzETextureResourceFormat::BC7:
+        case JzETextureResourceFormat::ETC2RGB8:
+        case JzETextureResourceFormat::ETC2RGBA8:
+        case JzETextureResourceFormat::ASTC4x4:
+            return true;
+        default:
+            return false;
+    }
+}
+
+JzRE::U32 JzRE::GetTextureFormatBlockSize(JzRE::JzETextureResourceFormat format)
+{
+    switch (format) {
+        case JzETextureResourceFormat::R8:
+            return 1;
+        case JzETextureResourceFormat::RG8:
+        case JzETextureResourceFormat::R16F:
+        case JzETextureResourceFormat::Depth16:
+            return 2;
+        case JzETextureResourceFormat::RGB8:
+            return 3;
+        case JzETextureResourceFormat::RGBA8:
+        case JzETextureResourceFormat::RG16F:
+        case JzETextureResourceFormat::R32F:
+        case JzETextureResourceFormat::Depth24:
+        case JzETextureResourceFormat::Depth32F:
+        case JzETextureResourceFormat::Depth24Stencil8:
+            return 4;
+        case JzETextureResourceFormat::RGB16F:
+            return 6;
+        case JzETextureResourceFormat::RGBA16F:
+        case JzETextureResourceFormat::RG32F:
+            return 8;
+        case JzETextureResourceFormat::RGB32F:
+            return 12;
+        case JzETextureResourceFormat::RGBA32F:
+            return 16;
+        case JzETextureResourceFormat::BC1:
+        case JzETextureResourceFormat::BC4:
+        case JzETextureResourceFormat::ETC2RGB8:
+            return 8;
+        case JzETextureResourceFormat::BC3:
+        case JzETextureResourceFormat::BC5:
+        case JzETextureResourceFormat::BC7:
+        case JzETextureResourceFormat::ETC2RGBA8:
+        case JzETextureResourceFormat::ASTC4x4:
+            return 16;
+        case JzETextureResourceFormat::Unknown:
+        default:
+            return 0;
+    }
+}
+
+JzRE::Size JzRE::GetTextureLevelSize(JzRE::JzETextureResourceFormat format, JzRE::U32 width, JzRE::U32 height,
+                                     JzRE::U32 mipLevel)
+{
+    const Size levelWidth  = GetTextureLevelExtent(width, mipLevel);
+    const Size levelHeight = GetTextureLevelExtent(height, mipLevel);
+    const Size blockSize   = GetTextureFormatBlockSize(format);
+
+    if (IsCompressedTextureFormat(format)) {
+        return ((levelWidth + 3) / 4) * ((levelHeight + 3) / 4) * blockSize;
+    }
+    return levelWidth * levelHeight * blockSize;
+}
+
+JzRE::U32 JzRE::GetTextureMipCount(JzRE::U32 width, JzRE::U32 height)
+{
+    U32 largest = std::max<U32>(1, std::max(width, height));
+    U32 count   = 1;
+    while (largest > 1) {
+        largest >>= 1;
+        ++count;
+    }
+    return count;
+}
+
+JzRE::U32 JzRE::GetTextureLevelExtent(JzRE::U32 extent, JzRE::U32 mipLevel)
+{
+    return mipLevel >= 32 ? 1 : std::max<U32>(1, extent >> mipLevel);
+}
+
+JzRE::Size JzRE::GetTextureUploadRegions(JzRE::JzETextureResourceFormat format, JzRE::U32 width, JzRE::U32 height,
+                                         JzRE::U32 firstMip, const std::vector<JzRE::JzGPUTextureMipData> &levels,
+                                         std::vector<JzRE::JzGPUTextureUploadRegion> &outRegions)
+{
+    outRegions.clear();
+    outRegions.reserve(levels.size());
+
+    const Size alignment = std::lcm<Size>(16, std::max<U32>(1, GetTextureFormatBlockSize(format)));
+
+    Size uploadSize = 0;
+    for (Size i = 0; i < levels.size(); ++i) {
+        uploadSize = (uploadSize + alignment - 1) / alignment * alignment;
+
+        JzGPUTextureUploadRegion region;
+        region.offset   = uploadSize;
+        region.mipLevel = firstMip + static_cast<U32>(i);
+        region.width    = GetTextureLevelExtent(width, region.mipLevel);
+        region.height   = GetTextureLevelExtent(height, region.mipLevel);
+        outRegions.push_back(region);
+
+        uploadSize += levels[i].size;
+    }
+    return uploadSize;
+}
+
+JzRE::Size JzRE::GetTextureMemorySize(const JzRE::JzGPUTextureObjectDesc &desc)
+{
+    const U32 mipLevels = std::max<U32>(1, desc.mipLevels);
+    Size      layers    = std::max<U32>(1, desc.arraySize) * std::max<U32>(1, desc.depth);
+    if (desc.type == JzETextureResourceType::TextureCube) {
+        layers = std::max<Size>(6, layers);
+    }
+
+    Size total = 0;
+    for (U32 level = 0; level < mipLevels; ++level) {
+        total += GetTextureLevelSize(desc.format, desc.width, desc.height, level);
+    }
+    return total * layers;
+}
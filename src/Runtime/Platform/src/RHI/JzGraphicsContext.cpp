@@ -63,6 +63,19 @@ void JzGraphicsContext::MakeCurrentContext(U32 threadIndex)
     m_windowBackend->MakeContextCurrent();
 }
 
+void JzGraphicsContext::ReleaseCurrentContext()
+{
+    if (!m_windowBackend) {
+        return;
+    }
+
+    if (m_rhiType != JzERHIType::OpenGL) {
+        return;
+    }
+
+    m_windowBackend->DetachContext();
+}
+
 void JzGraphicsContext::BeginFrame()
 {
     if (!m_device) {
@@ -0,0 +1,25 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Platform/RHI/JzRHICapabilities.h"
+
+JzRE::Bool JzRE::JzRHICapabilities::SupportsTextureFormat(JzRE::JzETextureResourceFormat format) const
+{
+    switch (format) {
+        case JzETextureResourceFormat::BC1:
+        case JzETextureResourceFormat::BC3:
+        case JzETextureResourceFormat::BC4:
+        case JzETextureResourceFormat::BC5:
+        case JzETextureResourceFormat::BC7:
+            return supportsTextureCompressionBC;
+        case JzETextureResourceFormat::ETC2RGB8:
+        case JzETextureResourceFormat::ETC2RGBA8:
+            return supportsTextureCompressionETC2;
+        case JzETextureResourceFormat::ASTC4x4:
+            return supportsTextureCompressionASTC;
+        default:
+            return format != JzETextureResourceFormat::Unknown;
+    }
+}
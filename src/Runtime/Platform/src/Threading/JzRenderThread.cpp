@@ -0,0 +1,119 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Platform/Threading/JzRenderThread.h"
+
+#include "JzRE/Runtime/Core/JzProfiler.h"
+
+JzRE::JzRenderThread::~JzRenderThread()
+{
+    Stop();
+}
+
+void JzRE::JzRenderThread::Start(const String &name)
+{
+    if (m_running.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop     = false;
+        m_hasFrame = false;
+    }
+
+    m_running.store(true, std::memory_order_release);
+    m_thread = std::thread(&JzRenderThread::ThreadMain, this, name);
+}
+
+void JzRE::JzRenderThread::Stop()
+{
+    if (!m_running.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_frameDone.wait(lock, [this] { return !m_hasFrame; });
+        m_stop = true;
+    }
+    m_frameReady.notify_one();
+
+    m_thread.join();
+    m_running.store(false, std::memory_order_release);
+}
+
+JzRE::Bool JzRE::JzRenderThread::IsRunning() const
+{
+    return m_running.load(std::memory_order_acquire);
+}
+
+JzRE::Bool JzRE::JzRenderThread::IsRenderThread() const
+{
+    return std::this_thread::get_id() == m_thread.get_id();
+}
+
+void JzRE::JzRenderThread::Kick(JzJob frame)
+{
+    if (!m_running.load(std::memory_order_acquire)) {
+        frame();
+        m_completedFrames.fetch_add(1, std::memory_order_release);
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_frameDone.wait(lock, [this] { return !m_hasFrame; });
+        m_frame    = std::move(frame);
+        m_hasFrame = true;
+    }
+    m_frameReady.notify_one();
+}
+
+void JzRE::JzRenderThread::Wait()
+{
+    if (!m_running.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    JzRE_PROFILE_SCOPE("WaitForRenderThread");
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_frameDone.wait(lock, [this] { return !m_hasFrame; });
+}
+
+JzRE::U64 JzRE::JzRenderThread::GetCompletedFrameCount() const
+{
+    return m_completedFrames.load(std::memory_order_acquire);
+}
+
+void JzRE::JzRenderThread::ThreadMain(String name)
+{
+    JzProfiler::GetInstance().SetThreadName(name);
+
+    while (true) {
+        JzJob frame;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_frameReady.wait(lock, [this] { return m_hasFrame || m_stop; });
+            if (!m_hasFrame) {
+                return;
+            }
+            frame = std::move(m_frame);
+        }
+
+        {
+            JzRE_PROFILE_SCOPE("RenderFrame");
+            frame();
+        }
+        m_completedFrames.fetch_add(1, std::memory_order_release);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_hasFrame = false;
+        }
+        m_frameDone.notify_all();
+    }
+}
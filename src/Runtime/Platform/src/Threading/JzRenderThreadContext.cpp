@@ -5,27 +5,21 @@
 
 #include "JzRE/Runtime/Platform/Threading/JzRenderThreadContext.h"
 
-JzRE::JzRenderThreadContext::JzRenderThreadContext(JzRE::U32 threadId) { }
+#include "JzRE/Runtime/Platform/RHI/JzGraphicsContext.h"
 
-JzRE::JzRenderThreadContext::~JzRenderThreadContext() { }
-
-JzRE::Bool JzRE::JzRenderThreadContext::Initialize()
+JzRE::JzRenderThreadContext::JzRenderThreadContext(JzGraphicsContext &context, U32 threadId) :
+    m_context(context),
+    m_threadId(threadId)
 {
-    return false;
+    m_context.MakeCurrentContext(m_threadId);
 }
 
-void JzRE::JzRenderThreadContext::MakeCurrent() { }
-
-void JzRE::JzRenderThreadContext::SwapBuffers() { }
-
-void JzRE::JzRenderThreadContext::Cleanup() { }
-
-JzRE::U32 JzRE::JzRenderThreadContext::GetThreadId() const
+JzRE::JzRenderThreadContext::~JzRenderThreadContext()
 {
-    return threadId;
+    m_context.ReleaseCurrentContext();
 }
 
-JzRE::Bool JzRE::JzRenderThreadContext::IsInitialized() const
+JzRE::U32 JzRE::JzRenderThreadContext::GetThreadId() const
 {
-    return isInitialized;
-}
\ No newline at end of file
+    return m_threadId;
+}
@@ -157,6 +157,8 @@ VkBufferUsageFlags JzVulkanBuffer::ConvertBufferUsage(JzEGPUBufferObjectType typ
             return VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
         case JzEGPUBufferObjectType::Storage:
             return VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+        case JzEGPUBufferObjectType::Indirect:
+            return VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
     }
 
     return VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
@@ -12,14 +12,18 @@
 #include <optional>
 #include <set>
 #include <sstream>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <GLFW/glfw3.h>
 
 #include "JzRE/Runtime/Core/JzLogger.h"
+#include "JzRE/Runtime/Core/JzProfiler.h"
 #include "JzRE/Runtime/Platform/Vulkan/JzVulkanBuffer.h"
 #include "JzRE/Runtime/Platform/Vulkan/JzVulkanFramebuffer.h"
 #include "JzRE/Runtime/Platform/Vulkan/JzVulkanPipeline.h"
+#include "JzRE/Runtime/Platform/Vulkan/JzVulkanQueueOwnership.h"
 #include "JzRE/Runtime/Platform/Vulkan/JzVulkanShader.h"
 #include "JzRE/Runtime/Platform/Vulkan/JzVulkanTexture.h"
 #include "JzRE/Runtime/Platform/Vulkan/JzVulkanVertexArray.h"
@@ -39,15 +43,22 @@ struct JzQueueFamilyIndices {
     }
 };
 
-JzQueueFamilyIndices FindQueueFamilies(VkPhysicalDevice device, VkSurfaceKHR surface)
+std::vector<VkQueueFamilyProperties> GetQueueFamilyProperties(VkPhysicalDevice device)
 {
-    JzQueueFamilyIndices indices;
-
     U32 queueFamilyCount = 0;
     vkGetPhysicalDeviceQueueFamilyProperties(device, &queueFamilyCount, nullptr);
 
     std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
     vkGetPhysicalDeviceQueueFamilyProperties(device, &queueFamilyCount, queueFamilies.data());
+    return queueFamilies;
+}
+
+JzQueueFamilyIndices FindQueueFamilies(VkPhysicalDevice device, VkSurfaceKHR surface)
+{
+    JzQueueFamilyIndices indices;
+
+    const auto queueFamilies    = GetQueueFamilyProperties(device);
+    const U32  queueFamilyCount = static_cast<U32>(queueFamilies.size());
 
     for (U32 i = 0; i < queueFamilyCount; ++i) {
         const auto &queueFamily = queueFamilies[i];
@@ -146,6 +157,85 @@ VkAccessFlags ConvertResourceStateToAccessFlags(JzERHIResourceState state)
     return 0;
 }
 
+/**
+ * @brief Stages, accesses and layout of one side of a barrier.
+ */
+struct JzVulkanAccessScope {
+    VkPipelineStageFlags2 stages = VK_PIPELINE_STAGE_2_NONE;
+    VkAccessFlags2        access = VK_ACCESS_2_NONE;
+    VkImageLayout         layout = VK_IMAGE_LAYOUT_UNDEFINED;
+};
+
+// Only writes need to be made available; read accesses in a source scope are no-ops
+constexpr VkAccessFlags2 kWriteAccessMask = VK_ACCESS_2_SHADER_WRITE_BIT | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT |
+                                            VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
+                                            VK_ACCESS_2_TRANSFER_WRITE_BIT | VK_ACCESS_2_HOST_WRITE_BIT |
+                                            VK_ACCESS_2_MEMORY_WRITE_BIT;
+
+VkPipelineStageFlags2 GetShaderStages(JzERHIPassType passType)
+{
+    switch (passType) {
+        case JzERHIPassType::Compute:
+            return VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+        case JzERHIPassType::Transfer:
+            return VK_PIPELINE_STAGE_2_TRANSFER_BIT;
+        case JzERHIPassType::Graphics:
+            break;
+    }
+    return VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT;
+}
+
+/**
+ * @brief Smallest scope covering a usage; the coarse state is used when the usage is unknown.
+ *
+ * Every bit used here has the same value in the legacy flags, so the scope
+ * also serves the vkCmdPipelineBarrier fallback.
+ */
+JzVulkanAccessScope GetAccessScope(JzERHIResourceUsage usage, JzERHIPassType passType, JzERHIResourceState state)
+{
+    switch (usage) {
+        case JzERHIResourceUsage::VertexBuffer:
+            return {VK_PIPELINE_STAGE_2_VERTEX_INPUT_BIT, VK_ACCESS_2_VERTEX_ATTRIBUTE_READ_BIT,
+                    VK_IMAGE_LAYOUT_UNDEFINED};
+        case JzERHIResourceUsage::IndexBuffer:
+            return {VK_PIPELINE_STAGE_2_VERTEX_INPUT_BIT, VK_ACCESS_2_INDEX_READ_BIT, VK_IMAGE_LAYOUT_UNDEFINED};
+        case JzERHIResourceUsage::UniformBuffer:
+            return {GetShaderStages(passType), VK_ACCESS_2_UNIFORM_READ_BIT, VK_IMAGE_LAYOUT_UNDEFINED};
+        case JzERHIResourceUsage::IndirectBuffer:
+            return {VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT, VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT,
+                    VK_IMAGE_LAYOUT_UNDEFINED};
+        case JzERHIResourceUsage::ShaderRead:
+            return {GetShaderStages(passType), VK_ACCESS_2_SHADER_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL};
+        case JzERHIResourceUsage::ShaderWrite:
+            return {GetShaderStages(passType), VK_ACCESS_2_SHADER_READ_BIT | VK_ACCESS_2_SHADER_WRITE_BIT,
+                    VK_IMAGE_LAYOUT_GENERAL};
+        case JzERHIResourceUsage::ColorAttachment:
+            return {VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
+                    VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT,
+                    VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+        case JzERHIResourceUsage::DepthStencilWrite:
+            return {VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT,
+                    VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+                    VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL};
+        case JzERHIResourceUsage::DepthStencilRead:
+            return {VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT |
+                        GetShaderStages(passType),
+                    VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_2_SHADER_READ_BIT,
+                    VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL};
+        case JzERHIResourceUsage::TransferSrc:
+            return {VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_ACCESS_2_TRANSFER_READ_BIT,
+                    VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL};
+        case JzERHIResourceUsage::TransferDst:
+            return {VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT,
+                    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL};
+        case JzERHIResourceUsage::Unknown:
+            break;
+    }
+
+    return {VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, ConvertResourceStateToAccessFlags(state),
+            ConvertResourceStateToImageLayout(state)};
+}
+
 VkImageAspectFlags GetImageAspectMask(VkFormat format)
 {
     switch (format) {
@@ -161,6 +251,24 @@ VkImageAspectFlags GetImageAspectMask(VkFormat format)
     }
 }
 
+VkAttachmentLoadOp ConvertLoadOp(JzERHILoadOp loadOp)
+{
+    switch (loadOp) {
+        case JzERHILoadOp::Clear:
+            return VK_ATTACHMENT_LOAD_OP_CLEAR;
+        case JzERHILoadOp::DontCare:
+            return VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        case JzERHILoadOp::Load:
+            break;
+    }
+    return VK_ATTACHMENT_LOAD_OP_LOAD;
+}
+
+VkAttachmentStoreOp ConvertStoreOp(JzERHIStoreOp storeOp)
+{
+    return storeOp == JzERHIStoreOp::DontCare ? VK_ATTACHMENT_STORE_OP_DONT_CARE : VK_ATTACHMENT_STORE_OP_STORE;
+}
+
 } // namespace
 
 JzVulkanDevice::JzVulkanDevice(JzIWindowBackend &windowBackend) :
@@ -247,15 +355,28 @@ JzVulkanDevice::JzVulkanDevice(JzIWindowBackend &windowBackend) :
 
 JzVulkanDevice::~JzVulkanDevice()
 {
-    if (m_lifetimeFlag) {
-        m_lifetimeFlag->store(false, std::memory_order_release);
-    }
-
     Finish();
 
+    // Textures released here still retire their images through the device
     m_boundTextures.clear();
     m_fallbackTexture.reset();
+    m_currentFramebuffer.reset();
+
+    if (m_lifetimeFlag) {
+        m_lifetimeFlag->store(false, std::memory_order_release);
+    }
+
+    if (m_device != VK_NULL_HANDLE) {
+        m_retiredFramebuffers.ReleaseAll([this](VkFramebuffer framebuffer) {
+            vkDestroyFramebuffer(m_device, framebuffer, nullptr);
+        });
+        m_retiredImages.ReleaseAll([this](const JzVulkanRetiredImage &retired) {
+            DestroyRetiredImage(retired);
+        });
+    }
+    DestroyRenderPassCache();
 
+    DestroyTimestampQueryPool();
     DestroyFrameSyncObjects();
     DestroySwapchainObjects();
 
@@ -340,6 +461,7 @@ std::shared_ptr<JzGPUTextureObject> JzVulkanDevice::CreateTexture(const JzGPUTex
 {
     auto texture = std::make_shared<JzVulkanTexture>(*this, desc);
     m_stats.textures++;
+    m_stats.textureMemory += GetTextureMemorySize(desc);
     return texture;
 }
 
@@ -359,7 +481,7 @@ std::shared_ptr<JzRHIPipeline> JzVulkanDevice::CreatePipeline(const JzPipelineDe
 
 std::shared_ptr<JzGPUFramebufferObject> JzVulkanDevice::CreateFramebuffer(const String &debugName)
 {
-    return std::make_shared<JzVulkanFramebuffer>(debugName);
+    return std::make_shared<JzVulkanFramebuffer>(*this, debugName);
 }
 
 std::shared_ptr<JzGPUVertexArrayObject> JzVulkanDevice::CreateVertexArray(const String &debugName)
@@ -412,6 +534,12 @@ void JzVulkanDevice::DispatchCommand(const JzRHIRecordedCommand &command)
             }
             break;
         }
+        case JzRHIECommandType::DrawIndexedIndirect: {
+            if (const auto *payload = std::get_if<JzDrawIndexedIndirectParams>(&command.payload)) {
+                DrawIndexedIndirect(*payload);
+            }
+            break;
+        }
         case JzRHIECommandType::BindPipeline: {
             if (const auto *payload = std::get_if<JzRHIBindPipelinePayload>(&command.payload)) {
                 BindPipeline(payload->pipeline);
@@ -432,7 +560,7 @@ void JzVulkanDevice::DispatchCommand(const JzRHIRecordedCommand &command)
         }
         case JzRHIECommandType::BindFramebuffer: {
             if (const auto *payload = std::get_if<JzRHIBindFramebufferPayload>(&command.payload)) {
-                BindFramebuffer(payload->framebuffer);
+                BindFramebuffer(payload->framebuffer, payload->hasAttachmentOps ? &payload->attachmentOps : nullptr);
             }
             break;
         }
@@ -477,6 +605,16 @@ void JzVulkanDevice::DispatchCommand(const JzRHIRecordedCommand &command)
             }
             break;
         }
+        case JzRHIECommandType::BeginGpuZone: {
+            if (const auto *payload = std::get_if<JzRHIGpuZonePayload>(&command.payload)) {
+                BeginGpuZone(payload->name);
+            }
+            break;
+        }
+        case JzRHIECommandType::EndGpuZone: {
+            EndGpuZone();
+            break;
+        }
     }
 }
 
@@ -516,6 +654,15 @@ void JzVulkanDevice::BeginFrame()
 
     vkWaitForFences(m_device, 1, &frame.inFlight, VK_TRUE, std::numeric_limits<U64>::max());
 
+    // The fence guarantees the previous use of this slot finished on the GPU
+    auto &zoneFrame = m_gpuZoneFrames[m_currentFrameIndex];
+    ResolveGpuZones(zoneFrame);
+
+    auto &uploadBatch = m_uploadBatches[m_currentFrameIndex];
+    if (uploadBatch.inFlight) {
+        ReclaimUploadBatch(uploadBatch);
+    }
+
     const VkResult acquireResult = vkAcquireNextImageKHR(
         m_device,
         m_swapchain,
@@ -548,6 +695,21 @@ void JzVulkanDevice::BeginFrame()
     vkResetFences(m_device, 1, &frame.inFlight);
     vkResetCommandPool(m_device, frame.commandPool, 0);
 
+    // Two fence waits after retirement every frame that could have used a framebuffer is done
+    m_retiredFramebuffers.Tick([this](VkFramebuffer framebuffer) {
+        vkDestroyFramebuffer(m_device, framebuffer, nullptr);
+    });
+    m_retiredImages.Tick([this](const JzVulkanRetiredImage &retired) {
+        DestroyRetiredImage(retired);
+    });
+
+    for (U32 i = 0; i < frame.usedEvents; ++i) {
+        vkResetEvent(m_device, frame.events[i]);
+    }
+    frame.usedEvents = 0;
+    m_pendingBarriers.clear();
+    m_openSplitBarriers.clear();
+
     VkCommandBufferBeginInfo beginInfo{};
     beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
     beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
@@ -557,18 +719,34 @@ void JzVulkanDevice::BeginFrame()
         return;
     }
 
-    if (!BeginSwapchainRenderPass()) {
-        vkEndCommandBuffer(frame.commandBuffer);
-        return;
+    // Queries must be reset outside of a render pass
+    if (m_timestampQueryPool != VK_NULL_HANDLE) {
+        vkCmdResetQueryPool(frame.commandBuffer, m_timestampQueryPool,
+                            m_currentFrameIndex * __MAX_GPU_ZONES_PER_FRAME * 2,
+                            __MAX_GPU_ZONES_PER_FRAME * 2);
+        zoneFrame.queriesReset = true;
     }
 
+    // Render pass instances start lazily, so offscreen passes can run before the swapchain one
+    m_isRenderPassActive   = false;
+    m_swapchainPassStarted = false;
+    m_currentFramebuffer.reset();
+    m_currentAttachmentOps = JzRHIAttachmentOps{};
+
     m_isFrameActive   = true;
     m_readyForPresent = false;
     m_boundTextures.clear();
 
-    m_stats.drawCalls = 0;
-    m_stats.triangles = 0;
-    m_stats.vertices  = 0;
+    m_stats.drawCalls     = 0;
+    m_stats.triangles     = 0;
+    m_stats.vertices      = 0;
+    m_stats.indirectDraws = 0;
+
+    const U64 now = JzProfiler::NowNs();
+    if (m_lastFrameBeginNs != 0) {
+        m_stats.frameTime = static_cast<F32>(static_cast<F64>(now - m_lastFrameBeginNs) / 1.0e6);
+    }
+    m_lastFrameBeginNs = now;
 }
 
 void JzVulkanDevice::EndFrame()
@@ -579,7 +757,17 @@ void JzVulkanDevice::EndFrame()
 
     auto &frame = m_frames[m_currentFrameIndex];
 
-    EndSwapchainRenderPass();
+    while (!m_gpuZoneFrames[m_currentFrameIndex].openZones.empty()) {
+        EndGpuZone();
+    }
+
+    EndActiveRenderPass();
+
+    // The clearing swapchain pass also moves the image to its present layout
+    if (!m_swapchainPassStarted && BeginSwapchainRenderPass()) {
+        EndActiveRenderPass();
+    }
+    FlushResourceBarriers();
 
     if (m_pendingBlitTexture &&
         m_pendingBlitTexture->GetImage() != VK_NULL_HANDLE &&
@@ -746,6 +934,7 @@ void JzVulkanDevice::SetViewport(const JzViewport &viewport)
 void JzVulkanDevice::SetScissor(const JzScissorRect &scissor)
 {
     m_currentScissor = scissor;
+    m_scissorSet     = true;
 
     if (!m_isFrameActive) {
         return;
@@ -768,12 +957,36 @@ void JzVulkanDevice::Clear(const JzClearParams &params)
         return;
     }
 
+    // A clear before the first draw of an instance becomes its CLEAR load op, unless a scissor limits it
+    if (!m_isRenderPassActive) {
+        if (m_currentFramebuffer && !m_scissorSet) {
+            if (params.clearColor) {
+                m_currentAttachmentOps.colorLoad = JzERHILoadOp::Clear;
+            }
+            if (params.clearDepth) {
+                m_currentAttachmentOps.depthLoad = JzERHILoadOp::Clear;
+            }
+            m_renderPassClear = params;
+            EnsureRenderPass();
+            return;
+        }
+
+        if (!m_swapchainPassStarted) {
+            BeginSwapchainRenderPass();
+            return;
+        }
+
+        if (!EnsureRenderPass()) {
+            return;
+        }
+    }
+
     auto &frame = m_frames[m_currentFrameIndex];
 
     std::array<VkClearAttachment, 2> clearAttachments{};
     U32                               attachmentCount = 0;
 
-    if (params.clearColor) {
+    if (params.clearColor && m_activeHasColor) {
         auto &colorAttachment          = clearAttachments[attachmentCount++];
         colorAttachment.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
         colorAttachment.colorAttachment = 0;
@@ -782,7 +995,7 @@ void JzVulkanDevice::Clear(const JzClearParams &params)
         };
     }
 
-    if (params.clearDepth || params.clearStencil) {
+    if ((params.clearDepth || params.clearStencil) && m_activeHasDepth) {
         auto &depthAttachment = clearAttachments[attachmentCount++];
         depthAttachment.aspectMask = 0;
         if (params.clearDepth) {
@@ -805,7 +1018,21 @@ void JzVulkanDevice::Clear(const JzClearParams &params)
     clearRect.baseArrayLayer = 0;
     clearRect.layerCount     = 1;
     clearRect.rect.offset    = {0, 0};
-    clearRect.rect.extent    = m_swapchainExtent;
+    clearRect.rect.extent    = m_activeRenderArea;
+    if (m_scissorSet) {
+        // The clear rect must lie inside the render area
+        const I32 x0 = std::clamp(m_currentScissor.x, 0, static_cast<I32>(m_activeRenderArea.width));
+        const I32 y0 = std::clamp(m_currentScissor.y, 0, static_cast<I32>(m_activeRenderArea.height));
+        const I64 x1 = std::min<I64>(static_cast<I64>(m_currentScissor.x) + m_currentScissor.width,
+                                     m_activeRenderArea.width);
+        const I64 y1 = std::min<I64>(static_cast<I64>(m_currentScissor.y) + m_currentScissor.height,
+                                     m_activeRenderArea.height);
+        if (x1 <= x0 || y1 <= y0) {
+            return;
+        }
+        clearRect.rect.offset = {x0, y0};
+        clearRect.rect.extent = {static_cast<U32>(x1 - x0), static_cast<U32>(y1 - y0)};
+    }
 
     vkCmdClearAttachments(
         frame.commandBuffer,
@@ -822,11 +1049,16 @@ void JzVulkanDevice::Draw(const JzDrawParams &params)
     }
 
     auto &frame = m_frames[m_currentFrameIndex];
-    if (!m_currentPipeline || m_currentPipeline->GetPipeline() == VK_NULL_HANDLE) {
+    if (!m_currentPipeline || !EnsureRenderPass()) {
+        return;
+    }
+
+    const VkPipeline pipeline = m_currentPipeline->GetPipeline(m_activeCompatibleRenderPass, m_activeHasColor);
+    if (pipeline == VK_NULL_HANDLE) {
         return;
     }
 
-    vkCmdBindPipeline(frame.commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_currentPipeline->GetPipeline());
+    vkCmdBindPipeline(frame.commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
     m_currentPipeline->BindResources(frame.commandBuffer, m_boundTextures);
 
     if (m_currentVertexArray) {
@@ -872,41 +1104,7 @@ void JzVulkanDevice::DrawIndexed(const JzDrawIndexedParams &params)
     }
 
     auto &frame = m_frames[m_currentFrameIndex];
-    if (!m_currentPipeline || m_currentPipeline->GetPipeline() == VK_NULL_HANDLE) {
-        return;
-    }
-
-    vkCmdBindPipeline(frame.commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_currentPipeline->GetPipeline());
-    m_currentPipeline->BindResources(frame.commandBuffer, m_boundTextures);
-
-    if (m_currentVertexArray) {
-        std::vector<std::pair<U32, VkBuffer>> bindings;
-        bindings.reserve(m_currentVertexArray->GetVertexBuffers().size());
-
-        for (const auto &entry : m_currentVertexArray->GetVertexBuffers()) {
-            const auto vkBuffer = std::dynamic_pointer_cast<JzVulkanBuffer>(entry.second);
-            if (!vkBuffer || vkBuffer->GetBuffer() == VK_NULL_HANDLE) {
-                continue;
-            }
-
-            bindings.emplace_back(entry.first, vkBuffer->GetBuffer());
-        }
-
-        std::sort(bindings.begin(), bindings.end(), [](const auto &lhs, const auto &rhs) {
-            return lhs.first < rhs.first;
-        });
-
-        for (const auto &[binding, buffer] : bindings) {
-            const VkDeviceSize offset = 0;
-            vkCmdBindVertexBuffers(frame.commandBuffer, binding, 1, &buffer, &offset);
-        }
-
-        const auto indexBuffer = std::dynamic_pointer_cast<JzVulkanBuffer>(m_currentVertexArray->GetIndexBuffer());
-        if (!indexBuffer || indexBuffer->GetBuffer() == VK_NULL_HANDLE) {
-            return;
-        }
-        vkCmdBindIndexBuffer(frame.commandBuffer, indexBuffer->GetBuffer(), 0, VK_INDEX_TYPE_UINT32);
-    } else {
+    if (!BindIndexedDrawState(frame.commandBuffer)) {
         return;
     }
 
@@ -924,6 +1122,85 @@ void JzVulkanDevice::DrawIndexed(const JzDrawIndexedParams &params)
     }
 }
 
+void JzVulkanDevice::DrawIndexedIndirect(const JzDrawIndexedIndirectParams &params)
+{
+    if (!m_isFrameActive || params.drawCount == 0) {
+        return;
+    }
+
+    const auto indirectBuffer = std::dynamic_pointer_cast<JzVulkanBuffer>(params.indirectBuffer);
+    if (!indirectBuffer || indirectBuffer->GetBuffer() == VK_NULL_HANDLE) {
+        return;
+    }
+
+    auto &frame = m_frames[m_currentFrameIndex];
+    if (!BindIndexedDrawState(frame.commandBuffer)) {
+        return;
+    }
+
+    if (m_capabilities.supportsMultiDrawIndirect) {
+        vkCmdDrawIndexedIndirect(frame.commandBuffer,
+                                 indirectBuffer->GetBuffer(),
+                                 static_cast<VkDeviceSize>(params.offset),
+                                 params.drawCount,
+                                 params.stride);
+        m_stats.drawCalls++;
+    } else {
+        // Without the multiDrawIndirect feature drawCount must be 0 or 1
+        for (U32 index = 0; index < params.drawCount; ++index) {
+            const VkDeviceSize offset = static_cast<VkDeviceSize>(params.offset) +
+                                        static_cast<VkDeviceSize>(index) * params.stride;
+            vkCmdDrawIndexedIndirect(frame.commandBuffer, indirectBuffer->GetBuffer(), offset, 1, params.stride);
+        }
+        m_stats.drawCalls += params.drawCount;
+    }
+
+    m_stats.indirectDraws += params.drawCount;
+}
+
+Bool JzVulkanDevice::BindIndexedDrawState(VkCommandBuffer commandBuffer)
+{
+    if (!m_currentPipeline || !m_currentVertexArray || !EnsureRenderPass()) {
+        return false;
+    }
+
+    const VkPipeline pipeline = m_currentPipeline->GetPipeline(m_activeCompatibleRenderPass, m_activeHasColor);
+    if (pipeline == VK_NULL_HANDLE) {
+        return false;
+    }
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+    m_currentPipeline->BindResources(commandBuffer, m_boundTextures);
+
+    std::vector<std::pair<U32, VkBuffer>> bindings;
+    bindings.reserve(m_currentVertexArray->GetVertexBuffers().size());
+
+    for (const auto &entry : m_currentVertexArray->GetVertexBuffers()) {
+        const auto vkBuffer = std::dynamic_pointer_cast<JzVulkanBuffer>(entry.second);
+        if (!vkBuffer || vkBuffer->GetBuffer() == VK_NULL_HANDLE) {
+            continue;
+        }
+
+        bindings.emplace_back(entry.first, vkBuffer->GetBuffer());
+    }
+
+    std::sort(bindings.begin(), bindings.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.first < rhs.first;
+    });
+
+    for (const auto &[binding, buffer] : bindings) {
+        const VkDeviceSize offset = 0;
+        vkCmdBindVertexBuffers(commandBuffer, binding, 1, &buffer, &offset);
+    }
+
+    const auto indexBuffer = std::dynamic_pointer_cast<JzVulkanBuffer>(m_currentVertexArray->GetIndexBuffer());
+    if (!indexBuffer || indexBuffer->GetBuffer() == VK_NULL_HANDLE) {
+        return false;
+    }
+    vkCmdBindIndexBuffer(commandBuffer, indexBuffer->GetBuffer(), 0, VK_INDEX_TYPE_UINT32);
+    return true;
+}
+
 void JzVulkanDevice::BindPipeline(std::shared_ptr<JzRHIPipeline> pipeline)
 {
     m_currentPipeline = std::dynamic_pointer_cast<JzVulkanPipeline>(std::move(pipeline));
@@ -950,23 +1227,48 @@ void JzVulkanDevice::BindTexture(std::shared_ptr<JzGPUTextureObject> texture, U3
     m_boundTextures[slot] = std::move(vkTexture);
 }
 
-void JzVulkanDevice::BindFramebuffer(std::shared_ptr<JzGPUFramebufferObject> framebuffer)
+void JzVulkanDevice::BindFramebuffer(std::shared_ptr<JzGPUFramebufferObject> framebuffer,
+                                     const JzRHIAttachmentOps               *attachmentOps)
 {
-    m_currentFramebuffer = std::dynamic_pointer_cast<JzVulkanFramebuffer>(std::move(framebuffer));
+    auto vkFramebuffer = std::dynamic_pointer_cast<JzVulkanFramebuffer>(std::move(framebuffer));
+
+    // Binding a framebuffer drops the scissor, as on OpenGL
+    if (m_scissorSet) {
+        m_scissorSet = false;
+        if (m_isRenderPassActive && m_currentFramebuffer && m_isFrameActive) {
+            VkRect2D scissor{};
+            scissor.extent = m_activeRenderArea;
+            vkCmdSetScissor(m_frames[m_currentFrameIndex].commandBuffer, 0, 1, &scissor);
+        }
+    }
+
+    // Rebinding the current target keeps its instance; explicit ops only apply before it begins
+    if (vkFramebuffer == m_currentFramebuffer && (m_isRenderPassActive || !attachmentOps)) {
+        return;
+    }
+
+    EndActiveRenderPass();
+
+    m_currentFramebuffer   = std::move(vkFramebuffer);
+    m_currentAttachmentOps = attachmentOps ? *attachmentOps : JzRHIAttachmentOps{};
+    m_renderPassClear      = JzClearParams{};
 }
 
 void JzVulkanDevice::BlitFramebufferToScreen(std::shared_ptr<JzGPUFramebufferObject> framebuffer,
                                              U32 srcWidth, U32 srcHeight,
                                              U32 dstWidth, U32 dstHeight)
 {
-    (void)framebuffer;
-    (void)srcWidth;
-    (void)srcHeight;
-    (void)dstWidth;
-    (void)dstHeight;
-    // Runtime currently records render passes with framebuffer bind semantics that are
-    // emulated on Vulkan by direct swapchain rendering. Keep blit as a no-op here so
-    // command stream remains unified while avoiding an extra overwrite of swapchain.
+    const auto vkFramebuffer = std::dynamic_pointer_cast<JzVulkanFramebuffer>(std::move(framebuffer));
+    if (!vkFramebuffer) {
+        return;
+    }
+
+    // The copy itself is recorded in EndFrame, after the last render pass instance
+    m_pendingBlitTexture   = vkFramebuffer->GetVulkanColorAttachment();
+    m_pendingBlitSrcWidth  = srcWidth;
+    m_pendingBlitSrcHeight = srcHeight;
+    m_pendingBlitDstWidth  = std::min(dstWidth, m_swapchainExtent.width);
+    m_pendingBlitDstHeight = std::min(dstHeight, m_swapchainExtent.height);
 }
 
 void JzVulkanDevice::ResourceBarrier(const std::vector<JzRHIResourceBarrier> &barriers)
@@ -975,67 +1277,290 @@ void JzVulkanDevice::ResourceBarrier(const std::vector<JzRHIResourceBarrier> &ba
         return;
     }
 
-    auto &frame = m_frames[m_currentFrameIndex];
+    // Barriers cannot be recorded inside an instance; the next draw starts a new one
+    m_pendingBarriers.insert(m_pendingBarriers.end(), barriers.begin(), barriers.end());
+    EndActiveRenderPass();
+    FlushResourceBarriers();
+}
+
+void JzVulkanDevice::FlushResourceBarriers()
+{
+    if (m_pendingBarriers.empty()) {
+        return;
+    }
+
+    auto &frame   = m_frames[m_currentFrameIndex];
+    auto  pending = std::move(m_pendingBarriers);
+    m_pendingBarriers.clear();
+
+    // Split halves only pay off with synchronization2, and a Begin flushed together with
+    // its End is no better than a plain barrier
+    const Bool              canSplit = m_cmdSetEvent2 != nullptr && m_cmdWaitEvents2 != nullptr;
+    std::unordered_set<U32> endsInBatch;
+    for (const auto &barrier : pending) {
+        if (barrier.split == JzERHIBarrierSplit::End) {
+            endsInBatch.insert(barrier.splitId);
+        }
+    }
 
-    std::vector<VkImageMemoryBarrier> imageBarriers;
-    imageBarriers.reserve(barriers.size());
+    std::vector<VkImageMemoryBarrier2>  imageBarriers;
+    std::vector<VkBufferMemoryBarrier2> bufferBarriers;
+    std::vector<VkEvent>                waitEvents;
+    std::vector<VkDependencyInfo>       waitInfos;
+    std::vector<U32>                    closedSplits;
 
-    for (const auto &barrier : barriers) {
-        if (barrier.type != JzEResourceType::Texture || !barrier.resource) {
+    for (const auto &barrier : pending) {
+        if (!barrier.resource) {
             continue;
         }
 
-        auto texture = std::dynamic_pointer_cast<JzVulkanTexture>(barrier.resource);
-        if (!texture || texture->GetImage() == VK_NULL_HANDLE) {
+        const Bool beginsSplit = barrier.split == JzERHIBarrierSplit::Begin;
+        if (beginsSplit && (!canSplit || endsInBatch.count(barrier.splitId) != 0)) {
             continue;
         }
 
-        const VkImageLayout oldLayout = texture->GetLayout();
-        const VkImageLayout newLayout = ConvertResourceStateToImageLayout(barrier.after);
+        // Without an event the Begin half is recorded as a plain barrier right away
+        const VkEvent event = beginsSplit ? AcquireFrameEvent() : VK_NULL_HANDLE;
+        if (event != VK_NULL_HANDLE) {
+            JzVulkanSplitBarrier split;
+            split.event       = event;
+            split.isImage     = barrier.type == JzEResourceType::Texture;
+            const Bool needed = split.isImage ? BuildImageBarrier(barrier, split.imageBarrier)
+                                              : BuildBufferBarrier(barrier, split.bufferBarrier);
+            if (!needed) {
+                --frame.usedEvents;
+                continue;
+            }
+
+            auto &stored = m_openSplitBarriers[barrier.splitId];
+            stored       = split;
 
-        if (oldLayout == newLayout) {
+            VkDependencyInfo dependencyInfo{};
+            dependencyInfo.sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+            dependencyInfo.imageMemoryBarrierCount  = stored.isImage ? 1 : 0;
+            dependencyInfo.pImageMemoryBarriers     = &stored.imageBarrier;
+            dependencyInfo.bufferMemoryBarrierCount = stored.isImage ? 0 : 1;
+            dependencyInfo.pBufferMemoryBarriers    = &stored.bufferBarrier;
+            m_cmdSetEvent2(frame.commandBuffer, stored.event, &dependencyInfo);
             continue;
         }
 
-        VkImageMemoryBarrier imageBarrier{};
-        imageBarrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-        imageBarrier.oldLayout           = oldLayout;
-        imageBarrier.newLayout           = newLayout;
-        imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        imageBarrier.image               = texture->GetImage();
-        imageBarrier.subresourceRange.aspectMask     = GetImageAspectMask(texture->GetVkFormat());
-        imageBarrier.subresourceRange.baseMipLevel   = 0;
-        imageBarrier.subresourceRange.levelCount     = 1;
-        imageBarrier.subresourceRange.baseArrayLayer = 0;
-        imageBarrier.subresourceRange.layerCount     = 1;
-        imageBarrier.srcAccessMask                   = ConvertResourceStateToAccessFlags(barrier.before);
-        imageBarrier.dstAccessMask                   = ConvertResourceStateToAccessFlags(barrier.after);
+        if (barrier.split == JzERHIBarrierSplit::End) {
+            const auto open = m_openSplitBarriers.find(barrier.splitId);
+            if (open != m_openSplitBarriers.end()) {
+                // The wait must repeat the dependency the event was set with
+                const auto      &stored = open->second;
+                VkDependencyInfo dependencyInfo{};
+                dependencyInfo.sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+                dependencyInfo.imageMemoryBarrierCount  = stored.isImage ? 1 : 0;
+                dependencyInfo.pImageMemoryBarriers     = &stored.imageBarrier;
+                dependencyInfo.bufferMemoryBarrierCount = stored.isImage ? 0 : 1;
+                dependencyInfo.pBufferMemoryBarriers    = &stored.bufferBarrier;
+                waitEvents.push_back(stored.event);
+                waitInfos.push_back(dependencyInfo);
+                closedSplits.push_back(barrier.splitId);
+                continue;
+            }
+            // Begin half was merged or never recorded: fall through to a plain barrier
+        }
+
+        if (barrier.type == JzEResourceType::Texture) {
+            VkImageMemoryBarrier2 imageBarrier{};
+            if (BuildImageBarrier(barrier, imageBarrier)) {
+                imageBarriers.push_back(imageBarrier);
+            }
+        } else {
+            VkBufferMemoryBarrier2 bufferBarrier{};
+            if (BuildBufferBarrier(barrier, bufferBarrier)) {
+                bufferBarriers.push_back(bufferBarrier);
+            }
+        }
+    }
+
+    if (!waitEvents.empty()) {
+        m_cmdWaitEvents2(frame.commandBuffer, static_cast<U32>(waitEvents.size()), waitEvents.data(),
+                         waitInfos.data());
+        for (const U32 splitId : closedSplits) {
+            m_openSplitBarriers.erase(splitId);
+        }
+    }
+
+    RecordPipelineBarrier(frame.commandBuffer, imageBarriers, bufferBarriers);
+}
+
+Bool JzVulkanDevice::BuildImageBarrier(const JzRHIResourceBarrier &barrier, VkImageMemoryBarrier2 &out)
+{
+    auto texture = std::dynamic_pointer_cast<JzVulkanTexture>(barrier.resource);
+    if (!texture || texture->GetImage() == VK_NULL_HANDLE) {
+        return false;
+    }
+
+    const auto source      = GetAccessScope(barrier.beforeUsage, barrier.beforePass, barrier.before);
+    const auto destination = GetAccessScope(barrier.afterUsage, barrier.afterPass, barrier.after);
+
+    const VkImageLayout oldLayout = texture->GetLayout();
+    const VkImageLayout newLayout = destination.layout;
+
+    // Read-after-read in the same layout needs no synchronization
+    const VkAccessFlags2 sourceWrites = source.access & kWriteAccessMask;
+    if (oldLayout == newLayout && sourceWrites == 0 && (destination.access & kWriteAccessMask) == 0) {
+        return false;
+    }
+
+    out                                 = VkImageMemoryBarrier2{};
+    out.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+    out.srcStageMask                    = source.stages;
+    out.srcAccessMask                   = sourceWrites;
+    out.dstStageMask                    = destination.stages;
+    out.dstAccessMask                   = destination.access;
+    out.oldLayout                       = oldLayout;
+    out.newLayout                       = newLayout;
+    out.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    out.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    out.image                           = texture->GetImage();
+    out.subresourceRange.aspectMask     = GetImageAspectMask(texture->GetVkFormat());
+    out.subresourceRange.baseMipLevel   = 0;
+    out.subresourceRange.levelCount     = VK_REMAINING_MIP_LEVELS;
+    out.subresourceRange.baseArrayLayer = 0;
+    out.subresourceRange.layerCount     = VK_REMAINING_ARRAY_LAYERS;
+
+    texture->SetLayout(newLayout);
+    return true;
+}
+
+Bool JzVulkanDevice::BuildBufferBarrier(const JzRHIResourceBarrier &barrier, VkBufferMemoryBarrier2 &out)
+{
+    auto buffer = std::dynamic_pointer_cast<JzVulkanBuffer>(barrier.resource);
+    if (!buffer || buffer->GetBuffer() == VK_NULL_HANDLE) {
+        return false;
+    }
+
+    const auto source      = GetAccessScope(barrier.beforeUsage, barrier.beforePass, barrier.before);
+    const auto destination = GetAccessScope(barrier.afterUsage, barrier.afterPass, barrier.after);
+
+    const VkAccessFlags2 sourceWrites = source.access & kWriteAccessMask;
+    if (sourceWrites == 0 && (destination.access & kWriteAccessMask) == 0) {
+        return false;
+    }
+
+    out                     = VkBufferMemoryBarrier2{};
+    out.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2;
+    out.srcStageMask        = source.stages;
+    out.srcAccessMask       = sourceWrites;
+    out.dstStageMask        = destination.stages;
+    out.dstAccessMask       = destination.access;
+    out.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    out.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    out.buffer              = buffer->GetBuffer();
+    out.offset              = 0;
+    out.size                = VK_WHOLE_SIZE;
+    return true;
+}
 
-        imageBarriers.push_back(imageBarrier);
-        texture->SetLayout(newLayout);
+void JzVulkanDevice::RecordPipelineBarrier(VkCommandBuffer                            commandBuffer,
+                                           const std::vector<VkImageMemoryBarrier2>  &imageBarriers,
+                                           const std::vector<VkBufferMemoryBarrier2> &bufferBarriers)
+{
+    if (imageBarriers.empty() && bufferBarriers.empty()) {
+        return;
     }
 
-    if (imageBarriers.empty()) {
+    if (m_cmdPipelineBarrier2 != nullptr) {
+        VkDependencyInfo dependencyInfo{};
+        dependencyInfo.sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+        dependencyInfo.imageMemoryBarrierCount  = static_cast<U32>(imageBarriers.size());
+        dependencyInfo.pImageMemoryBarriers     = imageBarriers.data();
+        dependencyInfo.bufferMemoryBarrierCount = static_cast<U32>(bufferBarriers.size());
+        dependencyInfo.pBufferMemoryBarriers    = bufferBarriers.data();
+        m_cmdPipelineBarrier2(commandBuffer, &dependencyInfo);
         return;
     }
 
+    // Legacy path: one call with the union of the stage masks
+    VkPipelineStageFlags               srcStages = 0;
+    VkPipelineStageFlags               dstStages = 0;
+    std::vector<VkImageMemoryBarrier>  legacyImageBarriers;
+    std::vector<VkBufferMemoryBarrier> legacyBufferBarriers;
+    legacyImageBarriers.reserve(imageBarriers.size());
+    legacyBufferBarriers.reserve(bufferBarriers.size());
+
+    for (const auto &barrier : imageBarriers) {
+        srcStages |= static_cast<VkPipelineStageFlags>(barrier.srcStageMask);
+        dstStages |= static_cast<VkPipelineStageFlags>(barrier.dstStageMask);
+
+        VkImageMemoryBarrier legacy{};
+        legacy.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        legacy.srcAccessMask       = static_cast<VkAccessFlags>(barrier.srcAccessMask);
+        legacy.dstAccessMask       = static_cast<VkAccessFlags>(barrier.dstAccessMask);
+        legacy.oldLayout           = barrier.oldLayout;
+        legacy.newLayout           = barrier.newLayout;
+        legacy.srcQueueFamilyIndex = barrier.srcQueueFamilyIndex;
+        legacy.dstQueueFamilyIndex = barrier.dstQueueFamilyIndex;
+        legacy.image               = barrier.image;
+        legacy.subresourceRange    = barrier.subresourceRange;
+        legacyImageBarriers.push_back(legacy);
+    }
+
+    for (const auto &barrier : bufferBarriers) {
+        srcStages |= static_cast<VkPipelineStageFlags>(barrier.srcStageMask);
+        dstStages |= static_cast<VkPipelineStageFlags>(barrier.dstStageMask);
+
+        VkBufferMemoryBarrier legacy{};
+        legacy.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        legacy.srcAccessMask       = static_cast<VkAccessFlags>(barrier.srcAccessMask);
+        legacy.dstAccessMask       = static_cast<VkAccessFlags>(barrier.dstAccessMask);
+        legacy.srcQueueFamilyIndex = barrier.srcQueueFamilyIndex;
+        legacy.dstQueueFamilyIndex = barrier.dstQueueFamilyIndex;
+        legacy.buffer              = barrier.buffer;
+        legacy.offset              = barrier.offset;
+        legacy.size                = barrier.size;
+        legacyBufferBarriers.push_back(legacy);
+    }
+
     vkCmdPipelineBarrier(
-        frame.commandBuffer,
-        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        commandBuffer,
+        srcStages != 0 ? srcStages : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+        dstStages != 0 ? dstStages : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
         0,
         0,
         nullptr,
-        0,
-        nullptr,
-        static_cast<U32>(imageBarriers.size()),
-        imageBarriers.data());
+        static_cast<U32>(legacyBufferBarriers.size()),
+        legacyBufferBarriers.data(),
+        static_cast<U32>(legacyImageBarriers.size()),
+        legacyImageBarriers.data());
+}
+
+VkEvent JzVulkanDevice::AcquireFrameEvent()
+{
+    auto &frame = m_frames[m_currentFrameIndex];
+    if (frame.usedEvents < frame.events.size()) {
+        return frame.events[frame.usedEvents++];
+    }
+
+    // Events are reset from the host once the frame fence signals
+    VkEventCreateInfo eventInfo{};
+    eventInfo.sType = VK_STRUCTURE_TYPE_EVENT_CREATE_INFO;
+
+    VkEvent event = VK_NULL_HANDLE;
+    if (vkCreateEvent(m_device, &eventInfo, nullptr, &event) != VK_SUCCESS) {
+        JzRE_LOG_WARN("JzVulkanDevice: vkCreateEvent failed, split barrier recorded as a plain barrier");
+        return VK_NULL_HANDLE;
+    }
+
+    frame.events.push_back(event);
+    ++frame.usedEvents;
+    return event;
 }
 
 void JzVulkanDevice::Flush()
 {
-    if (!m_isInitialized || !m_readyForPresent) {
+    if (!m_isInitialized) {
+        return;
+    }
+
+    // A skipped frame (minimized, swapchain out of date) still submits its uploads
+    if (!m_readyForPresent) {
+        SubmitPendingUploads();
         return;
     }
 
@@ -1059,27 +1584,184 @@ Bool JzVulkanDevice::SupportsMultithreading() const
     return true;
 }
 
-void JzVulkanDevice::RequestSwapchainRecreate()
+Bool JzVulkanDevice::SupportsMultiDrawIndirect() const
 {
-    m_needsSwapchainRecreate = true;
+    return m_capabilities.supportsMultiDrawIndirect;
 }
 
-Bool JzVulkanDevice::ExecuteImmediate(const std::function<void(VkCommandBuffer)> &recordFn)
+Bool JzVulkanDevice::SupportsTextureFormat(JzETextureResourceFormat format) const
 {
-    if (!m_isInitialized || !recordFn) {
-        return false;
-    }
+    return m_capabilities.SupportsTextureFormat(format);
+}
 
-    VkCommandPool transientPool = VK_NULL_HANDLE;
+Bool JzVulkanDevice::SupportsMipmapGeneration() const
+{
+    return true;
+}
 
-    VkCommandPoolCreateInfo poolInfo{};
-    poolInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-    poolInfo.flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
-    poolInfo.queueFamilyIndex = m_graphicsQueueFamilyIndex;
+const JzRHIStats &JzVulkanDevice::GetStats() const
+{
+    return m_stats;
+}
 
-    if (vkCreateCommandPool(m_device, &poolInfo, nullptr, &transientPool) != VK_SUCCESS) {
-        return false;
-    }
+void JzVulkanDevice::SetGpuProfilingEnabled(Bool enabled)
+{
+    if (m_isFrameActive) {
+        JzRE_LOG_WARN("JzVulkanDevice: GPU profiling can only be toggled between frames");
+        return;
+    }
+
+    if (!enabled) {
+        Finish();
+        DestroyTimestampQueryPool();
+        m_resolvedGpuZones.clear();
+        m_stats.gpuTime = 0.0f;
+        return;
+    }
+
+    if (m_timestampQueryPool != VK_NULL_HANDLE || m_device == VK_NULL_HANDLE) {
+        return;
+    }
+
+    U32 queueFamilyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(m_physicalDevice, &queueFamilyCount, nullptr);
+    std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(m_physicalDevice, &queueFamilyCount, queueFamilies.data());
+
+    const U32 validBits =
+        m_graphicsQueueFamilyIndex < queueFamilyCount ? queueFamilies[m_graphicsQueueFamilyIndex].timestampValidBits : 0;
+    if (validBits == 0) {
+        JzRE_LOG_WARN("JzVulkanDevice: graphics queue does not support timestamps, GPU zones disabled");
+        return;
+    }
+
+    VkPhysicalDeviceProperties properties{};
+    vkGetPhysicalDeviceProperties(m_physicalDevice, &properties);
+    m_timestampPeriod = static_cast<F64>(properties.limits.timestampPeriod);
+    m_timestampMask   = validBits >= 64 ? ~0ULL : ((1ULL << validBits) - 1);
+
+    VkQueryPoolCreateInfo queryPoolInfo{};
+    queryPoolInfo.sType      = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    queryPoolInfo.queryType  = VK_QUERY_TYPE_TIMESTAMP;
+    queryPoolInfo.queryCount = __MAX_FRAMES_IN_FLIGHT * __MAX_GPU_ZONES_PER_FRAME * 2;
+
+    if (vkCreateQueryPool(m_device, &queryPoolInfo, nullptr, &m_timestampQueryPool) != VK_SUCCESS) {
+        JzRE_LOG_ERROR("JzVulkanDevice: vkCreateQueryPool failed, GPU zones disabled");
+        m_timestampQueryPool = VK_NULL_HANDLE;
+    }
+}
+
+std::vector<JzRHIGpuZone> JzVulkanDevice::ConsumeGpuZones()
+{
+    return std::exchange(m_resolvedGpuZones, {});
+}
+
+void JzVulkanDevice::BeginGpuZone(const String &name)
+{
+    auto &zoneFrame = m_gpuZoneFrames[m_currentFrameIndex];
+    if (!m_isFrameActive || !zoneFrame.queriesReset ||
+        zoneFrame.queryCount + 2 > __MAX_GPU_ZONES_PER_FRAME * 2) {
+        return;
+    }
+
+    const U32 baseQuery = m_currentFrameIndex * __MAX_GPU_ZONES_PER_FRAME * 2;
+
+    JzVulkanGpuZone zone;
+    zone.name       = name;
+    zone.beginQuery = zoneFrame.queryCount++;
+    zone.endQuery   = zoneFrame.queryCount++;
+
+    vkCmdWriteTimestamp(m_frames[m_currentFrameIndex].commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                        m_timestampQueryPool, baseQuery + zone.beginQuery);
+
+    zoneFrame.openZones.push_back(static_cast<U32>(zoneFrame.zones.size()));
+    zoneFrame.zones.push_back(std::move(zone));
+}
+
+void JzVulkanDevice::EndGpuZone()
+{
+    auto &zoneFrame = m_gpuZoneFrames[m_currentFrameIndex];
+    if (zoneFrame.openZones.empty()) {
+        return;
+    }
+
+    const auto &zone = zoneFrame.zones[zoneFrame.openZones.back()];
+    zoneFrame.openZones.pop_back();
+
+    const U32 baseQuery = m_currentFrameIndex * __MAX_GPU_ZONES_PER_FRAME * 2;
+    vkCmdWriteTimestamp(m_frames[m_currentFrameIndex].commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                        m_timestampQueryPool, baseQuery + zone.endQuery);
+}
+
+void JzVulkanDevice::ResolveGpuZones(JzVulkanGpuZoneFrame &zoneFrame)
+{
+    const U32 queryCount = zoneFrame.queryCount;
+    const U32 baseQuery  = static_cast<U32>(&zoneFrame - m_gpuZoneFrames.data()) * __MAX_GPU_ZONES_PER_FRAME * 2;
+
+    auto zones = std::move(zoneFrame.zones);
+    zoneFrame.zones.clear();
+    zoneFrame.openZones.clear();
+    zoneFrame.queryCount   = 0;
+    zoneFrame.queriesReset = false;
+
+    if (queryCount == 0 || m_timestampQueryPool == VK_NULL_HANDLE) {
+        return;
+    }
+
+    std::vector<U64> ticks(queryCount, 0);
+    const VkResult   result = vkGetQueryPoolResults(m_device, m_timestampQueryPool, baseQuery, queryCount,
+                                                    ticks.size() * sizeof(U64), ticks.data(), sizeof(U64),
+                                                    VK_QUERY_RESULT_64_BIT);
+    if (result != VK_SUCCESS) {
+        // Frame was never submitted
+        return;
+    }
+
+    U64 firstTick = std::numeric_limits<U64>::max();
+    U64 lastTick  = 0;
+    for (auto &tick : ticks) {
+        tick &= m_timestampMask;
+        firstTick = std::min(firstTick, tick);
+        lastTick  = std::max(lastTick, tick);
+    }
+
+    // Without calibrated timestamps, anchor the first GPU tick at the submit time
+    const auto toNs = [&](U64 tick) {
+        return zoneFrame.submitNs + static_cast<U64>(static_cast<F64>(tick - firstTick) * m_timestampPeriod);
+    };
+
+    for (const auto &zone : zones) {
+        JzRHIGpuZone resolved;
+        resolved.name    = zone.name;
+        resolved.beginNs = toNs(ticks[zone.beginQuery]);
+        resolved.endNs   = std::max(resolved.beginNs, toNs(ticks[zone.endQuery]));
+        m_resolvedGpuZones.push_back(std::move(resolved));
+    }
+
+    m_stats.gpuTime = static_cast<F32>(static_cast<F64>(lastTick - firstTick) * m_timestampPeriod / 1.0e6);
+}
+
+void JzVulkanDevice::RequestSwapchainRecreate()
+{
+    m_needsSwapchainRecreate = true;
+}
+
+Bool JzVulkanDevice::ExecuteImmediate(const std::function<void(VkCommandBuffer)> &recordFn)
+{
+    if (!m_isInitialized || !recordFn) {
+        return false;
+    }
+
+    VkCommandPool transientPool = VK_NULL_HANDLE;
+
+    VkCommandPoolCreateInfo poolInfo{};
+    poolInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+    poolInfo.queueFamilyIndex = m_graphicsQueueFamilyIndex;
+
+    if (vkCreateCommandPool(m_device, &poolInfo, nullptr, &transientPool) != VK_SUCCESS) {
+        return false;
+    }
 
     VkCommandBuffer transientCommandBuffer = VK_NULL_HANDLE;
 
@@ -1122,6 +1804,116 @@ Bool JzVulkanDevice::ExecuteImmediate(const std::function<void(VkCommandBuffer)>
     return submitResult == VK_SUCCESS;
 }
 
+VkCommandBuffer JzVulkanDevice::GetUploadTransferCommands()
+{
+    if (!HasDedicatedTransferQueue()) {
+        return GetUploadGraphicsCommands();
+    }
+    if (!m_isInitialized) {
+        return VK_NULL_HANDLE;
+    }
+
+    auto &batch = PrepareUploadBatch();
+    if (!batch.transferRecording) {
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        if (vkBeginCommandBuffer(batch.transferCommands, &beginInfo) != VK_SUCCESS) {
+            return VK_NULL_HANDLE;
+        }
+        batch.transferRecording = true;
+    }
+    return batch.transferCommands;
+}
+
+VkCommandBuffer JzVulkanDevice::GetUploadGraphicsCommands()
+{
+    if (!m_isInitialized) {
+        return VK_NULL_HANDLE;
+    }
+
+    auto &batch = PrepareUploadBatch();
+    if (!batch.graphicsRecording) {
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        if (vkBeginCommandBuffer(batch.graphicsCommands, &beginInfo) != VK_SUCCESS) {
+            return VK_NULL_HANDLE;
+        }
+        batch.graphicsRecording = true;
+    }
+    return batch.graphicsCommands;
+}
+
+void JzVulkanDevice::RetireStagingBuffer(VkBuffer buffer, VkDeviceMemory memory)
+{
+    if (m_device == VK_NULL_HANDLE) {
+        return;
+    }
+
+    m_uploadBatches[m_currentFrameIndex].stagingBuffers.emplace_back(buffer, memory);
+}
+
+void JzVulkanDevice::RetireImage(VkImage image, VkDeviceMemory memory, VkImageView imageView, VkSampler sampler)
+{
+    if (m_device == VK_NULL_HANDLE) {
+        return;
+    }
+
+    // One extra frame covers uploads recorded for the slot after the current one
+    JzVulkanRetiredImage retired;
+    retired.image     = image;
+    retired.memory    = memory;
+    retired.imageView = imageView;
+    retired.sampler   = sampler;
+    m_retiredImages.Push(retired, __MAX_FRAMES_IN_FLIGHT + 1);
+}
+
+JzVulkanDevice::JzVulkanUploadBatch &JzVulkanDevice::PrepareUploadBatch()
+{
+    // Uploads recorded between Flush and the next BeginFrame reuse a slot that may still be executing
+    auto &batch = m_uploadBatches[m_currentFrameIndex];
+    if (batch.inFlight) {
+        auto &frame = m_frames[m_currentFrameIndex];
+        vkWaitForFences(m_device, 1, &frame.inFlight, VK_TRUE, std::numeric_limits<U64>::max());
+        ReclaimUploadBatch(batch);
+    }
+    return batch;
+}
+
+void JzVulkanDevice::ReclaimUploadBatch(JzVulkanUploadBatch &batch)
+{
+    for (const auto &[buffer, memory] : batch.inFlightStagingBuffers) {
+        vkDestroyBuffer(m_device, buffer, nullptr);
+        vkFreeMemory(m_device, memory, nullptr);
+    }
+    batch.inFlightStagingBuffers.clear();
+
+    if (batch.transferPool != VK_NULL_HANDLE) {
+        vkResetCommandPool(m_device, batch.transferPool, 0);
+    }
+    if (batch.graphicsPool != VK_NULL_HANDLE) {
+        vkResetCommandPool(m_device, batch.graphicsPool, 0);
+    }
+    batch.inFlight = false;
+}
+
+void JzVulkanDevice::DestroyRetiredImage(const JzVulkanRetiredImage &retired)
+{
+    if (retired.sampler != VK_NULL_HANDLE) {
+        vkDestroySampler(m_device, retired.sampler, nullptr);
+    }
+    if (retired.imageView != VK_NULL_HANDLE) {
+        vkDestroyImageView(m_device, retired.imageView, nullptr);
+    }
+    if (retired.image != VK_NULL_HANDLE) {
+        vkDestroyImage(m_device, retired.image, nullptr);
+    }
+    if (retired.memory != VK_NULL_HANDLE) {
+        vkFreeMemory(m_device, retired.memory, nullptr);
+    }
+}
+
 U32 JzVulkanDevice::FindMemoryType(U32 typeFilter, VkMemoryPropertyFlags properties) const
 {
     if (m_physicalDevice == VK_NULL_HANDLE) {
@@ -1155,6 +1947,16 @@ VkCommandBuffer JzVulkanDevice::GetCurrentCommandBuffer() const
     return m_frames[m_currentFrameIndex].commandBuffer;
 }
 
+Bool JzVulkanDevice::EnsureSwapchainRenderPass()
+{
+    if (!m_isFrameActive) {
+        return false;
+    }
+
+    BindFramebuffer(nullptr, nullptr);
+    return EnsureRenderPass();
+}
+
 Bool JzVulkanDevice::CreateInstance()
 {
     U32                 glfwExtensionCount = 0;
@@ -1238,6 +2040,8 @@ Bool JzVulkanDevice::PickPhysicalDevice()
         m_physicalDevice            = device;
         m_graphicsQueueFamilyIndex  = queueFamilies.graphics.value();
         m_presentQueueFamilyIndex   = queueFamilies.present.value();
+        m_transferQueueFamilyIndex  = FindDedicatedTransferQueueFamily(GetQueueFamilyProperties(device))
+                                          .value_or(m_graphicsQueueFamilyIndex);
         return true;
     }
 
@@ -1250,6 +2054,7 @@ Bool JzVulkanDevice::CreateLogicalDevice()
     std::set<U32>                         uniqueQueueFamilies = {
         m_graphicsQueueFamilyIndex,
         m_presentQueueFamilyIndex,
+        m_transferQueueFamilyIndex,
     };
 
     const F32 queuePriority = 1.0f;
@@ -1272,10 +2077,51 @@ Bool JzVulkanDevice::CreateLogicalDevice()
     }
 #endif
 
+    VkPhysicalDeviceFeatures supportedFeatures{};
+    vkGetPhysicalDeviceFeatures(m_physicalDevice, &supportedFeatures);
+
+    // Per-draw data is fetched through firstInstance, so both features are required together
     VkPhysicalDeviceFeatures deviceFeatures{};
+    if (supportedFeatures.multiDrawIndirect == VK_TRUE && supportedFeatures.drawIndirectFirstInstance == VK_TRUE) {
+        deviceFeatures.multiDrawIndirect         = VK_TRUE;
+        deviceFeatures.drawIndirectFirstInstance = VK_TRUE;
+        m_capabilities.supportsMultiDrawIndirect = true;
+    }
+
+    // Cooked textures are uploaded as they are, so enable every compression family the device offers
+    if (supportedFeatures.textureCompressionBC == VK_TRUE) {
+        deviceFeatures.textureCompressionBC         = VK_TRUE;
+        m_capabilities.supportsTextureCompressionBC = true;
+    }
+    if (supportedFeatures.textureCompressionETC2 == VK_TRUE) {
+        deviceFeatures.textureCompressionETC2         = VK_TRUE;
+        m_capabilities.supportsTextureCompressionETC2 = true;
+    }
+    if (supportedFeatures.textureCompressionASTC_LDR == VK_TRUE) {
+        deviceFeatures.textureCompressionASTC_LDR     = VK_TRUE;
+        m_capabilities.supportsTextureCompressionASTC = true;
+    }
+
+    // synchronization2 gives per-barrier stage masks and split barriers through events
+    VkPhysicalDeviceSynchronization2FeaturesKHR synchronization2Features{};
+    synchronization2Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR;
+    Bool enableSynchronization2    = false;
+    if (HasDeviceExtension(m_physicalDevice, VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME)) {
+        VkPhysicalDeviceFeatures2 supportedFeatures2{};
+        supportedFeatures2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        supportedFeatures2.pNext = &synchronization2Features;
+        vkGetPhysicalDeviceFeatures2(m_physicalDevice, &supportedFeatures2);
+        enableSynchronization2 = synchronization2Features.synchronization2 == VK_TRUE;
+    }
+    if (enableSynchronization2) {
+        deviceExtensions.push_back(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
+        synchronization2Features.pNext            = nullptr;
+        synchronization2Features.synchronization2 = VK_TRUE;
+    }
 
     VkDeviceCreateInfo deviceCreateInfo{};
     deviceCreateInfo.sType                   = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceCreateInfo.pNext                   = enableSynchronization2 ? &synchronization2Features : nullptr;
     deviceCreateInfo.queueCreateInfoCount    = static_cast<U32>(queueCreateInfos.size());
     deviceCreateInfo.pQueueCreateInfos       = queueCreateInfos.data();
     deviceCreateInfo.pEnabledFeatures        = &deviceFeatures;
@@ -1289,6 +2135,19 @@ Bool JzVulkanDevice::CreateLogicalDevice()
 
     vkGetDeviceQueue(m_device, m_graphicsQueueFamilyIndex, 0, &m_graphicsQueue);
     vkGetDeviceQueue(m_device, m_presentQueueFamilyIndex, 0, &m_presentQueue);
+    vkGetDeviceQueue(m_device, m_transferQueueFamilyIndex, 0, &m_transferQueue);
+    if (HasDedicatedTransferQueue()) {
+        JzRE_LOG_INFO("JzVulkanDevice: texture uploads use transfer queue family {}", m_transferQueueFamilyIndex);
+    }
+
+    if (enableSynchronization2) {
+        m_cmdPipelineBarrier2 = reinterpret_cast<PFN_vkCmdPipelineBarrier2KHR>(
+            vkGetDeviceProcAddr(m_device, "vkCmdPipelineBarrier2KHR"));
+        m_cmdSetEvent2 = reinterpret_cast<PFN_vkCmdSetEvent2KHR>(
+            vkGetDeviceProcAddr(m_device, "vkCmdSetEvent2KHR"));
+        m_cmdWaitEvents2 = reinterpret_cast<PFN_vkCmdWaitEvents2KHR>(
+            vkGetDeviceProcAddr(m_device, "vkCmdWaitEvents2KHR"));
+    }
 
     return true;
 }
@@ -1446,7 +2305,18 @@ Bool JzVulkanDevice::CreateSwapchainRenderPass()
     renderPassInfo.dependencyCount = 1;
     renderPassInfo.pDependencies   = &dependency;
 
-    return vkCreateRenderPass(m_device, &renderPassInfo, nullptr, &m_swapchainRenderPass) == VK_SUCCESS;
+    if (vkCreateRenderPass(m_device, &renderPassInfo, nullptr, &m_swapchainRenderPass) != VK_SUCCESS) {
+        return false;
+    }
+
+    // Resuming after an offscreen pass keeps the color drawn so far. Depth was not
+    // stored by the clearing pass, so it starts over.
+    std::array<VkAttachmentDescription, 2> loadAttachments = attachments;
+    loadAttachments[0].loadOp        = VK_ATTACHMENT_LOAD_OP_LOAD;
+    loadAttachments[0].initialLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+
+    renderPassInfo.pAttachments = loadAttachments.data();
+    return vkCreateRenderPass(m_device, &renderPassInfo, nullptr, &m_swapchainLoadRenderPass) == VK_SUCCESS;
 }
 
 Bool JzVulkanDevice::CreateSwapchainDepthResources()
@@ -1594,6 +2464,38 @@ Bool JzVulkanDevice::CreateFrameSyncObjects()
         }
     }
 
+    // Upload pools are reset as a whole once the frame that submitted them has finished
+    for (auto &batch : m_uploadBatches) {
+        const std::array<std::pair<U32, std::pair<VkCommandPool *, VkCommandBuffer *>>, 2> pools = {{
+            {m_transferQueueFamilyIndex, {&batch.transferPool, &batch.transferCommands}},
+            {m_graphicsQueueFamilyIndex, {&batch.graphicsPool, &batch.graphicsCommands}},
+        }};
+        for (const auto &[queueFamily, target] : pools) {
+            VkCommandPoolCreateInfo poolInfo{};
+            poolInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            poolInfo.flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+            poolInfo.queueFamilyIndex = queueFamily;
+            if (vkCreateCommandPool(m_device, &poolInfo, nullptr, target.first) != VK_SUCCESS) {
+                return false;
+            }
+
+            VkCommandBufferAllocateInfo commandBufferAllocInfo{};
+            commandBufferAllocInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            commandBufferAllocInfo.commandPool        = *target.first;
+            commandBufferAllocInfo.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            commandBufferAllocInfo.commandBufferCount = 1;
+            if (vkAllocateCommandBuffers(m_device, &commandBufferAllocInfo, target.second) != VK_SUCCESS) {
+                return false;
+            }
+        }
+
+        VkSemaphoreCreateInfo semaphoreInfo{};
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        if (vkCreateSemaphore(m_device, &semaphoreInfo, nullptr, &batch.transferFinished) != VK_SUCCESS) {
+            return false;
+        }
+    }
+
     return true;
 }
 
@@ -1628,6 +2530,10 @@ void JzVulkanDevice::DestroySwapchainObjects()
         vkDestroyRenderPass(m_device, m_swapchainRenderPass, nullptr);
         m_swapchainRenderPass = VK_NULL_HANDLE;
     }
+    if (m_swapchainLoadRenderPass != VK_NULL_HANDLE) {
+        vkDestroyRenderPass(m_device, m_swapchainLoadRenderPass, nullptr);
+        m_swapchainLoadRenderPass = VK_NULL_HANDLE;
+    }
 
     for (auto imageView : m_swapchainImageViews) {
         if (imageView != VK_NULL_HANDLE) {
@@ -1669,6 +2575,48 @@ void JzVulkanDevice::DestroyFrameSyncObjects()
             frame.commandPool = VK_NULL_HANDLE;
             frame.commandBuffer = VK_NULL_HANDLE;
         }
+        for (const VkEvent event : frame.events) {
+            vkDestroyEvent(m_device, event, nullptr);
+        }
+        frame.events.clear();
+        frame.usedEvents = 0;
+    }
+
+    for (auto &batch : m_uploadBatches) {
+        batch.inFlightStagingBuffers.insert(batch.inFlightStagingBuffers.end(), batch.stagingBuffers.begin(),
+                                            batch.stagingBuffers.end());
+        batch.stagingBuffers.clear();
+        batch.transferRecording = false;
+        batch.graphicsRecording = false;
+        batch.inFlight          = true;
+        ReclaimUploadBatch(batch);
+
+        if (batch.transferFinished != VK_NULL_HANDLE) {
+            vkDestroySemaphore(m_device, batch.transferFinished, nullptr);
+            batch.transferFinished = VK_NULL_HANDLE;
+        }
+        for (VkCommandPool *pool : {&batch.transferPool, &batch.graphicsPool}) {
+            if (*pool != VK_NULL_HANDLE) {
+                vkDestroyCommandPool(m_device, *pool, nullptr);
+                *pool = VK_NULL_HANDLE;
+            }
+        }
+        batch.transferCommands = VK_NULL_HANDLE;
+        batch.graphicsCommands = VK_NULL_HANDLE;
+    }
+}
+
+void JzVulkanDevice::DestroyTimestampQueryPool()
+{
+    if (m_device != VK_NULL_HANDLE && m_timestampQueryPool != VK_NULL_HANDLE) {
+        vkDestroyQueryPool(m_device, m_timestampQueryPool, nullptr);
+    }
+    m_timestampQueryPool = VK_NULL_HANDLE;
+
+    for (auto &zoneFrame : m_gpuZoneFrames) {
+        zoneFrame.zones.clear();
+        zoneFrame.openZones.clear();
+        zoneFrame.queryCount = 0;
     }
 }
 
@@ -1822,9 +2770,10 @@ Bool JzVulkanDevice::BeginSwapchainRenderPass()
     };
     clearValues[1].depthStencil = {m_currentClear.depth, m_currentClear.stencil};
 
+    // Only the first instance of the frame clears; later ones continue its contents
     VkRenderPassBeginInfo renderPassBeginInfo{};
     renderPassBeginInfo.sType             = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-    renderPassBeginInfo.renderPass        = m_swapchainRenderPass;
+    renderPassBeginInfo.renderPass        = m_swapchainPassStarted ? m_swapchainLoadRenderPass : m_swapchainRenderPass;
     renderPassBeginInfo.framebuffer       = m_swapchainFramebuffers[m_currentImageIndex];
     renderPassBeginInfo.renderArea.offset = {0, 0};
     renderPassBeginInfo.renderArea.extent = m_swapchainExtent;
@@ -1832,6 +2781,12 @@ Bool JzVulkanDevice::BeginSwapchainRenderPass()
     renderPassBeginInfo.pClearValues      = clearValues;
 
     vkCmdBeginRenderPass(frame.commandBuffer, &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
+    m_isRenderPassActive         = true;
+    m_swapchainPassStarted       = true;
+    m_activeCompatibleRenderPass = m_swapchainRenderPass;
+    m_activeRenderArea           = m_swapchainExtent;
+    m_activeHasColor             = true;
+    m_activeHasDepth             = true;
 
     VkViewport viewport{};
     viewport.x        = m_currentViewport.x;
@@ -1851,32 +2806,254 @@ Bool JzVulkanDevice::BeginSwapchainRenderPass()
     return true;
 }
 
-void JzVulkanDevice::EndSwapchainRenderPass()
+Bool JzVulkanDevice::BeginOffscreenRenderPass()
+{
+    auto &frame = m_frames[m_currentFrameIndex];
+
+    const auto color = m_currentFramebuffer->GetVulkanColorAttachment();
+    const auto depth = m_currentFramebuffer->GetVulkanDepthAttachment();
+    if (!color && !depth) {
+        return false;
+    }
+
+    // Contents that are cleared or discarded need no layout transition from their old layout
+    JzVulkanRenderPassKey key;
+    if (color) {
+        key.colorFormat        = color->GetVkFormat();
+        key.colorLoadOp        = ConvertLoadOp(m_currentAttachmentOps.colorLoad);
+        key.colorStoreOp       = ConvertStoreOp(m_currentAttachmentOps.colorStore);
+        key.colorInitialLayout = key.colorLoadOp == VK_ATTACHMENT_LOAD_OP_LOAD ? color->GetLayout() : VK_IMAGE_LAYOUT_UNDEFINED;
+    }
+    if (depth) {
+        key.depthFormat        = depth->GetVkFormat();
+        key.depthLoadOp        = ConvertLoadOp(m_currentAttachmentOps.depthLoad);
+        key.depthStoreOp       = ConvertStoreOp(m_currentAttachmentOps.depthStore);
+        key.depthInitialLayout = key.depthLoadOp == VK_ATTACHMENT_LOAD_OP_LOAD ? depth->GetLayout() : VK_IMAGE_LAYOUT_UNDEFINED;
+    }
+
+    const VkRenderPass renderPass           = GetOrCreateRenderPass(key);
+    const VkRenderPass compatibleRenderPass = GetCompatibleRenderPass(key.colorFormat, key.depthFormat);
+    if (renderPass == VK_NULL_HANDLE || compatibleRenderPass == VK_NULL_HANDLE) {
+        return false;
+    }
+
+    const VkFramebuffer framebuffer = m_currentFramebuffer->GetOrCreateHandle(compatibleRenderPass);
+    if (framebuffer == VK_NULL_HANDLE) {
+        return false;
+    }
+
+    const auto      &sizeSource = color ? color : depth;
+    const VkExtent2D extent{sizeSource->GetWidth(), sizeSource->GetHeight()};
+
+    std::array<VkClearValue, 2> clearValues{};
+    U32                         clearValueCount = 0;
+    if (color) {
+        clearValues[clearValueCount++].color = {
+            {m_renderPassClear.colorR, m_renderPassClear.colorG, m_renderPassClear.colorB, m_renderPassClear.colorA},
+        };
+    }
+    if (depth) {
+        clearValues[clearValueCount++].depthStencil = {m_renderPassClear.depth, m_renderPassClear.stencil};
+    }
+
+    VkRenderPassBeginInfo renderPassBeginInfo{};
+    renderPassBeginInfo.sType             = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    renderPassBeginInfo.renderPass        = renderPass;
+    renderPassBeginInfo.framebuffer       = framebuffer;
+    renderPassBeginInfo.renderArea.offset = {0, 0};
+    renderPassBeginInfo.renderArea.extent = extent;
+    renderPassBeginInfo.clearValueCount   = clearValueCount;
+    renderPassBeginInfo.pClearValues      = clearValues.data();
+
+    vkCmdBeginRenderPass(frame.commandBuffer, &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
+    m_isRenderPassActive         = true;
+    m_activeCompatibleRenderPass = compatibleRenderPass;
+    m_activeRenderArea           = extent;
+    m_activeHasColor             = color != nullptr;
+    m_activeHasDepth             = depth != nullptr;
+
+    VkViewport viewport{};
+    viewport.x        = m_currentViewport.x;
+    viewport.y        = m_currentViewport.y;
+    viewport.width    = m_currentViewport.width;
+    viewport.height   = m_currentViewport.height;
+    viewport.minDepth = m_currentViewport.minDepth;
+    viewport.maxDepth = m_currentViewport.maxDepth;
+
+    VkRect2D scissor{};
+    scissor.offset = {0, 0};
+    scissor.extent = extent;
+    if (m_scissorSet) {
+        scissor.offset = {m_currentScissor.x, m_currentScissor.y};
+        scissor.extent = {m_currentScissor.width, m_currentScissor.height};
+    }
+
+    vkCmdSetViewport(frame.commandBuffer, 0, 1, &viewport);
+    vkCmdSetScissor(frame.commandBuffer, 0, 1, &scissor);
+
+    return true;
+}
+
+Bool JzVulkanDevice::EnsureRenderPass()
 {
+    if (m_isRenderPassActive) {
+        return true;
+    }
+
+    return m_currentFramebuffer ? BeginOffscreenRenderPass() : BeginSwapchainRenderPass();
+}
+
+void JzVulkanDevice::EndActiveRenderPass()
+{
+    if (!m_isRenderPassActive) {
+        return;
+    }
+
     auto &frame = m_frames[m_currentFrameIndex];
     vkCmdEndRenderPass(frame.commandBuffer);
+    m_isRenderPassActive = false;
+
+    // Offscreen render passes leave their attachments in attachment layouts
+    if (m_currentFramebuffer && m_activeCompatibleRenderPass != m_swapchainRenderPass) {
+        if (const auto color = m_currentFramebuffer->GetVulkanColorAttachment()) {
+            color->SetLayout(VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+        }
+        if (const auto depth = m_currentFramebuffer->GetVulkanDepthAttachment()) {
+            depth->SetLayout(VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
+        }
+    }
+}
+
+VkRenderPass JzVulkanDevice::GetCompatibleRenderPass(VkFormat colorFormat, VkFormat depthFormat)
+{
+    // Compatibility ignores load/store ops and layouts, so one canonical variant stands for all
+    JzVulkanRenderPassKey key;
+    key.colorFormat = colorFormat;
+    key.depthFormat = depthFormat;
+    return GetOrCreateRenderPass(key);
+}
+
+VkRenderPass JzVulkanDevice::GetOrCreateRenderPass(const JzVulkanRenderPassKey &key)
+{
+    const auto cached = m_renderPassCache.find(key);
+    if (cached != m_renderPassCache.end()) {
+        return cached->second;
+    }
+
+    if (m_device == VK_NULL_HANDLE) {
+        return VK_NULL_HANDLE;
+    }
+
+    std::vector<VkAttachmentDescription> attachments;
+    VkAttachmentReference                colorAttachmentRef{};
+    VkAttachmentReference                depthAttachmentRef{};
+
+    if (key.colorFormat != VK_FORMAT_UNDEFINED) {
+        VkAttachmentDescription colorAttachment{};
+        colorAttachment.format         = key.colorFormat;
+        colorAttachment.samples        = VK_SAMPLE_COUNT_1_BIT;
+        colorAttachment.loadOp         = key.colorLoadOp;
+        colorAttachment.storeOp        = key.colorStoreOp;
+        colorAttachment.stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        colorAttachment.initialLayout  = key.colorInitialLayout;
+        colorAttachment.finalLayout    = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+        colorAttachmentRef.attachment = static_cast<U32>(attachments.size());
+        colorAttachmentRef.layout     = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        attachments.push_back(colorAttachment);
+    }
+
+    if (key.depthFormat != VK_FORMAT_UNDEFINED) {
+        const Bool hasStencil = (GetImageAspectMask(key.depthFormat) & VK_IMAGE_ASPECT_STENCIL_BIT) != 0;
+
+        VkAttachmentDescription depthAttachment{};
+        depthAttachment.format         = key.depthFormat;
+        depthAttachment.samples        = VK_SAMPLE_COUNT_1_BIT;
+        depthAttachment.loadOp         = key.depthLoadOp;
+        depthAttachment.storeOp        = key.depthStoreOp;
+        depthAttachment.stencilLoadOp  = hasStencil ? key.depthLoadOp : VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        depthAttachment.stencilStoreOp = hasStencil ? key.depthStoreOp : VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        depthAttachment.initialLayout  = key.depthInitialLayout;
+        depthAttachment.finalLayout    = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+        depthAttachmentRef.attachment = static_cast<U32>(attachments.size());
+        depthAttachmentRef.layout     = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+        attachments.push_back(depthAttachment);
+    }
+
+    VkSubpassDescription subpass{};
+    subpass.pipelineBindPoint       = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount    = key.colorFormat != VK_FORMAT_UNDEFINED ? 1U : 0U;
+    subpass.pColorAttachments       = key.colorFormat != VK_FORMAT_UNDEFINED ? &colorAttachmentRef : nullptr;
+    subpass.pDepthStencilAttachment = key.depthFormat != VK_FORMAT_UNDEFINED ? &depthAttachmentRef : nullptr;
+
+    // Earlier attachment writes and samples finish before this pass loads or overwrites the targets
+    VkSubpassDependency dependency{};
+    dependency.srcSubpass    = VK_SUBPASS_EXTERNAL;
+    dependency.dstSubpass    = 0;
+    dependency.srcStageMask  = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT |
+                               VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    dependency.dstStageMask  = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT |
+                               VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+    dependency.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+                               VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+
+    VkRenderPassCreateInfo renderPassInfo{};
+    renderPassInfo.sType           = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    renderPassInfo.attachmentCount = static_cast<U32>(attachments.size());
+    renderPassInfo.pAttachments    = attachments.data();
+    renderPassInfo.subpassCount    = 1;
+    renderPassInfo.pSubpasses      = &subpass;
+    renderPassInfo.dependencyCount = 1;
+    renderPassInfo.pDependencies   = &dependency;
+
+    VkRenderPass renderPass = VK_NULL_HANDLE;
+    if (vkCreateRenderPass(m_device, &renderPassInfo, nullptr, &renderPass) != VK_SUCCESS) {
+        JzRE_LOG_ERROR("JzVulkanDevice: vkCreateRenderPass failed for offscreen target (color={}, depth={})",
+                       static_cast<I32>(key.colorFormat), static_cast<I32>(key.depthFormat));
+        return VK_NULL_HANDLE;
+    }
+
+    m_renderPassCache.emplace(key, renderPass);
+    return renderPass;
+}
+
+void JzVulkanDevice::DestroyRenderPassCache()
+{
+    if (m_device != VK_NULL_HANDLE) {
+        for (const auto &[key, renderPass] : m_renderPassCache) {
+            (void)key;
+            vkDestroyRenderPass(m_device, renderPass, nullptr);
+        }
+    }
+    m_renderPassCache.clear();
+}
+
+void JzVulkanDevice::RetireFramebuffer(VkFramebuffer framebuffer)
+{
+    if (framebuffer == VK_NULL_HANDLE || m_device == VK_NULL_HANDLE) {
+        return;
+    }
+
+    m_retiredFramebuffers.Push(framebuffer, __MAX_FRAMES_IN_FLIGHT);
 }
 
 Bool JzVulkanDevice::SubmitAndPresent()
 {
     auto &frame = m_frames[m_currentFrameIndex];
 
-    const VkPipelineStageFlags waitStages[] = {
-        VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
-    };
+    std::vector<VkSemaphore>          waitSemaphores = {frame.imageAvailable};
+    std::vector<VkPipelineStageFlags> waitStages     = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
+    std::vector<VkCommandBuffer>      commandBuffers;
 
-    VkSubmitInfo submitInfo{};
-    submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    submitInfo.waitSemaphoreCount   = 1;
-    submitInfo.pWaitSemaphores      = &frame.imageAvailable;
-    submitInfo.pWaitDstStageMask    = waitStages;
-    submitInfo.commandBufferCount   = 1;
-    submitInfo.pCommandBuffers      = &frame.commandBuffer;
-    submitInfo.signalSemaphoreCount = 1;
-    submitInfo.pSignalSemaphores    = &frame.renderFinished;
-
-    if (vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, frame.inFlight) != VK_SUCCESS) {
-        JzRE_LOG_ERROR("JzVulkanDevice: vkQueueSubmit failed");
+    EndUploadBatch(m_uploadBatches[m_currentFrameIndex], waitSemaphores, waitStages, commandBuffers);
+    commandBuffers.push_back(frame.commandBuffer);
+
+    m_gpuZoneFrames[m_currentFrameIndex].submitNs = JzProfiler::NowNs();
+
+    if (!SubmitGraphics(waitSemaphores, waitStages, commandBuffers, frame.renderFinished, frame.inFlight)) {
         return false;
     }
 
@@ -1907,4 +3084,97 @@ Bool JzVulkanDevice::SubmitAndPresent()
     return true;
 }
 
+void JzVulkanDevice::EndUploadBatch(JzVulkanUploadBatch &batch, std::vector<VkSemaphore> &waitSemaphores,
+                                    std::vector<VkPipelineStageFlags> &waitStages,
+                                    std::vector<VkCommandBuffer>      &commandBuffers)
+{
+    if (!batch.transferRecording && !batch.graphicsRecording) {
+        return;
+    }
+
+    // Copies run on the transfer queue; the graphics side acquires ownership after they finish
+    if (batch.transferRecording) {
+        vkEndCommandBuffer(batch.transferCommands);
+        batch.transferRecording = false;
+
+        VkSubmitInfo transferSubmit{};
+        transferSubmit.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        transferSubmit.commandBufferCount   = 1;
+        transferSubmit.pCommandBuffers      = &batch.transferCommands;
+        transferSubmit.signalSemaphoreCount = 1;
+        transferSubmit.pSignalSemaphores    = &batch.transferFinished;
+
+        if (vkQueueSubmit(m_transferQueue, 1, &transferSubmit, VK_NULL_HANDLE) == VK_SUCCESS) {
+            waitSemaphores.push_back(batch.transferFinished);
+            waitStages.push_back(VK_PIPELINE_STAGE_TRANSFER_BIT);
+        } else {
+            JzRE_LOG_ERROR("JzVulkanDevice: vkQueueSubmit on the transfer queue failed");
+        }
+    }
+    if (batch.graphicsRecording) {
+        vkEndCommandBuffer(batch.graphicsCommands);
+        batch.graphicsRecording = false;
+        commandBuffers.push_back(batch.graphicsCommands);
+    }
+
+    // Even a failed submit leaves the staging buffers to the next wait on this slot
+    batch.inFlightStagingBuffers.insert(batch.inFlightStagingBuffers.end(), batch.stagingBuffers.begin(),
+                                        batch.stagingBuffers.end());
+    batch.stagingBuffers.clear();
+    batch.inFlight = true;
+}
+
+Bool JzVulkanDevice::SubmitGraphics(const std::vector<VkSemaphore>          &waitSemaphores,
+                                    const std::vector<VkPipelineStageFlags> &waitStages,
+                                    const std::vector<VkCommandBuffer> &commandBuffers, VkSemaphore signalSemaphore,
+                                    VkFence fence)
+{
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.waitSemaphoreCount   = static_cast<U32>(waitSemaphores.size());
+    submitInfo.pWaitSemaphores      = waitSemaphores.data();
+    submitInfo.pWaitDstStageMask    = waitStages.data();
+    submitInfo.commandBufferCount   = static_cast<U32>(commandBuffers.size());
+    submitInfo.pCommandBuffers      = commandBuffers.data();
+    submitInfo.signalSemaphoreCount = signalSemaphore != VK_NULL_HANDLE ? 1 : 0;
+    submitInfo.pSignalSemaphores    = &signalSemaphore;
+
+    const VkResult submitResult = vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, fence);
+    if (submitResult == VK_SUCCESS) {
+        return true;
+    }
+    JzRE_LOG_ERROR("JzVulkanDevice: vkQueueSubmit failed ({})", static_cast<I32>(submitResult));
+
+    // Nothing consumed the wait semaphores (e.g. a signaled transferFinished) and the fence
+    // would never signal; an empty submit unsignals the one and signals the other
+    VkSubmitInfo drainInfo{};
+    drainInfo.sType              = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    drainInfo.waitSemaphoreCount = static_cast<U32>(waitSemaphores.size());
+    drainInfo.pWaitSemaphores    = waitSemaphores.data();
+    drainInfo.pWaitDstStageMask  = waitStages.data();
+    if (vkQueueSubmit(m_graphicsQueue, 1, &drainInfo, fence) != VK_SUCCESS) {
+        JzRE_LOG_ERROR("JzVulkanDevice: could not recover from the failed submit");
+    }
+    return false;
+}
+
+void JzVulkanDevice::SubmitPendingUploads()
+{
+    auto &batch = m_uploadBatches[m_currentFrameIndex];
+    if (!batch.transferRecording && !batch.graphicsRecording) {
+        return;
+    }
+
+    // The slot's fence tracks this submit too, so the last frame that used it must be done
+    auto &frame = m_frames[m_currentFrameIndex];
+    vkWaitForFences(m_device, 1, &frame.inFlight, VK_TRUE, std::numeric_limits<U64>::max());
+    vkResetFences(m_device, 1, &frame.inFlight);
+
+    std::vector<VkSemaphore>          waitSemaphores;
+    std::vector<VkPipelineStageFlags> waitStages;
+    std::vector<VkCommandBuffer>      commandBuffers;
+    EndUploadBatch(batch, waitSemaphores, waitStages, commandBuffers);
+    SubmitGraphics(waitSemaphores, waitStages, commandBuffers, VK_NULL_HANDLE, frame.inFlight);
+}
+
 } // namespace JzRE
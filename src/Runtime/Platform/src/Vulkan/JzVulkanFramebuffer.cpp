@@ -7,13 +7,21 @@
 
 #include <algorithm>
 
+#include "JzRE/Runtime/Core/JzLogger.h"
+#include "JzRE/Runtime/Platform/Vulkan/JzVulkanDevice.h"
+#include "JzRE/Runtime/Platform/Vulkan/JzVulkanTexture.h"
+
 namespace JzRE {
 
-JzVulkanFramebuffer::JzVulkanFramebuffer(const String &debugName) :
-    JzGPUFramebufferObject(debugName)
+JzVulkanFramebuffer::JzVulkanFramebuffer(JzVulkanDevice &device, const String &debugName) :
+    JzGPUFramebufferObject(debugName),
+    m_owner(&device)
 { }
 
-JzVulkanFramebuffer::~JzVulkanFramebuffer() = default;
+JzVulkanFramebuffer::~JzVulkanFramebuffer()
+{
+    RetireHandle();
+}
 
 void JzVulkanFramebuffer::AttachColorTexture(std::shared_ptr<JzGPUTextureObject> texture, U32 attachmentIndex)
 {
@@ -50,4 +58,83 @@ Bool JzVulkanFramebuffer::IsComplete() const
     return hasColor || m_depthAttachment != nullptr || m_depthStencilAttachment != nullptr;
 }
 
+std::shared_ptr<JzVulkanTexture> JzVulkanFramebuffer::GetVulkanColorAttachment() const
+{
+    if (m_colorAttachments.empty()) {
+        return nullptr;
+    }
+
+    auto texture = std::dynamic_pointer_cast<JzVulkanTexture>(m_colorAttachments[0]);
+    return texture && texture->GetImageView() != VK_NULL_HANDLE ? texture : nullptr;
+}
+
+std::shared_ptr<JzVulkanTexture> JzVulkanFramebuffer::GetVulkanDepthAttachment() const
+{
+    auto texture = std::dynamic_pointer_cast<JzVulkanTexture>(
+        m_depthStencilAttachment ? m_depthStencilAttachment : m_depthAttachment);
+    return texture && texture->GetImageView() != VK_NULL_HANDLE ? texture : nullptr;
+}
+
+VkFramebuffer JzVulkanFramebuffer::GetOrCreateHandle(VkRenderPass renderPass)
+{
+    if (!m_owner || m_owner->GetVkDevice() == VK_NULL_HANDLE || renderPass == VK_NULL_HANDLE) {
+        return VK_NULL_HANDLE;
+    }
+
+    const auto color = GetVulkanColorAttachment();
+    const auto depth = GetVulkanDepthAttachment();
+    if (!color && !depth) {
+        return VK_NULL_HANDLE;
+    }
+
+    // Attachment order matches the render passes built by the device: color, then depth
+    std::vector<VkImageView> views;
+    if (color) {
+        views.push_back(color->GetImageView());
+    }
+    if (depth) {
+        views.push_back(depth->GetImageView());
+    }
+
+    const auto      &sizeSource = color ? color : depth;
+    const VkExtent2D extent{sizeSource->GetWidth(), sizeSource->GetHeight()};
+
+    if (m_handle != VK_NULL_HANDLE && views == m_handleViews &&
+        extent.width == m_handleExtent.width && extent.height == m_handleExtent.height) {
+        return m_handle;
+    }
+
+    RetireHandle();
+
+    VkFramebufferCreateInfo framebufferInfo{};
+    framebufferInfo.sType           = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+    framebufferInfo.renderPass      = renderPass;
+    framebufferInfo.attachmentCount = static_cast<U32>(views.size());
+    framebufferInfo.pAttachments    = views.data();
+    framebufferInfo.width           = extent.width;
+    framebufferInfo.height          = extent.height;
+    framebufferInfo.layers          = 1;
+
+    if (vkCreateFramebuffer(m_owner->GetVkDevice(), &framebufferInfo, nullptr, &m_handle) != VK_SUCCESS) {
+        JzRE_LOG_ERROR("JzVulkanFramebuffer: vkCreateFramebuffer failed for '{}'", GetDebugName());
+        m_handle = VK_NULL_HANDLE;
+        return VK_NULL_HANDLE;
+    }
+
+    m_handleViews  = std::move(views);
+    m_handleExtent = extent;
+    return m_handle;
+}
+
+void JzVulkanFramebuffer::RetireHandle()
+{
+    if (m_handle != VK_NULL_HANDLE && m_owner && m_owner->GetVkDevice() != VK_NULL_HANDLE) {
+        m_owner->RetireFramebuffer(m_handle);
+    }
+
+    m_handle = VK_NULL_HANDLE;
+    m_handleViews.clear();
+    m_handleExtent = {};
+}
+
 } // namespace JzRE
@@ -334,6 +334,14 @@ JzVulkanPipeline::~JzVulkanPipeline()
         m_pipeline = VK_NULL_HANDLE;
     }
 
+    for (const auto &[renderPass, pipeline] : m_pipelineVariants) {
+        (void)renderPass;
+        if (pipeline != VK_NULL_HANDLE) {
+            vkDestroyPipeline(m_owner->GetVkDevice(), pipeline, nullptr);
+        }
+    }
+    m_pipelineVariants.clear();
+
     DestroyDescriptorResources();
 
     if (m_pipelineLayout != VK_NULL_HANDLE) {
@@ -813,93 +821,11 @@ Bool JzVulkanPipeline::CreateGraphicsPipeline()
         }
     }
 
-    VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
-    vertexInputInfo.sType                           = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-    vertexInputInfo.vertexBindingDescriptionCount   = static_cast<U32>(vertexBindings.size());
-    vertexInputInfo.pVertexBindingDescriptions      = vertexBindings.empty() ? nullptr : vertexBindings.data();
-    vertexInputInfo.vertexAttributeDescriptionCount = static_cast<U32>(vertexAttributes.size());
-    vertexInputInfo.pVertexAttributeDescriptions    = vertexAttributes.empty() ? nullptr : vertexAttributes.data();
+    m_vertexBindings   = std::move(vertexBindings);
+    m_vertexAttributes = std::move(vertexAttributes);
 
-    VkPipelineInputAssemblyStateCreateInfo inputAssembly{};
-    inputAssembly.sType                  = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-    inputAssembly.topology               = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
-    inputAssembly.primitiveRestartEnable = VK_FALSE;
-
-    VkPipelineViewportStateCreateInfo viewportState{};
-    viewportState.sType         = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
-    viewportState.viewportCount = 1;
-    viewportState.scissorCount  = 1;
-
-    const auto &state = GetRenderState();
-
-    VkPipelineRasterizationStateCreateInfo rasterizer{};
-    rasterizer.sType                   = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
-    rasterizer.depthClampEnable        = VK_FALSE;
-    rasterizer.rasterizerDiscardEnable = VK_FALSE;
-    rasterizer.polygonMode             = state.wireframe ? VK_POLYGON_MODE_LINE : VK_POLYGON_MODE_FILL;
-    rasterizer.lineWidth               = 1.0f;
-    rasterizer.cullMode                = ConvertCullMode(state.cullMode);
-    rasterizer.frontFace               = VK_FRONT_FACE_COUNTER_CLOCKWISE;
-    rasterizer.depthBiasEnable         = VK_FALSE;
-
-    VkPipelineMultisampleStateCreateInfo multisampling{};
-    multisampling.sType                = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
-    multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
-    multisampling.sampleShadingEnable  = VK_FALSE;
-
-    VkPipelineDepthStencilStateCreateInfo depthStencil{};
-    depthStencil.sType                 = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
-    depthStencil.depthTestEnable       = state.depthTest ? VK_TRUE : VK_FALSE;
-    depthStencil.depthWriteEnable      = state.depthWrite ? VK_TRUE : VK_FALSE;
-    depthStencil.depthCompareOp        = VK_COMPARE_OP_LESS_OR_EQUAL;
-    depthStencil.depthBoundsTestEnable = VK_FALSE;
-    depthStencil.stencilTestEnable     = VK_FALSE;
-
-    VkPipelineColorBlendAttachmentState colorBlendAttachment{};
-    colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
-    ConfigureBlend(state.blendMode, colorBlendAttachment);
-
-    VkPipelineColorBlendStateCreateInfo colorBlending{};
-    colorBlending.sType           = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
-    colorBlending.logicOpEnable   = VK_FALSE;
-    colorBlending.attachmentCount = 1;
-    colorBlending.pAttachments    = &colorBlendAttachment;
-
-    const std::array<VkDynamicState, 2> dynamicStates = {
-        VK_DYNAMIC_STATE_VIEWPORT,
-        VK_DYNAMIC_STATE_SCISSOR,
-    };
-
-    VkPipelineDynamicStateCreateInfo dynamicState{};
-    dynamicState.sType             = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
-    dynamicState.dynamicStateCount = static_cast<U32>(dynamicStates.size());
-    dynamicState.pDynamicStates    = dynamicStates.data();
-
-    VkGraphicsPipelineCreateInfo pipelineInfo{};
-    pipelineInfo.sType               = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-    pipelineInfo.stageCount          = static_cast<U32>(shaderStages.size());
-    pipelineInfo.pStages             = shaderStages.data();
-    pipelineInfo.pVertexInputState   = &vertexInputInfo;
-    pipelineInfo.pInputAssemblyState = &inputAssembly;
-    pipelineInfo.pViewportState      = &viewportState;
-    pipelineInfo.pRasterizationState = &rasterizer;
-    pipelineInfo.pMultisampleState   = &multisampling;
-    pipelineInfo.pDepthStencilState  = &depthStencil;
-    pipelineInfo.pColorBlendState    = &colorBlending;
-    pipelineInfo.pDynamicState       = &dynamicState;
-    pipelineInfo.layout              = m_pipelineLayout;
-    pipelineInfo.renderPass          = m_owner->GetSwapchainRenderPass();
-    pipelineInfo.subpass             = 0;
-
-    const VkResult pipelineResult = vkCreateGraphicsPipelines(
-        m_owner->GetVkDevice(),
-        VK_NULL_HANDLE,
-        1,
-        &pipelineInfo,
-        nullptr,
-        &m_pipeline);
-    if (pipelineResult != VK_SUCCESS) {
-        JzRE_LOG_ERROR("JzVulkanPipeline: vkCreateGraphicsPipelines failed with {}", static_cast<I32>(pipelineResult));
+    m_pipeline = BuildPipeline(m_owner->GetSwapchainRenderPass(), true);
+    if (m_pipeline == VK_NULL_HANDLE) {
         vkDestroyPipelineLayout(m_owner->GetVkDevice(), m_pipelineLayout, nullptr);
         m_pipelineLayout = VK_NULL_HANDLE;
         DestroyDescriptorSetLayouts();
@@ -1035,6 +961,144 @@ Bool JzVulkanPipeline::CreateGraphicsPipeline()
     return true;
 }
 
+VkPipeline JzVulkanPipeline::GetPipeline(VkRenderPass renderPass, Bool hasColorAttachment)
+{
+    if (!m_owner || renderPass == VK_NULL_HANDLE || renderPass == m_owner->GetSwapchainRenderPass()) {
+        return m_pipeline;
+    }
+
+    const auto variant = m_pipelineVariants.find(renderPass);
+    if (variant != m_pipelineVariants.end()) {
+        return variant->second;
+    }
+
+    // Failed builds are cached too, so a broken signature does not retry every draw
+    const VkPipeline pipeline      = BuildPipeline(renderPass, hasColorAttachment);
+    m_pipelineVariants[renderPass] = pipeline;
+    return pipeline;
+}
+
+VkPipeline JzVulkanPipeline::BuildPipeline(VkRenderPass renderPass, Bool hasColorAttachment) const
+{
+    if (!m_owner || m_owner->GetVkDevice() == VK_NULL_HANDLE || renderPass == VK_NULL_HANDLE ||
+        m_pipelineLayout == VK_NULL_HANDLE) {
+        return VK_NULL_HANDLE;
+    }
+
+    std::vector<VkPipelineShaderStageCreateInfo> shaderStages;
+    shaderStages.reserve(m_shaders.size());
+
+    for (const auto &shader : m_shaders) {
+        if (!shader || shader->GetModule() == VK_NULL_HANDLE) {
+            continue;
+        }
+
+        VkPipelineShaderStageCreateInfo stageInfo{};
+        stageInfo.sType  = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        stageInfo.stage  = shader->GetStage();
+        stageInfo.module = shader->GetModule();
+        stageInfo.pName  = shader->GetEntryPoint().empty() ? "main" : shader->GetEntryPoint().c_str();
+        shaderStages.push_back(stageInfo);
+    }
+
+    if (shaderStages.empty()) {
+        return VK_NULL_HANDLE;
+    }
+
+    VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
+    vertexInputInfo.sType                           = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    vertexInputInfo.vertexBindingDescriptionCount   = static_cast<U32>(m_vertexBindings.size());
+    vertexInputInfo.pVertexBindingDescriptions      = m_vertexBindings.empty() ? nullptr : m_vertexBindings.data();
+    vertexInputInfo.vertexAttributeDescriptionCount = static_cast<U32>(m_vertexAttributes.size());
+    vertexInputInfo.pVertexAttributeDescriptions    = m_vertexAttributes.empty() ? nullptr : m_vertexAttributes.data();
+
+    VkPipelineInputAssemblyStateCreateInfo inputAssembly{};
+    inputAssembly.sType                  = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    inputAssembly.topology               = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    inputAssembly.primitiveRestartEnable = VK_FALSE;
+
+    VkPipelineViewportStateCreateInfo viewportState{};
+    viewportState.sType         = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewportState.viewportCount = 1;
+    viewportState.scissorCount  = 1;
+
+    const auto &state = GetRenderState();
+
+    VkPipelineRasterizationStateCreateInfo rasterizer{};
+    rasterizer.sType                   = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterizer.depthClampEnable        = VK_FALSE;
+    rasterizer.rasterizerDiscardEnable = VK_FALSE;
+    rasterizer.polygonMode             = state.wireframe ? VK_POLYGON_MODE_LINE : VK_POLYGON_MODE_FILL;
+    rasterizer.lineWidth               = 1.0f;
+    rasterizer.cullMode                = ConvertCullMode(state.cullMode);
+    rasterizer.frontFace               = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    rasterizer.depthBiasEnable         = VK_FALSE;
+
+    VkPipelineMultisampleStateCreateInfo multisampling{};
+    multisampling.sType                = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+    multisampling.sampleShadingEnable  = VK_FALSE;
+
+    VkPipelineDepthStencilStateCreateInfo depthStencil{};
+    depthStencil.sType                 = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+    depthStencil.depthTestEnable       = state.depthTest ? VK_TRUE : VK_FALSE;
+    depthStencil.depthWriteEnable      = state.depthWrite ? VK_TRUE : VK_FALSE;
+    depthStencil.depthCompareOp        = VK_COMPARE_OP_LESS_OR_EQUAL;
+    depthStencil.depthBoundsTestEnable = VK_FALSE;
+    depthStencil.stencilTestEnable     = VK_FALSE;
+
+    VkPipelineColorBlendAttachmentState colorBlendAttachment{};
+    colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+    ConfigureBlend(state.blendMode, colorBlendAttachment);
+
+    VkPipelineColorBlendStateCreateInfo colorBlending{};
+    colorBlending.sType           = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    colorBlending.logicOpEnable   = VK_FALSE;
+    colorBlending.attachmentCount = hasColorAttachment ? 1U : 0U;
+    colorBlending.pAttachments    = hasColorAttachment ? &colorBlendAttachment : nullptr;
+
+    const std::array<VkDynamicState, 2> dynamicStates = {
+        VK_DYNAMIC_STATE_VIEWPORT,
+        VK_DYNAMIC_STATE_SCISSOR,
+    };
+
+    VkPipelineDynamicStateCreateInfo dynamicState{};
+    dynamicState.sType             = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+    dynamicState.dynamicStateCount = static_cast<U32>(dynamicStates.size());
+    dynamicState.pDynamicStates    = dynamicStates.data();
+
+    VkGraphicsPipelineCreateInfo pipelineInfo{};
+    pipelineInfo.sType               = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipelineInfo.stageCount          = static_cast<U32>(shaderStages.size());
+    pipelineInfo.pStages             = shaderStages.data();
+    pipelineInfo.pVertexInputState   = &vertexInputInfo;
+    pipelineInfo.pInputAssemblyState = &inputAssembly;
+    pipelineInfo.pViewportState      = &viewportState;
+    pipelineInfo.pRasterizationState = &rasterizer;
+    pipelineInfo.pMultisampleState   = &multisampling;
+    pipelineInfo.pDepthStencilState  = &depthStencil;
+    pipelineInfo.pColorBlendState    = &colorBlending;
+    pipelineInfo.pDynamicState       = &dynamicState;
+    pipelineInfo.layout              = m_pipelineLayout;
+    pipelineInfo.renderPass          = renderPass;
+    pipelineInfo.subpass             = 0;
+
+    VkPipeline     pipeline       = VK_NULL_HANDLE;
+    const VkResult pipelineResult = vkCreateGraphicsPipelines(
+        m_owner->GetVkDevice(),
+        VK_NULL_HANDLE,
+        1,
+        &pipelineInfo,
+        nullptr,
+        &pipeline);
+    if (pipelineResult != VK_SUCCESS) {
+        JzRE_LOG_ERROR("JzVulkanPipeline: vkCreateGraphicsPipelines failed with {}", static_cast<I32>(pipelineResult));
+        return VK_NULL_HANDLE;
+    }
+
+    return pipeline;
+}
+
 void JzVulkanPipeline::DestroyDescriptorResources()
 {
     m_samplerBindings.clear();
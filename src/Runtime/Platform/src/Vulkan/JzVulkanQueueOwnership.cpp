@@ -0,0 +1,57 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Platform/Vulkan/JzVulkanQueueOwnership.h"
+
+namespace JzRE {
+
+std::optional<U32> FindDedicatedTransferQueueFamily(const std::vector<VkQueueFamilyProperties> &queueFamilies)
+{
+    std::optional<U32> computeFamily;
+    for (U32 i = 0; i < static_cast<U32>(queueFamilies.size()); ++i) {
+        const VkQueueFlags flags = queueFamilies[i].queueFlags;
+        if ((flags & VK_QUEUE_GRAPHICS_BIT) != 0 || queueFamilies[i].queueCount == 0) {
+            continue;
+        }
+        if ((flags & VK_QUEUE_COMPUTE_BIT) == 0 && (flags & VK_QUEUE_TRANSFER_BIT) != 0) {
+            return i;
+        }
+        if ((flags & VK_QUEUE_COMPUTE_BIT) != 0 && !computeFamily) {
+            computeFamily = i;
+        }
+    }
+    return computeFamily;
+}
+
+JzVulkanUploadBarriers GetUploadBarriers(const VkImageMemoryBarrier &toTransfer, Bool initialUpload,
+                                         U32 transferQueueFamily, U32 graphicsQueueFamily)
+{
+    JzVulkanUploadBarriers barriers;
+    barriers.onTransferQueue = initialUpload && transferQueueFamily != graphicsQueueFamily;
+
+    VkImageMemoryBarrier toShaderRead = toTransfer;
+    toShaderRead.oldLayout            = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    toShaderRead.newLayout            = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    toShaderRead.srcAccessMask        = VK_ACCESS_TRANSFER_WRITE_BIT;
+    toShaderRead.dstAccessMask        = VK_ACCESS_SHADER_READ_BIT;
+    toShaderRead.srcQueueFamilyIndex  = VK_QUEUE_FAMILY_IGNORED;
+    toShaderRead.dstQueueFamilyIndex  = VK_QUEUE_FAMILY_IGNORED;
+
+    if (barriers.onTransferQueue) {
+        // Release on the transfer queue, acquire with the same barrier on the graphics queue
+        toShaderRead.srcQueueFamilyIndex = transferQueueFamily;
+        toShaderRead.dstQueueFamilyIndex = graphicsQueueFamily;
+
+        barriers.release               = toShaderRead;
+        barriers.release.dstAccessMask = 0;
+
+        toShaderRead.srcAccessMask = 0;
+    }
+
+    barriers.acquire = toShaderRead;
+    return barriers;
+}
+
+} // namespace JzRE
@@ -10,6 +10,7 @@
 
 #include "JzRE/Runtime/Core/JzLogger.h"
 #include "JzRE/Runtime/Platform/Vulkan/JzVulkanDevice.h"
+#include "JzRE/Runtime/Platform/Vulkan/JzVulkanQueueOwnership.h"
 
 namespace JzRE {
 
@@ -43,7 +44,8 @@ U32 GetPixelSize(JzETextureResourceFormat format)
 
 JzVulkanTexture::JzVulkanTexture(JzVulkanDevice &device, const JzGPUTextureObjectDesc &desc) :
     JzGPUTextureObject(desc),
-    m_owner(&device)
+    m_owner(&device),
+    m_deviceAlive(device.GetLifetimeFlag())
 {
     if (!m_owner || m_owner->GetVkDevice() == VK_NULL_HANDLE) {
         return;
@@ -71,7 +73,8 @@ JzVulkanTexture::JzVulkanTexture(JzVulkanDevice &device, const JzGPUTextureObjec
                       VK_IMAGE_USAGE_SAMPLED_BIT;
     if (depthFormat) {
         imageInfo.usage |= VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
-    } else {
+    } else if (!IsCompressedTextureFormat(desc.format)) {
+        // Block-compressed images cannot be rendered to
         imageInfo.usage |= VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
     }
 
@@ -80,6 +83,9 @@ JzVulkanTexture::JzVulkanTexture(JzVulkanDevice &device, const JzGPUTextureObjec
         imageInfo.arrayLayers = std::max<U32>(6, imageInfo.arrayLayers);
     }
 
+    m_levelCount = imageInfo.mipLevels;
+    m_layerCount = imageInfo.arrayLayers;
+
     const VkResult imageResult = vkCreateImage(m_owner->GetVkDevice(), &imageInfo, nullptr, &m_image);
     if (imageResult != VK_SUCCESS) {
         JzRE_LOG_ERROR("JzVulkanTexture: vkCreateImage failed ({})", static_cast<I32>(imageResult));
@@ -153,91 +159,110 @@ JzVulkanTexture::JzVulkanTexture(JzVulkanDevice &device, const JzGPUTextureObjec
 
     m_layout = VK_IMAGE_LAYOUT_UNDEFINED;
 
-    const VkImageLayout     initialLayout = depthFormat
-                                                ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
-                                                : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-    const VkImageAspectFlags aspectMask   = GetImageAspectMask(desc.format);
-    m_owner->ExecuteImmediate([this, initialLayout, aspectMask](VkCommandBuffer commandBuffer) {
-        VkImageMemoryBarrier barrier{};
-        barrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-        barrier.oldLayout           = VK_IMAGE_LAYOUT_UNDEFINED;
-        barrier.newLayout           = initialLayout;
-        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier.image               = m_image;
-        barrier.subresourceRange.aspectMask     = aspectMask;
-        barrier.subresourceRange.baseMipLevel   = 0;
-        barrier.subresourceRange.levelCount     = 1;
-        barrier.subresourceRange.baseArrayLayer = 0;
-        barrier.subresourceRange.layerCount     = 1;
-        barrier.srcAccessMask                   = 0;
-        barrier.dstAccessMask                   = (initialLayout == VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL)
-                                                      ? VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT
-                                                      : VK_ACCESS_SHADER_READ_BIT;
-
-        vkCmdPipelineBarrier(
-            commandBuffer,
-            VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-            VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-            0,
-            0,
-            nullptr,
-            0,
-            nullptr,
-            1,
-            &barrier);
-    });
-    m_layout = initialLayout;
+    const Bool uploadable = !depthFormat && (IsCompressedTextureFormat(desc.format) || GetPixelSize(desc.format) != 0);
+    if (uploadable && !desc.mipData.empty()) {
+        const Size levels = std::min<Size>(desc.mipData.size(), imageInfo.mipLevels);
+        UploadLevels(std::vector<JzGPUTextureMipData>(desc.mipData.begin(), desc.mipData.begin() + levels), 0, 0, true);
+    } else if (uploadable && desc.data != nullptr) {
+        JzGPUTextureMipData level;
+        level.data = desc.data;
+        level.size = GetTextureLevelSize(desc.format, desc.width, desc.height, 0);
+        UploadLevels({level}, 0, 0, true);
+        if (imageInfo.mipLevels > 1) {
+            GenerateMipmaps();
+        }
+    }
 
-    if (desc.data != nullptr) {
-        UpdateData(desc.data, 0, 0);
+    if (m_layout == VK_IMAGE_LAYOUT_UNDEFINED) {
+        RecordInitialLayout(depthFormat ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
+                                        : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
     }
 }
 
 JzVulkanTexture::~JzVulkanTexture()
 {
-    if (!m_owner || m_owner->GetVkDevice() == VK_NULL_HANDLE) {
+    // Without the device every Vulkan object is already gone
+    if (!m_owner || !m_deviceAlive || !m_deviceAlive->load(std::memory_order_acquire)) {
         return;
     }
 
-    if (m_sampler != VK_NULL_HANDLE) {
-        vkDestroySampler(m_owner->GetVkDevice(), m_sampler, nullptr);
-        m_sampler = VK_NULL_HANDLE;
-    }
+    // Upload batches and frames in flight may still reference the image
+    m_owner->RetireImage(m_image, m_memory, m_imageView, m_sampler);
+    m_image     = VK_NULL_HANDLE;
+    m_memory    = VK_NULL_HANDLE;
+    m_imageView = VK_NULL_HANDLE;
+    m_sampler   = VK_NULL_HANDLE;
+}
 
-    if (m_imageView != VK_NULL_HANDLE) {
-        vkDestroyImageView(m_owner->GetVkDevice(), m_imageView, nullptr);
-        m_imageView = VK_NULL_HANDLE;
+void JzVulkanTexture::UpdateData(const void *data, U32 mipLevel, U32 arrayIndex)
+{
+    if (!data || mipLevel >= std::max<U32>(1, desc.mipLevels)) {
+        return;
     }
 
-    if (m_memory != VK_NULL_HANDLE) {
-        vkFreeMemory(m_owner->GetVkDevice(), m_memory, nullptr);
-        m_memory = VK_NULL_HANDLE;
+    JzGPUTextureMipData level;
+    level.data = data;
+    level.size = GetTextureLevelSize(desc.format, desc.width, desc.height, mipLevel);
+    UploadLevels({level}, mipLevel, arrayIndex);
+}
+
+void JzVulkanTexture::RecordInitialLayout(VkImageLayout layout)
+{
+    if (!m_owner || m_image == VK_NULL_HANDLE) {
+        return;
     }
 
-    if (m_image != VK_NULL_HANDLE) {
-        vkDestroyImage(m_owner->GetVkDevice(), m_image, nullptr);
-        m_image = VK_NULL_HANDLE;
+    const VkCommandBuffer commandBuffer = m_owner->GetUploadGraphicsCommands();
+    if (commandBuffer == VK_NULL_HANDLE) {
+        return;
     }
+
+    VkImageMemoryBarrier barrier{};
+    barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.oldLayout                       = VK_IMAGE_LAYOUT_UNDEFINED;
+    barrier.newLayout                       = layout;
+    barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image                           = m_image;
+    barrier.subresourceRange.aspectMask     = GetImageAspectMask(desc.format);
+    barrier.subresourceRange.baseMipLevel   = 0;
+    barrier.subresourceRange.levelCount     = m_levelCount;
+    barrier.subresourceRange.baseArrayLayer = 0;
+    barrier.subresourceRange.layerCount     = m_layerCount;
+    barrier.srcAccessMask                   = 0;
+    barrier.dstAccessMask                   = (layout == VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL)
+                                                  ? VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT
+                                                  : VK_ACCESS_SHADER_READ_BIT;
+
+    vkCmdPipelineBarrier(
+        commandBuffer,
+        VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        0,
+        0,
+        nullptr,
+        0,
+        nullptr,
+        1,
+        &barrier);
+
+    m_layout = layout;
 }
 
-void JzVulkanTexture::UpdateData(const void *data, U32 mipLevel, U32 arrayIndex)
+void JzVulkanTexture::UploadLevels(const std::vector<JzGPUTextureMipData> &levels, U32 firstMip, U32 arrayIndex,
+                                   Bool initialUpload)
 {
-    (void)mipLevel;
-    (void)arrayIndex;
-
-    if (!data || !m_owner || m_owner->GetVkDevice() == VK_NULL_HANDLE || m_image == VK_NULL_HANDLE) {
+    if (levels.empty() || !m_owner || m_owner->GetVkDevice() == VK_NULL_HANDLE || m_image == VK_NULL_HANDLE) {
         return;
     }
 
-    const U32 pixelSize = GetPixelSize(desc.format);
-    if (pixelSize == 0 || IsDepthFormat(desc.format)) {
+    if (IsDepthFormat(desc.format) || (!IsCompressedTextureFormat(desc.format) && GetPixelSize(desc.format) == 0)) {
         return;
     }
 
-    const VkDeviceSize uploadSize = static_cast<VkDeviceSize>(desc.width) *
-                                    static_cast<VkDeviceSize>(desc.height) *
-                                    static_cast<VkDeviceSize>(pixelSize);
+    std::vector<JzGPUTextureUploadRegion> uploadRegions;
+    const VkDeviceSize                    uploadSize = static_cast<VkDeviceSize>(
+        GetTextureUploadRegions(desc.format, desc.width, desc.height, firstMip, levels, uploadRegions));
     if (uploadSize == 0) {
         return;
     }
@@ -278,85 +303,243 @@ void JzVulkanTexture::UpdateData(const void *data, U32 mipLevel, U32 arrayIndex)
 
     void *mapped = nullptr;
     if (vkMapMemory(m_owner->GetVkDevice(), stagingMemory, 0, uploadSize, 0, &mapped) == VK_SUCCESS) {
-        std::memcpy(mapped, data, static_cast<Size>(uploadSize));
+        for (Size i = 0; i < levels.size(); ++i) {
+            if (levels[i].data != nullptr) {
+                std::memcpy(static_cast<U8 *>(mapped) + uploadRegions[i].offset, levels[i].data, levels[i].size);
+            }
+        }
         vkUnmapMemory(m_owner->GetVkDevice(), stagingMemory);
     }
 
-    m_owner->ExecuteImmediate([this, stagingBuffer](VkCommandBuffer commandBuffer) {
-        VkImageMemoryBarrier toTransfer{};
-        toTransfer.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-        toTransfer.oldLayout           = m_layout;
-        toTransfer.newLayout           = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-        toTransfer.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        toTransfer.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        toTransfer.image               = m_image;
-        toTransfer.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
-        toTransfer.subresourceRange.baseMipLevel   = 0;
-        toTransfer.subresourceRange.levelCount     = 1;
-        toTransfer.subresourceRange.baseArrayLayer = 0;
-        toTransfer.subresourceRange.layerCount     = 1;
-        toTransfer.srcAccessMask                   = 0;
-        toTransfer.dstAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+    std::vector<VkBufferImageCopy> regions;
+    regions.reserve(uploadRegions.size());
+    for (const auto &uploadRegion : uploadRegions) {
+        VkBufferImageCopy region{};
+        region.bufferOffset                    = static_cast<VkDeviceSize>(uploadRegion.offset);
+        region.bufferRowLength                 = 0;
+        region.bufferImageHeight               = 0;
+        region.imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.mipLevel       = uploadRegion.mipLevel;
+        region.imageSubresource.baseArrayLayer = arrayIndex;
+        region.imageSubresource.layerCount     = 1;
+        region.imageOffset                     = {0, 0, 0};
+        region.imageExtent                     = {uploadRegion.width, uploadRegion.height, 1};
+        regions.push_back(region);
+    }
+
+    // A new image moves as a whole, so later uploads and blits never see it undefined
+    VkImageMemoryBarrier toTransfer{};
+    toTransfer.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    toTransfer.oldLayout                       = initialUpload ? VK_IMAGE_LAYOUT_UNDEFINED : m_layout;
+    toTransfer.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    toTransfer.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    toTransfer.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    toTransfer.image                           = m_image;
+    toTransfer.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+    toTransfer.subresourceRange.baseMipLevel   = initialUpload ? 0 : firstMip;
+    toTransfer.subresourceRange.levelCount     = initialUpload ? m_levelCount : static_cast<U32>(regions.size());
+    toTransfer.subresourceRange.baseArrayLayer = initialUpload ? 0 : arrayIndex;
+    toTransfer.subresourceRange.layerCount     = initialUpload ? m_layerCount : 1;
+    toTransfer.srcAccessMask                   = initialUpload ? 0 : VK_ACCESS_MEMORY_WRITE_BIT;
+    toTransfer.dstAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+    const auto barriers = GetUploadBarriers(toTransfer, initialUpload, m_owner->GetTransferQueueFamilyIndex(),
+                                            m_owner->GetGraphicsQueueFamilyIndex());
+
+    const VkCommandBuffer graphicsCommands = m_owner->GetUploadGraphicsCommands();
+    const VkCommandBuffer copyCommands =
+        barriers.onTransferQueue ? m_owner->GetUploadTransferCommands() : graphicsCommands;
+    if (graphicsCommands == VK_NULL_HANDLE || copyCommands == VK_NULL_HANDLE) {
+        vkFreeMemory(m_owner->GetVkDevice(), stagingMemory, nullptr);
+        vkDestroyBuffer(m_owner->GetVkDevice(), stagingBuffer, nullptr);
+        return;
+    }
 
+    vkCmdPipelineBarrier(
+        copyCommands,
+        initialUpload ? VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT : VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        0,
+        0,
+        nullptr,
+        0,
+        nullptr,
+        1,
+        &toTransfer);
+
+    vkCmdCopyBufferToImage(
+        copyCommands,
+        stagingBuffer,
+        m_image,
+        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        static_cast<U32>(regions.size()),
+        regions.data());
+
+    if (barriers.onTransferQueue) {
         vkCmdPipelineBarrier(
-            commandBuffer,
-            VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+            copyCommands,
             VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
             0,
             0,
             nullptr,
             0,
             nullptr,
             1,
-            &toTransfer);
+            &barriers.release);
+    }
 
-        VkBufferImageCopy region{};
-        region.bufferOffset                    = 0;
-        region.bufferRowLength                 = 0;
-        region.bufferImageHeight               = 0;
-        region.imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
-        region.imageSubresource.mipLevel       = 0;
-        region.imageSubresource.baseArrayLayer = 0;
-        region.imageSubresource.layerCount     = 1;
-        region.imageOffset                     = {0, 0, 0};
-        region.imageExtent                     = {std::max<U32>(1, desc.width), std::max<U32>(1, desc.height), 1};
+    vkCmdPipelineBarrier(
+        graphicsCommands,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+        0,
+        0,
+        nullptr,
+        0,
+        nullptr,
+        1,
+        &barriers.acquire);
+
+    m_layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+    m_owner->RetireStagingBuffer(stagingBuffer, stagingMemory);
+}
+
+void JzVulkanTexture::GenerateMipmaps()
+{
+    if (m_levelCount < 2 || !m_owner || m_image == VK_NULL_HANDLE || m_layout == VK_IMAGE_LAYOUT_UNDEFINED) {
+        return;
+    }
+    if (IsDepthFormat(desc.format) || IsCompressedTextureFormat(desc.format)) {
+        return;
+    }
 
-        vkCmdCopyBufferToImage(
+    VkFormatProperties formatProperties{};
+    vkGetPhysicalDeviceFormatProperties(m_owner->GetVkPhysicalDevice(), m_format, &formatProperties);
+    constexpr VkFormatFeatureFlags kBlitFeatures = VK_FORMAT_FEATURE_BLIT_SRC_BIT |
+                                                   VK_FORMAT_FEATURE_BLIT_DST_BIT |
+                                                   VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+    if ((formatProperties.optimalTilingFeatures & kBlitFeatures) != kBlitFeatures) {
+        JzRE_LOG_WARN("JzVulkanTexture: format {} cannot be blitted with linear filtering, mipmaps not generated",
+                      static_cast<I32>(m_format));
+        return;
+    }
+
+    // Blits need a graphics queue, so the chain is built in the graphics upload commands
+    const VkCommandBuffer commandBuffer = m_owner->GetUploadGraphicsCommands();
+    if (commandBuffer == VK_NULL_HANDLE) {
+        return;
+    }
+
+    VkImageMemoryBarrier barriers[2]{};
+    for (auto &barrier : barriers) {
+        barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image                           = m_image;
+        barrier.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.levelCount     = 1;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount     = m_layerCount;
+    }
+
+    // Level 0 becomes the first source, the rest are overwritten
+    barriers[0].oldLayout                     = m_layout;
+    barriers[0].newLayout                     = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    barriers[0].srcAccessMask                 = VK_ACCESS_MEMORY_WRITE_BIT;
+    barriers[0].dstAccessMask                 = VK_ACCESS_TRANSFER_READ_BIT;
+    barriers[0].subresourceRange.baseMipLevel = 0;
+    barriers[1].oldLayout                     = VK_IMAGE_LAYOUT_UNDEFINED;
+    barriers[1].newLayout                     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barriers[1].srcAccessMask                 = 0;
+    barriers[1].dstAccessMask                 = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barriers[1].subresourceRange.baseMipLevel = 1;
+    barriers[1].subresourceRange.levelCount   = m_levelCount - 1;
+
+    vkCmdPipelineBarrier(
+        commandBuffer,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        0,
+        0,
+        nullptr,
+        0,
+        nullptr,
+        2,
+        barriers);
+
+    for (U32 level = 1; level < m_levelCount; ++level) {
+        const I32 srcWidth  = static_cast<I32>(GetTextureLevelExtent(desc.width, level - 1));
+        const I32 srcHeight = static_cast<I32>(GetTextureLevelExtent(desc.height, level - 1));
+        const I32 dstWidth  = static_cast<I32>(GetTextureLevelExtent(desc.width, level));
+        const I32 dstHeight = static_cast<I32>(GetTextureLevelExtent(desc.height, level));
+
+        VkImageBlit blit{};
+        blit.srcSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        blit.srcSubresource.mipLevel       = level - 1;
+        blit.srcSubresource.baseArrayLayer = 0;
+        blit.srcSubresource.layerCount     = m_layerCount;
+        blit.srcOffsets[1]                 = {srcWidth, srcHeight, 1};
+        blit.dstSubresource                = blit.srcSubresource;
+        blit.dstSubresource.mipLevel       = level;
+        blit.dstOffsets[1]                 = {dstWidth, dstHeight, 1};
+
+        vkCmdBlitImage(
             commandBuffer,
-            stagingBuffer,
+            m_image,
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
             m_image,
             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
             1,
-            &region);
-
-        VkImageMemoryBarrier toShaderRead = toTransfer;
-        toShaderRead.oldLayout            = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-        toShaderRead.newLayout            = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        toShaderRead.srcAccessMask        = VK_ACCESS_TRANSFER_WRITE_BIT;
-        toShaderRead.dstAccessMask        = VK_ACCESS_SHADER_READ_BIT;
+            &blit,
+            VK_FILTER_LINEAR);
+
+        // The finished source is sampled from now on; the new level feeds the next blit
+        barriers[0].oldLayout                     = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        barriers[0].newLayout                     = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        barriers[0].srcAccessMask                 = VK_ACCESS_TRANSFER_READ_BIT;
+        barriers[0].dstAccessMask                 = VK_ACCESS_SHADER_READ_BIT;
+        barriers[0].subresourceRange.baseMipLevel = level - 1;
+        barriers[1].oldLayout                     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barriers[1].newLayout                     = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        barriers[1].srcAccessMask                 = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barriers[1].dstAccessMask                 = VK_ACCESS_TRANSFER_READ_BIT;
+        barriers[1].subresourceRange.baseMipLevel = level;
+        barriers[1].subresourceRange.levelCount   = 1;
 
         vkCmdPipelineBarrier(
             commandBuffer,
             VK_PIPELINE_STAGE_TRANSFER_BIT,
-            VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+            VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
             0,
             0,
             nullptr,
             0,
             nullptr,
-            1,
-            &toShaderRead);
-    });
-
-    m_layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            2,
+            barriers);
+    }
 
-    vkFreeMemory(m_owner->GetVkDevice(), stagingMemory, nullptr);
-    vkDestroyBuffer(m_owner->GetVkDevice(), stagingBuffer, nullptr);
-}
+    barriers[0].oldLayout                     = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    barriers[0].newLayout                     = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    barriers[0].srcAccessMask                 = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barriers[0].dstAccessMask                 = VK_ACCESS_SHADER_READ_BIT;
+    barriers[0].subresourceRange.baseMipLevel = m_levelCount - 1;
+
+    vkCmdPipelineBarrier(
+        commandBuffer,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+        0,
+        0,
+        nullptr,
+        0,
+        nullptr,
+        1,
+        barriers);
 
-void JzVulkanTexture::GenerateMipmaps()
-{
-    // TODO: Full mipmap generation path is not required for the initial Vulkan integration.
+    m_layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 }
 
 void *JzVulkanTexture::GetTextureID() const
@@ -400,6 +583,22 @@ VkFormat JzVulkanTexture::ConvertTextureFormat(JzETextureResourceFormat format)
             return VK_FORMAT_D32_SFLOAT;
         case JzETextureResourceFormat::Depth24Stencil8:
             return VK_FORMAT_D24_UNORM_S8_UINT;
+        case JzETextureResourceFormat::BC1:
+            return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+        case JzETextureResourceFormat::BC3:
+            return VK_FORMAT_BC3_UNORM_BLOCK;
+        case JzETextureResourceFormat::BC4:
+            return VK_FORMAT_BC4_UNORM_BLOCK;
+        case JzETextureResourceFormat::BC5:
+            return VK_FORMAT_BC5_UNORM_BLOCK;
+        case JzETextureResourceFormat::BC7:
+            return VK_FORMAT_BC7_UNORM_BLOCK;
+        case JzETextureResourceFormat::ETC2RGB8:
+            return VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK;
+        case JzETextureResourceFormat::ETC2RGBA8:
+            return VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK;
+        case JzETextureResourceFormat::ASTC4x4:
+            return VK_FORMAT_ASTC_4x4_UNORM_BLOCK;
         case JzETextureResourceFormat::Unknown:
             break;
     }
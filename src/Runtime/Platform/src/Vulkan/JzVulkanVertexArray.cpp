@@ -53,4 +53,16 @@ void JzVulkanVertexArray::SetVertexAttribute(U32 index, U32 size, U32 stride, U3
     iter->offset = offset;
 }
 
+void JzVulkanVertexArray::SetVertexAttributeDivisor(U32 index, U32 divisor)
+{
+    // Input rate is baked into the pipeline from the shader vertex layout,
+    // the divisor is only kept as metadata.
+    for (auto &attribute : m_attributes) {
+        if (attribute.index == index) {
+            attribute.divisor = divisor;
+            return;
+        }
+    }
+}
+
 } // namespace JzRE
@@ -72,6 +72,11 @@ struct JzAssetLoadResult {
     String          errorMessage;
 };
 
+/**
+ * @brief Listener for finished async loads, called on the main thread
+ */
+using JzAssetLoadResultListener = std::function<void(const JzAssetLoadResult &)>;
+
 /**
  * @brief Modern asset manager with ECS-friendly design
  *
@@ -256,6 +261,14 @@ public:
      */
     void Update();
 
+    /**
+     * @brief Set a listener notified in Update() for every finished async load
+     *
+     * Lets ECS systems wake entities waiting on an asset instead of polling
+     * its load state every frame.
+     */
+    void SetLoadResultListener(JzAssetLoadResultListener listener);
+
     /**
      * @brief Evict assets to reach target memory
      *
@@ -397,6 +410,7 @@ private:
     // Callbacks
     std::unordered_map<JzAssetId, PendingCallback, JzAssetId::Hash> m_callbacks;
     std::mutex                                                      m_callbackMutex;
+    JzAssetLoadResultListener                                       m_loadResultListener;
 
     // LRU cache manager
     std::unique_ptr<JzLRUCacheManager> m_lruCache;
@@ -7,6 +7,7 @@
 
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <shared_mutex>
 #include <unordered_map>
@@ -0,0 +1,61 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+#include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Platform/RHI/JzGPUTextureObject.h"
+
+namespace JzRE {
+
+/**
+ * @brief 2D image with a mip chain, as stored in a KTX2 container.
+ */
+struct JzKtx2Image {
+    JzETextureResourceFormat     format = JzETextureResourceFormat::Unknown;
+    U32                          width  = 0;
+    U32                          height = 0;
+    std::vector<std::vector<U8>> levels; ///< Level 0 (largest) first
+};
+
+/**
+ * @brief Reader and writer of Khronos KTX2 texture containers.
+ *
+ * Covers single-layer 2D images without supercompression in the R8, RG8,
+ * RGBA8, BC1/3/4/5/7, ETC2 and ASTC 4x4 formats. sRGB variants are read as
+ * their UNORM counterparts, which matches how source images are loaded.
+ */
+class JzKtx2 {
+public:
+    /**
+     * @brief Serialize an image.
+     *
+     * @return std::vector<U8> File contents, empty if the format cannot be stored or a level has the wrong size.
+     */
+    static std::vector<U8> Encode(const JzKtx2Image &image);
+
+    /**
+     * @brief Parse file contents.
+     *
+     * @return std::optional<JzKtx2Image> The image, or nullopt if the data is malformed or unsupported.
+     */
+    static std::optional<JzKtx2Image> Decode(const U8 *data, Size size);
+
+    /**
+     * @brief Encode an image and write it to disk.
+     */
+    static Bool Save(const std::filesystem::path &path, const JzKtx2Image &image);
+
+    /**
+     * @brief Read and decode a file.
+     */
+    static std::optional<JzKtx2Image> Load(const std::filesystem::path &path);
+};
+
+} // namespace JzRE
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 #include "JzRE/Runtime/Resource/JzResource.h"
 #include "JzRE/Runtime/Core/JzVertex.h"
@@ -14,6 +15,24 @@
 namespace JzRE {
 
 class JzDevice; // Forward declaration
+class JzMesh;
+
+/**
+ * @brief Settings controlling LOD chain generation.
+ */
+struct JzMeshLODSettings {
+    U32 maxLevels        = 4;    ///< Maximum number of simplified levels (excluding LOD0)
+    F32 reductionRatio   = 0.5f; ///< Target index ratio between consecutive levels
+    U32 minTriangleCount = 64;   ///< Stop generating levels below this triangle count
+};
+
+/**
+ * @brief One simplified level of a mesh LOD chain.
+ */
+struct JzMeshLOD {
+    std::shared_ptr<JzMesh> mesh;         ///< Simplified mesh with compacted vertices
+    F32                     error = 0.0f; ///< Object-space geometric error relative to LOD0
+};
 
 /**
  * @brief Represents a mesh asset, containing vertex and index data.
@@ -74,6 +93,26 @@ public:
         return static_cast<U32>(m_indices.size());
     }
 
+    /**
+     * @brief Get the CPU-side vertices.
+     *
+     * @return const std::vector<JzVertex>&
+     */
+    const std::vector<JzVertex> &GetVertices() const
+    {
+        return m_vertices;
+    }
+
+    /**
+     * @brief Get the CPU-side indices.
+     *
+     * @return const std::vector<U32>&
+     */
+    const std::vector<U32> &GetIndices() const
+    {
+        return m_indices;
+    }
+
     /**
      * @brief Get the material index for this mesh.
      *
@@ -94,18 +133,71 @@ public:
         m_materialIndex = index;
     }
 
+    /**
+     * @brief Generate simplified LOD levels from the CPU-side data.
+     *
+     * Must be called before Load(), while vertex data is still available.
+     * Each level is simplified from LOD0 so that errors do not accumulate,
+     * and generation stops early once a level no longer reduces the mesh.
+     *
+     * @param settings LOD generation settings.
+     *
+     * @return U32 Number of generated levels (excluding LOD0).
+     */
+    U32 GenerateLODChain(const JzMeshLODSettings &settings = {});
+
+    /**
+     * @brief Get the simplified levels, ordered from finest to coarsest.
+     *
+     * @return const std::vector<JzMeshLOD>&
+     */
+    const std::vector<JzMeshLOD> &GetLODs() const
+    {
+        return m_lods;
+    }
+
+    /**
+     * @brief Get the object-space bounding sphere center.
+     *
+     * @return const JzVec3&
+     */
+    const JzVec3 &GetBoundsCenter() const
+    {
+        return m_boundsCenter;
+    }
+
+    /**
+     * @brief Get the object-space bounding sphere radius.
+     *
+     * @return F32
+     */
+    F32 GetBoundsRadius() const
+    {
+        return m_boundsRadius;
+    }
+
 private:
     /**
      * @brief Creates RHI resources (buffers and vertex array) for the mesh.
      */
     void SetupMesh();
 
+    /**
+     * @brief Computes the bounding sphere from the CPU-side vertices.
+     */
+    void ComputeBounds();
+
 private:
     // CPU-side data
     std::vector<JzVertex> m_vertices;
     std::vector<U32>      m_indices;
     I32                   m_materialIndex = -1;
 
+    // Level of detail
+    std::vector<JzMeshLOD> m_lods;
+    JzVec3                 m_boundsCenter{0.0f, 0.0f, 0.0f};
+    F32                    m_boundsRadius = 0.0f;
+
     // GPU-side RHI resources
     std::shared_ptr<JzGPUBufferObject>      m_vertexBuffer;
     std::shared_ptr<JzGPUBufferObject>      m_indexBuffer;
@@ -0,0 +1,62 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <limits>
+#include <vector>
+#include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Core/JzVertex.h"
+
+namespace JzRE {
+
+/**
+ * @brief Result of a mesh simplification run.
+ */
+struct JzMeshSimplifyResult {
+    std::vector<U32> indices;     ///< Simplified triangle list (indices into the source vertices)
+    F32              error = 0.0f; ///< Approximate geometric error in object-space units
+};
+
+/**
+ * @brief Quadric error metric edge-collapse mesh simplifier.
+ *
+ * Implements Garland-Heckbert simplification with half-edge collapses, so that
+ * every surviving vertex keeps its original attributes and no vertex data has to
+ * be interpolated. Vertices are welded by position before simplification, which
+ * lets meshes imported with per-corner vertices (e.g. OBJ) simplify as a whole.
+ * Positions on texture seams are locked and open borders are protected by
+ * boundary-plane quadrics to avoid visible cracks.
+ */
+class JzMeshSimplifier {
+public:
+    /**
+     * @brief Simplify a triangle list.
+     *
+     * @param vertices Source vertices.
+     * @param indices Source triangle list.
+     * @param targetIndexCount Desired index count of the simplified mesh.
+     * @param maxError Upper bound of the geometric error allowed for a collapse.
+     *
+     * @return JzMeshSimplifyResult Simplified indices referencing the source vertices and the reached error.
+     */
+    static JzMeshSimplifyResult Simplify(const std::vector<JzVertex> &vertices,
+                                         const std::vector<U32>      &indices,
+                                         Size                         targetIndexCount,
+                                         F32                          maxError = std::numeric_limits<F32>::max());
+
+    /**
+     * @brief Drop vertices that are not referenced by an index list.
+     *
+     * @param vertices Source vertices.
+     * @param indices Index list, rewritten in place to reference the compacted vertices.
+     *
+     * @return std::vector<JzVertex> Compacted vertex list.
+     */
+    static std::vector<JzVertex> CompactVertices(const std::vector<JzVertex> &vertices,
+                                                 std::vector<U32>            &indices);
+};
+
+} // namespace JzRE
@@ -101,9 +101,18 @@ public:
 
     /**
      * @brief Get or build pipeline variant by keyword bitmask.
+     *
+     * Never waits for the backend compiler: while a newly requested variant
+     * is still compiling, or after it failed to compile, this returns nullptr
+     * and callers should fall back to GetMainVariant().
      */
     std::shared_ptr<JzRHIPipeline> GetVariant(U64 keywordMask);
 
+    /**
+     * @brief Whether a variant was requested and is still compiling.
+     */
+    Bool IsVariantPending(U64 keywordMask) const;
+
     /**
      * @brief Compatibility overload from defines map to keyword bitmask.
      */
@@ -213,6 +222,7 @@ private:
 private:
     String m_manifestPath;
     String m_blobPath;
+    String m_sourceHash;
 
     std::vector<String> m_dependentFiles;
 
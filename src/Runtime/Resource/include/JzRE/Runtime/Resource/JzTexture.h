@@ -5,8 +5,10 @@
 
 #pragma once
 
+#include <filesystem>
 #include <memory>
 #include "JzRE/Runtime/Resource/JzResource.h"
+#include "JzRE/Runtime/Platform/RHI/JzDevice.h"
 #include "JzRE/Runtime/Platform/RHI/JzGPUTextureObject.h"
 
 namespace JzRE {
@@ -38,6 +40,11 @@ public:
     /**
      * @brief Loads the image from file and creates a GPU texture.
      *
+     * The image's cooked KTX2 file under the cooked root (see SetCookedRoot())
+     * is preferred while it is newer than the image and the device supports
+     * its format; its mips are uploaded as stored. The path may also name a
+     * KTX2 file.
+     *
      * @return Bool True if successful.
      */
     virtual Bool Load() override;
@@ -57,6 +64,26 @@ public:
         return m_rhiTexture;
     }
 
+    /**
+     * @brief Path of the KTX2 file that `JzRE build` cooks for a source image.
+     *
+     * The cooked file mirrors the source's place under contentRoot inside
+     * cookedRoot (`<cookedRoot>/<relative>.<ext>.ktx2`).
+     *
+     * @return Empty path if the source is not under contentRoot.
+     */
+    static std::filesystem::path GetCookedPath(const std::filesystem::path &source,
+                                               const std::filesystem::path &contentRoot,
+                                               const std::filesystem::path &cookedRoot);
+
+    /**
+     * @brief Set the roots Load() resolves cooked files from. Empty disables lookup.
+     */
+    static void SetCookedRoot(const std::filesystem::path &contentRoot, const std::filesystem::path &cookedRoot);
+
+private:
+    Bool LoadCooked(JzDevice &device);
+
 private:
     String                              m_path;
     std::shared_ptr<JzGPUTextureObject> m_rhiTexture;
@@ -0,0 +1,72 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <vector>
+
+#include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Platform/RHI/JzGPUTextureObject.h"
+#include "JzRE/Runtime/Resource/JzKtx2.h"
+
+namespace JzRE {
+
+/**
+ * @brief Offline texture cooker: mip chain generation and block compression.
+ *
+ * Encodes RGBA8 images into BC1, BC3, BC4, BC5 and BC7 (mode 6). Endpoints
+ * start on the principal axis of each 4x4 block and are refined once with a
+ * least-squares fit, which is fast enough for build-time cooking. ETC2 and
+ * ASTC data can be loaded at runtime but are not produced here.
+ */
+class JzTextureCompressor {
+public:
+    /**
+     * @brief Whether Encode() can produce the format.
+     */
+    static Bool CanEncode(JzETextureResourceFormat format);
+
+    /**
+     * @brief Pick BC1 for opaque images and BC7 when any texel is translucent.
+     *
+     * @param rgba Tightly packed RGBA8 texels.
+     */
+    static JzETextureResourceFormat ChooseFormat(const U8 *rgba, U32 width, U32 height);
+
+    /**
+     * @brief Build a box-filtered mip chain down to 1x1.
+     *
+     * @param rgba Tightly packed RGBA8 texels of level 0.
+     *
+     * @return std::vector<std::vector<U8>> RGBA8 levels, level 0 first.
+     */
+    static std::vector<std::vector<U8>> BuildMipChain(const U8 *rgba, U32 width, U32 height);
+
+    /**
+     * @brief Encode one RGBA8 level.
+     *
+     * BC4 reads the red channel and BC5 the red and green channels.
+     *
+     * @return std::vector<U8> Encoded level, empty if the format cannot be encoded.
+     */
+    static std::vector<U8> Encode(const U8 *rgba, U32 width, U32 height, JzETextureResourceFormat format);
+
+    /**
+     * @brief Encode an image and, optionally, its mip chain.
+     *
+     * @param format Target format; Unknown picks one with ChooseFormat().
+     */
+    static JzKtx2Image Cook(const U8 *rgba, U32 width, U32 height, JzETextureResourceFormat format,
+                            Bool generateMips = true);
+
+    /**
+     * @brief Load a PNG/JPG/TGA/BMP file, cook it and write a KTX2 file.
+     */
+    static Bool CookFile(const std::filesystem::path &source, const std::filesystem::path &destination,
+                         JzETextureResourceFormat format, Bool generateMips = true);
+};
+
+} // namespace JzRE
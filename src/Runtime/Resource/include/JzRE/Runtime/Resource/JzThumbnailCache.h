@@ -0,0 +1,155 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#pragma once
+
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "JzRE/Runtime/Core/JzRETypes.h"
+#include "JzRE/Runtime/Core/JzThreadPool.h"
+#include "JzRE/Runtime/Core/JzVector.h"
+
+namespace JzRE {
+
+/**
+ * @brief CPU side thumbnail image
+ */
+struct JzThumbnail {
+    U32             width  = 0;
+    U32             height = 0;
+    std::vector<U8> pixels; ///< Tightly packed RGBA8, first row at the top
+};
+
+/**
+ * @brief A finished thumbnail request
+ */
+struct JzThumbnailResult {
+    std::filesystem::path path;
+    Bool                  succeeded = false;
+    JzThumbnail           thumbnail;
+};
+
+/**
+ * @brief Configuration for the thumbnail cache
+ */
+struct JzThumbnailCacheConfig {
+    std::filesystem::path cacheDirectory;   ///< Where generated thumbnails are stored, empty disables the disk cache
+    U32                   size        = 64; ///< Edge length of the square thumbnails
+    Size                  workerCount = 2;
+};
+
+/**
+ * @brief Generates asset thumbnails on worker threads and caches them on disk
+ *
+ * Textures are decoded and box filtered, models are rasterized with a small
+ * software renderer and materials are drawn as a lit sphere. Results are
+ * stored under the cache directory keyed by a hash of the file content, so a
+ * thumbnail survives renames and restarts and is regenerated only when the
+ * content changes.
+ *
+ * The newest request is served first, which keeps the rows a user is
+ * looking at ahead of rows scrolled past. Results are collected with Poll.
+ */
+class JzThumbnailCache {
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param config Cache configuration
+     */
+    explicit JzThumbnailCache(const JzThumbnailCacheConfig &config);
+
+    /**
+     * @brief Destructor, drops queued requests and waits for the running ones
+     */
+    ~JzThumbnailCache();
+
+    JzThumbnailCache(const JzThumbnailCache &)            = delete;
+    JzThumbnailCache &operator=(const JzThumbnailCache &) = delete;
+
+    /**
+     * @brief Whether thumbnails can be generated for a file
+     */
+    static Bool IsSupported(const std::filesystem::path &path);
+
+    /**
+     * @brief Queue a thumbnail. A path already queued is not queued twice.
+     *
+     * @param path The asset file
+     *
+     * @return Bool False if the file type is not supported
+     */
+    Bool Request(const std::filesystem::path &path);
+
+    /**
+     * @brief Take one finished request.
+     *
+     * @param outResult Receives the result
+     *
+     * @return Bool False if nothing has finished
+     */
+    Bool Poll(JzThumbnailResult &outResult);
+
+    /**
+     * @brief Get the number of requests that have not finished
+     */
+    Size GetPendingCount() const;
+
+    /**
+     * @brief Hash file content with 64 bit FNV-1a.
+     *
+     * @return U64 The hash, 0 if the file cannot be read
+     */
+    static U64 HashFile(const std::filesystem::path &path);
+
+    /**
+     * @brief Shrink an RGBA8 image to fit a square thumbnail, centered on a transparent background.
+     */
+    static JzThumbnail DownscaleImage(const U8 *rgba, U32 width, U32 height, U32 size);
+
+    /**
+     * @brief Rasterize a triangle mesh from above and in front, framed by its bounds.
+     *
+     * @param positions Vertex positions
+     * @param indices Triangle list indices
+     * @param size Edge length of the thumbnail
+     */
+    static JzThumbnail RenderMesh(const std::vector<JzVec3> &positions, const std::vector<U32> &indices, U32 size);
+
+    /**
+     * @brief Draw a lit sphere in the given color.
+     */
+    static JzThumbnail RenderSwatch(const JzVec3 &color, U32 size);
+
+private:
+    struct JzHashRecord {
+        std::filesystem::file_time_type writeTime;
+        std::uintmax_t                  fileSize = 0;
+        U64                             hash     = 0;
+    };
+
+    void ProcessNext();
+    Bool Generate(const std::filesystem::path &path, JzThumbnail &outThumbnail);
+    U64  GetContentHash(const std::filesystem::path &path);
+    Bool LoadCached(const std::filesystem::path &cacheFile, JzThumbnail &outThumbnail) const;
+    void StoreCached(const std::filesystem::path &cacheFile, const JzThumbnail &thumbnail) const;
+
+private:
+    JzThumbnailCacheConfig                   m_config;
+    mutable std::mutex                       m_mutex;
+    std::vector<std::filesystem::path>       m_requests; ///< Served newest first
+    std::unordered_set<String>               m_queued;   ///< Requested and not finished
+    std::deque<JzThumbnailResult>            m_results;
+    std::unordered_map<String, JzHashRecord> m_hashes;   ///< Skips rehashing unchanged files
+    std::unique_ptr<JzThreadPool>            m_workers;
+};
+
+} // namespace JzRE
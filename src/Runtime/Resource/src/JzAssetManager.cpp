@@ -75,6 +75,7 @@ void JzAssetManager::Shutdown()
         std::lock_guard lock(m_callbackMutex);
         m_callbacks.clear();
     }
+    m_loadResultListener = nullptr;
 
     // Clear queues
     {
@@ -327,7 +328,16 @@ void JzAssetManager::ProcessResults()
                 m_callbacks.erase(it);
             }
         }
+
+        if (m_loadResultListener) {
+            m_loadResultListener(result);
+        }
     }
 }
 
+void JzAssetManager::SetLoadResultListener(JzAssetLoadResultListener listener)
+{
+    m_loadResultListener = std::move(listener);
+}
+
 } // namespace JzRE
@@ -0,0 +1,315 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Resource/JzKtx2.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+
+#include "JzRE/Runtime/Core/JzLogger.h"
+
+namespace JzRE {
+
+namespace {
+
+constexpr std::array<U8, 12> kIdentifier = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+constexpr Size kHeaderSize     = 80; ///< Identifier, header and index
+constexpr Size kLevelIndexSize = 24; ///< byteOffset, byteLength, uncompressedByteLength
+
+// Khronos Data Format basic descriptor values
+constexpr U8 kModelRGBSDA = 1;
+constexpr U8 kModelBC1A   = 128;
+constexpr U8 kModelBC3    = 130;
+constexpr U8 kModelBC4    = 131;
+constexpr U8 kModelBC5    = 132;
+constexpr U8 kModelBC7    = 134;
+constexpr U8 kModelETC2   = 161;
+constexpr U8 kModelASTC   = 162;
+
+constexpr U8 kPrimariesBT709  = 1;
+constexpr U8 kTransferLinear  = 1;
+constexpr U8 kChannelAlpha    = 15;
+constexpr U8 kChannelETC2Rgb  = 2;
+constexpr U8 kChannelBC1Alpha = 1;
+
+/**
+ * @brief One sample of the data format descriptor.
+ */
+struct JzKtx2Sample {
+    U16 bitOffset;
+    U8  bitLength;
+    U8  channel;
+    U32 upper;
+};
+
+/**
+ * @brief How a texture format is identified and described in KTX2.
+ */
+struct JzKtx2FormatInfo {
+    JzETextureResourceFormat  format;
+    U32                       vkFormat;
+    U32                       vkFormatSrgb; ///< 0 if the format has no sRGB variant
+    U8                        model;
+    std::vector<JzKtx2Sample> samples;
+};
+
+const std::vector<JzKtx2FormatInfo> &GetFormatTable()
+{
+    static const std::vector<JzKtx2FormatInfo> table = {
+        {JzETextureResourceFormat::R8, 9, 15, kModelRGBSDA, {{0, 7, 0, 255}}},
+        {JzETextureResourceFormat::RG8, 16, 22, kModelRGBSDA, {{0, 7, 0, 255}, {8, 7, 1, 255}}},
+        {JzETextureResourceFormat::RGBA8,
+         37,
+         43,
+         kModelRGBSDA,
+         {{0, 7, 0, 255}, {8, 7, 1, 255}, {16, 7, 2, 255}, {24, 7, kChannelAlpha, 255}}},
+        {JzETextureResourceFormat::BC1, 133, 134, kModelBC1A, {{0, 63, kChannelBC1Alpha, 0xFFFFFFFFu}}},
+        {JzETextureResourceFormat::BC3, 137, 138, kModelBC3, {{0, 63, kChannelAlpha, 0xFFFFFFFFu}, {64, 63, 0, 0xFFFFFFFFu}}},
+        {JzETextureResourceFormat::BC4, 139, 0, kModelBC4, {{0, 63, 0, 0xFFFFFFFFu}}},
+        {JzETextureResourceFormat::BC5, 141, 0, kModelBC5, {{0, 63, 0, 0xFFFFFFFFu}, {64, 63, 1, 0xFFFFFFFFu}}},
+        {JzETextureResourceFormat::BC7, 145, 146, kModelBC7, {{0, 127, 0, 0xFFFFFFFFu}}},
+        {JzETextureResourceFormat::ETC2RGB8, 147, 148, kModelETC2, {{0, 63, kChannelETC2Rgb, 0xFFFFFFFFu}}},
+        {JzETextureResourceFormat::ETC2RGBA8,
+         151,
+         152,
+         kModelETC2,
+         {{0, 63, kChannelAlpha, 0xFFFFFFFFu}, {64, 63, kChannelETC2Rgb, 0xFFFFFFFFu}}},
+        {JzETextureResourceFormat::ASTC4x4, 157, 158, kModelASTC, {{0, 127, 0, 0xFFFFFFFFu}}},
+    };
+    return table;
+}
+
+const JzKtx2FormatInfo *FindByFormat(JzETextureResourceFormat format)
+{
+    for (const auto &info : GetFormatTable()) {
+        if (info.format == format) {
+            return &info;
+        }
+    }
+    return nullptr;
+}
+
+const JzKtx2FormatInfo *FindByVkFormat(U32 vkFormat)
+{
+    for (const auto &info : GetFormatTable()) {
+        if (info.vkFormat == vkFormat || (info.vkFormatSrgb != 0 && info.vkFormatSrgb == vkFormat)) {
+            return &info;
+        }
+    }
+    return nullptr;
+}
+
+Size AlignUp(Size value, Size alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+void WriteU32(std::vector<U8> &out, Size offset, U32 value)
+{
+    for (Size i = 0; i < 4; ++i) {
+        out[offset + i] = static_cast<U8>(value >> (i * 8));
+    }
+}
+
+void WriteU64(std::vector<U8> &out, Size offset, U64 value)
+{
+    for (Size i = 0; i < 8; ++i) {
+        out[offset + i] = static_cast<U8>(value >> (i * 8));
+    }
+}
+
+U32 ReadU32(const U8 *data, Size offset)
+{
+    U32 value = 0;
+    for (Size i = 0; i < 4; ++i) {
+        value |= static_cast<U32>(data[offset + i]) << (i * 8);
+    }
+    return value;
+}
+
+U64 ReadU64(const U8 *data, Size offset)
+{
+    U64 value = 0;
+    for (Size i = 0; i < 8; ++i) {
+        value |= static_cast<U64>(data[offset + i]) << (i * 8);
+    }
+    return value;
+}
+
+std::vector<U8> BuildDataFormatDescriptor(const JzKtx2FormatInfo &info)
+{
+    const Bool compressed = IsCompressedTextureFormat(info.format);
+    const U32  blockSize  = 24 + 16 * static_cast<U32>(info.samples.size());
+    const U32  totalSize  = 4 + blockSize;
+
+    std::vector<U8> dfd(totalSize, 0);
+    WriteU32(dfd, 0, totalSize);
+    WriteU32(dfd, 4, 0);                      // vendorId = Khronos, descriptorType = basic
+    WriteU32(dfd, 8, 2u | (blockSize << 16)); // versionNumber 2
+    WriteU32(dfd, 12, info.model | (kPrimariesBT709 << 8) | (kTransferLinear << 16));
+    WriteU32(dfd, 16, compressed ? 0x00000303u : 0u); // texelBlockDimension - 1
+    WriteU32(dfd, 20, GetTextureFormatBlockSize(info.format));
+
+    Size offset = 28;
+    for (const auto &sample : info.samples) {
+        WriteU32(dfd, offset, sample.bitOffset | (static_cast<U32>(sample.bitLength) << 16) |
+                                  (static_cast<U32>(sample.channel) << 24));
+        WriteU32(dfd, offset + 4, 0);
+        WriteU32(dfd, offset + 8, 0);
+        WriteU32(dfd, offset + 12, sample.upper);
+        offset += 16;
+    }
+    return dfd;
+}
+
+} // namespace
+
+std::vector<U8> JzKtx2::Encode(const JzKtx2Image &image)
+{
+    const auto *info = FindByFormat(image.format);
+    if (!info || image.width == 0 || image.height == 0 || image.levels.empty() ||
+        image.levels.size() > GetTextureMipCount(image.width, image.height)) {
+        return {};
+    }
+
+    for (Size level = 0; level < image.levels.size(); ++level) {
+        if (image.levels[level].size() != GetTextureLevelSize(image.format, image.width, image.height, static_cast<U32>(level))) {
+            return {};
+        }
+    }
+
+    const Size levelCount = image.levels.size();
+    const auto dfd        = BuildDataFormatDescriptor(*info);
+    const Size dfdOffset  = kHeaderSize + levelCount * kLevelIndexSize;
+
+    // Levels are stored smallest first, each aligned to lcm(block size, 4)
+    const Size blockSize = GetTextureFormatBlockSize(image.format);
+    const Size alignment = std::lcm(blockSize, Size{4});
+
+    std::vector<Size> levelOffsets(levelCount);
+    Size              cursor = dfdOffset + dfd.size();
+    for (Size level = levelCount; level-- > 0;) {
+        cursor              = AlignUp(cursor, alignment);
+        levelOffsets[level] = cursor;
+        cursor += image.levels[level].size();
+    }
+
+    std::vector<U8> out(cursor, 0);
+    std::memcpy(out.data(), kIdentifier.data(), kIdentifier.size());
+    WriteU32(out, 12, info->vkFormat);
+    WriteU32(out, 16, 1); // typeSize
+    WriteU32(out, 20, image.width);
+    WriteU32(out, 24, image.height);
+    WriteU32(out, 28, 0); // pixelDepth
+    WriteU32(out, 32, 0); // layerCount
+    WriteU32(out, 36, 1); // faceCount
+    WriteU32(out, 40, static_cast<U32>(levelCount));
+    WriteU32(out, 44, 0); // supercompressionScheme
+    WriteU32(out, 48, static_cast<U32>(dfdOffset));
+    WriteU32(out, 52, static_cast<U32>(dfd.size()));
+    WriteU32(out, 56, 0); // kvdByteOffset
+    WriteU32(out, 60, 0); // kvdByteLength
+    WriteU64(out, 64, 0); // sgdByteOffset
+    WriteU64(out, 72, 0); // sgdByteLength
+
+    for (Size level = 0; level < levelCount; ++level) {
+        const Size entry = kHeaderSize + level * kLevelIndexSize;
+        WriteU64(out, entry, levelOffsets[level]);
+        WriteU64(out, entry + 8, image.levels[level].size());
+        WriteU64(out, entry + 16, image.levels[level].size());
+        std::memcpy(out.data() + levelOffsets[level], image.levels[level].data(), image.levels[level].size());
+    }
+
+    std::memcpy(out.data() + dfdOffset, dfd.data(), dfd.size());
+    return out;
+}
+
+std::optional<JzKtx2Image> JzKtx2::Decode(const U8 *data, Size size)
+{
+    if (!data || size < kHeaderSize || std::memcmp(data, kIdentifier.data(), kIdentifier.size()) != 0) {
+        return std::nullopt;
+    }
+
+    const U32 vkFormat         = ReadU32(data, 12);
+    const U32 width            = ReadU32(data, 20);
+    const U32 height           = ReadU32(data, 24);
+    const U32 depth            = ReadU32(data, 28);
+    const U32 layerCount       = ReadU32(data, 32);
+    const U32 faceCount        = ReadU32(data, 36);
+    const U32 levelCount       = std::max<U32>(1, ReadU32(data, 40));
+    const U32 supercompression = ReadU32(data, 44);
+
+    const auto *info = FindByVkFormat(vkFormat);
+    if (!info || width == 0 || height == 0 || depth > 1 || layerCount > 1 || faceCount != 1 || supercompression != 0 ||
+        levelCount > GetTextureMipCount(width, height)) {
+        return std::nullopt;
+    }
+
+    if (size < kHeaderSize + static_cast<Size>(levelCount) * kLevelIndexSize) {
+        return std::nullopt;
+    }
+
+    JzKtx2Image image;
+    image.format = info->format;
+    image.width  = width;
+    image.height = height;
+    image.levels.resize(levelCount);
+
+    for (U32 level = 0; level < levelCount; ++level) {
+        const Size entry      = kHeaderSize + static_cast<Size>(level) * kLevelIndexSize;
+        const U64  byteOffset = ReadU64(data, entry);
+        const U64  byteLength = ReadU64(data, entry + 8);
+        if (byteLength != GetTextureLevelSize(image.format, width, height, level) || byteOffset > size ||
+            byteLength > size - byteOffset) {
+            return std::nullopt;
+        }
+        image.levels[level].assign(data + byteOffset, data + byteOffset + byteLength);
+    }
+
+    return image;
+}
+
+Bool JzKtx2::Save(const std::filesystem::path &path, const JzKtx2Image &image)
+{
+    const auto bytes = Encode(image);
+    if (bytes.empty()) {
+        return false;
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+    file.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return file.good();
+}
+
+std::optional<JzKtx2Image> JzKtx2::Load(const std::filesystem::path &path)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return std::nullopt;
+    }
+
+    const auto      size = static_cast<Size>(file.tellg());
+    std::vector<U8> bytes(size);
+    file.seekg(0);
+    file.read(reinterpret_cast<char *>(bytes.data()), static_cast<std::streamsize>(size));
+    if (!file) {
+        return std::nullopt;
+    }
+
+    auto image = Decode(bytes.data(), bytes.size());
+    if (!image) {
+        JzRE_LOG_WARN("JzKtx2: unsupported or malformed file '{}'", path.string());
+    }
+    return image;
+}
+
+} // namespace JzRE
@@ -4,7 +4,9 @@
  */
 
 #include "JzRE/Runtime/Resource/JzMesh.h"
+#include <algorithm>
 #include "JzRE/Runtime/Core/JzServiceContainer.h"
+#include "JzRE/Runtime/Resource/JzMeshSimplifier.h"
 #include "JzRE/Runtime/Platform/RHI/JzDevice.h"
 
 namespace JzRE {
@@ -19,6 +21,7 @@ JzMesh::JzMesh(std::vector<JzVertex> vertices, std::vector<uint32_t> indices, I3
     m_vertices(std::move(vertices)), m_indices(std::move(indices)), m_materialIndex(materialIndex)
 {
     m_state = JzEResourceState::Unloaded;
+    ComputeBounds();
 }
 
 JzMesh::~JzMesh()
@@ -36,6 +39,10 @@ Bool JzMesh::Load()
 
     SetupMesh();
 
+    for (auto &lod : m_lods) {
+        lod.mesh->Load();
+    }
+
     // If setup fails, vertex array will be null
     if (m_vertexArray) {
         m_state = JzEResourceState::Loaded;
@@ -59,9 +66,74 @@ void JzMesh::Unload()
     m_indices.clear();
     m_indices.shrink_to_fit();
 
+    m_lods.clear();
+
     m_state = JzEResourceState::Unloaded;
 }
 
+U32 JzMesh::GenerateLODChain(const JzMeshLODSettings &settings)
+{
+    m_lods.clear();
+
+    if (m_indices.empty() || settings.reductionRatio <= 0.0f || settings.reductionRatio >= 1.0f) {
+        return 0;
+    }
+
+    const Size minIndexCount = static_cast<Size>(settings.minTriangleCount) * 3;
+    Size       previousCount = m_indices.size();
+    F32        previousError = 0.0f;
+    F32        ratio         = 1.0f;
+
+    for (U32 level = 1; level <= settings.maxLevels; ++level) {
+        ratio *= settings.reductionRatio;
+        const Size target = static_cast<Size>(static_cast<F32>(m_indices.size()) * ratio) / 3 * 3;
+        if (target < minIndexCount) {
+            break;
+        }
+
+        auto simplified = JzMeshSimplifier::Simplify(m_vertices, m_indices, target);
+
+        // Simplification got stuck (locked seams, topology): further levels would not help
+        if (simplified.indices.empty() ||
+            static_cast<F32>(simplified.indices.size()) > 0.8f * static_cast<F32>(previousCount)) {
+            break;
+        }
+
+        auto vertices = JzMeshSimplifier::CompactVertices(m_vertices, simplified.indices);
+        previousCount = simplified.indices.size();
+        previousError = std::max(previousError, simplified.error);
+
+        JzMeshLOD lod;
+        lod.mesh  = std::make_shared<JzMesh>(std::move(vertices), std::move(simplified.indices), m_materialIndex);
+        lod.error = previousError;
+        m_lods.push_back(std::move(lod));
+    }
+
+    return static_cast<U32>(m_lods.size());
+}
+
+void JzMesh::ComputeBounds()
+{
+    if (m_vertices.empty()) {
+        return;
+    }
+
+    JzVec3 minPos = m_vertices.front().Position;
+    JzVec3 maxPos = minPos;
+    for (const auto &vertex : m_vertices) {
+        for (U16 axis = 0; axis < 3; ++axis) {
+            minPos[axis] = std::min(minPos[axis], vertex.Position[axis]);
+            maxPos[axis] = std::max(maxPos[axis], vertex.Position[axis]);
+        }
+    }
+
+    m_boundsCenter = (minPos + maxPos) * 0.5f;
+    m_boundsRadius = 0.0f;
+    for (const auto &vertex : m_vertices) {
+        m_boundsRadius = std::max(m_boundsRadius, (vertex.Position - m_boundsCenter).Length());
+    }
+}
+
 void JzMesh::SetupMesh()
 {
     auto &device = JzServiceContainer::Get<JzDevice>();
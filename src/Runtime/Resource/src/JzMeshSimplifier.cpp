@@ -0,0 +1,425 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Resource/JzMeshSimplifier.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <queue>
+#include <unordered_map>
+
+namespace JzRE {
+
+namespace {
+
+/**
+ * @brief Symmetric 4x4 error quadric stored as its 10 unique coefficients.
+ */
+struct JzQuadric {
+    std::array<F64, 10> m{};
+
+    static JzQuadric FromPlane(F64 a, F64 b, F64 c, F64 d, F64 weight)
+    {
+        JzQuadric q;
+        q.m = {a * a * weight, a * b * weight, a * c * weight, a * d * weight,
+               b * b * weight, b * c * weight, b * d * weight,
+               c * c * weight, c * d * weight,
+               d * d * weight};
+        return q;
+    }
+
+    JzQuadric &operator+=(const JzQuadric &other)
+    {
+        for (Size i = 0; i < m.size(); ++i) {
+            m[i] += other.m[i];
+        }
+        return *this;
+    }
+
+    F64 Evaluate(const JzVec3 &p) const
+    {
+        const F64 x = p.x, y = p.y, z = p.z;
+        return m[0] * x * x + 2.0 * m[1] * x * y + 2.0 * m[2] * x * z + 2.0 * m[3] * x
+             + m[4] * y * y + 2.0 * m[5] * y * z + 2.0 * m[6] * y
+             + m[7] * z * z + 2.0 * m[8] * z
+             + m[9];
+    }
+};
+
+/**
+ * @brief Candidate half-edge collapse (from -> to).
+ */
+struct JzCollapse {
+    F64 cost;
+    U32 from;
+    U32 to;
+    U32 fromVersion;
+    U32 toVersion;
+
+    Bool operator>(const JzCollapse &other) const
+    {
+        return cost > other.cost;
+    }
+};
+
+struct JzPositionKey {
+    U32 x, y, z;
+
+    Bool operator==(const JzPositionKey &other) const
+    {
+        return x == other.x && y == other.y && z == other.z;
+    }
+};
+
+struct JzPositionKeyHash {
+    Size operator()(const JzPositionKey &key) const
+    {
+        Size h = key.x;
+        h      = h * 73856093u ^ key.y;
+        h      = h * 19349663u ^ key.z;
+        return h;
+    }
+};
+
+JzPositionKey MakePositionKey(const JzVec3 &p)
+{
+    JzPositionKey key;
+    std::memcpy(&key.x, &p.x, sizeof(F32));
+    std::memcpy(&key.y, &p.y, sizeof(F32));
+    std::memcpy(&key.z, &p.z, sizeof(F32));
+    return key;
+}
+
+JzVec3 TriangleNormal(const JzVec3 &a, const JzVec3 &b, const JzVec3 &c)
+{
+    return (b - a).Cross(c - a);
+}
+
+U64 EdgeKey(U32 a, U32 b)
+{
+    return (static_cast<U64>(std::min(a, b)) << 32) | static_cast<U64>(std::max(a, b));
+}
+
+} // namespace
+
+JzMeshSimplifyResult JzMeshSimplifier::Simplify(const std::vector<JzVertex> &vertices,
+                                                const std::vector<U32>      &indices,
+                                                Size                         targetIndexCount,
+                                                F32                          maxError)
+{
+    JzMeshSimplifyResult result;
+    result.indices = indices;
+
+    const Size triangleCount = indices.size() / 3;
+    if (triangleCount == 0 || indices.size() <= targetIndexCount) {
+        return result;
+    }
+
+    // ==================== Weld by position ====================
+
+    std::vector<U32>    weldOf(vertices.size());
+    std::vector<JzVec3> positions;
+    std::vector<JzVec2> weldUV;
+    std::vector<Bool>   locked;
+    {
+        std::unordered_map<JzPositionKey, U32, JzPositionKeyHash> weldMap;
+        weldMap.reserve(vertices.size());
+        for (Size v = 0; v < vertices.size(); ++v) {
+            const auto &vertex  = vertices[v];
+            auto [it, inserted] = weldMap.try_emplace(MakePositionKey(vertex.Position),
+                                                      static_cast<U32>(positions.size()));
+            if (inserted) {
+                positions.push_back(vertex.Position);
+                weldUV.push_back(vertex.TexCoords);
+                locked.push_back(false);
+            } else if (weldUV[it->second] != vertex.TexCoords) {
+                // Texture seam: collapsing this position would tear the UV layout
+                locked[it->second] = true;
+            }
+            weldOf[v] = it->second;
+        }
+    }
+
+    const Size weldCount = positions.size();
+
+    // ==================== Build triangles and adjacency ====================
+
+    std::vector<std::array<U32, 3>> triangles;    // welded vertex ids
+    std::vector<std::array<U32, 3>> triCorners;   // original vertex ids
+    std::vector<Bool>               triAlive;
+    triangles.reserve(triangleCount);
+    triCorners.reserve(triangleCount);
+
+    for (Size t = 0; t < triangleCount; ++t) {
+        const U32 i0 = indices[t * 3 + 0];
+        const U32 i1 = indices[t * 3 + 1];
+        const U32 i2 = indices[t * 3 + 2];
+        if (i0 >= vertices.size() || i1 >= vertices.size() || i2 >= vertices.size()) {
+            return result;
+        }
+
+        const U32 w0 = weldOf[i0], w1 = weldOf[i1], w2 = weldOf[i2];
+        if (w0 == w1 || w1 == w2 || w0 == w2) {
+            continue;
+        }
+        triangles.push_back({w0, w1, w2});
+        triCorners.push_back({i0, i1, i2});
+    }
+    triAlive.assign(triangles.size(), true);
+
+    std::vector<std::vector<U32>> vertexTriangles(weldCount);
+    for (U32 t = 0; t < triangles.size(); ++t) {
+        for (U32 c = 0; c < 3; ++c) {
+            vertexTriangles[triangles[t][c]].push_back(t);
+        }
+    }
+
+    // ==================== Quadrics ====================
+
+    std::vector<JzQuadric> quadrics(weldCount);
+    std::unordered_map<U64, U32> edgeUse;
+    edgeUse.reserve(triangles.size() * 3);
+
+    for (const auto &tri : triangles) {
+        const JzVec3 &p0  = positions[tri[0]];
+        JzVec3        n   = TriangleNormal(p0, positions[tri[1]], positions[tri[2]]);
+        const F32     len = n.Length();
+        if (len <= 0.0f) {
+            continue;
+        }
+        n = n / len;
+
+        const auto plane = JzQuadric::FromPlane(n.x, n.y, n.z, -n.Dot(p0), 1.0);
+        for (U32 c = 0; c < 3; ++c) {
+            quadrics[tri[c]] += plane;
+            edgeUse[EdgeKey(tri[c], tri[(c + 1) % 3])]++;
+        }
+    }
+
+    // Boundary edges get a perpendicular constraint plane so open borders stay in place
+    constexpr F64 kBoundaryWeight = 10.0;
+    for (const auto &tri : triangles) {
+        const JzVec3 faceNormal = TriangleNormal(positions[tri[0]], positions[tri[1]], positions[tri[2]]);
+        for (U32 c = 0; c < 3; ++c) {
+            const U32 a = tri[c];
+            const U32 b = tri[(c + 1) % 3];
+            if (edgeUse[EdgeKey(a, b)] != 1) {
+                continue;
+            }
+
+            JzVec3    n   = (positions[b] - positions[a]).Cross(faceNormal);
+            const F32 len = n.Length();
+            if (len <= 0.0f) {
+                continue;
+            }
+            n = n / len;
+
+            const auto plane = JzQuadric::FromPlane(n.x, n.y, n.z, -n.Dot(positions[a]), kBoundaryWeight);
+            quadrics[a] += plane;
+            quadrics[b] += plane;
+        }
+    }
+
+    // ==================== Collapse loop ====================
+
+    std::vector<U32>  version(weldCount, 0);
+    std::vector<Bool> removed(weldCount, false);
+
+    std::priority_queue<JzCollapse, std::vector<JzCollapse>, std::greater<JzCollapse>> heap;
+
+    auto pushCandidate = [&](U32 from, U32 to) {
+        if (locked[from]) {
+            return;
+        }
+        JzQuadric q = quadrics[from];
+        q += quadrics[to];
+        heap.push({std::max(q.Evaluate(positions[to]), 0.0), from, to, version[from], version[to]});
+    };
+
+    auto collectNeighbours = [&](U32 v, std::vector<U32> &out) {
+        out.clear();
+        for (U32 t : vertexTriangles[v]) {
+            if (!triAlive[t]) {
+                continue;
+            }
+            for (U32 c = 0; c < 3; ++c) {
+                if (triangles[t][c] != v) {
+                    out.push_back(triangles[t][c]);
+                }
+            }
+        }
+        std::sort(out.begin(), out.end());
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+    };
+
+    std::vector<U32> neighbours;
+    std::vector<U32> otherNeighbours;
+    for (U32 v = 0; v < weldCount; ++v) {
+        collectNeighbours(v, neighbours);
+        for (U32 n : neighbours) {
+            pushCandidate(v, n);
+        }
+    }
+
+    const F64  maxCost     = static_cast<F64>(maxError) * static_cast<F64>(maxError);
+    const Size targetTris  = targetIndexCount / 3;
+    Size       aliveCount  = triangles.size();
+    F64        reachedCost = 0.0;
+
+    while (aliveCount > targetTris && !heap.empty()) {
+        const JzCollapse candidate = heap.top();
+        heap.pop();
+
+        const U32 from = candidate.from;
+        const U32 to   = candidate.to;
+        if (removed[from] || removed[to] || candidate.fromVersion != version[from] ||
+            candidate.toVersion != version[to]) {
+            continue;
+        }
+        if (candidate.cost > maxCost) {
+            break;
+        }
+
+        // Link condition: the edge may only share as many neighbours as it has faces
+        collectNeighbours(from, neighbours);
+        collectNeighbours(to, otherNeighbours);
+        Size sharedNeighbours = 0;
+        Size sharedTriangles  = 0;
+        for (U32 n : neighbours) {
+            if (std::binary_search(otherNeighbours.begin(), otherNeighbours.end(), n)) {
+                ++sharedNeighbours;
+            }
+        }
+
+        Bool valid = true;
+        for (U32 t : vertexTriangles[from]) {
+            if (!triAlive[t]) {
+                continue;
+            }
+            const auto &tri = triangles[t];
+            if (tri[0] == to || tri[1] == to || tri[2] == to) {
+                ++sharedTriangles;
+                continue;
+            }
+
+            // Reject collapses that flip or degenerate a remaining triangle
+            std::array<JzVec3, 3> moved = {positions[tri[0]], positions[tri[1]], positions[tri[2]]};
+            const JzVec3          before = TriangleNormal(moved[0], moved[1], moved[2]);
+            for (U32 c = 0; c < 3; ++c) {
+                if (tri[c] == from) {
+                    moved[c] = positions[to];
+                }
+            }
+            const JzVec3 after = TriangleNormal(moved[0], moved[1], moved[2]);
+            if (before.Dot(after) <= 0.0f) {
+                valid = false;
+                break;
+            }
+        }
+        if (!valid || sharedTriangles == 0 || sharedNeighbours > sharedTriangles) {
+            continue;
+        }
+
+        // Apply collapse
+        for (U32 t : vertexTriangles[from]) {
+            if (!triAlive[t]) {
+                continue;
+            }
+            auto &tri = triangles[t];
+            if (tri[0] == to || tri[1] == to || tri[2] == to) {
+                triAlive[t] = false;
+                --aliveCount;
+                continue;
+            }
+            for (U32 c = 0; c < 3; ++c) {
+                if (tri[c] == from) {
+                    tri[c] = to;
+                }
+            }
+            vertexTriangles[to].push_back(t);
+        }
+        vertexTriangles[from].clear();
+
+        quadrics[to] += quadrics[from];
+        removed[from] = true;
+        ++version[from];
+        ++version[to];
+        reachedCost = std::max(reachedCost, candidate.cost);
+
+        auto &toTriangles = vertexTriangles[to];
+        toTriangles.erase(std::remove_if(toTriangles.begin(), toTriangles.end(),
+                                         [&](U32 t) { return !triAlive[t]; }),
+                          toTriangles.end());
+
+        collectNeighbours(to, neighbours);
+        for (U32 n : neighbours) {
+            pushCandidate(to, n);
+            pushCandidate(n, to);
+        }
+    }
+
+    // ==================== Emit indices ====================
+
+    std::vector<std::vector<U32>> weldVertices(weldCount);
+    for (U32 v = 0; v < vertices.size(); ++v) {
+        weldVertices[weldOf[v]].push_back(v);
+    }
+
+    // Pick the source vertex at the collapse target whose attributes best match the original corner
+    auto resolveCorner = [&](U32 corner, U32 weld) -> U32 {
+        if (weldOf[corner] == weld) {
+            return corner;
+        }
+        const JzVertex &original = vertices[corner];
+        U32             best     = weldVertices[weld].front();
+        F32             bestCost = std::numeric_limits<F32>::max();
+        for (U32 v : weldVertices[weld]) {
+            const JzVec2 duv  = vertices[v].TexCoords - original.TexCoords;
+            const F32    cost = duv.Dot(duv) + (1.0f - vertices[v].Normal.Dot(original.Normal));
+            if (cost < bestCost) {
+                bestCost = cost;
+                best     = v;
+            }
+        }
+        return best;
+    };
+
+    result.indices.clear();
+    result.indices.reserve(aliveCount * 3);
+    for (Size t = 0; t < triangles.size(); ++t) {
+        if (!triAlive[t]) {
+            continue;
+        }
+        for (U32 c = 0; c < 3; ++c) {
+            result.indices.push_back(resolveCorner(triCorners[t][c], triangles[t][c]));
+        }
+    }
+    result.error = static_cast<F32>(std::sqrt(reachedCost));
+
+    return result;
+}
+
+std::vector<JzVertex> JzMeshSimplifier::CompactVertices(const std::vector<JzVertex> &vertices,
+                                                        std::vector<U32>            &indices)
+{
+    constexpr U32         kUnused = std::numeric_limits<U32>::max();
+    std::vector<U32>      remap(vertices.size(), kUnused);
+    std::vector<JzVertex> compacted;
+    compacted.reserve(vertices.size());
+
+    for (auto &index : indices) {
+        if (remap[index] == kUnused) {
+            remap[index] = static_cast<U32>(compacted.size());
+            compacted.push_back(vertices[index]);
+        }
+        index = remap[index];
+    }
+
+    return compacted;
+}
+
+} // namespace JzRE
@@ -125,7 +125,8 @@ std::shared_ptr<JzRE::JzMesh> JzRE::JzModel::ProcessMesh(aiMesh *mesh, const aiS
 
     // Create mesh with material index
     auto meshResource = std::make_shared<JzMesh>(vertices, indices, materialIndex);
-    meshResource->Load(); // Create GPU resources
+    meshResource->GenerateLODChain(); // Simplify while CPU data is available
+    meshResource->Load();             // Create GPU resources (including LOD levels)
     return meshResource;
 }
 
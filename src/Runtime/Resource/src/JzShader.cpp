@@ -247,9 +247,11 @@ void JzShader::Unload()
 
 std::shared_ptr<JzRHIPipeline> JzShader::GetVariant(U64 keywordMask)
 {
+    // A variant that failed to compile stays cached, so callers keep the fallback without retrying
     auto cached = m_compiledVariants.find(keywordMask);
     if (cached != m_compiledVariants.end()) {
-        return cached->second;
+        const auto &pipeline = cached->second;
+        return (pipeline && pipeline->IsReady() && !pipeline->HasFailed()) ? pipeline : nullptr;
     }
 
     std::shared_ptr<JzRHIPipeline> pipeline;
@@ -262,11 +264,20 @@ std::shared_ptr<JzRHIPipeline> JzShader::GetVariant(U64 keywordMask)
         if (keywordMask == 0 && !m_mainVariant) {
             m_mainVariant = pipeline;
         }
+        if (!pipeline->IsReady() || pipeline->HasFailed()) {
+            return nullptr;
+        }
     }
 
     return pipeline;
 }
 
+Bool JzShader::IsVariantPending(U64 keywordMask) const
+{
+    auto cached = m_compiledVariants.find(keywordMask);
+    return cached != m_compiledVariants.end() && cached->second && !cached->second->IsReady();
+}
+
 std::vector<JzShaderProgramDesc> JzShader::GetBackendProgramDesc(JzERHIType rhiType, U64 keywordMask) const
 {
     std::vector<JzShaderProgramDesc> result;
@@ -386,6 +397,11 @@ Bool JzShader::LoadManifest()
         m_name = manifest["shaderName"].get<String>();
     }
 
+    m_sourceHash.clear();
+    if (manifest["sourceHash"].is_string()) {
+        m_sourceHash = manifest["sourceHash"].get<String>();
+    }
+
     if (!manifest["keywords"].is_array()) {
         m_compileLog = "Shader manifest 'keywords' must be an array";
         JzRE_LOG_ERROR("JzShader: {} ({})", m_compileLog, m_manifestPath);
@@ -777,6 +793,9 @@ Bool JzShader::BuildVariantPipeline(U64 keywordMask, std::shared_ptr<JzRHIPipeli
     JzPipelineDesc pipelineDesc{};
     pipelineDesc.renderState = variant->renderState;
     pipelineDesc.debugName   = m_name + "_" + std::to_string(variant->keywordMask);
+    if (!m_sourceHash.empty()) {
+        pipelineDesc.cacheKey = m_name + "_" + m_sourceHash + "_" + std::to_string(variant->keywordMask);
+    }
 
     auto layoutIter = m_vertexLayouts.find(variant->vertexLayoutName);
     if (layoutIter != m_vertexLayouts.end()) {
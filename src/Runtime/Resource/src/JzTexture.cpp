@@ -4,10 +4,21 @@
  */
 
 #include "JzRE/Runtime/Resource/JzTexture.h"
+#include <mutex>
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
+#include "JzRE/Runtime/Core/JzLogger.h"
 #include "JzRE/Runtime/Core/JzServiceContainer.h"
 #include "JzRE/Runtime/Platform/RHI/JzDevice.h"
+#include "JzRE/Runtime/Resource/JzKtx2.h"
+
+namespace {
+
+std::mutex            g_cookedRootMutex;
+std::filesystem::path g_contentRoot;
+std::filesystem::path g_cookedRoot;
+
+} // namespace
 
 JzRE::JzTexture::JzTexture(std::shared_ptr<JzRE::JzGPUTextureObject> rhiTexture) :
     m_rhiTexture(rhiTexture)
@@ -33,6 +44,13 @@ JzRE::Bool JzRE::JzTexture::Load()
     }
     m_state = JzEResourceState::Loading;
 
+    auto &device = JzServiceContainer::Get<JzDevice>();
+
+    if (LoadCooked(device)) {
+        m_state = JzEResourceState::Loaded;
+        return true;
+    }
+
     I32 width, height, channels;
     // Force 4 channels (RGBA) for consistency
     stbi_uc *pixels = stbi_load(m_path.c_str(), &width, &height, &channels, STBI_rgb_alpha);
@@ -43,12 +61,16 @@ JzRE::Bool JzRE::JzTexture::Load()
         return false;
     }
 
-    auto &device = JzServiceContainer::Get<JzDevice>();
+    // Source images carry one level; the backend fills the rest of the chain from it
+    const Bool generateMips = device.SupportsMipmapGeneration();
 
     JzGPUTextureObjectDesc textureDesc;
     textureDesc.width     = width;
     textureDesc.height    = height;
     textureDesc.format    = JzETextureResourceFormat::RGBA8;
+    textureDesc.mipLevels = generateMips ? GetTextureMipCount(width, height) : 1;
+    textureDesc.minFilter = generateMips ? JzETextureResourceFilter::LinearMipmapLinear
+                                         : JzETextureResourceFilter::Linear;
     textureDesc.debugName = m_path;
     textureDesc.data      = pixels;
 
@@ -70,3 +92,79 @@ void JzRE::JzTexture::Unload()
     m_rhiTexture = nullptr;
     m_state      = JzEResourceState::Unloaded;
 }
+
+std::filesystem::path JzRE::JzTexture::GetCookedPath(const std::filesystem::path &source,
+                                                     const std::filesystem::path &contentRoot,
+                                                     const std::filesystem::path &cookedRoot)
+{
+    if (contentRoot.empty() || cookedRoot.empty()) {
+        return {};
+    }
+
+    std::error_code ec;
+    const auto      absoluteSource = std::filesystem::absolute(source, ec).lexically_normal();
+    const auto      absoluteRoot   = std::filesystem::absolute(contentRoot, ec).lexically_normal();
+    const auto      relative       = absoluteSource.lexically_relative(absoluteRoot);
+    if (ec || relative.empty() || *relative.begin() == "..") {
+        return {};
+    }
+
+    auto cooked = cookedRoot / relative;
+    cooked += ".ktx2";
+    return cooked.lexically_normal();
+}
+
+void JzRE::JzTexture::SetCookedRoot(const std::filesystem::path &contentRoot, const std::filesystem::path &cookedRoot)
+{
+    std::lock_guard<std::mutex> lock(g_cookedRootMutex);
+    g_contentRoot = contentRoot;
+    g_cookedRoot  = cookedRoot;
+}
+
+JzRE::Bool JzRE::JzTexture::LoadCooked(JzRE::JzDevice &device)
+{
+    const std::filesystem::path source(m_path);
+    const Bool                  direct = source.extension() == ".ktx2";
+
+    std::filesystem::path cooked = source;
+    if (!direct) {
+        std::lock_guard<std::mutex> lock(g_cookedRootMutex);
+        cooked = GetCookedPath(source, g_contentRoot, g_cookedRoot);
+    }
+
+    std::error_code ec;
+    if (cooked.empty() || !std::filesystem::is_regular_file(cooked, ec)) {
+        return false;
+    }
+
+    // A source image edited after the last cook wins until it is cooked again
+    if (!direct && std::filesystem::is_regular_file(source, ec) &&
+        std::filesystem::last_write_time(source, ec) > std::filesystem::last_write_time(cooked, ec)) {
+        return false;
+    }
+
+    const auto image = JzKtx2::Load(cooked);
+    if (!image) {
+        return false;
+    }
+
+    if (!device.SupportsTextureFormat(image->format)) {
+        JzRE_LOG_WARN("JzTexture: device cannot sample the format of '{}', using the source image", cooked.string());
+        return false;
+    }
+
+    JzGPUTextureObjectDesc textureDesc;
+    textureDesc.width     = image->width;
+    textureDesc.height    = image->height;
+    textureDesc.format    = image->format;
+    textureDesc.mipLevels = static_cast<U32>(image->levels.size());
+    textureDesc.minFilter = textureDesc.mipLevels > 1 ? JzETextureResourceFilter::LinearMipmapLinear
+                                                      : JzETextureResourceFilter::Linear;
+    textureDesc.debugName = m_path;
+    for (const auto &level : image->levels) {
+        textureDesc.mipData.push_back({level.data(), level.size()});
+    }
+
+    m_rhiTexture = device.CreateTexture(textureDesc);
+    return m_rhiTexture != nullptr;
+}
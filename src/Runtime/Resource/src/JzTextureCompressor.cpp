@@ -0,0 +1,721 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Resource/JzTextureCompressor.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include <stb_image.h>
+
+#include "JzRE/Runtime/Core/JzLogger.h"
+
+namespace JzRE {
+
+namespace {
+
+using JzTexel = std::array<F32, 4>;
+using JzBlock = std::array<JzTexel, 16>;
+
+/**
+ * @brief Read a 4x4 block, replicating edge texels past the image border.
+ */
+JzBlock ReadBlock(const U8 *rgba, U32 width, U32 height, U32 blockX, U32 blockY)
+{
+    JzBlock block{};
+    for (U32 y = 0; y < 4; ++y) {
+        for (U32 x = 0; x < 4; ++x) {
+            const U32 sx    = std::min(blockX * 4 + x, width - 1);
+            const U32 sy    = std::min(blockY * 4 + y, height - 1);
+            const U8 *texel = rgba + (static_cast<Size>(sy) * width + sx) * 4;
+            for (U32 c = 0; c < 4; ++c) {
+                block[y * 4 + x][c] = texel[c];
+            }
+        }
+    }
+    return block;
+}
+
+/**
+ * @brief Mean and principal axis of the first `channels` channels of the selected texels.
+ */
+void ComputePrincipalAxis(const JzBlock &block, const std::array<Bool, 16> &selected, U32 channels, JzTexel &mean,
+                          JzTexel &axis)
+{
+    mean = {0.0f, 0.0f, 0.0f, 0.0f};
+    axis = {0.0f, 0.0f, 0.0f, 0.0f};
+
+    F32 count = 0.0f;
+    for (Size i = 0; i < 16; ++i) {
+        if (!selected[i]) {
+            continue;
+        }
+        for (U32 c = 0; c < channels; ++c) {
+            mean[c] += block[i][c];
+        }
+        count += 1.0f;
+    }
+    if (count == 0.0f) {
+        return;
+    }
+    for (U32 c = 0; c < channels; ++c) {
+        mean[c] /= count;
+    }
+
+    F32 covariance[4][4] = {};
+    for (Size i = 0; i < 16; ++i) {
+        if (!selected[i]) {
+            continue;
+        }
+        for (U32 a = 0; a < channels; ++a) {
+            for (U32 b = 0; b < channels; ++b) {
+                covariance[a][b] += (block[i][a] - mean[a]) * (block[i][b] - mean[b]);
+            }
+        }
+    }
+
+    // Power iteration seeded with the covariance row of the widest channel
+    U32 widest = 0;
+    for (U32 c = 1; c < channels; ++c) {
+        if (covariance[c][c] > covariance[widest][widest]) {
+            widest = c;
+        }
+    }
+    for (U32 c = 0; c < channels; ++c) {
+        axis[c] = covariance[widest][c];
+    }
+
+    for (U32 iteration = 0; iteration < 8; ++iteration) {
+        JzTexel next{};
+        F32     length = 0.0f;
+        for (U32 a = 0; a < channels; ++a) {
+            for (U32 b = 0; b < channels; ++b) {
+                next[a] += covariance[a][b] * axis[b];
+            }
+            length += next[a] * next[a];
+        }
+        if (length <= 1e-12f) {
+            break;
+        }
+        length = std::sqrt(length);
+        for (U32 c = 0; c < channels; ++c) {
+            axis[c] = next[c] / length;
+        }
+    }
+}
+
+/**
+ * @brief Endpoints at the extremes of the selected texels projected on the principal axis.
+ */
+void ComputeEndpoints(const JzBlock &block, const std::array<Bool, 16> &selected, U32 channels, JzTexel &low,
+                      JzTexel &high)
+{
+    JzTexel mean;
+    JzTexel axis;
+    ComputePrincipalAxis(block, selected, channels, mean, axis);
+
+    F32 minT = std::numeric_limits<F32>::max();
+    F32 maxT = std::numeric_limits<F32>::lowest();
+    for (Size i = 0; i < 16; ++i) {
+        if (!selected[i]) {
+            continue;
+        }
+        F32 t = 0.0f;
+        for (U32 c = 0; c < channels; ++c) {
+            t += (block[i][c] - mean[c]) * axis[c];
+        }
+        minT = std::min(minT, t);
+        maxT = std::max(maxT, t);
+    }
+    if (minT > maxT) {
+        minT = maxT = 0.0f;
+    }
+
+    for (U32 c = 0; c < 4; ++c) {
+        low[c]  = std::clamp(mean[c] + axis[c] * minT, 0.0f, 255.0f);
+        high[c] = std::clamp(mean[c] + axis[c] * maxT, 0.0f, 255.0f);
+    }
+}
+
+/**
+ * @brief Least-squares endpoints for fixed per-texel weights of `a` (the weight of `b` is 1 - w).
+ *
+ * @return false if the system is degenerate (all texels use one weight).
+ */
+Bool FitEndpoints(const JzBlock &block, const std::array<Bool, 16> &selected, const std::array<F32, 16> &weights,
+                  U32 channels, JzTexel &a, JzTexel &b)
+{
+    F32     aa = 0.0f;
+    F32     ab = 0.0f;
+    F32     bb = 0.0f;
+    JzTexel ax{};
+    JzTexel bx{};
+    for (Size i = 0; i < 16; ++i) {
+        if (!selected[i]) {
+            continue;
+        }
+        const F32 wa = weights[i];
+        const F32 wb = 1.0f - wa;
+        aa += wa * wa;
+        ab += wa * wb;
+        bb += wb * wb;
+        for (U32 c = 0; c < channels; ++c) {
+            ax[c] += wa * block[i][c];
+            bx[c] += wb * block[i][c];
+        }
+    }
+
+    const F32 determinant = aa * bb - ab * ab;
+    if (std::abs(determinant) < 1e-6f) {
+        return false;
+    }
+
+    for (U32 c = 0; c < channels; ++c) {
+        a[c] = std::clamp((ax[c] * bb - bx[c] * ab) / determinant, 0.0f, 255.0f);
+        b[c] = std::clamp((bx[c] * aa - ax[c] * ab) / determinant, 0.0f, 255.0f);
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// BC1 colour block
+// ---------------------------------------------------------------------------
+
+U16 PackRGB565(const JzTexel &color)
+{
+    const U32 r = static_cast<U32>(std::lround(color[0] * 31.0f / 255.0f));
+    const U32 g = static_cast<U32>(std::lround(color[1] * 63.0f / 255.0f));
+    const U32 b = static_cast<U32>(std::lround(color[2] * 31.0f / 255.0f));
+    return static_cast<U16>((r << 11) | (g << 5) | b);
+}
+
+std::array<I32, 3> UnpackRGB565(U16 packed)
+{
+    const I32 r = (packed >> 11) & 31;
+    const I32 g = (packed >> 5) & 63;
+    const I32 b = packed & 31;
+    return {(r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)};
+}
+
+/**
+ * @brief Colour indices and squared error of one endpoint pair.
+ */
+struct JzColorFit {
+    U16                color0  = 0;
+    U16                color1  = 0;
+    std::array<U8, 16> indices = {};
+    F32                error   = std::numeric_limits<F32>::max();
+};
+
+JzColorFit EvaluateColorEndpoints(const JzBlock &block, const std::array<Bool, 16> &transparent, U16 color0,
+                                  U16 color1, Bool threeColor)
+{
+    const auto c0 = UnpackRGB565(color0);
+    const auto c1 = UnpackRGB565(color1);
+
+    std::array<std::array<I32, 3>, 4> palette{};
+    palette[0] = c0;
+    palette[1] = c1;
+    for (Size c = 0; c < 3; ++c) {
+        if (threeColor) {
+            palette[2][c] = (c0[c] + c1[c]) / 2;
+        } else {
+            palette[2][c] = (2 * c0[c] + c1[c]) / 3;
+            palette[3][c] = (c0[c] + 2 * c1[c]) / 3;
+        }
+    }
+
+    JzColorFit fit;
+    fit.color0 = color0;
+    fit.color1 = color1;
+    fit.error  = 0.0f;
+
+    const Size candidates = threeColor ? 3 : 4;
+    for (Size i = 0; i < 16; ++i) {
+        if (transparent[i]) {
+            fit.indices[i] = 3;
+            continue;
+        }
+        F32 best = std::numeric_limits<F32>::max();
+        for (Size k = 0; k < candidates; ++k) {
+            F32 error = 0.0f;
+            for (Size c = 0; c < 3; ++c) {
+                const F32 d = block[i][c] - static_cast<F32>(palette[k][c]);
+                error += d * d;
+            }
+            if (error < best) {
+                best           = error;
+                fit.indices[i] = static_cast<U8>(k);
+            }
+        }
+        fit.error += best;
+    }
+    return fit;
+}
+
+/**
+ * @brief Order endpoints for the wanted mode and evaluate them.
+ *
+ * Four-colour mode needs color0 > color1 and three-colour mode color0 <= color1.
+ * Equal endpoints are only valid in four-colour mode when every texel uses index 0.
+ */
+JzColorFit FitColorEndpoints(const JzBlock &block, const std::array<Bool, 16> &transparent, const JzTexel &a,
+                             const JzTexel &b, Bool threeColor)
+{
+    U16 color0 = PackRGB565(a);
+    U16 color1 = PackRGB565(b);
+    if (threeColor ? color0 > color1 : color0 < color1) {
+        std::swap(color0, color1);
+    }
+
+    if (!threeColor && color0 == color1) {
+        JzColorFit fit = EvaluateColorEndpoints(block, transparent, color0, color1, false);
+        fit.indices.fill(0);
+        return fit;
+    }
+    return EvaluateColorEndpoints(block, transparent, color0, color1, threeColor);
+}
+
+/**
+ * @brief Encode the colour half of a BC1/BC3 block.
+ *
+ * @param allowTransparent Use BC1 three-colour mode for texels with alpha < 128.
+ */
+void EncodeColorBlock(const JzBlock &block, Bool allowTransparent, U8 *out)
+{
+    std::array<Bool, 16> transparent{};
+    std::array<Bool, 16> opaque{};
+    Bool                 anyTransparent = false;
+    Bool                 anyOpaque      = false;
+    for (Size i = 0; i < 16; ++i) {
+        transparent[i] = allowTransparent && block[i][3] < 128.0f;
+        opaque[i]      = !transparent[i];
+        anyTransparent = anyTransparent || transparent[i];
+        anyOpaque      = anyOpaque || opaque[i];
+    }
+
+    JzColorFit best;
+    if (!anyOpaque) {
+        best = EvaluateColorEndpoints(block, transparent, 0, 0, true);
+    } else {
+        JzTexel low;
+        JzTexel high;
+        ComputeEndpoints(block, opaque, 3, low, high);
+        best = FitColorEndpoints(block, transparent, high, low, anyTransparent);
+
+        // One least-squares refinement pass with the indices found above
+        std::array<F32, 16> weights{};
+        for (Size i = 0; i < 16; ++i) {
+            switch (best.indices[i]) {
+                case 0:
+                    weights[i] = 1.0f;
+                    break;
+                case 1:
+                    weights[i] = 0.0f;
+                    break;
+                case 2:
+                    weights[i] = anyTransparent ? 0.5f : 2.0f / 3.0f;
+                    break;
+                default:
+                    weights[i] = 1.0f / 3.0f;
+                    break;
+            }
+        }
+
+        JzTexel refinedA = high;
+        JzTexel refinedB = low;
+        if (FitEndpoints(block, opaque, weights, 3, refinedA, refinedB)) {
+            const JzColorFit refined = FitColorEndpoints(block, transparent, refinedA, refinedB, anyTransparent);
+            if (refined.error < best.error) {
+                best = refined;
+            }
+        }
+    }
+
+    out[0] = static_cast<U8>(best.color0 & 0xFF);
+    out[1] = static_cast<U8>(best.color0 >> 8);
+    out[2] = static_cast<U8>(best.color1 & 0xFF);
+    out[3] = static_cast<U8>(best.color1 >> 8);
+
+    U32 bits = 0;
+    for (Size i = 0; i < 16; ++i) {
+        bits |= static_cast<U32>(best.indices[i]) << (i * 2);
+    }
+    for (Size i = 0; i < 4; ++i) {
+        out[4 + i] = static_cast<U8>(bits >> (i * 8));
+    }
+}
+
+// ---------------------------------------------------------------------------
+// BC4 single-channel block (also the alpha half of BC3 and both halves of BC5)
+// ---------------------------------------------------------------------------
+
+void EncodeChannelBlock(const JzBlock &block, U32 channel, U8 *out)
+{
+    F32 minValue = 255.0f;
+    F32 maxValue = 0.0f;
+    for (const auto &texel : block) {
+        minValue = std::min(minValue, texel[channel]);
+        maxValue = std::max(maxValue, texel[channel]);
+    }
+
+    const I32 red0 = static_cast<I32>(std::lround(maxValue));
+    const I32 red1 = static_cast<I32>(std::lround(minValue));
+    out[0]         = static_cast<U8>(red0);
+    out[1]         = static_cast<U8>(red1);
+
+    // red0 > red1 selects the eight-value mode; equal endpoints decode index 0 as red0
+    std::array<I32, 8> palette{};
+    palette[0] = red0;
+    palette[1] = red1;
+    for (I32 k = 2; k < 8; ++k) {
+        palette[k] = ((8 - k) * red0 + (k - 1) * red1) / 7;
+    }
+
+    U64 bits = 0;
+    for (Size i = 0; i < 16; ++i) {
+        U64 index = 0;
+        if (red0 != red1) {
+            F32 best = std::numeric_limits<F32>::max();
+            for (U64 k = 0; k < 8; ++k) {
+                const F32 error = std::abs(block[i][channel] - static_cast<F32>(palette[k]));
+                if (error < best) {
+                    best  = error;
+                    index = k;
+                }
+            }
+        }
+        bits |= index << (i * 3);
+    }
+    for (Size i = 0; i < 6; ++i) {
+        out[2 + i] = static_cast<U8>(bits >> (i * 8));
+    }
+}
+
+// ---------------------------------------------------------------------------
+// BC7 mode 6: one subset, RGBA 7.7.7.7 endpoints with a p-bit each, 4-bit indices
+// ---------------------------------------------------------------------------
+
+constexpr std::array<I32, 16> kBC7Weights4 = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+/**
+ * @brief Endpoint quantized to 7 bits per channel plus a shared p-bit.
+ */
+struct JzBC7Endpoint {
+    std::array<I32, 4> q{};
+    I32                pbit = 0;
+
+    I32 Value(Size channel) const
+    {
+        return (q[channel] << 1) | pbit;
+    }
+};
+
+JzBC7Endpoint QuantizeBC7Endpoint(const JzTexel &endpoint)
+{
+    JzBC7Endpoint best;
+    F32           bestError = std::numeric_limits<F32>::max();
+    for (I32 pbit = 0; pbit < 2; ++pbit) {
+        JzBC7Endpoint candidate;
+        candidate.pbit = pbit;
+        F32 error      = 0.0f;
+        for (Size c = 0; c < 4; ++c) {
+            candidate.q[c] = std::clamp(static_cast<I32>(std::lround((endpoint[c] - pbit) / 2.0f)), 0, 127);
+            const F32 d    = endpoint[c] - static_cast<F32>(candidate.Value(c));
+            error += d * d;
+        }
+        if (error < bestError) {
+            bestError = error;
+            best      = candidate;
+        }
+    }
+    return best;
+}
+
+struct JzBC7Fit {
+    JzBC7Endpoint      e0;
+    JzBC7Endpoint      e1;
+    std::array<U8, 16> indices = {};
+    F32                error   = std::numeric_limits<F32>::max();
+};
+
+JzBC7Fit EvaluateBC7Endpoints(const JzBlock &block, const JzBC7Endpoint &e0, const JzBC7Endpoint &e1)
+{
+    std::array<std::array<I32, 4>, 16> palette{};
+    for (Size k = 0; k < 16; ++k) {
+        for (Size c = 0; c < 4; ++c) {
+            palette[k][c] = ((64 - kBC7Weights4[k]) * e0.Value(c) + kBC7Weights4[k] * e1.Value(c) + 32) >> 6;
+        }
+    }
+
+    JzBC7Fit fit;
+    fit.e0    = e0;
+    fit.e1    = e1;
+    fit.error = 0.0f;
+    for (Size i = 0; i < 16; ++i) {
+        F32 best = std::numeric_limits<F32>::max();
+        for (Size k = 0; k < 16; ++k) {
+            F32 error = 0.0f;
+            for (Size c = 0; c < 4; ++c) {
+                const F32 d = block[i][c] - static_cast<F32>(palette[k][c]);
+                error += d * d;
+            }
+            if (error < best) {
+                best           = error;
+                fit.indices[i] = static_cast<U8>(k);
+            }
+        }
+        fit.error += best;
+    }
+    return fit;
+}
+
+/**
+ * @brief Little-endian bit writer for one 128-bit block.
+ */
+class JzBlockBitWriter {
+public:
+    explicit JzBlockBitWriter(U8 *out) :
+        m_out(out)
+    {
+        std::fill(m_out, m_out + 16, U8{0});
+    }
+
+    void Write(U32 value, U32 bitCount)
+    {
+        for (U32 bit = 0; bit < bitCount; ++bit, ++m_position) {
+            if ((value >> bit) & 1u) {
+                m_out[m_position / 8] |= static_cast<U8>(1u << (m_position % 8));
+            }
+        }
+    }
+
+private:
+    U8 *m_out;
+    U32 m_position = 0;
+};
+
+void EncodeBC7Block(const JzBlock &block, U8 *out)
+{
+    std::array<Bool, 16> all;
+    all.fill(true);
+
+    JzTexel low;
+    JzTexel high;
+    ComputeEndpoints(block, all, 4, low, high);
+
+    JzBC7Fit best = EvaluateBC7Endpoints(block, QuantizeBC7Endpoint(low), QuantizeBC7Endpoint(high));
+
+    std::array<F32, 16> weights{};
+    for (Size i = 0; i < 16; ++i) {
+        weights[i] = 1.0f - static_cast<F32>(kBC7Weights4[best.indices[i]]) / 64.0f;
+    }
+    JzTexel refinedLow  = low;
+    JzTexel refinedHigh = high;
+    if (FitEndpoints(block, all, weights, 4, refinedLow, refinedHigh)) {
+        const JzBC7Fit refined =
+            EvaluateBC7Endpoints(block, QuantizeBC7Endpoint(refinedLow), QuantizeBC7Endpoint(refinedHigh));
+        if (refined.error < best.error) {
+            best = refined;
+        }
+    }
+
+    // The anchor index is stored with 3 bits, so its top bit has to be zero
+    if (best.indices[0] >= 8) {
+        std::swap(best.e0, best.e1);
+        for (auto &index : best.indices) {
+            index = static_cast<U8>(15 - index);
+        }
+    }
+
+    JzBlockBitWriter writer(out);
+    writer.Write(1u << 6, 7);
+    for (Size c = 0; c < 4; ++c) {
+        writer.Write(static_cast<U32>(best.e0.q[c]), 7);
+        writer.Write(static_cast<U32>(best.e1.q[c]), 7);
+    }
+    writer.Write(static_cast<U32>(best.e0.pbit), 1);
+    writer.Write(static_cast<U32>(best.e1.pbit), 1);
+    writer.Write(best.indices[0], 3);
+    for (Size i = 1; i < 16; ++i) {
+        writer.Write(best.indices[i], 4);
+    }
+}
+
+} // namespace
+
+Bool JzTextureCompressor::CanEncode(JzETextureResourceFormat format)
+{
+    switch (format) {
+        case JzETextureResourceFormat::RGBA8:
+        case JzETextureResourceFormat::BC1:
+        case JzETextureResourceFormat::BC3:
+        case JzETextureResourceFormat::BC4:
+        case JzETextureResourceFormat::BC5:
+        case JzETextureResourceFormat::BC7:
+            return true;
+        default:
+            return false;
+    }
+}
+
+JzETextureResourceFormat JzTextureCompressor::ChooseFormat(const U8 *rgba, U32 width, U32 height)
+{
+    const Size texelCount = static_cast<Size>(width) * height;
+    for (Size i = 0; i < texelCount; ++i) {
+        if (rgba[i * 4 + 3] != 255) {
+            return JzETextureResourceFormat::BC7;
+        }
+    }
+    return JzETextureResourceFormat::BC1;
+}
+
+std::vector<std::vector<U8>> JzTextureCompressor::BuildMipChain(const U8 *rgba, U32 width, U32 height)
+{
+    std::vector<std::vector<U8>> levels;
+    if (!rgba || width == 0 || height == 0) {
+        return levels;
+    }
+
+    const U32 levelCount = GetTextureMipCount(width, height);
+    levels.reserve(levelCount);
+    levels.emplace_back(rgba, rgba + static_cast<Size>(width) * height * 4);
+
+    U32 srcWidth  = width;
+    U32 srcHeight = height;
+    for (U32 level = 1; level < levelCount; ++level) {
+        const U32  dstWidth  = std::max<U32>(1, srcWidth / 2);
+        const U32  dstHeight = std::max<U32>(1, srcHeight / 2);
+        const auto &src      = levels.back();
+
+        std::vector<U8> dst(static_cast<Size>(dstWidth) * dstHeight * 4);
+        for (U32 y = 0; y < dstHeight; ++y) {
+            const U32 y0 = std::min(y * 2, srcHeight - 1);
+            const U32 y1 = std::min(y * 2 + 1, srcHeight - 1);
+            for (U32 x = 0; x < dstWidth; ++x) {
+                const U32 x0 = std::min(x * 2, srcWidth - 1);
+                const U32 x1 = std::min(x * 2 + 1, srcWidth - 1);
+                for (U32 c = 0; c < 4; ++c) {
+                    const U32 sum = src[(static_cast<Size>(y0) * srcWidth + x0) * 4 + c] +
+                                    src[(static_cast<Size>(y0) * srcWidth + x1) * 4 + c] +
+                                    src[(static_cast<Size>(y1) * srcWidth + x0) * 4 + c] +
+                                    src[(static_cast<Size>(y1) * srcWidth + x1) * 4 + c];
+                    dst[(static_cast<Size>(y) * dstWidth + x) * 4 + c] = static_cast<U8>((sum + 2) / 4);
+                }
+            }
+        }
+
+        levels.push_back(std::move(dst));
+        srcWidth  = dstWidth;
+        srcHeight = dstHeight;
+    }
+    return levels;
+}
+
+std::vector<U8> JzTextureCompressor::Encode(const U8 *rgba, U32 width, U32 height, JzETextureResourceFormat format)
+{
+    if (!rgba || width == 0 || height == 0 || !CanEncode(format)) {
+        return {};
+    }
+
+    if (format == JzETextureResourceFormat::RGBA8) {
+        return std::vector<U8>(rgba, rgba + static_cast<Size>(width) * height * 4);
+    }
+
+    const U32  blocksX   = (width + 3) / 4;
+    const U32  blocksY   = (height + 3) / 4;
+    const Size blockSize = GetTextureFormatBlockSize(format);
+
+    std::vector<U8> out(static_cast<Size>(blocksX) * blocksY * blockSize);
+    for (U32 by = 0; by < blocksY; ++by) {
+        for (U32 bx = 0; bx < blocksX; ++bx) {
+            const JzBlock block = ReadBlock(rgba, width, height, bx, by);
+            U8           *dst   = out.data() + (static_cast<Size>(by) * blocksX + bx) * blockSize;
+            switch (format) {
+                case JzETextureResourceFormat::BC1:
+                    EncodeColorBlock(block, true, dst);
+                    break;
+                case JzETextureResourceFormat::BC3:
+                    EncodeChannelBlock(block, 3, dst);
+                    EncodeColorBlock(block, false, dst + 8);
+                    break;
+                case JzETextureResourceFormat::BC4:
+                    EncodeChannelBlock(block, 0, dst);
+                    break;
+                case JzETextureResourceFormat::BC5:
+                    EncodeChannelBlock(block, 0, dst);
+                    EncodeChannelBlock(block, 1, dst + 8);
+                    break;
+                case JzETextureResourceFormat::BC7:
+                    EncodeBC7Block(block, dst);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+    return out;
+}
+
+JzKtx2Image JzTextureCompressor::Cook(const U8 *rgba, U32 width, U32 height, JzETextureResourceFormat format,
+                                      Bool generateMips)
+{
+    JzKtx2Image image;
+    if (!rgba || width == 0 || height == 0) {
+        return image;
+    }
+
+    if (format == JzETextureResourceFormat::Unknown) {
+        format = ChooseFormat(rgba, width, height);
+    }
+    if (!CanEncode(format)) {
+        return image;
+    }
+
+    image.format = format;
+    image.width  = width;
+    image.height = height;
+
+    std::vector<std::vector<U8>> sourceLevels;
+    if (generateMips) {
+        sourceLevels = BuildMipChain(rgba, width, height);
+    } else {
+        sourceLevels.emplace_back(rgba, rgba + static_cast<Size>(width) * height * 4);
+    }
+
+    image.levels.reserve(sourceLevels.size());
+    for (Size level = 0; level < sourceLevels.size(); ++level) {
+        const U32 levelWidth  = std::max<U32>(1, width >> level);
+        const U32 levelHeight = std::max<U32>(1, height >> level);
+        image.levels.push_back(Encode(sourceLevels[level].data(), levelWidth, levelHeight, format));
+    }
+    return image;
+}
+
+Bool JzTextureCompressor::CookFile(const std::filesystem::path &source, const std::filesystem::path &destination,
+                                   JzETextureResourceFormat format, Bool generateMips)
+{
+    I32      width    = 0;
+    I32      height   = 0;
+    I32      channels = 0;
+    stbi_uc *pixels   = stbi_load(source.string().c_str(), &width, &height, &channels, STBI_rgb_alpha);
+    if (!pixels) {
+        JzRE_LOG_ERROR("JzTextureCompressor: failed to load '{}'", source.string());
+        return false;
+    }
+
+    const auto image = Cook(pixels, static_cast<U32>(width), static_cast<U32>(height), format, generateMips);
+    stbi_image_free(pixels);
+
+    if (image.levels.empty() || !JzKtx2::Save(destination, image)) {
+        JzRE_LOG_ERROR("JzTextureCompressor: failed to write '{}'", destination.string());
+        return false;
+    }
+    return true;
+}
+
+} // namespace JzRE
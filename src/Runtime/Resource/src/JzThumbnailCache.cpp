@@ -0,0 +1,531 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include "JzRE/Runtime/Resource/JzThumbnailCache.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <thread>
+
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <stb_image.h>
+
+#include "JzRE/Runtime/Core/JzFileSystemUtils.h"
+#include "JzRE/Runtime/Core/JzLogger.h"
+
+namespace JzRE {
+
+namespace {
+
+namespace fs = std::filesystem;
+
+constexpr char kThumbnailMagic[4] = {'J', 'Z', 'T', 'H'};
+constexpr U32  kThumbnailVersion  = 1; ///< Bump when generated images change
+
+struct JzThumbnailFileHeader {
+    char magic[4];
+    U32  version;
+    U32  width;
+    U32  height;
+};
+
+U8 ToByte(F32 value)
+{
+    return static_cast<U8>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+JzThumbnail MakeBlank(U32 size)
+{
+    JzThumbnail thumbnail;
+    thumbnail.width  = size;
+    thumbnail.height = size;
+    thumbnail.pixels.assign(static_cast<Size>(size) * size * 4, 0);
+    return thumbnail;
+}
+
+Bool LoadModelGeometry(const fs::path &path, std::vector<JzVec3> &positions, std::vector<U32> &indices)
+{
+    Assimp::Importer importer;
+    const aiScene   *scene = importer.ReadFile(path.string(), aiProcess_Triangulate | aiProcess_PreTransformVertices);
+    if (!scene || !scene->mRootNode) {
+        return false;
+    }
+
+    for (U32 m = 0; m < scene->mNumMeshes; ++m) {
+        const aiMesh *mesh = scene->mMeshes[m];
+        const U32     base = static_cast<U32>(positions.size());
+
+        for (U32 v = 0; v < mesh->mNumVertices; ++v) {
+            positions.emplace_back(mesh->mVertices[v].x, mesh->mVertices[v].y, mesh->mVertices[v].z);
+        }
+        for (U32 f = 0; f < mesh->mNumFaces; ++f) {
+            const aiFace &face = mesh->mFaces[f];
+            if (face.mNumIndices == 3) {
+                indices.push_back(base + face.mIndices[0]);
+                indices.push_back(base + face.mIndices[1]);
+                indices.push_back(base + face.mIndices[2]);
+            }
+        }
+    }
+    return !indices.empty();
+}
+
+/**
+ * @brief Material files have no loader yet; use the first three numbers after "diffuse" if present
+ */
+JzVec3 ReadMaterialColor(const fs::path &path)
+{
+    std::ifstream stream(path, std::ios::binary);
+    String        text((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    std::transform(text.begin(), text.end(), text.begin(), [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+
+    JzVec3     color(0.7f, 0.7f, 0.7f);
+    const auto key = text.find("diffuse");
+    if (key == String::npos) {
+        return color;
+    }
+
+    F32         channels[3] = {};
+    U32         found       = 0;
+    const char *cursor      = text.c_str() + key;
+    const char *end         = text.c_str() + std::min(text.size(), key + 256);
+    while (found < 3 && cursor < end) {
+        if (std::isdigit(static_cast<unsigned char>(*cursor)) || *cursor == '.') {
+            char *next        = nullptr;
+            channels[found++] = std::strtof(cursor, &next);
+            cursor            = next;
+        } else {
+            ++cursor;
+        }
+    }
+    if (found < 3) {
+        return color;
+    }
+
+    // Colors stored as 0-255 bytes
+    const F32 scale = std::max({channels[0], channels[1], channels[2]}) > 1.0f ? 1.0f / 255.0f : 1.0f;
+    return JzVec3(channels[0] * scale, channels[1] * scale, channels[2] * scale);
+}
+
+} // namespace
+
+JzThumbnailCache::JzThumbnailCache(const JzThumbnailCacheConfig &config) :
+    m_config(config),
+    m_workers(std::make_unique<JzThreadPool>(std::max<Size>(config.workerCount, 1)))
+{
+    if (m_config.size == 0) {
+        m_config.size = 64;
+    }
+}
+
+JzThumbnailCache::~JzThumbnailCache()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_requests.clear();
+    }
+    m_workers.reset();
+}
+
+Bool JzThumbnailCache::IsSupported(const std::filesystem::path &path)
+{
+    switch (JzFileSystemUtils::GetFileType(path.string())) {
+        case JzEFileType::TEXTURE:
+        case JzEFileType::MODEL:
+        case JzEFileType::MATERIAL:
+            return true;
+        default:
+            return false;
+    }
+}
+
+Bool JzThumbnailCache::Request(const std::filesystem::path &path)
+{
+    if (!IsSupported(path)) {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_queued.insert(path.string()).second) {
+            return true;
+        }
+        m_requests.push_back(path);
+    }
+
+    m_workers->Submit([this]() { ProcessNext(); });
+    return true;
+}
+
+Bool JzThumbnailCache::Poll(JzThumbnailResult &outResult)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_results.empty()) {
+        return false;
+    }
+
+    outResult = std::move(m_results.front());
+    m_results.pop_front();
+    return true;
+}
+
+Size JzThumbnailCache::GetPendingCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_queued.size();
+}
+
+U64 JzThumbnailCache::HashFile(const std::filesystem::path &path)
+{
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream) {
+        return 0;
+    }
+
+    U64               hash = 14695981039346656037ull;
+    std::vector<char> buffer(64 * 1024);
+    while (stream) {
+        stream.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        const auto count = static_cast<Size>(stream.gcount());
+        for (Size i = 0; i < count; ++i) {
+            hash ^= static_cast<U8>(buffer[i]);
+            hash *= 1099511628211ull;
+        }
+    }
+    return hash;
+}
+
+JzThumbnail JzThumbnailCache::DownscaleImage(const U8 *rgba, U32 width, U32 height, U32 size)
+{
+    JzThumbnail thumbnail = MakeBlank(size);
+    if (!rgba || width == 0 || height == 0) {
+        return thumbnail;
+    }
+
+    // Fit the longer side, never enlarge
+    const F32 scale     = std::min(1.0f, static_cast<F32>(size) / static_cast<F32>(std::max(width, height)));
+    const U32 outWidth  = std::max(1u, static_cast<U32>(width * scale));
+    const U32 outHeight = std::max(1u, static_cast<U32>(height * scale));
+    const U32 offsetX   = (size - outWidth) / 2;
+    const U32 offsetY   = (size - outHeight) / 2;
+
+    for (U32 y = 0; y < outHeight; ++y) {
+        const U32 srcY0 = static_cast<U32>(static_cast<U64>(y) * height / outHeight);
+        const U32 srcY1 = std::max(srcY0 + 1, static_cast<U32>(static_cast<U64>(y + 1) * height / outHeight));
+
+        for (U32 x = 0; x < outWidth; ++x) {
+            const U32 srcX0 = static_cast<U32>(static_cast<U64>(x) * width / outWidth);
+            const U32 srcX1 = std::max(srcX0 + 1, static_cast<U32>(static_cast<U64>(x + 1) * width / outWidth));
+
+            U64 sum[4] = {};
+            for (U32 sy = srcY0; sy < srcY1; ++sy) {
+                const U8 *row = rgba + (static_cast<Size>(sy) * width + srcX0) * 4;
+                for (U32 sx = srcX0; sx < srcX1; ++sx, row += 4) {
+                    sum[0] += row[0];
+                    sum[1] += row[1];
+                    sum[2] += row[2];
+                    sum[3] += row[3];
+                }
+            }
+
+            const U64 count = static_cast<U64>(srcX1 - srcX0) * (srcY1 - srcY0);
+            U8       *out   = thumbnail.pixels.data() + (static_cast<Size>(offsetY + y) * size + offsetX + x) * 4;
+            for (U32 c = 0; c < 4; ++c) {
+                out[c] = static_cast<U8>((sum[c] + count / 2) / count);
+            }
+        }
+    }
+    return thumbnail;
+}
+
+JzThumbnail JzThumbnailCache::RenderMesh(const std::vector<JzVec3> &positions, const std::vector<U32> &indices, U32 size)
+{
+    JzThumbnail thumbnail = MakeBlank(size);
+    if (positions.empty() || indices.size() < 3) {
+        return thumbnail;
+    }
+
+    JzVec3 boundsMin = positions.front();
+    JzVec3 boundsMax = positions.front();
+    for (const auto &position : positions) {
+        for (U32 axis = 0; axis < 3; ++axis) {
+            boundsMin[axis] = std::min(boundsMin[axis], position[axis]);
+            boundsMax[axis] = std::max(boundsMax[axis], position[axis]);
+        }
+    }
+    const JzVec3 center = (boundsMin + boundsMax) * 0.5f;
+    const F32    radius = std::max((boundsMax - boundsMin).Length() * 0.5f, 1e-6f);
+
+    // Orthographic camera looking down at the front-right corner
+    const JzVec3 forward = JzVec3(-1.0f, -0.8f, -1.0f).Normalized();
+    const JzVec3 right   = forward.Cross(JzVec3(0.0f, 1.0f, 0.0f)).Normalized();
+    const JzVec3 up      = right.Cross(forward);
+    const JzVec3 light   = (forward * -1.0f + right * -0.4f + up * 0.6f).Normalized();
+
+    const F32 half = static_cast<F32>(size) * 0.5f;
+    const F32 zoom = half * 0.95f / radius;
+
+    std::vector<JzVec3> projected(positions.size());
+    for (Size i = 0; i < positions.size(); ++i) {
+        const JzVec3 local = positions[i] - center;
+        projected[i]       = JzVec3(half + local.Dot(right) * zoom, half - local.Dot(up) * zoom, local.Dot(forward));
+    }
+
+    std::vector<F32> depth(static_cast<Size>(size) * size, std::numeric_limits<F32>::max());
+
+    for (Size t = 0; t + 2 < indices.size(); t += 3) {
+        if (indices[t] >= positions.size() || indices[t + 1] >= positions.size() || indices[t + 2] >= positions.size()) {
+            continue;
+        }
+
+        const JzVec3 &a = projected[indices[t]];
+        const JzVec3 &b = projected[indices[t + 1]];
+        const JzVec3 &c = projected[indices[t + 2]];
+
+        const F32 area = (b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]);
+        if (std::abs(area) < 1e-8f) {
+            continue;
+        }
+
+        // Both faces are lit so meshes with either winding look the same
+        const JzVec3 normal       = (positions[indices[t + 1]] - positions[indices[t]]).Cross(positions[indices[t + 2]] - positions[indices[t]]);
+        const F32    normalLength = normal.Length();
+        const F32    lambert      = normalLength > 0.0f ? std::abs(normal.Dot(light)) / normalLength : 0.0f;
+        const F32    shade        = 0.25f + 0.75f * lambert;
+        const U8     red          = ToByte(0.72f * shade);
+        const U8     green        = ToByte(0.76f * shade);
+        const U8     blue         = ToByte(0.82f * shade);
+
+        const I32 minX = std::max(0, static_cast<I32>(std::floor(std::min({a[0], b[0], c[0]}))));
+        const I32 maxX = std::min(static_cast<I32>(size) - 1, static_cast<I32>(std::ceil(std::max({a[0], b[0], c[0]}))));
+        const I32 minY = std::max(0, static_cast<I32>(std::floor(std::min({a[1], b[1], c[1]}))));
+        const I32 maxY = std::min(static_cast<I32>(size) - 1, static_cast<I32>(std::ceil(std::max({a[1], b[1], c[1]}))));
+
+        for (I32 y = minY; y <= maxY; ++y) {
+            const F32 py = static_cast<F32>(y) + 0.5f;
+            for (I32 x = minX; x <= maxX; ++x) {
+                const F32 px = static_cast<F32>(x) + 0.5f;
+                const F32 w0 = ((b[0] - px) * (c[1] - py) - (b[1] - py) * (c[0] - px)) / area;
+                const F32 w1 = ((c[0] - px) * (a[1] - py) - (c[1] - py) * (a[0] - px)) / area;
+                const F32 w2 = 1.0f - w0 - w1;
+                if (w0 < 0.0f || w1 < 0.0f || w2 < 0.0f) {
+                    continue;
+                }
+
+                const F32  z     = w0 * a[2] + w1 * b[2] + w2 * c[2];
+                const Size pixel = static_cast<Size>(y) * size + x;
+                if (z >= depth[pixel]) {
+                    continue;
+                }
+                depth[pixel] = z;
+
+                U8 *out = thumbnail.pixels.data() + pixel * 4;
+                out[0]  = red;
+                out[1]  = green;
+                out[2]  = blue;
+                out[3]  = 255;
+            }
+        }
+    }
+    return thumbnail;
+}
+
+JzThumbnail JzThumbnailCache::RenderSwatch(const JzVec3 &color, U32 size)
+{
+    JzThumbnail thumbnail = MakeBlank(size);
+
+    const JzVec3 light   = JzVec3(-0.4f, 0.5f, 0.75f).Normalized();
+    const JzVec3 halfway = (light + JzVec3(0.0f, 0.0f, 1.0f)).Normalized();
+    const F32    radius  = static_cast<F32>(size) * 0.5f - 1.0f;
+    const F32    center  = static_cast<F32>(size) * 0.5f;
+
+    for (U32 y = 0; y < size; ++y) {
+        for (U32 x = 0; x < size; ++x) {
+            const F32 nx       = (static_cast<F32>(x) + 0.5f - center) / radius;
+            const F32 ny       = (center - static_cast<F32>(y) - 0.5f) / radius;
+            const F32 distance = std::sqrt(nx * nx + ny * ny);
+            if (distance > 1.0f + 1.0f / radius) {
+                continue;
+            }
+
+            const F32    nz       = std::sqrt(std::max(0.0f, 1.0f - nx * nx - ny * ny));
+            const JzVec3 normal   = JzVec3(nx, ny, nz).Normalized();
+            const F32    diffuse  = std::max(0.0f, normal.Dot(light));
+            const F32    specular = 0.4f * std::pow(std::max(0.0f, normal.Dot(halfway)), 32.0f);
+
+            U8 *out = thumbnail.pixels.data() + (static_cast<Size>(y) * size + x) * 4;
+            out[0]  = ToByte(color[0] * (0.15f + 0.85f * diffuse) + specular);
+            out[1]  = ToByte(color[1] * (0.15f + 0.85f * diffuse) + specular);
+            out[2]  = ToByte(color[2] * (0.15f + 0.85f * diffuse) + specular);
+            out[3]  = ToByte((1.0f - distance) * radius + 0.5f); // One pixel of edge coverage
+        }
+    }
+    return thumbnail;
+}
+
+void JzThumbnailCache::ProcessNext()
+{
+    std::filesystem::path path;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_requests.empty()) {
+            return;
+        }
+        path = std::move(m_requests.back());
+        m_requests.pop_back();
+    }
+
+    JzThumbnailResult result;
+    result.path = path;
+    try {
+        result.succeeded = Generate(path, result.thumbnail);
+    } catch (const std::exception &e) {
+        JzRE_LOG_WARN("JzThumbnailCache: thumbnail for '{}' failed: {}", path.string(), e.what());
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queued.erase(path.string());
+    m_results.push_back(std::move(result));
+}
+
+Bool JzThumbnailCache::Generate(const std::filesystem::path &path, JzThumbnail &outThumbnail)
+{
+    const U64 hash = GetContentHash(path);
+    if (hash == 0) {
+        return false;
+    }
+
+    fs::path cacheFile;
+    if (!m_config.cacheDirectory.empty()) {
+        char name[64];
+        std::snprintf(name, sizeof(name), "%016llx-%u.jzthumb", static_cast<unsigned long long>(hash), m_config.size);
+        cacheFile = m_config.cacheDirectory / name;
+
+        if (LoadCached(cacheFile, outThumbnail)) {
+            return true;
+        }
+    }
+
+    switch (JzFileSystemUtils::GetFileType(path.string())) {
+        case JzEFileType::TEXTURE: {
+            I32      width    = 0;
+            I32      height   = 0;
+            I32      channels = 0;
+            stbi_uc *pixels   = stbi_load(path.string().c_str(), &width, &height, &channels, STBI_rgb_alpha);
+            if (!pixels) {
+                return false;
+            }
+            outThumbnail = DownscaleImage(pixels, static_cast<U32>(width), static_cast<U32>(height), m_config.size);
+            stbi_image_free(pixels);
+            break;
+        }
+        case JzEFileType::MODEL: {
+            std::vector<JzVec3> positions;
+            std::vector<U32>    indices;
+            if (!LoadModelGeometry(path, positions, indices)) {
+                return false;
+            }
+            outThumbnail = RenderMesh(positions, indices, m_config.size);
+            break;
+        }
+        case JzEFileType::MATERIAL:
+            outThumbnail = RenderSwatch(ReadMaterialColor(path), m_config.size);
+            break;
+        default:
+            return false;
+    }
+
+    if (!cacheFile.empty()) {
+        StoreCached(cacheFile, outThumbnail);
+    }
+    return true;
+}
+
+U64 JzThumbnailCache::GetContentHash(const std::filesystem::path &path)
+{
+    std::error_code ec;
+    const auto      writeTime = fs::last_write_time(path, ec);
+    const auto      fileSize  = ec ? 0 : fs::file_size(path, ec);
+    if (ec) {
+        return 0;
+    }
+
+    const auto key = path.string();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto                        it = m_hashes.find(key);
+        if (it != m_hashes.end() && it->second.writeTime == writeTime && it->second.fileSize == fileSize) {
+            return it->second.hash;
+        }
+    }
+
+    const U64 hash = HashFile(path);
+    if (hash != 0) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_hashes[key] = {writeTime, fileSize, hash};
+    }
+    return hash;
+}
+
+Bool JzThumbnailCache::LoadCached(const std::filesystem::path &cacheFile, JzThumbnail &outThumbnail) const
+{
+    std::ifstream stream(cacheFile, std::ios::binary);
+    if (!stream) {
+        return false;
+    }
+
+    JzThumbnailFileHeader header{};
+    stream.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!stream || std::memcmp(header.magic, kThumbnailMagic, sizeof(kThumbnailMagic)) != 0 ||
+        header.version != kThumbnailVersion || header.width != m_config.size || header.height != m_config.size) {
+        return false;
+    }
+
+    outThumbnail.width  = header.width;
+    outThumbnail.height = header.height;
+    outThumbnail.pixels.resize(static_cast<Size>(header.width) * header.height * 4);
+    stream.read(reinterpret_cast<char *>(outThumbnail.pixels.data()), static_cast<std::streamsize>(outThumbnail.pixels.size()));
+    return static_cast<Size>(stream.gcount()) == outThumbnail.pixels.size();
+}
+
+void JzThumbnailCache::StoreCached(const std::filesystem::path &cacheFile, const JzThumbnail &thumbnail) const
+{
+    std::error_code ec;
+    fs::create_directories(cacheFile.parent_path(), ec);
+
+    // Files with equal content share a cache entry, so write privately and rename into place
+    auto temporary = cacheFile;
+    temporary += "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + ".tmp";
+    {
+        std::ofstream stream(temporary, std::ios::binary | std::ios::trunc);
+        if (!stream) {
+            return;
+        }
+
+        JzThumbnailFileHeader header{};
+        std::memcpy(header.magic, kThumbnailMagic, sizeof(kThumbnailMagic));
+        header.version = kThumbnailVersion;
+        header.width   = thumbnail.width;
+        header.height  = thumbnail.height;
+        stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        stream.write(reinterpret_cast<const char *>(thumbnail.pixels.data()), static_cast<std::streamsize>(thumbnail.pixels.size()));
+    }
+
+    fs::rename(temporary, cacheFile, ec);
+    if (ec) {
+        fs::remove(temporary, ec);
+        JzRE_LOG_WARN("JzThumbnailCache: cannot write '{}'", cacheFile.string());
+    }
+}
+
+} // namespace JzRE
@@ -0,0 +1,65 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/CLI/JzBenchReport.h"
+
+TEST(JzBenchReport, ComputesNearestRankPercentiles)
+{
+    std::vector<JzRE::F64> samples;
+    for (int i = 100; i >= 1; --i) {
+        samples.push_back(static_cast<JzRE::F64>(i));
+    }
+
+    const auto stats = JzRE::JzBenchReport::ComputeStats(samples);
+    EXPECT_EQ(stats.samples, 100U);
+    EXPECT_DOUBLE_EQ(stats.mean, 50.5);
+    EXPECT_DOUBLE_EQ(stats.min, 1.0);
+    EXPECT_DOUBLE_EQ(stats.p50, 50.0);
+    EXPECT_DOUBLE_EQ(stats.p95, 95.0);
+    EXPECT_DOUBLE_EQ(stats.p99, 99.0);
+    EXPECT_DOUBLE_EQ(stats.max, 100.0);
+}
+
+TEST(JzBenchReport, EmptySeriesIsAllZero)
+{
+    const auto stats = JzRE::JzBenchReport::ComputeStats({});
+    EXPECT_EQ(stats.samples, 0U);
+    EXPECT_DOUBLE_EQ(stats.p99, 0.0);
+}
+
+TEST(JzBenchReport, CompareReportsOnlyMetricsBeyondTolerance)
+{
+    const JzRE::JzBenchMetrics baseline = {
+        {"frameTimeMs.p50", 10.0},
+        {"frameTimeMs.p95", 12.0},
+        {"peakMemoryMB", 200.0},
+        {"systemTimeMs.Removed.p50", 1.0},
+    };
+    const JzRE::JzBenchMetrics current = {
+        {"frameTimeMs.p50", 10.5},
+        {"frameTimeMs.p95", 14.0},
+        {"peakMemoryMB", 150.0},
+        {"systemTimeMs.Added.p50", 3.0},
+    };
+
+    const auto regressions = JzRE::JzBenchReport::Compare(baseline, current, 0.1);
+    ASSERT_EQ(regressions.size(), 1U);
+    EXPECT_EQ(regressions[0].metric, "frameTimeMs.p95");
+    EXPECT_DOUBLE_EQ(regressions[0].baseline, 12.0);
+    EXPECT_DOUBLE_EQ(regressions[0].current, 14.0);
+}
+
+TEST(JzBenchReport, AbsoluteSlackIgnoresNearZeroNoise)
+{
+    const JzRE::JzBenchMetrics baseline = {{"systemTimeMs.Input.p50", 0.01}};
+    const JzRE::JzBenchMetrics current  = {{"systemTimeMs.Input.p50", 0.03}};
+
+    EXPECT_TRUE(JzRE::JzBenchReport::Compare(baseline, current, 0.1).empty());
+    EXPECT_EQ(JzRE::JzBenchReport::Compare(baseline, current, 0.1, 0.0).size(), 1U);
+}
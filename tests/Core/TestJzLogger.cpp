@@ -0,0 +1,273 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+// Strip trace calls in this file only, to test compile-time filtering
+#define JzRE_LOG_ACTIVE_LEVEL JzRE_LOG_LEVEL_DEBUG
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <latch>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Core/JzLogger.h"
+
+using namespace JzRE;
+
+namespace {
+
+struct JzReceivedMessage {
+    String      text; ///< Message without the timestamp and level prefix
+    JzELogLevel level;
+};
+
+class JzLoggerTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        auto &logger = JzLogger::GetInstance();
+        logger.SetConsoleOutput(false);
+        logger.SetLevel(JzELogLevel::Trace);
+        logger.Flush();
+        logger.SetLogMessageCallback([this](const JzLogMessage &message) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_messages.push_back({StripPrefix(message.message), message.level});
+        });
+    }
+
+    void TearDown() override
+    {
+        auto &logger = JzLogger::GetInstance();
+        logger.Flush();
+        logger.ClearLogMessageCallback();
+        logger.SetLevel(JzELogLevel::Info);
+        logger.SetConsoleOutput(true);
+    }
+
+    std::vector<JzReceivedMessage> Messages()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_messages;
+    }
+
+    std::vector<String> Texts()
+    {
+        std::vector<String> texts;
+        for (const auto &message : Messages()) {
+            texts.push_back(message.text);
+        }
+        return texts;
+    }
+
+private:
+    static String StripPrefix(const String &formatted)
+    {
+        // "[date time] [level] message\n"
+        String     text  = formatted;
+        const Size level = text.find("] [");
+        if (level != String::npos) {
+            const Size end = text.find("] ", level + 3);
+            if (end != String::npos) {
+                text.erase(0, end + 2);
+            }
+        }
+        while (!text.empty() && (text.back() == '\n' || text.back() == '\r')) {
+            text.pop_back();
+        }
+        return text;
+    }
+
+    std::mutex                     m_mutex;
+    std::vector<JzReceivedMessage> m_messages;
+};
+
+} // namespace
+
+TEST_F(JzLoggerTest, CallbackReceivesFormattedMessageAndLevel)
+{
+    JzRE_LOG_WARN("value {} and {}", 42, "text");
+    JzLogger::GetInstance().Flush();
+
+    const auto messages = Messages();
+    ASSERT_EQ(messages.size(), 1u);
+    EXPECT_EQ(messages[0].text, "value 42 and text");
+    EXPECT_EQ(messages[0].level, JzELogLevel::Warning);
+}
+
+TEST_F(JzLoggerTest, CompileTimeFilterSkipsArguments)
+{
+    I32 evaluated = 0;
+    JzRE_LOG_TRACE("trace {}", ++evaluated);
+    EXPECT_EQ(evaluated, 0);
+
+    JzRE_LOG_DEBUG("debug {}", ++evaluated);
+    EXPECT_EQ(evaluated, 1);
+
+    JzLogger::GetInstance().Flush();
+    EXPECT_EQ(Texts(), std::vector<String>{"debug 1"});
+}
+
+TEST_F(JzLoggerTest, RuntimeLevelSkipsArguments)
+{
+    auto &logger = JzLogger::GetInstance();
+    logger.SetLevel(JzELogLevel::Warning);
+
+    I32 evaluated = 0;
+    JzRE_LOG_INFO("info {}", ++evaluated);
+    EXPECT_EQ(evaluated, 0);
+    JzRE_LOG_ERROR("error {}", ++evaluated);
+    EXPECT_EQ(evaluated, 1);
+
+    logger.SetLevel(JzELogLevel::Info);
+    JzRE_LOG_INFO("info {}", ++evaluated);
+
+    logger.Flush();
+    EXPECT_EQ(Texts(), (std::vector<String>{"error 1", "info 2"}));
+}
+
+TEST_F(JzLoggerTest, DeferredStringsOutliveCallerBuffers)
+{
+    {
+        String text = "owned string";
+        char   buffer[32];
+        std::strcpy(buffer, "char buffer");
+        std::string_view view = text;
+
+        JzRE_LOG_INFO("{} / {} / {} / {}", text, buffer, view, 7.5);
+
+        // Clobber everything the record could still point at
+        text.assign(text.size(), 'X');
+        std::memset(buffer, 'Y', sizeof(buffer) - 1);
+    }
+
+    JzLogger::GetInstance().Flush();
+    EXPECT_EQ(Texts(), std::vector<String>{"owned string / char buffer / owned string / 7.5"});
+}
+
+TEST_F(JzLoggerTest, RingWrapAndPaddingKeepEveryRecordInOrder)
+{
+    // Uneven record sizes make the ring wrap mid-record and insert padding
+    constexpr U32 kRecordCount = 3000;
+
+    std::vector<String> expected;
+    for (U32 index = 0; index < kRecordCount; ++index) {
+        const String payload(static_cast<Size>((index * 37) % 1500), static_cast<char>('a' + index % 26));
+        JzRE_LOG_INFO("{}:{}", index, payload);
+        expected.push_back(std::to_string(index) + ":" + payload);
+    }
+
+    JzLogger::GetInstance().Flush();
+    EXPECT_EQ(Texts(), expected);
+}
+
+TEST_F(JzLoggerTest, OversizedMessageIsCutWithMarker)
+{
+    // Deferred string bigger than a record, and a preformatted message through Log()
+    const String payload(JzLogger::MaxArgumentBytes + 100, 'x');
+    JzRE_LOG_INFO("{}", payload);
+    JzLogger::GetInstance().Log(payload, JzELogLevel::Info);
+    JzLogger::GetInstance().Flush();
+
+    const auto texts = Texts();
+    ASSERT_EQ(texts.size(), 2u);
+    for (const auto &text : texts) {
+        const Size   kept   = text.find(' ');
+        const String marker = " [truncated " + std::to_string(payload.size() - kept) + " bytes]";
+        ASSERT_NE(kept, String::npos);
+        EXPECT_EQ(text.substr(0, kept), payload.substr(0, kept));
+        EXPECT_EQ(text.substr(kept), marker);
+        EXPECT_LE(kept, JzLogger::MaxArgumentBytes);
+    }
+
+    // A message that fits is left alone
+    const String fits(1000, 'y');
+    JzRE_LOG_INFO("{}", fits);
+    JzLogger::GetInstance().Flush();
+    EXPECT_EQ(Texts().back(), fits);
+}
+
+TEST_F(JzLoggerTest, FlushDrainsEveryThreadRing)
+{
+    constexpr U32 kThreadCount = 4;
+    constexpr U32 kPerThread   = 200;
+
+    std::latch logged(kThreadCount);
+    std::latch release(1);
+
+    std::vector<std::thread> threads;
+    for (U32 thread = 0; thread < kThreadCount; ++thread) {
+        threads.emplace_back([thread, &logged, &release]() {
+            for (U32 index = 0; index < kPerThread; ++index) {
+                JzRE_LOG_INFO("thread {} record {}", thread, index);
+            }
+            logged.count_down();
+            // Stay alive so the rings are drained by Flush, not by thread exit
+            release.wait();
+        });
+    }
+
+    logged.wait();
+    JzLogger::GetInstance().Flush();
+    const auto texts = Texts();
+
+    release.count_down();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(texts.size(), kThreadCount * kPerThread);
+
+    // Records of one thread stay in call order
+    std::vector<U32> nextIndex(kThreadCount, 0);
+    for (const auto &text : texts) {
+        U32 thread = 0;
+        U32 index  = 0;
+        ASSERT_EQ(std::sscanf(text.c_str(), "thread %u record %u", &thread, &index), 2) << text;
+        ASSERT_LT(thread, kThreadCount);
+        EXPECT_EQ(index, nextIndex[thread]++);
+    }
+}
+
+TEST_F(JzLoggerTest, PushWakesIdleLoggerThread)
+{
+    // The logger thread does not poll, so only the push itself can wake it
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    JzRE_LOG_INFO("wake {}", 1);
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (Messages().empty() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(Texts(), std::vector<String>{"wake 1"});
+}
+
+TEST_F(JzLoggerTest, CriticalIsWrittenBeforeReturning)
+{
+    JzRE_LOG_CRITICAL("fatal {}", 7);
+
+    // No Flush: the call itself waits for the sinks
+    const auto messages = Messages();
+    ASSERT_EQ(messages.size(), 1u);
+    EXPECT_EQ(messages[0].text, "fatal 7");
+    EXPECT_EQ(messages[0].level, JzELogLevel::Critical);
+}
+
+TEST_F(JzLoggerTest, ExitedThreadRingIsReleased)
+{
+    auto &logger = JzLogger::GetInstance();
+    logger.Flush();
+    const Size ringCount = logger.GetRingCount();
+
+    std::thread([]() { JzRE_LOG_INFO("from a short-lived thread"); }).join();
+    logger.Flush();
+
+    EXPECT_EQ(Texts(), std::vector<String>{"from a short-lived thread"});
+    EXPECT_EQ(logger.GetRingCount(), ringCount);
+}
@@ -0,0 +1,104 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Core/JzMPSCQueue.h"
+
+using namespace JzRE;
+
+TEST(JzMPSCQueue, CapacityRoundsUpToPowerOfTwo)
+{
+    JzMPSCQueue<int> queue(100);
+    EXPECT_EQ(queue.GetCapacity(), 128u);
+}
+
+TEST(JzMPSCQueue, PopsInPushOrder)
+{
+    JzMPSCQueue<int> queue(8);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_TRUE(queue.TryPush(i));
+    }
+
+    int value = -1;
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(queue.TryPop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(queue.TryPop(value));
+}
+
+TEST(JzMPSCQueue, PushFailsWhenFullAndRecoversAfterPop)
+{
+    JzMPSCQueue<int> queue(4);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(queue.TryPush(i));
+    }
+    EXPECT_FALSE(queue.TryPush(4));
+
+    int value = -1;
+    ASSERT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(queue.TryPush(4));
+}
+
+TEST(JzMPSCQueue, DestroysUnpoppedElements)
+{
+    auto tracker = std::make_shared<int>(0);
+    {
+        JzMPSCQueue<std::shared_ptr<int>> queue(4);
+        queue.TryPush(tracker);
+        queue.TryPush(tracker);
+        EXPECT_EQ(tracker.use_count(), 3);
+    }
+    EXPECT_EQ(tracker.use_count(), 1);
+}
+
+TEST(JzMPSCQueue, ConcurrentProducersKeepPerProducerOrder)
+{
+    constexpr int kProducers = 4;
+    constexpr int kPerThread = 20000;
+
+    struct Item {
+        int producer = 0;
+        int sequence = 0;
+    };
+
+    JzMPSCQueue<Item>        queue(256);
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&queue, p]() {
+            for (int i = 0; i < kPerThread; ++i) {
+                while (!queue.TryPush(Item{p, i})) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<int> next(kProducers, 0);
+    int              received = 0;
+    Item             item;
+    while (received < kProducers * kPerThread) {
+        if (queue.TryPop(item)) {
+            EXPECT_EQ(item.sequence, next[item.producer]);
+            next[item.producer] = item.sequence + 1;
+            ++received;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    for (int p = 0; p < kProducers; ++p) {
+        EXPECT_EQ(next[p], kPerThread);
+    }
+}
@@ -71,6 +71,17 @@ TEST(JzPlatformEventWrapper, SameTypeHasConsistentTypeId)
     EXPECT_EQ(w1.GetTypeId(), w2.GetTypeId());
 }
 
+TEST(JzPlatformEventWrapper, DifferentTypesDoNotMatch)
+{
+    JzPlatformEventWrapper key(KeyEvent{});
+    JzPlatformEventWrapper resize(ResizeEvent{});
+
+    EXPECT_NE(key.GetTypeId(), resize.GetTypeId());
+    EXPECT_EQ(key.As<ResizeEvent>(), nullptr);
+    EXPECT_EQ(resize.As<KeyEvent>(), nullptr);
+    EXPECT_NE(resize.As<ResizeEvent>(), nullptr);
+}
+
 // ---------------------------------------------------------------------------
 // JzPlatformEventWrapper – move semantics
 // ---------------------------------------------------------------------------
@@ -0,0 +1,117 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include "JzRE/Runtime/Core/JzProfiler.h"
+
+class TestJzProfiler : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        ResetProfiler();
+    }
+
+    void TearDown() override
+    {
+        ResetProfiler();
+    }
+
+    static void ResetProfiler()
+    {
+        auto &profiler = JzRE::JzProfiler::GetInstance();
+        profiler.SetEnabled(false);
+        profiler.Collect();
+        profiler.ClearCapture();
+    }
+
+    static std::string ReadFile(const std::filesystem::path &path)
+    {
+        std::ifstream stream(path);
+        return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+};
+
+TEST_F(TestJzProfiler, ScopeIsIgnoredWhileDisabled)
+{
+    auto &profiler = JzRE::JzProfiler::GetInstance();
+    {
+        JzRE_PROFILE_SCOPE("Disabled");
+    }
+    profiler.Collect();
+
+    EXPECT_EQ(profiler.GetCapturedEventCount(), 0u);
+}
+
+TEST_F(TestJzProfiler, CollectsScopesFromAllThreads)
+{
+    auto &profiler = JzRE::JzProfiler::GetInstance();
+    profiler.SetEnabled(true);
+    {
+        JzRE_PROFILE_SCOPE("Main");
+    }
+    std::thread worker([] {
+        JzRE_PROFILE_SCOPE("Worker");
+    });
+    worker.join();
+
+    EXPECT_EQ(profiler.GetCapturedEventCount(), 0u);
+    profiler.Collect();
+    EXPECT_EQ(profiler.GetCapturedEventCount(), 2u);
+
+    // Rings are drained, a second collect adds nothing
+    profiler.Collect();
+    EXPECT_EQ(profiler.GetCapturedEventCount(), 2u);
+}
+
+TEST_F(TestJzProfiler, GpuZonesAreAcceptedWhileDisabled)
+{
+    auto &profiler = JzRE::JzProfiler::GetInstance();
+    profiler.RecordGpuZone("Pass", 100, 200);
+    profiler.Collect();
+
+    EXPECT_EQ(profiler.GetCapturedEventCount(), 1u);
+}
+
+TEST_F(TestJzProfiler, FullRingDropsEvents)
+{
+    auto      &profiler      = JzRE::JzProfiler::GetInstance();
+    const auto droppedBefore = profiler.GetDroppedEventCount();
+
+    for (JzRE::Size i = 0; i < JzRE::JzProfiler::RingCapacity + 10; ++i) {
+        profiler.RecordCpuZone("Zone", i + 1, i + 2);
+    }
+
+    EXPECT_EQ(profiler.GetDroppedEventCount() - droppedBefore, 10u);
+    profiler.Collect();
+    EXPECT_EQ(profiler.GetCapturedEventCount(), JzRE::JzProfiler::RingCapacity);
+}
+
+TEST_F(TestJzProfiler, ExportsChromeTrace)
+{
+    auto &profiler = JzRE::JzProfiler::GetInstance();
+    profiler.SetThreadName("Main");
+    profiler.RecordCpuZone("Update \"World\"", 1000, 3000);
+    profiler.RecordGpuZone("GeometryPass", 2000, 2500);
+    profiler.Collect();
+
+    const auto path = std::filesystem::temp_directory_path() / "JzRE_profiler_test" / "trace.json";
+    ASSERT_TRUE(profiler.ExportChromeTrace(path));
+
+    const auto json = ReadFile(path);
+    EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"Main\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"GPU\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"Update \\\"World\\\"\""), std::string::npos);
+    EXPECT_NE(json.find("\"cat\":\"gpu\",\"ph\":\"X\",\"ts\":1.000,\"dur\":0.500"), std::string::npos);
+    EXPECT_NE(json.find("\"cat\":\"cpu\",\"ph\":\"X\",\"ts\":0.000,\"dur\":2.000"), std::string::npos);
+
+    std::error_code ec;
+    std::filesystem::remove_all(path.parent_path(), ec);
+}
@@ -0,0 +1,47 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Core/JzSIMD.h"
+
+using namespace JzRE;
+
+TEST(JzSIMD, ArithmeticIsPerLane)
+{
+    const F32 lhsValues[4] = {1.0f, -2.0f, 3.0f, 16.0f};
+    const auto lhs          = JzF32x4::Load(lhsValues);
+    const auto rhs          = JzF32x4::Set(4.0f, 3.0f, 2.0f, 1.0f);
+
+    F32 result[4];
+    (lhs * rhs + JzF32x4::Splat(1.0f)).Store(result);
+    EXPECT_FLOAT_EQ(result[0], 5.0f);
+    EXPECT_FLOAT_EQ(result[1], -5.0f);
+    EXPECT_FLOAT_EQ(result[2], 7.0f);
+    EXPECT_FLOAT_EQ(result[3], 17.0f);
+
+    Min(lhs, rhs).Store(result);
+    EXPECT_FLOAT_EQ(result[1], -2.0f);
+    Max(lhs, rhs).Store(result);
+    EXPECT_FLOAT_EQ(result[3], 16.0f);
+    Sqrt(JzF32x4::Set(4.0f, 9.0f, 16.0f, 25.0f)).Store(result);
+    EXPECT_FLOAT_EQ(result[3], 5.0f);
+}
+
+TEST(JzSIMD, MasksCombineAndSelect)
+{
+    const auto values = JzF32x4::Set(1.0f, 2.0f, 3.0f, 4.0f);
+    const auto limit  = JzF32x4::Splat(2.0f);
+
+    EXPECT_EQ(Less(values, limit).MoveMask(), 0b0001u);
+    EXPECT_EQ(LessEqual(values, limit).MoveMask(), 0b0011u);
+    EXPECT_EQ(And(LessEqual(values, limit), Less(limit, values)).MoveMask(), 0u);
+    EXPECT_EQ(Or(Less(values, limit), Less(limit, values)).MoveMask(), 0b1101u);
+
+    F32 result[4];
+    Select(Less(values, limit), JzF32x4::Splat(-1.0f), values).Store(result);
+    EXPECT_FLOAT_EQ(result[0], -1.0f);
+    EXPECT_FLOAT_EQ(result[1], 2.0f);
+}
@@ -3,6 +3,8 @@
  * @copyright Copyright (c) 2026 JzRE
  */
 
+#include <stdexcept>
+
 #include <gtest/gtest.h>
 
 #include "JzRE/Runtime/Core/JzServiceContainer.h"
@@ -23,6 +25,8 @@ struct ServiceC {
     bool active = false;
 };
 
+struct ServiceNeverProvided { };
+
 class JzServiceContainerTest : public ::testing::Test {
 protected:
     void SetUp() override
@@ -196,3 +200,71 @@ TEST_F(JzServiceContainerTest, ProvideOverwritesExistingRegistration)
 
     EXPECT_EQ(JzServiceContainer::Get<ServiceA>().value, 2);
 }
+
+// ---------------------------------------------------------------------------
+// Missing services
+// ---------------------------------------------------------------------------
+
+TEST_F(JzServiceContainerTest, GetThrowsWhenNotProvided)
+{
+    EXPECT_THROW(JzServiceContainer::Get<ServiceA>(), std::runtime_error);
+}
+
+TEST_F(JzServiceContainerTest, SlotIsAssignedByProvideOnly)
+{
+    // Lookups of a type that was never provided read the reserved empty slot
+    EXPECT_FALSE(JzServiceContainer::Has<ServiceNeverProvided>());
+    EXPECT_THROW(JzServiceContainer::Get<ServiceNeverProvided>(), std::runtime_error);
+    EXPECT_EQ(JzServiceSlot<ServiceNeverProvided>, 0u);
+
+    ServiceA a;
+    JzServiceContainer::Provide<ServiceA>(a);
+    const Size slot = JzServiceSlot<ServiceA>;
+    EXPECT_NE(slot, 0u);
+
+    // Removing and providing again keeps the slot
+    JzServiceContainer::Remove<ServiceA>();
+    JzServiceContainer::Provide<ServiceA>(a);
+    EXPECT_EQ(JzServiceSlot<ServiceA>, slot);
+    EXPECT_EQ(&JzServiceContainer::Get<ServiceA>(), &a);
+}
+
+// ---------------------------------------------------------------------------
+// Scope
+// ---------------------------------------------------------------------------
+
+TEST_F(JzServiceContainerTest, ScopeStartsEmptyAndRestoresPreviousServices)
+{
+    ServiceA outer;
+    outer.value = 1;
+    JzServiceContainer::Provide<ServiceA>(outer);
+
+    {
+        JzServiceScope scope;
+        EXPECT_FALSE(JzServiceContainer::Has<ServiceA>());
+
+        ServiceA inner;
+        inner.value = 2;
+        ServiceB b;
+        JzServiceContainer::Provide<ServiceA>(inner);
+        JzServiceContainer::Provide<ServiceB>(b);
+        EXPECT_EQ(JzServiceContainer::Get<ServiceA>().value, 2);
+    }
+
+    EXPECT_EQ(JzServiceContainer::Get<ServiceA>().value, 1);
+    EXPECT_FALSE(JzServiceContainer::Has<ServiceB>());
+}
+
+TEST_F(JzServiceContainerTest, ScopesNest)
+{
+    ServiceA a;
+    JzServiceScope outerScope;
+    JzServiceContainer::Provide<ServiceA>(a);
+
+    {
+        JzServiceScope innerScope;
+        EXPECT_FALSE(JzServiceContainer::Has<ServiceA>());
+    }
+
+    EXPECT_TRUE(JzServiceContainer::Has<ServiceA>());
+}
@@ -3,13 +3,19 @@
  * @copyright Copyright (c) 2026 JzRE
  */
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <future>
+#include <mutex>
+#include <numeric>
 #include <stdexcept>
 #include <vector>
 
 #include <gtest/gtest.h>
 
+#include "JzRE/Runtime/Core/JzJob.h"
+#include "JzRE/Runtime/Core/JzTaskGraph.h"
 #include "JzRE/Runtime/Core/JzThreadPool.h"
 
 using namespace JzRE;
@@ -166,3 +172,246 @@ TEST(JzThreadPool, AllSubmittedTasksEventuallyComplete)
 
     EXPECT_EQ(count, kN);
 }
+
+TEST(JzThreadPool, SubmitPropagatesExceptionThroughFuture)
+{
+    JzThreadPool pool(2);
+
+    auto future = pool.Submit([]() -> int { throw std::runtime_error("boom"); });
+    EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+TEST(JzThreadPool, SubmitFromWorkerThread)
+{
+    JzThreadPool pool(2);
+
+    auto outer = pool.Submit([&pool]() {
+        return pool.Submit([]() { return 7; });
+    });
+
+    EXPECT_EQ(outer.get().get(), 7);
+}
+
+// ---------------------------------------------------------------------------
+// Job storage
+// ---------------------------------------------------------------------------
+
+TEST(JzJob, SmallCallablesAreStoredInline)
+{
+    int  value = 0;
+    auto small = [&value]() { value++; };
+    EXPECT_TRUE(JzJob::IsStoredInline<decltype(small)>());
+
+    JzJob job(small);
+    job();
+    job();
+    EXPECT_EQ(value, 2);
+}
+
+TEST(JzJob, LargeCallablesFallBackToHeap)
+{
+    std::array<int, 64> payload{};
+    payload.back() = 5;
+
+    int  result = 0;
+    auto large  = [payload, &result]() { result = payload.back(); };
+    EXPECT_FALSE(JzJob::IsStoredInline<decltype(large)>());
+
+    JzJob job(large);
+    JzJob moved(std::move(job));
+    EXPECT_FALSE(static_cast<bool>(job));
+
+    moved();
+    EXPECT_EQ(result, 5);
+}
+
+// ---------------------------------------------------------------------------
+// ParallelFor
+// ---------------------------------------------------------------------------
+
+TEST(JzThreadPool, ParallelForVisitsEveryIndexOnce)
+{
+    JzThreadPool pool(4);
+
+    std::vector<std::atomic<int>> visits(10000);
+    pool.ParallelFor(0, visits.size(), 64, [&visits](Size begin, Size end) {
+        for (Size i = begin; i < end; ++i) {
+            visits[i].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    for (const auto &visit : visits) {
+        EXPECT_EQ(visit.load(), 1);
+    }
+}
+
+TEST(JzThreadPool, ParallelForRespectsGrain)
+{
+    JzThreadPool pool(4);
+
+    std::mutex        mutex;
+    std::vector<Size> chunkSizes;
+    pool.ParallelFor(0, 1000, 100, [&](Size begin, Size end) {
+        std::lock_guard<std::mutex> lock(mutex);
+        chunkSizes.push_back(end - begin);
+    });
+
+    EXPECT_EQ(std::accumulate(chunkSizes.begin(), chunkSizes.end(), Size{0}), 1000u);
+    for (Size size : chunkSizes) {
+        EXPECT_LE(size, 100u);
+        EXPECT_GE(size, 50u);
+    }
+}
+
+TEST(JzThreadPool, ParallelForRunsInlineWithoutWorkers)
+{
+    JzThreadPool pool(0);
+
+    int chunks = 0;
+    pool.ParallelFor(0, 100, 1, [&chunks](Size begin, Size end) {
+        EXPECT_EQ(begin, 0u);
+        EXPECT_EQ(end, 100u);
+        chunks++;
+    });
+
+    EXPECT_EQ(chunks, 1);
+}
+
+TEST(JzThreadPool, NestedParallelForCompletes)
+{
+    JzThreadPool pool(3);
+
+    std::atomic<int> total{0};
+    pool.ParallelFor(0, 16, 1, [&](Size, Size) {
+        pool.ParallelFor(0, 100, 10, [&](Size begin, Size end) {
+            total.fetch_add(static_cast<int>(end - begin), std::memory_order_relaxed);
+        });
+    });
+
+    EXPECT_EQ(total.load(), 1600);
+}
+
+TEST(JzThreadPool, ParallelForRethrowsFirstException)
+{
+    JzThreadPool pool(4);
+
+    EXPECT_THROW(pool.ParallelFor(0, 1000, 10, [](Size begin, Size) {
+        if (begin == 500) {
+            throw std::runtime_error("chunk failed");
+        }
+    }),
+                 std::runtime_error);
+
+    // The pool stays usable afterwards
+    EXPECT_EQ(pool.Submit([]() { return 1; }).get(), 1);
+}
+
+// ---------------------------------------------------------------------------
+// Task graph
+// ---------------------------------------------------------------------------
+
+TEST(JzTaskGraph, RunsTasksAfterTheirDependencies)
+{
+    JzThreadPool pool(4);
+    JzTaskGraph  graph;
+
+    std::mutex       mutex;
+    std::vector<int> order;
+    auto             record = [&](int value) {
+        return [&, value]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(value);
+        };
+    };
+
+    // Diamond: 0 -> {1, 2} -> 3
+    const auto a = graph.AddTask(record(0));
+    const auto b = graph.AddTask(record(1));
+    const auto c = graph.AddTask(record(2));
+    const auto d = graph.AddTask(record(3));
+    graph.AddDependency(a, b);
+    graph.AddDependency(a, c);
+    graph.AddDependency(b, d);
+    graph.AddDependency(c, d);
+
+    ASSERT_TRUE(pool.Run(graph));
+    ASSERT_EQ(order.size(), 4u);
+    EXPECT_EQ(order.front(), 0);
+    EXPECT_EQ(order.back(), 3);
+}
+
+TEST(JzTaskGraph, CanRunRepeatedly)
+{
+    JzThreadPool pool(2);
+    JzTaskGraph  graph;
+
+    std::atomic<int> counter{0};
+    JzTaskId         previous = JzTaskGraph::InvalidTask;
+    for (int i = 0; i < 8; ++i) {
+        const auto task = graph.AddTask([&counter]() { counter.fetch_add(1); });
+        if (previous != JzTaskGraph::InvalidTask) {
+            graph.AddDependency(previous, task);
+        }
+        previous = task;
+    }
+
+    for (int run = 0; run < 3; ++run) {
+        ASSERT_TRUE(pool.Run(graph));
+    }
+    EXPECT_EQ(counter.load(), 24);
+}
+
+TEST(JzTaskGraph, RejectsCycles)
+{
+    JzThreadPool pool(2);
+    JzTaskGraph  graph;
+
+    Bool       executed = false;
+    const auto a        = graph.AddTask([&executed]() { executed = true; });
+    const auto b        = graph.AddTask([]() {});
+    graph.AddDependency(a, b);
+    graph.AddDependency(b, a);
+
+    EXPECT_FALSE(graph.Validate());
+    EXPECT_FALSE(pool.Run(graph));
+    EXPECT_FALSE(executed);
+}
+
+TEST(JzTaskGraph, EditsAfterARunAreValidatedAgain)
+{
+    JzThreadPool pool(2);
+    JzTaskGraph  graph;
+
+    const auto a = graph.AddTask([]() {});
+    const auto b = graph.AddTask([]() {});
+    graph.AddDependency(a, b);
+    ASSERT_TRUE(pool.Run(graph));
+
+    graph.AddDependency(b, a);
+    EXPECT_FALSE(pool.Run(graph));
+
+    graph.Clear();
+    Bool       executed = false;
+    const auto c        = graph.AddTask([&executed]() { executed = true; });
+    EXPECT_NE(c, JzTaskGraph::InvalidTask);
+    EXPECT_TRUE(pool.Run(graph));
+    EXPECT_TRUE(executed);
+}
+
+TEST(JzTaskGraph, WideFanOutCompletes)
+{
+    JzThreadPool pool(4);
+    JzTaskGraph  graph;
+
+    std::atomic<int> counter{0};
+    const auto       root = graph.AddTask([]() {});
+    const auto       sink = graph.AddTask([&counter]() { counter.fetch_add(1000); });
+    for (int i = 0; i < 500; ++i) {
+        const auto task = graph.AddTask([&counter]() { counter.fetch_add(1); });
+        graph.AddDependency(root, task);
+        graph.AddDependency(task, sink);
+    }
+
+    ASSERT_TRUE(pool.Run(graph));
+    EXPECT_EQ(counter.load(), 1500);
+}
@@ -0,0 +1,150 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Core/JzServiceContainer.h"
+#include "JzRE/Runtime/Function/ECS/JzAssetComponents.h"
+#include "JzRE/Runtime/Function/ECS/JzAssetSystem.h"
+#include "JzRE/Runtime/Function/ECS/JzWorld.h"
+
+using namespace JzRE;
+
+namespace {
+
+class JzAssetSystemReadinessTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        JzAssetManagerConfig config;
+        config.asyncWorkerCount = 1;
+        assetSystem.Initialize(world, config);
+    }
+
+    void TearDown() override
+    {
+        assetSystem.OnShutdown(world);
+    }
+
+    JzServiceScope scope;
+    JzWorld        world;
+    JzAssetSystem  assetSystem;
+};
+
+} // namespace
+
+TEST_F(JzAssetSystemReadinessTest, NewComponentIsProcessedOnceThenIdle)
+{
+    auto handle = assetSystem.RegisterAsset<JzMaterial>("test#mat0", std::make_shared<JzMaterial>(JzMaterialProperties{}));
+    auto entity = world.CreateEntity();
+    world.AddComponent<JzMaterialAssetComponent>(entity, handle);
+    EXPECT_EQ(assetSystem.GetPendingEntityCount(), 1u);
+
+    assetSystem.Update(world, 0.016f);
+    EXPECT_TRUE(world.GetComponent<JzMaterialAssetComponent>(entity).isReady);
+    EXPECT_EQ(assetSystem.GetPendingEntityCount(), 0u);
+
+    assetSystem.Update(world, 0.016f);
+    EXPECT_EQ(assetSystem.GetPendingEntityCount(), 0u);
+}
+
+TEST_F(JzAssetSystemReadinessTest, PatchedComponentIsProcessedAgain)
+{
+    auto handle = assetSystem.RegisterAsset<JzMaterial>("test#mat0", std::make_shared<JzMaterial>(JzMaterialProperties{}));
+    auto entity = world.CreateEntity();
+    world.AddComponent<JzMaterialAssetComponent>(entity, handle);
+    assetSystem.Update(world, 0.016f);
+
+    world.PatchComponent<JzMaterialAssetComponent>(entity, [](auto &comp) { comp.isReady = false; });
+    EXPECT_EQ(assetSystem.GetPendingEntityCount(), 1u);
+
+    assetSystem.Update(world, 0.016f);
+    EXPECT_TRUE(world.GetComponent<JzMaterialAssetComponent>(entity).isReady);
+}
+
+TEST_F(JzAssetSystemReadinessTest, EntityWaitingOnLoadingAssetIsWokenWhenItLoads)
+{
+    auto &registry = assetSystem.GetAssetManager().GetRegistry<JzMaterial>();
+    auto  handle   = registry.Allocate("test#loading");
+    registry.SetLoadState(handle, JzEAssetLoadState::Loading);
+
+    auto entity = world.CreateEntity();
+    world.AddComponent<JzMaterialAssetComponent>(entity, handle);
+
+    // Parked on the asset, so later frames do not visit the entity
+    assetSystem.Update(world, 0.016f);
+    EXPECT_EQ(assetSystem.GetPendingEntityCount(), 0u);
+    EXPECT_FALSE(world.GetComponent<JzMaterialAssetComponent>(entity).isReady);
+
+    registry.Set(handle, std::make_shared<JzMaterial>(JzMaterialProperties{}));
+    registry.SetLoadState(handle, JzEAssetLoadState::Loaded);
+    assetSystem.LoadSync<JzMaterial>("test#loading");
+    EXPECT_EQ(assetSystem.GetPendingEntityCount(), 1u);
+
+    assetSystem.Update(world, 0.016f);
+    EXPECT_TRUE(world.GetComponent<JzMaterialAssetComponent>(entity).isReady);
+}
+
+TEST_F(JzAssetSystemReadinessTest, GetOrLoadWakesEntityWaitingOnTheAsset)
+{
+    auto &registry = assetSystem.GetAssetManager().GetRegistry<JzMaterial>();
+    auto  handle   = registry.Allocate("test#loading");
+    registry.SetLoadState(handle, JzEAssetLoadState::Loading);
+
+    auto entity = world.CreateEntity();
+    world.AddComponent<JzMaterialAssetComponent>(entity, handle);
+    assetSystem.Update(world, 0.016f);
+    EXPECT_EQ(assetSystem.GetPendingEntityCount(), 0u);
+
+    registry.Set(handle, std::make_shared<JzMaterial>(JzMaterialProperties{}));
+    registry.SetLoadState(handle, JzEAssetLoadState::Loaded);
+    EXPECT_EQ(assetSystem.GetOrLoad<JzMaterial>("test#loading"), handle);
+    EXPECT_EQ(assetSystem.GetPendingEntityCount(), 1u);
+
+    assetSystem.Update(world, 0.016f);
+    EXPECT_TRUE(world.GetComponent<JzMaterialAssetComponent>(entity).isReady);
+}
+
+TEST_F(JzAssetSystemReadinessTest, AsyncLoadResultWakesWaitingEntity)
+{
+    auto &registry = assetSystem.GetAssetManager().GetRegistry<JzMaterial>();
+
+    // Higher-priority requests fill the first frame's dispatch batch, so the
+    // entity is parked before its own load is dispatched
+    for (I32 index = 0; index < 4; ++index) {
+        assetSystem.LoadAsync<JzMaterial>("test#filler" + std::to_string(index), nullptr, 10);
+    }
+
+    // The callback runs on the main thread just before the result listener;
+    // finish the asset there the way a loader would before posting its result
+    auto handle = assetSystem.LoadAsync<JzMaterial>(
+        "test#async",
+        [&registry](JzAssetHandle<JzMaterial> loaded, Bool) {
+            registry.Set(loaded, std::make_shared<JzMaterial>(JzMaterialProperties{}));
+            registry.SetLoadState(loaded, JzEAssetLoadState::Loaded);
+        },
+        0);
+
+    auto entity = world.CreateEntity();
+    world.AddComponent<JzMaterialAssetComponent>(entity, handle);
+
+    assetSystem.Update(world, 0.016f);
+    EXPECT_EQ(assetSystem.GetPendingEntityCount(), 0u);
+    EXPECT_FALSE(world.GetComponent<JzMaterialAssetComponent>(entity).isReady);
+
+    // Only the listener can move the parked entity back to the pending set
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!world.GetComponent<JzMaterialAssetComponent>(entity).isReady && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        assetSystem.Update(world, 0.016f);
+    }
+    EXPECT_TRUE(world.GetComponent<JzMaterialAssetComponent>(entity).isReady);
+    EXPECT_EQ(assetSystem.GetPendingEntityCount(), 0u);
+}
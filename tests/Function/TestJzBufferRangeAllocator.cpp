@@ -0,0 +1,108 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Function/Rendering/JzBufferRangeAllocator.h"
+
+using namespace JzRE;
+
+TEST(JzBufferRangeAllocator, AllocatesSequentialRanges)
+{
+    JzBufferRangeAllocator allocator(100);
+
+    auto first  = allocator.Allocate(30);
+    auto second = allocator.Allocate(20);
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(*first, 0u);
+    EXPECT_EQ(*second, 30u);
+    EXPECT_EQ(allocator.GetUsed(), 50u);
+    EXPECT_EQ(allocator.GetLargestFreeRange(), 50u);
+}
+
+TEST(JzBufferRangeAllocator, RejectsZeroAndOversizedRequests)
+{
+    JzBufferRangeAllocator allocator(16);
+
+    EXPECT_FALSE(allocator.Allocate(0).has_value());
+    EXPECT_FALSE(allocator.Allocate(17).has_value());
+    EXPECT_TRUE(allocator.Allocate(16).has_value());
+    EXPECT_FALSE(allocator.Allocate(1).has_value());
+}
+
+TEST(JzBufferRangeAllocator, CoalescesFreedNeighbours)
+{
+    JzBufferRangeAllocator allocator(90);
+
+    auto a = allocator.Allocate(30);
+    auto b = allocator.Allocate(30);
+    auto c = allocator.Allocate(30);
+    ASSERT_TRUE(a && b && c);
+    EXPECT_EQ(allocator.GetLargestFreeRange(), 0u);
+
+    allocator.Free(*a, 30);
+    allocator.Free(*c, 30);
+    EXPECT_EQ(allocator.GetLargestFreeRange(), 30u);
+    EXPECT_FALSE(allocator.Allocate(60).has_value());
+
+    // Freeing the middle range merges all three into one
+    allocator.Free(*b, 30);
+    EXPECT_EQ(allocator.GetUsed(), 0u);
+    EXPECT_EQ(allocator.GetLargestFreeRange(), 90u);
+
+    auto whole = allocator.Allocate(90);
+    ASSERT_TRUE(whole.has_value());
+    EXPECT_EQ(*whole, 0u);
+}
+
+TEST(JzBufferRangeAllocator, ReusesFreedHoleFirstFit)
+{
+    JzBufferRangeAllocator allocator(100);
+
+    auto a = allocator.Allocate(40);
+    auto b = allocator.Allocate(40);
+    ASSERT_TRUE(a && b);
+
+    allocator.Free(*a, 40);
+
+    auto c = allocator.Allocate(10);
+    ASSERT_TRUE(c.has_value());
+    EXPECT_EQ(*c, 0u);
+}
+
+TEST(JzBufferRangeAllocator, GrowMergesWithFreeTail)
+{
+    JzBufferRangeAllocator allocator(50);
+
+    auto a = allocator.Allocate(40);
+    ASSERT_TRUE(a.has_value());
+    EXPECT_FALSE(allocator.Allocate(20).has_value());
+
+    allocator.Grow(100);
+    EXPECT_EQ(allocator.GetCapacity(), 100u);
+    EXPECT_EQ(allocator.GetLargestFreeRange(), 60u);
+
+    auto b = allocator.Allocate(20);
+    ASSERT_TRUE(b.has_value());
+    EXPECT_EQ(*b, 40u);
+
+    // Shrinking is not supported
+    allocator.Grow(10);
+    EXPECT_EQ(allocator.GetCapacity(), 100u);
+}
+
+TEST(JzBufferRangeAllocator, ResetKeepsCapacity)
+{
+    JzBufferRangeAllocator allocator(64);
+
+    ASSERT_TRUE(allocator.Allocate(32).has_value());
+    allocator.Reset();
+
+    EXPECT_EQ(allocator.GetUsed(), 0u);
+    EXPECT_EQ(allocator.GetCapacity(), 64u);
+    EXPECT_EQ(allocator.GetLargestFreeRange(), 64u);
+}
@@ -0,0 +1,122 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Function/Rendering/JzClusteredLighting.h"
+
+using namespace JzRE;
+
+namespace {
+
+constexpr F32 kFovY = 1.5707963f;
+
+JzLightData MakeLight(JzELightType type, JzVec3 position, F32 range)
+{
+    JzLightData light{};
+    light.type      = type;
+    light.position  = position;
+    light.direction = JzVec3(0.0f, 0.0f, -1.0f);
+    light.color     = JzVec3(1.0f, 1.0f, 1.0f);
+    light.intensity = 1.0f;
+    light.range     = range;
+    return light;
+}
+
+// Camera at the origin looking down -z
+JzMat4 Projection()
+{
+    return JzMat4x4::Perspective(kFovY, 16.0f / 9.0f, 0.1f, 100.0f);
+}
+
+Bool ClusterHasLight(const JzClusteredLighting &lighting, U32 x, U32 y, U32 z, U32 lightRow)
+{
+    const auto lights = lighting.GetClusterLights(lighting.GetClusterIndex(x, y, z));
+    return std::find(lights.begin(), lights.end(), lightRow) != lights.end();
+}
+
+} // namespace
+
+TEST(JzClusteredLighting, DepthSlicesFollowTheProjection)
+{
+    JzClusteredLighting lighting;
+    lighting.Build({}, JzMat4x4::Identity(), Projection());
+
+    EXPECT_NEAR(lighting.GetNearPlane(), 0.1f, 1e-4f);
+    EXPECT_NEAR(lighting.GetFarPlane(), 100.0f, 1e-1f);
+    EXPECT_EQ(lighting.GetDepthSlice(0.1f), 0);
+    EXPECT_EQ(lighting.GetDepthSlice(99.9f), 23);
+    EXPECT_EQ(lighting.GetDepthSlice(0.05f), -1);
+
+    // Exponential slices: each decade of depth covers the same number of slices
+    EXPECT_EQ(lighting.GetDepthSlice(1.01f) - lighting.GetDepthSlice(0.101f),
+              lighting.GetDepthSlice(10.1f) - lighting.GetDepthSlice(1.01f));
+}
+
+TEST(JzClusteredLighting, PointLightOnlyReachesNearbyClusters)
+{
+    JzClusteredLighting lighting;
+    lighting.Build({MakeLight(JzELightType::Point, JzVec3(0.0f, 0.0f, -10.0f), 1.0f)}, JzMat4x4::Identity(),
+                   Projection());
+
+    const U32 slice = static_cast<U32>(lighting.GetDepthSlice(10.0f));
+    EXPECT_TRUE(ClusterHasLight(lighting, 8, 4, slice, 0));
+    EXPECT_TRUE(ClusterHasLight(lighting, 7, 4, slice, 0));
+    EXPECT_FALSE(ClusterHasLight(lighting, 0, 0, slice, 0));
+    EXPECT_FALSE(ClusterHasLight(lighting, 8, 4, 0, 0));
+    EXPECT_FALSE(ClusterHasLight(lighting, 8, 4, lighting.GetClusterCountZ() - 1, 0));
+}
+
+TEST(JzClusteredLighting, DirectionalLightsComeFirstAndAreNotBinned)
+{
+    JzClusteredLighting lighting;
+    lighting.Build({MakeLight(JzELightType::Point, JzVec3(0.0f, 0.0f, -10.0f), 100.0f),
+                    MakeLight(JzELightType::Directional, JzVec3(0.0f, 0.0f, 0.0f), 0.0f)},
+                   JzMat4x4::Identity(), Projection());
+
+    EXPECT_EQ(lighting.GetLightCount(), 2u);
+    EXPECT_EQ(lighting.GetDirectionalLightCount(), 1u);
+
+    const U32 slice = static_cast<U32>(lighting.GetDepthSlice(10.0f));
+    EXPECT_TRUE(ClusterHasLight(lighting, 8, 4, slice, 1));
+    EXPECT_FALSE(ClusterHasLight(lighting, 8, 4, slice, 0));
+}
+
+TEST(JzClusteredLighting, SpotConeSkipsClustersBehindIt)
+{
+    auto spot        = MakeLight(JzELightType::Spot, JzVec3(0.0f, 0.0f, -10.0f), 5.0f);
+    spot.direction   = JzVec3(1.0f, 0.0f, 0.0f);
+    spot.innerCutoff = 5.0f;
+    spot.outerCutoff = 10.0f;
+
+    JzClusteredLighting lighting;
+    lighting.Build({spot, MakeLight(JzELightType::Point, JzVec3(0.0f, 0.0f, -10.0f), 5.0f)},
+                   JzMat4x4::Identity(), Projection());
+
+    const U32 slice = static_cast<U32>(lighting.GetDepthSlice(10.0f));
+    EXPECT_TRUE(ClusterHasLight(lighting, 9, 4, slice, 0));
+    EXPECT_FALSE(ClusterHasLight(lighting, 6, 4, slice, 0));
+    EXPECT_TRUE(ClusterHasLight(lighting, 6, 4, slice, 1));
+
+    // Lists stay sorted by light row
+    const auto lights = lighting.GetClusterLights(lighting.GetClusterIndex(9, 4, slice));
+    ASSERT_EQ(lights.size(), 2u);
+    EXPECT_LT(lights[0], lights[1]);
+}
+
+TEST(JzClusteredLighting, LightsBehindTheCameraAreNotAssigned)
+{
+    JzClusteredLighting lighting;
+    lighting.Build({MakeLight(JzELightType::Point, JzVec3(0.0f, 0.0f, 10.0f), 2.0f)}, JzMat4x4::Identity(),
+                   Projection());
+
+    for (U32 cluster = 0; cluster < 16 * 9 * 24; ++cluster) {
+        EXPECT_TRUE(lighting.GetClusterLights(cluster).empty());
+    }
+    EXPECT_EQ(lighting.GetLightCount(), 1u);
+}
@@ -0,0 +1,167 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Function/Event/JzEventSystem.h"
+
+using namespace JzRE;
+
+namespace {
+
+struct TestEventA : public JzECSEvent {
+    I32 value = 0;
+};
+
+struct TestEventB : public JzECSEvent {
+    I32 value = 0;
+};
+
+TestEventA MakeA(I32 value)
+{
+    TestEventA event;
+    event.value = value;
+    return event;
+}
+
+TestEventB MakeB(I32 value)
+{
+    TestEventB event;
+    event.value = value;
+    return event;
+}
+
+} // namespace
+
+TEST(JzEventSystem, EventTypesHaveDistinctIds)
+{
+    EXPECT_NE(JzECSEventType<TestEventA>::Id(), JzECSEventType<TestEventB>::Id());
+}
+
+TEST(JzEventSystem, HandlersOnlyReceiveTheirType)
+{
+    JzEventSystem    events;
+    std::vector<I32> receivedA;
+    std::vector<I32> receivedB;
+    events.RegisterHandler<TestEventA>([&](const TestEventA &e) { receivedA.push_back(e.value); });
+    events.RegisterHandler<TestEventB>([&](const TestEventB &e) { receivedB.push_back(e.value); });
+
+    events.Send(MakeA(1));
+    events.Send(MakeB(2));
+    events.Send(MakeA(3));
+    events.DispatchEvents();
+
+    EXPECT_EQ(receivedA, (std::vector<I32>{1, 3}));
+    EXPECT_EQ(receivedB, (std::vector<I32>{2}));
+}
+
+TEST(JzEventSystem, EventsAreDeliveredInSendOrderAcrossTypes)
+{
+    JzEventSystem    events;
+    std::vector<I32> order;
+    events.RegisterHandler<TestEventA>([&](const TestEventA &e) { order.push_back(e.value); });
+    events.RegisterHandler<TestEventB>([&](const TestEventB &e) { order.push_back(e.value); });
+
+    events.Send(MakeB(1));
+    events.Send(MakeA(2));
+    events.Send(MakeB(3));
+    events.DispatchEvents();
+
+    EXPECT_EQ(order, (std::vector<I32>{1, 2, 3}));
+}
+
+TEST(JzEventSystem, HandlersRunInPriorityOrder)
+{
+    JzEventSystem    events;
+    std::vector<I32> order;
+    events.RegisterHandler<TestEventA>([&](const TestEventA &) { order.push_back(2); }, 2);
+    events.RegisterHandler<TestEventA>([&](const TestEventA &) { order.push_back(0); }, 0);
+    events.RegisterHandler<TestEventA>([&](const TestEventA &) { order.push_back(1); }, 1);
+    events.RegisterHandler<TestEventA>([&](const TestEventA &) { order.push_back(3); }, 1);
+
+    events.Send(MakeA(0));
+    events.DispatchEvents();
+
+    EXPECT_EQ(order, (std::vector<I32>{0, 1, 3, 2}));
+}
+
+TEST(JzEventSystem, RemovedHandlerIsNotCalled)
+{
+    JzEventSystem events;
+    I32           calls   = 0;
+    auto         *handler = events.RegisterHandler<TestEventA>([&](const TestEventA &) { ++calls; });
+    EXPECT_EQ(events.GetHandlerCount<TestEventA>(), 1u);
+
+    events.RemoveHandler(handler);
+    EXPECT_EQ(events.GetHandlerCount<TestEventA>(), 0u);
+
+    events.Send(MakeA(0));
+    events.DispatchEvents();
+    EXPECT_EQ(calls, 0);
+}
+
+TEST(JzEventSystem, EventsSentByHandlersAreDeliveredInTheSameDispatch)
+{
+    JzEventSystem    events;
+    std::vector<I32> receivedB;
+    events.RegisterHandler<TestEventA>([&](const TestEventA &e) { events.Send(MakeB(e.value * 10)); });
+    events.RegisterHandler<TestEventB>([&](const TestEventB &e) { receivedB.push_back(e.value); });
+
+    events.Send(MakeA(1));
+    events.Send(MakeA(2));
+    events.DispatchEvents();
+
+    EXPECT_EQ(receivedB, (std::vector<I32>{10, 20}));
+}
+
+TEST(JzEventSystem, DelayedEventsFollowRegularEventsAndSkipTheCurrentDispatch)
+{
+    JzEventSystem    events;
+    std::vector<I32> received;
+    events.RegisterHandler<TestEventA>([&](const TestEventA &e) {
+        received.push_back(e.value);
+        if (e.value == 1) {
+            events.SendDelayed(MakeA(3));
+        }
+    });
+
+    events.SendDelayed(MakeA(2));
+    events.Send(MakeA(1));
+    events.DispatchEvents();
+    EXPECT_EQ(received, (std::vector<I32>{1, 2}));
+
+    events.DispatchEvents();
+    EXPECT_EQ(received, (std::vector<I32>{1, 2, 3}));
+}
+
+TEST(JzEventSystem, EventsFromOtherThreadsAreDelivered)
+{
+    constexpr I32 kThreads   = 4;
+    constexpr I32 kPerThread = 1000; // More than the lock-free queue holds, exercises the overflow path
+
+    JzEventSystem     events;
+    std::vector<bool> seen(kThreads * kPerThread, false);
+    events.RegisterHandler<TestEventA>([&](const TestEventA &e) { seen[e.value] = true; });
+
+    std::vector<std::thread> senders;
+    for (I32 t = 0; t < kThreads; ++t) {
+        senders.emplace_back([&events, t]() {
+            for (I32 i = 0; i < kPerThread; ++i) {
+                events.Send(MakeA(t * kPerThread + i));
+            }
+        });
+    }
+    for (auto &sender : senders) {
+        sender.join();
+    }
+
+    events.DispatchEvents();
+    for (I32 i = 0; i < kThreads * kPerThread; ++i) {
+        EXPECT_TRUE(seen[i]) << i;
+    }
+}
@@ -0,0 +1,152 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Function/Rendering/JzIndirectDrawBatcher.h"
+
+using namespace JzRE;
+
+namespace {
+
+class JzTestTexture : public JzGPUTextureObject {
+public:
+    JzTestTexture() :
+        JzGPUTextureObject(JzGPUTextureObjectDesc{}) { }
+
+    void  UpdateData(const void *, U32, U32) override { }
+    void  GenerateMipmaps() override { }
+    void *GetTextureID() const override { return nullptr; }
+};
+
+/**
+ * @brief Draw whose mesh range and instance data are tagged with an id.
+ */
+JzIndirectDrawInput MakeDraw(U32 id, const JzDrawTextureSet &textures = {})
+{
+    JzIndirectDrawInput input;
+    input.textures                  = textures;
+    input.args.indexCount           = 3 * (id + 1);
+    input.args.instanceCount        = 1;
+    input.args.firstIndex           = 100 * id;
+    input.args.vertexOffset         = static_cast<I32>(10 * id);
+    input.args.firstInstance        = 999; // Overwritten by the batcher
+    input.instance.modelRows[3]     = static_cast<F32>(id);
+    input.instance.diffuseColor[0]  = 0.1f * static_cast<F32>(id);
+    input.instance.specularColor[3] = 8.0f + static_cast<F32>(id);
+    return input;
+}
+
+U32 DrawId(const JzGeometryInstanceData &instance)
+{
+    return static_cast<U32>(instance.modelRows[3]);
+}
+
+} // namespace
+
+TEST(JzIndirectDrawBatcher, EmptyInputBuildsNothing)
+{
+    const auto batch = JzIndirectDrawBatcher::Build({});
+
+    EXPECT_TRUE(batch.instances.empty());
+    EXPECT_TRUE(batch.args.empty());
+    EXPECT_TRUE(batch.groups.empty());
+}
+
+TEST(JzIndirectDrawBatcher, UntexturedDrawsShareOneGroup)
+{
+    std::vector<JzIndirectDrawInput> inputs;
+    for (U32 id = 0; id < 4; ++id) {
+        inputs.push_back(MakeDraw(id));
+    }
+
+    const auto batch = JzIndirectDrawBatcher::Build(std::move(inputs));
+
+    ASSERT_EQ(batch.groups.size(), 1u);
+    EXPECT_EQ(batch.groups[0].firstDraw, 0u);
+    EXPECT_EQ(batch.groups[0].drawCount, 4u);
+    EXPECT_FALSE(batch.groups[0].textures.diffuse);
+    EXPECT_FALSE(batch.groups[0].textures.normal);
+    EXPECT_FALSE(batch.groups[0].textures.specular);
+
+    // Submission order is kept and each draw reads its own instance
+    ASSERT_EQ(batch.args.size(), 4u);
+    for (U32 draw = 0; draw < 4; ++draw) {
+        EXPECT_EQ(batch.args[draw].firstInstance, draw);
+        EXPECT_EQ(DrawId(batch.instances[draw]), draw);
+    }
+}
+
+TEST(JzIndirectDrawBatcher, DrawsAreGroupedByTextureSet)
+{
+    auto diffuseA = std::make_shared<JzTestTexture>();
+    auto diffuseB = std::make_shared<JzTestTexture>();
+    auto normal   = std::make_shared<JzTestTexture>();
+    auto specular = std::make_shared<JzTestTexture>();
+
+    const JzDrawTextureSet setA{diffuseA, nullptr, nullptr};
+    const JzDrawTextureSet setB{diffuseB, nullptr, nullptr};
+    const JzDrawTextureSet setANormal{diffuseA, normal, nullptr};
+    const JzDrawTextureSet setASpecular{diffuseA, nullptr, specular};
+
+    // Interleaved sets; the same diffuse with different maps must not merge
+    std::vector<JzIndirectDrawInput> inputs;
+    inputs.push_back(MakeDraw(0, setA));
+    inputs.push_back(MakeDraw(1, setB));
+    inputs.push_back(MakeDraw(2, setANormal));
+    inputs.push_back(MakeDraw(3, setA));
+    inputs.push_back(MakeDraw(4, setASpecular));
+    inputs.push_back(MakeDraw(5, setB));
+    inputs.push_back(MakeDraw(6, setANormal));
+
+    const auto batch = JzIndirectDrawBatcher::Build(std::move(inputs));
+
+    ASSERT_EQ(batch.groups.size(), 4u);
+    ASSERT_EQ(batch.args.size(), 7u);
+    ASSERT_EQ(batch.instances.size(), 7u);
+
+    // Groups tile the argument buffer, and every set appears exactly once
+    U32 nextDraw = 0;
+    for (const auto &group : batch.groups) {
+        EXPECT_EQ(group.firstDraw, nextDraw);
+        nextDraw += group.drawCount;
+        for (const auto &other : batch.groups) {
+            if (&other != &group) {
+                EXPECT_FALSE(other.textures == group.textures);
+            }
+        }
+    }
+    EXPECT_EQ(nextDraw, 7u);
+
+    auto findGroup = [&batch](const JzDrawTextureSet &textures) -> const JzIndirectDrawGroup * {
+        for (const auto &group : batch.groups) {
+            if (group.textures == textures) {
+                return &group;
+            }
+        }
+        return nullptr;
+    };
+
+    auto expectMembers = [&batch](const JzIndirectDrawGroup *group, std::vector<U32> ids) {
+        ASSERT_NE(group, nullptr);
+        ASSERT_EQ(group->drawCount, ids.size());
+        for (U32 member = 0; member < group->drawCount; ++member) {
+            const U32 draw = group->firstDraw + member;
+            EXPECT_EQ(batch.args[draw].firstInstance, draw);
+            EXPECT_EQ(DrawId(batch.instances[draw]), ids[member]);
+            EXPECT_EQ(batch.args[draw].firstIndex, 100 * ids[member]);
+            EXPECT_EQ(batch.args[draw].vertexOffset, static_cast<I32>(10 * ids[member]));
+            EXPECT_FLOAT_EQ(batch.instances[draw].specularColor[3], 8.0f + static_cast<F32>(ids[member]));
+        }
+    };
+
+    expectMembers(findGroup(setA), {0, 3});
+    expectMembers(findGroup(setB), {1, 5});
+    expectMembers(findGroup(setANormal), {2, 6});
+    expectMembers(findGroup(setASpecular), {4});
+}
@@ -0,0 +1,168 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <array>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Function/ECS/JzInputComponents.h"
+#include "JzRE/Runtime/Function/Event/JzPlatformEventAdapter.h"
+
+using namespace JzRE;
+
+namespace {
+
+constexpr I32 kRelease = 0;
+constexpr I32 kPress   = 1;
+constexpr I32 kRepeat  = 2;
+
+void PushKey(JzPlatformEventQueue &queue, JzEKeyCode key, I32 action)
+{
+    JzPlatformKeyEvent event;
+    event.key    = static_cast<I32>(key);
+    event.action = action;
+    queue.Push(std::move(event));
+}
+
+} // namespace
+
+TEST(JzInputStateComponent, PressAndReleaseInOneFrameRaiseBothEdges)
+{
+    JzPlatformEventQueue   queue;
+    JzPlatformEventAdapter adapter;
+    JzInputStateComponent  input;
+
+    PushKey(queue, JzEKeyCode::Space, kPress);
+    PushKey(queue, JzEKeyCode::Space, kRelease);
+    adapter.ProcessPlatformEvents(queue, nullptr, INVALID_ENTITY, &input);
+
+    EXPECT_TRUE(input.changed);
+    EXPECT_TRUE(input.keyboard.IsKeyDown(JzEKeyCode::Space));
+    EXPECT_TRUE(input.keyboard.IsKeyUp(JzEKeyCode::Space));
+    EXPECT_FALSE(input.keyboard.IsKeyPressed(JzEKeyCode::Space));
+    ASSERT_EQ(input.keyboard.changedKeys.size(), 1u);
+    EXPECT_EQ(input.keyboard.changedKeys[0], static_cast<U16>(JzEKeyCode::Space));
+}
+
+TEST(JzInputStateComponent, ClearFrameStateResetsEdgesButKeepsHeldKeys)
+{
+    JzInputStateComponent input;
+
+    input.keyboard.ApplyKeyAction(static_cast<I32>(JzEKeyCode::W), kPress);
+    input.keyboard.ApplyKeyAction(static_cast<I32>(JzEKeyCode::W), kRepeat);
+    input.mouse.ApplyButtonAction(static_cast<I32>(JzEMouseButton::Left), kPress);
+    input.changed = true;
+    input.ClearFrameState();
+
+    EXPECT_FALSE(input.changed);
+    EXPECT_TRUE(input.keyboard.changedKeys.empty());
+    EXPECT_TRUE(input.keyboard.keysDown.none());
+    EXPECT_TRUE(input.keyboard.keysRepeating.none());
+    EXPECT_TRUE(input.mouse.buttonsDown.none());
+    EXPECT_TRUE(input.keyboard.IsKeyPressed(JzEKeyCode::W));
+    EXPECT_TRUE(input.mouse.IsButtonPressed(JzEMouseButton::Left));
+}
+
+TEST(JzInputStateComponent, RedundantActionsDoNotMarkChanges)
+{
+    JzInputStateComponent input;
+
+    EXPECT_FALSE(input.keyboard.ApplyKeyAction(static_cast<I32>(JzEKeyCode::A), kRelease));
+    EXPECT_TRUE(input.keyboard.ApplyKeyAction(static_cast<I32>(JzEKeyCode::A), kPress));
+    EXPECT_FALSE(input.keyboard.ApplyKeyAction(static_cast<I32>(JzEKeyCode::A), kPress));
+    EXPECT_FALSE(input.keyboard.ApplyKeyAction(-1, kPress));
+    EXPECT_FALSE(input.mouse.ApplyButtonAction(static_cast<I32>(JzEMouseButton::Right), kRelease));
+    EXPECT_EQ(input.keyboard.changedKeys.size(), 1u);
+}
+
+TEST(JzInputStateComponent, ScrollEventsAccumulateWithinAFrame)
+{
+    JzPlatformEventQueue   queue;
+    JzPlatformEventAdapter adapter;
+    JzInputStateComponent  input;
+
+    for (I32 i = 0; i < 3; ++i) {
+        JzPlatformMouseScrollEvent event;
+        event.offset = JzVec2(0.0f, 1.0f);
+        queue.Push(std::move(event));
+    }
+    adapter.ProcessPlatformEvents(queue, nullptr, INVALID_ENTITY, &input);
+
+    EXPECT_TRUE(input.changed);
+    EXPECT_FLOAT_EQ(input.mouse.scrollDelta.y, 3.0f);
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST(JzInputStateComponent, KeyEdgesFollowStartOfFrameState)
+{
+    const I32           space = static_cast<I32>(JzEKeyCode::Space);
+    std::array<Bool, 3> edges{};
+
+    // Up at frame start: press, release, press
+    JzInputStateComponent tapped;
+    tapped.keyboard.ApplyKeyAction(space, kPress);
+    tapped.keyboard.ApplyKeyAction(space, kRelease);
+    tapped.keyboard.ApplyKeyAction(space, kPress);
+    ASSERT_EQ(tapped.keyboard.GetKeyEdges(static_cast<U16>(space), edges), 3u);
+    EXPECT_TRUE(edges[0]);
+    EXPECT_FALSE(edges[1]);
+    EXPECT_TRUE(edges[2]);
+
+    // Held at frame start: release, press raises the same bits
+    JzInputStateComponent regrabbed;
+    regrabbed.keyboard.ApplyKeyAction(space, kPress);
+    regrabbed.ClearFrameState();
+    regrabbed.keyboard.ApplyKeyAction(space, kRelease);
+    regrabbed.keyboard.ApplyKeyAction(space, kPress);
+    ASSERT_EQ(regrabbed.keyboard.GetKeyEdges(static_cast<U16>(space), edges), 2u);
+    EXPECT_FALSE(edges[0]);
+    EXPECT_TRUE(edges[1]);
+
+    // A single edge stays a single event
+    JzInputStateComponent pressed;
+    pressed.keyboard.ApplyKeyAction(space, kPress);
+    ASSERT_EQ(pressed.keyboard.GetKeyEdges(static_cast<U16>(space), edges), 1u);
+    EXPECT_TRUE(edges[0]);
+
+    // Repeats alone raise no edge
+    pressed.ClearFrameState();
+    pressed.keyboard.ApplyKeyAction(space, kRepeat);
+    EXPECT_EQ(pressed.keyboard.GetKeyEdges(static_cast<U16>(space), edges), 0u);
+}
+
+TEST(JzInputStateComponent, ButtonEdgesFollowStartOfFrameState)
+{
+    const I32           left = static_cast<I32>(JzEMouseButton::Left);
+    std::array<Bool, 3> edges{};
+
+    // Held at frame start: release, press must not read as press, release
+    JzInputStateComponent regrabbed;
+    regrabbed.mouse.ApplyButtonAction(left, kPress);
+    regrabbed.ClearFrameState();
+    regrabbed.mouse.ApplyButtonAction(left, kRelease);
+    regrabbed.mouse.ApplyButtonAction(left, kPress);
+    ASSERT_EQ(regrabbed.mouse.changedButtons.size(), 1u);
+    ASSERT_EQ(regrabbed.mouse.GetButtonEdges(static_cast<U8>(left), edges), 2u);
+    EXPECT_FALSE(edges[0]);
+    EXPECT_TRUE(edges[1]);
+    EXPECT_TRUE(regrabbed.mouse.IsButtonPressed(JzEMouseButton::Left));
+
+    // Up at frame start: press, release, press
+    JzInputStateComponent tapped;
+    tapped.mouse.ApplyButtonAction(left, kPress);
+    tapped.mouse.ApplyButtonAction(left, kRelease);
+    tapped.mouse.ApplyButtonAction(left, kPress);
+    ASSERT_EQ(tapped.mouse.GetButtonEdges(static_cast<U8>(left), edges), 3u);
+    EXPECT_TRUE(edges[0]);
+    EXPECT_FALSE(edges[1]);
+    EXPECT_TRUE(edges[2]);
+
+    // A single release stays a single event, and clearing empties the delta list
+    regrabbed.ClearFrameState();
+    EXPECT_TRUE(regrabbed.mouse.changedButtons.empty());
+    regrabbed.mouse.ApplyButtonAction(left, kRelease);
+    ASSERT_EQ(regrabbed.mouse.GetButtonEdges(static_cast<U8>(left), edges), 1u);
+    EXPECT_FALSE(edges[0]);
+}
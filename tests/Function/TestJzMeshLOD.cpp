@@ -0,0 +1,126 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Function/ECS/JzLODSystem.h"
+#include "JzRE/Runtime/Resource/JzMeshSimplifier.h"
+
+using namespace JzRE;
+
+namespace {
+
+// Build a UV sphere with per-corner vertices (like an unwelded OBJ import)
+void BuildSphere(U32 rings, U32 segments, std::vector<JzVertex> &vertices, std::vector<U32> &indices)
+{
+    constexpr F32 kPi = 3.14159265358979323846f;
+
+    auto pointAt = [&](U32 ring, U32 segment) {
+        // Wrap the seam onto the same position so it welds
+        segment         = segment % segments;
+        const F32 theta = kPi * static_cast<F32>(ring) / static_cast<F32>(rings);
+        const F32 phi   = 2.0f * kPi * static_cast<F32>(segment) / static_cast<F32>(segments);
+        JzVertex  v{};
+        v.Position  = JzVec3(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+        v.Normal    = v.Position;
+        v.TexCoords = JzVec2(0.0f, 0.0f);
+        if (ring == 0 || ring == rings) {
+            v.Position = JzVec3(0.0f, ring == 0 ? 1.0f : -1.0f, 0.0f);
+        }
+        return v;
+    };
+
+    for (U32 r = 0; r < rings; ++r) {
+        for (U32 s = 0; s < segments; ++s) {
+            const JzVertex quad[4] = {pointAt(r, s), pointAt(r + 1, s), pointAt(r + 1, s + 1), pointAt(r, s + 1)};
+            const U32      order[6] = {0, 1, 2, 0, 2, 3};
+            for (U32 i : order) {
+                indices.push_back(static_cast<U32>(vertices.size()));
+                vertices.push_back(quad[i]);
+            }
+        }
+    }
+}
+
+} // namespace
+
+// ==================== JzMeshSimplifier ====================
+
+TEST(JzMeshSimplifier, ReducesSphereTowardsTarget)
+{
+    std::vector<JzVertex> vertices;
+    std::vector<U32>      indices;
+    BuildSphere(24, 32, vertices, indices);
+
+    const Size target = indices.size() / 4;
+    auto       result = JzMeshSimplifier::Simplify(vertices, indices, target);
+
+    EXPECT_EQ(result.indices.size() % 3, 0u);
+    EXPECT_LE(result.indices.size(), indices.size() / 2);
+    EXPECT_GT(result.indices.size(), 0u);
+    EXPECT_GT(result.error, 0.0f);
+    EXPECT_LT(result.error, 0.5f);
+
+    for (U32 index : result.indices) {
+        ASSERT_LT(index, vertices.size());
+    }
+}
+
+TEST(JzMeshSimplifier, RespectsMaxError)
+{
+    std::vector<JzVertex> vertices;
+    std::vector<U32>      indices;
+    BuildSphere(16, 16, vertices, indices);
+
+    auto result = JzMeshSimplifier::Simplify(vertices, indices, 0, 0.01f);
+
+    EXPECT_LE(result.error, 0.01f);
+    EXPECT_GT(result.indices.size(), 0u);
+}
+
+TEST(JzMeshSimplifier, CompactVerticesRemapsIndices)
+{
+    std::vector<JzVertex> vertices(5);
+    for (U32 i = 0; i < vertices.size(); ++i) {
+        vertices[i].Position = JzVec3(static_cast<F32>(i), 0.0f, 0.0f);
+    }
+    std::vector<U32> indices = {4, 2, 4};
+
+    auto compacted = JzMeshSimplifier::CompactVertices(vertices, indices);
+
+    ASSERT_EQ(compacted.size(), 2u);
+    EXPECT_EQ(indices, (std::vector<U32>{0, 1, 0}));
+    EXPECT_FLOAT_EQ(compacted[0].Position.x, 4.0f);
+    EXPECT_FLOAT_EQ(compacted[1].Position.x, 2.0f);
+}
+
+// ==================== JzLODSystem::SelectLOD ====================
+
+TEST(JzLODSystem, SelectsCoarsestLevelUnderThreshold)
+{
+    const std::vector<F32> errors = {0.01f, 0.05f, 0.2f};
+
+    // 10 px per unit: projected errors 0.1, 0.5, 2.0 px
+    EXPECT_EQ(JzLODSystem::SelectLOD(errors, 0, 10.0f, 1.0f, 0.0f), 2u);
+    // 1000 px per unit: every level exceeds 1px
+    EXPECT_EQ(JzLODSystem::SelectLOD(errors, 2, 1000.0f, 1.0f, 0.0f), 0u);
+}
+
+TEST(JzLODSystem, HysteresisDelaysCoarsening)
+{
+    const std::vector<F32> errors = {0.1f};
+
+    // Projected error 0.9px: inside the 25% band, stay at LOD0
+    EXPECT_EQ(JzLODSystem::SelectLOD(errors, 0, 9.0f, 1.0f, 0.25f), 0u);
+    // Already at LOD1 with the same error: keep LOD1
+    EXPECT_EQ(JzLODSystem::SelectLOD(errors, 1, 9.0f, 1.0f, 0.25f), 1u);
+    // Well below the band: coarsen
+    EXPECT_EQ(JzLODSystem::SelectLOD(errors, 0, 5.0f, 1.0f, 0.25f), 1u);
+    // Above the threshold: refine immediately
+    EXPECT_EQ(JzLODSystem::SelectLOD(errors, 1, 11.0f, 1.0f, 0.25f), 0u);
+}
@@ -0,0 +1,180 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Core/JzThreadPool.h"
+#include "JzRE/Runtime/Function/Rendering/JzOcclusionCuller.h"
+
+using namespace JzRE;
+
+namespace {
+
+/**
+ * @brief Square wall facing +Z, owning the geometry its occluder points to.
+ */
+struct JzWall {
+    std::vector<JzVertex> vertices = std::vector<JzVertex>(4);
+    std::vector<U32>      indices{0, 1, 2, 0, 2, 3};
+    JzOccluderMesh        occluder;
+
+    JzWall(const JzVec3 &center, F32 size)
+    {
+        vertices[0].Position = JzVec3(-0.5f, -0.5f, 0.0f);
+        vertices[1].Position = JzVec3(0.5f, -0.5f, 0.0f);
+        vertices[2].Position = JzVec3(0.5f, 0.5f, 0.0f);
+        vertices[3].Position = JzVec3(-0.5f, 0.5f, 0.0f);
+
+        occluder.vertices     = &vertices;
+        occluder.indices      = &indices;
+        occluder.worldMatrix  = JzMat4x4::Translate(center) * JzMat4x4::Scale(JzVec3(size, size, 1.0f));
+        occluder.boundsCenter = center;
+        occluder.boundsRadius = size * 0.7072f;
+    }
+
+    JzWall(const JzWall &)            = delete;
+    JzWall &operator=(const JzWall &) = delete;
+};
+
+/**
+ * @brief Camera at the origin looking down -Z.
+ */
+void BeginCameraFrame(JzOcclusionCuller &culler)
+{
+    const JzMat4 view = JzMat4x4::LookAt(JzVec3(0.0f, 0.0f, 0.0f), JzVec3(0.0f, 0.0f, -1.0f), JzVec3(0.0f, 1.0f, 0.0f));
+    const JzMat4 projection = JzMat4x4::Perspective(1.0472f, 2.0f, 0.1f, 100.0f);
+    culler.BeginFrame(view, projection);
+}
+
+} // namespace
+
+TEST(JzOcclusionCuller, WallHidesObjectsBehindIt)
+{
+    const JzWall      wall(JzVec3(0.0f, 0.0f, -10.0f), 8.0f);
+    JzOcclusionCuller culler;
+    BeginCameraFrame(culler);
+    culler.AddOccluder(wall.occluder);
+    culler.Rasterize();
+
+    EXPECT_TRUE(culler.IsOccluded(JzVec3(0.0f, 0.0f, -20.0f), 1.0f));
+    EXPECT_TRUE(culler.IsOccluded(JzVec3(1.5f, -1.0f, -30.0f), 2.0f));
+
+    // In front of the wall, straddling it, or peeking out past its edge
+    EXPECT_FALSE(culler.IsOccluded(JzVec3(0.0f, 0.0f, -5.0f), 1.0f));
+    EXPECT_FALSE(culler.IsOccluded(JzVec3(0.0f, 0.0f, -10.0f), 1.0f));
+    EXPECT_FALSE(culler.IsOccluded(JzVec3(8.0f, 0.0f, -20.0f), 1.0f));
+
+    // Crossing the near plane or off screen
+    EXPECT_FALSE(culler.IsOccluded(JzVec3(0.0f, 0.0f, 0.0f), 1.0f));
+    EXPECT_FALSE(culler.IsOccluded(JzVec3(0.0f, 0.0f, 10.0f), 1.0f));
+}
+
+TEST(JzOcclusionCuller, BackFacingOccludersStillOcclude)
+{
+    JzWall wall(JzVec3(0.0f, 0.0f, -10.0f), 8.0f);
+    std::swap(wall.indices[1], wall.indices[2]);
+    std::swap(wall.indices[4], wall.indices[5]);
+
+    JzOcclusionCuller culler;
+    BeginCameraFrame(culler);
+    culler.AddOccluder(wall.occluder);
+    culler.Rasterize();
+
+    EXPECT_TRUE(culler.IsOccluded(JzVec3(0.0f, 0.0f, -20.0f), 1.0f));
+}
+
+TEST(JzOcclusionCuller, NothingIsOccludedWithoutOccluders)
+{
+    JzOcclusionCuller culler;
+    BeginCameraFrame(culler);
+    culler.Rasterize();
+
+    EXPECT_FALSE(culler.IsOccluded(JzVec3(0.0f, 0.0f, -20.0f), 1.0f));
+    EXPECT_EQ(culler.GetStats().occluders, 0u);
+}
+
+TEST(JzOcclusionCuller, DropsOccludersCrossingTheNearPlane)
+{
+    JzOcclusionCuller culler;
+    BeginCameraFrame(culler);
+
+    // A floor running under the camera would need clipping; it is skipped instead
+    JzWall floor(JzVec3(0.0f, -1.0f, 0.0f), 50.0f);
+    floor.occluder.worldMatrix = JzMat4x4::Translate(JzVec3(0.0f, -1.0f, 0.0f)) * JzMat4x4::RotateX(-1.5707963f) *
+                                 JzMat4x4::Scale(JzVec3(50.0f, 50.0f, 1.0f));
+    culler.AddOccluder(floor.occluder);
+    culler.Rasterize();
+
+    EXPECT_FALSE(culler.IsOccluded(JzVec3(0.0f, -3.0f, -20.0f), 1.0f));
+}
+
+TEST(JzOcclusionCuller, KeepsTheLargestOccludersWithinBudget)
+{
+    const JzWall        smallWall(JzVec3(-30.0f, 0.0f, -40.0f), 2.0f);
+    const JzWall        bigWall(JzVec3(0.0f, 0.0f, -10.0f), 8.0f);
+    JzOcclusionSettings settings;
+    settings.maxOccluders = 1;
+
+    JzOcclusionCuller culler(settings);
+    BeginCameraFrame(culler);
+    culler.AddOccluder(smallWall.occluder);
+    culler.AddOccluder(bigWall.occluder);
+    culler.Rasterize();
+
+    EXPECT_EQ(culler.GetStats().occluders, 1u);
+    EXPECT_EQ(culler.GetStats().occluderTriangles, 2u);
+    EXPECT_TRUE(culler.IsOccluded(JzVec3(0.0f, 0.0f, -20.0f), 1.0f));
+    EXPECT_FALSE(culler.IsOccluded(JzVec3(-45.0f, 0.0f, -60.0f), 0.5f));
+
+    // A triangle budget too small for the wall leaves nothing to rasterize
+    settings.maxOccluders         = 8;
+    settings.maxOccluderTriangles = 1;
+    culler.SetSettings(settings);
+    BeginCameraFrame(culler);
+    culler.AddOccluder(bigWall.occluder);
+    culler.Rasterize();
+
+    EXPECT_EQ(culler.GetStats().occluders, 0u);
+    EXPECT_FALSE(culler.IsOccluded(JzVec3(0.0f, 0.0f, -20.0f), 1.0f));
+}
+
+TEST(JzOcclusionCuller, ThreadedResultsMatchSerial)
+{
+    const JzWall   leftWall(JzVec3(-3.0f, 0.0f, -10.0f), 6.0f);
+    const JzWall   rightWall(JzVec3(4.0f, 1.0f, -12.0f), 5.0f);
+    JzThreadPool   threadPool(4);
+    std::vector<JzVec4> spheres;
+    for (I32 y = -10; y <= 10; ++y) {
+        for (I32 x = -20; x <= 20; ++x) {
+            spheres.emplace_back(static_cast<F32>(x), static_cast<F32>(y) * 0.5f, -25.0f, 0.4f);
+        }
+    }
+
+    std::vector<U8> results[2];
+    for (U32 run = 0; run < 2; ++run) {
+        JzOcclusionCuller culler;
+        culler.SetThreadPool(run == 0 ? nullptr : &threadPool);
+        BeginCameraFrame(culler);
+        culler.AddOccluder(leftWall.occluder);
+        culler.AddOccluder(rightWall.occluder);
+        culler.Rasterize();
+        culler.TestSpheres(spheres, results[run]);
+
+        const auto &stats = culler.GetStats();
+        EXPECT_EQ(stats.occluders, 2u);
+        EXPECT_EQ(stats.tested, spheres.size());
+        EXPECT_GT(stats.occluded, 0u);
+        EXPECT_LT(stats.occluded, spheres.size());
+
+        U32 occluded = 0;
+        for (U8 result : results[run]) {
+            occluded += result;
+        }
+        EXPECT_EQ(occluded, stats.occluded);
+    }
+    EXPECT_EQ(results[0], results[1]);
+}
@@ -0,0 +1,173 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Function/Project/JzProjectFileIndex.h"
+
+using namespace JzRE;
+
+namespace {
+
+namespace fs = std::filesystem;
+
+class JzProjectFileIndexTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        const String testName = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        root                  = JzFileWatcher::NormalizePath(fs::temp_directory_path() / ("JzREProjectFileIndexTest_" + testName));
+        fs::remove_all(root);
+        fs::create_directories(root / "Textures");
+        fs::create_directories(root / "models" / "props");
+        WriteFile(root / "readme.txt", "hello");
+        WriteFile(root / "Textures" / "b.png", "b");
+        WriteFile(root / "Textures" / "A.png", "a");
+        WriteFile(root / "models" / "props" / "crate.obj", "o crate");
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(root);
+    }
+
+    static void WriteFile(const fs::path &path, const String &content)
+    {
+        std::ofstream stream(path);
+        stream << content;
+    }
+
+    static void WaitReady(JzProjectFileIndex &index)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (index.IsBuilding() && std::chrono::steady_clock::now() < deadline) {
+            index.Update();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    static std::vector<String> Names(const std::vector<JzProjectFileEntry> *entries)
+    {
+        std::vector<String> names;
+        if (entries) {
+            for (const auto &entry : *entries) {
+                names.push_back(entry.name);
+            }
+        }
+        return names;
+    }
+
+    fs::path root;
+};
+
+} // namespace
+
+TEST_F(JzProjectFileIndexTest, BackgroundBuildListsDirectoriesFirstSortedByName)
+{
+    JzProjectFileIndex index(root);
+    EXPECT_FALSE(index.IsReady());
+
+    index.Rebuild();
+    WaitReady(index);
+
+    ASSERT_TRUE(index.IsReady());
+    EXPECT_EQ(Names(index.GetEntries(root)), (std::vector<String>{"models", "Textures", "readme.txt"}));
+    EXPECT_EQ(Names(index.GetEntries(root / "Textures")), (std::vector<String>{"A.png", "b.png"}));
+    EXPECT_EQ(Names(index.GetEntries(root / "models" / "props")), (std::vector<String>{"crate.obj"}));
+
+    const auto *readme = index.Find(root / "readme.txt");
+    ASSERT_NE(readme, nullptr);
+    EXPECT_FALSE(readme->isDirectory);
+    EXPECT_EQ(readme->size, 5u);
+}
+
+TEST_F(JzProjectFileIndexTest, ChangesUpdateOnlyTheAffectedListing)
+{
+    JzProjectFileIndex index(root);
+    index.Rebuild();
+    WaitReady(index);
+
+    fs::create_directories(root / "Audio" / "Music");
+    WriteFile(root / "Audio" / "Music" / "theme.ogg", "ogg");
+    fs::remove(root / "Textures" / "b.png");
+
+    const U64 version = index.GetVersion();
+    index.ApplyChanges({
+        {root / "Audio", JzEFileChangeKind::Added},
+        {root / "Textures" / "b.png", JzEFileChangeKind::Removed},
+    });
+
+    EXPECT_GT(index.GetVersion(), version);
+    EXPECT_EQ(Names(index.GetEntries(root)), (std::vector<String>{"Audio", "models", "Textures", "readme.txt"}));
+    EXPECT_EQ(Names(index.GetEntries(root / "Audio" / "Music")), (std::vector<String>{"theme.ogg"}));
+    EXPECT_EQ(Names(index.GetEntries(root / "Textures")), (std::vector<String>{"A.png"}));
+
+    fs::remove_all(root / "models");
+    index.ApplyChanges({{root / "models", JzEFileChangeKind::Removed}});
+
+    EXPECT_EQ(index.GetEntries(root / "models"), nullptr);
+    EXPECT_EQ(index.GetEntries(root / "models" / "props"), nullptr);
+}
+
+TEST_F(JzProjectFileIndexTest, RenamedDirectoryMovesItsSubtree)
+{
+    JzProjectFileIndex index(root);
+    index.Rebuild();
+    WaitReady(index);
+
+    fs::rename(root / "models", root / "meshes");
+    index.ApplyChanges({{root / "meshes", JzEFileChangeKind::Renamed, root / "models"}});
+
+    EXPECT_EQ(Names(index.GetEntries(root)), (std::vector<String>{"meshes", "Textures", "readme.txt"}));
+    EXPECT_EQ(index.GetEntries(root / "models" / "props"), nullptr);
+    EXPECT_EQ(Names(index.GetEntries(root / "meshes" / "props")), (std::vector<String>{"crate.obj"}));
+}
+
+TEST_F(JzProjectFileIndexTest, ModificationBumpsRevision)
+{
+    JzProjectFileIndex index(root);
+    index.Rebuild();
+    WaitReady(index);
+
+    const U64 revision = index.Find(root / "readme.txt")->revision;
+
+    WriteFile(root / "readme.txt", "hello world");
+    index.ApplyChanges({{root / "readme.txt", JzEFileChangeKind::Modified}});
+
+    const auto *readme = index.Find(root / "readme.txt");
+    ASSERT_NE(readme, nullptr);
+    EXPECT_NE(readme->revision, revision);
+    EXPECT_EQ(readme->size, 11u);
+}
+
+TEST_F(JzProjectFileIndexTest, ChangesDuringBuildAreAppliedAfterIt)
+{
+    JzProjectFileIndex index(root);
+    index.Rebuild();
+
+    WriteFile(root / "late.txt", "late");
+    index.ApplyChanges({{root / "late.txt", JzEFileChangeKind::Added}});
+    WaitReady(index);
+
+    EXPECT_NE(index.Find(root / "late.txt"), nullptr);
+}
+
+TEST_F(JzProjectFileIndexTest, ChangeInUnindexedDirectoryIndexesItsParent)
+{
+    JzProjectFileIndex index(root);
+    index.Rebuild();
+    WaitReady(index);
+
+    fs::create_directories(root / "Scenes" / "Levels");
+    WriteFile(root / "Scenes" / "Levels" / "one.jzscene", "{}");
+    index.ApplyChanges({{root / "Scenes" / "Levels" / "one.jzscene", JzEFileChangeKind::Added}});
+
+    EXPECT_NE(index.Find(root / "Scenes"), nullptr);
+    EXPECT_NE(index.Find(root / "Scenes" / "Levels" / "one.jzscene"), nullptr);
+}
@@ -0,0 +1,279 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Function/Rendering/JzRenderGraph.h"
+#include "JzRE/Runtime/Platform/RHI/JzDevice.h"
+
+using namespace JzRE;
+
+namespace {
+
+// Device that hands out plain command lists and creates no GPU objects
+class JzRecordingDevice final : public JzDevice {
+public:
+    JzRecordingDevice() :
+        JzDevice(JzERHIType::Unknown) { }
+
+    String GetDeviceName() const override { return "Recording"; }
+    String GetVendorName() const override { return "JzRE"; }
+    String GetDriverVersion() const override { return "0"; }
+
+    std::shared_ptr<JzGPUBufferObject> CreateBuffer(const JzGPUBufferObjectDesc &) override { return nullptr; }
+    std::shared_ptr<JzGPUTextureObject> CreateTexture(const JzGPUTextureObjectDesc &) override { return nullptr; }
+    std::shared_ptr<JzGPUShaderProgramObject> CreateShader(const JzShaderProgramDesc &) override { return nullptr; }
+    std::shared_ptr<JzRHIPipeline> CreatePipeline(const JzPipelineDesc &) override { return nullptr; }
+    std::shared_ptr<JzGPUFramebufferObject> CreateFramebuffer(const String &) override { return nullptr; }
+    std::shared_ptr<JzGPUVertexArrayObject> CreateVertexArray(const String &) override { return nullptr; }
+
+    std::shared_ptr<JzRHICommandList> CreateCommandList(const String &debugName) override
+    {
+        return std::make_shared<JzRHICommandList>(debugName);
+    }
+
+    void ExecuteCommandList(std::shared_ptr<JzRHICommandList>) override { }
+    void ExecuteCommandLists(const std::vector<std::shared_ptr<JzRHICommandList>> &) override { }
+    void BeginFrame() override { }
+    void EndFrame() override { }
+    void Flush() override { }
+    void Finish() override { }
+    Bool SupportsMultithreading() const override { return false; }
+    Bool SupportsMultiDrawIndirect() const override { return false; }
+    const JzRHIStats &GetStats() const override { return m_stats; }
+
+private:
+    JzRHIStats m_stats;
+};
+
+struct JzRecordedTransitions {
+    String                      passName;
+    std::vector<JzRGTransition> transitions;
+};
+
+// Compile and execute the graph, returning every transition callback in order
+std::vector<JzRecordedTransitions> CompileAndExecute(JzRenderGraph &graph)
+{
+    std::vector<JzRecordedTransitions> recorded;
+    graph.SetTransitionCallback([&recorded](JzRHICommandList &, const JzRGPassDesc &pass,
+                                            const std::vector<JzRGTransition> &transitions) {
+        recorded.push_back({pass.name, transitions});
+    });
+
+    JzRecordingDevice device;
+    graph.Compile();
+    graph.Execute(device);
+    return recorded;
+}
+
+JzRGTexture CreateTarget(JzRenderGraph &graph, const String &name)
+{
+    return graph.CreateTexture({{64, 64}, JzETextureResourceFormat::RGBA8, true, name});
+}
+
+// Pass that renders into the targets and reports the attachment ops it executed with
+JzRGPassDesc RenderPass(const String &name, JzRGTexture color, JzRGTexture depth,
+                        std::vector<JzRHIAttachmentOps> &executed)
+{
+    return {name, nullptr,
+            [=](JzRGBuilder &builder) {
+                if (color.id != 0) {
+                    builder.Write(color);
+                }
+                if (depth.id != 0) {
+                    builder.Write(depth);
+                }
+                builder.SetRenderTarget(color, depth);
+            },
+            [&executed](const JzRGPassContext &context) { executed.push_back(context.attachmentOps); }};
+}
+
+} // namespace
+
+TEST(JzRenderGraph, AttachmentWriteThenSampleResolvesPreciseUsages)
+{
+    JzRenderGraph graph;
+    auto          color = CreateTarget(graph, "Color");
+    auto          depth = graph.CreateTexture({{64, 64}, JzETextureResourceFormat::Depth24, true, "Depth"});
+
+    graph.AddPass({"Scene", nullptr, [=](JzRGBuilder &builder) {
+                       builder.Write(color);
+                       builder.Write(depth);
+                       builder.SetRenderTarget(color, depth);
+                   },
+                   nullptr});
+    graph.AddPass({"Post", nullptr, [=](JzRGBuilder &builder) { builder.Read(color); }, nullptr});
+
+    const auto recorded = CompileAndExecute(graph);
+    ASSERT_EQ(recorded.size(), 1u);
+    EXPECT_EQ(recorded[0].passName, "Post");
+    ASSERT_EQ(recorded[0].transitions.size(), 1u);
+
+    const auto &transition = recorded[0].transitions[0];
+    EXPECT_EQ(transition.type, JzRGResourceType::Texture);
+    EXPECT_EQ(transition.id, color.id);
+    EXPECT_EQ(transition.beforeUsage, JzERHIResourceUsage::ColorAttachment);
+    EXPECT_EQ(transition.afterUsage, JzERHIResourceUsage::ShaderRead);
+    EXPECT_EQ(transition.split, JzERHIBarrierSplit::None);
+}
+
+TEST(JzRenderGraph, WriteAfterWriteNeedsBarrierButReadAfterReadDoesNot)
+{
+    JzRenderGraph graph;
+    auto          color = CreateTarget(graph, "Color");
+
+    const auto drawInto = [=](JzRGBuilder &builder) {
+        builder.Write(color);
+        builder.SetRenderTarget(color);
+    };
+    const auto sample = [=](JzRGBuilder &builder) { builder.Read(color); };
+
+    graph.AddPass({"Geometry", nullptr, drawInto, nullptr});
+    graph.AddPass({"Overlay", nullptr, drawInto, nullptr});
+    graph.AddPass({"Bloom", nullptr, sample, nullptr});
+    graph.AddPass({"Tonemap", nullptr, sample, nullptr});
+
+    const auto recorded = CompileAndExecute(graph);
+    ASSERT_EQ(recorded.size(), 2u);
+
+    EXPECT_EQ(recorded[0].passName, "Overlay");
+    ASSERT_EQ(recorded[0].transitions.size(), 1u);
+    EXPECT_EQ(recorded[0].transitions[0].beforeUsage, JzERHIResourceUsage::ColorAttachment);
+    EXPECT_EQ(recorded[0].transitions[0].afterUsage, JzERHIResourceUsage::ColorAttachment);
+
+    EXPECT_EQ(recorded[1].passName, "Bloom");
+}
+
+TEST(JzRenderGraph, SlackBetweenProducerAndConsumerSplitsTheBarrier)
+{
+    JzRenderGraph graph;
+    auto          shadow = graph.CreateTexture({{64, 64}, JzETextureResourceFormat::Depth24, true, "Shadow"});
+    auto          color  = CreateTarget(graph, "Color");
+
+    graph.AddPass({"Shadow", nullptr, [=](JzRGBuilder &builder) {
+                       builder.Write(shadow);
+                       builder.SetRenderTarget({}, shadow);
+                   },
+                   nullptr});
+    graph.AddPass({"Sky", nullptr, [=](JzRGBuilder &builder) {
+                       builder.Write(color);
+                       builder.SetRenderTarget(color);
+                   },
+                   nullptr});
+    graph.AddPass({"Lighting", nullptr, [=](JzRGBuilder &builder) { builder.Read(shadow); }, nullptr});
+
+    const auto recorded = CompileAndExecute(graph);
+    ASSERT_EQ(recorded.size(), 2u);
+
+    // Begin half right after the producer, End half right before the consumer
+    EXPECT_EQ(recorded[0].passName, "Shadow");
+    ASSERT_EQ(recorded[0].transitions.size(), 1u);
+    EXPECT_EQ(recorded[0].transitions[0].split, JzERHIBarrierSplit::Begin);
+    EXPECT_EQ(recorded[0].transitions[0].beforeUsage, JzERHIResourceUsage::DepthStencilWrite);
+    EXPECT_EQ(recorded[0].transitions[0].afterUsage, JzERHIResourceUsage::ShaderRead);
+
+    EXPECT_EQ(recorded[1].passName, "Lighting");
+    ASSERT_EQ(recorded[1].transitions.size(), 1u);
+    EXPECT_EQ(recorded[1].transitions[0].split, JzERHIBarrierSplit::End);
+    EXPECT_EQ(recorded[1].transitions[0].splitId, recorded[0].transitions[0].splitId);
+    EXPECT_NE(recorded[1].transitions[0].splitId, 0u);
+}
+
+TEST(JzRenderGraph, BufferUsagesFollowPassAndBufferType)
+{
+    JzRenderGraph graph;
+    auto          args = graph.CreateBuffer(
+        {256, JzEGPUBufferObjectType::Indirect, JzEGPUBufferObjectUsage::DynamicDraw, true, "DrawArgs"});
+    auto staging = CreateTarget(graph, "Staging");
+
+    JzRGPassDesc upload{"Upload", nullptr, [=](JzRGBuilder &builder) { builder.Write(staging); }, nullptr};
+    upload.type = JzERHIPassType::Transfer;
+    graph.AddPass(upload);
+
+    JzRGPassDesc cull{"Cull", nullptr, [=](JzRGBuilder &builder) {
+                          builder.Read(staging);
+                          builder.Write(args);
+                      },
+                      nullptr};
+    cull.type = JzERHIPassType::Compute;
+    graph.AddPass(cull);
+
+    graph.AddPass({"Draw", nullptr, [=](JzRGBuilder &builder) { builder.Read(args); }, nullptr});
+
+    const auto recorded = CompileAndExecute(graph);
+    ASSERT_EQ(recorded.size(), 2u);
+
+    EXPECT_EQ(recorded[0].passName, "Cull");
+    ASSERT_EQ(recorded[0].transitions.size(), 1u);
+    EXPECT_EQ(recorded[0].transitions[0].beforeUsage, JzERHIResourceUsage::TransferDst);
+    EXPECT_EQ(recorded[0].transitions[0].beforePass, JzERHIPassType::Transfer);
+    EXPECT_EQ(recorded[0].transitions[0].afterUsage, JzERHIResourceUsage::ShaderRead);
+    EXPECT_EQ(recorded[0].transitions[0].afterPass, JzERHIPassType::Compute);
+
+    EXPECT_EQ(recorded[1].passName, "Draw");
+    ASSERT_EQ(recorded[1].transitions.size(), 1u);
+    EXPECT_EQ(recorded[1].transitions[0].type, JzRGResourceType::Buffer);
+    EXPECT_EQ(recorded[1].transitions[0].beforeUsage, JzERHIResourceUsage::ShaderWrite);
+    EXPECT_EQ(recorded[1].transitions[0].afterUsage, JzERHIResourceUsage::IndirectBuffer);
+    EXPECT_EQ(recorded[1].transitions[0].afterPass, JzERHIPassType::Graphics);
+}
+
+TEST(JzRenderGraph, FirstWriterClearsAndLaterWritersLoad)
+{
+    JzRenderGraph                   graph;
+    std::vector<JzRHIAttachmentOps> executed;
+    auto                            color = CreateTarget(graph, "Color");
+    auto                            depth = graph.CreateTexture({{64, 64}, JzETextureResourceFormat::Depth24, true, "Depth"});
+
+    graph.AddPass(RenderPass("Opaque", color, depth, executed));
+    graph.AddPass(RenderPass("Transparent", color, depth, executed));
+    graph.AddPass({"Post", nullptr, [=](JzRGBuilder &builder) { builder.Read(color); }, nullptr});
+
+    CompileAndExecute(graph);
+    ASSERT_EQ(executed.size(), 2u);
+
+    EXPECT_EQ(executed[0].colorLoad, JzERHILoadOp::Clear);
+    EXPECT_EQ(executed[0].depthLoad, JzERHILoadOp::Clear);
+    EXPECT_EQ(executed[1].colorLoad, JzERHILoadOp::Load);
+    EXPECT_EQ(executed[1].depthLoad, JzERHILoadOp::Load);
+
+    // Depth dies with the frame once the last writer is done, color is still sampled
+    EXPECT_EQ(executed[0].depthStore, JzERHIStoreOp::Store);
+    EXPECT_EQ(executed[1].depthStore, JzERHIStoreOp::DontCare);
+    EXPECT_EQ(executed[1].colorStore, JzERHIStoreOp::Store);
+}
+
+TEST(JzRenderGraph, PersistentTargetsAreAlwaysStored)
+{
+    JzRenderGraph                   graph;
+    std::vector<JzRHIAttachmentOps> executed;
+    auto                            history = graph.CreateTexture({{64, 64}, JzETextureResourceFormat::RGBA8, false, "History"});
+
+    graph.AddPass(RenderPass("Accumulate", history, {}, executed));
+
+    CompileAndExecute(graph);
+    ASSERT_EQ(executed.size(), 1u);
+    EXPECT_EQ(executed[0].colorStore, JzERHIStoreOp::Store);
+}
+
+TEST(JzRenderGraph, SkippedFirstWriterHandsTheClearToTheNextWriter)
+{
+    JzRenderGraph                   graph;
+    std::vector<JzRHIAttachmentOps> executed;
+    auto                            color = CreateTarget(graph, "Color");
+
+    auto skipped           = RenderPass("Sky", color, {}, executed);
+    skipped.enabledExecute = [] { return false; };
+    graph.AddPass(skipped);
+    graph.AddPass(RenderPass("Opaque", color, {}, executed));
+    graph.AddPass({"Post", nullptr, [=](JzRGBuilder &builder) { builder.Read(color); }, nullptr});
+
+    CompileAndExecute(graph);
+    ASSERT_EQ(executed.size(), 1u);
+    EXPECT_EQ(executed[0].colorLoad, JzERHILoadOp::Clear);
+}
@@ -0,0 +1,79 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Function/Rendering/JzRenderSnapshot.h"
+
+using namespace JzRE;
+
+TEST(JzRenderSnapshotBuffer, WritesStayHiddenUntilPublished)
+{
+    JzRenderSnapshotBuffer buffer;
+
+    auto &first     = buffer.BeginWrite();
+    first.frameSize = JzIVec2(640, 480);
+    first.draws.emplace_back();
+    EXPECT_EQ(buffer.GetPublished().frameIndex, 0u);
+    EXPECT_TRUE(buffer.GetPublished().draws.empty());
+
+    buffer.Publish();
+    EXPECT_EQ(buffer.GetPublished().frameIndex, 1u);
+    EXPECT_EQ(buffer.GetPublished().frameSize.x, 640);
+    EXPECT_EQ(buffer.GetPublished().draws.size(), 1u);
+
+    // The next frame is written to the other slot while frame 1 stays readable
+    auto &second = buffer.BeginWrite();
+    EXPECT_NE(&second, &buffer.GetPublished());
+    EXPECT_TRUE(second.draws.empty());
+    EXPECT_EQ(second.frameIndex, 2u);
+    EXPECT_EQ(buffer.GetPublished().draws.size(), 1u);
+
+    buffer.Publish();
+    EXPECT_EQ(buffer.GetPublished().frameIndex, 2u);
+    EXPECT_TRUE(buffer.GetPublished().draws.empty());
+}
+
+TEST(JzRenderSnapshot, FindCameraPrefersRequestedThenMainCamera)
+{
+    JzRenderSnapshot snapshot;
+    EXPECT_EQ(snapshot.FindCamera(INVALID_ENTITY), nullptr);
+
+    auto &side        = snapshot.cameras.emplace_back();
+    side.entity       = static_cast<JzEntity>(1);
+    side.isMainCamera = false;
+    auto &main        = snapshot.cameras.emplace_back();
+    main.entity       = static_cast<JzEntity>(2);
+    main.isMainCamera = true;
+
+    EXPECT_EQ(snapshot.FindCamera(INVALID_ENTITY)->entity, static_cast<JzEntity>(2));
+    EXPECT_EQ(snapshot.FindCamera(static_cast<JzEntity>(1))->entity, static_cast<JzEntity>(1));
+    EXPECT_EQ(snapshot.FindCamera(static_cast<JzEntity>(7))->entity, static_cast<JzEntity>(2));
+}
+
+TEST(JzRenderSnapshotBuffer, BeginWriteReleasesTargetsOfTheOldFrame)
+{
+    JzRenderSnapshotBuffer buffer;
+    auto                   output = std::make_shared<JzRenderOutput>("Target_Output");
+
+    auto &first  = buffer.BeginWrite();
+    auto &target = first.targets.emplace_back();
+    target.name  = "Target";
+    target.output = output;
+    first.contributions.emplace_back().name = "Overlay";
+    buffer.Publish();
+
+    // The published frame keeps the output alive after the render system drops it
+    EXPECT_EQ(output.use_count(), 2);
+    ASSERT_EQ(buffer.GetPublished().targets.size(), 1u);
+    EXPECT_EQ(buffer.GetPublished().contributions.size(), 1u);
+
+    buffer.BeginWrite();
+    buffer.Publish();
+    buffer.BeginWrite();
+    EXPECT_EQ(output.use_count(), 1);
+}
@@ -10,6 +10,7 @@
 #include <fstream>
 #include <thread>
 
+#include "JzRE/Runtime/Core/JzServiceContainer.h"
 #include "JzRE/Runtime/Function/Script/JzScriptComponent.h"
 #include "JzRE/Runtime/Function/Script/JzScriptContext.h"
 #include "JzRE/Runtime/Function/Script/JzScriptSystem.h"
@@ -243,6 +244,46 @@ TEST_F(JzScriptContextTest, HotReloadReplacesFunction)
     EXPECT_FALSE(ok); // v2 always errors
 }
 
+TEST(JzScriptContextWatcher, HotReloadFollowsFileNotifications)
+{
+    JzServiceScope services;
+
+    JzFileWatcherConfig watcherConfig;
+    watcherConfig.debounceSeconds     = 0.0f;
+    watcherConfig.pollIntervalSeconds = 0.0f;
+    watcherConfig.forcePolling        = true;
+    JzFileWatcher watcher(watcherConfig);
+    JzServiceContainer::Provide<JzFileWatcher>(watcher);
+
+    JzWorld         world;
+    JzScriptContext ctx;
+    ctx.Initialize(world);
+
+    JzEntity entity = world.CreateEntity();
+    world.AddComponent<JzScriptComponent>(entity, JzScriptComponent{"test.lua", true});
+
+    auto dir = std::filesystem::temp_directory_path() / "JzREWatchedScripts";
+    std::filesystem::create_directories(dir);
+    auto path = dir / "watched.lua";
+
+    { std::ofstream f(path); f << "function OnUpdate(entity, dt) end\n"; }
+    ASSERT_TRUE(ctx.LoadScript(entity, path.string()));
+
+    // No notification yet: nothing is reloaded even with a large delta
+    ctx.CheckHotReload(10.0f);
+    EXPECT_TRUE(ctx.CallOnUpdate(entity, 0.016f));
+
+    { std::ofstream f(path); f << "function OnUpdate(entity, dt)\n  error('v2')\nend\n"; }
+    watcher.Update(0.0f);
+    ctx.CheckHotReload(0.0f);
+
+    EXPECT_FALSE(ctx.CallOnUpdate(entity, 0.016f));
+    EXPECT_FALSE(world.GetComponent<JzScriptComponent>(entity).started);
+
+    ctx.Shutdown();
+    std::filesystem::remove_all(dir);
+}
+
 // ---------------------------------------------------------------------------
 // JzScriptSystem: integration through ECS world
 // ---------------------------------------------------------------------------
@@ -44,6 +44,19 @@ public:
     {
         MarkParametersCommitted();
     }
+
+    JzRE::Bool IsReady() override
+    {
+        return ready;
+    }
+
+    JzRE::Bool HasFailed() override
+    {
+        return failed;
+    }
+
+    JzRE::Bool ready  = true;
+    JzRE::Bool failed = false;
 };
 
 class JzTestDevice final : public JzRE::JzDevice {
@@ -84,8 +97,11 @@ public:
 
     std::shared_ptr<JzRE::JzRHIPipeline> CreatePipeline(const JzRE::JzPipelineDesc &desc) override
     {
-        m_lastPipelineDesc = desc;
-        return std::make_shared<JzTestPipeline>(desc);
+        m_lastPipelineDesc    = desc;
+        m_lastPipeline        = std::make_shared<JzTestPipeline>(desc);
+        m_lastPipeline->ready = !m_asyncCompile;
+        m_pipelineCount++;
+        return m_lastPipeline;
     }
 
     std::shared_ptr<JzRE::JzGPUFramebufferObject> CreateFramebuffer(const JzRE::String &) override
@@ -114,13 +130,45 @@ public:
         return false;
     }
 
+    JzRE::Bool SupportsMultiDrawIndirect() const override
+    {
+        return false;
+    }
+
+    const JzRE::JzRHIStats &GetStats() const override
+    {
+        return m_stats;
+    }
+
     const JzRE::JzPipelineDesc &GetLastPipelineDesc() const
     {
         return m_lastPipelineDesc;
     }
 
+    /**
+     * @brief Pipelines created from now on keep compiling until marked ready.
+     */
+    void SetAsyncCompile(JzRE::Bool async)
+    {
+        m_asyncCompile = async;
+    }
+
+    const std::shared_ptr<JzTestPipeline> &GetLastPipeline() const
+    {
+        return m_lastPipeline;
+    }
+
+    JzRE::U32 GetPipelineCount() const
+    {
+        return m_pipelineCount;
+    }
+
 private:
-    JzRE::JzPipelineDesc m_lastPipelineDesc{};
+    JzRE::JzPipelineDesc            m_lastPipelineDesc{};
+    JzRE::JzRHIStats                m_stats{};
+    std::shared_ptr<JzTestPipeline> m_lastPipeline;
+    JzRE::Bool                      m_asyncCompile  = false;
+    JzRE::U32                       m_pipelineCount = 0;
 };
 
 std::filesystem::path MakeTempDirectory(const char *suffix)
@@ -394,3 +442,95 @@ TEST(JzShaderCooked, RejectsMissingBlobFile)
 
     CleanupPath(tempDir);
 }
+
+TEST(JzShaderCooked, PendingVariantFallsBackUntilCompiled)
+{
+    const auto tempDir = MakeTempDirectory("pending_variant");
+    CleanupPath(tempDir);
+    ASSERT_TRUE(WriteCookedShader(tempDir, BuildBaseManifest()));
+
+    JzRE::JzServiceContainer::Init();
+    JzTestDevice testDevice(JzRE::JzERHIType::OpenGL);
+    JzRE::JzServiceContainer::Provide<JzRE::JzDevice>(testDevice);
+
+    JzRE::JzShader shader((tempDir / "unit_shader.jzshader").string());
+    ASSERT_TRUE(shader.Load());
+    ASSERT_NE(shader.GetMainVariant(), nullptr);
+
+    testDevice.SetAsyncCompile(true);
+    EXPECT_EQ(shader.GetVariant(1), nullptr);
+    EXPECT_TRUE(shader.IsVariantPending(1));
+    EXPECT_FALSE(shader.IsVariantPending(0));
+
+    // Asking again while it compiles does not start another compile
+    const auto pipelineCount = testDevice.GetPipelineCount();
+    EXPECT_EQ(shader.GetVariant(1), nullptr);
+    EXPECT_EQ(testDevice.GetPipelineCount(), pipelineCount);
+
+    const auto variant = testDevice.GetLastPipeline();
+    variant->ready     = true;
+    EXPECT_EQ(shader.GetVariant(1), variant);
+    EXPECT_FALSE(shader.IsVariantPending(1));
+    EXPECT_NE(shader.GetMainVariant(), variant);
+
+    CleanupPath(tempDir);
+}
+
+TEST(JzShaderCooked, FailedVariantStaysOnFallback)
+{
+    const auto tempDir = MakeTempDirectory("failed_variant");
+    CleanupPath(tempDir);
+    ASSERT_TRUE(WriteCookedShader(tempDir, BuildBaseManifest()));
+
+    JzRE::JzServiceContainer::Init();
+    JzTestDevice testDevice(JzRE::JzERHIType::OpenGL);
+    JzRE::JzServiceContainer::Provide<JzRE::JzDevice>(testDevice);
+
+    JzRE::JzShader shader((tempDir / "unit_shader.jzshader").string());
+    ASSERT_TRUE(shader.Load());
+
+    testDevice.SetAsyncCompile(true);
+    EXPECT_EQ(shader.GetVariant(1), nullptr);
+
+    const auto variant = testDevice.GetLastPipeline();
+    variant->ready     = true;
+    variant->failed    = true;
+
+    const auto pipelineCount = testDevice.GetPipelineCount();
+    EXPECT_EQ(shader.GetVariant(1), nullptr);
+    EXPECT_FALSE(shader.IsVariantPending(1));
+    EXPECT_EQ(testDevice.GetPipelineCount(), pipelineCount);
+    EXPECT_NE(shader.GetMainVariant(), nullptr);
+
+    CleanupPath(tempDir);
+}
+
+TEST(JzShaderCooked, ProgramCacheKeyFollowsSourceAndVariant)
+{
+    const auto tempDir = MakeTempDirectory("cache_key");
+    CleanupPath(tempDir);
+
+    JzRE::JzServiceContainer::Init();
+    JzTestDevice testDevice(JzRE::JzERHIType::OpenGL);
+    JzRE::JzServiceContainer::Provide<JzRE::JzDevice>(testDevice);
+
+    auto manifest = BuildBaseManifest();
+    ASSERT_TRUE(WriteCookedShader(tempDir, manifest));
+
+    JzRE::JzShader shader((tempDir / "unit_shader.jzshader").string());
+    ASSERT_TRUE(shader.Load());
+    const auto mainKey = testDevice.GetLastPipelineDesc().cacheKey;
+    ASSERT_NE(shader.GetVariant(1), nullptr);
+    const auto variantKey = testDevice.GetLastPipelineDesc().cacheKey;
+
+    EXPECT_FALSE(mainKey.empty());
+    EXPECT_NE(mainKey, variantKey);
+
+    // Recooked source: binaries of the old source must not be reused
+    manifest["sourceHash"] = "changed_hash";
+    ASSERT_TRUE(WriteCookedShader(tempDir, manifest));
+    ASSERT_TRUE(shader.Reload());
+    EXPECT_NE(testDevice.GetLastPipelineDesc().cacheKey, mainKey);
+
+    CleanupPath(tempDir);
+}
@@ -0,0 +1,219 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Function/Rendering/JzShadowAtlas.h"
+
+using namespace JzRE;
+
+namespace {
+
+JzLightData MakeSun(U32 entityId)
+{
+    JzLightData light{};
+    light.type       = JzELightType::Directional;
+    light.direction  = JzVec3(0.3f, -1.0f, -0.4f).Normalized();
+    light.color      = JzVec3(1.0f, 1.0f, 1.0f);
+    light.intensity  = 1.0f;
+    light.entity     = static_cast<JzEntity>(entityId);
+    light.castShadow = true;
+    return light;
+}
+
+JzLightData MakeSpot(U32 entityId, JzVec3 position, F32 range)
+{
+    JzLightData light{};
+    light.type        = JzELightType::Spot;
+    light.position    = position;
+    light.direction   = JzVec3(0.0f, -1.0f, 0.0f);
+    light.color       = JzVec3(1.0f, 1.0f, 1.0f);
+    light.intensity   = 1.0f;
+    light.range       = range;
+    light.innerCutoff = 20.0f;
+    light.outerCutoff = 30.0f;
+    light.entity      = static_cast<JzEntity>(entityId);
+    light.castShadow  = true;
+    return light;
+}
+
+JzRenderSnapshotDraw MakeDraw(U32 entityId, JzVec3 position, Bool isStatic)
+{
+    JzRenderSnapshotDraw draw;
+    draw.entity       = static_cast<JzEntity>(entityId);
+    draw.modelMatrix  = JzMat4x4::Translate(position);
+    draw.boundsCenter = position;
+    draw.boundsRadius = 1.0f;
+    draw.isStatic     = isStatic;
+    return draw;
+}
+
+JzMat4 Projection()
+{
+    return JzMat4x4::Perspective(1.0471976f, 16.0f / 9.0f, 0.1f, 200.0f);
+}
+
+JzMat4 CameraAt(JzVec3 position)
+{
+    return JzMat4x4::LookAt(position, position + JzVec3(0.0f, 0.0f, -1.0f), JzVec3(0.0f, 1.0f, 0.0f));
+}
+
+Bool Refreshes(const JzShadowAtlas &atlas, U32 viewIndex)
+{
+    const auto &refresh = atlas.GetRefreshViews();
+    return std::find(refresh.begin(), refresh.end(), viewIndex) != refresh.end();
+}
+
+} // namespace
+
+TEST(JzShadowAtlas, CascadesAreTexelSnapped)
+{
+    JzShadowAtlasSettings settings;
+    settings.refreshBudget = 16;
+    JzShadowAtlas atlas(settings);
+
+    const std::vector<JzLightData> lights = {MakeSun(1)};
+    atlas.Plan(lights, {}, CameraAt(JzVec3(0.0f, 2.0f, 0.0f)), Projection());
+    ASSERT_EQ(atlas.GetViews().size(), 3u);
+    EXPECT_EQ(atlas.GetLightShadow(0).viewCount, 3u);
+
+    const auto  first     = atlas.GetViews();
+    const F32   texelSize = first[0].texelWorldSize;
+    const auto &snapped   = first[0].projectionMatrix;
+
+    // A move well under a texel keeps every cascade in place
+    atlas.Plan(lights, {}, CameraAt(JzVec3(texelSize * 0.01f, 2.0f, 0.0f)), Projection());
+    for (U32 cascade = 0; cascade < 3; ++cascade) {
+        const auto &before = first[cascade].projectionMatrix;
+        const auto &after  = atlas.GetViews()[cascade].projectionMatrix;
+        for (U32 i = 0; i < 16; ++i) {
+            EXPECT_FLOAT_EQ(before.Data()[i], after.Data()[i]);
+        }
+    }
+
+    // Turning the camera keeps the cascade size, so texels do not swim
+    const JzMat4 turned = JzMat4x4::LookAt(JzVec3(0.0f, 2.0f, 0.0f), JzVec3(1.0f, 2.0f, -1.0f),
+                                           JzVec3(0.0f, 1.0f, 0.0f));
+    atlas.Plan(lights, {}, turned, Projection());
+    EXPECT_FLOAT_EQ(atlas.GetViews()[0].texelWorldSize, texelSize);
+    EXPECT_FLOAT_EQ(atlas.GetViews()[0].projectionMatrix.m00, snapped.m00);
+
+    // Cascades grow outward and the last one ends at the shadow distance
+    EXPECT_LT(first[0].splitDepth, first[1].splitDepth);
+    EXPECT_NEAR(first[2].splitDepth, settings.shadowDistance, 1e-3f);
+}
+
+TEST(JzShadowAtlas, StaticTilesAreCachedUntilACasterMoves)
+{
+    JzShadowAtlas atlas;
+
+    const std::vector<JzLightData> lights = {MakeSpot(1, JzVec3(0.0f, 10.0f, -10.0f), 30.0f)};
+    std::vector<JzRenderSnapshotDraw> draws  = {MakeDraw(2, JzVec3(0.0f, 0.0f, -10.0f), true),
+                                                MakeDraw(3, JzVec3(100.0f, 0.0f, 0.0f), false)};
+    const JzMat4 view = CameraAt(JzVec3(0.0f, 2.0f, 0.0f));
+
+    atlas.Plan(lights, draws, view, Projection());
+    ASSERT_EQ(atlas.GetViews().size(), 1u);
+    EXPECT_TRUE(atlas.GetViews()[0].staticOnly);
+    EXPECT_EQ(atlas.GetViews()[0].casters, std::vector<U32>{0});
+    EXPECT_TRUE(Refreshes(atlas, 0));
+
+    // Nothing changed, so the cached tile is used as is
+    atlas.Plan(lights, draws, view, Projection());
+    EXPECT_TRUE(atlas.GetRefreshViews().empty());
+    EXPECT_TRUE(atlas.GetViews()[0].valid);
+
+    draws[0] = MakeDraw(2, JzVec3(0.5f, 0.0f, -10.0f), true);
+    atlas.Plan(lights, draws, view, Projection());
+    EXPECT_TRUE(Refreshes(atlas, 0));
+
+    // A moving light invalidates the tile as well
+    auto movedLights        = lights;
+    movedLights[0].position = JzVec3(1.0f, 10.0f, -10.0f);
+    atlas.Plan(movedLights, draws, view, Projection());
+    EXPECT_TRUE(Refreshes(atlas, 0));
+}
+
+TEST(JzShadowAtlas, DynamicCastersRefreshEveryFrame)
+{
+    JzShadowAtlas atlas;
+
+    const std::vector<JzLightData>          lights = {MakeSpot(1, JzVec3(0.0f, 10.0f, -10.0f), 30.0f)};
+    const std::vector<JzRenderSnapshotDraw> draws  = {MakeDraw(2, JzVec3(0.0f, 0.0f, -10.0f), true),
+                                                      MakeDraw(3, JzVec3(1.0f, 0.0f, -10.0f), false)};
+    const JzMat4 view = CameraAt(JzVec3(0.0f, 2.0f, 0.0f));
+
+    for (U32 frame = 0; frame < 3; ++frame) {
+        atlas.Plan(lights, draws, view, Projection());
+        EXPECT_FALSE(atlas.GetViews()[0].staticOnly);
+        EXPECT_TRUE(Refreshes(atlas, 0));
+    }
+}
+
+TEST(JzShadowAtlas, RefreshBudgetPrefersCoverageAndAgesWaitingTiles)
+{
+    JzShadowAtlasSettings settings;
+    settings.refreshBudget = 1;
+    JzShadowAtlas atlas(settings);
+
+    // A large light around the camera and a small one far away, both with dynamic casters
+    const std::vector<JzLightData> lights = {MakeSpot(1, JzVec3(0.0f, 6.0f, -60.0f), 2.0f),
+                                             MakeSpot(2, JzVec3(0.0f, 6.0f, -5.0f), 30.0f)};
+    const std::vector<JzRenderSnapshotDraw> draws = {MakeDraw(3, JzVec3(0.0f, 0.0f, -5.0f), false),
+                                                     MakeDraw(4, JzVec3(0.0f, 5.0f, -60.0f), false)};
+    const JzMat4 view = CameraAt(JzVec3(0.0f, 2.0f, 0.0f));
+
+    atlas.Plan(lights, draws, view, Projection());
+    ASSERT_EQ(atlas.GetViews().size(), 2u);
+    ASSERT_EQ(atlas.GetRefreshViews().size(), 1u);
+    EXPECT_GT(atlas.GetViews()[1].coverage, atlas.GetViews()[0].coverage);
+    EXPECT_EQ(atlas.GetRefreshViews()[0], 1u);
+
+    // The small light is never drawn yet, so it samples as unshadowed
+    EXPECT_FALSE(atlas.GetViews()[0].valid);
+
+    // Waiting raises its priority until it gets a turn
+    Bool smallRefreshed = false;
+    for (U32 frame = 0; frame < 64 && !smallRefreshed; ++frame) {
+        atlas.Plan(lights, draws, view, Projection());
+        smallRefreshed = Refreshes(atlas, 0);
+    }
+    EXPECT_TRUE(smallRefreshed);
+}
+
+TEST(JzShadowAtlas, ViewsKeepTheirTiles)
+{
+    JzShadowAtlasSettings settings;
+    settings.atlasSize = 2048;
+    JzShadowAtlas atlas(settings);
+    ASSERT_EQ(atlas.GetTileCount(), 4u);
+
+    const JzMat4 view  = CameraAt(JzVec3(0.0f, 2.0f, 0.0f));
+    auto         spotA = MakeSpot(1, JzVec3(0.0f, 6.0f, -5.0f), 10.0f);
+    auto         spotB = MakeSpot(2, JzVec3(5.0f, 6.0f, -5.0f), 10.0f);
+
+    atlas.Plan({spotA, spotB}, {}, view, Projection());
+    const U32 tileB = atlas.GetViews()[1].tile;
+
+    // Removing a light frees its tile without moving the others
+    atlas.Plan({spotB}, {}, view, Projection());
+    ASSERT_EQ(atlas.GetViews().size(), 1u);
+    EXPECT_EQ(atlas.GetViews()[0].tile, tileB);
+
+    const JzIVec2 origin = atlas.GetTileOrigin(3);
+    EXPECT_EQ(origin.x, 1024);
+    EXPECT_EQ(origin.y, 1024);
+
+    // Views beyond the tile count cast no shadow
+    std::vector<JzLightData> many;
+    for (U32 i = 0; i < 6; ++i) {
+        many.push_back(MakeSpot(10 + i, JzVec3(static_cast<F32>(i), 6.0f, -5.0f), 10.0f));
+    }
+    atlas.Plan(many, {}, view, Projection());
+    EXPECT_EQ(atlas.GetViews().size(), 4u);
+}
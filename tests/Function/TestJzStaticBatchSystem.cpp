@@ -0,0 +1,398 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Core/JzServiceContainer.h"
+#include "JzRE/Runtime/Function/ECS/JzAssetComponents.h"
+#include "JzRE/Runtime/Function/ECS/JzAssetSystem.h"
+#include "JzRE/Runtime/Function/ECS/JzEntityComponents.h"
+#include "JzRE/Runtime/Function/ECS/JzRenderComponents.h"
+#include "JzRE/Runtime/Function/ECS/JzStaticBatchSystem.h"
+#include "JzRE/Runtime/Function/ECS/JzTransformComponents.h"
+#include "JzRE/Runtime/Function/ECS/JzWorld.h"
+#include "JzRE/Runtime/Platform/RHI/JzDevice.h"
+#include "JzRE/Runtime/Platform/RHI/JzGPUBufferObject.h"
+#include "JzRE/Runtime/Platform/RHI/JzGPUVertexArrayObject.h"
+#include "JzRE/Runtime/Resource/JzMaterial.h"
+#include "JzRE/Runtime/Resource/JzMesh.h"
+
+using namespace JzRE;
+
+namespace {
+
+class JzTestBuffer : public JzGPUBufferObject {
+public:
+    JzTestBuffer(const JzGPUBufferObjectDesc &desc) :
+        JzGPUBufferObject(desc) { }
+
+    void  UpdateData(const void *, Size, Size) override { }
+    void *MapBuffer() override { return nullptr; }
+    void  UnmapBuffer() override { }
+};
+
+class JzTestVertexArray : public JzGPUVertexArrayObject {
+public:
+    void BindVertexBuffer(std::shared_ptr<JzGPUBufferObject>, U32) override { }
+    void BindIndexBuffer(std::shared_ptr<JzGPUBufferObject>) override { }
+    void SetVertexAttribute(U32, U32, U32, U32) override { }
+    void SetVertexAttributeDivisor(U32, U32) override { }
+};
+
+// Device that creates the buffers and vertex arrays a batch mesh needs, and nothing else
+class JzMeshDevice final : public JzDevice {
+public:
+    JzMeshDevice() :
+        JzDevice(JzERHIType::Unknown) { }
+
+    String GetDeviceName() const override { return "Mesh"; }
+    String GetVendorName() const override { return "JzRE"; }
+    String GetDriverVersion() const override { return "0"; }
+
+    std::shared_ptr<JzGPUBufferObject> CreateBuffer(const JzGPUBufferObjectDesc &desc) override
+    {
+        return std::make_shared<JzTestBuffer>(desc);
+    }
+
+    std::shared_ptr<JzGPUVertexArrayObject> CreateVertexArray(const String &) override
+    {
+        return std::make_shared<JzTestVertexArray>();
+    }
+
+    std::shared_ptr<JzGPUTextureObject> CreateTexture(const JzGPUTextureObjectDesc &) override { return nullptr; }
+    std::shared_ptr<JzGPUShaderProgramObject> CreateShader(const JzShaderProgramDesc &) override { return nullptr; }
+    std::shared_ptr<JzRHIPipeline> CreatePipeline(const JzPipelineDesc &) override { return nullptr; }
+    std::shared_ptr<JzGPUFramebufferObject> CreateFramebuffer(const String &) override { return nullptr; }
+    std::shared_ptr<JzRHICommandList> CreateCommandList(const String &) override { return nullptr; }
+
+    void ExecuteCommandList(std::shared_ptr<JzRHICommandList>) override { }
+    void ExecuteCommandLists(const std::vector<std::shared_ptr<JzRHICommandList>> &) override { }
+    void BeginFrame() override { }
+    void EndFrame() override { }
+    void Flush() override { }
+    void Finish() override { }
+    Bool SupportsMultithreading() const override { return false; }
+    Bool SupportsMultiDrawIndirect() const override { return false; }
+    const JzRHIStats &GetStats() const override { return m_stats; }
+
+private:
+    JzRHIStats m_stats;
+};
+
+class JzStaticBatchSystemTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        JzServiceContainer::Provide<JzDevice>(device);
+
+        JzAssetManagerConfig config;
+        config.asyncWorkerCount = 1;
+        assetSystem.Initialize(world, config);
+        JzServiceContainer::Provide<JzAssetSystem>(assetSystem);
+
+        // Unit quad in the XY plane
+        std::vector<JzVertex> vertices(4);
+        vertices[0].Position = JzVec3(-0.5f, -0.5f, 0.0f);
+        vertices[1].Position = JzVec3(0.5f, -0.5f, 0.0f);
+        vertices[2].Position = JzVec3(0.5f, 0.5f, 0.0f);
+        vertices[3].Position = JzVec3(-0.5f, 0.5f, 0.0f);
+        mesh = assetSystem.RegisterAsset<JzMesh>(
+            "test#quad", std::make_shared<JzMesh>(std::move(vertices), std::vector<U32>{0, 1, 2, 0, 2, 3}));
+        material =
+            assetSystem.RegisterAsset<JzMaterial>("test#mat0", std::make_shared<JzMaterial>(JzMaterialProperties{}));
+
+        batchSystem.OnInit(world);
+    }
+
+    void TearDown() override
+    {
+        batchSystem.OnShutdown(world);
+        assetSystem.OnShutdown(world);
+    }
+
+    // Static entity with ready assets, as the asset system leaves it after loading
+    JzEntity CreateStatic(const JzVec3 &position)
+    {
+        auto entity = world.CreateEntity();
+        world.AddComponent<JzTransformComponent>(entity, position);
+        world.AddComponent<JzMeshAssetComponent>(entity, mesh);
+        world.AddComponent<JzMaterialAssetComponent>(entity, material);
+        world.AddComponent<JzAssetReadyTag>(entity);
+        world.AddComponent<JzStaticTag>(entity);
+        return entity;
+    }
+
+    std::vector<JzEntity> Batches()
+    {
+        std::vector<JzEntity> batches;
+        for (auto entity : world.View<JzStaticBatchComponent>()) {
+            batches.push_back(entity);
+        }
+        return batches;
+    }
+
+    // Sources of the only batch, sorted for comparison
+    std::vector<JzEntity> SourcesOf(JzEntity batch)
+    {
+        auto sources = world.GetComponent<JzStaticBatchComponent>(batch).sources;
+        std::sort(sources.begin(), sources.end());
+        return sources;
+    }
+
+    // Static meshes the renderer draws on their own
+    std::vector<JzEntity> Drawn()
+    {
+        std::vector<JzEntity> drawn;
+        for (auto entity :
+             world.View<JzStaticTag, JzMeshAssetComponent>(JzExclude<JzStaticBatchMemberComponent>)) {
+            drawn.push_back(entity);
+        }
+        std::sort(drawn.begin(), drawn.end());
+        return drawn;
+    }
+
+    Bool IsMemberOf(JzEntity entity, JzEntity batch)
+    {
+        const auto *member = world.TryGetComponent<JzStaticBatchMemberComponent>(entity);
+        return member && member->batch == batch;
+    }
+
+    // Largest world-space X among the merged vertices of a batch
+    F32 MaxBatchX(JzEntity batch)
+    {
+        const auto *batchMesh = assetSystem.Get(world.GetComponent<JzMeshAssetComponent>(batch).meshHandle);
+        F32         maxX      = -1.0e9f;
+        for (const auto &vertex : batchMesh->GetVertices()) {
+            maxX = std::max(maxX, vertex.Position.x);
+        }
+        return maxX;
+    }
+
+    void Tick()
+    {
+        batchSystem.Update(world, 0.016f);
+    }
+
+    JzServiceScope      scope;
+    JzMeshDevice        device;
+    JzWorld             world;
+    JzAssetSystem       assetSystem;
+    JzStaticBatchSystem batchSystem;
+    JzMeshHandle        mesh;
+    JzMaterialHandle    material;
+};
+
+} // namespace
+
+TEST_F(JzStaticBatchSystemTest, StaticEntitiesAreMergedAndHidden)
+{
+    const auto a = CreateStatic(JzVec3(0.0f, 0.0f, 0.0f));
+    const auto b = CreateStatic(JzVec3(2.0f, 0.0f, 0.0f));
+    const auto c = CreateStatic(JzVec3(4.0f, 0.0f, 0.0f));
+    Tick();
+
+    const auto batches = Batches();
+    ASSERT_EQ(batches.size(), 1u);
+    const auto batch = batches[0];
+    EXPECT_EQ(SourcesOf(batch), (std::vector<JzEntity>{a, b, c}));
+    EXPECT_TRUE(IsMemberOf(a, batch));
+    EXPECT_TRUE(IsMemberOf(b, batch));
+    EXPECT_TRUE(IsMemberOf(c, batch));
+
+    // Only the batch is drawn, with the merged geometry and world bounds
+    EXPECT_EQ(Drawn(), std::vector<JzEntity>{batch});
+    const auto &meshComp = world.GetComponent<JzMeshAssetComponent>(batch);
+    EXPECT_TRUE(meshComp.isReady);
+    EXPECT_EQ(meshComp.indexCount, 18u);
+    EXPECT_NEAR(meshComp.boundsCenter.x, 2.0f, 1e-4f);
+    EXPECT_NE(assetSystem.Get(meshComp.meshHandle), nullptr);
+
+    // Nothing changed, so the next update keeps the batch
+    Tick();
+    EXPECT_EQ(Batches(), batches);
+}
+
+TEST_F(JzStaticBatchSystemTest, LoneStaticEntityIsNotBatched)
+{
+    const auto a = CreateStatic(JzVec3(0.0f, 0.0f, 0.0f));
+    Tick();
+
+    EXPECT_TRUE(Batches().empty());
+    EXPECT_FALSE(world.HasComponent<JzStaticBatchMemberComponent>(a));
+    EXPECT_EQ(Drawn(), std::vector<JzEntity>{a});
+}
+
+TEST_F(JzStaticBatchSystemTest, EntityMarkedStaticLaterIsBatched)
+{
+    const auto a = CreateStatic(JzVec3(0.0f, 0.0f, 0.0f));
+    const auto b = world.CreateEntity();
+    world.AddComponent<JzTransformComponent>(b, JzVec3(2.0f, 0.0f, 0.0f));
+    world.AddComponent<JzMeshAssetComponent>(b, mesh);
+    world.AddComponent<JzMaterialAssetComponent>(b, material);
+    world.AddComponent<JzAssetReadyTag>(b);
+    Tick();
+    EXPECT_TRUE(Batches().empty());
+
+    world.AddComponent<JzStaticTag>(b);
+    Tick();
+
+    const auto batches = Batches();
+    ASSERT_EQ(batches.size(), 1u);
+    EXPECT_EQ(SourcesOf(batches[0]), (std::vector<JzEntity>{a, b}));
+}
+
+TEST_F(JzStaticBatchSystemTest, RemovingStaticTagDissolvesAndRebatches)
+{
+    const auto a = CreateStatic(JzVec3(0.0f, 0.0f, 0.0f));
+    const auto b = CreateStatic(JzVec3(2.0f, 0.0f, 0.0f));
+    const auto c = CreateStatic(JzVec3(4.0f, 0.0f, 0.0f));
+    Tick();
+    ASSERT_EQ(Batches().size(), 1u);
+    const auto oldBatch = Batches()[0];
+
+    world.RemoveComponent<JzStaticTag>(b);
+    Tick();
+
+    EXPECT_FALSE(world.IsValid(oldBatch));
+    const auto batches = Batches();
+    ASSERT_EQ(batches.size(), 1u);
+    EXPECT_EQ(SourcesOf(batches[0]), (std::vector<JzEntity>{a, c}));
+    EXPECT_TRUE(IsMemberOf(a, batches[0]));
+    EXPECT_TRUE(IsMemberOf(c, batches[0]));
+
+    // The dynamic entity draws itself again
+    EXPECT_FALSE(world.HasComponent<JzStaticBatchMemberComponent>(b));
+}
+
+TEST_F(JzStaticBatchSystemTest, DestroyingMemberDissolvesAndRebatches)
+{
+    const auto a = CreateStatic(JzVec3(0.0f, 0.0f, 0.0f));
+    const auto b = CreateStatic(JzVec3(2.0f, 0.0f, 0.0f));
+    const auto c = CreateStatic(JzVec3(4.0f, 0.0f, 0.0f));
+    Tick();
+    ASSERT_EQ(Batches().size(), 1u);
+    const auto oldBatch = Batches()[0];
+
+    world.DestroyEntity(a);
+    Tick();
+
+    EXPECT_FALSE(world.IsValid(oldBatch));
+    const auto batches = Batches();
+    ASSERT_EQ(batches.size(), 1u);
+    EXPECT_EQ(SourcesOf(batches[0]), (std::vector<JzEntity>{b, c}));
+    EXPECT_EQ(Drawn(), std::vector<JzEntity>{batches[0]});
+}
+
+TEST_F(JzStaticBatchSystemTest, LastTwoMembersFallBackToSeparateDraws)
+{
+    const auto a = CreateStatic(JzVec3(0.0f, 0.0f, 0.0f));
+    const auto b = CreateStatic(JzVec3(2.0f, 0.0f, 0.0f));
+    Tick();
+    ASSERT_EQ(Batches().size(), 1u);
+
+    world.DestroyEntity(a);
+    Tick();
+
+    EXPECT_TRUE(Batches().empty());
+    EXPECT_FALSE(world.HasComponent<JzStaticBatchMemberComponent>(b));
+    EXPECT_EQ(Drawn(), std::vector<JzEntity>{b});
+}
+
+TEST_F(JzStaticBatchSystemTest, OrphanedMembersAreReleasedAndRebatched)
+{
+    const auto a = CreateStatic(JzVec3(0.0f, 0.0f, 0.0f));
+    const auto b = CreateStatic(JzVec3(2.0f, 0.0f, 0.0f));
+    Tick();
+    ASSERT_EQ(Batches().size(), 1u);
+    const auto oldBatch = Batches()[0];
+
+    // Destroyed from outside, e.g. by a scene unload
+    world.DestroyEntity(oldBatch);
+    EXPECT_TRUE(world.HasComponent<JzStaticBatchMemberComponent>(a));
+    EXPECT_TRUE(Drawn().empty());
+
+    Tick();
+
+    const auto batches = Batches();
+    ASSERT_EQ(batches.size(), 1u);
+    EXPECT_NE(batches[0], oldBatch);
+    EXPECT_EQ(SourcesOf(batches[0]), (std::vector<JzEntity>{a, b}));
+    EXPECT_TRUE(IsMemberOf(a, batches[0]));
+    EXPECT_TRUE(IsMemberOf(b, batches[0]));
+}
+
+TEST_F(JzStaticBatchSystemTest, PatchedMemberTransformRebatchesWithNewVertices)
+{
+    const auto a = CreateStatic(JzVec3(0.0f, 0.0f, 0.0f));
+    const auto b = CreateStatic(JzVec3(2.0f, 0.0f, 0.0f));
+    const auto c = CreateStatic(JzVec3(4.0f, 0.0f, 0.0f));
+    Tick();
+    ASSERT_EQ(Batches().size(), 1u);
+    const auto oldBatch = Batches()[0];
+    EXPECT_NEAR(MaxBatchX(oldBatch), 4.5f, 1e-4f);
+
+    world.PatchComponent<JzTransformComponent>(c, [](auto &transform) {
+        transform.position = JzVec3(6.0f, 0.0f, 0.0f);
+        transform.SetDirty();
+    });
+    Tick();
+
+    EXPECT_FALSE(world.IsValid(oldBatch));
+    const auto batches = Batches();
+    ASSERT_EQ(batches.size(), 1u);
+    EXPECT_EQ(SourcesOf(batches[0]), (std::vector<JzEntity>{a, b, c}));
+    EXPECT_NEAR(MaxBatchX(batches[0]), 6.5f, 1e-4f);
+}
+
+TEST_F(JzStaticBatchSystemTest, MemberMovedInPlaceLeavesBatch)
+{
+    const auto a = CreateStatic(JzVec3(0.0f, 0.0f, 0.0f));
+    const auto b = CreateStatic(JzVec3(2.0f, 0.0f, 0.0f));
+    const auto c = CreateStatic(JzVec3(4.0f, 0.0f, 0.0f));
+    Tick();
+    ASSERT_EQ(Batches().size(), 1u);
+
+    // Edited through a reference, as the inspector and scripts do
+    auto &transform    = world.GetComponent<JzTransformComponent>(c);
+    transform.position = JzVec3(100.0f, 0.0f, 0.0f);
+    transform.SetDirty();
+    Tick();
+
+    // The moved entity lands in another chunk on its own and is drawn unbatched
+    const auto batches = Batches();
+    ASSERT_EQ(batches.size(), 1u);
+    EXPECT_EQ(SourcesOf(batches[0]), (std::vector<JzEntity>{a, b}));
+    EXPECT_NEAR(MaxBatchX(batches[0]), 2.5f, 1e-4f);
+    EXPECT_FALSE(world.HasComponent<JzStaticBatchMemberComponent>(c));
+    EXPECT_EQ(Drawn(), (std::vector<JzEntity>{std::min(batches[0], c), std::max(batches[0], c)}));
+
+    // Settled: the next update keeps the new batch
+    Tick();
+    EXPECT_EQ(Batches(), batches);
+}
+
+TEST_F(JzStaticBatchSystemTest, RebuildReplacesEveryBatch)
+{
+    const auto a = CreateStatic(JzVec3(0.0f, 0.0f, 0.0f));
+    const auto b = CreateStatic(JzVec3(2.0f, 0.0f, 0.0f));
+    Tick();
+    ASSERT_EQ(Batches().size(), 1u);
+    const auto oldBatch = Batches()[0];
+
+    batchSystem.Rebuild(world);
+    EXPECT_FALSE(world.IsValid(oldBatch));
+    EXPECT_FALSE(world.HasComponent<JzStaticBatchMemberComponent>(a));
+
+    Tick();
+    const auto batches = Batches();
+    ASSERT_EQ(batches.size(), 1u);
+    EXPECT_EQ(SourcesOf(batches[0]), (std::vector<JzEntity>{a, b}));
+    EXPECT_TRUE(IsMemberOf(a, batches[0]));
+    EXPECT_TRUE(IsMemberOf(b, batches[0]));
+}
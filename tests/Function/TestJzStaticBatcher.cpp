@@ -0,0 +1,180 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Function/Rendering/JzStaticBatcher.h"
+
+using namespace JzRE;
+
+namespace {
+
+/**
+ * @brief Unit quad in the XY plane facing +Z.
+ */
+struct JzQuad {
+    std::vector<JzVertex> vertices;
+    std::vector<U32>      indices{0, 1, 2, 0, 2, 3};
+
+    JzQuad()
+    {
+        const JzVec3 corners[4] = {{-0.5f, -0.5f, 0.0f}, {0.5f, -0.5f, 0.0f}, {0.5f, 0.5f, 0.0f}, {-0.5f, 0.5f, 0.0f}};
+        for (const auto &corner : corners) {
+            JzVertex vertex;
+            vertex.Position  = corner;
+            vertex.Normal    = JzVec3(0.0f, 0.0f, 1.0f);
+            vertex.Tangent   = JzVec3(1.0f, 0.0f, 0.0f);
+            vertex.Bitangent = JzVec3(0.0f, 1.0f, 0.0f);
+            vertices.push_back(vertex);
+        }
+    }
+};
+
+JzStaticBatchInput MakeInput(const JzQuad &quad, const JzMat4 &worldMatrix, U64 groupKey = 0)
+{
+    JzStaticBatchInput input;
+    input.vertices    = &quad.vertices;
+    input.indices     = &quad.indices;
+    input.worldMatrix = worldMatrix;
+    input.groupKey    = groupKey;
+    return input;
+}
+
+JzVec3 FaceNormal(const JzStaticBatchChunk &chunk, Size triangle)
+{
+    const JzVec3 &a = chunk.vertices[chunk.indices[triangle * 3 + 0]].Position;
+    const JzVec3 &b = chunk.vertices[chunk.indices[triangle * 3 + 1]].Position;
+    const JzVec3 &c = chunk.vertices[chunk.indices[triangle * 3 + 2]].Position;
+    return (b - a).Cross(c - a).Normalized();
+}
+
+} // namespace
+
+TEST(JzStaticBatcher, MergesInstancesPerCellAndGroup)
+{
+    const JzQuad                    quad;
+    std::vector<JzStaticBatchInput> inputs;
+
+    // 100 quads of one material in one cell, 50 of another material, 10 in a far cell
+    for (U32 i = 0; i < 100; ++i) {
+        const JzVec3 position(static_cast<F32>(i % 10) + 1.0f, 1.0f, static_cast<F32>(i / 10) + 1.0f);
+        inputs.push_back(MakeInput(quad, JzMat4x4::Translate(position), 1));
+    }
+    for (U32 i = 0; i < 50; ++i) {
+        inputs.push_back(MakeInput(quad, JzMat4x4::Translate(JzVec3(static_cast<F32>(i % 10) + 1.0f, 2.0f, 1.0f)), 2));
+    }
+    for (U32 i = 0; i < 10; ++i) {
+        inputs.push_back(MakeInput(quad, JzMat4x4::Translate(JzVec3(100.0f + static_cast<F32>(i), 1.0f, 1.0f)), 1));
+    }
+
+    const auto chunks = JzStaticBatcher::Build(inputs);
+    ASSERT_EQ(chunks.size(), 3u);
+
+    EXPECT_EQ(chunks[0].groupKey, 1u);
+    EXPECT_EQ(chunks[0].inputs.size(), 100u);
+    EXPECT_EQ(chunks[0].indices.size(), 600u);
+    EXPECT_EQ(chunks[0].vertices.size(), 400u);
+    EXPECT_EQ(chunks[1].groupKey, 1u);
+    EXPECT_EQ(chunks[1].inputs.size(), 10u);
+    EXPECT_EQ(chunks[2].groupKey, 2u);
+    EXPECT_EQ(chunks[2].inputs.size(), 50u);
+
+    // Every input ends up in exactly one chunk
+    std::vector<U32> seen(inputs.size(), 0);
+    for (const auto &chunk : chunks) {
+        for (U32 input : chunk.inputs) {
+            ++seen[input];
+        }
+    }
+    for (U32 count : seen) {
+        EXPECT_EQ(count, 1u);
+    }
+}
+
+TEST(JzStaticBatcher, PreTransformsVerticesAndBounds)
+{
+    const JzQuad quad;
+    const JzMat4 world = JzMat4x4::Translate(JzVec3(4.0f, 0.0f, 0.0f)) * JzMat4x4::RotateY(1.5707963f) *
+                         JzMat4x4::Scale(JzVec3(2.0f, 1.0f, 1.0f));
+
+    const auto chunks = JzStaticBatcher::Build({MakeInput(quad, world)});
+    ASSERT_EQ(chunks.size(), 1u);
+    const auto &chunk = chunks[0];
+
+    for (Size i = 0; i < chunk.vertices.size(); ++i) {
+        const JzVec4 expected = world * JzVec4(quad.vertices[i].Position.x, quad.vertices[i].Position.y,
+                                               quad.vertices[i].Position.z, 1.0f);
+        EXPECT_NEAR(chunk.vertices[i].Position.x, expected.x, 1e-5f);
+        EXPECT_NEAR(chunk.vertices[i].Position.y, expected.y, 1e-5f);
+        EXPECT_NEAR(chunk.vertices[i].Position.z, expected.z, 1e-5f);
+
+        // The quad now faces along +X (or -X), with unit normals and tangents
+        EXPECT_NEAR(std::abs(chunk.vertices[i].Normal.x), 1.0f, 1e-5f);
+        EXPECT_NEAR(chunk.vertices[i].Normal.Length(), 1.0f, 1e-5f);
+        EXPECT_NEAR(chunk.vertices[i].Tangent.Length(), 1.0f, 1e-5f);
+
+        // The winding agrees with the transformed normal
+        EXPECT_GT(FaceNormal(chunk, 0).Dot(chunk.vertices[i].Normal), 0.99f);
+
+        EXPECT_LE((chunk.vertices[i].Position - chunk.boundsCenter).Length(), chunk.boundsRadius + 1e-5f);
+    }
+    EXPECT_NEAR(chunk.boundsCenter.x, 4.0f, 1e-5f);
+}
+
+TEST(JzStaticBatcher, MirroredInstancesKeepFacingOutward)
+{
+    const JzQuad quad;
+    const JzMat4 mirror = JzMat4x4::Scale(JzVec3(-1.0f, 1.0f, 1.0f));
+
+    const auto chunks = JzStaticBatcher::Build({MakeInput(quad, mirror)});
+    ASSERT_EQ(chunks.size(), 1u);
+
+    // Mirroring X keeps the +Z normal, so the triangles must be rewound to match it
+    const auto &chunk = chunks[0];
+    for (Size triangle = 0; triangle < 2; ++triangle) {
+        EXPECT_GT(FaceNormal(chunk, triangle).z, 0.99f);
+    }
+    EXPECT_NEAR(chunk.vertices[0].Normal.z, 1.0f, 1e-5f);
+}
+
+TEST(JzStaticBatcher, SplitsChunksAtTheVertexLimit)
+{
+    const JzQuad                    quad;
+    std::vector<JzStaticBatchInput> inputs;
+    for (U32 i = 0; i < 10; ++i) {
+        inputs.push_back(MakeInput(quad, JzMat4x4::Translate(JzVec3(static_cast<F32>(i) + 1.0f, 1.0f, 1.0f))));
+    }
+
+    JzStaticBatchSettings settings;
+    settings.maxVerticesPerChunk = 12;
+
+    const auto chunks = JzStaticBatcher::Build(inputs, settings);
+    ASSERT_EQ(chunks.size(), 4u);
+    for (const auto &chunk : chunks) {
+        EXPECT_LE(chunk.vertices.size(), 12u);
+        for (U32 index : chunk.indices) {
+            EXPECT_LT(index, chunk.vertices.size());
+        }
+    }
+    EXPECT_EQ(chunks.back().inputs.size(), 1u);
+}
+
+TEST(JzStaticBatcher, SkipsEmptyInputs)
+{
+    const JzQuad          quad;
+    std::vector<JzVertex> noVertices;
+    std::vector<U32>      noIndices;
+
+    JzStaticBatchInput empty;
+    empty.vertices = &noVertices;
+    empty.indices  = &noIndices;
+
+    const auto chunks = JzStaticBatcher::Build({empty, MakeInput(quad, JzMat4x4::Identity())});
+    ASSERT_EQ(chunks.size(), 1u);
+    EXPECT_EQ(chunks[0].inputs, std::vector<U32>{1});
+}
@@ -0,0 +1,346 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <array>
+#include <cstdlib>
+#include <filesystem>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Resource/JzKtx2.h"
+#include "JzRE/Runtime/Resource/JzTexture.h"
+#include "JzRE/Runtime/Resource/JzTextureCompressor.h"
+
+using namespace JzRE;
+
+namespace {
+
+// Smooth RGBA gradient with a diagonal alpha ramp
+std::vector<U8> MakeGradient(U32 width, U32 height, Bool translucent)
+{
+    std::vector<U8> rgba(static_cast<Size>(width) * height * 4);
+    for (U32 y = 0; y < height; ++y) {
+        for (U32 x = 0; x < width; ++x) {
+            U8 *texel = rgba.data() + (static_cast<Size>(y) * width + x) * 4;
+            texel[0]  = static_cast<U8>(x * 255 / (width - 1));
+            texel[1]  = static_cast<U8>(y * 255 / (height - 1));
+            texel[2]  = static_cast<U8>(128 + (x + y) % 32);
+            texel[3]  = translucent ? static_cast<U8>((x + y) * 255 / (width + height - 2)) : 255;
+        }
+    }
+    return rgba;
+}
+
+std::array<I32, 3> Unpack565(U16 packed)
+{
+    const I32 r = (packed >> 11) & 31;
+    const I32 g = (packed >> 5) & 63;
+    const I32 b = packed & 31;
+    return {(r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)};
+}
+
+// Reference BC1 decoder writing RGBA texels of one block
+void DecodeBC1Block(const U8 *block, std::array<std::array<I32, 4>, 16> &out)
+{
+    const U16 color0 = static_cast<U16>(block[0] | (block[1] << 8));
+    const U16 color1 = static_cast<U16>(block[2] | (block[3] << 8));
+    const auto c0    = Unpack565(color0);
+    const auto c1    = Unpack565(color1);
+
+    std::array<std::array<I32, 4>, 4> palette{};
+    for (Size c = 0; c < 3; ++c) {
+        palette[0][c] = c0[c];
+        palette[1][c] = c1[c];
+        if (color0 > color1) {
+            palette[2][c] = (2 * c0[c] + c1[c]) / 3;
+            palette[3][c] = (c0[c] + 2 * c1[c]) / 3;
+        } else {
+            palette[2][c] = (c0[c] + c1[c]) / 2;
+            palette[3][c] = 0;
+        }
+    }
+    palette[0][3] = palette[1][3] = palette[2][3] = 255;
+    palette[3][3]                                 = color0 > color1 ? 255 : 0;
+
+    const U32 bits = block[4] | (block[5] << 8) | (block[6] << 16) | (static_cast<U32>(block[7]) << 24);
+    for (Size i = 0; i < 16; ++i) {
+        out[i] = palette[(bits >> (i * 2)) & 3];
+    }
+}
+
+// Reference BC4 decoder for one channel of one block
+void DecodeBC4Block(const U8 *block, std::array<I32, 16> &out)
+{
+    const I32          red0 = block[0];
+    const I32          red1 = block[1];
+    std::array<I32, 8> palette{red0, red1};
+    if (red0 > red1) {
+        for (I32 k = 2; k < 8; ++k) {
+            palette[k] = ((8 - k) * red0 + (k - 1) * red1) / 7;
+        }
+    } else {
+        for (I32 k = 2; k < 6; ++k) {
+            palette[k] = ((6 - k) * red0 + (k - 1) * red1) / 5;
+        }
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    U64 bits = 0;
+    for (Size i = 0; i < 6; ++i) {
+        bits |= static_cast<U64>(block[2 + i]) << (i * 8);
+    }
+    for (Size i = 0; i < 16; ++i) {
+        out[i] = palette[(bits >> (i * 3)) & 7];
+    }
+}
+
+// Reference BC7 decoder restricted to mode 6
+Bool DecodeBC7Mode6Block(const U8 *block, std::array<std::array<I32, 4>, 16> &out)
+{
+    U32  position = 0;
+    auto read     = [&](U32 count) {
+        U32 value = 0;
+        for (U32 bit = 0; bit < count; ++bit, ++position) {
+            value |= ((block[position / 8] >> (position % 8)) & 1u) << bit;
+        }
+        return value;
+    };
+
+    if (read(7) != (1u << 6)) {
+        return false;
+    }
+
+    std::array<std::array<U32, 4>, 2> endpoints{};
+    for (Size c = 0; c < 4; ++c) {
+        endpoints[0][c] = read(7);
+        endpoints[1][c] = read(7);
+    }
+    const U32 p0 = read(1);
+    const U32 p1 = read(1);
+    for (Size c = 0; c < 4; ++c) {
+        endpoints[0][c] = (endpoints[0][c] << 1) | p0;
+        endpoints[1][c] = (endpoints[1][c] << 1) | p1;
+    }
+
+    constexpr std::array<I32, 16> kWeights = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+    for (Size i = 0; i < 16; ++i) {
+        const U32 index = read(i == 0 ? 3 : 4);
+        for (Size c = 0; c < 4; ++c) {
+            out[i][c] = ((64 - kWeights[index]) * static_cast<I32>(endpoints[0][c]) +
+                         kWeights[index] * static_cast<I32>(endpoints[1][c]) + 32) >>
+                        6;
+        }
+    }
+    return true;
+}
+
+// Mean absolute error of the first `channels` channels over a block-aligned image
+template <typename DecodeFn>
+F64 MeasureError(const std::vector<U8> &rgba, const std::vector<U8> &encoded, U32 width, U32 height, Size blockSize,
+                 U32 channels, DecodeFn decode)
+{
+    F64  total   = 0.0;
+    Size samples = 0;
+    for (U32 by = 0; by < height / 4; ++by) {
+        for (U32 bx = 0; bx < width / 4; ++bx) {
+            std::array<std::array<I32, 4>, 16> texels{};
+            decode(encoded.data() + (static_cast<Size>(by) * (width / 4) + bx) * blockSize, texels);
+            for (U32 i = 0; i < 16; ++i) {
+                const U8 *source = rgba.data() + ((static_cast<Size>(by) * 4 + i / 4) * width + bx * 4 + i % 4) * 4;
+                for (U32 c = 0; c < channels; ++c) {
+                    total += std::abs(texels[i][c] - static_cast<I32>(source[c]));
+                    ++samples;
+                }
+            }
+        }
+    }
+    return total / static_cast<F64>(samples);
+}
+
+} // namespace
+
+TEST(JzTextureFormat, LevelSizesFollowBlockLayout)
+{
+    EXPECT_TRUE(IsCompressedTextureFormat(JzETextureResourceFormat::BC7));
+    EXPECT_FALSE(IsCompressedTextureFormat(JzETextureResourceFormat::RGBA8));
+
+    EXPECT_EQ(GetTextureLevelSize(JzETextureResourceFormat::RGBA8, 256, 256), 256u * 256u * 4u);
+    EXPECT_EQ(GetTextureLevelSize(JzETextureResourceFormat::BC1, 256, 256), 64u * 64u * 8u);
+    EXPECT_EQ(GetTextureLevelSize(JzETextureResourceFormat::BC7, 256, 256), 64u * 64u * 16u);
+
+    // Partial blocks round up and levels never drop below one block
+    EXPECT_EQ(GetTextureLevelSize(JzETextureResourceFormat::BC1, 5, 3), 2u * 1u * 8u);
+    EXPECT_EQ(GetTextureLevelSize(JzETextureResourceFormat::BC3, 256, 256, 8), 16u);
+
+    EXPECT_EQ(GetTextureMipCount(256, 128), 9u);
+    EXPECT_EQ(GetTextureMipCount(1, 1), 1u);
+
+    JzGPUTextureObjectDesc desc;
+    desc.format    = JzETextureResourceFormat::BC1;
+    desc.width     = 8;
+    desc.height    = 8;
+    desc.mipLevels = 4;
+    EXPECT_EQ(GetTextureMemorySize(desc), 32u + 8u + 8u + 8u);
+}
+
+TEST(JzTextureCompressor, MipChainBoxFiltersDownToOneTexel)
+{
+    // 4x2 checkerboard of black and white averages to mid grey
+    std::vector<U8> rgba(4 * 2 * 4);
+    for (Size i = 0; i < 8; ++i) {
+        const U8 value = ((i % 4) + (i / 4)) % 2 == 0 ? 0 : 255;
+        rgba[i * 4 + 0] = rgba[i * 4 + 1] = rgba[i * 4 + 2] = value;
+        rgba[i * 4 + 3]                                     = 255;
+    }
+
+    const auto levels = JzTextureCompressor::BuildMipChain(rgba.data(), 4, 2);
+    ASSERT_EQ(levels.size(), 3u);
+    EXPECT_EQ(levels[0].size(), 4u * 2u * 4u);
+    EXPECT_EQ(levels[1].size(), 2u * 1u * 4u);
+    EXPECT_EQ(levels[2].size(), 1u * 1u * 4u);
+    EXPECT_EQ(levels[2][0], 128);
+    EXPECT_EQ(levels[2][3], 255);
+}
+
+TEST(JzTextureCompressor, ChoosesBC7OnlyForTranslucentImages)
+{
+    const auto opaque      = MakeGradient(8, 8, false);
+    const auto translucent = MakeGradient(8, 8, true);
+    EXPECT_EQ(JzTextureCompressor::ChooseFormat(opaque.data(), 8, 8), JzETextureResourceFormat::BC1);
+    EXPECT_EQ(JzTextureCompressor::ChooseFormat(translucent.data(), 8, 8), JzETextureResourceFormat::BC7);
+}
+
+TEST(JzTextureCompressor, BC1ReproducesSolidColorsAndTracksGradients)
+{
+    std::vector<U8> solid(4 * 4 * 4);
+    for (Size i = 0; i < 16; ++i) {
+        solid[i * 4 + 0] = 255;
+        solid[i * 4 + 1] = 0;
+        solid[i * 4 + 2] = 255;
+        solid[i * 4 + 3] = 255;
+    }
+    const auto solidBlock = JzTextureCompressor::Encode(solid.data(), 4, 4, JzETextureResourceFormat::BC1);
+    ASSERT_EQ(solidBlock.size(), 8u);
+    EXPECT_DOUBLE_EQ(MeasureError(solid, solidBlock, 4, 4, 8, 4, DecodeBC1Block), 0.0);
+
+    const auto gradient = MakeGradient(32, 32, false);
+    const auto encoded  = JzTextureCompressor::Encode(gradient.data(), 32, 32, JzETextureResourceFormat::BC1);
+    ASSERT_EQ(encoded.size(), 8u * 8u * 8u);
+    EXPECT_LT(MeasureError(gradient, encoded, 32, 32, 8, 3, DecodeBC1Block), 6.0);
+}
+
+TEST(JzTextureCompressor, BC4AndBC5KeepSingleChannelPrecision)
+{
+    const auto gradient = MakeGradient(32, 32, false);
+
+    const auto bc4 = JzTextureCompressor::Encode(gradient.data(), 32, 32, JzETextureResourceFormat::BC4);
+    ASSERT_EQ(bc4.size(), 8u * 8u * 8u);
+    const auto decodeRed = [](const U8 *block, std::array<std::array<I32, 4>, 16> &out) {
+        std::array<I32, 16> red{};
+        DecodeBC4Block(block, red);
+        for (Size i = 0; i < 16; ++i) {
+            out[i][0] = red[i];
+        }
+    };
+    EXPECT_LT(MeasureError(gradient, bc4, 32, 32, 8, 1, decodeRed), 2.0);
+
+    const auto bc5 = JzTextureCompressor::Encode(gradient.data(), 32, 32, JzETextureResourceFormat::BC5);
+    ASSERT_EQ(bc5.size(), 8u * 8u * 16u);
+    const auto decodeRedGreen = [](const U8 *block, std::array<std::array<I32, 4>, 16> &out) {
+        std::array<I32, 16> red{};
+        std::array<I32, 16> green{};
+        DecodeBC4Block(block, red);
+        DecodeBC4Block(block + 8, green);
+        for (Size i = 0; i < 16; ++i) {
+            out[i][0] = red[i];
+            out[i][1] = green[i];
+        }
+    };
+    EXPECT_LT(MeasureError(gradient, bc5, 32, 32, 16, 2, decodeRedGreen), 2.0);
+}
+
+TEST(JzTextureCompressor, BC7Mode6EncodesTranslucentGradients)
+{
+    const auto gradient = MakeGradient(32, 32, true);
+    const auto encoded  = JzTextureCompressor::Encode(gradient.data(), 32, 32, JzETextureResourceFormat::BC7);
+    ASSERT_EQ(encoded.size(), 8u * 8u * 16u);
+
+    Bool       allMode6 = true;
+    const auto decode   = [&allMode6](const U8 *block, std::array<std::array<I32, 4>, 16> &out) {
+        allMode6 = DecodeBC7Mode6Block(block, out) && allMode6;
+    };
+    EXPECT_LT(MeasureError(gradient, encoded, 32, 32, 16, 4, decode), 4.0);
+    EXPECT_TRUE(allMode6);
+}
+
+TEST(JzKtx2, CookedImagesRoundTrip)
+{
+    const auto gradient = MakeGradient(20, 12, false);
+    const auto image    = JzTextureCompressor::Cook(gradient.data(), 20, 12, JzETextureResourceFormat::Unknown);
+    ASSERT_EQ(image.format, JzETextureResourceFormat::BC1);
+    ASSERT_EQ(image.levels.size(), GetTextureMipCount(20, 12));
+
+    const auto bytes = JzKtx2::Encode(image);
+    ASSERT_FALSE(bytes.empty());
+    EXPECT_EQ(bytes[1], 'K');
+    EXPECT_EQ(bytes[2], 'T');
+    EXPECT_EQ(bytes[3], 'X');
+
+    const auto decoded = JzKtx2::Decode(bytes.data(), bytes.size());
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->format, image.format);
+    EXPECT_EQ(decoded->width, 20u);
+    EXPECT_EQ(decoded->height, 12u);
+    EXPECT_EQ(decoded->levels, image.levels);
+
+    // Cooked BC1 with mips is far smaller than the uncompressed base level
+    Size cookedSize = 0;
+    for (const auto &level : decoded->levels) {
+        cookedSize += level.size();
+    }
+    EXPECT_LT(cookedSize * 4, gradient.size());
+}
+
+TEST(JzKtx2, RejectsMalformedData)
+{
+    const auto gradient = MakeGradient(8, 8, false);
+    const auto image    = JzTextureCompressor::Cook(gradient.data(), 8, 8, JzETextureResourceFormat::RGBA8);
+    auto       bytes    = JzKtx2::Encode(image);
+    ASSERT_FALSE(bytes.empty());
+
+    EXPECT_FALSE(JzKtx2::Decode(bytes.data(), bytes.size() - 1).has_value());
+    EXPECT_FALSE(JzKtx2::Decode(bytes.data(), 40).has_value());
+
+    auto badIdentifier = bytes;
+    badIdentifier[0]   = 0;
+    EXPECT_FALSE(JzKtx2::Decode(badIdentifier.data(), badIdentifier.size()).has_value());
+
+    // Supercompressed data (e.g. Basis Universal) is not supported
+    auto supercompressed = bytes;
+    supercompressed[44]  = 1;
+    EXPECT_FALSE(JzKtx2::Decode(supercompressed.data(), supercompressed.size()).has_value());
+
+    JzKtx2Image wrongSize = image;
+    wrongSize.levels[0].pop_back();
+    EXPECT_TRUE(JzKtx2::Encode(wrongSize).empty());
+}
+
+TEST(JzTexture, CookedPathMirrorsContentTree)
+{
+    const std::filesystem::path project = std::filesystem::path("/project");
+    const auto                  content = project / "Content";
+    const auto                  cooked  = project / "Intermediate" / "CookedTextures";
+
+    EXPECT_EQ(JzTexture::GetCookedPath(content / "Textures" / "brick.png", content, cooked),
+              cooked / "Textures" / "brick.png.ktx2");
+    EXPECT_EQ(JzTexture::GetCookedPath(content / "Textures" / ".." / "grass.jpg", content, cooked),
+              cooked / "grass.jpg.ktx2");
+
+    // Sources outside the content root, or no configured roots, have no cooked file
+    EXPECT_TRUE(JzTexture::GetCookedPath(project / "Other" / "brick.png", content, cooked).empty());
+    EXPECT_TRUE(JzTexture::GetCookedPath(content / "brick.png", {}, {}).empty());
+}
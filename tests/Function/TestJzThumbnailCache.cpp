@@ -0,0 +1,176 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Resource/JzThumbnailCache.h"
+
+using namespace JzRE;
+
+namespace {
+
+namespace fs = std::filesystem;
+
+class JzThumbnailCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        const String testName = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        root                  = fs::temp_directory_path() / ("JzREThumbnailCacheTest_" + testName);
+        fs::remove_all(root);
+        fs::create_directories(root / "Cache");
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(root);
+    }
+
+    /**
+     * @brief Write an uncompressed 32 bit TGA, left half red and right half blue
+     */
+    static void WriteSplitImage(const fs::path &path, U32 width, U32 height)
+    {
+        U8 header[18] = {};
+        header[2]     = 2; // Uncompressed true color
+        header[12]    = static_cast<U8>(width & 0xFF);
+        header[13]    = static_cast<U8>(width >> 8);
+        header[14]    = static_cast<U8>(height & 0xFF);
+        header[15]    = static_cast<U8>(height >> 8);
+        header[16]    = 32;
+        header[17]    = 0x28; // Top-left origin, 8 alpha bits
+
+        std::ofstream stream(path, std::ios::binary);
+        stream.write(reinterpret_cast<const char *>(header), sizeof(header));
+        for (U32 y = 0; y < height; ++y) {
+            for (U32 x = 0; x < width; ++x) {
+                const U8 bgra[4] = {static_cast<U8>(x < width / 2 ? 0 : 255), 0, static_cast<U8>(x < width / 2 ? 255 : 0), 255};
+                stream.write(reinterpret_cast<const char *>(bgra), sizeof(bgra));
+            }
+        }
+    }
+
+    static Bool WaitResult(JzThumbnailCache &cache, JzThumbnailResult &result)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (std::chrono::steady_clock::now() < deadline) {
+            if (cache.Poll(result)) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return false;
+    }
+
+    static const U8 *Pixel(const JzThumbnail &thumbnail, U32 x, U32 y)
+    {
+        return thumbnail.pixels.data() + (static_cast<Size>(y) * thumbnail.width + x) * 4;
+    }
+
+    static Size CountCacheFiles(const fs::path &directory)
+    {
+        Size count = 0;
+        for (const auto &entry : fs::directory_iterator(directory)) {
+            count += entry.path().extension() == ".jzthumb" ? 1 : 0;
+        }
+        return count;
+    }
+
+    fs::path root;
+};
+
+} // namespace
+
+TEST_F(JzThumbnailCacheTest, UnsupportedFilesAreRejected)
+{
+    JzThumbnailCache cache({root / "Cache", 32, 1});
+
+    EXPECT_FALSE(cache.Request(root / "notes.txt"));
+    EXPECT_TRUE(JzThumbnailCache::IsSupported("a.png"));
+    EXPECT_TRUE(JzThumbnailCache::IsSupported("a.fbx"));
+    EXPECT_TRUE(JzThumbnailCache::IsSupported("a.ovmat"));
+}
+
+TEST_F(JzThumbnailCacheTest, TextureIsDecodedAndFittedInBackground)
+{
+    WriteSplitImage(root / "split.tga", 128, 64);
+
+    JzThumbnailCache cache({root / "Cache", 32, 1});
+    ASSERT_TRUE(cache.Request(root / "split.tga"));
+
+    JzThumbnailResult result;
+    ASSERT_TRUE(WaitResult(cache, result));
+    ASSERT_TRUE(result.succeeded);
+    EXPECT_EQ(result.path, root / "split.tga");
+    EXPECT_EQ(result.thumbnail.width, 32u);
+    EXPECT_EQ(result.thumbnail.height, 32u);
+    EXPECT_EQ(cache.GetPendingCount(), 0u);
+
+    // 2:1 image is letterboxed: 32x16 centered vertically
+    EXPECT_EQ(Pixel(result.thumbnail, 16, 2)[3], 0);
+    EXPECT_EQ(Pixel(result.thumbnail, 4, 16)[0], 255);
+    EXPECT_EQ(Pixel(result.thumbnail, 4, 16)[2], 0);
+    EXPECT_EQ(Pixel(result.thumbnail, 28, 16)[0], 0);
+    EXPECT_EQ(Pixel(result.thumbnail, 28, 16)[2], 255);
+}
+
+TEST_F(JzThumbnailCacheTest, DiskCacheIsKeyedByContent)
+{
+    WriteSplitImage(root / "first.tga", 64, 64);
+    fs::copy_file(root / "first.tga", root / "second.tga");
+
+    JzThumbnailResult first;
+    {
+        JzThumbnailCache cache({root / "Cache", 32, 1});
+        cache.Request(root / "first.tga");
+        ASSERT_TRUE(WaitResult(cache, first));
+        ASSERT_TRUE(first.succeeded);
+    }
+    EXPECT_EQ(CountCacheFiles(root / "Cache"), 1u);
+
+    JzThumbnailCache  cache({root / "Cache", 32, 1});
+    JzThumbnailResult second;
+    cache.Request(root / "second.tga");
+    ASSERT_TRUE(WaitResult(cache, second));
+    ASSERT_TRUE(second.succeeded);
+    EXPECT_EQ(second.thumbnail.pixels, first.thumbnail.pixels);
+    EXPECT_EQ(CountCacheFiles(root / "Cache"), 1u);
+
+    // Changed content gets its own entry
+    WriteSplitImage(root / "second.tga", 32, 64);
+    cache.Request(root / "second.tga");
+    ASSERT_TRUE(WaitResult(cache, second));
+    EXPECT_EQ(CountCacheFiles(root / "Cache"), 2u);
+}
+
+TEST_F(JzThumbnailCacheTest, MeshFillsTheFrame)
+{
+    // Unit cube
+    const std::vector<JzVec3> positions = {
+        {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1}, {-1, -1, 1}, {1, -1, 1}, {1, 1, 1}, {-1, 1, 1}};
+    const std::vector<U32> indices = {0, 1, 2, 0, 2, 3, 4, 6, 5, 4, 7, 6, 0, 4, 5, 0, 5, 1,
+                                      3, 2, 6, 3, 6, 7, 0, 3, 7, 0, 7, 4, 1, 5, 6, 1, 6, 2};
+
+    const auto thumbnail = JzThumbnailCache::RenderMesh(positions, indices, 32);
+
+    ASSERT_EQ(thumbnail.pixels.size(), 32u * 32u * 4u);
+    EXPECT_EQ(Pixel(thumbnail, 16, 16)[3], 255);
+    EXPECT_EQ(Pixel(thumbnail, 0, 0)[3], 0);
+    EXPECT_EQ(Pixel(thumbnail, 31, 31)[3], 0);
+}
+
+TEST_F(JzThumbnailCacheTest, SwatchIsARoundTintedShape)
+{
+    const auto thumbnail = JzThumbnailCache::RenderSwatch(JzVec3(1.0f, 0.0f, 0.0f), 32);
+
+    const U8 *center = Pixel(thumbnail, 16, 16);
+    EXPECT_EQ(center[3], 255);
+    EXPECT_GT(center[0], center[1]);
+    EXPECT_EQ(Pixel(thumbnail, 0, 0)[3], 0);
+}
@@ -3,6 +3,8 @@
  * @copyright Copyright (c) 2026 JzRE
  */
 
+#include <chrono>
+#include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -72,6 +74,30 @@ public:
     int updateCount = 0;
 };
 
+// A system that runs in the render phase
+class RenderPhaseSystem final : public JzSystem {
+public:
+    void Update(JzWorld &, F32) override
+    {
+        ++updateCount;
+    }
+
+    JzSystemPhase GetPhase() const override
+    {
+        return JzSystemPhase::Render;
+    }
+
+    int updateCount = 0;
+};
+
+class SleepSystem final : public JzSystem {
+public:
+    void Update(JzWorld &, F32) override
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+};
+
 } // namespace
 
 // ===========================================================================
@@ -331,6 +357,96 @@ TEST(JzWorld, MultipleSystemsAllReceiveUpdate)
     EXPECT_EQ(s2->updateCount, 1);
 }
 
+TEST(JzWorld, PhaseRangeUpdateRunsOnlyMatchingSystems)
+{
+    JzWorld world;
+    auto    logic  = world.RegisterSystem<CounterSystem>();
+    auto    render = world.RegisterSystem<RenderPhaseSystem>();
+
+    world.Update(0.016f, JzSystemPhase::Input, JzSystemPhase::Culling);
+    EXPECT_EQ(logic->updateCount, 1);
+    EXPECT_EQ(render->updateCount, 0);
+
+    world.Update(0.016f, JzSystemPhase::Render, JzSystemPhase::Render);
+    EXPECT_EQ(logic->updateCount, 1);
+    EXPECT_EQ(render->updateCount, 1);
+}
+
+TEST(JzWorld, SystemTimingsAreRecordedOnlyWhenEnabled)
+{
+    JzWorld world;
+    world.RegisterSystem<CounterSystem>();
+    world.RegisterSystem<SleepSystem>();
+
+    world.Update(0.016f);
+    const auto &timings = world.GetSystemTimings();
+    ASSERT_EQ(timings.size(), 2u);
+    EXPECT_NE(timings[1].name.find("SleepSystem"), std::string_view::npos);
+    EXPECT_EQ(timings[1].lastUpdateNs, 0u);
+
+    world.SetSystemTimingEnabled(true);
+    world.Update(0.016f);
+    EXPECT_GE(timings[1].lastUpdateNs, 1000000u);
+}
+
+TEST(JzWorld, RecordSystemTimingOverridesDrivenSystems)
+{
+    JzWorld       world;
+    const auto    counter = world.RegisterSystem<CounterSystem>();
+    CounterSystem unregistered;
+
+    world.RecordSystemTiming(*counter, 42);
+    EXPECT_EQ(world.GetSystemTimings()[0].lastUpdateNs, 0u);
+
+    world.SetSystemTimingEnabled(true);
+    world.RecordSystemTiming(*counter, 42);
+    world.RecordSystemTiming(unregistered, 7);
+    ASSERT_EQ(world.GetSystemTimings().size(), 1u);
+    EXPECT_EQ(world.GetSystemTimings()[0].lastUpdateNs, 42u);
+    EXPECT_EQ(counter->updateCount, 0);
+}
+
+// ===========================================================================
+// Component observers
+// ===========================================================================
+
+namespace {
+
+struct ObserverLog {
+    void OnChanged(entt::registry &, JzEntity entity)
+    {
+        entities.push_back(entity);
+    }
+
+    std::vector<JzEntity> entities;
+};
+
+} // namespace
+
+TEST(JzWorld, ObserversSeeConstructAndPatch)
+{
+    JzWorld     world;
+    ObserverLog constructed;
+    ObserverLog updated;
+
+    world.OnConstruct<Position>().connect<&ObserverLog::OnChanged>(constructed);
+    world.OnUpdate<Position>().connect<&ObserverLog::OnChanged>(updated);
+
+    auto e = world.CreateEntity();
+    world.AddComponent<Position>(e);
+    EXPECT_EQ(constructed.entities.size(), 1u);
+    EXPECT_TRUE(updated.entities.empty());
+
+    world.PatchComponent<Position>(e, [](Position &p) { p.x = 3.0f; });
+    ASSERT_EQ(updated.entities.size(), 1u);
+    EXPECT_EQ(updated.entities[0], e);
+    EXPECT_FLOAT_EQ(world.GetComponent<Position>(e).x, 3.0f);
+
+    world.OnUpdate<Position>().disconnect(&updated);
+    world.PatchComponent<Position>(e);
+    EXPECT_EQ(updated.entities.size(), 1u);
+}
+
 // ===========================================================================
 // System shutdown
 // ===========================================================================
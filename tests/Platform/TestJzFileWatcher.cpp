@@ -0,0 +1,263 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Platform/FileSystem/JzFileWatcher.h"
+#include "JzRE/Runtime/Platform/FileSystem/JzPollingFileWatchBackend.h"
+
+using namespace JzRE;
+
+namespace {
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief Backend fed by the test
+ */
+class FakeBackend : public JzIFileWatchBackend {
+public:
+    Bool AddDirectory(const fs::path &, Bool) override
+    {
+        return true;
+    }
+
+    void RemoveDirectory(const fs::path &) override { }
+
+    void Poll(F32, std::vector<JzFileChange> &outChanges) override
+    {
+        outChanges.insert(outChanges.end(), queued.begin(), queued.end());
+        queued.clear();
+    }
+
+    const char *GetName() const override
+    {
+        return "fake";
+    }
+
+    std::vector<JzFileChange> queued;
+};
+
+class JzFileWatcherTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        const String testName = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        root                  = JzFileWatcher::NormalizePath(fs::temp_directory_path() / ("JzREFileWatcherTest_" + testName));
+        fs::remove_all(root);
+        fs::create_directories(root / "sub");
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(root);
+    }
+
+    static void WriteFile(const fs::path &path, const String &content)
+    {
+        std::ofstream stream(path);
+        stream << content;
+    }
+
+    /**
+     * @brief Update until a callback fired or the timeout passed
+     */
+    static void UpdateUntil(JzFileWatcher &watcher, const std::vector<JzFileChange> &received)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (received.empty() && std::chrono::steady_clock::now() < deadline) {
+            watcher.Update(0.01f);
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+    }
+
+    fs::path root;
+};
+
+} // namespace
+
+TEST_F(JzFileWatcherTest, BurstForOnePathIsCoalescedAndDebounced)
+{
+    auto  backend = std::make_unique<FakeBackend>();
+    auto *fake    = backend.get();
+
+    JzFileWatcherConfig config;
+    config.debounceSeconds = 0.1f;
+    JzFileWatcher watcher(std::move(backend), config);
+
+    std::vector<JzFileChange> received;
+    watcher.Watch(root, false, [&](const std::vector<JzFileChange> &changes) {
+        received.insert(received.end(), changes.begin(), changes.end());
+    });
+
+    fake->queued = {{root / "a.lua", JzEFileChangeKind::Modified}, {root / "a.lua", JzEFileChangeKind::Modified}};
+    watcher.Update(0.05f);
+    fake->queued = {{root / "a.lua", JzEFileChangeKind::Modified}};
+    watcher.Update(0.05f);
+    EXPECT_TRUE(received.empty());
+
+    watcher.Update(0.1f);
+    ASSERT_EQ(received.size(), 1u);
+    EXPECT_EQ(received[0].path, root / "a.lua");
+    EXPECT_EQ(received[0].kind, JzEFileChangeKind::Modified);
+}
+
+TEST_F(JzFileWatcherTest, AtomicSaveIsReportedAsModifiedAndTempFilesAreDropped)
+{
+    auto  backend = std::make_unique<FakeBackend>();
+    auto *fake    = backend.get();
+
+    JzFileWatcherConfig config;
+    config.debounceSeconds = 0.0f;
+    JzFileWatcher watcher(std::move(backend), config);
+
+    std::vector<JzFileChange> received;
+    watcher.Watch(root, false, [&](const std::vector<JzFileChange> &changes) {
+        received.insert(received.end(), changes.begin(), changes.end());
+    });
+
+    fake->queued = {{root / "a.lua", JzEFileChangeKind::Removed},
+                    {root / "a.lua.tmp", JzEFileChangeKind::Added},
+                    {root / "a.lua.tmp", JzEFileChangeKind::Removed},
+                    {root / "a.lua", JzEFileChangeKind::Added}};
+    watcher.Update(0.0f);
+
+    ASSERT_EQ(received.size(), 1u);
+    EXPECT_EQ(received[0].path, root / "a.lua");
+    EXPECT_EQ(received[0].kind, JzEFileChangeKind::Modified);
+}
+
+TEST_F(JzFileWatcherTest, ChangesAreRoutedByDirectory)
+{
+    auto  backend = std::make_unique<FakeBackend>();
+    auto *fake    = backend.get();
+
+    JzFileWatcherConfig config;
+    config.debounceSeconds = 0.0f;
+    JzFileWatcher watcher(std::move(backend), config);
+
+    std::vector<JzFileChange> flat;
+    std::vector<JzFileChange> recursive;
+    watcher.Watch(root, false, [&](const std::vector<JzFileChange> &changes) { flat = changes; });
+    watcher.Watch(root, true, [&](const std::vector<JzFileChange> &changes) { recursive = changes; });
+
+    fake->queued = {{root / "a.lua", JzEFileChangeKind::Modified}, {root / "sub" / "b.lua", JzEFileChangeKind::Added}};
+    watcher.Update(0.0f);
+
+    ASSERT_EQ(flat.size(), 1u);
+    EXPECT_EQ(flat[0].path, root / "a.lua");
+    EXPECT_EQ(recursive.size(), 2u);
+}
+
+TEST_F(JzFileWatcherTest, UnwatchedSubscriptionReceivesNothing)
+{
+    auto  backend = std::make_unique<FakeBackend>();
+    auto *fake    = backend.get();
+
+    JzFileWatcherConfig config;
+    config.debounceSeconds = 0.0f;
+    JzFileWatcher watcher(std::move(backend), config);
+
+    I32  calls  = 0;
+    auto handle = watcher.Watch(root, false, [&](const std::vector<JzFileChange> &) { ++calls; });
+    watcher.Unwatch(handle);
+
+    fake->queued = {{root / "a.lua", JzEFileChangeKind::Modified}};
+    watcher.Update(0.0f);
+    EXPECT_EQ(calls, 0);
+}
+
+TEST_F(JzFileWatcherTest, PollingBackendReportsAddModifyRemove)
+{
+    JzFileWatcherConfig config;
+    config.debounceSeconds     = 0.0f;
+    config.pollIntervalSeconds = 0.0f;
+    config.forcePolling        = true;
+    JzFileWatcher watcher(config);
+    EXPECT_STREQ(watcher.GetBackendName(), "polling");
+
+    WriteFile(root / "existing.lua", "v1");
+
+    std::vector<JzFileChange> received;
+    watcher.Watch(root, true, [&](const std::vector<JzFileChange> &changes) { received = changes; });
+
+    WriteFile(root / "sub" / "new.lua", "v1");
+    watcher.Update(0.0f);
+    ASSERT_EQ(received.size(), 1u);
+    EXPECT_EQ(received[0].path, root / "sub" / "new.lua");
+    EXPECT_EQ(received[0].kind, JzEFileChangeKind::Added);
+
+    received.clear();
+    WriteFile(root / "existing.lua", "version 2");
+    watcher.Update(0.0f);
+    ASSERT_EQ(received.size(), 1u);
+    EXPECT_EQ(received[0].kind, JzEFileChangeKind::Modified);
+
+    received.clear();
+    fs::remove(root / "existing.lua");
+    watcher.Update(0.0f);
+    ASSERT_EQ(received.size(), 1u);
+    EXPECT_EQ(received[0].kind, JzEFileChangeKind::Removed);
+}
+
+#ifdef __linux__
+TEST_F(JzFileWatcherTest, NativeBackendReportsWritesInNewSubdirectories)
+{
+    JzFileWatcherConfig config;
+    config.debounceSeconds = 0.0f;
+    JzFileWatcher watcher(config);
+    EXPECT_STREQ(watcher.GetBackendName(), "inotify");
+
+    std::vector<JzFileChange> received;
+    watcher.Watch(root, true, [&](const std::vector<JzFileChange> &changes) {
+        received.insert(received.end(), changes.begin(), changes.end());
+    });
+
+    WriteFile(root / "a.lua", "v1");
+    UpdateUntil(watcher, received);
+    ASSERT_FALSE(received.empty());
+    EXPECT_EQ(received[0].path, root / "a.lua");
+
+    received.clear();
+    fs::create_directories(root / "late");
+    watcher.Update(0.0f);
+    WriteFile(root / "late" / "b.lua", "v1");
+    UpdateUntil(watcher, received);
+    ASSERT_FALSE(received.empty());
+    EXPECT_EQ(received[0].path, root / "late" / "b.lua");
+}
+
+TEST_F(JzFileWatcherTest, NativeBackendFollowsRenamedDirectories)
+{
+    JzFileWatcherConfig config;
+    config.debounceSeconds = 0.0f;
+    JzFileWatcher watcher(config);
+
+    fs::create_directories(root / "sub" / "deep");
+
+    std::vector<JzFileChange> received;
+    watcher.Watch(root, true, [&](const std::vector<JzFileChange> &changes) {
+        received.insert(received.end(), changes.begin(), changes.end());
+    });
+
+    fs::rename(root / "sub", root / "moved");
+    UpdateUntil(watcher, received);
+    ASSERT_EQ(received.size(), 1u);
+    EXPECT_EQ(received[0].kind, JzEFileChangeKind::Renamed);
+    EXPECT_EQ(received[0].path, root / "moved");
+    EXPECT_EQ(received[0].previousPath, root / "sub");
+
+    // The subtree's watches now report the new paths
+    received.clear();
+    WriteFile(root / "moved" / "deep" / "a.lua", "v1");
+    UpdateUntil(watcher, received);
+    ASSERT_FALSE(received.empty());
+    EXPECT_EQ(received[0].path, root / "moved" / "deep" / "a.lua");
+}
+#endif
@@ -0,0 +1,122 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Platform/OpenGL/JzOpenGLProgramCache.h"
+
+using namespace JzRE;
+
+namespace {
+
+namespace fs = std::filesystem;
+
+class JzOpenGLProgramCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        const String testName = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        directory             = fs::temp_directory_path() / ("JzREProgramCacheTest_" + testName);
+        fs::remove_all(directory);
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(directory);
+    }
+
+    static JzOpenGLProgramBinary MakeBinary(char fill)
+    {
+        JzOpenGLProgramBinary binary;
+        binary.format = 0x8E3B;
+        binary.data.assign(64, fill);
+        return binary;
+    }
+
+    Size CountEntries() const
+    {
+        Size count = 0;
+        for (const auto &entry : fs::directory_iterator(directory)) {
+            count += entry.path().extension() == ".glbin" ? 1 : 0;
+        }
+        return count;
+    }
+
+    fs::path directory;
+};
+
+} // namespace
+
+TEST_F(JzOpenGLProgramCacheTest, BinaryRoundTripsForSameKeyAndDriver)
+{
+    JzOpenGLProgramCache cache(directory, "Vendor|Renderer|4.6");
+    ASSERT_TRUE(cache.WriteBinary("unit_hash_0", MakeBinary('a')));
+
+    JzOpenGLProgramBinary binary;
+    ASSERT_TRUE(cache.ReadBinary("unit_hash_0", binary));
+    EXPECT_EQ(binary.format, 0x8E3Bu);
+    EXPECT_EQ(binary.data, MakeBinary('a').data);
+
+    // Entries outlive the cache object
+    JzOpenGLProgramCache reopened(directory, "Vendor|Renderer|4.6");
+    EXPECT_TRUE(reopened.ReadBinary("unit_hash_0", binary));
+    EXPECT_EQ(CountEntries(), 1u);
+}
+
+TEST_F(JzOpenGLProgramCacheTest, KeyIncludesSourceAndVariant)
+{
+    JzOpenGLProgramCache cache(directory, "Vendor|Renderer|4.6");
+    ASSERT_TRUE(cache.WriteBinary("unit_hash_0", MakeBinary('a')));
+    ASSERT_TRUE(cache.WriteBinary("unit_hash_1", MakeBinary('b')));
+
+    JzOpenGLProgramBinary binary;
+    EXPECT_FALSE(cache.ReadBinary("unit_changed_0", binary));
+
+    ASSERT_TRUE(cache.ReadBinary("unit_hash_1", binary));
+    EXPECT_EQ(binary.data, MakeBinary('b').data);
+    EXPECT_EQ(CountEntries(), 2u);
+}
+
+TEST_F(JzOpenGLProgramCacheTest, DriverChangeInvalidatesEntries)
+{
+    {
+        JzOpenGLProgramCache cache(directory, "Vendor|Renderer|4.6 Driver 1");
+        ASSERT_TRUE(cache.WriteBinary("unit_hash_0", MakeBinary('a')));
+    }
+
+    JzOpenGLProgramCache  cache(directory, "Vendor|Renderer|4.6 Driver 2");
+    JzOpenGLProgramBinary binary;
+    EXPECT_FALSE(cache.ReadBinary("unit_hash_0", binary));
+}
+
+TEST_F(JzOpenGLProgramCacheTest, TruncatedEntryIsRejected)
+{
+    JzOpenGLProgramCache cache(directory, "Vendor|Renderer|4.6");
+    ASSERT_TRUE(cache.WriteBinary("unit_hash_0", MakeBinary('a')));
+
+    for (const auto &entry : fs::directory_iterator(directory)) {
+        fs::resize_file(entry.path(), fs::file_size(entry.path()) - 8);
+    }
+
+    JzOpenGLProgramBinary binary;
+    EXPECT_FALSE(cache.ReadBinary("unit_hash_0", binary));
+}
+
+TEST_F(JzOpenGLProgramCacheTest, RemoveDropsOnlyThatEntry)
+{
+    JzOpenGLProgramCache cache(directory, "Vendor|Renderer|4.6");
+    ASSERT_TRUE(cache.WriteBinary("unit_hash_0", MakeBinary('a')));
+    ASSERT_TRUE(cache.WriteBinary("unit_hash_1", MakeBinary('b')));
+
+    cache.Remove("unit_hash_0");
+
+    JzOpenGLProgramBinary binary;
+    EXPECT_FALSE(cache.ReadBinary("unit_hash_0", binary));
+    EXPECT_TRUE(cache.ReadBinary("unit_hash_1", binary));
+    EXPECT_EQ(CountEntries(), 1u);
+}
@@ -0,0 +1,89 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Platform/OpenGL/JzOpenGLStateCache.h"
+
+using JzRE::JzOpenGLStateCache;
+
+TEST(JzOpenGLStateCache, SkipsRedundantBinds)
+{
+    JzOpenGLStateCache cache;
+
+    EXPECT_TRUE(cache.SetProgram(3));
+    EXPECT_FALSE(cache.SetProgram(3));
+    EXPECT_TRUE(cache.SetProgram(4));
+
+    EXPECT_TRUE(cache.SetVertexArray(1));
+    EXPECT_FALSE(cache.SetVertexArray(1));
+
+    EXPECT_TRUE(cache.SetFramebuffer(0));
+    EXPECT_FALSE(cache.SetFramebuffer(0));
+
+    EXPECT_EQ(cache.GetIssuedCount(), 4u);
+    EXPECT_EQ(cache.GetSkippedCount(), 3u);
+}
+
+TEST(JzOpenGLStateCache, TracksTexturesPerUnit)
+{
+    JzOpenGLStateCache cache;
+
+    EXPECT_TRUE(cache.SetTexture(0, GL_TEXTURE_2D, 7));
+    EXPECT_TRUE(cache.SetTexture(1, GL_TEXTURE_2D, 7));
+    EXPECT_FALSE(cache.SetTexture(0, GL_TEXTURE_2D, 7));
+    EXPECT_TRUE(cache.SetTexture(0, GL_TEXTURE_CUBE_MAP, 7));
+}
+
+TEST(JzOpenGLStateCache, TracksRenderState)
+{
+    JzOpenGLStateCache cache;
+
+    EXPECT_TRUE(cache.SetDepthTestEnabled(true));
+    EXPECT_FALSE(cache.SetDepthTestEnabled(true));
+    EXPECT_TRUE(cache.SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
+    EXPECT_FALSE(cache.SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
+    EXPECT_TRUE(cache.SetBlendFunc(GL_SRC_ALPHA, GL_ONE));
+    EXPECT_TRUE(cache.SetViewport(0, 0, 1280, 720));
+    EXPECT_FALSE(cache.SetViewport(0, 0, 1280, 720));
+    EXPECT_TRUE(cache.SetViewport(0, 0, 640, 480));
+}
+
+TEST(JzOpenGLStateCache, InvalidateForcesReissueAndKeepsCounters)
+{
+    JzOpenGLStateCache cache;
+
+    cache.SetProgram(3);
+    cache.SetCullFaceEnabled(true);
+    cache.Invalidate();
+
+    EXPECT_TRUE(cache.SetProgram(3));
+    EXPECT_TRUE(cache.SetCullFaceEnabled(true));
+    EXPECT_EQ(cache.GetIssuedCount(), 4u);
+
+    cache.ResetCounters();
+    EXPECT_EQ(cache.GetIssuedCount(), 0u);
+    EXPECT_EQ(cache.GetSkippedCount(), 0u);
+}
+
+TEST(JzOpenGLStateCache, InvalidateResourceBindingsTouchesEveryUnitAndVertexArray)
+{
+    JzOpenGLStateCache cache;
+
+    cache.SetActiveTextureUnit(1);
+    cache.SetTexture(0, GL_TEXTURE_2D, 5);
+    cache.SetTexture(1, GL_TEXTURE_2D, 6);
+    cache.SetVertexArray(2);
+    cache.SetProgram(9);
+
+    cache.InvalidateResourceBindings();
+
+    // Name 5 may belong to a new texture now, even though unit 0 was not active
+    EXPECT_TRUE(cache.SetTexture(0, GL_TEXTURE_2D, 5));
+    EXPECT_TRUE(cache.SetTexture(1, GL_TEXTURE_2D, 6));
+    EXPECT_TRUE(cache.SetVertexArray(2));
+    EXPECT_FALSE(cache.SetProgram(9));
+    EXPECT_FALSE(cache.SetActiveTextureUnit(1));
+}
@@ -0,0 +1,71 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Platform/RHI/JzRHIDeferredRelease.h"
+
+using namespace JzRE;
+
+TEST(JzRHIDeferredRelease, ObjectIsReleasedAfterItsFrames)
+{
+    JzRHIDeferredReleaseQueue<U32> queue;
+    std::vector<U32>               released;
+    const auto                     release = [&released](U32 object) { released.push_back(object); };
+
+    // Framebuffers wait for the frames in flight, images for one more
+    queue.Push(1, 2);
+    queue.Push(2, 3);
+    EXPECT_EQ(queue.GetCount(), 2u);
+
+    queue.Tick(release);
+    EXPECT_TRUE(released.empty());
+
+    queue.Tick(release);
+    EXPECT_EQ(released, std::vector<U32>{1});
+    EXPECT_EQ(queue.GetCount(), 1u);
+
+    queue.Tick(release);
+    EXPECT_EQ(released, (std::vector<U32>{1, 2}));
+    EXPECT_EQ(queue.GetCount(), 0u);
+
+    queue.Tick(release);
+    EXPECT_EQ(released.size(), 2u);
+}
+
+TEST(JzRHIDeferredRelease, ObjectsPushedLaterKeepTheirOwnCount)
+{
+    JzRHIDeferredReleaseQueue<U32> queue;
+    std::vector<U32>               released;
+    const auto                     release = [&released](U32 object) { released.push_back(object); };
+
+    queue.Push(1, 2);
+    queue.Tick(release);
+    queue.Push(2, 2);
+    queue.Push(3, 0); // Treated as one frame
+
+    queue.Tick(release);
+    EXPECT_EQ(released, (std::vector<U32>{1, 3}));
+
+    queue.Tick(release);
+    EXPECT_EQ(released, (std::vector<U32>{1, 3, 2}));
+}
+
+TEST(JzRHIDeferredRelease, ReleaseAllEmptiesTheQueue)
+{
+    JzRHIDeferredReleaseQueue<U32> queue;
+    std::vector<U32>               released;
+
+    queue.Push(1, 3);
+    queue.Push(2, 1);
+    queue.ReleaseAll([&released](U32 object) { released.push_back(object); });
+
+    EXPECT_EQ(released, (std::vector<U32>{1, 2}));
+    EXPECT_EQ(queue.GetCount(), 0u);
+
+    queue.Tick([](U32) { FAIL() << "Nothing is left to release"; });
+}
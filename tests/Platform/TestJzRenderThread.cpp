@@ -0,0 +1,78 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Platform/Threading/JzRenderThread.h"
+
+using namespace JzRE;
+
+TEST(JzRenderThread, KickRunsInlineWhenNotStarted)
+{
+    JzRenderThread renderThread;
+    const auto     caller = std::this_thread::get_id();
+    auto           ranOn  = std::thread::id{};
+
+    renderThread.Kick([&ranOn] { ranOn = std::this_thread::get_id(); });
+
+    EXPECT_EQ(ranOn, caller);
+    EXPECT_EQ(renderThread.GetCompletedFrameCount(), 1u);
+}
+
+TEST(JzRenderThread, FramesRunOnTheRenderThreadInOrder)
+{
+    JzRenderThread renderThread;
+    renderThread.Start("TestRender");
+    ASSERT_TRUE(renderThread.IsRunning());
+    EXPECT_FALSE(renderThread.IsRenderThread());
+
+    std::vector<int> frames;
+    Bool             allOnRenderThread = true;
+    for (int i = 0; i < 16; ++i) {
+        // Written by the game thread before Kick, read by the frame
+        frames.push_back(-1);
+        renderThread.Kick([&frames, &allOnRenderThread, &renderThread, i] {
+            allOnRenderThread = allOnRenderThread && renderThread.IsRenderThread();
+            frames.back()     = i;
+        });
+        renderThread.Wait();
+    }
+    renderThread.Stop();
+
+    EXPECT_TRUE(allOnRenderThread);
+    ASSERT_EQ(frames.size(), 16u);
+    for (int i = 0; i < 16; ++i) {
+        EXPECT_EQ(frames[i], i);
+    }
+    EXPECT_EQ(renderThread.GetCompletedFrameCount(), 16u);
+}
+
+TEST(JzRenderThread, KickWaitsForTheFrameInFlight)
+{
+    JzRenderThread renderThread;
+    renderThread.Start();
+
+    std::atomic<int> inFlight{0};
+    std::atomic<int> maxInFlight{0};
+    for (int i = 0; i < 8; ++i) {
+        renderThread.Kick([&inFlight, &maxInFlight] {
+            const int current = ++inFlight;
+            int       seen    = maxInFlight.load();
+            while (current > seen && !maxInFlight.compare_exchange_weak(seen, current)) { }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            --inFlight;
+        });
+    }
+    renderThread.Stop();
+
+    EXPECT_EQ(maxInFlight.load(), 1);
+    EXPECT_EQ(renderThread.GetCompletedFrameCount(), 8u);
+    EXPECT_FALSE(renderThread.IsRunning());
+}
@@ -0,0 +1,137 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Platform/RHI/JzGPUTextureObject.h"
+
+using namespace JzRE;
+
+namespace {
+
+std::vector<JzGPUTextureMipData> MakeChain(JzETextureResourceFormat format, U32 width, U32 height, U32 firstMip,
+                                           U32 count)
+{
+    std::vector<JzGPUTextureMipData> levels;
+    for (U32 level = firstMip; level < firstMip + count; ++level) {
+        levels.push_back({nullptr, GetTextureLevelSize(format, width, height, level)});
+    }
+    return levels;
+}
+
+} // namespace
+
+TEST(JzTextureUpload, MipCountReachesOneByOne)
+{
+    EXPECT_EQ(GetTextureMipCount(1, 1), 1u);
+    EXPECT_EQ(GetTextureMipCount(0, 0), 1u);
+    EXPECT_EQ(GetTextureMipCount(256, 256), 9u);
+    EXPECT_EQ(GetTextureMipCount(256, 1), 9u);
+    EXPECT_EQ(GetTextureMipCount(300, 20), 9u);
+    EXPECT_EQ(GetTextureMipCount(1, 1025), 11u);
+
+    // The last level of a full chain is 1x1 and the one before it is not
+    const U32 count = GetTextureMipCount(300, 20);
+    EXPECT_EQ(GetTextureLevelExtent(300, count - 1), 1u);
+    EXPECT_EQ(GetTextureLevelExtent(20, count - 1), 1u);
+    EXPECT_GT(GetTextureLevelExtent(300, count - 2), 1u);
+}
+
+TEST(JzTextureUpload, LevelExtentsHalveAndClamp)
+{
+    EXPECT_EQ(GetTextureLevelExtent(300, 0), 300u);
+    EXPECT_EQ(GetTextureLevelExtent(300, 1), 150u);
+    EXPECT_EQ(GetTextureLevelExtent(300, 3), 37u);
+    EXPECT_EQ(GetTextureLevelExtent(300, 9), 1u);
+    EXPECT_EQ(GetTextureLevelExtent(0, 0), 1u);
+    EXPECT_EQ(GetTextureLevelExtent(5, 40), 1u);
+
+    // Blitting level by level gives the same extents as shifting the base
+    U32 width = 300;
+    for (U32 level = 1; level < GetTextureMipCount(300, 300); ++level) {
+        width = std::max<U32>(1, width / 2);
+        EXPECT_EQ(GetTextureLevelExtent(300, level), width);
+    }
+}
+
+TEST(JzTextureUpload, RegionsCoverEveryLevelOfUncompressedChain)
+{
+    const auto format = JzETextureResourceFormat::RGBA8;
+    const auto levels = MakeChain(format, 37, 10, 0, GetTextureMipCount(37, 10));
+
+    std::vector<JzGPUTextureUploadRegion> regions;
+    const Size uploadSize = GetTextureUploadRegions(format, 37, 10, 0, levels, regions);
+
+    ASSERT_EQ(regions.size(), levels.size());
+    for (Size i = 0; i < regions.size(); ++i) {
+        const auto &region = regions[i];
+        EXPECT_EQ(region.mipLevel, static_cast<U32>(i));
+        EXPECT_EQ(region.width, GetTextureLevelExtent(37, region.mipLevel));
+        EXPECT_EQ(region.height, GetTextureLevelExtent(10, region.mipLevel));
+        EXPECT_EQ(levels[i].size, Size{region.width} * region.height * 4);
+        EXPECT_EQ(region.offset % 16, 0u);
+
+        // Levels never overlap and follow each other in order
+        const Size end = region.offset + levels[i].size;
+        if (i + 1 < regions.size()) {
+            EXPECT_LE(end, regions[i + 1].offset);
+            EXPECT_LT(regions[i + 1].offset - end, 16u);
+        } else {
+            EXPECT_EQ(end, uploadSize);
+        }
+    }
+}
+
+TEST(JzTextureUpload, RegionsAlignToTexelAndBlockSize)
+{
+    // RGB8 texels are 3 bytes, so offsets must be multiples of 48
+    const auto rgb = MakeChain(JzETextureResourceFormat::RGB8, 5, 3, 0, 3);
+
+    std::vector<JzGPUTextureUploadRegion> regions;
+    GetTextureUploadRegions(JzETextureResourceFormat::RGB8, 5, 3, 0, rgb, regions);
+    ASSERT_EQ(regions.size(), 3u);
+    EXPECT_EQ(regions[0].offset, 0u);
+    EXPECT_EQ(regions[1].offset, 48u);
+    EXPECT_EQ(regions[2].offset, 96u);
+
+    // BC1 blocks are 8 bytes; the copy offset alignment stays at 16
+    const auto bc1 = MakeChain(JzETextureResourceFormat::BC1, 8, 8, 0, GetTextureMipCount(8, 8));
+    const Size size = GetTextureUploadRegions(JzETextureResourceFormat::BC1, 8, 8, 0, bc1, regions);
+    ASSERT_EQ(regions.size(), 4u);
+    EXPECT_EQ(bc1[0].size, 32u);
+    EXPECT_EQ(bc1[1].size, 8u);
+    EXPECT_EQ(bc1[2].size, 8u);
+    EXPECT_EQ(bc1[3].size, 8u);
+    EXPECT_EQ(regions[1].offset, 32u);
+    EXPECT_EQ(regions[2].offset, 48u);
+    EXPECT_EQ(regions[3].offset, 64u);
+    EXPECT_EQ(size, 72u);
+}
+
+TEST(JzTextureUpload, RegionsStartAtFirstMip)
+{
+    const auto format = JzETextureResourceFormat::RGBA8;
+    const auto levels = MakeChain(format, 64, 16, 2, 2);
+
+    std::vector<JzGPUTextureUploadRegion> regions;
+    const Size uploadSize = GetTextureUploadRegions(format, 64, 16, 2, levels, regions);
+
+    ASSERT_EQ(regions.size(), 2u);
+    EXPECT_EQ(regions[0].mipLevel, 2u);
+    EXPECT_EQ(regions[0].width, 16u);
+    EXPECT_EQ(regions[0].height, 4u);
+    EXPECT_EQ(regions[0].offset, 0u);
+    EXPECT_EQ(regions[1].mipLevel, 3u);
+    EXPECT_EQ(regions[1].width, 8u);
+    EXPECT_EQ(regions[1].height, 2u);
+    EXPECT_EQ(regions[1].offset, 256u);
+    EXPECT_EQ(uploadSize, 256u + 64u);
+
+    EXPECT_EQ(GetTextureUploadRegions(format, 64, 16, 0, {}, regions), 0u);
+    EXPECT_TRUE(regions.empty());
+}
@@ -0,0 +1,121 @@
+/**
+ * @author    Jinzhao Tian
+ * @copyright Copyright (c) 2026 JzRE
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "JzRE/Runtime/Platform/Vulkan/JzVulkanQueueOwnership.h"
+
+using namespace JzRE;
+
+namespace {
+
+VkQueueFamilyProperties Family(VkQueueFlags flags, U32 queueCount = 1)
+{
+    VkQueueFamilyProperties properties{};
+    properties.queueFlags = flags;
+    properties.queueCount = queueCount;
+    return properties;
+}
+
+constexpr VkQueueFlags kGraphics = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+constexpr VkQueueFlags kCompute  = VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+constexpr VkQueueFlags kCopy     = VK_QUEUE_TRANSFER_BIT;
+constexpr U32          kTransfer = 2;
+constexpr U32          kDraw     = 0;
+
+// Barrier UploadLevels records before the copy of a new image
+VkImageMemoryBarrier ToTransfer()
+{
+    VkImageMemoryBarrier barrier{};
+    barrier.sType                       = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.oldLayout                   = VK_IMAGE_LAYOUT_UNDEFINED;
+    barrier.newLayout                   = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.srcQueueFamilyIndex         = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex         = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstAccessMask               = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.subresourceRange.levelCount = 5;
+    barrier.subresourceRange.layerCount = 1;
+    return barrier;
+}
+
+void ExpectShaderReadLayout(const VkImageMemoryBarrier &barrier)
+{
+    EXPECT_EQ(barrier.oldLayout, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    EXPECT_EQ(barrier.newLayout, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    EXPECT_EQ(barrier.subresourceRange.levelCount, 5u);
+}
+
+} // namespace
+
+TEST(JzVulkanQueueOwnership, PureCopyFamilyIsPreferredOverAsyncCompute)
+{
+    const std::vector<VkQueueFamilyProperties> families{Family(kGraphics), Family(kCompute), Family(kCopy)};
+    EXPECT_EQ(FindDedicatedTransferQueueFamily(families), 2u);
+}
+
+TEST(JzVulkanQueueOwnership, AsyncComputeFamilyIsUsedWithoutCopyFamily)
+{
+    const std::vector<VkQueueFamilyProperties> families{Family(kGraphics), Family(kCompute), Family(kCompute)};
+    EXPECT_EQ(FindDedicatedTransferQueueFamily(families), 1u);
+}
+
+TEST(JzVulkanQueueOwnership, GraphicsAndEmptyFamiliesAreNeverPicked)
+{
+    const std::vector<VkQueueFamilyProperties> graphicsOnly{Family(kGraphics), Family(kGraphics)};
+    EXPECT_FALSE(FindDedicatedTransferQueueFamily(graphicsOnly).has_value());
+
+    const std::vector<VkQueueFamilyProperties> emptyCopy{Family(kGraphics), Family(kCopy, 0)};
+    EXPECT_FALSE(FindDedicatedTransferQueueFamily(emptyCopy).has_value());
+
+    EXPECT_FALSE(FindDedicatedTransferQueueFamily({}).has_value());
+}
+
+TEST(JzVulkanQueueOwnership, FirstUploadIsReleasedByTransferAndAcquiredByGraphics)
+{
+    const auto barriers = GetUploadBarriers(ToTransfer(), true, kTransfer, kDraw);
+
+    ASSERT_TRUE(barriers.onTransferQueue);
+
+    // Both halves name the same families and layout change
+    EXPECT_EQ(barriers.release.srcQueueFamilyIndex, kTransfer);
+    EXPECT_EQ(barriers.release.dstQueueFamilyIndex, kDraw);
+    EXPECT_EQ(barriers.acquire.srcQueueFamilyIndex, kTransfer);
+    EXPECT_EQ(barriers.acquire.dstQueueFamilyIndex, kDraw);
+    ExpectShaderReadLayout(barriers.release);
+    ExpectShaderReadLayout(barriers.acquire);
+
+    // The release only makes the copy available, the acquire only makes it visible
+    EXPECT_EQ(barriers.release.srcAccessMask, static_cast<VkAccessFlags>(VK_ACCESS_TRANSFER_WRITE_BIT));
+    EXPECT_EQ(barriers.release.dstAccessMask, 0u);
+    EXPECT_EQ(barriers.acquire.srcAccessMask, 0u);
+    EXPECT_EQ(barriers.acquire.dstAccessMask, static_cast<VkAccessFlags>(VK_ACCESS_SHADER_READ_BIT));
+}
+
+TEST(JzVulkanQueueOwnership, LaterUploadsStayOnGraphicsQueue)
+{
+    auto toTransfer      = ToTransfer();
+    toTransfer.oldLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+    const auto barriers = GetUploadBarriers(toTransfer, false, kTransfer, kDraw);
+
+    EXPECT_FALSE(barriers.onTransferQueue);
+    EXPECT_EQ(barriers.acquire.srcQueueFamilyIndex, VK_QUEUE_FAMILY_IGNORED);
+    EXPECT_EQ(barriers.acquire.dstQueueFamilyIndex, VK_QUEUE_FAMILY_IGNORED);
+    EXPECT_EQ(barriers.acquire.srcAccessMask, static_cast<VkAccessFlags>(VK_ACCESS_TRANSFER_WRITE_BIT));
+    EXPECT_EQ(barriers.acquire.dstAccessMask, static_cast<VkAccessFlags>(VK_ACCESS_SHADER_READ_BIT));
+    ExpectShaderReadLayout(barriers.acquire);
+}
+
+TEST(JzVulkanQueueOwnership, SharedFamilyNeedsNoOwnershipTransfer)
+{
+    const auto barriers = GetUploadBarriers(ToTransfer(), true, kDraw, kDraw);
+
+    EXPECT_FALSE(barriers.onTransferQueue);
+    EXPECT_EQ(barriers.acquire.srcQueueFamilyIndex, VK_QUEUE_FAMILY_IGNORED);
+    EXPECT_EQ(barriers.acquire.dstQueueFamilyIndex, VK_QUEUE_FAMILY_IGNORED);
+    EXPECT_EQ(barriers.acquire.srcAccessMask, static_cast<VkAccessFlags>(VK_ACCESS_TRANSFER_WRITE_BIT));
+}